@@ -131,7 +131,7 @@ FUNC(tpl_app_id, OS_CODE) tpl_check_object_ownership_service(
 #if (TASK_COUNT > 0) || (ISR_COUNT > 0)
       if (obj_id < (TASK_COUNT+ISR_COUNT))
       {
-      result = tpl_stat_proc_table[obj_id]->app_id;
+      result = TPL_STAT_PROC(obj_id)->app_id;
       }
 #endif
       break;
@@ -374,10 +374,10 @@ FUNC(tpl_status, OS_CODE) tpl_terminate_application_service(
 #endif
             tpl_release_internal_resource(proc_id);
             /* reset the task descriptor */
-            tpl_dyn_proc_table[proc_id]->state = SUSPENDED;
-            tpl_dyn_proc_table[proc_id]->activate_count = 0;
-            tpl_dyn_proc_table[proc_id]->priority =
-            tpl_stat_proc_table[proc_id]->base_priority;
+            TPL_DYN_PROC(proc_id)->state = SUSPENDED;
+            TPL_DYN_PROC(proc_id)->activate_count = 0;
+            TPL_DYN_PROC(proc_id)->priority =
+            TPL_STAT_PROC(proc_id)->base_priority;
           }
         }
 #endif
@@ -44,6 +44,182 @@
  */
 tpl_bool tpl_spinlock_resscheduler_taken[NUMBER_OF_CORES] = {FALSE};
 
+#if WITH_SPINLOCK_STATISTICS == YES
+/*
+ * SPINLOCK_SPIN counts an iteration of a spin loop
+ */
+#define SPINLOCK_SPIN(a_spin)   (a_spin)++;
+
+/*
+ * SPINLOCK_RECORD_WAIT updates the statistics of a spinlock that has just
+ * been taken after a_spin iterations of the spin loop
+ */
+#define SPINLOCK_RECORD_WAIT(a_spinlock, a_spin)                              \
+  (a_spinlock)->stats.acquire_count++;                                        \
+  (a_spinlock)->stats.spin_count += (a_spin);                                 \
+  if ((a_spin) > (a_spinlock)->stats.max_wait)                                \
+  {                                                                           \
+    (a_spinlock)->stats.max_wait = (a_spin);                                  \
+  }
+#else
+#define SPINLOCK_SPIN(a_spin)
+#define SPINLOCK_RECORD_WAIT(a_spinlock, a_spin)
+#endif
+
+/*
+ * The lock word of a MCS spinlock and the links of its queue hold the id of
+ * a core plus one, 0 means no core.
+ */
+#define MCS_LINK(a_core_id)     ((tpl_lock)((a_core_id) + 1))
+#define MCS_NO_CORE             ((tpl_lock)0)
+
+FUNC(void, OS_CODE) tpl_lock_spinlock(
+  CONST(uint16, AUTOMATIC) core_id,
+  CONST(tpl_spinlock_id, AUTOMATIC) spinlock_id)
+{
+  CONSTP2VAR(tpl_spinlock, AUTOMATIC, OS_VAR) spinlock =
+    tpl_spinlock_table[spinlock_id];
+  P2VAR(volatile tpl_mcs_node, AUTOMATIC, OS_VAR) node;
+  VAR(tpl_lock, AUTOMATIC) ticket;
+  VAR(tpl_lock, AUTOMATIC) last;
+#if WITH_SPINLOCK_STATISTICS == YES
+  VAR(uint32, AUTOMATIC) spin = 0;
+  VAR(tpl_try_to_get_spinlock_type, AUTOMATIC) success;
+#endif
+
+  switch (spinlock->algorithm)
+  {
+    case TICKET_LOCK :
+      /* take a ticket and wait until it is served */
+      ticket = tpl_fetch_and_increment_lock(&(spinlock->state));
+      while (*(volatile tpl_lock *)&(spinlock->now_serving) != ticket)
+      {
+        SPINLOCK_SPIN(spin)
+      }
+      break;
+
+    case MCS_LOCK :
+      /* enqueue the node of the core, then wait on it for the core ahead */
+      node = &(spinlock->nodes[core_id]);
+      node->next = MCS_NO_CORE;
+      node->locked = LOCKED_LOCK;
+      last = tpl_swap_lock(&(spinlock->state), MCS_LINK(core_id));
+      if (last != MCS_NO_CORE)
+      {
+        tpl_swap_lock(&(spinlock->nodes[last - 1].next), MCS_LINK(core_id));
+        while (node->locked == LOCKED_LOCK)
+        {
+          SPINLOCK_SPIN(spin)
+        }
+      }
+      break;
+
+    default :
+#if WITH_SPINLOCK_STATISTICS == YES
+      tpl_try_to_get_lock(&(spinlock->state), &success);
+      while (success == TRYTOGETSPINLOCK_NOSUCCESS)
+      {
+        SPINLOCK_SPIN(spin)
+        tpl_try_to_get_lock(&(spinlock->state), &success);
+      }
+#else
+      tpl_get_lock(&(spinlock->state));
+#endif
+      break;
+  }
+
+  SPINLOCK_RECORD_WAIT(spinlock, spin)
+}
+
+FUNC(void, OS_CODE) tpl_unlock_spinlock(
+  CONST(uint16, AUTOMATIC) core_id,
+  CONST(tpl_spinlock_id, AUTOMATIC) spinlock_id)
+{
+  CONSTP2VAR(tpl_spinlock, AUTOMATIC, OS_VAR) spinlock =
+    tpl_spinlock_table[spinlock_id];
+  P2VAR(volatile tpl_mcs_node, AUTOMATIC, OS_VAR) node;
+
+  switch (spinlock->algorithm)
+  {
+    case TICKET_LOCK :
+      /* serve the next ticket */
+      tpl_fetch_and_increment_lock(&(spinlock->now_serving));
+      break;
+
+    case MCS_LOCK :
+      node = &(spinlock->nodes[core_id]);
+      /*
+       * Without a successor, the queue is emptied if the core is still the
+       * last one. Otherwise a core is enqueuing, wait for its link.
+       */
+      if ((node->next != MCS_NO_CORE) ||
+          (FALSE == tpl_compare_and_swap_lock(&(spinlock->state),
+                                              MCS_LINK(core_id),
+                                              MCS_NO_CORE)))
+      {
+        while (node->next == MCS_NO_CORE)
+        {
+        }
+        /* hand the lock over to the next core */
+        tpl_swap_lock(&(spinlock->nodes[node->next - 1].locked),
+                      UNLOCKED_LOCK);
+      }
+      break;
+
+    default :
+      tpl_release_lock(&(spinlock->state));
+      break;
+  }
+}
+
+FUNC(void, OS_CODE) tpl_try_to_lock_spinlock(
+  CONST(uint16, AUTOMATIC) core_id,
+  CONST(tpl_spinlock_id, AUTOMATIC) spinlock_id,
+  P2VAR(tpl_try_to_get_spinlock_type, AUTOMATIC, OS_VAR) success)
+{
+  CONSTP2VAR(tpl_spinlock, AUTOMATIC, OS_VAR) spinlock =
+    tpl_spinlock_table[spinlock_id];
+  VAR(tpl_lock, AUTOMATIC) ticket;
+  VAR(tpl_bool, AUTOMATIC) taken;
+#if WITH_SPINLOCK_STATISTICS == YES
+  CONST(uint32, AUTOMATIC) spin = 0;
+#endif
+
+  switch (spinlock->algorithm)
+  {
+    case TICKET_LOCK :
+      /* the lock is free if the next ticket is served, take it */
+      ticket = *(volatile tpl_lock *)&(spinlock->now_serving);
+      taken = tpl_compare_and_swap_lock(&(spinlock->state),
+                                        ticket,
+                                        (tpl_lock)(ticket + 1));
+      break;
+
+    case MCS_LOCK :
+      /* the lock is free if the queue is empty, enqueue the core */
+      spinlock->nodes[core_id].next = MCS_NO_CORE;
+      taken = tpl_compare_and_swap_lock(&(spinlock->state),
+                                        MCS_NO_CORE,
+                                        MCS_LINK(core_id));
+      break;
+
+    default :
+      tpl_try_to_get_lock(&(spinlock->state), success);
+      taken = (*success == TRYTOGETSPINLOCK_SUCCESS);
+      break;
+  }
+
+  if (taken)
+  {
+    *success = TRYTOGETSPINLOCK_SUCCESS;
+    SPINLOCK_RECORD_WAIT(spinlock, spin)
+  }
+  else
+  {
+    *success = TRYTOGETSPINLOCK_NOSUCCESS;
+  }
+}
+
 /*
  *
  */
@@ -54,8 +230,6 @@ FUNC(tpl_status, OS_CODE) tpl_get_spinlock_service(
 
   VAR(tpl_status, AUTOMATIC)  result = E_OK;
 
-  P2VAR(tpl_lock, AUTOMATIC, OS_VAR) lock = NULL_PTR;
-
   /*  store information for error hook routine    */
   STORE_SERVICE(OSServiceId_GetSpinlock)
   STORE_SPINLOCK_ID(spinlock_id)
@@ -78,11 +252,8 @@ FUNC(tpl_status, OS_CODE) tpl_get_spinlock_service(
      * lock method */
     SPINLOCK_SUSPEND_INTERRUPTS(core_id, spinlock_id)
 
-    /*  get the lock descriptor                   */
-    lock = &(tpl_spinlock_table[spinlock_id]->state);
-
     /* get the lock, this call is blocking        */
-    tpl_get_lock(lock);
+    tpl_lock_spinlock(core_id, spinlock_id);
 
     /* get the resscheduler if the spinlock has the associated method */
     SPINLOCK_GET_RESSCHEDULER(core_id, spinlock_id)
@@ -110,8 +281,6 @@ FUNC(tpl_status, OS_CODE) tpl_release_spinlock_service(
 
   VAR(tpl_status, AUTOMATIC)  result = E_OK;
 
-  P2VAR(tpl_lock, AUTOMATIC, OS_VAR) lock = NULL_PTR;
-
   /*  store information for error hook routine    */
   STORE_SERVICE(OSServiceId_ReleaseSpinlock)
   STORE_SPINLOCK_ID(spinlock_id)
@@ -130,11 +299,8 @@ FUNC(tpl_status, OS_CODE) tpl_release_spinlock_service(
 
   IF_NO_EXTENDED_ERROR(result)
   {
-    /*  get the lock descriptor                   */
-    lock = &(tpl_spinlock_table[spinlock_id]->state);
-
-    /* get the lock, this call is blocking        */
-    tpl_release_lock(lock);
+    /* release the lock                           */
+    tpl_unlock_spinlock(core_id, spinlock_id);
 
     /* store id of last released spinlock, so we can check later the nesting order */
     REMOVE_LAST_TAKEN_SPINLOCK(core_id)
@@ -161,8 +327,6 @@ FUNC(tpl_status, OS_CODE) tpl_try_to_get_spinlock_service(
 
   VAR(tpl_status, AUTOMATIC)  result = E_OK;
 
-  P2VAR(tpl_lock, AUTOMATIC, OS_VAR) lock = NULL_PTR;
-
   /*  store information for error hook routine    */
   STORE_SERVICE(OSServiceId_TryToGetSpinlock)
   STORE_SPINLOCK_ID(spinlock_id)
@@ -185,11 +349,8 @@ FUNC(tpl_status, OS_CODE) tpl_try_to_get_spinlock_service(
      * lock method */
     SPINLOCK_SUSPEND_INTERRUPTS(core_id, spinlock_id)
 
-    /*  get the lock descriptor                   */
-    lock = &(tpl_spinlock_table[spinlock_id]->state);
-
     /* get the lock, this call is not blocking        */
-    tpl_try_to_get_lock(lock, success);
+    tpl_try_to_lock_spinlock(core_id, spinlock_id, success);
 
     if (*success == TRYTOGETSPINLOCK_SUCCESS) {
       /* get the resscheduler if the spinlock has the associated method */
@@ -45,21 +45,91 @@
 #define LOCK_ALL_INTERRUPTS         3
 typedef uint8 tpl_lock_method;
 
+/**
+ * @typedef tpl_lock_algorithm
+ *
+ * Trampoline extra. Algorithm used to take the lock of a spinlock:
+ * - TEST_AND_SET_LOCK uses the lock of the target (#tpl_get_lock);
+ * - TICKET_LOCK serves the cores in FIFO order. Each core takes a ticket
+ *   and spins until the ticket is served;
+ * - MCS_LOCK serves the cores in FIFO order too. Each core spins on its own
+ *   queue node, so a release touches the cache line of the next core only.
+ */
+#define TEST_AND_SET_LOCK           0
+#define TICKET_LOCK                 1
+#define MCS_LOCK                    2
+typedef uint8 tpl_lock_algorithm;
+
+#ifndef TPL_CACHE_LINE_SIZE
+#define TPL_CACHE_LINE_SIZE         64
+#endif
+
+/**
+ * @struct TPL_MCS_NODE
+ *
+ * Queue node of a core waiting for a MCS spinlock. A MCS spinlock has one
+ * node per core. The nodes are linked by core: a link is the id of the
+ * core plus one, 0 ends the queue. A node fills a cache line so that a core
+ * spins alone on it.
+ */
+struct TPL_MCS_NODE {
+    VAR(tpl_lock, TYPEDEF) next;    /**< next core in the queue plus one */
+    VAR(tpl_lock, TYPEDEF) locked;  /**< LOCKED_LOCK while the core waits */
+    VAR(uint8, TYPEDEF) padding[TPL_CACHE_LINE_SIZE - 2 * sizeof(tpl_lock)];
+};
+
+/**
+ * @typedef tpl_mcs_node
+ *
+ * This type is an alias for the structure #TPL_MCS_NODE.
+ *
+ * @see #TPL_MCS_NODE
+ */
+typedef struct TPL_MCS_NODE tpl_mcs_node;
+
+#if WITH_SPINLOCK_STATISTICS == YES
+/**
+ * @struct TPL_SPINLOCK_STATS
+ *
+ * Contention statistics of a spinlock. They are updated by the core that
+ * holds the spinlock. The waits are counted in iterations of the spin loop.
+ */
+struct TPL_SPINLOCK_STATS {
+    VAR(uint32, TYPEDEF) acquire_count; /**< number of times it was taken  */
+    VAR(uint32, TYPEDEF) spin_count;    /**< total of the waits            */
+    VAR(uint32, TYPEDEF) max_wait;      /**< longest wait                  */
+};
+
+typedef struct TPL_SPINLOCK_STATS tpl_spinlock_stats;
+#endif
+
 /**
  * @struct TPL_SPINLOCK
  *
- * This structure describes all attributes of a spinlock
+ * This structure describes all attributes of a spinlock. The descriptors
+ * are aligned on a cache line so that two spinlocks do not share one.
  */
 struct TPL_SPINLOCK {
     VAR(tpl_lock, TYPEDEF) state; /**< Lock state. Can be either UNLOCKED_LOCK
-                                       or LOCKED_LOCK                         */
+                                       or LOCKED_LOCK. Next ticket to take
+                                       for a TICKET_LOCK, last core of the
+                                       queue plus one for a MCS_LOCK       */
+    VAR(tpl_lock, TYPEDEF) now_serving; /**< Ticket allowed to take a
+                                             TICKET_LOCK                   */
+    CONSTP2VAR(tpl_mcs_node, TYPEDEF, OS_VAR)
+        nodes;                      /**< Queue nodes of a MCS_LOCK, one per
+                                         core. NULL otherwise              */
     CONST(tpl_lock_method, TYPEDEF) method;
+    CONST(tpl_lock_algorithm, TYPEDEF) algorithm;
 #if WITH_OS_EXTENDED == YES
     CONSTP2CONST(tpl_spinlock_successor_bitfield, TYPEDEF, OS_CONST)
         successors;                 /**< Array of bitfields indexed by a
                                          spinlock_id describing which spinlock
                                          can be taken after this one. */
 #endif
+#if WITH_SPINLOCK_STATISTICS == YES
+    VAR(tpl_spinlock_stats, TYPEDEF) stats;
+#endif
 };
 
 /**
@@ -112,11 +182,9 @@ extern VAR(tpl_spinlock_id, OS_VAR) tpl_taken_spinlock_counter[NUMBER_OF_CORES];
 #define RELEASE_ALL_SPINLOCKS(core_id)                                        \
     {                                                                         \
       VAR(sint32, AUTOMATIC) tmp;                                             \
-      for(tmp = 0; tmp < tpl_taken_spinlock_counter[core_id]; tmp++)          \
+      for(tmp = tpl_taken_spinlock_counter[core_id] - 1; tmp >= 0; tmp--)     \
       {                                                                       \
-        P2VAR(tpl_lock, AUTOMATIC, OS_VAR) lock;                              \
-        lock = &(tpl_spinlock_table[tmp]->state);                             \
-        tpl_release_lock(lock);                                               \
+        tpl_unlock_spinlock(core_id, tpl_taken_spinlocks[core_id][tmp]);      \
       }                                                                       \
       tpl_taken_spinlock_counter[core_id] = 0;                                \
     }
@@ -186,6 +254,46 @@ extern FUNC(void, OS_CODE) tpl_try_to_get_lock(
   CONSTP2VAR(tpl_lock, AUTOMATIC, OS_VAR) lock,
   P2VAR(tpl_try_to_get_spinlock_type, AUTOMATIC, OS_VAR) success);
 
+/**
+ * @internal
+ *
+ * Takes the lock of a spinlock with its algorithm. This call is blocking.
+ *
+ * @param core_id       the core taking the spinlock
+ * @param spinlock_id   identifier of the spinlock
+ */
+extern FUNC(void, OS_CODE) tpl_lock_spinlock(
+  CONST(uint16, AUTOMATIC) core_id,
+  CONST(tpl_spinlock_id, AUTOMATIC) spinlock_id);
+
+/**
+ * @internal
+ *
+ * Releases the lock of a spinlock with its algorithm.
+ *
+ * @param core_id       the core holding the spinlock
+ * @param spinlock_id   identifier of the spinlock
+ */
+extern FUNC(void, OS_CODE) tpl_unlock_spinlock(
+  CONST(uint16, AUTOMATIC) core_id,
+  CONST(tpl_spinlock_id, AUTOMATIC) spinlock_id);
+
+/**
+ * @internal
+ *
+ * Takes the lock of a spinlock with its algorithm if it is free. This call
+ * is not blocking.
+ *
+ * @param core_id       the core taking the spinlock
+ * @param spinlock_id   identifier of the spinlock
+ * @param success       TRYTOGETSPINLOCK_SUCCESS if the lock has been taken,
+ *                      TRYTOGETSPINLOCK_NOSUCCESS otherwise
+ */
+extern FUNC(void, OS_CODE) tpl_try_to_lock_spinlock(
+  CONST(uint16, AUTOMATIC) core_id,
+  CONST(tpl_spinlock_id, AUTOMATIC) spinlock_id,
+  P2VAR(tpl_try_to_get_spinlock_type, AUTOMATIC, OS_VAR) success);
+
 /**
  * Gets a Spinlock
  *
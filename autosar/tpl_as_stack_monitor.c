@@ -32,7 +32,7 @@ FUNC(void, OS_CODE) tpl_check_stack (
   CONST(tpl_proc_id, AUTOMATIC) proc_id)
 {
   CONSTP2CONST(tpl_stack, AUTOMATIC, OS_APPL_DATA) stack =
-    &(tpl_stat_proc_table[proc_id]->stack);
+    &(TPL_STAT_PROC(proc_id)->stack);
   /* MISRA RULE 33 VIOLATION: MISRA rule 33 says the right hand of
      a && or || operator shall not contain side effects (function call
      for instance). However this is intended here because
@@ -93,7 +93,7 @@ FUNC(tpl_bool, OS_CODE) tpl_tp_reset_watchdogs (
 {
     VAR(tpl_bool, AUTOMATIC) result = TRUE;
     CONSTP2VAR(tpl_timing_protection, AUTOMATIC, OS_APPL_DATA) tp =
-        tpl_stat_proc_table[proc_id]->timing_protection;
+        TPL_STAT_PROC(proc_id)->timing_protection;
 
     if(tp != NULL)
     {
@@ -122,9 +122,9 @@ FUNC(tpl_bool, OS_CODE) tpl_tp_on_activate_or_release (
   VAR(tpl_bool, AUTOMATIC) result = TRUE;
   VAR(tpl_time, AUTOMATIC) now;
   CONSTP2CONST(tpl_proc_static, AUTOMATIC, OS_APPL_DATA)  s_proc =
-    tpl_stat_proc_table[proc_id];
+    TPL_STAT_PROC(proc_id);
   CONSTP2VAR(tpl_timing_protection, AUTOMATIC, OS_APPL_DATA) tp =
-    tpl_stat_proc_table[proc_id]->timing_protection;
+    TPL_STAT_PROC(proc_id)->timing_protection;
 
    /* printf("TPL_TP : %s(proc %u @ %u)\n", __FUNCTION__, proc_id, (unsigned int)tpl_get_local_current_date()); */
     
@@ -161,9 +161,9 @@ FUNC(tpl_bool, OS_CODE) tpl_tp_on_terminate_or_wait(
 {
 
     CONSTP2CONST(tpl_proc_static, AUTOMATIC, OS_APPL_DATA)  s_proc =
-      tpl_stat_proc_table[proc_id];
+      TPL_STAT_PROC(proc_id);
     CONSTP2VAR(tpl_timing_protection, AUTOMATIC, OS_APPL_DATA) tp =
-      tpl_stat_proc_table[proc_id]->timing_protection;
+      TPL_STAT_PROC(proc_id)->timing_protection;
 
     if(tp != NULL)
     {
@@ -191,7 +191,7 @@ FUNC(tpl_bool, OS_CODE) tpl_tp_on_start(
 {
     VAR(tpl_time, AUTOMATIC) now;
     CONSTP2VAR(tpl_timing_protection, AUTOMATIC, OS_APPL_DATA)           
-        tp = tpl_stat_proc_table[proc_id]->timing_protection;
+        tp = TPL_STAT_PROC(proc_id)->timing_protection;
     VAR(unsigned char, AUTOMATIC) min_id = 0;
     VAR(unsigned char, AUTOMATIC) c = 0;
 
@@ -231,7 +231,7 @@ FUNC(tpl_bool, OS_CODE) tpl_tp_on_preempt(
 {
     VAR(tpl_time, AUTOMATIC) now;
     CONSTP2VAR(tpl_timing_protection, AUTOMATIC, OS_APPL_DATA)  
-        tp = tpl_stat_proc_table[proc_id]->timing_protection;
+        tp = TPL_STAT_PROC(proc_id)->timing_protection;
     VAR(unsigned int, AUTOMATIC) c;
     /* printf("TPL_TP : %s(proc %u @ %u)\n", __FUNCTION__, proc_id, (unsigned int)tpl_get_tptimer()); */
     if(tp != NULL)
@@ -273,7 +273,7 @@ FUNC(tpl_bool, OS_CODE) tpl_watchdog_expiration(void)
 {
     GET_CURRENT_CORE_ID(core_id)
     CONSTP2VAR(tpl_timing_protection, AUTOMATIC, OS_APPL_DATA)  
-        tp = tpl_stat_proc_table[GET_TP_WATCHDOG_OWNER(core_id)]->timing_protection;
+        tp = TPL_STAT_PROC(GET_TP_WATCHDOG_OWNER(core_id))->timing_protection;
     VAR(unsigned int, AUTOMATIC) error_code = E_OS_PROTECTION_LOCKED;
     VAR(unsigned int, AUTOMATIC) cpt = 0;
     VAR(tpl_bool, AUTOMATIC) at_least_one = FALSE;
@@ -264,10 +264,10 @@ extern tpl_com_service_call_descriptor tpl_com_service;
 #if WITH_EXTERNAL_COM == YES
 #   define CHECK_NOT_ZERO_LENGTH_SEND(mess_id,result)   \
     if (result == E_OK &&                               \
-        tpl_send_message_table[mess_id]->sender ==      \
+        (tpl_send_message_table[mess_id]->sender ==     \
             tpl_send_zero_internal_message ||           \
         tpl_send_message_table[mess_id]->sender ==      \
-            tpl_send_zero_external_message) {           \
+            tpl_send_zero_external_message)) {          \
         result = E_COM_ID;                              \
     }
 #else
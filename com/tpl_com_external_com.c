@@ -15,74 +15,203 @@
  * $URL$
  */
 
-
 #include "tpl_com_external_com.h"
 #include "tpl_com_internal_com.h"
+#include "tpl_com_notification.h"
 #include "tpl_os_definitions.h"
 #include "tpl_com_definitions.h"
 
+#if WITH_EXTERNAL_COM == YES
+
+#define OS_START_SEC_CONST_UNSPECIFIED
+#include "tpl_memmap.h"
+/*
+ * Used to know at run time how the CPU stores the unsigned integers. The
+ * test is folded by the compiler.
+ */
+STATIC CONST(uint16, OS_CONST) tpl_com_byte_order = 1;
+#define OS_STOP_SEC_CONST_UNSPECIFIED
+#include "tpl_memmap.h"
+
+/*
+ * TRUE if the bytes of the data are in order of increasing significance:
+ * the data is a byte array or the CPU is little endian.
+ */
+#define TPL_COM_LSB_FIRST(loc)                                            \
+  (((loc)->interpretation == IPDU_BYTEARRAY) ||                           \
+   (*(const uint8 *)&tpl_com_byte_order == 1))
+
+/*
+ * Largest unsigned integer message, in bytes. Larger messages are byte
+ * arrays and are given to the receivers straight from the I-PDU buffer.
+ */
+#define TPL_COM_MAX_INTEGER_SIZE 8
+
+/*
+ * A message stored byte per byte in the I-PDU, in the order of the CPU,
+ * is copied without shifting or masking
+ */
+#define TPL_COM_BYTE_ALIGNED(loc, lsb_first)                              \
+  ((lsb_first) && ((loc)->shift == 0) && ((loc)->step == 1) &&            \
+   ((loc)->first_mask == 0xFF) && ((loc)->last_mask == 0xFF))
+
 #define OS_START_SEC_CODE
 #include "tpl_memmap.h"
 
+/*
+ * tpl_com_ipdu_pack copies the data of a message in an I-PDU. Only the
+ * bytes of the I-PDU spanned by the message are written and the bits of
+ * the other messages are kept thanks to the masks of the location.
+ */
+FUNC(void, OS_CODE) tpl_com_ipdu_pack(
+  CONSTP2VAR(tpl_com_data, AUTOMATIC, OS_VAR)             ipdu_buf,
+  CONSTP2CONST(tpl_ipdu_location, AUTOMATIC, OS_CONST)    loc,
+  CONSTP2CONST(tpl_com_data, AUTOMATIC, OS_VAR)           data,
+  CONST(tpl_message_size, AUTOMATIC)                      size)
+{
+  CONST(tpl_bool, AUTOMATIC) lsb_first = TPL_COM_LSB_FIRST(loc);
+  CONST(uint8, AUTOMATIC) last = loc->byte_count - 1;
+  VAR(tpl_ipdu_size, AUTOMATIC) b = loc->lsb_byte;
+  VAR(uint8, AUTOMATIC) prev = 0;
+  VAR(uint8, AUTOMATIC) cur;
+  VAR(uint8, AUTOMATIC) out;
+  VAR(uint8, AUTOMATIC) mask;
+  VAR(uint8, AUTOMATIC) i;
+
+  if (TPL_COM_BYTE_ALIGNED(loc, lsb_first) && (loc->byte_count == size))
+  {
+    for (i = 0; i <= last; i++)
+    {
+      ipdu_buf[b + i] = data[i];
+    }
+  }
+  else
+  {
+    for (i = 0; i <= last; i++)
+    {
+      /*  byte of significance i of the data  */
+      cur = 0;
+      if (i < size)
+      {
+        cur = data[lsb_first ? i : (size - 1 - i)];
+      }
+      out = (uint8)((cur << loc->shift) | (prev >> (8 - loc->shift)));
+      if (i == 0)
+      {
+        mask = loc->first_mask;
+      }
+      else if (i == last)
+      {
+        mask = loc->last_mask;
+      }
+      else
+      {
+        mask = 0xFF;
+      }
+      ipdu_buf[b] = (tpl_com_data)((ipdu_buf[b] & ~mask) | (out & mask));
+      prev = cur;
+      b += loc->step;
+    }
+  }
+}
+
+/*
+ * tpl_com_ipdu_unpack gets the data of a message from an I-PDU. The bits
+ * of the data beyond the size of the message are cleared.
+ */
+FUNC(void, OS_CODE) tpl_com_ipdu_unpack(
+  CONSTP2CONST(tpl_com_data, AUTOMATIC, OS_VAR)           ipdu_buf,
+  CONSTP2CONST(tpl_ipdu_location, AUTOMATIC, OS_CONST)    loc,
+  CONSTP2VAR(tpl_com_data, AUTOMATIC, OS_VAR)             data,
+  CONST(tpl_message_size, AUTOMATIC)                      size)
+{
+  CONST(tpl_bool, AUTOMATIC) lsb_first = TPL_COM_LSB_FIRST(loc);
+  CONST(uint8, AUTOMATIC) last = loc->byte_count - 1;
+  VAR(tpl_ipdu_size, AUTOMATIC) b = loc->lsb_byte;
+  VAR(uint8, AUTOMATIC) cur;
+  VAR(uint8, AUTOMATIC) next;
+  VAR(uint8, AUTOMATIC) i;
+
+  if (TPL_COM_BYTE_ALIGNED(loc, lsb_first) && (loc->byte_count == size))
+  {
+    for (i = 0; i < size; i++)
+    {
+      data[i] = ipdu_buf[b + i];
+    }
+  }
+  else
+  {
+    cur = ipdu_buf[b] & loc->first_mask;
+    for (i = 0; i < size; i++)
+    {
+      /*  byte i+1 of the I-PDU, masked   */
+      next = 0;
+      if (i < last)
+      {
+        b += loc->step;
+        next = ipdu_buf[b];
+        if (i + 1 == last)
+        {
+          next &= loc->last_mask;
+        }
+      }
+      data[lsb_first ? i : (size - 1 - i)] =
+        (tpl_com_data)((cur >> loc->shift) | (next << (8 - loc->shift)));
+      cur = next;
+    }
+  }
+}
+
 /*
  * tpl_send_static_external_message sends a message from a static external 
  * sending message object to an IPDU.
  * This function is attached to the sending message object.
  */
 FUNC(tpl_status, OS_CODE) tpl_send_static_external_message(
-  CONSTP2CONST(void, COM_CONST, AUTOMATIC)   smo,
-  P2VAR(tpl_com_data, COM_VAR, AUTOMATIC)    data)
+  CONSTP2CONST(void, AUTOMATIC, OS_CONST)       smo,
+  CONSTP2CONST(tpl_com_data, AUTOMATIC, OS_VAR) data)
 {
   VAR(tpl_status, AUTOMATIC) result = E_OK;
   /* cast the base mo to the correct type of mo */
-  CONSTP2CONST(tpl_external_sending_mo, COM_CONST, AUTOMATIC) esmo = smo;
-  /* get the pointer to the data buffer */
-  CONSTP2VAR(tpl_com_data, COM_VAR, AUTOMATIC) mo_buf = esmo->buffer.buffer;
+  CONSTP2CONST(tpl_external_sending_mo, AUTOMATIC, OS_CONST) esmo = smo;
+  /* get the pointer to the last value sent */
+  P2VAR(tpl_com_data, AUTOMATIC, OS_VAR) mo_buf = esmo->buffer.buffer;
 
   /* filter the message */
   if (tpl_filtering(mo_buf, data, esmo->filter))
   {
-#if WITH_CPU_ORDER_CALLOUT == YES
-    /* call the CPU-order message callout */
-    if (COM_TRUE == esmo->base_mo.cpu_callout())
-#endif
-    {
-      /*
-       * does the byte ordering of the message or not.
-       * If cpu order and network order differs, the data are ordered and
-       * copied from buffer.buffer to buffer.ordered_buffer. If cpu order
-       * and network order are the same, the data are simply copied from
-       * buffer.buffer to buffer.ordered_buffer.
-       */
-      esmo->order(&(esmo->buffer));
-
-#if WITH_NET_ORDER_CALLOUT == YES
-      /* call the Network-order message callout */
-      if (COM_TRUE == esmo->base_mo.net_callout())
-#endif
-      {
-
-        /* copy & pack the message object in the IPDU */
-        esmo->copy_and_pack(esmo);
-        /*
-         * notify the IPDU. According to the message property and
-         * the transfer property, this may trigger the sending of
-         * the IPDU to the network.
-         */
-        tpl_notify_ipdu(esmo->base_mo.property);
+    VAR(tpl_message_size, AUTOMATIC) size = esmo->buffer.size;
+    P2CONST(tpl_com_data, AUTOMATIC, OS_VAR) src = data;
 
-      }
+    /* keep the value for the filter of the next message */
+    while (size-- > 0)
+    {
+      *mo_buf++ = *src++;
+    }
+    /* copy & pack the message object in the IPDU */
+    tpl_com_ipdu_pack(
+      esmo->external_target->buffer,
+      &(esmo->message_location),
+      data,
+      esmo->buffer.size);
+    /*
+     * notify the IPDU if the message is TRIGGERED. According to the
+     * transmission mode of the IPDU, this may send the IPDU to the network.
+     */
+    if (esmo->triggered)
+    {
+      tpl_notify_ipdu(esmo->external_target);
     }
   }
   /*
    * if at least an internal target exists,
    * the tpl_send_static_internal_message function is called
    */
-  if (NULL != esmo->base_mo.internal.internal_target)
+  if (NULL != esmo->internal.internal_target)
   {
     result = tpl_send_static_internal_message(smo, data);
   }
-	return result;
+  return result;
 }
 
 /*
@@ -91,48 +220,281 @@ FUNC(tpl_status, OS_CODE) tpl_send_static_external_message(
  * This function is attached to the sending message object.
  */
 FUNC(tpl_status, OS_CODE) tpl_send_zero_external_message(
-  CONSTP2CONST(void, AUTOMATIC, OS_CONST)   smo,
-  P2VAR(tpl_com_data, AUTOMATIC, OS_VAR)    data)
+  CONSTP2CONST(void, AUTOMATIC, OS_CONST)       smo,
+  CONSTP2CONST(tpl_com_data, AUTOMATIC, OS_VAR) data)
 {
   VAR(tpl_status, AUTOMATIC) result = E_OK;
   /* cast the base mo to the correct type of mo */
   CONSTP2CONST(tpl_external_sending_zero_mo, AUTOMATIC, OS_CONST) esmo = smo;
 
-#if WITH_CPU_ORDER_CALLOUT == YES
-    /* call the CPU-order message callout */
-    if (COM_TRUE == esmo->cpu_callout())
-#endif
+  tpl_notify_ipdu(esmo->external_target);
+  /*
+   * if at least an internal target exists, the tpl_send_zero_internal_message
+   * function is called
+   */
+  if (NULL != esmo->internal.internal_target)
+  {
+    result = tpl_send_zero_internal_message(smo, data);
+  }
+  return result;
+}
+
+/*
+ * tpl_notify_ipdu is called when a TRIGGERED message has been packed in
+ * an IPDU. A DIRECT or MIXED IPDU is sent at once unless the minimum delay
+ * since the previous transmission has not elapsed. In this case, it is
+ * sent by tpl_com_ipdu_tick when the delay elapses. A PERIODIC IPDU is
+ * only sent by tpl_com_ipdu_tick.
+ */
+FUNC(void, OS_CODE) tpl_notify_ipdu(
+  CONSTP2CONST(tpl_sending_ipdu, AUTOMATIC, OS_CONST) ipdu)
+{
+  CONSTP2VAR(tpl_sending_ipdu_dyn, AUTOMATIC, OS_VAR) dyn = ipdu->dyn;
+
+  if (ipdu->mode & IPDU_DIRECT)
+  {
+    if (dyn->delay_countdown == 0)
+    {
+      ipdu->driver->send(&ipdu, 1);
+      dyn->delay_countdown = ipdu->min_delay;
+    }
+    else
+    {
+      dyn->pending = TRUE;
+    }
+  }
+}
+
+/*
+ * tpl_com_ipdu_init is called by StartOS. It packs the initial value of
+ * the static external sending message objects in their IPDU, starts the
+ * periodic transmissions and initializes the drivers.
+ */
+FUNC(void, OS_CODE) tpl_com_ipdu_init(void)
+{
+  VAR(uint16, AUTOMATIC) i;
+
+#if SEND_MESSAGE_COUNT > 0
+  for (i = 0; i < SEND_MESSAGE_COUNT; i++)
+  {
+    if (tpl_send_message_table[i]->sender == tpl_send_static_external_message)
     {
-#if WITH_NET_ORDER_CALLOUT == YES
-      /* call the Network-order message callout */
-      if (COM_TRUE == esmo->net_callout())
+      CONSTP2CONST(tpl_external_sending_mo, AUTOMATIC, OS_CONST) esmo =
+        (const tpl_external_sending_mo *)tpl_send_message_table[i];
+      tpl_com_ipdu_pack(
+        esmo->external_target->buffer,
+        &(esmo->message_location),
+        esmo->buffer.buffer,
+        esmo->buffer.size);
+    }
+  }
+#endif
+
+#if SENDING_IPDU_COUNT > 0
+  for (i = 0; i < SENDING_IPDU_COUNT; i++)
+  {
+    CONSTP2CONST(tpl_sending_ipdu, AUTOMATIC, OS_CONST) ipdu =
+      tpl_sending_ipdu_table[i];
+    ipdu->dyn->period_countdown = ipdu->offset;
+    ipdu->dyn->delay_countdown = 0;
+    ipdu->dyn->pending = FALSE;
+  }
 #endif
+
+  for (i = 0; i < IPDU_DRIVER_COUNT; i++)
+  {
+    if (tpl_ipdu_driver_table[i]->init != NULL)
+    {
+      tpl_ipdu_driver_table[i]->init();
+    }
+  }
+}
+
+/*
+ * tpl_com_ipdu_tick is called at each tick of the hardware counters. It
+ * sends the periodic IPDUs whose period elapsed and the direct IPDUs
+ * whose minimum delay elapsed. All the IPDUs due at the same tick are
+ * given to their driver in a single call.
+ */
+FUNC(void, OS_CODE) tpl_com_ipdu_tick(void)
+{
+#if SENDING_IPDU_COUNT > 0
+  P2CONST(tpl_sending_ipdu, AUTOMATIC, OS_CONST) due[SENDING_IPDU_COUNT];
+  VAR(uint16, AUTOMATIC) count = 0;
+  VAR(uint16, AUTOMATIC) first = 0;
+  VAR(uint16, AUTOMATIC) i;
+
+  for (i = 0; i < SENDING_IPDU_COUNT; i++)
+  {
+    CONSTP2CONST(tpl_sending_ipdu, AUTOMATIC, OS_CONST) ipdu =
+      tpl_sending_ipdu_table[i];
+    CONSTP2VAR(tpl_sending_ipdu_dyn, AUTOMATIC, OS_VAR) dyn = ipdu->dyn;
+    VAR(tpl_bool, AUTOMATIC) send = dyn->pending;
+
+    if (dyn->delay_countdown > 0)
+    {
+      dyn->delay_countdown--;
+      send = send && (dyn->delay_countdown == 0);
+    }
+    if (ipdu->mode & IPDU_PERIODIC)
+    {
+      dyn->period_countdown--;
+      if (dyn->period_countdown == 0)
       {
-        /*
-         * notify the IPDU. According to the message property and
-         * the transfer property, this may trigger the sending of
-         * the IPDU to the network.
-         */
-        tpl_notify_ipdu(esmo->property);
+        dyn->period_countdown = ipdu->period;
+        send = TRUE;
       }
     }
+    if (send)
+    {
+      due[count++] = ipdu;
+      dyn->pending = FALSE;
+      dyn->delay_countdown = ipdu->min_delay;
+    }
+  }
+
   /*
-   * if at least an internal target exists, the tpl_send_zero_internal_message
-   * function is called
+   * the IPDUs are sorted by driver in the table, one call is done for each
+   * run of IPDUs having the same driver
    */
-  if (NULL != esmo->internal.internal_target)
+  for (i = 1; i <= count; i++)
   {
-    result = tpl_send_zero_internal_message(smo, data);
+    if ((i == count) || (due[i]->driver != due[first]->driver))
+    {
+      due[first]->driver->send(&due[first], i - first);
+      first = i;
+    }
   }
-	return result;
+#endif
 }
 
-FUNC(void, COM_CODE) tpl_notify_ipdu(
-  CONST(tpl_message_property, AUTOMATIC) property)
+/*
+ * tpl_com_ipdu_next_deadline gives the number of ticks until the next
+ * tick where tpl_com_ipdu_tick changes the state of an IPDU: a periodic
+ * transmission or the end of a minimum delay. It returns 0 when no IPDU
+ * has a deadline, tpl_com_ipdu_tick does nothing then. The virtual time
+ * of the posix target uses it not to jump over a deadline.
+ */
+FUNC(tpl_com_time, OS_CODE) tpl_com_ipdu_next_deadline(void)
 {
+  VAR(tpl_com_time, AUTOMATIC) deadline = 0;
+#if SENDING_IPDU_COUNT > 0
+  VAR(uint16, AUTOMATIC) i;
+
+  for (i = 0; i < SENDING_IPDU_COUNT; i++)
+  {
+    CONSTP2CONST(tpl_sending_ipdu, AUTOMATIC, OS_CONST) ipdu =
+      tpl_sending_ipdu_table[i];
+    CONSTP2CONST(tpl_sending_ipdu_dyn, AUTOMATIC, OS_VAR) dyn = ipdu->dyn;
+
+    if ((dyn->delay_countdown > 0) &&
+        ((deadline == 0) || (dyn->delay_countdown < deadline)))
+    {
+      deadline = dyn->delay_countdown;
+    }
+    if ((ipdu->mode & IPDU_PERIODIC) &&
+        ((deadline == 0) || (dyn->period_countdown < deadline)))
+    {
+      deadline = dyn->period_countdown;
+    }
+  }
+#endif
+  return deadline;
+}
+
+/*
+ * tpl_com_ipdu_received is called by a driver when an IPDU is received.
+ * Each message of the IPDU is unpacked and given to its receiving message
+ * objects. The notifications are done but the rescheduling is left to
+ * the driver which calls tpl_notify_receiving_mos once all the IPDUs
+ * available have been received.
+ */
+FUNC(void, OS_CODE) tpl_com_ipdu_received(
+  CONST(tpl_ipdu_id, AUTOMATIC)                   id,
+  CONSTP2CONST(tpl_com_data, AUTOMATIC, OS_VAR)   data,
+  CONST(tpl_ipdu_size, AUTOMATIC)                 size)
+{
+#if RECEIVING_IPDU_COUNT > 0
+  P2CONST(tpl_receiving_ipdu, AUTOMATIC, OS_CONST) ipdu = NULL;
+  VAR(uint16, AUTOMATIC) i;
+
+  for (i = 0; (i < RECEIVING_IPDU_COUNT) && (ipdu == NULL); i++)
+  {
+    if (tpl_receiving_ipdu_table[i]->id == id)
+    {
+      ipdu = tpl_receiving_ipdu_table[i];
+    }
+  }
+
+  /* IPDUs unknown in this ECU or of an other size are ignored */
+  if ((ipdu != NULL) && (ipdu->size == size))
+  {
+    for (i = 0; i < size; i++)
+    {
+      ipdu->buffer[i] = data[i];
+    }
+
+    for (i = 0; i < ipdu->message_count; i++)
+    {
+      CONSTP2CONST(tpl_ipdu_message, AUTOMATIC, OS_CONST) message =
+        &(ipdu->messages[i]);
+      CONSTP2CONST(tpl_ipdu_location, AUTOMATIC, OS_CONST) loc =
+        &(message->location);
+      P2CONST(tpl_base_receiving_mo, AUTOMATIC, OS_CONST) rmo =
+        (const tpl_base_receiving_mo *)message->rmo;
+      P2CONST(tpl_com_data, AUTOMATIC, OS_VAR) value = NULL;
+      /* aligned for any unsigned integer type */
+      union {
+        tpl_com_data  bytes[TPL_COM_MAX_INTEGER_SIZE];
+        double        align;
+      } integer;
+
+      if (message->size == 0)
+      {
+        /* zero length message, only notified */
+      }
+      else if (message->size <= TPL_COM_MAX_INTEGER_SIZE)
+      {
+        /*
+         * unpacked in an aligned buffer since the receivers and the
+         * filters read the data as a CDATATYPE
+         */
+        tpl_com_ipdu_unpack(ipdu->buffer, loc, integer.bytes, message->size);
+        value = integer.bytes;
+      }
+      else if ((loc->interpretation == IPDU_BYTEARRAY) &&
+               (loc->shift == 0) && (loc->step == 1))
+      {
+        value = &(ipdu->buffer[loc->lsb_byte]);
+      }
+      else
+      {
+        rmo = NULL;
+      }
+
+      while (rmo != NULL)
+      {
+        VAR(tpl_status, AUTOMATIC) result = E_OK;
+        if (value != NULL)
+        {
+          P2CONST(tpl_data_receiving_mo, AUTOMATIC, OS_CONST) drmo =
+            (const tpl_data_receiving_mo *)rmo;
+          result = drmo->receiver(drmo, value);
+        }
+        if ((result == E_OK) && (rmo->notification != NULL))
+        {
+          rmo->notification->action(rmo->notification);
+        }
+        rmo = rmo->next_mo;
+      }
+    }
+  }
+#endif
 }
 
 #define OS_STOP_SEC_CODE
 #include "tpl_memmap.h"
 
+#endif /* WITH_EXTERNAL_COM */
+
 /* End of file tpl_com_external_com.c */
@@ -16,21 +16,44 @@
 #ifndef TPL_COM_EXTERNAL_COM
 #define TPL_COM_EXTERNAL_COM
 
-#include "tpl_com_external_mo.h"
+#include "tpl_com_external_private_types.h"
 
 #define OS_START_SEC_CODE
 #include "tpl_memmap.h"
 
 FUNC(tpl_status, OS_CODE) tpl_send_static_external_message(
-  CONSTP2CONST(void, AUTOMATIC, OS_CONST)   smo,
-  P2VAR(tpl_com_data, AUTOMATIC, OS_VAR)    data);
+  CONSTP2CONST(void, AUTOMATIC, OS_CONST)       smo,
+  CONSTP2CONST(tpl_com_data, AUTOMATIC, OS_VAR) data);
 
 FUNC(tpl_status, OS_CODE) tpl_send_zero_external_message(
-  CONSTP2CONST(void, AUTOMATIC, OS_CONST)   smo,
-  P2VAR(tpl_com_data, AUTOMATIC, OS_VAR)    data);
+  CONSTP2CONST(void, AUTOMATIC, OS_CONST)       smo,
+  CONSTP2CONST(tpl_com_data, AUTOMATIC, OS_VAR) data);
 
-FUNC(void, COM_CODE) tpl_notify_ipdu(
-  CONST(tpl_message_property, AUTOMATIC) property);
+FUNC(void, OS_CODE) tpl_notify_ipdu(
+  CONSTP2CONST(tpl_sending_ipdu, AUTOMATIC, OS_CONST) ipdu);
+
+FUNC(void, OS_CODE) tpl_com_ipdu_pack(
+  CONSTP2VAR(tpl_com_data, AUTOMATIC, OS_VAR)             ipdu_buf,
+  CONSTP2CONST(tpl_ipdu_location, AUTOMATIC, OS_CONST)    loc,
+  CONSTP2CONST(tpl_com_data, AUTOMATIC, OS_VAR)           data,
+  CONST(tpl_message_size, AUTOMATIC)                      size);
+
+FUNC(void, OS_CODE) tpl_com_ipdu_unpack(
+  CONSTP2CONST(tpl_com_data, AUTOMATIC, OS_VAR)           ipdu_buf,
+  CONSTP2CONST(tpl_ipdu_location, AUTOMATIC, OS_CONST)    loc,
+  CONSTP2VAR(tpl_com_data, AUTOMATIC, OS_VAR)             data,
+  CONST(tpl_message_size, AUTOMATIC)                      size);
+
+FUNC(void, OS_CODE) tpl_com_ipdu_init(void);
+
+FUNC(void, OS_CODE) tpl_com_ipdu_tick(void);
+
+FUNC(tpl_com_time, OS_CODE) tpl_com_ipdu_next_deadline(void);
+
+FUNC(void, OS_CODE) tpl_com_ipdu_received(
+  CONST(tpl_ipdu_id, AUTOMATIC)                   id,
+  CONSTP2CONST(tpl_com_data, AUTOMATIC, OS_VAR)   data,
+  CONST(tpl_ipdu_size, AUTOMATIC)                 size);
 
 #define OS_STOP_SEC_CODE
 #include "tpl_memmap.h"
@@ -17,42 +17,56 @@
 #ifndef __TPL_COM_EXTERNAL_PRIVATE_TYPES_H__
 #define __TPL_COM_EXTERNAL_PRIVATE_TYPES_H__
 
+#include "tpl_com_mo.h"
+#include "tpl_com_ipdu.h"
+
 /*
- * tpl_external_sending_mo is external only sending message object
+ * tpl_external_sending_mo is a static external sending message object.
+ * It may also have internal receivers: the first member is an internal
+ * sending message object so that tpl_send_static_internal_message
+ * can be called on it.
  */
 struct TPL_EXTERNAL_SENDING_MO {
-    /*  common to all sending mo            */
-    tpl_base_sending_mo     base_mo;
-    /*  function pointer to the filter      */
-    tpl_filter_desc         filter;
-    /*  pointer to the buffer               */
-    tpl_com_data            *buffer;
-    /*  pointer to the IPDU                 */
-    tpl_sending_ipdu        *external_target;
-    /*  location of the message in the IPDU */
-    tpl_ipdu_location       message_location;
+    /*  sending function and internal receivers (may be NULL)   */
+    tpl_internal_sending_mo     internal;
+    /*  pointer to the filter                                   */
+    tpl_filter_desc             *filter;
+    /*  last value sent, used by the filter                     */
+    tpl_com_buffer              buffer;
+    /*  pointer to the IPDU                                     */
+    const tpl_sending_ipdu      *external_target;
+    /*  location of the message in the IPDU                     */
+    tpl_ipdu_location           message_location;
+    /*  TRUE if the transfer property is TRIGGERED              */
+    tpl_bool                    triggered;
 };
 
 typedef struct TPL_EXTERNAL_SENDING_MO tpl_external_sending_mo;
 
 /*
- * tpl_internal_external_sending_mo is internal AND external
- * sending message object
+ * tpl_external_sending_zero_mo is a zero length external sending message
+ * object. Sending the message notifies the IPDU.
  */
-struct TPL_INTERNAL_EXTERNAL_SENDING_MO {
-    /*  common to all sending mo                            */
-    tpl_base_sending_mo             base_mo;
-    /*  function pointer to the filter                      */
-    tpl_filter                      filter;
-    /*  pointer to the buffer                               */
-    tpl_com_data                    *buffer;
-    /*  pointer to the internal receiving message object    */
-    struct TPL_BASE_RECEIVING_MO    *internal_target;
-    /*  pointer to the IPDU                                 */
-    struct TPL_SENDING_IPDU         *external_target;
+struct TPL_EXTERNAL_SENDING_ZERO_MO {
+    /*  sending function and internal receivers (may be NULL)   */
+    tpl_internal_sending_mo     internal;
+    /*  pointer to the IPDU                                     */
+    const tpl_sending_ipdu      *external_target;
 };
 
-typedef struct TPL_INTERNAL_EXTERNAL_SENDING_MO
-tpl_internal_external_sending_mo;
+typedef struct TPL_EXTERNAL_SENDING_ZERO_MO tpl_external_sending_zero_mo;
+
+/*
+ * Tables of the IPDUs and of their drivers. The sending IPDUs are sorted
+ * by driver.
+ */
+extern CONSTP2CONST(tpl_sending_ipdu, AUTOMATIC, OS_CONST)
+  tpl_sending_ipdu_table[];
+
+extern CONSTP2CONST(tpl_receiving_ipdu, AUTOMATIC, OS_CONST)
+  tpl_receiving_ipdu_table[];
+
+extern CONSTP2CONST(tpl_ipdu_driver, AUTOMATIC, OS_CONST)
+  tpl_ipdu_driver_table[];
 
 #endif
@@ -30,7 +30,7 @@ tpl_bool tpl_filtering(
   CONSTP2CONST(tpl_filter_desc, AUTOMATIC, OS_CONST)  filter_desc)
 {
   
-  /*  Checks there is a filter set */
+  /*  Checks there is a filter set, goil sets none for ALWAYS */
   if ((filter_desc != NULL) && (filter_desc->filter != NULL)) {
     /*  Checks the data is compatible with filter. Size have
         to be less or equal than the tpl_com_value data size    */
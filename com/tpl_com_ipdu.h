@@ -17,27 +17,158 @@
 #ifndef __TPL_COM_IPDU_H__
 #define __TPL_COM_IPDU_H__
 
-typedef u8  tpl_ipdu_mode;
+#include "tpl_os_internal_types.h"
+#include "tpl_com_types.h"
+
+typedef uint8  tpl_ipdu_mode;
 
 #define IPDU_PERIODIC 1
 #define IPDU_DIRECT   2
 #define IPDU_MIXED    ((IPDU_PERIODIC) | (IPDU_DIRECT))
 
-typedef u32 tpl_ipdu_id;
+typedef uint32 tpl_ipdu_id;
+
+/*
+ * size of an I-PDU or offset in an I-PDU, in bytes
+ */
+typedef uint16 tpl_ipdu_size;
+
+/*
+ * time of the I-PDU layer, in COM ticks. A COM tick is a tick of the
+ * hardware counters (see tpl_com_ipdu_tick)
+ */
+typedef uint32 tpl_com_time;
+
+/*
+ * Interpretation of the data of a message in an I-PDU. An unsigned integer
+ * is stored in CPU order in the message object and packed according to the
+ * bit ordering of the network message. A byte array is copied as is.
+ */
+#define IPDU_UNSIGNEDINTEGER  0
+#define IPDU_BYTEARRAY        1
+
+/*
+ * A tpl_ipdu_location gives where the bits of a network message are in
+ * the I-PDU. It is computed by goil from the BITPOSITION, SIZEINBITS and
+ * BITORDERING of the network message so that packing and unpacking the
+ * message only walk the bytes it spans:
+ * - lsb_byte is the byte holding the least significant bit,
+ * - byte_count is the number of bytes spanned,
+ * - shift is the position of the least significant bit in lsb_byte,
+ * - step is 1 when the following bytes have increasing addresses
+ *   (LITTLEENDIAN) and -1 otherwise (BIGENDIAN),
+ * - first_mask and last_mask are the bits of the message in the first
+ *   and in the last byte spanned. When the message fits in one byte,
+ *   first_mask gives its bits.
+ */
+struct TPL_IPDU_LOCATION {
+  tpl_ipdu_size   lsb_byte;
+  uint8           byte_count;
+  uint8           shift;
+  sint8           step;
+  uint8           first_mask;
+  uint8           last_mask;
+  uint8           interpretation;
+};
+
+typedef struct TPL_IPDU_LOCATION tpl_ipdu_location;
+
+struct TPL_SENDING_IPDU;
+
+/*
+ * Functions of an I-PDU driver.
+ * init is called once by StartOS.
+ * send transmits a batch of I-PDUs. All the I-PDUs which are due at the
+ * same COM tick are given in a single call.
+ * Received I-PDUs are given to tpl_com_ipdu_received by the driver,
+ * usually from its reception interrupt.
+ */
+typedef void (*tpl_ipdu_init_func)(void);
+
+typedef tpl_status (*tpl_ipdu_send_func)(
+  CONSTP2CONST(struct TPL_SENDING_IPDU, AUTOMATIC, OS_CONST) *ipdus,
+  CONST(uint16, AUTOMATIC) count);
+
+struct TPL_IPDU_DRIVER {
+  /*  initialization function                 */
+  tpl_ipdu_init_func  init;
+  /*  transmission function                   */
+  tpl_ipdu_send_func  send;
+};
+
+typedef struct TPL_IPDU_DRIVER tpl_ipdu_driver;
+
+/*
+ * Dynamic part of a sending I-PDU.
+ */
+struct TPL_SENDING_IPDU_DYN {
+  /*  ticks before the next periodic transmission                   */
+  tpl_com_time  period_countdown;
+  /*  ticks before a direct transmission is allowed again           */
+  tpl_com_time  delay_countdown;
+  /*  a direct transmission waits for the minimum delay to elapse   */
+  tpl_bool      pending;
+};
+
+typedef struct TPL_SENDING_IPDU_DYN tpl_sending_ipdu_dyn;
 
 /*
  * A tpl_sending_ipdu gathers :
- * - An id
- * - A mode
- * - A 8 bytes buffer pointer
+ * - An id, sent with the I-PDU to identify it on the network
+ * - A mode (DIRECT, PERIODIC or MIXED)
+ * - The buffer where the messages are packed and its size
+ * - The period, the offset of the first periodic transmission and the
+ *   minimum delay between two direct transmissions, in COM ticks
+ * - The dynamic part
+ * - The driver
  */ 
 struct TPL_SENDING_IPDU {
-  CONST(tpl_ipdu_id, TYPEDEF)      id;
-  CONST(tpl_ipdu_mode, TYPEDEF)    mode;
-  CONSTP2VAR(u8, TYPEDEF, COM_VAR) buffer;
+  tpl_ipdu_id                 id;
+  tpl_ipdu_mode               mode;
+  tpl_ipdu_size               size;
+  tpl_com_data                *buffer;
+  tpl_com_time                period;
+  tpl_com_time                offset;
+  tpl_com_time                min_delay;
+  tpl_sending_ipdu_dyn        *dyn;
+  const tpl_ipdu_driver       *driver;
 };
 
 typedef struct TPL_SENDING_IPDU tpl_sending_ipdu;
 
+struct TPL_DATA_RECEIVING_MO;
+
+/*
+ * A message received in an I-PDU. rmo is the first receiving message
+ * object of the network message, the other ones are chained to it. size
+ * is the size of the data of the receiving message objects, 0 for a zero
+ * length message.
+ */
+struct TPL_IPDU_MESSAGE {
+  struct TPL_DATA_RECEIVING_MO  *rmo;
+  tpl_message_size              size;
+  tpl_ipdu_location             location;
+};
+
+typedef struct TPL_IPDU_MESSAGE tpl_ipdu_message;
+
+/*
+ * A tpl_receiving_ipdu gathers :
+ * - The id of the I-PDU
+ * - The buffer where the I-PDU is copied on reception and its size
+ * - The messages it holds
+ * - The driver
+ */
+struct TPL_RECEIVING_IPDU {
+  tpl_ipdu_id                 id;
+  tpl_ipdu_size               size;
+  tpl_com_data                *buffer;
+  const tpl_ipdu_message      *messages;
+  uint8                       message_count;
+  const tpl_ipdu_driver       *driver;
+};
+
+typedef struct TPL_RECEIVING_IPDU tpl_receiving_ipdu;
+
 /*  __TPL_COM_IPDU_H__  */
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,78 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "tpl_os.h"
+
+DeclareMessage(ping);
+DeclareMessage(ping_tag);
+DeclareMessage(pong);
+DeclareMessage(pong_log);
+DeclareMessage(heartbeat);
+DeclareMessage(stop);
+
+#define ROUNDS 1000
+
+static uint32_t rounds = 0;
+static double sent_at;
+static double total = 0;
+static double worst = 0;
+
+static double now_us(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e6 + t.tv_nsec / 1e3;
+}
+
+static void send_ping(void) {
+  uint32_t data = 0x80000001 + rounds;
+  sent_at = now_us();
+  SendMessage(ping, &data);
+}
+
+int main(void) {
+  StartOS(OSDEFAULTAPPMODE);
+  return 0;
+}
+
+TASK(start_ping) {
+  /* ping_tag is PENDING: it goes with the next ping */
+  uint16_t tag = 0x5A5;
+  SendMessage(ping_tag, &tag);
+  send_ping();
+  TerminateTask();
+}
+
+TASK(on_pong) {
+  uint32_t data;
+  uint32_t logged;
+  double round_trip = now_us() - sent_at;
+
+  ReceiveMessage(pong, &data);
+  /* pong_log is linked to pong and gets the same values */
+  while (ReceiveMessage(pong_log, &logged) == E_OK) {}
+  if (data != (0x80000001 + rounds) * 3 || logged != data) {
+    printf("round %u: bad pong %x\r\n", rounds, data);
+  }
+  total += round_trip;
+  if (round_trip > worst) {
+    worst = round_trip;
+  }
+  rounds++;
+  if (rounds < ROUNDS) {
+    send_ping();
+  } else {
+    printf("%u round trips, mean %.1f us, worst %.1f us\r\n",
+           rounds, total / rounds, worst);
+    SendZeroMessage(stop);
+    ShutdownOS(E_OK);
+  }
+  TerminateTask();
+}
+
+TASK(on_heartbeat) {
+  uint16_t beat;
+  ReceiveMessage(heartbeat, &beat);
+  printf("heartbeat %u\r\n", beat);
+  TerminateTask();
+}
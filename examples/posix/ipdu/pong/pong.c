@@ -0,0 +1,44 @@
+#include <stdint.h>
+#include <stdio.h>
+
+#include "tpl_os.h"
+
+DeclareMessage(ping);
+DeclareMessage(ping_tag);
+DeclareMessage(pong);
+DeclareMessage(heartbeat);
+
+static uint32_t pings = 0;
+
+int main(void) {
+  StartOS(OSDEFAULTAPPMODE);
+  return 0;
+}
+
+TASK(on_ping) {
+  uint32_t data;
+  uint16_t tag;
+
+  ReceiveMessage(ping, &data);
+  ReceiveMessage(ping_tag, &tag);
+  if (pings == 0) {
+    printf("first ping %x, tag %x\r\n", data, tag);
+  }
+  pings++;
+  data = data * 3;
+  SendMessage(pong, &data);
+  TerminateTask();
+}
+
+TASK(beat) {
+  static uint16_t beat = 0;
+  beat++;
+  SendMessage(heartbeat, &beat);
+  TerminateTask();
+}
+
+TASK(on_stop) {
+  printf("stop after %u pings\r\n", pings);
+  ShutdownOS(E_OK);
+  TerminateTask();
+}
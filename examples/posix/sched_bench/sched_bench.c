@@ -0,0 +1,116 @@
+#include <stdio.h>
+#include <time.h>
+#include "tpl_os.h"
+#include "tpl_os_kernel.h"
+#include "tpl_os_timeobj_kernel.h"
+
+#if defined(__i386__) || defined(__x86_64__)
+#include <x86intrin.h>
+#define UNIT "cycles"
+static unsigned long long now(void)
+{
+    return __rdtsc();
+}
+#else
+#define UNIT "ns"
+static unsigned long long now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+#endif
+
+#define ROUNDS      2000
+#define TICKS       1000
+#define LOW_COUNT   8
+
+/*
+ * The kernel functions are called directly, with the interrupts
+ * disabled, so that the measure does not include the kernel entry.
+ */
+extern VAR(tpl_counter, OS_VAR) bench_counter_counter_desc;
+
+DeclareEvent(done);
+
+typedef struct {
+    const char *name;
+    unsigned long long min;
+    unsigned long long total;
+    unsigned long count;
+} measure;
+
+static void account(measure *m, unsigned long long duration)
+{
+    if (duration < m->min)
+    {
+        m->min = duration;
+    }
+    m->total += duration;
+}
+
+static void report(const measure *m)
+{
+    printf("%-10s min %6.1f avg %6.1f %s per call\n", m->name,
+           (double)m->min / m->count,
+           (double)m->total / ROUNDS / m->count, UNIT);
+}
+
+int main(void)
+{
+    StartOS(OSDEFAULTAPPMODE);
+    return 0;
+}
+
+TASK(bench)
+{
+    const TaskType low_tasks[LOW_COUNT] = {
+        low1, low2, low3, low4, low5, low6, low7, low8
+    };
+    measure activate = { "activate", ~0ULL, 0, LOW_COUNT };
+    measure tick = { "tick", ~0ULL, 0, TICKS };
+    unsigned long long t0, t1, t2;
+    int round;
+    int i;
+
+    for (round = 0; round < ROUNDS; round++)
+    {
+        SuspendAllInterrupts();
+        t0 = now();
+        for (i = 0; i < LOW_COUNT; i++)
+        {
+            tpl_activate_task(low_tasks[i]);
+        }
+        t1 = now();
+        for (i = 0; i < TICKS; i++)
+        {
+            tpl_counter_tick(&bench_counter_counter_desc);
+        }
+        t2 = now();
+        ResumeAllInterrupts();
+        account(&activate, t1 - t0);
+        account(&tick, t2 - t1);
+        /* the activated tasks run, low1 is the last one */
+        WaitEvent(done);
+        ClearEvent(done);
+    }
+    report(&activate);
+    report(&tick);
+    ShutdownOS(E_OK);
+    TerminateTask();
+}
+
+TASK(tick_task) { TerminateTask(); }
+TASK(low8) { TerminateTask(); }
+TASK(low7) { TerminateTask(); }
+TASK(low6) { TerminateTask(); }
+TASK(low5) { TerminateTask(); }
+TASK(low4) { TerminateTask(); }
+TASK(low3) { TerminateTask(); }
+TASK(low2) { TerminateTask(); }
+
+TASK(low1)
+{
+    SetEvent(bench, done);
+    TerminateTask();
+}
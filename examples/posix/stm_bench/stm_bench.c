@@ -0,0 +1,198 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "tpl_os.h"
+#include "tpl_os_stm_kernel.h"
+
+#if defined(__i386__) || defined(__x86_64__)
+#include <x86intrin.h>
+#define UNIT "cycles"
+static unsigned long long now(void)
+{
+    return __rdtsc();
+}
+#else
+#define UNIT "ns"
+static unsigned long long now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+#endif
+
+#define ROUNDS        5000
+#define WARMUP        100
+#define OBJECT_COUNT  8
+
+/* at most two executions of read_all per task and round */
+#define MAX_SAMPLES   (4 * OBJECT_COUNT * ROUNDS)
+
+DeclareObject(obj0);
+DeclareObject(obj1);
+DeclareObject(obj2);
+DeclareObject(obj3);
+DeclareObject(obj4);
+DeclareObject(obj5);
+DeclareObject(obj6);
+DeclareObject(obj7);
+
+DeclareTask(writer);
+DeclareTask(helper);
+
+/*
+ * The kernel functions are called directly, with the interrupts
+ * disabled, so that the measure does not include the kernel entry.
+ */
+#define MEASURE(m, status, call)                \
+    do {                                        \
+        unsigned long long t0;                  \
+        SuspendAllInterrupts();                 \
+        t0 = now();                             \
+        status = call;                          \
+        account(&(m), now() - t0);              \
+        ResumeAllInterrupts();                  \
+    } while (0)
+
+typedef struct {
+    const char *name;
+    unsigned long count;
+    unsigned long long samples[MAX_SAMPLES];
+} measure;
+
+static measure begin_read = { "begin_read", 0 };
+static measure begin_write = { "begin_write", 0 };
+static measure open_read = { "open_read", 0 };
+static measure open_write = { "open_write", 0 };
+static measure commit_read = { "commit_read", 0 };
+static measure commit_write = { "commit_write", 0 };
+
+static int round = 0;
+static int value = 0;
+static int retries = 0;
+static int errors = 0;
+
+static void account(measure *m, unsigned long long duration)
+{
+    /* the first rounds fill the caches */
+    if (round >= WARMUP && m->count < MAX_SAMPLES)
+    {
+        m->samples[m->count] = duration;
+        m->count++;
+    }
+}
+
+static int compare(const void *a, const void *b)
+{
+    const unsigned long long x = *(const unsigned long long *)a;
+    const unsigned long long y = *(const unsigned long long *)b;
+    return (x > y) - (x < y);
+}
+
+/*
+ * The maximum includes the preemptions of the process by the host, the
+ * 99.9th percentile does not.
+ */
+static void report(measure *m)
+{
+    qsort(m->samples, m->count, sizeof(m->samples[0]), compare);
+    printf("%-12s min %5llu median %5llu 99.9%% %5llu max %8llu %s\n",
+           m->name, m->samples[0], m->samples[m->count / 2],
+           m->samples[m->count - 1 - m->count / 1000],
+           m->samples[m->count - 1], UNIT);
+}
+
+static ObjectType object(int i)
+{
+    const ObjectType objects[OBJECT_COUNT] = {
+        obj0, obj1, obj2, obj3, obj4, obj5, obj6, obj7
+    };
+    return objects[i];
+}
+
+/*
+ * Reads all the objects, the values of a committed transaction are all the
+ * same. If interfere is TRUE, the writer commits in the middle.
+ */
+static StatusType read_all(int interfere)
+{
+    StatusType status;
+    int data[OBJECT_COUNT];
+    int i;
+
+    MEASURE(begin_read, status, tpl_stm_begin_read_tx_service());
+    for (i = 0; i < OBJECT_COUNT; i++)
+    {
+        MEASURE(open_read, status, tpl_stm_open_read_object_service(object(i), &data[i]));
+        if (interfere && i == 0)
+        {
+            ActivateTask(writer);
+        }
+    }
+    MEASURE(commit_read, status, tpl_stm_commit_read_tx_service());
+    if (status == E_OK)
+    {
+        for (i = 1; i < OBJECT_COUNT; i++)
+        {
+            if (data[i] != data[0])
+            {
+                errors++;
+            }
+        }
+    }
+    return status;
+}
+
+int main(void)
+{
+    StartOS(OSDEFAULTAPPMODE);
+    return 0;
+}
+
+TASK(bench)
+{
+    for (round = 0; round < ROUNDS; round++)
+    {
+        /* the writer fails the transaction, then commits during the retry */
+        while (read_all(TRUE) == E_OS_STM_RETRY)
+        {
+            retries++;
+        }
+    }
+    report(&begin_read);
+    report(&begin_write);
+    report(&open_read);
+    report(&open_write);
+    report(&commit_read);
+    report(&commit_write);
+    printf("%d retries, %d errors\n", retries, errors);
+    ShutdownOS(E_OK);
+    TerminateTask();
+}
+
+TASK(writer)
+{
+    StatusType status;
+    int i;
+
+    value++;
+    MEASURE(begin_write, status, tpl_stm_begin_write_tx_service());
+    for (i = 0; i < OBJECT_COUNT; i++)
+    {
+        MEASURE(open_write, status, tpl_stm_open_write_object_service(object(i), &value));
+    }
+    MEASURE(commit_write, status, tpl_stm_commit_write_tx_service());
+    (void)status;
+    /* helper reads the objects, their update may be pending */
+    ActivateTask(helper);
+    TerminateTask();
+}
+
+TASK(helper)
+{
+    while (read_all(FALSE) == E_OS_STM_RETRY)
+    {
+        retries++;
+    }
+    TerminateTask();
+}
@@ -0,0 +1,161 @@
+/**
+ * @file spinlock_bench/spinlock_bench.c
+ *
+ * @section desc File description
+ *
+ * Spinlock contention benchmark. The two cores take the same spinlock
+ * ITERATIONS times in a row, once for each lock algorithm.
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline Test Suite
+ *
+ * Trampoline Test Suite is copyright (c) IRCCyN 2005-2007
+ * Trampoline Test Suite is protected by the French intellectual property law.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2
+ * of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#include "Os.h"
+#include "tpl_os.h"
+#include "tpl_registers.h"
+
+#define ITERATIONS    10000
+#define PHASE_COUNT   3
+
+/* PIT channel used as a free running down counter to time the phases */
+#define BENCH_PIT     3
+
+DeclareSpinlock(spin_tas);
+DeclareSpinlock(spin_ticket);
+DeclareSpinlock(spin_mcs);
+
+DeclareTask(bench_core0);
+DeclareTask(bench_core1);
+
+/*
+ * Results, read with the debugger once bench_done is 2:
+ * - bench_duration is the time taken by each core for the ITERATIONS
+ *   acquisitions of each spinlock, in PIT ticks;
+ * - shared_counter is 2 * ITERATIONS for each spinlock if the mutual
+ *   exclusion holds.
+ * The spin iterations are in the stats field of the spinlock descriptors
+ * (spin_tas_spinlock_desc, spin_ticket_spinlock_desc and
+ * spin_mcs_spinlock_desc).
+ */
+volatile VAR(uint32, AUTOMATIC) bench_duration[2][PHASE_COUNT];
+volatile VAR(uint32, AUTOMATIC) shared_counter[PHASE_COUNT];
+volatile VAR(uint32, AUTOMATIC) bench_done = 0;
+
+/* number of cores that reached the start of each phase */
+volatile VAR(uint32, AUTOMATIC) bench_arrived[PHASE_COUNT];
+
+#define APP_COMMON_START_SEC_CODE
+#include "tpl_memmap.h"
+
+int main(void)
+{
+  StatusType rv;
+
+  switch(GetCoreID()){
+    case OS_CORE_ID_MASTER :
+      /* Wakeup core 1 */
+      StartCore(OS_CORE_ID_1, &rv);
+      if(rv == E_OK)
+        StartOS(OSDEFAULTAPPMODE);
+      break;
+    case OS_CORE_ID_1 :
+      StartOS(OSDEFAULTAPPMODE);
+      break;
+    default :
+      /* Should not happen */
+      break;
+  }
+  return 0;
+}
+
+/*
+ * Both cores start a phase together, so that they contend for the
+ * spinlock during the whole phase.
+ */
+static void bench_barrier(uint32 phase)
+{
+  GetSpinlock(spin_tas);
+  bench_arrived[phase]++;
+  ReleaseSpinlock(spin_tas);
+  while (bench_arrived[phase] < 2)
+  {
+  }
+}
+
+static void bench_phase(uint32 core, uint32 phase, SpinlockIdType spinlock)
+{
+  uint32 start;
+  uint32 i;
+
+  bench_barrier(phase);
+  start = PIT_CVR(BENCH_PIT);
+  for (i = 0; i < ITERATIONS; i++)
+  {
+    GetSpinlock(spinlock);
+    shared_counter[phase]++;
+    ReleaseSpinlock(spinlock);
+  }
+  bench_duration[core][phase] = start - PIT_CVR(BENCH_PIT);
+}
+
+static void bench_run(uint32 core)
+{
+  bench_phase(core, 0, spin_tas);
+  bench_phase(core, 1, spin_ticket);
+  bench_phase(core, 2, spin_mcs);
+
+  GetSpinlock(spin_tas);
+  bench_done++;
+  ReleaseSpinlock(spin_tas);
+}
+
+#define APP_COMMON_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+#define APP_Task_bench_core0_START_SEC_CODE
+#include "tpl_memmap.h"
+TASK(bench_core0)
+{
+  /* the counter is started before core 1 may pass the first barrier */
+  PIT_LVR(BENCH_PIT) = 0xFFFFFFFF;
+  PIT_CR(BENCH_PIT) = PIT_CR_TEN;
+  bench_run(0);
+  TerminateTask();
+}
+#define APP_Task_bench_core0_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+#define APP_Task_bench_core1_START_SEC_CODE
+#include "tpl_memmap.h"
+TASK(bench_core1)
+{
+  bench_run(1);
+  TerminateTask();
+}
+#define APP_Task_bench_core1_STOP_SEC_CODE
+#include "tpl_memmap.h"
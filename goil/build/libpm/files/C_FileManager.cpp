@@ -666,6 +666,20 @@ bool C_FileManager::writeStringToExecutableFile (const C_String & inString,
 
 //----------------------------------------------------------------------------------------------------------------------
 
+bool C_FileManager::appendStringToFile (const C_String & inString,
+                                        const C_String & inFilePath) {
+  makeDirectoryIfDoesNotExist (inFilePath.stringByDeletingLastPathComponent ()) ;
+  C_TextFileWrite file (inFilePath, true) ;
+  bool success = file.isOpened () ;
+  file << inString ;
+  if (success) {
+    success = file.close () ;
+  }
+  return success ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
 bool C_FileManager::writeBinaryDataToFile (const C_Data & inBinaryData,
                                            const C_String & inFilePath) {
   makeDirectoryIfDoesNotExist (inFilePath.stringByDeletingLastPathComponent()) ;
@@ -1000,6 +1014,50 @@ C_String C_FileManager::deleteFile (const C_String & inFilePath) {
 
 //----------------------------------------------------------------------------------------------------------------------
 
+C_String C_FileManager::renameFile (const C_String & inFilePath,
+                                    const C_String & inNewFilePath) {
+  C_String returnValue ;
+  const C_String nativePath = nativePathWithUnixPath (inFilePath) ;
+  const C_String newNativePath = nativePathWithUnixPath (inNewFilePath) ;
+  #if COMPILE_FOR_WINDOWS == 1
+  //--- rename does not replace an existing file on Windows
+    unlink (newNativePath.cString (HERE)) ;
+  #endif
+  const int result = ::rename (nativePath.cString (HERE), newNativePath.cString (HERE)) ;
+  if (result < 0) {
+    returnValue << ::strerror (errno) ;
+  }
+  return returnValue ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+bool C_FileManager::filesHaveSameContents (const C_String & inFilePath1,
+                                           const C_String & inFilePath2) {
+  FILE * file1 = openBinaryFileForReading (inFilePath1) ;
+  FILE * file2 = openBinaryFileForReading (inFilePath2) ;
+  bool same = (file1 != NULL) && (file2 != NULL) ;
+  while (same) {
+    char buffer1 [4096] ;
+    char buffer2 [4096] ;
+    const size_t length1 = ::fread (buffer1, 1, sizeof (buffer1), file1) ;
+    const size_t length2 = ::fread (buffer2, 1, sizeof (buffer2), file2) ;
+    same = (length1 == length2) && (::memcmp (buffer1, buffer2, length1) == 0) ;
+    if (length1 == 0) {
+      break ;
+    }
+  }
+  if (file1 != NULL) {
+    ::fclose (file1) ;
+  }
+  if (file2 != NULL) {
+    ::fclose (file2) ;
+  }
+  return same ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
 #ifdef PRAGMA_MARK_ALLOWED
   #pragma mark Search a file in a directory
 #endif
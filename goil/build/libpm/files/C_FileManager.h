@@ -61,6 +61,10 @@ class C_FileManager {
   public : static bool writeStringToExecutableFile (const C_String & inString,
                                                     const C_String & inFilePath) ;
 
+//--- Append string to file, the file is created if it does not exist
+  public : static bool appendStringToFile (const C_String & inString,
+                                           const C_String & inFilePath) ;
+
 //--- Write data to file
   public : static bool writeBinaryDataToFile (const C_Data & inBinaryData,
                                               const C_String & inFilePath) ;
@@ -71,6 +75,14 @@ class C_FileManager {
 //--- Delete file (returns an empty string on success, or a string describing the error)
   public : static C_String deleteFile (const C_String & inFilePath) ;
 
+//--- Rename file, replacing inNewFilePath (returns an empty string on success, or a string describing the error)
+  public : static C_String renameFile (const C_String & inFilePath,
+                                       const C_String & inNewFilePath) ;
+
+//--- Compare the bytes of two files
+  public : static bool filesHaveSameContents (const C_String & inFilePath1,
+                                              const C_String & inFilePath2) ;
+
 //--- Directory handling
   public : static C_String currentDirectory (void) ;
   public : static bool directoryExists (const C_String & inDirectoryPath) ;
@@ -29,11 +29,25 @@
 
 //----------------------------------------------------------------------------------------------------------------------
 
-C_TextFileWrite::C_TextFileWrite (const C_String & inFileName) :
-AC_FileHandleForWriting (inFileName, "wt"),
+C_TextFileWrite::C_TextFileWrite (const C_String & inFileName,
+                                  const bool inAppend) :
+AC_FileHandleForWriting (inFileName, inAppend ? "at" : "wt"),
 mBufferLength (0) {
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+//                    Write buffered characters into the file
+// fwrite is used instead of fprintf ("%.*s") : it does not parse a format and
+// does not stop on a NUL character
+//----------------------------------------------------------------------------------------------------------------------
+
+void C_TextFileWrite::flushBuffer (void) {
+  if (mBufferLength > 0) {
+    ::fwrite (mBuffer, 1, (size_t) mBufferLength, mFilePtr) ;
+    mBufferLength = 0 ;
+  }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 //                                Close                                                          
 //----------------------------------------------------------------------------------------------------------------------
@@ -41,10 +55,7 @@ mBufferLength (0) {
 bool C_TextFileWrite::close (void) {
   bool ok = true ;
   if (mFilePtr != NULL) {
-    if (mBufferLength > 0) {
-      ::fprintf (mFilePtr, "%.*s", (int) mBufferLength, mBuffer) ;
-      mBufferLength = 0 ;
-    }
+    flushBuffer () ;
     ok = ::fclose (mFilePtr) == 0 ; // Flushes the file, then closes it
     mFilePtr = NULL ;
   }
@@ -57,9 +68,8 @@ bool C_TextFileWrite::close (void) {
 //----------------------------------------------------------------------------------------------------------------------
 
 C_TextFileWrite::~C_TextFileWrite (void) {
-  if ((mFilePtr != NULL) && (mBufferLength > 0)) {
-    ::fprintf (mFilePtr, "%.*s", (int) mBufferLength, mBuffer) ;
-    mBufferLength = 0 ;
+  if (mFilePtr != NULL) {
+    flushBuffer () ;
   }
 }
 
@@ -74,11 +84,8 @@ void C_TextFileWrite::performActualCharArrayOutput (const char * inCharArray,
       ::memcpy (& mBuffer [mBufferLength], inCharArray, (size_t) inArrayCount) ;
       mBufferLength += inArrayCount ;
     }else{
-      if (mBufferLength > 0) {
-        ::fprintf (mFilePtr, "%.*s", (int) mBufferLength, mBuffer) ;
-        mBufferLength = 0 ;
-      }
-      ::fprintf (mFilePtr, "%.*s", (int) inArrayCount, inCharArray) ;
+      flushBuffer () ;
+      ::fwrite (inCharArray, 1, (size_t) inArrayCount, mFilePtr) ;
     }
   }
 }
@@ -89,14 +96,18 @@ void C_TextFileWrite::performActualUnicodeArrayOutput (const utf32 * inCharArray
                                                        const int32_t inArrayCount) {
   if ((mFilePtr != NULL) && (inArrayCount > 0)) {
     for (int32_t i=0 ; i<inArrayCount ; i++) {
-      char buffer [5] ;
-      const int32_t length = UTF8StringFromUTF32Character (inCharArray [i], buffer) ;
-      if ((mBufferLength + length) > kFileBufferSize) {
-        ::fprintf (mFilePtr, "%.*s", (int) mBufferLength, mBuffer) ;
-        mBufferLength = 0 ;
+    //--- A character needs at most 4 bytes in UTF-8, plus the terminating NUL
+    //    written by UTF8StringFromUTF32Character (mBuffer has one extra byte)
+      if ((mBufferLength + 4) > kFileBufferSize) {
+        flushBuffer () ;
+      }
+      const uint32_t codePoint = UNICODE_VALUE (inCharArray [i]) ;
+      if (codePoint < 0x80) { // ASCII
+        mBuffer [mBufferLength] = (char) codePoint ;
+        mBufferLength ++ ;
+      }else{
+        mBufferLength += UTF8StringFromUTF32Character (inCharArray [i], & mBuffer [mBufferLength]) ;
       }
-      ::memcpy (& mBuffer [mBufferLength], buffer, (size_t) length) ;
-      mBufferLength += length ;
     }
   }
 }
@@ -107,10 +118,7 @@ void C_TextFileWrite::performActualUnicodeArrayOutput (const utf32 * inCharArray
 
 void C_TextFileWrite::flush (void) {
   if (mFilePtr != NULL) {
-    if (mBufferLength > 0) {
-      ::fprintf (mFilePtr, "%.*s", (int) mBufferLength, mBuffer) ;
-      mBufferLength = 0 ;
-    }
+    flushBuffer () ;
     ::fflush (mFilePtr) ;
   }
 }
@@ -38,9 +38,10 @@ const int32_t kFileBufferSize = 10000 ;
 
 class C_TextFileWrite : public AC_OutputStream, public AC_FileHandleForWriting {
 //--- Constructor : if inFileName is the empty string, no file is opened.
-//    Otherwise, it tries to open the file for writing;
+//    Otherwise, it tries to open the file for writing, at its end if inAppend is true;
 //    The destructor will close the file (is successfully opened)
-  public : C_TextFileWrite (const C_String & inFileName) ;
+  public : C_TextFileWrite (const C_String & inFileName,
+                            const bool inAppend = false) ;
 
 //--- Destructor closes the file
   public : virtual ~C_TextFileWrite (void) ;
@@ -62,6 +63,9 @@ class C_TextFileWrite : public AC_OutputStream, public AC_FileHandleForWriting {
 //--- Close file (does nothing is file is not open)
   public : virtual bool close (void) ;
 
+//--- Write buffered characters into the file
+  private : void flushBuffer (void) ;
+
 //--- Private attributes
   private : int32_t mBufferLength ;
   private : char mBuffer [kFileBufferSize + 1] ;
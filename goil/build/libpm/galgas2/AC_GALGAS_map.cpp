@@ -85,6 +85,8 @@ class cSharedMapRoot : public C_SharedObject {
                                                                const uint32_t inLevel,
                                                                const cSharedMapRoot * inFirstMap) const ;
 
+  private : VIRTUAL_IN_DEBUG cMapNode * findEntryInMapForWriting (const C_String & inKey) ;
+
   public : VIRTUAL_IN_DEBUG void findNearestKey (const C_String & inKey,
                                                  TC_UniqueArray <C_String> & ioNearestKeyArray) const ;
 
@@ -159,12 +161,17 @@ class cSharedMapRoot : public C_SharedObject {
 //
 //  c M a p N o d e                                                                              
 //
+//  Nodes are reference counted and shared between the trees of map copies: copying a map only retains its root
+//  node. A node is modified only when it is uniquely referenced, so a modification first copies the nodes of the
+//  path from the root to the modified node that are shared (path copying).
+//
 //----------------------------------------------------------------------------------------------------------------------
 
 class cMapNode {
   public : cMapNode * mInfPtr ;
   public : cMapNode * mSupPtr ;
   public : int32_t mBalance ;
+  public : uint32_t mReferenceCount ;
   public : const C_String mKey ;
   public : capCollectionElement mAttributes ;
 
@@ -172,7 +179,7 @@ class cMapNode {
   public : cMapNode (const C_String & inKey,
                      const capCollectionElement & inAttributes) ;
 
-  public : cMapNode (cMapNode * inNode) ;
+  public : cMapNode (const cMapNode * inNode) ;
 
 //--- Destructor
   public : virtual ~ cMapNode (void) ;
@@ -184,6 +191,40 @@ class cMapNode {
 
 //----------------------------------------------------------------------------------------------------------------------
 
+static inline void retainNode (cMapNode * inNode) {
+  if (NULL != inNode) {
+    macroValidPointer (inNode) ;
+    inNode->mReferenceCount ++ ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static void releaseNode (cMapNode * & ioNode) {
+  if (NULL != ioNode) {
+    macroValidPointer (ioNode) ;
+    ioNode->mReferenceCount -- ;
+    if (0 == ioNode->mReferenceCount) {
+      macroMyDelete (ioNode) ;
+    }
+    ioNode = NULL ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Replace a shared node by a copy that references the same subtrees
+
+static void uniqueNode (cMapNode * & ioNode) {
+  if ((NULL != ioNode) && (ioNode->mReferenceCount > 1)) {
+    cMapNode * p = NULL ;
+    macroMyNew (p, cMapNode (ioNode)) ;
+    ioNode->mReferenceCount -- ;
+    ioNode = p ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
 cSharedMapRoot::cSharedMapRoot (const bool inActivateReplacementSuggestions COMMA_LOCATION_ARGS) :
 C_SharedObject (THERE),
 mRoot (NULL),
@@ -195,7 +236,7 @@ mActivateReplacementSuggestions (inActivateReplacementSuggestions) {
 //----------------------------------------------------------------------------------------------------------------------
 
 cSharedMapRoot::~ cSharedMapRoot (void) {
-  macroMyDelete (mRoot) ;
+  releaseNode (mRoot) ;
   macroDetachSharedObject (mOverridenMap) ;
 }
 
@@ -206,6 +247,7 @@ cMapNode::cMapNode (const C_String & inKey,
 mInfPtr (NULL),
 mSupPtr (NULL),
 mBalance (0),
+mReferenceCount (1),
 mKey (inKey),
 mAttributes (inAttributes) {
 }
@@ -213,8 +255,8 @@ mAttributes (inAttributes) {
 //----------------------------------------------------------------------------------------------------------------------
 
 cMapNode::~cMapNode (void) {
-  macroMyDelete (mInfPtr) ;
-  macroMyDelete (mSupPtr) ;
+  releaseNode (mInfPtr) ;
+  releaseNode (mSupPtr) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -427,6 +469,32 @@ cMapNode * cSharedMapRoot::findEntryInMap (const C_String & inKey,
   return result ;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+// Returns the node of inKey, after making unique the nodes of the path from the root of the tree that contains it
+
+cMapNode * cSharedMapRoot::findEntryInMapForWriting (const C_String & inKey) {
+  cMapNode * result = NULL ;
+  cSharedMapRoot * currentMap = this ;
+  while ((NULL != currentMap) && (NULL == result)) {
+    if (NULL != findEntryInMapAtLevel (inKey, 0, currentMap)) {
+      cMapNode * * nodePtr = & currentMap->mRoot ;
+      while (NULL == result) {
+        uniqueNode (*nodePtr) ;
+        const int32_t comparaison = (*nodePtr)->mKey.compare (inKey) ;
+        if (comparaison > 0) {
+          nodePtr = & (*nodePtr)->mInfPtr ;
+        }else if (comparaison < 0) {
+          nodePtr = & (*nodePtr)->mSupPtr ;
+        }else{ // Found
+          result = *nodePtr ;
+        }
+      }
+    }
+    currentMap = currentMap->mOverridenMap ;
+  }
+  return result ;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 
 const cMapNode * cSharedMapRoot::findNodeForKeyInMapOrInOverridenMaps (const GALGAS_string & inKey,
@@ -484,7 +552,7 @@ cCollectionElement * AC_GALGAS_map::readWriteAccessForWithInstructionWithErrorMe
   if (isValid () && inKey.isValid ()) {
     insulate (HERE) ;
     const C_String key = inKey.mProperty_string.stringValue () ;
-    cMapNode * node = mSharedMap->findEntryInMap (key, mSharedMap) ;
+    cMapNode * node = mSharedMap->findEntryInMapForWriting (key) ;
     if (NULL == node) {
       TC_UniqueArray <C_String> nearestKeyArray ;
       if (mActivateReplacementSuggestions) {
@@ -507,6 +575,8 @@ cCollectionElement * AC_GALGAS_map::readWriteAccessForWithInstructionWithErrorMe
 //----------------------------------------------------------------------------------------------------------------------
 
 static void rotateLeft (cMapNode * & ioRootPtr) {
+  uniqueNode (ioRootPtr) ;
+  uniqueNode (ioRootPtr->mSupPtr) ;
   cMapNode * b = ioRootPtr->mSupPtr ;
   ioRootPtr->mSupPtr = b->mInfPtr ;
   b->mInfPtr = ioRootPtr;
@@ -528,6 +598,8 @@ static void rotateLeft (cMapNode * & ioRootPtr) {
 //----------------------------------------------------------------------------------------------------------------------
 
 static void rotateRight (cMapNode * & ioRootPtr) {
+  uniqueNode (ioRootPtr) ;
+  uniqueNode (ioRootPtr->mInfPtr) ;
   cMapNode * b = ioRootPtr->mInfPtr ;
   ioRootPtr->mInfPtr = b->mSupPtr ;
   b->mSupPtr = ioRootPtr ;
@@ -558,6 +630,7 @@ static bool internalInsertOrReplace (cMapNode * & ioRootPtr,
     anObjectHasBeenAdded = true ;
   }else{
     macroValidPointer (ioRootPtr) ;
+    uniqueNode (ioRootPtr) ;
     const int32_t comparaison = ioRootPtr->mKey.compare (inKey) ;
     if (comparaison > 0) {
       anObjectHasBeenAdded = internalInsertOrReplace (ioRootPtr->mInfPtr, inKey, ioAttributeArray, ioExtension) ;
@@ -636,18 +709,15 @@ void AC_GALGAS_map::performInsertOrReplace (const capCollectionElement & inAttri
 
 //----------------------------------------------------------------------------------------------------------------------
 
-cMapNode::cMapNode (cMapNode * inNode) :
-mInfPtr (NULL),
-mSupPtr (NULL),
+cMapNode::cMapNode (const cMapNode * inNode) :
+mInfPtr (inNode->mInfPtr),
+mSupPtr (inNode->mSupPtr),
 mBalance (inNode->mBalance),
+mReferenceCount (1),
 mKey (inNode->mKey),
 mAttributes (inNode->mAttributes) {
-  if (inNode->mInfPtr != NULL) {
-    macroMyNew (mInfPtr, cMapNode (inNode->mInfPtr)) ;
-  }
-  if (inNode->mSupPtr != NULL) {
-    macroMyNew (mSupPtr, cMapNode (inNode->mSupPtr)) ;
-  }
+  retainNode (mInfPtr) ;
+  retainNode (mSupPtr) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -659,9 +729,8 @@ void cSharedMapRoot::copyFrom (const cSharedMapRoot * inSource) {
   #endif
   macroValidSharedObject (inSource, cSharedMapRoot) ;
   mCount = inSource->mCount ;
-  if (NULL != inSource->mRoot) {
-    macroMyNew (mRoot, cMapNode (inSource->mRoot)) ;
-  }
+  mRoot = inSource->mRoot ;
+  retainNode (mRoot) ;
   macroAssignSharedObject (mOverridenMap, inSource->mOverridenMap) ;
   #ifndef DO_NOT_GENERATE_CHECKINGS
     checkMap (HERE) ;
@@ -689,9 +758,8 @@ void cSharedMapRoot::copyCurrentAndOverridenMapsFrom (const cSharedMapRoot * inS
   #endif
   macroValidSharedObject (inSource, cSharedMapRoot) ;
   mCount = inSource->mCount ;
-  if (NULL != inSource->mRoot) {
-    macroMyNew (mRoot, cMapNode (inSource->mRoot)) ;
-  }
+  mRoot = inSource->mRoot ;
+  retainNode (mRoot) ;
   if (NULL != inSource->mOverridenMap) {
     macroMyNew (mOverridenMap, cSharedMapRoot (mActivateReplacementSuggestions COMMA_HERE)) ;
     mOverridenMap->copyCurrentAndOverridenMapsFrom (inSource->mOverridenMap) ;
@@ -705,7 +773,7 @@ void cSharedMapRoot::copyCurrentAndOverridenMapsFrom (const cSharedMapRoot * inS
 
 void AC_GALGAS_map::insulateCurrentAndOverridenMaps (LOCATION_ARGS) {
   if (NULL != mSharedMap) {
-  //--- Perform a deep copy if any of the overriden maps is shared
+  //--- Copy the map and the overriden maps if any of them is shared (the trees are shared, see cMapNode)
     bool performDeepCopy = !mSharedMap->isUniquelyReferenced () ;
     cSharedMapRoot * overridenMap = mSharedMap->mOverridenMap ;
     while ((NULL != overridenMap) && !performDeepCopy) {
@@ -742,6 +810,7 @@ static cMapNode * internalInsert (cMapNode * & ioRootPtr,
     matchingEntry = ioRootPtr ;
   }else{
     macroValidPointer (ioRootPtr) ;
+    uniqueNode (ioRootPtr) ;
     const int32_t comparaison = ioRootPtr->mKey.compare (inKey) ;
     if (comparaison > 0) {
       matchingEntry = internalInsert (ioRootPtr->mInfPtr, inKey, inAttributes, outEntryAlreadyExists, ioExtension) ;
@@ -1245,7 +1314,7 @@ cMapElement * cSharedMapRoot::searchForReadWriteAttribute (const GALGAS_string &
   cMapElement * result = NULL ;
   if (inKey.isValid ()) {
     const C_String key = inKey.stringValue () ;
-    cMapNode * node = findEntryInMap (key, this) ;
+    cMapNode * node = findEntryInMapForWriting (key) ;
     if (NULL != node) {
       node->mAttributes.insulate () ;
       result = (cMapElement *) node->mAttributes.ptr () ;
@@ -1294,7 +1363,7 @@ cMapElement * cSharedMapRoot::searchForReadWriteAttribute (const GALGAS_lstring
   cMapElement * result = NULL ;
   if (inKey.isValid ()) {
     const C_String key = inKey.mProperty_string.stringValue () ;
-    cMapNode * node = findEntryInMap (key, this) ;
+    cMapNode * node = findEntryInMapForWriting (key) ;
     if (NULL != node) {
       node->mAttributes.insulate () ;
       result = (cMapElement *) node->mAttributes.ptr () ;
@@ -1396,6 +1465,7 @@ static void infBranchDecreased (cMapNode * & ioRoot,
 static void getPreviousElement (cMapNode * & ioRoot,
                                 cMapNode * & ioElement,
                                 bool & ioBranchHasBeenRemoved) {
+  uniqueNode (ioRoot) ;
   if (ioRoot->mSupPtr == NULL) {
     ioElement = ioRoot ;
     ioRoot = ioRoot->mInfPtr ;
@@ -1415,6 +1485,7 @@ static cMapNode * internalRemoveEntry (const C_String & inKeyToRemove,
                                        bool & ioBranchHasBeenRemoved) {
   cMapNode * removedNode = NULL ;
   if (ioRoot != NULL) {
+    uniqueNode (ioRoot) ;
     const int32_t comparaison = ioRoot->mKey.compare (inKeyToRemove) ;
     if (comparaison > 0) {
       removedNode = internalRemoveEntry (inKeyToRemove, ioRoot->mInfPtr, ioBranchHasBeenRemoved);
@@ -1490,7 +1561,7 @@ void cSharedMapRoot::performRemove (GALGAS_lstring & inKey,
       inCompiler->semanticErrorAtLocation (key_location, message, TC_Array <C_FixItDescription> () COMMA_THERE) ;
     }else{ // Ok, found
       outResult = node->mAttributes ;
-      macroMyDelete (node) ;
+      releaseNode (node) ;
       mCount -- ;
     }
   }
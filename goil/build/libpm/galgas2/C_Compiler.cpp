@@ -72,6 +72,7 @@ mTemplateString (),
 mTemplateStringLocation (),
 mSourceText (),
 mCurrentLocation (),
+mParsedSourceTextArray (),
 mStartLocationForHere (),
 mEndLocationForHere (),
 mStartLocationForNext (),
@@ -93,6 +94,15 @@ C_String C_Compiler::sourceFilePath (void) const {
 
 //----------------------------------------------------------------------------------------------------------------------
 
+void C_Compiler::appendParsedSourceText (const C_SourceTextInString & inSourceText) {
+  mParsedSourceTextArray.appendObject (inSourceText) ;
+  if ((NULL != mCallerCompiler) && (NULL != mCallerCompiler->mCallerCompiler)) {
+    mCallerCompiler->appendParsedSourceText (inSourceText) ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
 #ifdef PRAGMA_MARK_ALLOWED
   #pragma mark Issue
 #endif
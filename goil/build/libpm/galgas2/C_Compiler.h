@@ -84,6 +84,14 @@ class C_Compiler : public C_SharedObject {
     return mSourceText ;
   }
 
+//--- Source texts read by the lexiques of this compiler and of the compilers it calls, the top compiler does not
+//    record them
+  private : TC_UniqueArray <C_SourceTextInString> mParsedSourceTextArray ;
+  public : void appendParsedSourceText (const C_SourceTextInString & inSourceText) ;
+  public : inline const TC_UniqueArray <C_SourceTextInString> & parsedSourceTextArray (void) const {
+    return mParsedSourceTextArray ;
+  }
+
 //--- 'loop' intruction variant run-time error
   public : void loopRunTimeVariantError (LOCATION_ARGS) ;
 
@@ -116,6 +116,7 @@ mLatexNextCharacterToEnterIndex (0) {
       resetAndLoadSourceFromText (source) ;
       mTokenStartLocation.resetWithSourceText (source) ;
       mTokenEndLocation.resetWithSourceText (source) ;
+      appendParsedSourceText (source) ;
     }else if (inCallerCompiler != NULL) {
       C_String errorMessage ; 
       errorMessage << "cannot read '" << inSourceFileName << "': this file does not exist or is not encoded in UTF8" ;
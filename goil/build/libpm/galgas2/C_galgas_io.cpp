@@ -119,6 +119,24 @@ int32_t totalWarningCount (void) {
   return mTotalWarningCount ;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+//
+//    Issues signaled by an other process, their messages are already printed
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+void appendIssueCounts (const int32_t inErrorCount,
+                        const int32_t inWarningCount) {
+  mErrorTotalCount += inErrorCount ;
+  mTotalWarningCount += inWarningCount ;
+  if ((inErrorCount > 0) && (totalErrorCount () >= maxErrorCount ())) {
+    throw max_error_count_reached_exception () ;
+  }
+  if ((inWarningCount > 0) && (totalWarningCount () >= maxWarningCount ())) {
+    throw max_warning_count_reached_exception () ;
+  }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 //
 //    Construct error or warning location message                                                
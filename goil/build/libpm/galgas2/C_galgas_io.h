@@ -148,6 +148,10 @@ int32_t totalErrorCount (void) ;
 int32_t maxWarningCount (void) ;
 
 int32_t totalWarningCount (void) ;
+
+//--- Issues of an other process
+void appendIssueCounts (const int32_t inErrorCount,
+                        const int32_t inWarningCount) ;
  
 void signalParsingError (C_Compiler * inCompiler,
                          const C_SourceTextInString & inSourceText,
@@ -24,8 +24,38 @@
 #include "command_line_interface/C_StringCommandLineOption.h"
 #include "command_line_interface/F_Analyze_CLI_Options.h"
 #include "galgas2/F_verbose_output.h"
+#include "galgas2/C_galgas_io.h"
+#include "galgas2/C_galgas_CLI_Options.h"
+#include "command_line_interface/C_builtin_CLI_Options.h"
+#include "streams/C_ConsoleOut.h"
+#include "streams/C_ErrorOut.h"
+#include "files/C_FileManager.h"
 #include "cLexiqueIntrospection.h"
 
+//----------------------------------------------------------------------------------------------------------------------
+
+#ifndef COMPILE_FOR_WINDOWS
+  #error COMPILE_FOR_WINDOWS is undefined
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------
+
+#if COMPILE_FOR_WINDOWS == 0
+  #include <stdio.h>
+  #include <stdlib.h>
+  #include <string.h>
+  #include <unistd.h>
+  #include <dirent.h>
+  #include <sys/stat.h>
+  #include <sys/wait.h>
+#endif
+
+#ifdef __linux__
+  #include <errno.h>
+  #include <poll.h>
+  #include <sys/inotify.h>
+#endif
+
 //----------------------------------------------------------------------------------------------------------------------
 //
 //                     'GALGAS_application' class                                                
@@ -362,6 +392,31 @@ GALGAS_string GALGAS_application::constructor_commandLineArgumentAtIndex (const
   return result ;
 }
 
+//----------------------------------------------------------------------------------------------------------------------*
+//  Source files read by the lexiques called from the current one, and the MD5 of their contents as they were read
+//----------------------------------------------------------------------------------------------------------------------*
+
+GALGAS__32_stringlist GALGAS_application::constructor_parsedSourceFiles (C_Compiler * inCompiler
+                                                                         COMMA_LOCATION_ARGS) {
+  GALGAS__32_stringlist result = GALGAS__32_stringlist::constructor_emptyList (THERE) ;
+  const TC_UniqueArray <C_SourceTextInString> & sourceTexts = inCompiler->parsedSourceTextArray () ;
+  TC_UniqueArray <C_String> filePaths ;
+  for (int32_t i=0 ; i < sourceTexts.count () ; i++) {
+    const C_String filePath = sourceTexts (i COMMA_HERE).sourceFilePath () ;
+    bool found = false ;
+    for (int32_t j=0 ; (j < filePaths.count ()) && ! found ; j++) {
+      found = filePaths (j COMMA_HERE) == filePath ;
+    }
+    if (! found) {
+      filePaths.appendObject (filePath) ;
+      result.addAssign_operation (GALGAS_string (filePath),
+                                  GALGAS_string (sourceTexts (i COMMA_HERE).sourceString ().md5 ())
+                                  COMMA_THERE) ;
+    }
+  }
+  return result ;
+}
+
 //----------------------------------------------------------------------------------------------------------------------*
 
 GALGAS_stringset GALGAS_application::constructor_keywordIdentifierSet (LOCATION_ARGS) {
@@ -391,4 +446,812 @@ GALGAS_stringlist GALGAS_application::constructor_keywordListForIdentifier (cons
   return result ;
 }
 
+//----------------------------------------------------------------------------------------------------------------------*
+//  Output jobs. With a job count greater than 1, startOutputJob forks and returns true in the child, which runs the
+//  instructions up to endOutputJob with its console output in temporary files. The parent returns false and goes on,
+//  its own console output is also kept in temporary files until the jobs end. They are printed, and the error and
+//  warning counts of the jobs are added, in the order of a run without job. The GALGAS objects are not thread safe,
+//  hence the processes.
+//----------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 0
+  class cOutputJob {
+    public : pid_t mProcessID ;
+    public : FILE * mOutputFile ; // stdout of the job
+    public : FILE * mErrorFile ; // stderr of the job
+    public : FILE * mCountFile ; // error and warning counts of the job
+    public : FILE * mNextOutputFile ; // stdout of the parent up to the next job
+    public : FILE * mNextErrorFile ; // stderr of the parent up to the next job
+
+    public : cOutputJob (void) :
+    mProcessID (-1),
+    mOutputFile (NULL),
+    mErrorFile (NULL),
+    mCountFile (NULL),
+    mNextOutputFile (NULL),
+    mNextErrorFile (NULL) {
+    }
+  } ;
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 0
+  static TC_UniqueArray <cOutputJob> gOutputJobs ;
+  static bool gIsOutputJob = false ;
+  static FILE * gOutputJobCountFile = NULL ;
+  static int32_t gOutputJobStartErrorCount = 0 ;
+  static int32_t gOutputJobStartWarningCount = 0 ;
+//--- stdout and stderr of the parent while they are redirected, -1 otherwise
+  static int gConsoleOutput = -1 ;
+  static int gConsoleError = -1 ;
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 0
+  static void flushConsole (void) {
+    co.flush () ;
+    ce.flush () ;
+    fflush (stdout) ;
+    fflush (stderr) ;
+  }
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 0
+  static void closeOutputJobFile (FILE * inFile) {
+    if (inFile != NULL) {
+      fclose (inFile) ;
+    }
+  }
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 0
+  static void closeOutputJobFiles (const cOutputJob & inJob) {
+    closeOutputJobFile (inJob.mOutputFile) ;
+    closeOutputJobFile (inJob.mErrorFile) ;
+    closeOutputJobFile (inJob.mCountFile) ;
+    closeOutputJobFile (inJob.mNextOutputFile) ;
+    closeOutputJobFile (inJob.mNextErrorFile) ;
+  }
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 0
+  static void copyOutputJobFile (FILE * inFile, const int inFileDescriptor) {
+    rewind (inFile) ;
+    char buffer [4096] ;
+    size_t length = fread (buffer, 1, sizeof (buffer), inFile) ;
+    while (length > 0) {
+      size_t written = 0 ;
+      while (written < length) {
+        const ssize_t n = write (inFileDescriptor, buffer + written, length - written) ;
+        written += (n > 0) ? (size_t) n : length ;
+      }
+      length = fread (buffer, 1, sizeof (buffer), inFile) ;
+    }
+  }
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 0
+  static void restoreConsole (void) {
+    if (gConsoleOutput >= 0) {
+      flushConsole () ;
+      dup2 (gConsoleOutput, STDOUT_FILENO) ;
+      dup2 (gConsoleError, STDERR_FILENO) ;
+      close (gConsoleOutput) ;
+      close (gConsoleError) ;
+      gConsoleOutput = -1 ;
+      gConsoleError = -1 ;
+    }
+  }
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------*
+//  Also called at exit, when the job ends before endOutputJob
+
+#if COMPILE_FOR_WINDOWS == 0
+  static void writeOutputJobCounts (void) {
+    flushConsole () ;
+    fprintf (gOutputJobCountFile, "%d %d\n",
+             (int) (totalErrorCount () - gOutputJobStartErrorCount),
+             (int) (totalWarningCount () - gOutputJobStartWarningCount)) ;
+    fflush (gOutputJobCountFile) ;
+  }
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------*
+//  Waits for the first job, prints its console output, then the one of the parent up to the next job
+
+#if COMPILE_FOR_WINDOWS == 0
+  static void printFirstOutputJob (int & outErrorCount,
+                                   int & outWarningCount) {
+    const cOutputJob job = gOutputJobs (0 COMMA_HERE) ;
+    gOutputJobs.removeObjectAtIndex (0 COMMA_HERE) ;
+    int status = 0 ;
+    waitpid (job.mProcessID, & status, 0) ;
+    flushConsole () ;
+    const int output = (gConsoleOutput >= 0) ? gConsoleOutput : STDOUT_FILENO ;
+    const int error = (gConsoleError >= 0) ? gConsoleError : STDERR_FILENO ;
+    copyOutputJobFile (job.mOutputFile, output) ;
+    copyOutputJobFile (job.mErrorFile, error) ;
+    outErrorCount = 0 ;
+    outWarningCount = 0 ;
+    rewind (job.mCountFile) ;
+    if (fscanf (job.mCountFile, "%d %d", & outErrorCount, & outWarningCount) != 2) {
+      C_String message ;
+      message << "error: output job " << cStringWithSigned ((int32_t) job.mProcessID) << " did not complete\n" ;
+      const char * text = message.cString (HERE) ;
+      const ssize_t written = write (output, text, strlen (text)) ;
+      (void) written ;
+      outErrorCount = 1 ;
+      outWarningCount = 0 ;
+    }
+    copyOutputJobFile (job.mNextOutputFile, output) ;
+    copyOutputJobFile (job.mNextErrorFile, error) ;
+    closeOutputJobFiles (job) ;
+  }
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 0
+  static void waitFirstOutputJob (void) {
+    int errorCount = 0 ;
+    int warningCount = 0 ;
+    printFirstOutputJob (errorCount, warningCount) ;
+    try{
+      appendIssueCounts ((int32_t) errorCount, (int32_t) warningCount) ;
+    }catch (...) {
+    //--- The maximum count is reached, the console output of the other jobs is printed before exiting
+      restoreConsole () ;
+      while (gOutputJobs.count () > 0) {
+        printFirstOutputJob (errorCount, warningCount) ;
+      }
+      throw ;
+    }
+  }
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------*
+//  When the parent exits with jobs, on an exception for instance
+
+#if COMPILE_FOR_WINDOWS == 0
+  static void printOutputJobsAtExit (void) {
+    restoreConsole () ;
+    while (gOutputJobs.count () > 0) {
+      int errorCount = 0 ;
+      int warningCount = 0 ;
+      printFirstOutputJob (errorCount, warningCount) ;
+    }
+  }
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_bool GALGAS_application::constructor_startOutputJob (const GALGAS_uint & inMaxJobCount
+                                                            COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_bool result ;
+  if (inMaxJobCount.isValid ()) {
+    bool runHere = true ;
+    #if COMPILE_FOR_WINDOWS == 0
+    //--- The issues of the jobs are not in the issue file, it is written by the parent
+      if (! gIsOutputJob
+       && (inMaxJobCount.uintValue () > 1)
+       && (gOption_generic_5F_cli_5F_options_emit_5F_issue_5F_json_5F_file.mValue.length () == 0)) {
+        while (gOutputJobs.count () >= (int32_t) inMaxJobCount.uintValue ()) {
+          waitFirstOutputJob () ;
+        }
+        cOutputJob job ;
+        job.mOutputFile = tmpfile () ;
+        job.mErrorFile = tmpfile () ;
+        job.mCountFile = tmpfile () ;
+        job.mNextOutputFile = tmpfile () ;
+        job.mNextErrorFile = tmpfile () ;
+        flushConsole () ;
+        if ((job.mOutputFile != NULL) && (job.mErrorFile != NULL) && (job.mCountFile != NULL)
+         && (job.mNextOutputFile != NULL) && (job.mNextErrorFile != NULL)) {
+          job.mProcessID = fork () ;
+        }
+        if (job.mProcessID == 0) { // Job
+          gIsOutputJob = true ;
+          gOutputJobs.setCountToZero () ;
+          if (gConsoleOutput >= 0) {
+            close (gConsoleOutput) ;
+            close (gConsoleError) ;
+            gConsoleOutput = -1 ;
+            gConsoleError = -1 ;
+          }
+          dup2 (fileno (job.mOutputFile), STDOUT_FILENO) ;
+          dup2 (fileno (job.mErrorFile), STDERR_FILENO) ;
+        //--- The maximum counts are checked by the parent
+          gOption_galgas_5F_builtin_5F_options_max_5F_errors.mValue = 0 ;
+          gOption_galgas_5F_builtin_5F_options_max_5F_warnings.mValue = 0 ;
+          gOutputJobCountFile = job.mCountFile ;
+          gOutputJobStartErrorCount = totalErrorCount () ;
+          gOutputJobStartWarningCount = totalWarningCount () ;
+          atexit (writeOutputJobCounts) ;
+        }else if (job.mProcessID > 0) { // Parent
+          if (gConsoleOutput < 0) {
+            static bool atExitRegistered = false ;
+            if (! atExitRegistered) {
+              atExitRegistered = true ;
+              atexit (printOutputJobsAtExit) ;
+            }
+            gConsoleOutput = dup (STDOUT_FILENO) ;
+            gConsoleError = dup (STDERR_FILENO) ;
+          }
+          dup2 (fileno (job.mNextOutputFile), STDOUT_FILENO) ;
+          dup2 (fileno (job.mNextErrorFile), STDERR_FILENO) ;
+          gOutputJobs.appendObject (job) ;
+          runHere = false ;
+        }else{ // No job, run here
+          closeOutputJobFiles (job) ;
+        }
+      }
+    #endif
+    result = GALGAS_bool (runHere) ;
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_application::class_method_endOutputJob (UNUSED_LOCATION_ARGS) {
+  #if COMPILE_FOR_WINDOWS == 0
+    if (gIsOutputJob) {
+      writeOutputJobCounts () ;
+      _exit (0) ;
+    }
+  #endif
+}
+
+//----------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_application::class_method_waitOutputJobs (UNUSED_LOCATION_ARGS) {
+  #if COMPILE_FOR_WINDOWS == 0
+    restoreConsole () ;
+    while (gOutputJobs.count () > 0) {
+      waitFirstOutputJob () ;
+    }
+  #endif
+}
+
+//----------------------------------------------------------------------------------------------------------------------*
+//  Dependencies of the outputs, used by goil --watch. Between beginOutputDependencies and endOutputDependencies,
+//  the variables and the files read while an output is computed are recorded. The frames are nested: the
+//  dependencies of a nested output are also dependencies of the enclosing one. A volatile dependency, the date
+//  for instance, is never up to date.
+//----------------------------------------------------------------------------------------------------------------------*
+
+//--- The dependencies of a frame are sorted, from the index of the frame to the end of the array
+static TC_UniqueArray <C_String> gOutputDependencies ;
+static TC_UniqueArray <int32_t> gOutputDependencyFrames ;
+
+//--- The records of the outputs, kept between the generations. They are sorted by file path
+static TC_UniqueArray <C_String> gOutputRecordFilePaths ;
+static TC_UniqueArray <C_String> gOutputRecords ;
+
+//----------------------------------------------------------------------------------------------------------------------*
+//  Index of inString in the sorted part of inArray from inStartIndex, or the index where it should be inserted
+
+static int32_t sortedIndex (const TC_UniqueArray <C_String> & inArray,
+                            const int32_t inStartIndex,
+                            const C_String & inString,
+                            bool & outFound) {
+  int32_t low = inStartIndex ;
+  int32_t high = inArray.count () ;
+  outFound = false ;
+  while ((low < high) && ! outFound) {
+    const int32_t middle = (low + high) / 2 ;
+    const int32_t comparison = inArray (middle COMMA_HERE).compare (inString) ;
+    outFound = comparison == 0 ;
+    if (outFound) {
+      low = middle ;
+    }else if (comparison < 0) {
+      low = middle + 1 ;
+    }else{
+      high = middle ;
+    }
+  }
+  return low ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------*
+
+static void addOutputDependency (const C_String & inDependency) {
+  bool found = false ;
+  const int32_t index = sortedIndex (gOutputDependencies, gOutputDependencyFrames.lastObject (HERE), inDependency, found) ;
+  if (! found) {
+    gOutputDependencies.insertObjectAtIndex (inDependency, index COMMA_HERE) ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_application::class_method_beginOutputDependencies (UNUSED_LOCATION_ARGS) {
+  gOutputDependencyFrames.appendObject (gOutputDependencies.count ()) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_application::class_method_addOutputVariableDependency (GALGAS_string inVariableName
+                                                                   COMMA_UNUSED_LOCATION_ARGS) {
+  if ((gOutputDependencyFrames.count () > 0) && inVariableName.isValid ()) {
+    addOutputDependency (C_String ("var\t") + inVariableName.stringValue ()) ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_application::class_method_addOutputFileDependency (GALGAS_string inFilePath
+                                                               COMMA_UNUSED_LOCATION_ARGS) {
+  if ((gOutputDependencyFrames.count () > 0) && inFilePath.isValid ()) {
+    addOutputDependency (C_String ("file\t") + inFilePath.stringValue ()) ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_application::class_method_addOutputVolatileDependency (UNUSED_LOCATION_ARGS) {
+  if (gOutputDependencyFrames.count () > 0) {
+    addOutputDependency ("volatile") ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------*
+
+GALGAS_stringlist GALGAS_application::constructor_endOutputDependencies (LOCATION_ARGS) {
+  GALGAS_stringlist result = GALGAS_stringlist::constructor_emptyList (THERE) ;
+  if (gOutputDependencyFrames.count () > 0) {
+    const int32_t frame = gOutputDependencyFrames.lastObject (HERE) ;
+    TC_UniqueArray <C_String> dependencies ;
+    for (int32_t i=frame ; i < gOutputDependencies.count () ; i++) {
+      dependencies.appendObject (gOutputDependencies (i COMMA_HERE)) ;
+      result.addAssign_operation (GALGAS_string (gOutputDependencies (i COMMA_HERE)) COMMA_THERE) ;
+    }
+    gOutputDependencies.removeLastObjects (gOutputDependencies.count () - frame COMMA_HERE) ;
+    gOutputDependencyFrames.removeLastObject (HERE) ;
+    if (gOutputDependencyFrames.count () > 0) {
+      for (int32_t i=0 ; i < dependencies.count () ; i++) {
+        addOutputDependency (dependencies (i COMMA_HERE)) ;
+      }
+    }
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------*
+//  The record of an unknown output is empty
+
+GALGAS_string GALGAS_application::constructor_outputRecord (const GALGAS_string & inFilePath
+                                                            COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_string result ;
+  if (inFilePath.isValid ()) {
+    bool found = false ;
+    const int32_t index = sortedIndex (gOutputRecordFilePaths, 0, inFilePath.stringValue (), found) ;
+    result = GALGAS_string (found ? gOutputRecords (index COMMA_HERE) : C_String ()) ;
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_application::class_method_setOutputRecord (GALGAS_string inFilePath,
+                                                       GALGAS_string inRecord
+                                                       COMMA_UNUSED_LOCATION_ARGS) {
+  if (inFilePath.isValid () && inRecord.isValid ()) {
+    bool found = false ;
+    const int32_t index = sortedIndex (gOutputRecordFilePaths, 0, inFilePath.stringValue (), found) ;
+    if (found) {
+      gOutputRecords (index COMMA_HERE) = inRecord.stringValue () ;
+    }else{
+      gOutputRecordFilePaths.insertObjectAtIndex (inFilePath.stringValue (), index COMMA_HERE) ;
+      gOutputRecords.insertObjectAtIndex (inRecord.stringValue (), index COMMA_HERE) ;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------*
+
+void GALGAS_application::class_method_forgetOutputRecords (UNUSED_LOCATION_ARGS) {
+  gOutputRecordFilePaths.setCountToZero () ;
+  gOutputRecords.setCountToZero () ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------*
+//  File change notification, used by goil --watch. watchFiles sets the files to watch and the directories to watch
+//  with their subdirectories. changedFiles waits for a change of them since they are watched, then until no change
+//  comes for 100 ms, as editors write a file in several steps. It returns the changed files: the path given to
+//  watchFiles for a file, the path of the directory followed by the relative path for a file in a directory. Hidden
+//  files and backup files ending with ~ are ignored. On Linux the changes come from inotify. Otherwise, or when
+//  inotify has no more watch, the modification times and the sizes of the files are polled every second.
+//----------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 0
+  static TC_UniqueArray <C_String> gChangedFiles ;
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 0
+  static void addChangedFile (const C_String & inFilePath) {
+    if (! gChangedFiles.containsObjectEqualTo (inFilePath)) {
+      gChangedFiles.appendObject (inFilePath) ;
+    }
+  }
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 0
+  static bool isIgnoredFileName (const char * inName) {
+    const size_t length = strlen (inName) ;
+    return (length == 0) || (inName [0] == '.') || (inName [length - 1] == '~') ;
+  }
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------*
+//  The subdirectories of a directory and their files, recursively
+
+#if COMPILE_FOR_WINDOWS == 0
+  static void findWatchedFiles (const C_String & inDirectory,
+                                TC_UniqueArray <C_String> & ioDirectories,
+                                TC_UniqueArray <C_String> & ioFiles) {
+    DIR * dir = ::opendir (inDirectory.cString (HERE)) ;
+    if (dir != NULL) {
+      struct dirent * current = readdir (dir) ;
+      while (current != NULL) {
+        if (! isIgnoredFileName (current->d_name)) {
+          const C_String path = inDirectory + "/" + current->d_name ;
+          if (C_FileManager::directoryExists (path)) {
+            ioDirectories.appendObject (path) ;
+            findWatchedFiles (path, ioDirectories, ioFiles) ;
+          }else{
+            ioFiles.appendObject (path) ;
+          }
+        }
+        current = readdir (dir) ;
+      }
+      closedir (dir) ;
+    }
+  }
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 0
+  class cPolledFile {
+    public : C_String mPath ;
+    public : time_t mModificationTime ;
+    public : off_t mSize ; // Negative for a missing file
+
+    public : cPolledFile (void) :
+    mPath (),
+    mModificationTime (0),
+    mSize (0) {
+    }
+  } ;
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 0
+  static TC_UniqueArray <C_String> gWatchedPaths ;
+  static TC_UniqueArray <cPolledFile> gPolledFiles ;
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 0
+  static void pollWatchedFiles (TC_UniqueArray <cPolledFile> & outFiles) {
+    TC_UniqueArray <C_String> paths ;
+    for (int32_t i=0 ; i < gWatchedPaths.count () ; i++) {
+      const C_String path = gWatchedPaths (i COMMA_HERE) ;
+      if (C_FileManager::directoryExists (path)) {
+        TC_UniqueArray <C_String> directories ;
+        findWatchedFiles (path, directories, paths) ;
+      }else{
+        paths.appendObject (path) ;
+      }
+    }
+    outFiles.setCountToZero () ;
+    for (int32_t i=0 ; i < paths.count () ; i++) {
+      cPolledFile file ;
+      file.mPath = paths (i COMMA_HERE) ;
+      struct stat fileProperties ;
+      if (::stat (file.mPath.cString (HERE), & fileProperties) == 0) {
+        file.mModificationTime = fileProperties.st_mtime ;
+        file.mSize = fileProperties.st_size ;
+      }else{
+        file.mSize = -1 ;
+      }
+      outFiles.appendObject (file) ;
+    }
+  }
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------*
+//  The files that changed since the previous poll. A file missing in the previous poll is new, unless
+//  inNewFilesChanged is false: it is then watched from now on
+
+#if COMPILE_FOR_WINDOWS == 0
+  static void findPolledFileChanges (const bool inNewFilesChanged) {
+    TC_UniqueArray <cPolledFile> files ;
+    pollWatchedFiles (files) ;
+    for (int32_t i=0 ; i < files.count () ; i++) {
+      const cPolledFile file = files (i COMMA_HERE) ;
+      bool found = false ;
+      for (int32_t j=0 ; (j < gPolledFiles.count ()) && ! found ; j++) {
+        const cPolledFile previous = gPolledFiles (j COMMA_HERE) ;
+        found = previous.mPath == file.mPath ;
+        if (found && ((previous.mModificationTime != file.mModificationTime) || (previous.mSize != file.mSize))) {
+          addChangedFile (file.mPath) ;
+        }
+      }
+      if (! found && inNewFilesChanged) {
+        addChangedFile (file.mPath) ;
+      }
+    }
+    for (int32_t j=0 ; (j < gPolledFiles.count ()) && inNewFilesChanged ; j++) {
+      const C_String path = gPolledFiles (j COMMA_HERE).mPath ;
+      bool found = false ;
+      for (int32_t i=0 ; (i < files.count ()) && ! found ; i++) {
+        found = files (i COMMA_HERE).mPath == path ;
+      }
+      if (! found) {
+        addChangedFile (path) ;
+      }
+    }
+    gPolledFiles.setCountToZero () ;
+    gPolledFiles.appendObjectsFromArray (files) ;
+  }
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------*
+
+#ifdef __linux__
+  class cWatchedFile {
+    public : C_String mPath ; // Path of the file, or of the directory
+    public : C_String mName ; // Name of the file in its directory, empty for a directory
+    public : int mWatch ; // inotify watch of the directory
+
+    public : cWatchedFile (void) :
+    mPath (),
+    mName (),
+    mWatch (-1) {
+    }
+  } ;
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------*
+
+#ifdef __linux__
+  static int gNotificationDescriptor = -1 ;
+  static bool gNotificationFailed = false ;
+  static TC_UniqueArray <cWatchedFile> gWatchedFiles ;
+
+  static const uint32_t kWatchedEvents = IN_CLOSE_WRITE | IN_ATTRIB | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO ;
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------*
+//  Without more watch, the notification stops and the files are polled
+
+#ifdef __linux__
+  static int addWatch (const C_String & inDirectory) {
+    const int watch = inotify_add_watch (gNotificationDescriptor, inDirectory.cString (HERE), kWatchedEvents) ;
+    if ((watch < 0) && ((errno == ENOSPC) || (errno == ENOMEM))) {
+      gNotificationFailed = true ;
+    }
+    return watch ;
+  }
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------*
+
+#ifdef __linux__
+  static void watchDirectory (const C_String & inDirectory,
+                              TC_UniqueArray <cWatchedFile> & ioWatchedFiles) {
+    TC_UniqueArray <C_String> directories ;
+    TC_UniqueArray <C_String> files ;
+    directories.appendObject (inDirectory) ;
+    findWatchedFiles (inDirectory, directories, files) ;
+    for (int32_t i=0 ; i < directories.count () ; i++) {
+      cWatchedFile directory ;
+      directory.mPath = directories (i COMMA_HERE) ;
+      directory.mWatch = addWatch (directory.mPath) ;
+      if (directory.mWatch >= 0) {
+        ioWatchedFiles.appendObject (directory) ;
+      }
+    }
+  }
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------*
+
+#ifdef __linux__
+  static void readFileChangeNotifications (void) {
+    char buffer [4096] __attribute__ ((aligned (__alignof__ (struct inotify_event)))) ;
+    ssize_t length = read (gNotificationDescriptor, buffer, sizeof (buffer)) ;
+    while (length > 0) {
+      ssize_t index = 0 ;
+      while (index < length) {
+        const struct inotify_event * event = (const struct inotify_event *) (buffer + index) ;
+        index += (ssize_t) (sizeof (struct inotify_event) + event->len) ;
+        if ((event->mask & IN_Q_OVERFLOW) != 0) { // Events are lost, all the files may have changed
+          for (int32_t i=0 ; i < gWatchedFiles.count () ; i++) {
+            addChangedFile (gWatchedFiles (i COMMA_HERE).mPath) ;
+          }
+        }else if ((event->len > 0) && ! isIgnoredFileName (event->name)) {
+          const int32_t watchedFileCount = gWatchedFiles.count () ;
+          for (int32_t i=0 ; i < watchedFileCount ; i++) {
+            const cWatchedFile watched = gWatchedFiles (i COMMA_HERE) ;
+            if (watched.mWatch != event->wd) {
+            }else if (watched.mName.length () > 0) { // A file
+              if (watched.mName == event->name) {
+                addChangedFile (watched.mPath) ;
+              }
+            }else{ // A directory
+              const C_String path = watched.mPath + "/" + event->name ;
+              if ((event->mask & IN_ISDIR) == 0) {
+                addChangedFile (path) ;
+              }else if ((event->mask & (IN_CREATE | IN_MOVED_TO | IN_DELETE | IN_MOVED_FROM)) != 0) {
+                addChangedFile (path) ;
+                if ((event->mask & (IN_CREATE | IN_MOVED_TO)) != 0) {
+                  watchDirectory (path, gWatchedFiles) ;
+                }
+              }
+            }
+          }
+        }
+      }
+      length = read (gNotificationDescriptor, buffer, sizeof (buffer)) ;
+    }
+  }
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------*
+
+#ifdef __linux__
+  static void watchNotifiedFiles (const GALGAS_stringlist & inPaths) {
+    readFileChangeNotifications () ;
+    TC_UniqueArray <cWatchedFile> watchedFiles ;
+    cEnumerator_stringlist enumerator (inPaths, kENUMERATION_UP) ;
+    while (enumerator.hasCurrentObject ()) {
+      const C_String path = enumerator.current_mValue (HERE).stringValue () ;
+      if (C_FileManager::directoryExists (path)) {
+        watchDirectory (path, watchedFiles) ;
+      }else{
+        cWatchedFile file ;
+        file.mPath = path ;
+        file.mName = path.lastPathComponent () ;
+        C_String directory = path.stringByDeletingLastPathComponent () ;
+        if (directory.length () == 0) {
+          directory = "." ;
+        }
+        file.mWatch = addWatch (directory) ;
+        if (file.mWatch >= 0) {
+          watchedFiles.appendObject (file) ;
+        }
+      }
+      enumerator.gotoNextObject () ;
+    }
+  //--- Remove the watches that are no longer used
+    for (int32_t i=0 ; i < gWatchedFiles.count () ; i++) {
+      const int watch = gWatchedFiles (i COMMA_HERE).mWatch ;
+      bool used = watch < 0 ;
+      for (int32_t j=0 ; (j < watchedFiles.count ()) && ! used ; j++) {
+        used = watchedFiles (j COMMA_HERE).mWatch == watch ;
+      }
+      if (! used) {
+        inotify_rm_watch (gNotificationDescriptor, watch) ;
+        for (int32_t j=i+1 ; j < gWatchedFiles.count () ; j++) {
+          if (gWatchedFiles (j COMMA_HERE).mWatch == watch) {
+            gWatchedFiles (j COMMA_HERE).mWatch = -1 ;
+          }
+        }
+      }
+    }
+    gWatchedFiles.setCountToZero () ;
+    gWatchedFiles.appendObjectsFromArray (watchedFiles) ;
+  }
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------*
+//  The changes of the files already watched are kept
+
+void GALGAS_application::class_method_watchFiles (GALGAS_stringlist inPaths
+                                                  COMMA_UNUSED_LOCATION_ARGS) {
+  #if COMPILE_FOR_WINDOWS == 0
+    if (inPaths.isValid ()) {
+      bool notified = false ;
+      #ifdef __linux__
+        if ((gNotificationDescriptor < 0) && ! gNotificationFailed) {
+          gNotificationDescriptor = inotify_init1 (IN_NONBLOCK | IN_CLOEXEC) ;
+          gNotificationFailed = gNotificationDescriptor < 0 ;
+        }
+        if (gNotificationDescriptor >= 0) {
+          watchNotifiedFiles (inPaths) ;
+          if (gNotificationFailed) {
+            close (gNotificationDescriptor) ;
+            gNotificationDescriptor = -1 ;
+            gWatchedFiles.setCountToZero () ;
+          }
+        }
+        notified = gNotificationDescriptor >= 0 ;
+      #endif
+      if (! notified) {
+        if (gWatchedPaths.count () > 0) {
+          findPolledFileChanges (true) ;
+        }
+        gWatchedPaths.setCountToZero () ;
+        cEnumerator_stringlist enumerator (inPaths, kENUMERATION_UP) ;
+        while (enumerator.hasCurrentObject ()) {
+          gWatchedPaths.appendObject (enumerator.current_mValue (HERE).stringValue ()) ;
+          enumerator.gotoNextObject () ;
+        }
+        findPolledFileChanges (false) ;
+      }
+    }
+  #endif
+}
+
+//----------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 1
+  GALGAS_stringlist GALGAS_application::constructor_changedFiles (C_Compiler * inCompiler
+                                                                  COMMA_LOCATION_ARGS) {
+    inCompiler->onTheFlyRunTimeError (
+      "@application changedFiles constructor is not implemented for Windows"
+      COMMA_THERE
+    ) ;
+    return GALGAS_stringlist () ; // Poison value
+  }
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------*
+
+#if COMPILE_FOR_WINDOWS == 0
+  GALGAS_stringlist GALGAS_application::constructor_changedFiles (C_Compiler * /* inCompiler */
+                                                                  COMMA_LOCATION_ARGS) {
+    bool notified = false ;
+    #ifdef __linux__
+      notified = gNotificationDescriptor >= 0 ;
+      if (notified) {
+        struct pollfd notification ;
+        notification.fd = gNotificationDescriptor ;
+        notification.events = POLLIN ;
+        readFileChangeNotifications () ;
+        while (gChangedFiles.count () == 0) {
+          poll (& notification, 1, -1) ;
+          readFileChangeNotifications () ;
+        }
+        while (poll (& notification, 1, 100) > 0) {
+          readFileChangeNotifications () ;
+        }
+      }
+    #endif
+    if (! notified) {
+      findPolledFileChanges (true) ;
+      while (gChangedFiles.count () == 0) {
+        sleep (1) ;
+        findPolledFileChanges (true) ;
+      }
+    }
+    GALGAS_stringlist result = GALGAS_stringlist::constructor_emptyList (THERE) ;
+    for (int32_t i=0 ; i < gChangedFiles.count () ; i++) {
+      result.addAssign_operation (GALGAS_string (gChangedFiles (i COMMA_HERE)) COMMA_THERE) ;
+    }
+    gChangedFiles.setCountToZero () ;
+    return result ;
+  }
+#endif
+
 //----------------------------------------------------------------------------------------------------------------------
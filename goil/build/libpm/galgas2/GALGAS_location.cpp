@@ -240,3 +240,84 @@ GALGAS_uint GALGAS_location::getter_line (C_Compiler * inCompiler
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+
+GALGAS_uint GALGAS_location::getter_startLocationIndex (C_Compiler * inCompiler
+                                                        COMMA_LOCATION_ARGS) const {
+  GALGAS_uint result ;
+  if (isValid ()) {
+    if (!mSourceText.isValid ()) {
+      inCompiler->onTheFlyRunTimeError ("'startLocationIndex' reader cannot be called on a nowhere @location object" COMMA_THERE) ;
+    }else{
+      result = GALGAS_uint ((uint32_t) mStartLocationInSource.index ()) ;
+    }
+  }
+  return result ;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+GALGAS_uint GALGAS_location::getter_startColumn (C_Compiler * inCompiler
+                                                 COMMA_LOCATION_ARGS) const {
+  GALGAS_uint result ;
+  if (isValid ()) {
+    if (!mSourceText.isValid ()) {
+      inCompiler->onTheFlyRunTimeError ("'startColumn' reader cannot be called on a nowhere @location object" COMMA_THERE) ;
+    }else{
+      result = GALGAS_uint ((uint32_t) mStartLocationInSource.columnNumber ()) ;
+    }
+  }
+  return result ;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+GALGAS_uint GALGAS_location::getter_startLine (C_Compiler * inCompiler
+                                               COMMA_LOCATION_ARGS) const {
+  GALGAS_uint result ;
+  if (isValid ()) {
+    if (!mSourceText.isValid ()) {
+      inCompiler->onTheFlyRunTimeError ("'startLine' reader cannot be called on a nowhere @location object" COMMA_THERE) ;
+    }else{
+      result = GALGAS_uint ((uint32_t) mStartLocationInSource.lineNumber ()) ;
+    }
+  }
+  return result ;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//  Location in the source text of the receiver, from the index, line and column of its start and of its end, as returned
+//  by the start and end getters. The source text is not read again.
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+GALGAS_location GALGAS_location::getter_locationInSameSource (const GALGAS_uint & inStartIndex,
+                                                              const GALGAS_uint & inStartLine,
+                                                              const GALGAS_uint & inStartColumn,
+                                                              const GALGAS_uint & inEndIndex,
+                                                              const GALGAS_uint & inEndLine,
+                                                              const GALGAS_uint & inEndColumn,
+                                                              C_Compiler * inCompiler
+                                                              COMMA_LOCATION_ARGS) const {
+  GALGAS_location result ;
+  if (isValid () && inStartIndex.isValid () && inStartLine.isValid () && inStartColumn.isValid ()
+   && inEndIndex.isValid () && inEndLine.isValid () && inEndColumn.isValid ()) {
+    if (!mSourceText.isValid ()) {
+      inCompiler->onTheFlyRunTimeError ("'locationInSameSource' reader cannot be called on a nowhere @location object" COMMA_THERE) ;
+    }else if ((inStartIndex.uintValue () > (uint32_t) mSourceText.sourceLength ())
+           || (inEndIndex.uintValue () > (uint32_t) mSourceText.sourceLength ())) {
+      inCompiler->onTheFlyRunTimeError ("'locationInSameSource' reader: index out of the source text" COMMA_THERE) ;
+    }else{
+      const C_LocationInSource startLocationInSource (mSourceText,
+                                                      (int32_t) inStartIndex.uintValue (),
+                                                      (int32_t) inStartLine.uintValue (),
+                                                      (int32_t) inStartColumn.uintValue ()) ;
+      const C_LocationInSource endLocationInSource (mSourceText,
+                                                    (int32_t) inEndIndex.uintValue (),
+                                                    (int32_t) inEndLine.uintValue (),
+                                                    (int32_t) inEndColumn.uintValue ()) ;
+      result = GALGAS_location (startLocationInSource, endLocationInSource, mSourceText) ;
+    }
+  }
+  return result ;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
@@ -1811,6 +1811,62 @@ void GALGAS_string::method_writeToFileWhenDifferentContents (GALGAS_string inFil
   }
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+//  The receiver is the end of the file contents, its beginning has been appended to inPartFilePath by
+//  setter_appendLinesToFile. When nothing has been appended, the receiver is written as by the other write methods.
+//  Otherwise, the receiver is appended to the part file, which then replaces inFilePath.
+//----------------------------------------------------------------------------------------------------------------------
+
+void GALGAS_string::method_writeToFileWithPart (GALGAS_string inFilePath,
+                                                GALGAS_string inPartFilePath,
+                                                GALGAS_bool inExecutable,
+                                                GALGAS_bool inOnlyWhenDifferentContents,
+                                                C_Compiler * inCompiler
+                                                COMMA_LOCATION_ARGS) const {
+  if (isValid () && inFilePath.isValid () && inPartFilePath.isValid () && inExecutable.isValid () && inOnlyWhenDifferentContents.isValid ()) {
+    const bool executable = inExecutable.boolValue () ;
+    const bool onlyWhenDifferentContents = inOnlyWhenDifferentContents.boolValue () ;
+    if (! C_FileManager::fileExistsAtPath (inPartFilePath.mString)) {
+      GALGAS_bool fileWritten ;
+      if (executable && onlyWhenDifferentContents) {
+        method_writeToExecutableFileWhenDifferentContents (inFilePath, fileWritten, inCompiler COMMA_THERE) ;
+      }else if (executable) {
+        method_makeDirectoryAndWriteToExecutableFile (inFilePath, inCompiler COMMA_THERE) ;
+      }else if (onlyWhenDifferentContents) {
+        method_writeToFileWhenDifferentContents (inFilePath, fileWritten, inCompiler COMMA_THERE) ;
+      }else{
+        method_makeDirectoryAndWriteToFile (inFilePath, inCompiler COMMA_THERE) ;
+      }
+    }else{
+      const bool verboseOptionOn = verboseOutput () ;
+      const bool fileAlreadyExists = C_FileManager::fileExistsAtPath (inFilePath.mString) ;
+      bool ok = C_FileManager::appendStringToFile (mString, inPartFilePath.mString) ;
+      if (ok && onlyWhenDifferentContents && fileAlreadyExists) {
+        inCompiler->logFileRead (inFilePath.mString) ;
+        if (C_FileManager::filesHaveSameContents (inPartFilePath.mString, inFilePath.mString)) {
+          C_FileManager::deleteFile (inPartFilePath.mString) ;
+          return ;
+        }
+      }
+      if (ok) {
+        ok = C_FileManager::renameFile (inPartFilePath.mString, inFilePath.mString).length () == 0 ;
+      }
+      if (ok && executable) {
+        C_FileManager::makeFileExecutable (inFilePath.mString) ;
+      }
+      if (ok && verboseOptionOn && fileAlreadyExists) {
+        ggs_printFileOperationSuccess (C_String ("Replaced '") + inFilePath.mString + "'.\n") ;
+      }else if (ok && verboseOptionOn && ! fileAlreadyExists) {
+        ggs_printFileCreationSuccess (C_String ("Created '") + inFilePath.mString + "'.\n") ;
+      }else if (! ok) {
+        C_String message ;
+        message << "cannot write '" << inFilePath.mString << "' file" ;
+        inCompiler->onTheFlyRunTimeError (message COMMA_THERE) ;
+      }
+    }
+  }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 
 void GALGAS_string::method_writeToExecutableFile (GALGAS_string inFilePath,
@@ -2015,6 +2071,33 @@ void GALGAS_string::setter_removeCharacterAtIndex (GALGAS_char & outChar,
   }
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+//  Appends the complete lines of the receiver to the file and removes them from the receiver. The last line is
+//  kept, so the current column is still known.
+//----------------------------------------------------------------------------------------------------------------------
+
+void GALGAS_string::setter_appendLinesToFile (GALGAS_string inFilePath,
+                                              C_Compiler * inCompiler
+                                              COMMA_LOCATION_ARGS) {
+  if (isValid () && inFilePath.isValid () && C_Compiler::performGeneration ()) {
+    const utf32 * ptr = mString.utf32String (HERE) ;
+    int32_t linesLength = mString.length () ;
+    while ((linesLength > 0) && (UNICODE_VALUE (ptr [linesLength - 1]) != '\n')) {
+      linesLength -- ;
+    }
+    if (linesLength > 0) {
+      const bool ok = C_FileManager::appendStringToFile (mString.subString (0, linesLength), inFilePath.mString) ;
+      if (ok) {
+        mString.suppress (0, linesLength COMMA_THERE) ;
+      }else{
+        C_String message ;
+        message << "cannot write '" << inFilePath.mString << "' file" ;
+        inCompiler->onTheFlyRunTimeError (message COMMA_THERE) ;
+      }
+    }
+  }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 //
 //     Type methods                                                                              
@@ -38,12 +38,14 @@ see https://www.gnu.org/licenses/.  */
 #define FUNCTION               mpz_mul_si
 #define MULTIPLICAND_UNSIGNED
 #define MULTIPLICAND_ABS(x)    ABS_CAST(unsigned long, (x))
+#define MULTIPLICAND_NEG(x)    ((x) < 0)
 #endif
 
 #ifdef OPERATION_mul_ui
 #define FUNCTION               mpz_mul_ui
 #define MULTIPLICAND_UNSIGNED  unsigned
 #define MULTIPLICAND_ABS(x)    x
+#define MULTIPLICAND_NEG(x)    0
 #endif
 
 #ifndef FUNCTION
@@ -103,5 +105,5 @@ FUNCTION (mpz_ptr prod, mpz_srcptr mult,
     }
 #endif
 
-  SIZ(prod) = ((sign_product < 0) ^ (((int) small_mult) < 0)) ? -size : size;
+  SIZ(prod) = ((sign_product < 0) ^ MULTIPLICAND_NEG (small_mult)) ? -size : size;
 }
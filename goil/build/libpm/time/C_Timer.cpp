@@ -20,10 +20,17 @@
 
 #include "time/C_Timer.h"
 #include "utilities/M_machine.h"
+#include "utilities/cpp-allocation.h"
 #include "strings/C_String.h"
 
 //----------------------------------------------------------------------------------------------------------------------
 
+#if COMPILE_FOR_WINDOWS == 0
+  #include <sys/resource.h>
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------
+
 #if COMPILE_FOR_WINDOWS == 0
   static timeval gTime ;
   static timeval now (void) {
@@ -36,13 +43,36 @@
   }
 #endif
 
+//----------------------------------------------------------------------------------------------------------------------
+// CPU time used by the process (user and system), in us
+
+static uint64_t cpuNow (void) {
+  #if COMPILE_FOR_WINDOWS == 0
+    struct rusage usage ;
+    getrusage (RUSAGE_SELF, & usage) ;
+    return ((uint64_t) usage.ru_utime.tv_sec + (uint64_t) usage.ru_stime.tv_sec) * 1000000
+         + (uint64_t) usage.ru_utime.tv_usec + (uint64_t) usage.ru_stime.tv_usec ;
+  #else
+    return (((uint64_t) ::clock ()) * 1000000) / CLOCKS_PER_SEC ;
+  #endif
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 
 C_Timer::C_Timer (void) :
 mStart (now ()),
 mEnd (now ()),
-mRunning (true) {
+mRunning (true),
+mCPUStart (cpuNow ()),
+mCPUEnd (0),
+mAllocatedBlockStart (allocatedBlockCount ()),
+mAllocatedBlockEnd (0),
+mAllocatedByteStart (allocatedByteCount ()),
+mAllocatedByteEnd (0) {
   mEnd = mStart ;
+  mCPUEnd = mCPUStart ;
+  mAllocatedBlockEnd = mAllocatedBlockStart ;
+  mAllocatedByteEnd = mAllocatedByteStart ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -54,6 +84,9 @@ void C_Timer::stopTimer (void) {
     #else
       mEnd = ::clock () ;
     #endif
+    mCPUEnd = cpuNow () ;
+    mAllocatedBlockEnd = allocatedBlockCount () ;
+    mAllocatedByteEnd = allocatedByteCount () ;
     mRunning = false ;
   }
 }
@@ -67,6 +100,12 @@ void C_Timer::startTimer (void) {
     mStart = ::clock () ;
   #endif
   mEnd = mStart ;
+  mCPUStart = cpuNow () ;
+  mCPUEnd = mCPUStart ;
+  mAllocatedBlockStart = allocatedBlockCount () ;
+  mAllocatedBlockEnd = mAllocatedBlockStart ;
+  mAllocatedByteStart = allocatedByteCount () ;
+  mAllocatedByteEnd = mAllocatedByteStart ;
   mRunning = true ;
 }
 
@@ -97,6 +136,24 @@ uint32_t C_Timer::msFromStart (void) const {
 
 //----------------------------------------------------------------------------------------------------------------------
 
+uint64_t C_Timer::cpuMicrosecondsFromStart (void) const {
+  return (mRunning ? cpuNow () : mCPUEnd) - mCPUStart ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+uint64_t C_Timer::allocatedBlocksFromStart (void) const {
+  return (mRunning ? allocatedBlockCount () : mAllocatedBlockEnd) - mAllocatedBlockStart ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+uint64_t C_Timer::allocatedBytesFromStart (void) const {
+  return (mRunning ? allocatedByteCount () : mAllocatedByteEnd) - mAllocatedByteStart ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
 C_String C_Timer::timeString (void) const {
   const uint32_t d = msFromStart () ;
   const uint32_t ms = d % 1000 ;
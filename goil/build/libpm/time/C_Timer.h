@@ -59,6 +59,14 @@ class C_Timer {
   #endif
   
   private : bool mRunning ;
+
+//--- CPU time of the process in us and allocations, read at start and at stop
+  private : uint64_t mCPUStart ;
+  private : uint64_t mCPUEnd ;
+  private : uint64_t mAllocatedBlockStart ;
+  private : uint64_t mAllocatedBlockEnd ;
+  private : uint64_t mAllocatedByteStart ;
+  private : uint64_t mAllocatedByteEnd ;
   
   public : C_Timer (void) ;
 
@@ -68,6 +76,12 @@ class C_Timer {
 
   public : uint32_t msFromStart (void) const ;
 
+  public : uint64_t cpuMicrosecondsFromStart (void) const ;
+
+  public : uint64_t allocatedBlocksFromStart (void) const ;
+
+  public : uint64_t allocatedBytesFromStart (void) const ;
+
   public : C_String timeString (void) const ;
   
   public : inline bool isRunning (void) const { return mRunning ; }
@@ -20,6 +20,153 @@
 
 #include "utilities/C_BigInt.h"
 #include "strings/C_String.h"
+#include "utilities/C_PrologueEpilogue.h"
+
+//----------------------------------------------------------------------------------------------------------------------
+//  Values that fit in int64_t are handled without GMP (mIsSmall is true). Each operation on two small values is
+//  performed on int64_t when it cannot overflow; otherwise operands are converted to GMP, the operation is performed
+//  by GMP and the result is converted back to a small value if it fits (normalize). So a value is small if and only
+//  if it fits in int64_t.
+//----------------------------------------------------------------------------------------------------------------------
+
+#ifdef PRAGMA_MARK_ALLOWED
+  #pragma mark Small values
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------
+// Overflow checked operations: return false and leave outResult unchanged if the result does not fit in int64_t.
+//----------------------------------------------------------------------------------------------------------------------
+
+static bool addInt64 (const int64_t inOperand1, const int64_t inOperand2, int64_t & outResult) {
+  #if defined (__GNUC__) || defined (__clang__)
+    int64_t result ;
+    const bool ok = ! __builtin_add_overflow (inOperand1, inOperand2, & result) ;
+    if (ok) {
+      outResult = result ;
+    }
+    return ok ;
+  #else
+    const bool ok = (inOperand2 >= 0) ? (inOperand1 <= (INT64_MAX - inOperand2)) : (inOperand1 >= (INT64_MIN - inOperand2)) ;
+    if (ok) {
+      outResult = inOperand1 + inOperand2 ;
+    }
+    return ok ;
+  #endif
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static bool subInt64 (const int64_t inOperand1, const int64_t inOperand2, int64_t & outResult) {
+  #if defined (__GNUC__) || defined (__clang__)
+    int64_t result ;
+    const bool ok = ! __builtin_sub_overflow (inOperand1, inOperand2, & result) ;
+    if (ok) {
+      outResult = result ;
+    }
+    return ok ;
+  #else
+    const bool ok = (inOperand2 >= 0) ? (inOperand1 >= (INT64_MIN + inOperand2)) : (inOperand1 <= (INT64_MAX + inOperand2)) ;
+    if (ok) {
+      outResult = inOperand1 - inOperand2 ;
+    }
+    return ok ;
+  #endif
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static bool mulInt64 (const int64_t inOperand1, const int64_t inOperand2, int64_t & outResult) {
+  #if defined (__GNUC__) || defined (__clang__)
+    int64_t result ;
+    const bool ok = ! __builtin_mul_overflow (inOperand1, inOperand2, & result) ;
+    if (ok) {
+      outResult = result ;
+    }
+    return ok ;
+  #else
+    const bool ok = (inOperand1 >= INT32_MIN) && (inOperand1 <= INT32_MAX)
+                 && (inOperand2 >= INT32_MIN) && (inOperand2 <= INT32_MAX) ;
+    if (ok) {
+      outResult = inOperand1 * inOperand2 ;
+    }
+    return ok ;
+  #endif
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static void setGMPFromInt64 (mpz_t ioGMPint, const int64_t inValue) {
+  const bool negative = inValue < 0 ;
+  const uint64_t v = negative ? (((uint64_t) 0) - (uint64_t) inValue) : (uint64_t) inValue ;
+  const uint64_t high = v >> 32 ;
+  if (high == 0) {
+    mpz_set_ui (ioGMPint, (uint32_t) v) ;
+  }else{
+    mpz_set_ui (ioGMPint, (uint32_t) high) ;
+    mpz_mul_2exp (ioGMPint, ioGMPint, 32) ;
+    mpz_add_ui (ioGMPint, ioGMPint, (uint32_t) (v & UINT32_MAX)) ;
+  }
+  if (negative) {
+    mpz_neg (ioGMPint, ioGMPint) ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static bool gmpFitsInSInt64 (const mpz_t inGMPint) {
+  const size_t requiredBitCount = mpz_sizeinbase (inGMPint, 2) ;
+  bool ok = requiredBitCount <= 63 ;
+  if ((requiredBitCount == 64) && (mpz_sgn (inGMPint) < 0)) { // INT64_MIN is a particular case
+    int64_t r ;
+    mpz_export (& r, NULL, 1, sizeof (int64_t), 0, 0, inGMPint) ;
+    ok = r == INT64_MIN ;
+  }
+  return ok ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static int64_t gmpToInt64 (const mpz_t inGMPint) {
+  uint64_t r = UINT64_MAX ;
+  if (gmpFitsInSInt64 (inGMPint)) {
+    r = 0 ;
+    mpz_export (& r, NULL, 1, sizeof (uint64_t), 0, 0, inGMPint) ;
+  }
+  if (mpz_sgn (inGMPint) < 0) {
+    r = ((uint64_t) 0) - r ;
+  }
+  return (int64_t) r ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void C_BigInt::setToSmallValue (const int64_t inValue) {
+  if (! mIsSmall) {
+    mpz_clear (mGMPint) ;
+    mIsSmall = true ;
+  }
+  mSmallValue = inValue ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void C_BigInt::convertToGMP (void) {
+  if (mIsSmall) {
+    mpz_init (mGMPint) ;
+    setGMPFromInt64 (mGMPint, mSmallValue) ;
+    mIsSmall = false ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void C_BigInt::normalize (void) {
+  if (! mIsSmall && gmpFitsInSInt64 (mGMPint)) {
+    mSmallValue = gmpToInt64 (mGMPint) ;
+    mpz_clear (mGMPint) ;
+    mIsSmall = true ;
+  }
+}
 
 //----------------------------------------------------------------------------------------------------------------------
 
@@ -32,8 +179,9 @@
 //----------------------------------------------------------------------------------------------------------------------
 
 C_BigInt::C_BigInt (void) :
-mGMPint () {
-  mpz_init (mGMPint) ;
+mSmallValue (0),
+mGMPint (),
+mIsSmall (true) {
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -41,7 +189,9 @@ mGMPint () {
 //----------------------------------------------------------------------------------------------------------------------
 
 C_BigInt::~C_BigInt (void) {
-  mpz_clear (mGMPint) ;
+  if (! mIsSmall) {
+    mpz_clear (mGMPint) ;
+  }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -49,16 +199,28 @@ C_BigInt::~C_BigInt (void) {
 //----------------------------------------------------------------------------------------------------------------------
 
 C_BigInt::C_BigInt (const C_BigInt & inOperand) :
-mGMPint () {
-  mpz_init (mGMPint) ;
-  mpz_set (mGMPint, inOperand.mGMPint) ;
+mSmallValue (inOperand.mSmallValue),
+mGMPint (),
+mIsSmall (inOperand.mIsSmall) {
+  if (! mIsSmall) {
+    mpz_init (mGMPint) ;
+    mpz_set (mGMPint, inOperand.mGMPint) ;
+  }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 C_BigInt & C_BigInt::operator = (const C_BigInt & inOperand) {
   if (this != & inOperand) {
-    mpz_set (mGMPint, inOperand.mGMPint) ;
+    if (inOperand.mIsSmall) {
+      setToSmallValue (inOperand.mSmallValue) ;
+    }else{
+      if (mIsSmall) {
+        mpz_init (mGMPint) ;
+        mIsSmall = false ;
+      }
+      mpz_set (mGMPint, inOperand.mGMPint) ;
+    }
   }
   return *this ;
 }
@@ -74,25 +236,31 @@ C_BigInt & C_BigInt::operator = (const C_BigInt & inOperand) {
 //----------------------------------------------------------------------------------------------------------------------
 
 bool C_BigInt::isZero (void) const {
-  return mpz_cmp_ui (mGMPint, 0) == 0 ;
+  return mIsSmall ? (mSmallValue == 0) : (mpz_cmp_ui (mGMPint, 0) == 0) ;
 }
-  
+
 //----------------------------------------------------------------------------------------------------------------------
 
 bool C_BigInt::isOne (void) const {
-  return mpz_cmp_ui (mGMPint, 1) == 0 ;
+  return mIsSmall ? (mSmallValue == 1) : (mpz_cmp_ui (mGMPint, 1) == 0) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 bool C_BigInt::isMinusOne (void) const {
-  return mpz_cmp_si (mGMPint, -1) == 0 ;
+  return mIsSmall ? (mSmallValue == -1) : (mpz_cmp_si (mGMPint, -1) == 0) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 int32_t C_BigInt::sign (void) const {
-  return mpz_sgn (mGMPint) ;
+  int32_t result ;
+  if (mIsSmall) {
+    result = (mSmallValue > 0) ? 1 : ((mSmallValue < 0) ? -1 : 0) ;
+  }else{
+    result = mpz_sgn (mGMPint) ;
+  }
+  return result ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -118,28 +286,37 @@ bool C_BigInt::isPositive (void) const {
 //----------------------------------------------------------------------------------------------------------------------
 
 C_BigInt::C_BigInt (const uint64_t inValue, const bool inNegate) :
-mGMPint () {
-  mpz_init (mGMPint) ;
-  const uint64_t high = inValue >> 32 ;
-  if (high == 0) {
-    mpz_set_ui (mGMPint, (uint32_t) inValue) ;
+mSmallValue (0),
+mGMPint (),
+mIsSmall (true) {
+  if (inValue <= (uint64_t) INT64_MAX) {
+    mSmallValue = inNegate ? (- (int64_t) inValue) : (int64_t) inValue ;
+  }else if (inNegate && (inValue == (((uint64_t) INT64_MAX) + 1))) {
+    mSmallValue = INT64_MIN ;
   }else{
+    mpz_init (mGMPint) ;
+    mIsSmall = false ;
+    const uint64_t high = inValue >> 32 ;
     mpz_set_ui (mGMPint, (uint32_t) high) ;
     mpz_mul_2exp (mGMPint, mGMPint, 32) ;
     mpz_add_ui (mGMPint, mGMPint, (uint32_t) (inValue & UINT32_MAX)) ;
-  }
-  if (inNegate) {
-    mpz_neg (mGMPint, mGMPint) ;
+    if (inNegate) {
+      mpz_neg (mGMPint, mGMPint) ;
+    }
   }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 C_BigInt::C_BigInt (const uint64_t inHighValue, const uint64_t inLowValue, const bool inNegate) :
-mGMPint () {
-  mpz_init (mGMPint) ;
-  mpz_set_ui (mGMPint, 0) ;
-  if (inHighValue != 0) {
+mSmallValue (0),
+mGMPint (),
+mIsSmall (true) {
+  if (inHighValue == 0) {
+    *this = C_BigInt (inLowValue, inNegate) ;
+  }else{
+    mpz_init (mGMPint) ;
+    mIsSmall = false ;
     const uint64_t high = inHighValue >> 32 ;
     if (high == 0) {
       mpz_set_ui (mGMPint, (uint32_t) inHighValue) ;
@@ -149,55 +326,46 @@ mGMPint () {
       mpz_add_ui (mGMPint, mGMPint, (uint32_t) (inHighValue & UINT32_MAX)) ;
     }
     mpz_mul_2exp (mGMPint, mGMPint, 32) ;
-  }
-  const uint64_t high = inLowValue >> 32 ;
-  mpz_add_ui (mGMPint, mGMPint, (uint32_t) high) ;
-  mpz_mul_2exp (mGMPint, mGMPint, 32) ;
-  mpz_add_ui (mGMPint, mGMPint, (uint32_t) (inLowValue & UINT32_MAX)) ;
-  if (inNegate) {
-    mpz_neg (mGMPint, mGMPint) ;
+    const uint64_t lowHigh = inLowValue >> 32 ;
+    mpz_add_ui (mGMPint, mGMPint, (uint32_t) lowHigh) ;
+    mpz_mul_2exp (mGMPint, mGMPint, 32) ;
+    mpz_add_ui (mGMPint, mGMPint, (uint32_t) (inLowValue & UINT32_MAX)) ;
+    if (inNegate) {
+      mpz_neg (mGMPint, mGMPint) ;
+    }
   }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 C_BigInt::C_BigInt (const int64_t inValue) :
-mGMPint () {
-  const bool negative = inValue < 0 ;
-  const uint64_t v = (uint64_t) (negative ? (- inValue) : inValue) ;
-  mpz_init (mGMPint) ;
-  const uint64_t high = v >> 32 ;
-  if (high == 0) {
-    mpz_set_ui (mGMPint, (uint32_t) v) ;
-  }else{
-    mpz_set_ui (mGMPint, (uint32_t) high) ;
-    mpz_mul_2exp (mGMPint, mGMPint, 32) ;
-    mpz_add_ui (mGMPint, mGMPint, (uint32_t) (v & UINT32_MAX)) ;
-  }
-  if (negative) {
-    mpz_neg (mGMPint, mGMPint) ;
-  }
+mSmallValue (inValue),
+mGMPint (),
+mIsSmall (true) {
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 void C_BigInt::setToZero (void) {
-  mpz_set_ui (mGMPint, 0) ;
+  setToSmallValue (0) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 void C_BigInt::setFromUnsigned (const uint32_t inValue) {
-  mpz_set_ui (mGMPint, inValue) ;
+  setToSmallValue (inValue) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 C_BigInt::C_BigInt (const char * inString, const int32_t inBase, bool & outOk) :
-mGMPint () {
+mSmallValue (0),
+mGMPint (),
+mIsSmall (false) {
   mpz_init (mGMPint) ;
   const int r = mpz_set_str (mGMPint, inString, inBase) ;
   outOk = r == 0 ;
+  normalize () ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -211,14 +379,26 @@ mGMPint () {
 //----------------------------------------------------------------------------------------------------------------------
 
 C_BigInt & C_BigInt::operator ++ (void) {
-  mpz_add_ui (mGMPint, mGMPint, 1) ;
+  if (mIsSmall && (mSmallValue < INT64_MAX)) {
+    mSmallValue ++ ;
+  }else{
+    convertToGMP () ;
+    mpz_add_ui (mGMPint, mGMPint, 1) ;
+    normalize () ;
+  }
   return *this ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 C_BigInt & C_BigInt::operator -- (void) {
-  mpz_sub_ui (mGMPint, mGMPint, 1) ;
+  if (mIsSmall && (mSmallValue > INT64_MIN)) {
+    mSmallValue -- ;
+  }else{
+    convertToGMP () ;
+    mpz_sub_ui (mGMPint, mGMPint, 1) ;
+    normalize () ;
+  }
   return *this ;
 }
 
@@ -233,13 +413,17 @@ C_BigInt & C_BigInt::operator -- (void) {
 //----------------------------------------------------------------------------------------------------------------------
 
 C_String C_BigInt::decimalString (void) const {
-  const size_t neededSize = mpz_sizeinbase (mGMPint, 10) + 2 ;
-  char * s = NULL ;
-  macroMyNewPODArray (s, char, neededSize) ;
-  mpz_get_str (s, 10, mGMPint) ;
   C_String result ;
-  result << s ;
-  macroMyDeletePODArray (s) ;
+  if (mIsSmall) {
+    result.appendSigned (mSmallValue) ;
+  }else{
+    const size_t neededSize = mpz_sizeinbase (mGMPint, 10) + 2 ;
+    char * s = NULL ;
+    macroMyNewPODArray (s, char, neededSize) ;
+    mpz_get_str (s, 10, mGMPint) ;
+    result << s ;
+    macroMyDeletePODArray (s) ;
+  }
   return result ;
 }
 
@@ -272,13 +456,19 @@ C_String C_BigInt::hexString (void) const {
 //----------------------------------------------------------------------------------------------------------------------
 
 C_String C_BigInt::xString (void) const {
-  char * s = NULL ;
-  const size_t neededSize = mpz_sizeinbase (mGMPint, 16) + 2 ;
-  macroMyNewPODArray (s, char, neededSize) ;
-  mpz_get_str (s, -16, mGMPint) ; // -16 for getting 'A' to 'F' (16 provides 'a' to 'f')
   C_String result ;
-  result << s ;
-  macroMyDeletePODArray (s) ;
+  if (mIsSmall && (mSmallValue >= 0)) {
+    result.appendUnsignedHex ((uint64_t) mSmallValue) ;
+  }else{
+    C_BigInt value (*this) ;
+    value.convertToGMP () ;
+    char * s = NULL ;
+    const size_t neededSize = mpz_sizeinbase (value.mGMPint, 16) + 2 ;
+    macroMyNewPODArray (s, char, neededSize) ;
+    mpz_get_str (s, -16, value.mGMPint) ; // -16 for getting 'A' to 'F' (16 provides 'a' to 'f')
+    result << s ;
+    macroMyDeletePODArray (s) ;
+  }
   return result ;
 }
 
@@ -291,8 +481,16 @@ C_String C_BigInt::xString (void) const {
 //----------------------------------------------------------------------------------------------------------------------
 
 C_BigInt C_BigInt::abs (void) const {
-  C_BigInt result ;
-  mpz_abs (result.mGMPint, mGMPint) ;
+  C_BigInt result (*this) ;
+  if (result.mIsSmall && (result.mSmallValue != INT64_MIN)) {
+    if (result.mSmallValue < 0) {
+      result.mSmallValue = - result.mSmallValue ;
+    }
+  }else{
+    result.convertToGMP () ;
+    mpz_abs (result.mGMPint, result.mGMPint) ;
+    result.normalize () ;
+  }
   return result ;
 }
 
@@ -302,10 +500,21 @@ C_BigInt C_BigInt::abs (void) const {
   #pragma mark Logical operations
 #endif
 
+//----------------------------------------------------------------------------------------------------------------------
+// GMP logical operations behave as two's complement, so they give the same result as int64_t operations on small
+// values.
 //----------------------------------------------------------------------------------------------------------------------
 
 void C_BigInt::operator &= (const C_BigInt inOperand) {
-  mpz_and (mGMPint, mGMPint, inOperand.mGMPint) ;
+  if (mIsSmall && inOperand.mIsSmall) {
+    mSmallValue &= inOperand.mSmallValue ;
+  }else{
+    C_BigInt operand (inOperand) ;
+    operand.convertToGMP () ;
+    convertToGMP () ;
+    mpz_and (mGMPint, mGMPint, operand.mGMPint) ;
+    normalize () ;
+  }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -319,7 +528,15 @@ C_BigInt C_BigInt::operator & (const C_BigInt & inOperand) const {
 //----------------------------------------------------------------------------------------------------------------------
 
 void C_BigInt::operator |= (const C_BigInt inOperand) {
-  mpz_ior (mGMPint, mGMPint, inOperand.mGMPint) ;
+  if (mIsSmall && inOperand.mIsSmall) {
+    mSmallValue |= inOperand.mSmallValue ;
+  }else{
+    C_BigInt operand (inOperand) ;
+    operand.convertToGMP () ;
+    convertToGMP () ;
+    mpz_ior (mGMPint, mGMPint, operand.mGMPint) ;
+    normalize () ;
+  }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -333,7 +550,15 @@ C_BigInt C_BigInt::operator | (const C_BigInt & inOperand) const {
 //----------------------------------------------------------------------------------------------------------------------
 
 void C_BigInt::operator ^= (const C_BigInt inOperand) {
-  mpz_xor (mGMPint, mGMPint, inOperand.mGMPint) ;
+  if (mIsSmall && inOperand.mIsSmall) {
+    mSmallValue ^= inOperand.mSmallValue ;
+  }else{
+    C_BigInt operand (inOperand) ;
+    operand.convertToGMP () ;
+    convertToGMP () ;
+    mpz_xor (mGMPint, mGMPint, operand.mGMPint) ;
+    normalize () ;
+  }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -347,8 +572,13 @@ C_BigInt C_BigInt::operator ^ (const C_BigInt & inOperand) const {
 //----------------------------------------------------------------------------------------------------------------------
 
 C_BigInt C_BigInt::operator ~ (void) const {
-  C_BigInt result ;
-  mpz_com (result.mGMPint, mGMPint) ;
+  C_BigInt result (*this) ;
+  if (result.mIsSmall) {
+    result.mSmallValue = ~ result.mSmallValue ;
+  }else{
+    mpz_com (result.mGMPint, result.mGMPint) ;
+    result.normalize () ;
+  }
   return result ;
 }
 
@@ -361,7 +591,11 @@ C_BigInt C_BigInt::operator ~ (void) const {
 //----------------------------------------------------------------------------------------------------------------------
 
 void C_BigInt::operator += (const uint32_t inOperand) {
-  mpz_add_ui (mGMPint, mGMPint, inOperand) ;
+  if (! (mIsSmall && addInt64 (mSmallValue, inOperand, mSmallValue))) {
+    convertToGMP () ;
+    mpz_add_ui (mGMPint, mGMPint, inOperand) ;
+    normalize () ;
+  }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -375,7 +609,11 @@ C_BigInt C_BigInt::operator + (const uint32_t inOperand) const {
 //----------------------------------------------------------------------------------------------------------------------
 
 void C_BigInt::operator -= (const uint32_t inOperand) {
-  mpz_sub_ui (mGMPint, mGMPint, inOperand) ;
+  if (! (mIsSmall && subInt64 (mSmallValue, inOperand, mSmallValue))) {
+    convertToGMP () ;
+    mpz_sub_ui (mGMPint, mGMPint, inOperand) ;
+    normalize () ;
+  }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -395,13 +633,25 @@ C_BigInt C_BigInt::operator - (const uint32_t inOperand) const {
 //----------------------------------------------------------------------------------------------------------------------
 
 void C_BigInt::operator += (const C_BigInt inOperand) {
-  mpz_add (mGMPint, mGMPint, inOperand.mGMPint) ;
+  if (! (mIsSmall && inOperand.mIsSmall && addInt64 (mSmallValue, inOperand.mSmallValue, mSmallValue))) {
+    C_BigInt operand (inOperand) ;
+    operand.convertToGMP () ;
+    convertToGMP () ;
+    mpz_add (mGMPint, mGMPint, operand.mGMPint) ;
+    normalize () ;
+  }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 void C_BigInt::operator -= (const C_BigInt inOperand) {
-  mpz_sub (mGMPint, mGMPint, inOperand.mGMPint) ;
+  if (! (mIsSmall && inOperand.mIsSmall && subInt64 (mSmallValue, inOperand.mSmallValue, mSmallValue))) {
+    C_BigInt operand (inOperand) ;
+    operand.convertToGMP () ;
+    convertToGMP () ;
+    mpz_sub (mGMPint, mGMPint, operand.mGMPint) ;
+    normalize () ;
+  }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -439,7 +689,13 @@ C_BigInt C_BigInt::operator - (void) const {
 //----------------------------------------------------------------------------------------------------------------------
 
 void C_BigInt::negateInPlace (void) {
-  mpz_neg (mGMPint, mGMPint) ;
+  if (mIsSmall && (mSmallValue != INT64_MIN)) {
+    mSmallValue = - mSmallValue ;
+  }else{
+    convertToGMP () ;
+    mpz_neg (mGMPint, mGMPint) ;
+    normalize () ;
+  }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -451,7 +707,11 @@ void C_BigInt::negateInPlace (void) {
 //----------------------------------------------------------------------------------------------------------------------
 
 void C_BigInt::operator *= (const uint32_t inMultiplicand) {
-  mpz_mul_ui (mGMPint, mGMPint, inMultiplicand) ;
+  if (! (mIsSmall && mulInt64 (mSmallValue, inMultiplicand, mSmallValue))) {
+    convertToGMP () ;
+    mpz_mul_ui (mGMPint, mGMPint, inMultiplicand) ;
+    normalize () ;
+  }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -462,6 +722,27 @@ C_BigInt C_BigInt::operator * (const uint32_t inMultiplicand) const {
   return result ;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+// Regression check, run at startup by the debug build: a large value times a multiplicand of 2^31 or more keeps its
+// sign (mpz_mul_ui used to take the sign of the multiplicand cast to int).
+//----------------------------------------------------------------------------------------------------------------------
+
+#ifndef DO_NOT_GENERATE_CHECKINGS
+  static void checkMultiplicationWithUInt32 (void) {
+    const uint32_t multiplicands [4] = {0x7FFFFFFFU, 0x80000000U, 0xC0000001U, 0xFFFFFFFFU} ;
+    for (int32_t negative = 0 ; negative < 2 ; negative++) {
+      const C_BigInt large (UINT64_C (0x123456789ABCDEF), UINT64_C (0xFEDCBA9876543210), negative != 0) ;
+      for (uint32_t i = 0 ; i < 4 ; i++) {
+        const C_BigInt product = large * multiplicands [i] ;
+        MF_Assert (product.sign () == large.sign (), "C_BigInt * uint32_t: wrong sign for multiplicand %lld", (int64_t) multiplicands [i], 0) ;
+        MF_Assert (product == large * C_BigInt (multiplicands [i], false), "C_BigInt * uint32_t: wrong product for multiplicand %lld", (int64_t) multiplicands [i], 0) ;
+      }
+    }
+  }
+
+  static C_PrologueEpilogue gCheckMultiplicationWithUInt32 (checkMultiplicationWithUInt32, NULL) ;
+#endif
+
 //----------------------------------------------------------------------------------------------------------------------
 
 #ifdef PRAGMA_MARK_ALLOWED
@@ -471,7 +752,13 @@ C_BigInt C_BigInt::operator * (const uint32_t inMultiplicand) const {
 //----------------------------------------------------------------------------------------------------------------------
 
 void C_BigInt::operator *= (const C_BigInt inMultiplicand) {
-  mpz_mul (mGMPint, mGMPint, inMultiplicand.mGMPint) ;
+  if (! (mIsSmall && inMultiplicand.mIsSmall && mulInt64 (mSmallValue, inMultiplicand.mSmallValue, mSmallValue))) {
+    C_BigInt operand (inMultiplicand) ;
+    operand.convertToGMP () ;
+    convertToGMP () ;
+    mpz_mul (mGMPint, mGMPint, operand.mGMPint) ;
+    normalize () ;
+  }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -488,26 +775,58 @@ C_BigInt C_BigInt::operator * (const C_BigInt & inMultiplicand) const {
   #pragma mark Division
 #endif
 
+//----------------------------------------------------------------------------------------------------------------------
+// Division of small values by a non zero divisor is done on int64_t, except INT64_MIN / -1 whose quotient does not
+// fit. The C++ division truncates, the floor and ceil divisions adjust the truncated quotient.
+//----------------------------------------------------------------------------------------------------------------------
+
+static bool smallDivisionIsPossible (const int64_t inDividend, const int64_t inDivisor) {
+  return (inDivisor != 0) && ! ((inDividend == INT64_MIN) && (inDivisor == -1)) ;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 
 void C_BigInt::divideBy (const uint32_t inDivisor,
                          C_BigInt & outQuotient,
                          uint32_t & outRemainder) const {
-  outRemainder = (uint32_t) mpz_fdiv_q_ui (outQuotient.mGMPint, mGMPint, inDivisor) ;
+  if (mIsSmall && (inDivisor != 0)) {
+    int64_t quotient = mSmallValue / (int64_t) inDivisor ;
+    int64_t remainder = mSmallValue % (int64_t) inDivisor ;
+    if (remainder < 0) {
+      quotient -= 1 ;
+      remainder += (int64_t) inDivisor ;
+    }
+    outQuotient.setToSmallValue (quotient) ;
+    outRemainder = (uint32_t) remainder ;
+  }else{
+    C_BigInt dividend (*this) ;
+    dividend.convertToGMP () ;
+    outQuotient.convertToGMP () ;
+    outRemainder = (uint32_t) mpz_fdiv_q_ui (outQuotient.mGMPint, dividend.mGMPint, inDivisor) ;
+    outQuotient.normalize () ;
+  }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 void C_BigInt::divideInPlace (const uint32_t inDivisor, uint32_t & outRemainder) {
-  mpz_t quotient ;
-  mpz_init (quotient) ;
-  if (mpz_sgn (mGMPint) >= 0) {
-    outRemainder = (uint32_t) mpz_fdiv_q_ui (quotient, mGMPint, inDivisor) ;
+  if (mIsSmall && (inDivisor != 0)) {
+    const int64_t remainder = mSmallValue % (int64_t) inDivisor ;
+    mSmallValue /= (int64_t) inDivisor ;
+    outRemainder = (uint32_t) ((remainder < 0) ? (- remainder) : remainder) ;
   }else{
-    outRemainder = (uint32_t) mpz_cdiv_q_ui (quotient, mGMPint, inDivisor) ;
+    convertToGMP () ;
+    mpz_t quotient ;
+    mpz_init (quotient) ;
+    if (mpz_sgn (mGMPint) >= 0) {
+      outRemainder = (uint32_t) mpz_fdiv_q_ui (quotient, mGMPint, inDivisor) ;
+    }else{
+      outRemainder = (uint32_t) mpz_cdiv_q_ui (quotient, mGMPint, inDivisor) ;
+    }
+    mpz_swap (quotient, mGMPint) ;
+    mpz_clear (quotient) ;
+    normalize () ;
   }
-  mpz_swap (quotient, mGMPint) ;
-  mpz_clear (quotient) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -522,21 +841,49 @@ void C_BigInt::divideBy (const C_BigInt inDivisor,
 //----------------------------------------------------------------------------------------------------------------------
 
 void C_BigInt::divideInPlace (const C_BigInt inDivisor, C_BigInt & outRemainder) {
-  mpz_t quotient ;
-  mpz_init (quotient) ;
-  mpz_tdiv_qr (quotient, outRemainder.mGMPint, mGMPint, inDivisor.mGMPint) ;
-  mpz_swap (quotient, mGMPint) ;
-  mpz_clear (quotient) ;
+  if (mIsSmall && inDivisor.mIsSmall && smallDivisionIsPossible (mSmallValue, inDivisor.mSmallValue)) {
+    const int64_t remainder = mSmallValue % inDivisor.mSmallValue ;
+    mSmallValue /= inDivisor.mSmallValue ;
+    outRemainder.setToSmallValue (remainder) ;
+  }else{
+    C_BigInt divisor (inDivisor) ;
+    divisor.convertToGMP () ;
+    convertToGMP () ;
+    outRemainder.convertToGMP () ;
+    mpz_t quotient ;
+    mpz_init (quotient) ;
+    mpz_tdiv_qr (quotient, outRemainder.mGMPint, mGMPint, divisor.mGMPint) ;
+    mpz_swap (quotient, mGMPint) ;
+    mpz_clear (quotient) ;
+    normalize () ;
+    outRemainder.normalize () ;
+  }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 void C_BigInt::ceilDivideInPlace (const C_BigInt inDivisor, C_BigInt & outRemainder) {
-  mpz_t quotient ;
-  mpz_init (quotient) ;
-  mpz_cdiv_qr (quotient, outRemainder.mGMPint, mGMPint, inDivisor.mGMPint) ;
-  mpz_swap (quotient, mGMPint) ;
-  mpz_clear (quotient) ;
+  if (mIsSmall && inDivisor.mIsSmall && smallDivisionIsPossible (mSmallValue, inDivisor.mSmallValue)) {
+    int64_t remainder = mSmallValue % inDivisor.mSmallValue ;
+    mSmallValue /= inDivisor.mSmallValue ;
+    if ((remainder != 0) && ((remainder > 0) == (inDivisor.mSmallValue > 0))) {
+      mSmallValue += 1 ;
+      remainder -= inDivisor.mSmallValue ;
+    }
+    outRemainder.setToSmallValue (remainder) ;
+  }else{
+    C_BigInt divisor (inDivisor) ;
+    divisor.convertToGMP () ;
+    convertToGMP () ;
+    outRemainder.convertToGMP () ;
+    mpz_t quotient ;
+    mpz_init (quotient) ;
+    mpz_cdiv_qr (quotient, outRemainder.mGMPint, mGMPint, divisor.mGMPint) ;
+    mpz_swap (quotient, mGMPint) ;
+    mpz_clear (quotient) ;
+    normalize () ;
+    outRemainder.normalize () ;
+  }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -551,11 +898,27 @@ void C_BigInt::ceilDivideBy (const C_BigInt inDivisor,
 //----------------------------------------------------------------------------------------------------------------------
 
 void C_BigInt::floorDivideInPlace (const C_BigInt inDivisor, C_BigInt & outRemainder) {
-  mpz_t quotient ;
-  mpz_init (quotient) ;
-  mpz_fdiv_qr (quotient, outRemainder.mGMPint, mGMPint, inDivisor.mGMPint) ;
-  mpz_swap (quotient, mGMPint) ;
-  mpz_clear (quotient) ;
+  if (mIsSmall && inDivisor.mIsSmall && smallDivisionIsPossible (mSmallValue, inDivisor.mSmallValue)) {
+    int64_t remainder = mSmallValue % inDivisor.mSmallValue ;
+    mSmallValue /= inDivisor.mSmallValue ;
+    if ((remainder != 0) && ((remainder < 0) != (inDivisor.mSmallValue < 0))) {
+      mSmallValue -= 1 ;
+      remainder += inDivisor.mSmallValue ;
+    }
+    outRemainder.setToSmallValue (remainder) ;
+  }else{
+    C_BigInt divisor (inDivisor) ;
+    divisor.convertToGMP () ;
+    convertToGMP () ;
+    outRemainder.convertToGMP () ;
+    mpz_t quotient ;
+    mpz_init (quotient) ;
+    mpz_fdiv_qr (quotient, outRemainder.mGMPint, mGMPint, divisor.mGMPint) ;
+    mpz_swap (quotient, mGMPint) ;
+    mpz_clear (quotient) ;
+    normalize () ;
+    outRemainder.normalize () ;
+  }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -585,14 +948,22 @@ C_BigInt C_BigInt::operator / (const C_BigInt & inDivisor) const {
 //----------------------------------------------------------------------------------------------------------------------
 
 void C_BigInt::operator %= (const C_BigInt inDivisor) {
-  mpz_t quotient ;
-  mpz_init (quotient) ;
-  mpz_t remainder ;
-  mpz_init (remainder) ;
-  mpz_tdiv_qr (quotient, remainder, mGMPint, inDivisor.mGMPint) ;
-  mpz_swap (remainder, mGMPint) ;
-  mpz_clear (quotient) ;
-  mpz_clear (remainder) ;
+  if (mIsSmall && inDivisor.mIsSmall && smallDivisionIsPossible (mSmallValue, inDivisor.mSmallValue)) {
+    mSmallValue %= inDivisor.mSmallValue ;
+  }else{
+    C_BigInt divisor (inDivisor) ;
+    divisor.convertToGMP () ;
+    convertToGMP () ;
+    mpz_t quotient ;
+    mpz_init (quotient) ;
+    mpz_t remainder ;
+    mpz_init (remainder) ;
+    mpz_tdiv_qr (quotient, remainder, mGMPint, divisor.mGMPint) ;
+    mpz_swap (remainder, mGMPint) ;
+    mpz_clear (quotient) ;
+    mpz_clear (remainder) ;
+    normalize () ;
+  }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -612,7 +983,15 @@ C_BigInt C_BigInt::operator % (const C_BigInt & inDivisor) const {
 //----------------------------------------------------------------------------------------------------------------------
 
 void C_BigInt::operator <<= (const uint32_t inValue) {
-  mpz_mul_2exp (mGMPint, mGMPint, inValue) ;
+  if (mIsSmall && (mSmallValue == 0)) {
+  }else if (mIsSmall && (inValue < 63)
+         && (mSmallValue >= (INT64_MIN >> inValue)) && (mSmallValue <= (INT64_MAX >> inValue))) {
+    mSmallValue = (int64_t) (((uint64_t) mSmallValue) << inValue) ;
+  }else{
+    convertToGMP () ;
+    mpz_mul_2exp (mGMPint, mGMPint, inValue) ;
+    normalize () ;
+  }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -640,14 +1019,25 @@ C_BigInt C_BigInt::operator << (const C_BigInt inValue) const {
   #pragma mark Shift right
 #endif
 
+//----------------------------------------------------------------------------------------------------------------------
+// Shifting right is a floor division by a power of 2, as the arithmetic shift of int64_t.
 //----------------------------------------------------------------------------------------------------------------------
 
 void C_BigInt::operator >>= (const uint32_t inValue) {
-  mpz_t quotient ;
-  mpz_init (quotient) ;
-  mpz_fdiv_q_2exp (quotient, mGMPint, inValue) ;
-  mpz_swap (quotient, mGMPint) ;
-  mpz_clear (quotient) ;
+  if (mIsSmall) {
+    if (inValue < 63) {
+      mSmallValue >>= inValue ;
+    }else{
+      mSmallValue = (mSmallValue < 0) ? -1 : 0 ;
+    }
+  }else{
+    mpz_t quotient ;
+    mpz_init (quotient) ;
+    mpz_fdiv_q_2exp (quotient, mGMPint, inValue) ;
+    mpz_swap (quotient, mGMPint) ;
+    mpz_clear (quotient) ;
+    normalize () ;
+  }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -675,10 +1065,23 @@ C_BigInt C_BigInt::operator >> (const C_BigInt inValue) const {
   #pragma mark Compare
 #endif
 
+//----------------------------------------------------------------------------------------------------------------------
+// A value that is not small does not fit in int64_t: it is greater than any small value if it is positive, lower if
+// it is negative.
 //----------------------------------------------------------------------------------------------------------------------
 
 int32_t C_BigInt::compare (const C_BigInt & inValue) const {
-  return mpz_cmp (mGMPint, inValue.mGMPint) ;
+  int32_t result ;
+  if (mIsSmall && inValue.mIsSmall) {
+    result = (mSmallValue < inValue.mSmallValue) ? -1 : ((mSmallValue > inValue.mSmallValue) ? 1 : 0) ;
+  }else if (mIsSmall) {
+    result = - mpz_sgn (inValue.mGMPint) ;
+  }else if (inValue.mIsSmall) {
+    result = mpz_sgn (mGMPint) ;
+  }else{
+    result = mpz_cmp (mGMPint, inValue.mGMPint) ;
+  }
+  return result ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -723,26 +1126,51 @@ bool C_BigInt::operator < (const C_BigInt & inOperand) const {
   #pragma mark Bit manipulation
 #endif
 
+//----------------------------------------------------------------------------------------------------------------------
+// Bits of a small value are its two's complement bits, the bits above bit 63 are the sign bit.
 //----------------------------------------------------------------------------------------------------------------------
 
 bool C_BigInt::bitAtIndex (const uint32_t inIndex) const {
-  return mpz_tstbit (mGMPint, inIndex) != 0 ;
+  bool result ;
+  if (mIsSmall) {
+    result = (inIndex < 63) ? (((mSmallValue >> inIndex) & 1) != 0) : (mSmallValue < 0) ;
+  }else{
+    result = mpz_tstbit (mGMPint, inIndex) != 0 ;
+  }
+  return result ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 void C_BigInt::setBitAtIndex (const bool inBit, const uint32_t inIndex) {
-  if (inBit) {
-    mpz_setbit (mGMPint, inIndex) ;
+  if (mIsSmall && (inIndex < 63)) {
+    const uint64_t mask = ((uint64_t) 1) << inIndex ;
+    if (inBit) {
+      mSmallValue = (int64_t) (((uint64_t) mSmallValue) | mask) ;
+    }else{
+      mSmallValue = (int64_t) (((uint64_t) mSmallValue) & ~ mask) ;
+    }
   }else{
-    mpz_clrbit (mGMPint, inIndex) ;
+    convertToGMP () ;
+    if (inBit) {
+      mpz_setbit (mGMPint, inIndex) ;
+    }else{
+      mpz_clrbit (mGMPint, inIndex) ;
+    }
+    normalize () ;
   }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 void C_BigInt::complementBitAtIndex (const uint32_t inIndex) {
-  mpz_combit (mGMPint, inIndex) ;
+  if (mIsSmall && (inIndex < 63)) {
+    mSmallValue = (int64_t) (((uint64_t) mSmallValue) ^ (((uint64_t) 1) << inIndex)) ;
+  }else{
+    convertToGMP () ;
+    mpz_combit (mGMPint, inIndex) ;
+    normalize () ;
+  }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -754,39 +1182,52 @@ void C_BigInt::complementBitAtIndex (const uint32_t inIndex) {
 //----------------------------------------------------------------------------------------------------------------------
 
 bool C_BigInt::fitsInUInt32 (void) const {
-  return mpz_fits_uint_p (mGMPint) != 0 ;
+  bool result ;
+  if (mIsSmall) {
+    result = (mSmallValue >= 0) && (mSmallValue <= (int64_t) UINT32_MAX) ;
+  }else{
+    result = mpz_fits_uint_p (mGMPint) != 0 ;
+  }
+  return result ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 bool C_BigInt::fitsInUInt64 (void) const {
-  return (mpz_sgn (mGMPint) >= 0) && (mpz_sizeinbase (mGMPint, 2) <= 64) ;
+  bool result ;
+  if (mIsSmall) {
+    result = mSmallValue >= 0 ;
+  }else{
+    result = (mpz_sgn (mGMPint) >= 0) && (mpz_sizeinbase (mGMPint, 2) <= 64) ;
+  }
+  return result ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 bool C_BigInt::fitsInSInt32 (void) const {
-  return mpz_fits_sint_p (mGMPint) != 0 ;
+  bool result ;
+  if (mIsSmall) {
+    result = (mSmallValue >= INT32_MIN) && (mSmallValue <= INT32_MAX) ;
+  }else{
+    result = mpz_fits_sint_p (mGMPint) != 0 ;
+  }
+  return result ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 bool C_BigInt::fitsInSInt64 (void) const {
-  const size_t requiredBitCount = mpz_sizeinbase (mGMPint, 2) ;
-  bool ok = requiredBitCount <= 63 ;
-  if ((requiredBitCount == 64) && (mpz_sgn (mGMPint) < 0)) { // INT64_MIN is a particular case
-    int64_t r ;
-    mpz_export (& r, NULL, 1, sizeof (int64_t), 0, 0, mGMPint) ;
-    ok = r == INT64_MIN ;
-  }
-  return ok ;
+  return mIsSmall || gmpFitsInSInt64 (mGMPint) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 uint32_t C_BigInt::requiredBitCountForSignedRepresentation (void) const {
-  size_t requiredBitCount = mpz_sizeinbase (mGMPint, 2) ;
-  if (mpz_sgn (mGMPint) > 0) {
+  C_BigInt value (*this) ;
+  value.convertToGMP () ;
+  size_t requiredBitCount = mpz_sizeinbase (value.mGMPint, 2) ;
+  if (mpz_sgn (value.mGMPint) > 0) {
     requiredBitCount ++ ;
   }
   return (uint32_t) requiredBitCount ;
@@ -795,7 +1236,9 @@ uint32_t C_BigInt::requiredBitCountForSignedRepresentation (void) const {
 //----------------------------------------------------------------------------------------------------------------------
 
 uint32_t C_BigInt::requiredBitCountForUnsignedRepresentation (void) const {
-  return (uint32_t) mpz_sizeinbase (mGMPint, 2) ;
+  C_BigInt value (*this) ;
+  value.convertToGMP () ;
+  return (uint32_t) mpz_sizeinbase (value.mGMPint, 2) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -807,14 +1250,24 @@ uint32_t C_BigInt::requiredBitCountForUnsignedRepresentation (void) const {
 //----------------------------------------------------------------------------------------------------------------------
 
 uint32_t C_BigInt::uint32 (void) const {
-  return (uint32_t) mpz_get_ui (mGMPint) ;
+  uint32_t result ;
+  if (mIsSmall) { // As mpz_get_ui, returns the low bits of the absolute value
+    result = (uint32_t) ((mSmallValue < 0) ? (((uint64_t) 0) - (uint64_t) mSmallValue) : (uint64_t) mSmallValue) ;
+  }else{
+    result = (uint32_t) mpz_get_ui (mGMPint) ;
+  }
+  return result ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 uint64_t C_BigInt::uint64 (void) const {
   uint64_t result = UINT64_MAX ;
-  if (fitsInUInt64 ()) {
+  if (mIsSmall) {
+    if (mSmallValue >= 0) {
+      result = (uint64_t) mSmallValue ;
+    }
+  }else if (fitsInUInt64 ()) {
     mpz_export (& result, NULL, 1, sizeof (uint64_t), 0, 0, mGMPint) ;
   }
   return result ;
@@ -823,28 +1276,22 @@ uint64_t C_BigInt::uint64 (void) const {
 //----------------------------------------------------------------------------------------------------------------------
 
 int32_t C_BigInt::int32 (void) const {
-  return (int32_t) mpz_get_si (mGMPint) ;
+  return mIsSmall ? (int32_t) mSmallValue : (int32_t) mpz_get_si (mGMPint) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 int64_t C_BigInt::int64 (void) const {
-  uint64_t r = UINT64_MAX ;
-  if (fitsInSInt64 ()) {
-    mpz_export (& r, NULL, 1, sizeof (uint64_t), 0, 0, mGMPint) ;
-  }
-  int64_t result = (int64_t) r ;
-  if (mpz_sgn (mGMPint) < 0) {
-    result = - result ;
-  }
-  return result ;
+  return mIsSmall ? mSmallValue : gmpToInt64 (mGMPint) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 void C_BigInt::extractBytesForUnsignedRepresentation (TC_UniqueArray <uint8_t> & outValue) const {
+  C_BigInt value (*this) ;
+  value.convertToGMP () ;
   size_t count = 0 ;
-  const uint8_t * ptr = (const uint8_t *) mpz_export (NULL, & count, -1, sizeof (uint8_t), 0, 0, mGMPint) ;
+  const uint8_t * ptr = (const uint8_t *) mpz_export (NULL, & count, -1, sizeof (uint8_t), 0, 0, value.mGMPint) ;
   outValue.setCountToZero () ;
   for (size_t i=0 ; i<count ; i++) {
     outValue.appendObject (ptr [i]) ;
@@ -858,10 +1305,10 @@ void C_BigInt::extractBytesForUnsignedRepresentation (TC_UniqueArray <uint8_t> &
 //----------------------------------------------------------------------------------------------------------------------
 
 void C_BigInt::extractBytesForSignedRepresentation (TC_UniqueArray <uint8_t> & outValue) const {
-  if (mpz_sgn (mGMPint) == 0) { // zero
+  if (sign () == 0) { // zero
     outValue.setCountToZero () ;
     outValue.appendObject (0) ;
-  }else if (mpz_sgn (mGMPint) > 0) { // > 0
+  }else if (sign () > 0) { // > 0
     extractBytesForUnsignedRepresentation (outValue) ;
     if ((outValue.lastObject (HERE) & 0x80) != 0) {
       outValue.appendObject (0) ;
@@ -887,7 +1334,15 @@ void C_BigInt::extractBytesForSignedRepresentation (TC_UniqueArray <uint8_t> & o
 //----------------------------------------------------------------------------------------------------------------------
 
 void swap (C_BigInt & ioOp1, C_BigInt & ioOp2) {
-  mpz_swap (ioOp1.mGMPint, ioOp2.mGMPint) ;
+  const int64_t smallValue = ioOp1.mSmallValue ;
+  ioOp1.mSmallValue = ioOp2.mSmallValue ;
+  ioOp2.mSmallValue = smallValue ;
+  const __mpz_struct gmpValue = ioOp1.mGMPint [0] ;
+  ioOp1.mGMPint [0] = ioOp2.mGMPint [0] ;
+  ioOp2.mGMPint [0] = gmpValue ;
+  const bool isSmall = ioOp1.mIsSmall ;
+  ioOp1.mIsSmall = ioOp2.mIsSmall ;
+  ioOp2.mIsSmall = isSmall ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
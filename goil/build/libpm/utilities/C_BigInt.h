@@ -171,8 +171,16 @@ class C_BigInt {
   public : uint32_t requiredBitCountForSignedRepresentation (void) const ;
   public : uint32_t requiredBitCountForUnsignedRepresentation (void) const ;
   
-//--- Value
+//--- Small value handling
+  private : void setToSmallValue (const int64_t inValue) ;
+  private : void convertToGMP (void) ;
+  private : void normalize (void) ;
+
+//--- Value: a value that fits in int64_t is stored in mSmallValue and mGMPint is not
+//    initialized. Any other value is stored in mGMPint.
+  protected : int64_t mSmallValue ;
   protected : mpz_t mGMPint ;
+  protected : bool mIsSmall ;
 
 //--- Friend
   friend void swap (C_BigInt & ioOp1, C_BigInt & ioOp2) ;
@@ -26,6 +26,7 @@
 //----------------------------------------------------------------------------------------------------------------------
 
 #include <stdio.h>
+#include <stdlib.h>
 
 //----------------------------------------------------------------------------------------------------------------------
 
@@ -70,6 +71,24 @@
   static uint32_t gAllocatedArrayCount = 0 ;
 #endif
 
+//----------------------------------------------------------------------------------------------------------------------
+// Counted in every build, for the profile of the allocations
+
+static uint64_t gAllocatedBlockCount = 0 ;
+static uint64_t gAllocatedByteCount = 0 ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+uint64_t allocatedBlockCount (void) {
+  return gAllocatedBlockCount ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+uint64_t allocatedByteCount (void) {
+  return gAllocatedByteCount ;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 
 #ifndef DO_NOT_GENERATE_CHECKINGS
@@ -102,6 +121,8 @@
       gCurrentObjectCount ++ ;
       gAllocatedObjectCount ++ ;
     #endif
+    gAllocatedBlockCount ++ ;
+    gAllocatedByteCount += inSizeInBytes ;
   }
   return result ;
 }
@@ -131,6 +152,8 @@
         gCurrentArrayCount ++ ;
         gAllocatedArrayCount ++ ;
       #endif
+      gAllocatedBlockCount ++ ;
+      gAllocatedByteCount += inSizeInBytes ;
     }
     return result ;
   }
@@ -170,6 +193,60 @@
 }
 #endif
 
+//----------------------------------------------------------------------------------------------------------------------
+// Without the checkings, the new operators of the C++ library are replaced by operators that only count the blocks.
+// They are not inlined, otherwise the compiler matches the malloc and free calls with the new and delete operators.
+
+#ifndef REDEFINE_NEW_DELETE_OPERATORS
+  #if __cplusplus >= 201703
+    __attribute__ ((noinline)) void * operator new (size_t inSizeInBytes) {
+  #else
+    __attribute__ ((noinline)) void * operator new (size_t inSizeInBytes) throw (std::bad_alloc) {
+  #endif
+  void * result = ::malloc ((inSizeInBytes > 0) ? inSizeInBytes : 1) ;
+  if (NULL == result) {
+    throw std::bad_alloc () ;
+  }
+  gAllocatedBlockCount ++ ;
+  gAllocatedByteCount += inSizeInBytes ;
+  return result ;
+}
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------
+
+#ifndef REDEFINE_NEW_DELETE_OPERATORS
+  #if __cplusplus >= 201703
+    __attribute__ ((noinline)) void * operator new [] (size_t inSizeInBytes) {
+  #else
+    __attribute__ ((noinline)) void * operator new [] (size_t inSizeInBytes) throw (std::bad_alloc) {
+  #endif
+  void * result = ::malloc ((inSizeInBytes > 0) ? inSizeInBytes : 1) ;
+  if (NULL == result) {
+    throw std::bad_alloc () ;
+  }
+  gAllocatedBlockCount ++ ;
+  gAllocatedByteCount += inSizeInBytes ;
+  return result ;
+}
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------
+
+#ifndef REDEFINE_NEW_DELETE_OPERATORS
+  __attribute__ ((noinline)) void operator delete (void * inPointer) throw () {
+    ::free (inPointer) ;
+  }
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------
+
+#ifndef REDEFINE_NEW_DELETE_OPERATORS
+  __attribute__ ((noinline)) void operator delete [] (void * inPointer) throw () {
+    ::free (inPointer) ;
+  }
+#endif
+
 //----------------------------------------------------------------------------------------------------------------------
 
 void displayAllocationStats (void) {
@@ -22,6 +22,10 @@
 
 //----------------------------------------------------------------------------------------------------------------------
 
+#include <stdint.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+
 #ifndef DO_NOT_GENERATE_CHECKINGS
   void prologueForNew (void) ;
 #endif
@@ -31,3 +35,13 @@
 void displayAllocationStats (void) ;
 
 //----------------------------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------------------------
+// Number and total size of the blocks allocated by the new operators since the start of the program, read by the
+// @timer type for the profile of the allocations.
+
+uint64_t allocatedBlockCount (void) ;
+
+uint64_t allocatedByteCount (void) ;
+
+//----------------------------------------------------------------------------------------------------------------------
@@ -1832,6 +1832,764 @@ void extensionSetter_getTemplate (GALGAS_gtlTemplateMap & ioObject,
 }
 
 
+//----------------------------------------------------------------------------------------------------------------------
+
+cMapElement_gtlProfileMap::cMapElement_gtlProfileMap (const GALGAS_lstring & inKey,
+                                                      const GALGAS_uint & in_count,
+                                                      const GALGAS_uint & in_time,
+                                                      const GALGAS_uint & in_cpu,
+                                                      const GALGAS_uint & in_allocations,
+                                                      const GALGAS_uint_36__34_ & in_allocatedBytes
+                                                      COMMA_LOCATION_ARGS) :
+cMapElement (inKey COMMA_THERE),
+mProperty_count (in_count),
+mProperty_time (in_time),
+mProperty_cpu (in_cpu),
+mProperty_allocations (in_allocations),
+mProperty_allocatedBytes (in_allocatedBytes) {
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+bool cMapElement_gtlProfileMap::isValid (void) const {
+  return mProperty_lkey.isValid () && mProperty_count.isValid () && mProperty_time.isValid () && mProperty_cpu.isValid () && mProperty_allocations.isValid () && mProperty_allocatedBytes.isValid () ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+cMapElement * cMapElement_gtlProfileMap::copy (void) {
+  cMapElement * result = NULL ;
+  macroMyNew (result, cMapElement_gtlProfileMap (mProperty_lkey, mProperty_count, mProperty_time, mProperty_cpu, mProperty_allocations, mProperty_allocatedBytes COMMA_HERE)) ;
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void cMapElement_gtlProfileMap::description (C_String & ioString, const int32_t inIndentation) const {
+  ioString << "\n" ;
+  ioString.writeStringMultiple ("| ", inIndentation) ;
+  ioString << "count" ":" ;
+  mProperty_count.description (ioString, inIndentation) ;
+  ioString << "\n" ;
+  ioString.writeStringMultiple ("| ", inIndentation) ;
+  ioString << "time" ":" ;
+  mProperty_time.description (ioString, inIndentation) ;
+  ioString << "\n" ;
+  ioString.writeStringMultiple ("| ", inIndentation) ;
+  ioString << "cpu" ":" ;
+  mProperty_cpu.description (ioString, inIndentation) ;
+  ioString << "\n" ;
+  ioString.writeStringMultiple ("| ", inIndentation) ;
+  ioString << "allocations" ":" ;
+  mProperty_allocations.description (ioString, inIndentation) ;
+  ioString << "\n" ;
+  ioString.writeStringMultiple ("| ", inIndentation) ;
+  ioString << "allocatedBytes" ":" ;
+  mProperty_allocatedBytes.description (ioString, inIndentation) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+typeComparisonResult cMapElement_gtlProfileMap::compare (const cCollectionElement * inOperand) const {
+  cMapElement_gtlProfileMap * operand = (cMapElement_gtlProfileMap *) inOperand ;
+  typeComparisonResult result = mProperty_lkey.objectCompare (operand->mProperty_lkey) ;
+  if (kOperandEqual == result) {
+    result = mProperty_count.objectCompare (operand->mProperty_count) ;
+  }
+  if (kOperandEqual == result) {
+    result = mProperty_time.objectCompare (operand->mProperty_time) ;
+  }
+  if (kOperandEqual == result) {
+    result = mProperty_cpu.objectCompare (operand->mProperty_cpu) ;
+  }
+  if (kOperandEqual == result) {
+    result = mProperty_allocations.objectCompare (operand->mProperty_allocations) ;
+  }
+  if (kOperandEqual == result) {
+    result = mProperty_allocatedBytes.objectCompare (operand->mProperty_allocatedBytes) ;
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_gtlProfileMap::GALGAS_gtlProfileMap (void) :
+AC_GALGAS_map (true) {
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_gtlProfileMap::GALGAS_gtlProfileMap (const GALGAS_gtlProfileMap & inSource) :
+AC_GALGAS_map (inSource) {
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_gtlProfileMap & GALGAS_gtlProfileMap::operator = (const GALGAS_gtlProfileMap & inSource) {
+  * ((AC_GALGAS_map *) this) = inSource ;
+  return * this ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_gtlProfileMap GALGAS_gtlProfileMap::constructor_emptyMap (LOCATION_ARGS) {
+  GALGAS_gtlProfileMap result ;
+  result.makeNewEmptyMap (THERE) ;
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_gtlProfileMap GALGAS_gtlProfileMap::constructor_mapWithMapToOverride (const GALGAS_gtlProfileMap & inMapToOverride
+                                                                             COMMA_LOCATION_ARGS) {
+  GALGAS_gtlProfileMap result ;
+  result.makeNewEmptyMapWithMapToOverride (inMapToOverride COMMA_THERE) ;
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_gtlProfileMap GALGAS_gtlProfileMap::getter_overriddenMap (C_Compiler * inCompiler
+                                                                 COMMA_LOCATION_ARGS) const {
+  GALGAS_gtlProfileMap result ;
+  getOverridenMap (result, inCompiler COMMA_THERE) ;
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void GALGAS_gtlProfileMap::addAssign_operation (const GALGAS_lstring & inKey,
+                                                const GALGAS_uint & inArgument0,
+                                                const GALGAS_uint & inArgument1,
+                                                const GALGAS_uint & inArgument2,
+                                                const GALGAS_uint & inArgument3,
+                                                const GALGAS_uint_36__34_ & inArgument4,
+                                                C_Compiler * inCompiler
+                                                COMMA_LOCATION_ARGS) {
+  cMapElement_gtlProfileMap * p = NULL ;
+  macroMyNew (p, cMapElement_gtlProfileMap (inKey, inArgument0, inArgument1, inArgument2, inArgument3, inArgument4 COMMA_HERE)) ;
+  capCollectionElement attributes ;
+  attributes.setPointer (p) ;
+  macroDetachSharedObject (p) ;
+  const char * kInsertErrorMessage = "@gtlProfileMap insert error: '%K' already in map" ;
+  const char * kShadowErrorMessage = "" ;
+  performInsert (attributes, inCompiler, kInsertErrorMessage, kShadowErrorMessage COMMA_THERE) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void GALGAS_gtlProfileMap::setter_put (GALGAS_lstring inKey,
+                                       GALGAS_uint inArgument0,
+                                       GALGAS_uint inArgument1,
+                                       GALGAS_uint inArgument2,
+                                       GALGAS_uint inArgument3,
+                                       GALGAS_uint_36__34_ inArgument4,
+                                       C_Compiler * inCompiler
+                                       COMMA_LOCATION_ARGS) {
+  cMapElement_gtlProfileMap * p = NULL ;
+  macroMyNew (p, cMapElement_gtlProfileMap (inKey, inArgument0, inArgument1, inArgument2, inArgument3, inArgument4 COMMA_HERE)) ;
+  capCollectionElement attributes ;
+  attributes.setPointer (p) ;
+  macroDetachSharedObject (p) ;
+  const char * kInsertErrorMessage = "the '%K' profile entry is already declared in %L" ;
+  const char * kShadowErrorMessage = "" ;
+  performInsert (attributes, inCompiler, kInsertErrorMessage, kShadowErrorMessage COMMA_THERE) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+const char * kSearchErrorMessage_gtlProfileMap_get = "there is no '%K' profile entry" ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void GALGAS_gtlProfileMap::method_get (GALGAS_lstring inKey,
+                                       GALGAS_uint & outArgument0,
+                                       GALGAS_uint & outArgument1,
+                                       GALGAS_uint & outArgument2,
+                                       GALGAS_uint & outArgument3,
+                                       GALGAS_uint_36__34_ & outArgument4,
+                                       C_Compiler * inCompiler
+                                       COMMA_LOCATION_ARGS) const {
+  const cMapElement_gtlProfileMap * p = (const cMapElement_gtlProfileMap *) performSearch (inKey,
+                                                                                           inCompiler,
+                                                                                           kSearchErrorMessage_gtlProfileMap_get
+                                                                                           COMMA_THERE) ;
+  if (NULL == p) {
+    outArgument0.drop () ;
+    outArgument1.drop () ;
+    outArgument2.drop () ;
+    outArgument3.drop () ;
+    outArgument4.drop () ;
+  }else{
+    macroValidSharedObject (p, cMapElement_gtlProfileMap) ;
+    outArgument0 = p->mProperty_count ;
+    outArgument1 = p->mProperty_time ;
+    outArgument2 = p->mProperty_cpu ;
+    outArgument3 = p->mProperty_allocations ;
+    outArgument4 = p->mProperty_allocatedBytes ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_uint GALGAS_gtlProfileMap::getter_countForKey (const GALGAS_string & inKey,
+                                                      C_Compiler * inCompiler
+                                                      COMMA_LOCATION_ARGS) const {
+  const cCollectionElement * attributes = searchForReadingAttribute (inKey, inCompiler COMMA_THERE) ;
+  const cMapElement_gtlProfileMap * p = (const cMapElement_gtlProfileMap *) attributes ;
+  GALGAS_uint result ;
+  if (NULL != p) {
+    macroValidSharedObject (p, cMapElement_gtlProfileMap) ;
+    result = p->mProperty_count ;
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_uint GALGAS_gtlProfileMap::getter_timeForKey (const GALGAS_string & inKey,
+                                                     C_Compiler * inCompiler
+                                                     COMMA_LOCATION_ARGS) const {
+  const cCollectionElement * attributes = searchForReadingAttribute (inKey, inCompiler COMMA_THERE) ;
+  const cMapElement_gtlProfileMap * p = (const cMapElement_gtlProfileMap *) attributes ;
+  GALGAS_uint result ;
+  if (NULL != p) {
+    macroValidSharedObject (p, cMapElement_gtlProfileMap) ;
+    result = p->mProperty_time ;
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_uint GALGAS_gtlProfileMap::getter_cpuForKey (const GALGAS_string & inKey,
+                                                    C_Compiler * inCompiler
+                                                    COMMA_LOCATION_ARGS) const {
+  const cCollectionElement * attributes = searchForReadingAttribute (inKey, inCompiler COMMA_THERE) ;
+  const cMapElement_gtlProfileMap * p = (const cMapElement_gtlProfileMap *) attributes ;
+  GALGAS_uint result ;
+  if (NULL != p) {
+    macroValidSharedObject (p, cMapElement_gtlProfileMap) ;
+    result = p->mProperty_cpu ;
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_uint GALGAS_gtlProfileMap::getter_allocationsForKey (const GALGAS_string & inKey,
+                                                            C_Compiler * inCompiler
+                                                            COMMA_LOCATION_ARGS) const {
+  const cCollectionElement * attributes = searchForReadingAttribute (inKey, inCompiler COMMA_THERE) ;
+  const cMapElement_gtlProfileMap * p = (const cMapElement_gtlProfileMap *) attributes ;
+  GALGAS_uint result ;
+  if (NULL != p) {
+    macroValidSharedObject (p, cMapElement_gtlProfileMap) ;
+    result = p->mProperty_allocations ;
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_uint_36__34_ GALGAS_gtlProfileMap::getter_allocatedBytesForKey (const GALGAS_string & inKey,
+                                                                       C_Compiler * inCompiler
+                                                                       COMMA_LOCATION_ARGS) const {
+  const cCollectionElement * attributes = searchForReadingAttribute (inKey, inCompiler COMMA_THERE) ;
+  const cMapElement_gtlProfileMap * p = (const cMapElement_gtlProfileMap *) attributes ;
+  GALGAS_uint_36__34_ result ;
+  if (NULL != p) {
+    macroValidSharedObject (p, cMapElement_gtlProfileMap) ;
+    result = p->mProperty_allocatedBytes ;
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void GALGAS_gtlProfileMap::setter_setCountForKey (GALGAS_uint inAttributeValue,
+                                                  GALGAS_string inKey,
+                                                  C_Compiler * inCompiler
+                                                  COMMA_LOCATION_ARGS) {
+  cCollectionElement * attributes = searchForReadWriteAttribute (inKey, true, inCompiler COMMA_THERE) ;
+  cMapElement_gtlProfileMap * p = (cMapElement_gtlProfileMap *) attributes ;
+  if (NULL != p) {
+    macroValidSharedObject (p, cMapElement_gtlProfileMap) ;
+    p->mProperty_count = inAttributeValue ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void GALGAS_gtlProfileMap::setter_setTimeForKey (GALGAS_uint inAttributeValue,
+                                                 GALGAS_string inKey,
+                                                 C_Compiler * inCompiler
+                                                 COMMA_LOCATION_ARGS) {
+  cCollectionElement * attributes = searchForReadWriteAttribute (inKey, true, inCompiler COMMA_THERE) ;
+  cMapElement_gtlProfileMap * p = (cMapElement_gtlProfileMap *) attributes ;
+  if (NULL != p) {
+    macroValidSharedObject (p, cMapElement_gtlProfileMap) ;
+    p->mProperty_time = inAttributeValue ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void GALGAS_gtlProfileMap::setter_setCpuForKey (GALGAS_uint inAttributeValue,
+                                                GALGAS_string inKey,
+                                                C_Compiler * inCompiler
+                                                COMMA_LOCATION_ARGS) {
+  cCollectionElement * attributes = searchForReadWriteAttribute (inKey, true, inCompiler COMMA_THERE) ;
+  cMapElement_gtlProfileMap * p = (cMapElement_gtlProfileMap *) attributes ;
+  if (NULL != p) {
+    macroValidSharedObject (p, cMapElement_gtlProfileMap) ;
+    p->mProperty_cpu = inAttributeValue ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void GALGAS_gtlProfileMap::setter_setAllocationsForKey (GALGAS_uint inAttributeValue,
+                                                        GALGAS_string inKey,
+                                                        C_Compiler * inCompiler
+                                                        COMMA_LOCATION_ARGS) {
+  cCollectionElement * attributes = searchForReadWriteAttribute (inKey, true, inCompiler COMMA_THERE) ;
+  cMapElement_gtlProfileMap * p = (cMapElement_gtlProfileMap *) attributes ;
+  if (NULL != p) {
+    macroValidSharedObject (p, cMapElement_gtlProfileMap) ;
+    p->mProperty_allocations = inAttributeValue ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void GALGAS_gtlProfileMap::setter_setAllocatedBytesForKey (GALGAS_uint_36__34_ inAttributeValue,
+                                                           GALGAS_string inKey,
+                                                           C_Compiler * inCompiler
+                                                           COMMA_LOCATION_ARGS) {
+  cCollectionElement * attributes = searchForReadWriteAttribute (inKey, true, inCompiler COMMA_THERE) ;
+  cMapElement_gtlProfileMap * p = (cMapElement_gtlProfileMap *) attributes ;
+  if (NULL != p) {
+    macroValidSharedObject (p, cMapElement_gtlProfileMap) ;
+    p->mProperty_allocatedBytes = inAttributeValue ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+cMapElement_gtlProfileMap * GALGAS_gtlProfileMap::readWriteAccessForWithInstruction (C_Compiler * inCompiler,
+                                                                                     const GALGAS_string & inKey
+                                                                                     COMMA_LOCATION_ARGS) {
+  cMapElement_gtlProfileMap * result = (cMapElement_gtlProfileMap *) searchForReadWriteAttribute (inKey, false, inCompiler COMMA_THERE) ;
+  macroNullOrValidSharedObject (result, cMapElement_gtlProfileMap) ;
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+cEnumerator_gtlProfileMap::cEnumerator_gtlProfileMap (const GALGAS_gtlProfileMap & inEnumeratedObject,
+                                                      const typeEnumerationOrder inOrder) :
+cGenericAbstractEnumerator (inOrder) {
+  inEnumeratedObject.populateEnumerationArray (mEnumerationArray) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_gtlProfileMap_2D_element cEnumerator_gtlProfileMap::current (LOCATION_ARGS) const {
+  const cMapElement_gtlProfileMap * p = (const cMapElement_gtlProfileMap *) currentObjectPtr (THERE) ;
+  macroValidSharedObject (p, cMapElement_gtlProfileMap) ;
+  return GALGAS_gtlProfileMap_2D_element (p->mProperty_lkey, p->mProperty_count, p->mProperty_time, p->mProperty_cpu, p->mProperty_allocations, p->mProperty_allocatedBytes) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_lstring cEnumerator_gtlProfileMap::current_lkey (LOCATION_ARGS) const {
+  const cMapElement * p = (const cMapElement *) currentObjectPtr (THERE) ;
+  macroValidSharedObject (p, cMapElement) ;
+  return p->mProperty_lkey ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_uint cEnumerator_gtlProfileMap::current_count (LOCATION_ARGS) const {
+  const cMapElement_gtlProfileMap * p = (const cMapElement_gtlProfileMap *) currentObjectPtr (THERE) ;
+  macroValidSharedObject (p, cMapElement_gtlProfileMap) ;
+  return p->mProperty_count ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_uint cEnumerator_gtlProfileMap::current_time (LOCATION_ARGS) const {
+  const cMapElement_gtlProfileMap * p = (const cMapElement_gtlProfileMap *) currentObjectPtr (THERE) ;
+  macroValidSharedObject (p, cMapElement_gtlProfileMap) ;
+  return p->mProperty_time ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_uint cEnumerator_gtlProfileMap::current_cpu (LOCATION_ARGS) const {
+  const cMapElement_gtlProfileMap * p = (const cMapElement_gtlProfileMap *) currentObjectPtr (THERE) ;
+  macroValidSharedObject (p, cMapElement_gtlProfileMap) ;
+  return p->mProperty_cpu ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_uint cEnumerator_gtlProfileMap::current_allocations (LOCATION_ARGS) const {
+  const cMapElement_gtlProfileMap * p = (const cMapElement_gtlProfileMap *) currentObjectPtr (THERE) ;
+  macroValidSharedObject (p, cMapElement_gtlProfileMap) ;
+  return p->mProperty_allocations ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_uint_36__34_ cEnumerator_gtlProfileMap::current_allocatedBytes (LOCATION_ARGS) const {
+  const cMapElement_gtlProfileMap * p = (const cMapElement_gtlProfileMap *) currentObjectPtr (THERE) ;
+  macroValidSharedObject (p, cMapElement_gtlProfileMap) ;
+  return p->mProperty_allocatedBytes ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+bool GALGAS_gtlProfileMap::optional_searchKey (const GALGAS_string & inKey,
+                                               GALGAS_uint & outArgument0,
+                                               GALGAS_uint & outArgument1,
+                                               GALGAS_uint & outArgument2,
+                                               GALGAS_uint & outArgument3,
+                                               GALGAS_uint_36__34_ & outArgument4) const {
+  const cMapElement_gtlProfileMap * p = (const cMapElement_gtlProfileMap *) searchForKey (inKey) ;
+  const bool result = NULL != p ;
+  if (result) {
+    macroValidSharedObject (p, cMapElement_gtlProfileMap) ;
+    outArgument0 = p->mProperty_count ;
+    outArgument1 = p->mProperty_time ;
+    outArgument2 = p->mProperty_cpu ;
+    outArgument3 = p->mProperty_allocations ;
+    outArgument4 = p->mProperty_allocatedBytes ;
+  }else{
+    outArgument0.drop () ;
+    outArgument1.drop () ;
+    outArgument2.drop () ;
+    outArgument3.drop () ;
+    outArgument4.drop () ;
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//@gtlProfileMap type
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+const C_galgas_type_descriptor
+kTypeDescriptor_GALGAS_gtlProfileMap ("gtlProfileMap",
+                                      NULL) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+const C_galgas_type_descriptor * GALGAS_gtlProfileMap::staticTypeDescriptor (void) const {
+  return & kTypeDescriptor_GALGAS_gtlProfileMap ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+AC_GALGAS_root * GALGAS_gtlProfileMap::clonedObject (void) const {
+  AC_GALGAS_root * result = NULL ;
+  if (isValid ()) {
+    macroMyNew (result, GALGAS_gtlProfileMap (*this)) ;
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_gtlProfileMap GALGAS_gtlProfileMap::extractObject (const GALGAS_object & inObject,
+                                                          C_Compiler * inCompiler
+                                                          COMMA_LOCATION_ARGS) {
+  GALGAS_gtlProfileMap result ;
+  const GALGAS_gtlProfileMap * p = (const GALGAS_gtlProfileMap *) inObject.embeddedObject () ;
+  if (NULL != p) {
+    if (NULL != dynamic_cast <const GALGAS_gtlProfileMap *> (p)) {
+      result = *p ;
+    }else{
+      inCompiler->castError ("gtlProfileMap", p->dynamicTypeDescriptor () COMMA_THERE) ;
+    }  
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Extension method '@gtlProfileMap addCosts'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+void extensionSetter_addCosts (GALGAS_gtlProfileMap & ioObject,
+                               const GALGAS_string constinArgument_key,
+                               const GALGAS_uint constinArgument_count,
+                               const GALGAS_uint constinArgument_time,
+                               const GALGAS_uint constinArgument_cpu,
+                               const GALGAS_uint constinArgument_allocations,
+                               const GALGAS_uint_36__34_ constinArgument_allocatedBytes,
+                               C_Compiler * inCompiler
+                               COMMA_UNUSED_LOCATION_ARGS) {
+  enumGalgasBool test_0 = kBoolTrue ;
+  if (kBoolTrue == test_0) {
+    const GALGAS_gtlProfileMap temp_1 = ioObject ;
+    test_0 = temp_1.getter_hasKey (constinArgument_key COMMA_SOURCE_FILE ("gtl_types.galgas", 511)).boolEnum () ;
+    if (kBoolTrue == test_0) {
+      {
+      const GALGAS_gtlProfileMap temp_2 = ioObject ;
+      ioObject.setter_setCountForKey (temp_2.getter_countForKey (constinArgument_key, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 512)).add_operation (constinArgument_count, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 512)), constinArgument_key, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 512)) ;
+      }
+      {
+      const GALGAS_gtlProfileMap temp_3 = ioObject ;
+      ioObject.setter_setTimeForKey (temp_3.getter_timeForKey (constinArgument_key, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 513)).add_operation (constinArgument_time, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 513)), constinArgument_key, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 513)) ;
+      }
+      {
+      const GALGAS_gtlProfileMap temp_4 = ioObject ;
+      ioObject.setter_setCpuForKey (temp_4.getter_cpuForKey (constinArgument_key, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 514)).add_operation (constinArgument_cpu, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 514)), constinArgument_key, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 514)) ;
+      }
+      {
+      const GALGAS_gtlProfileMap temp_5 = ioObject ;
+      ioObject.setter_setAllocationsForKey (temp_5.getter_allocationsForKey (constinArgument_key, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 515)).add_operation (constinArgument_allocations, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 515)), constinArgument_key, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 515)) ;
+      }
+      {
+      const GALGAS_gtlProfileMap temp_6 = ioObject ;
+      ioObject.setter_setAllocatedBytesForKey (temp_6.getter_allocatedBytesForKey (constinArgument_key, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 517)).add_operation (constinArgument_allocatedBytes, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 517)), constinArgument_key, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 516)) ;
+      }
+    }
+  }
+  if (kBoolFalse == test_0) {
+    {
+    ioObject.setter_put (GALGAS_lstring::constructor_new (constinArgument_key, GALGAS_location::constructor_nowhere (SOURCE_FILE ("gtl_types.galgas", 521))  COMMA_SOURCE_FILE ("gtl_types.galgas", 521)), constinArgument_count, constinArgument_time, constinArgument_cpu, constinArgument_allocations, constinArgument_allocatedBytes, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 521)) ;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Extension method '@gtlProfileMap addSample'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+void extensionSetter_addSample (GALGAS_gtlProfileMap & ioObject,
+                                const GALGAS_string constinArgument_key,
+                                const GALGAS_timer constinArgument_timer,
+                                C_Compiler * inCompiler
+                                COMMA_UNUSED_LOCATION_ARGS) {
+  {
+  extensionSetter_addCosts (ioObject, constinArgument_key, GALGAS_uint ((uint32_t) 1U), constinArgument_timer.getter_msFromStart (SOURCE_FILE ("gtl_types.galgas", 532)), constinArgument_timer.getter_cpuUsFromStart (SOURCE_FILE ("gtl_types.galgas", 533)), constinArgument_timer.getter_allocationsFromStart (SOURCE_FILE ("gtl_types.galgas", 534)), constinArgument_timer.getter_allocatedBytesFromStart (SOURCE_FILE ("gtl_types.galgas", 535)), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 529)) ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_gtlProfileMap_2D_element::GALGAS_gtlProfileMap_2D_element (void) :
+mProperty_lkey (),
+mProperty_count (),
+mProperty_time (),
+mProperty_cpu (),
+mProperty_allocations (),
+mProperty_allocatedBytes () {
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_gtlProfileMap_2D_element::~ GALGAS_gtlProfileMap_2D_element (void) {
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_gtlProfileMap_2D_element::GALGAS_gtlProfileMap_2D_element (const GALGAS_lstring & inOperand0,
+                                                                  const GALGAS_uint & inOperand1,
+                                                                  const GALGAS_uint & inOperand2,
+                                                                  const GALGAS_uint & inOperand3,
+                                                                  const GALGAS_uint & inOperand4,
+                                                                  const GALGAS_uint_36__34_ & inOperand5) :
+mProperty_lkey (inOperand0),
+mProperty_count (inOperand1),
+mProperty_time (inOperand2),
+mProperty_cpu (inOperand3),
+mProperty_allocations (inOperand4),
+mProperty_allocatedBytes (inOperand5) {
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_gtlProfileMap_2D_element GALGAS_gtlProfileMap_2D_element::constructor_default (UNUSED_LOCATION_ARGS) {
+  return GALGAS_gtlProfileMap_2D_element (GALGAS_lstring::constructor_default (HERE),
+                                          GALGAS_uint::constructor_default (HERE),
+                                          GALGAS_uint::constructor_default (HERE),
+                                          GALGAS_uint::constructor_default (HERE),
+                                          GALGAS_uint::constructor_default (HERE),
+                                          GALGAS_uint_36__34_::constructor_default (HERE)) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_gtlProfileMap_2D_element GALGAS_gtlProfileMap_2D_element::constructor_new (const GALGAS_lstring & inOperand0,
+                                                                                  const GALGAS_uint & inOperand1,
+                                                                                  const GALGAS_uint & inOperand2,
+                                                                                  const GALGAS_uint & inOperand3,
+                                                                                  const GALGAS_uint & inOperand4,
+                                                                                  const GALGAS_uint_36__34_ & inOperand5 
+                                                                                  COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_gtlProfileMap_2D_element result ;
+  if (inOperand0.isValid () && inOperand1.isValid () && inOperand2.isValid () && inOperand3.isValid () && inOperand4.isValid () && inOperand5.isValid ()) {
+    result = GALGAS_gtlProfileMap_2D_element (inOperand0, inOperand1, inOperand2, inOperand3, inOperand4, inOperand5) ;
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+typeComparisonResult GALGAS_gtlProfileMap_2D_element::objectCompare (const GALGAS_gtlProfileMap_2D_element & inOperand) const {
+   typeComparisonResult result = kOperandEqual ;
+  if (result == kOperandEqual) {
+    result = mProperty_lkey.objectCompare (inOperand.mProperty_lkey) ;
+  }
+  if (result == kOperandEqual) {
+    result = mProperty_count.objectCompare (inOperand.mProperty_count) ;
+  }
+  if (result == kOperandEqual) {
+    result = mProperty_time.objectCompare (inOperand.mProperty_time) ;
+  }
+  if (result == kOperandEqual) {
+    result = mProperty_cpu.objectCompare (inOperand.mProperty_cpu) ;
+  }
+  if (result == kOperandEqual) {
+    result = mProperty_allocations.objectCompare (inOperand.mProperty_allocations) ;
+  }
+  if (result == kOperandEqual) {
+    result = mProperty_allocatedBytes.objectCompare (inOperand.mProperty_allocatedBytes) ;
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+bool GALGAS_gtlProfileMap_2D_element::isValid (void) const {
+  return mProperty_lkey.isValid () && mProperty_count.isValid () && mProperty_time.isValid () && mProperty_cpu.isValid () && mProperty_allocations.isValid () && mProperty_allocatedBytes.isValid () ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void GALGAS_gtlProfileMap_2D_element::drop (void) {
+  mProperty_lkey.drop () ;
+  mProperty_count.drop () ;
+  mProperty_time.drop () ;
+  mProperty_cpu.drop () ;
+  mProperty_allocations.drop () ;
+  mProperty_allocatedBytes.drop () ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void GALGAS_gtlProfileMap_2D_element::description (C_String & ioString,
+                                                   const int32_t inIndentation) const {
+  ioString << "<struct @gtlProfileMap-element:" ;
+  if (! isValid ()) {
+    ioString << " not built" ;
+  }else{
+    mProperty_lkey.description (ioString, inIndentation+1) ;
+    ioString << ", " ;
+    mProperty_count.description (ioString, inIndentation+1) ;
+    ioString << ", " ;
+    mProperty_time.description (ioString, inIndentation+1) ;
+    ioString << ", " ;
+    mProperty_cpu.description (ioString, inIndentation+1) ;
+    ioString << ", " ;
+    mProperty_allocations.description (ioString, inIndentation+1) ;
+    ioString << ", " ;
+    mProperty_allocatedBytes.description (ioString, inIndentation+1) ;
+  }
+  ioString << ">" ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_lstring GALGAS_gtlProfileMap_2D_element::getter_lkey (UNUSED_LOCATION_ARGS) const {
+  return mProperty_lkey ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_uint GALGAS_gtlProfileMap_2D_element::getter_count (UNUSED_LOCATION_ARGS) const {
+  return mProperty_count ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_uint GALGAS_gtlProfileMap_2D_element::getter_time (UNUSED_LOCATION_ARGS) const {
+  return mProperty_time ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_uint GALGAS_gtlProfileMap_2D_element::getter_cpu (UNUSED_LOCATION_ARGS) const {
+  return mProperty_cpu ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_uint GALGAS_gtlProfileMap_2D_element::getter_allocations (UNUSED_LOCATION_ARGS) const {
+  return mProperty_allocations ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_uint_36__34_ GALGAS_gtlProfileMap_2D_element::getter_allocatedBytes (UNUSED_LOCATION_ARGS) const {
+  return mProperty_allocatedBytes ;
+}
+
+
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//@gtlProfileMap-element type
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+const C_galgas_type_descriptor
+kTypeDescriptor_GALGAS_gtlProfileMap_2D_element ("gtlProfileMap-element",
+                                                 NULL) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+const C_galgas_type_descriptor * GALGAS_gtlProfileMap_2D_element::staticTypeDescriptor (void) const {
+  return & kTypeDescriptor_GALGAS_gtlProfileMap_2D_element ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+AC_GALGAS_root * GALGAS_gtlProfileMap_2D_element::clonedObject (void) const {
+  AC_GALGAS_root * result = NULL ;
+  if (isValid ()) {
+    macroMyNew (result, GALGAS_gtlProfileMap_2D_element (*this)) ;
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_gtlProfileMap_2D_element GALGAS_gtlProfileMap_2D_element::extractObject (const GALGAS_object & inObject,
+                                                                                C_Compiler * inCompiler
+                                                                                COMMA_LOCATION_ARGS) {
+  GALGAS_gtlProfileMap_2D_element result ;
+  const GALGAS_gtlProfileMap_2D_element * p = (const GALGAS_gtlProfileMap_2D_element *) inObject.embeddedObject () ;
+  if (NULL != p) {
+    if (NULL != dynamic_cast <const GALGAS_gtlProfileMap_2D_element *> (p)) {
+      result = *p ;
+    }else{
+      inCompiler->castError ("gtlProfileMap-element", p->dynamicTypeDescriptor () COMMA_THERE) ;
+    }  
+  }
+  return result ;
+}
+
+
 //----------------------------------------------------------------------------------------------------------------------
 
 cMapElement_gtlFuncMap::cMapElement_gtlFuncMap (const GALGAS_lstring & inKey,
@@ -3629,13 +4387,19 @@ GALGAS_gtlData extensionGetter_get (const GALGAS_gtlVarPath & inObject,
     if (kBoolTrue == test_0) {
       const GALGAS_gtlVarPath temp_2 = inObject ;
       GALGAS_gtlVarItem var_item_23830 = temp_2.getter_itemAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 823)) ;
+      if (var_item_23830.isValid ()) {
+        if (NULL != dynamic_cast <const cPtr_gtlVarItemField *> (var_item_23830.ptr ())) {
+          GALGAS_gtlVarItemField cast_23900_itemField ((cPtr_gtlVarItemField *) var_item_23830.ptr ()) ;
+          GALGAS_application::class_method_addOutputVariableDependency (cast_23900_itemField.getter_field (SOURCE_FILE ("gtl_expressions.galgas", 825)).getter_string (SOURCE_FILE ("gtl_expressions.galgas", 825))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 825)) ;
+        }
+      }
       const GALGAS_gtlVarPath temp_3 = inObject ;
-      result_variableValue = callExtensionGetter_getInContext ((const cPtr_gtlVarItem *) var_item_23830.ptr (), constinArgument_exeContext, constinArgument_context, constinArgument_context, constinArgument_lib, temp_3.getter_subListFromIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 824)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 824)) ;
+      result_variableValue = callExtensionGetter_getInContext ((const cPtr_gtlVarItem *) var_item_23830.ptr (), constinArgument_exeContext, constinArgument_context, constinArgument_context, constinArgument_lib, temp_3.getter_subListFromIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 828)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 828)) ;
     }
   }
   if (kBoolFalse == test_0) {
     TC_Array <C_FixItDescription> fixItArray4 ;
-    inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 826)), GALGAS_string ("INTERNAL ERROR. A @gtlVarPath should not be an empty list"), fixItArray4  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 826)) ;
+    inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 830)), GALGAS_string ("INTERNAL ERROR. A @gtlVarPath should not be an empty list"), fixItArray4  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 830)) ;
     result_variableValue.drop () ; // Release error dropped variable
   }
 //---
@@ -3661,17 +4425,23 @@ GALGAS_bool extensionGetter_exists (const GALGAS_gtlVarPath & inObject,
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
     const GALGAS_gtlVarPath temp_1 = inObject ;
-    test_0 = GALGAS_bool (kIsStrictSup, temp_1.getter_length (SOURCE_FILE ("gtl_expressions.galgas", 840)).objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
+    test_0 = GALGAS_bool (kIsStrictSup, temp_1.getter_length (SOURCE_FILE ("gtl_expressions.galgas", 844)).objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
     if (kBoolTrue == test_0) {
       const GALGAS_gtlVarPath temp_2 = inObject ;
-      GALGAS_gtlVarItem var_item_24437 = temp_2.getter_itemAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 841)) ;
+      GALGAS_gtlVarItem var_item_24437 = temp_2.getter_itemAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 845)) ;
+      if (var_item_24437.isValid ()) {
+        if (NULL != dynamic_cast <const cPtr_gtlVarItemField *> (var_item_24437.ptr ())) {
+          GALGAS_gtlVarItemField cast_24507_itemField ((cPtr_gtlVarItemField *) var_item_24437.ptr ()) ;
+          GALGAS_application::class_method_addOutputVariableDependency (cast_24507_itemField.getter_field (SOURCE_FILE ("gtl_expressions.galgas", 847)).getter_string (SOURCE_FILE ("gtl_expressions.galgas", 847))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 847)) ;
+        }
+      }
       const GALGAS_gtlVarPath temp_3 = inObject ;
-      result_result = callExtensionGetter_existsInContext ((const cPtr_gtlVarItem *) var_item_24437.ptr (), constinArgument_exeContext, constinArgument_context, constinArgument_context, constinArgument_lib, temp_3.getter_subListFromIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 842)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 842)) ;
+      result_result = callExtensionGetter_existsInContext ((const cPtr_gtlVarItem *) var_item_24437.ptr (), constinArgument_exeContext, constinArgument_context, constinArgument_context, constinArgument_lib, temp_3.getter_subListFromIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 850)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 850)) ;
     }
   }
   if (kBoolFalse == test_0) {
     TC_Array <C_FixItDescription> fixItArray4 ;
-    inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 844)), GALGAS_string ("INTERNAL ERROR. A @gtlVarPath should not be an empty list"), fixItArray4  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 844)) ;
+    inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 852)), GALGAS_string ("INTERNAL ERROR. A @gtlVarPath should not be an empty list"), fixItArray4  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 852)) ;
     result_result.drop () ; // Release error dropped variable
   }
 //---
@@ -3696,17 +4466,17 @@ void extensionMethod_delete (const GALGAS_gtlVarPath inObject,
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
     const GALGAS_gtlVarPath temp_1 = inObject ;
-    test_0 = GALGAS_bool (kIsStrictSup, temp_1.getter_length (SOURCE_FILE ("gtl_expressions.galgas", 857)).objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
+    test_0 = GALGAS_bool (kIsStrictSup, temp_1.getter_length (SOURCE_FILE ("gtl_expressions.galgas", 865)).objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
     if (kBoolTrue == test_0) {
       const GALGAS_gtlVarPath temp_2 = inObject ;
-      GALGAS_gtlVarItem var_item_25005 = temp_2.getter_itemAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 858)) ;
+      GALGAS_gtlVarItem var_item_25005 = temp_2.getter_itemAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 866)) ;
       const GALGAS_gtlVarPath temp_3 = inObject ;
-      callExtensionMethod_deleteInContext ((const cPtr_gtlVarItem *) var_item_25005.ptr (), constinArgument_exeContext, ioArgument_vars, ioArgument_vars, constinArgument_lib, temp_3.getter_subListFromIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 864)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 859)) ;
+      callExtensionMethod_deleteInContext ((const cPtr_gtlVarItem *) var_item_25005.ptr (), constinArgument_exeContext, ioArgument_vars, ioArgument_vars, constinArgument_lib, temp_3.getter_subListFromIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 872)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 867)) ;
     }
   }
   if (kBoolFalse == test_0) {
     TC_Array <C_FixItDescription> fixItArray4 ;
-    inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 867)), GALGAS_string ("INTERNAL ERROR. A @gtlVarPath should not be an empty list"), fixItArray4  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 867)) ;
+    inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 875)), GALGAS_string ("INTERNAL ERROR. A @gtlVarPath should not be an empty list"), fixItArray4  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 875)) ;
   }
 }
 
@@ -3723,8 +4493,8 @@ GALGAS_location extensionGetter_location (const GALGAS_gtlVarPath & inObject,
   GALGAS_location result_where ; // Returned variable
   GALGAS_gtlVarItem var_lastOne_25547 ;
   const GALGAS_gtlVarPath temp_0 = inObject ;
-  temp_0.method_last (var_lastOne_25547, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 876)) ;
-  result_where = callExtensionGetter_location ((const cPtr_gtlVarItem *) var_lastOne_25547.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 877)) ;
+  temp_0.method_last (var_lastOne_25547, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 884)) ;
+  result_where = callExtensionGetter_location ((const cPtr_gtlVarItem *) var_lastOne_25547.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 885)) ;
 //---
   return result_where ;
 }
@@ -9633,14 +10403,14 @@ void cParser_gtl_5F_expression_5F_parser::rule_gtl_5F_expression_5F_parser_gtl_5
       GALGAS_location var_opLocation_1099 = GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 39)) ;
       GALGAS_gtlExpression var_rightSon_1156 ;
       nt_gtl_5F_relation_5F_term_ (var_rightSon_1156, inCompiler) ;
-      outArgument_expression = GALGAS_gtlOrExpression::constructor_new (var_opLocation_1099, outArgument_expression, var_rightSon_1156  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 41)) ;
+      outArgument_expression = function_foldConstants (GALGAS_gtlOrExpression::constructor_new (var_opLocation_1099, outArgument_expression, var_rightSon_1156  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 41)), inCompiler COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 41)) ;
     } break ;
     case 3: {
       inCompiler->acceptTerminal (C_Lexique_gtl_5F_scanner::kToken__5E_ COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 43)) ;
       GALGAS_location var_opLocation_1269 = GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 43)) ;
       GALGAS_gtlExpression var_rightSon_1326 ;
       nt_gtl_5F_relation_5F_term_ (var_rightSon_1326, inCompiler) ;
-      outArgument_expression = GALGAS_gtlXorExpression::constructor_new (var_opLocation_1269, outArgument_expression, var_rightSon_1326  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 45)) ;
+      outArgument_expression = function_foldConstants (GALGAS_gtlXorExpression::constructor_new (var_opLocation_1269, outArgument_expression, var_rightSon_1326  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 45)), inCompiler COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 45)) ;
     } break ;
     default:
       repeatFlag_0 = false ;
@@ -9686,7 +10456,7 @@ void cParser_gtl_5F_expression_5F_parser::rule_gtl_5F_expression_5F_parser_gtl_5
       GALGAS_location var_opLocation_1794 = GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 59)) ;
       GALGAS_gtlExpression var_rightSon_1853 ;
       nt_gtl_5F_relation_5F_factor_ (var_rightSon_1853, inCompiler) ;
-      outArgument_expression = GALGAS_gtlAndExpression::constructor_new (var_opLocation_1794, outArgument_expression, var_rightSon_1853  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 61)) ;
+      outArgument_expression = function_foldConstants (GALGAS_gtlAndExpression::constructor_new (var_opLocation_1794, outArgument_expression, var_rightSon_1853  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 61)), inCompiler COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 61)) ;
     } break ;
     default:
       repeatFlag_0 = false ;
@@ -9728,42 +10498,42 @@ void cParser_gtl_5F_expression_5F_parser::rule_gtl_5F_expression_5F_parser_gtl_5
     GALGAS_location var_opLocation_2323 = GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 75)) ;
     GALGAS_gtlExpression var_rightSon_2384 ;
     nt_gtl_5F_simple_5F_expression_ (var_rightSon_2384, inCompiler) ;
-    outArgument_expression = GALGAS_gtlEqualExpression::constructor_new (var_opLocation_2323, outArgument_expression, var_rightSon_2384  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 77)) ;
+    outArgument_expression = function_foldConstants (GALGAS_gtlEqualExpression::constructor_new (var_opLocation_2323, outArgument_expression, var_rightSon_2384  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 77)), inCompiler COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 77)) ;
   } break ;
   case 3: {
     inCompiler->acceptTerminal (C_Lexique_gtl_5F_scanner::kToken__21__3D_ COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 81)) ;
     GALGAS_location var_opLocation_2508 = GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 81)) ;
     GALGAS_gtlExpression var_rightSon_2569 ;
     nt_gtl_5F_simple_5F_expression_ (var_rightSon_2569, inCompiler) ;
-    outArgument_expression = GALGAS_gtlNotEqualExpression::constructor_new (var_opLocation_2508, outArgument_expression, var_rightSon_2569  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 83)) ;
+    outArgument_expression = function_foldConstants (GALGAS_gtlNotEqualExpression::constructor_new (var_opLocation_2508, outArgument_expression, var_rightSon_2569  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 83)), inCompiler COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 83)) ;
   } break ;
   case 4: {
     inCompiler->acceptTerminal (C_Lexique_gtl_5F_scanner::kToken__3C__3D_ COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 87)) ;
     GALGAS_location var_opLocation_2696 = GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 87)) ;
     GALGAS_gtlExpression var_rightSon_2757 ;
     nt_gtl_5F_simple_5F_expression_ (var_rightSon_2757, inCompiler) ;
-    outArgument_expression = GALGAS_gtlLowerOrEqualExpression::constructor_new (var_opLocation_2696, outArgument_expression, var_rightSon_2757  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 89)) ;
+    outArgument_expression = function_foldConstants (GALGAS_gtlLowerOrEqualExpression::constructor_new (var_opLocation_2696, outArgument_expression, var_rightSon_2757  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 89)), inCompiler COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 89)) ;
   } break ;
   case 5: {
     inCompiler->acceptTerminal (C_Lexique_gtl_5F_scanner::kToken__3E__3D_ COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 93)) ;
     GALGAS_location var_opLocation_2888 = GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 93)) ;
     GALGAS_gtlExpression var_rightSon_2949 ;
     nt_gtl_5F_simple_5F_expression_ (var_rightSon_2949, inCompiler) ;
-    outArgument_expression = GALGAS_gtlGreaterOrEqualExpression::constructor_new (var_opLocation_2888, outArgument_expression, var_rightSon_2949  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 95)) ;
+    outArgument_expression = function_foldConstants (GALGAS_gtlGreaterOrEqualExpression::constructor_new (var_opLocation_2888, outArgument_expression, var_rightSon_2949  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 95)), inCompiler COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 95)) ;
   } break ;
   case 6: {
     inCompiler->acceptTerminal (C_Lexique_gtl_5F_scanner::kToken__3E_ COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 99)) ;
     GALGAS_location var_opLocation_3081 = GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 99)) ;
     GALGAS_gtlExpression var_rightSon_3142 ;
     nt_gtl_5F_simple_5F_expression_ (var_rightSon_3142, inCompiler) ;
-    outArgument_expression = GALGAS_gtlGreaterThanExpression::constructor_new (var_opLocation_3081, outArgument_expression, var_rightSon_3142  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 101)) ;
+    outArgument_expression = function_foldConstants (GALGAS_gtlGreaterThanExpression::constructor_new (var_opLocation_3081, outArgument_expression, var_rightSon_3142  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 101)), inCompiler COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 101)) ;
   } break ;
   case 7: {
     inCompiler->acceptTerminal (C_Lexique_gtl_5F_scanner::kToken__3C_ COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 105)) ;
     GALGAS_location var_opLocation_3271 = GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 105)) ;
     GALGAS_gtlExpression var_rightSon_3332 ;
     nt_gtl_5F_simple_5F_expression_ (var_rightSon_3332, inCompiler) ;
-    outArgument_expression = GALGAS_gtlLowerThanExpression::constructor_new (var_opLocation_3271, outArgument_expression, var_rightSon_3332  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 107)) ;
+    outArgument_expression = function_foldConstants (GALGAS_gtlLowerThanExpression::constructor_new (var_opLocation_3271, outArgument_expression, var_rightSon_3332  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 107)), inCompiler COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 107)) ;
   } break ;
   default:
     break ;
@@ -9835,7 +10605,7 @@ void cParser_gtl_5F_expression_5F_parser::rule_gtl_5F_expression_5F_parser_gtl_5
       GALGAS_location var_opLocation_4171 = GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 135)) ;
       GALGAS_gtlExpression var_rightSon_4219 ;
       nt_gtl_5F_term_ (var_rightSon_4219, inCompiler) ;
-      outArgument_expression = GALGAS_gtlAddExpression::constructor_new (var_opLocation_4171, outArgument_expression, var_rightSon_4219  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 137)) ;
+      outArgument_expression = function_foldConstants (GALGAS_gtlAddExpression::constructor_new (var_opLocation_4171, outArgument_expression, var_rightSon_4219  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 137)), inCompiler COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 137)) ;
     } break ;
     case 5: {
       inCompiler->acceptTerminal (C_Lexique_gtl_5F_scanner::kToken__2E_ COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 141)) ;
@@ -9851,14 +10621,14 @@ void cParser_gtl_5F_expression_5F_parser::rule_gtl_5F_expression_5F_parser_gtl_5
       }
       GALGAS_gtlExpression var_rightSon_4532 ;
       nt_gtl_5F_term_ (var_rightSon_4532, inCompiler) ;
-      outArgument_expression = GALGAS_gtlAddExpression::constructor_new (var_opLocation_4344, outArgument_expression, var_rightSon_4532  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 146)) ;
+      outArgument_expression = function_foldConstants (GALGAS_gtlAddExpression::constructor_new (var_opLocation_4344, outArgument_expression, var_rightSon_4532  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 146)), inCompiler COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 146)) ;
     } break ;
     case 6: {
       inCompiler->acceptTerminal (C_Lexique_gtl_5F_scanner::kToken__2D_ COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 150)) ;
       GALGAS_location var_opLocation_4657 = GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 150)) ;
       GALGAS_gtlExpression var_rightSon_4705 ;
       nt_gtl_5F_term_ (var_rightSon_4705, inCompiler) ;
-      outArgument_expression = GALGAS_gtlSubstractExpression::constructor_new (var_opLocation_4657, outArgument_expression, var_rightSon_4705  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 152)) ;
+      outArgument_expression = function_foldConstants (GALGAS_gtlSubstractExpression::constructor_new (var_opLocation_4657, outArgument_expression, var_rightSon_4705  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 152)), inCompiler COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 152)) ;
     } break ;
     default:
       repeatFlag_0 = false ;
@@ -9916,7 +10686,7 @@ void cParser_gtl_5F_expression_5F_parser::rule_gtl_5F_expression_5F_parser_gtl_5
       GALGAS_location var_opLocation_5172 = GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 168)) ;
       GALGAS_gtlExpression var_rightSon_5222 ;
       nt_gtl_5F_factor_ (var_rightSon_5222, inCompiler) ;
-      outArgument_expression = GALGAS_gtlMultiplyExpression::constructor_new (var_opLocation_5172, outArgument_expression, var_rightSon_5222  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 170)) ;
+      outArgument_expression = function_foldConstants (GALGAS_gtlMultiplyExpression::constructor_new (var_opLocation_5172, outArgument_expression, var_rightSon_5222  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 170)), inCompiler COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 170)) ;
     } break ;
     case 3: {
       inCompiler->acceptTerminal (C_Lexique_gtl_5F_scanner::kToken__2F_ COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 174)) ;
@@ -9975,7 +10745,7 @@ void cParser_gtl_5F_expression_5F_parser::rule_gtl_5F_expression_5F_parser_gtl_5
   GALGAS_location var_opLocation_6002 = GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 195)) ;
   GALGAS_gtlExpression var_factorExpression_6062 ;
   nt_gtl_5F_expression_ (var_factorExpression_6062, inCompiler) ;
-  outArgument_expression = GALGAS_gtlParenthesizedExpression::constructor_new (var_opLocation_6002, var_factorExpression_6062  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 197)) ;
+  outArgument_expression = function_foldConstants (GALGAS_gtlParenthesizedExpression::constructor_new (var_opLocation_6002, var_factorExpression_6062  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 197)), inCompiler COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 197)) ;
   inCompiler->acceptTerminal (C_Lexique_gtl_5F_scanner::kToken__29_ COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 201)) ;
 }
 
@@ -9997,7 +10767,7 @@ void cParser_gtl_5F_expression_5F_parser::rule_gtl_5F_expression_5F_parser_gtl_5
   GALGAS_location var_opLocation_6484 = GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 211)) ;
   GALGAS_gtlExpression var_notExpression_6537 ;
   nt_gtl_5F_factor_ (var_notExpression_6537, inCompiler) ;
-  outArgument_expression = GALGAS_gtlNotExpression::constructor_new (var_opLocation_6484, var_notExpression_6537  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 213)) ;
+  outArgument_expression = function_foldConstants (GALGAS_gtlNotExpression::constructor_new (var_opLocation_6484, var_notExpression_6537  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 213)), inCompiler COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 213)) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -10017,7 +10787,7 @@ void cParser_gtl_5F_expression_5F_parser::rule_gtl_5F_expression_5F_parser_gtl_5
   GALGAS_location var_opLocation_6928 = GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 223)) ;
   GALGAS_gtlExpression var_notExpression_6981 ;
   nt_gtl_5F_factor_ (var_notExpression_6981, inCompiler) ;
-  outArgument_expression = GALGAS_gtlNotExpression::constructor_new (var_opLocation_6928, var_notExpression_6981  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 225)) ;
+  outArgument_expression = function_foldConstants (GALGAS_gtlNotExpression::constructor_new (var_opLocation_6928, var_notExpression_6981  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 225)), inCompiler COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 225)) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -10037,7 +10807,7 @@ void cParser_gtl_5F_expression_5F_parser::rule_gtl_5F_expression_5F_parser_gtl_5
   GALGAS_location var_opLocation_7372 = GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 235)) ;
   GALGAS_gtlExpression var_minusExpression_7427 ;
   nt_gtl_5F_factor_ (var_minusExpression_7427, inCompiler) ;
-  outArgument_expression = GALGAS_gtlMinusExpression::constructor_new (var_opLocation_7372, var_minusExpression_7427  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 237)) ;
+  outArgument_expression = function_foldConstants (GALGAS_gtlMinusExpression::constructor_new (var_opLocation_7372, var_minusExpression_7427  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 237)), inCompiler COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 237)) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -10057,7 +10827,7 @@ void cParser_gtl_5F_expression_5F_parser::rule_gtl_5F_expression_5F_parser_gtl_5
   GALGAS_location var_opLocation_7822 = GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 247)) ;
   GALGAS_gtlExpression var_plusExpression_7876 ;
   nt_gtl_5F_factor_ (var_plusExpression_7876, inCompiler) ;
-  outArgument_expression = GALGAS_gtlPlusExpression::constructor_new (var_opLocation_7822, var_plusExpression_7876  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 249)) ;
+  outArgument_expression = function_foldConstants (GALGAS_gtlPlusExpression::constructor_new (var_opLocation_7822, var_plusExpression_7876  COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 249)), inCompiler COMMA_SOURCE_FILE ("gtl_expression_parser.galgas", 249)) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -11557,112 +12327,113 @@ void extensionMethod_execute (const GALGAS_gtlInstructionList inObject,
                               GALGAS_string & ioArgument_outputString,
                               C_Compiler * inCompiler
                               COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_uint var_startErrorCount_1648 = GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_instructions.galgas", 60)) ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = callExtensionGetter_debugActive ((const cPtr_gtlContext *) ioArgument_context.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 60)).boolEnum () ;
+    test_0 = callExtensionGetter_debugActive ((const cPtr_gtlContext *) ioArgument_context.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 61)).boolEnum () ;
     if (kBoolTrue == test_0) {
       {
       const GALGAS_gtlInstructionList temp_1 = inObject ;
       ioArgument_context.insulate (HERE) ;
       cPtr_gtlContext * ptr_1576 = (cPtr_gtlContext *) ioArgument_context.ptr () ;
-      callExtensionSetter_pushInstructionList ((cPtr_gtlContext *) ptr_1576, temp_1, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 61)) ;
+      callExtensionSetter_pushInstructionList ((cPtr_gtlContext *) ptr_1576, temp_1, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 62)) ;
       }
-      GALGAS_uint var_lastErrorCount_1628 = GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_instructions.galgas", 62)) ;
+      GALGAS_uint var_lastErrorCount_1628 = GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_instructions.galgas", 63)) ;
       const GALGAS_gtlInstructionList temp_2 = inObject ;
       cEnumerator_gtlInstructionList enumerator_1661 (temp_2, kENUMERATION_UP) ;
       GALGAS_uint index_1650 ((uint32_t) 0) ;
       while (enumerator_1661.hasCurrentObject ()) {
-        GALGAS_bool var_errorCountIncreased_1704 = GALGAS_bool (kIsStrictSup, GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_instructions.galgas", 64)).substract_operation (var_lastErrorCount_1628, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 64)).objectCompare (GALGAS_uint ((uint32_t) 0U))) ;
+        GALGAS_bool var_errorCountIncreased_1704 = GALGAS_bool (kIsStrictSup, GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_instructions.galgas", 65)).substract_operation (var_lastErrorCount_1628, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 65)).objectCompare (GALGAS_uint ((uint32_t) 0U))) ;
         enumGalgasBool test_3 = kBoolTrue ;
         if (kBoolTrue == test_3) {
-          test_3 = callExtensionGetter_breakOnNext ((const cPtr_gtlContext *) ioArgument_context.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 65)).operator_or (callExtensionGetter_breakOn ((const cPtr_gtlContext *) ioArgument_context.ptr (), enumerator_1661.current_instruction (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 65)) COMMA_SOURCE_FILE ("gtl_instructions.galgas", 65)).operator_or (callExtensionGetter_watchOn ((const cPtr_gtlContext *) ioArgument_context.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 66)) COMMA_SOURCE_FILE ("gtl_instructions.galgas", 65)).operator_or (var_errorCountIncreased_1704 COMMA_SOURCE_FILE ("gtl_instructions.galgas", 66)).boolEnum () ;
+          test_3 = callExtensionGetter_breakOnNext ((const cPtr_gtlContext *) ioArgument_context.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 66)).operator_or (callExtensionGetter_breakOn ((const cPtr_gtlContext *) ioArgument_context.ptr (), enumerator_1661.current_instruction (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 66)) COMMA_SOURCE_FILE ("gtl_instructions.galgas", 66)).operator_or (callExtensionGetter_watchOn ((const cPtr_gtlContext *) ioArgument_context.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 67)) COMMA_SOURCE_FILE ("gtl_instructions.galgas", 66)).operator_or (var_errorCountIncreased_1704 COMMA_SOURCE_FILE ("gtl_instructions.galgas", 67)).boolEnum () ;
           if (kBoolTrue == test_3) {
             {
             ioArgument_context.insulate (HERE) ;
             cPtr_gtlContext * ptr_1905 = (cPtr_gtlContext *) ioArgument_context.ptr () ;
-            callExtensionSetter_setBreakOnNext ((cPtr_gtlContext *) ptr_1905, GALGAS_bool (true), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 67)) ;
+            callExtensionSetter_setBreakOnNext ((cPtr_gtlContext *) ptr_1905, GALGAS_bool (true), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 68)) ;
             }
             {
             ioArgument_context.insulate (HERE) ;
             cPtr_gtlContext * ptr_1946 = (cPtr_gtlContext *) ioArgument_context.ptr () ;
-            callExtensionSetter_setNextInstructionIndex ((cPtr_gtlContext *) ptr_1946, index_1650, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 68)) ;
+            callExtensionSetter_setNextInstructionIndex ((cPtr_gtlContext *) ptr_1946, index_1650, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 69)) ;
             }
             {
             ioArgument_context.insulate (HERE) ;
             cPtr_gtlContext * ptr_1997 = (cPtr_gtlContext *) ioArgument_context.ptr () ;
-            callExtensionSetter_setDebugger ((cPtr_gtlContext *) ptr_1997, GALGAS_bool (false), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 69)) ;
+            callExtensionSetter_setDebugger ((cPtr_gtlContext *) ptr_1997, GALGAS_bool (false), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 70)) ;
             }
             {
             ioArgument_context.insulate (HERE) ;
             cPtr_gtlContext * ptr_2036 = (cPtr_gtlContext *) ioArgument_context.ptr () ;
-            callExtensionSetter_executeStepDoList ((cPtr_gtlContext *) ptr_2036, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 70)) ;
+            callExtensionSetter_executeStepDoList ((cPtr_gtlContext *) ptr_2036, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 71)) ;
             }
             {
             ioArgument_context.insulate (HERE) ;
             cPtr_gtlContext * ptr_2112 = (cPtr_gtlContext *) ioArgument_context.ptr () ;
-            callExtensionSetter_setDebugger ((cPtr_gtlContext *) ptr_2112, GALGAS_bool (true), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 71)) ;
+            callExtensionSetter_setDebugger ((cPtr_gtlContext *) ptr_2112, GALGAS_bool (true), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 72)) ;
             }
             {
             ioArgument_context.insulate (HERE) ;
             cPtr_gtlContext * ptr_2150 = (cPtr_gtlContext *) ioArgument_context.ptr () ;
-            callExtensionSetter_setLoopOnCommand ((cPtr_gtlContext *) ptr_2150, GALGAS_bool (true), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 72)) ;
+            callExtensionSetter_setLoopOnCommand ((cPtr_gtlContext *) ptr_2150, GALGAS_bool (true), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 73)) ;
             }
-            if (GALGAS_uint::constructor_max (SOURCE_FILE ("gtl_instructions.galgas", 73)).isValid ()) {
-              uint32_t variant_2187 = GALGAS_uint::constructor_max (SOURCE_FILE ("gtl_instructions.galgas", 73)).uintValue () ;
+            if (GALGAS_uint::constructor_max (SOURCE_FILE ("gtl_instructions.galgas", 74)).isValid ()) {
+              uint32_t variant_2187 = GALGAS_uint::constructor_max (SOURCE_FILE ("gtl_instructions.galgas", 74)).uintValue () ;
               bool loop_2187 = true ;
               while (loop_2187) {
-                  inCompiler->printMessage (callExtensionGetter_promptStyle ((const cPtr_gtlContext *) ioArgument_context.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 74)).add_operation (GALGAS_string ("gtl> "), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 74)).add_operation (function_endc (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 74)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 74))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 74)) ;
+                  inCompiler->printMessage (callExtensionGetter_promptStyle ((const cPtr_gtlContext *) ioArgument_context.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 75)).add_operation (GALGAS_string ("gtl> "), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 75)).add_operation (function_endc (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 75)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 75))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 75)) ;
                   GALGAS_string var_input_2305 ;
                   {
                   ioArgument_context.insulate (HERE) ;
                   cPtr_gtlContext * ptr_2279 = (cPtr_gtlContext *) ioArgument_context.ptr () ;
-                  callExtensionSetter_getCommand ((cPtr_gtlContext *) ptr_2279, var_input_2305, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 75)) ;
+                  callExtensionSetter_getCommand ((cPtr_gtlContext *) ptr_2279, var_input_2305, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 76)) ;
                   }
                   GALGAS_gtlInstruction var_command_2340 ;
-                  GALGAS_uint var_currentErrorCount_2374 = GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_instructions.galgas", 77)) ;
+                  GALGAS_uint var_currentErrorCount_2374 = GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_instructions.galgas", 78)) ;
                   enumGalgasBool test_4 = kBoolTrue ;
                   if (kBoolTrue == test_4) {
-                    test_4 = GALGAS_bool (kIsEqual, var_input_2305.getter_stringByTrimmingWhiteSpaces (SOURCE_FILE ("gtl_instructions.galgas", 78)).objectCompare (GALGAS_string::makeEmptyString ())).boolEnum () ;
+                    test_4 = GALGAS_bool (kIsEqual, var_input_2305.getter_stringByTrimmingWhiteSpaces (SOURCE_FILE ("gtl_instructions.galgas", 79)).objectCompare (GALGAS_string::makeEmptyString ())).boolEnum () ;
                     if (kBoolTrue == test_4) {
-                      var_command_2340 = GALGAS_gtlStepInstruction::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 79)), GALGAS_string::makeEmptyString ()  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 79)) ;
+                      var_command_2340 = GALGAS_gtlStepInstruction::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 80)), GALGAS_string::makeEmptyString ()  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 80)) ;
                     }
                   }
                   if (kBoolFalse == test_4) {
                     var_command_2340.drop () ;
-                    cGrammar_gtl_5F_debugger_5F_grammar::_performSourceStringParsing_ (inCompiler, var_input_2305, GALGAS_string ("Debugger command"), var_command_2340  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 81)) ;
+                    cGrammar_gtl_5F_debugger_5F_grammar::_performSourceStringParsing_ (inCompiler, var_input_2305, GALGAS_string ("Debugger command"), var_command_2340  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 82)) ;
                   }
                   enumGalgasBool test_5 = kBoolTrue ;
                   if (kBoolTrue == test_5) {
-                    test_5 = GALGAS_bool (kIsEqual, GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_instructions.galgas", 84)).objectCompare (var_currentErrorCount_2374)).boolEnum () ;
+                    test_5 = GALGAS_bool (kIsEqual, GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_instructions.galgas", 85)).objectCompare (var_currentErrorCount_2374)).boolEnum () ;
                     if (kBoolTrue == test_5) {
                       enumGalgasBool test_6 = kBoolTrue ;
                       if (kBoolTrue == test_6) {
-                        test_6 = callExtensionGetter_mayExecuteWithoutError ((const cPtr_gtlInstruction *) var_command_2340.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 85)).boolEnum () ;
+                        test_6 = callExtensionGetter_mayExecuteWithoutError ((const cPtr_gtlInstruction *) var_command_2340.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 86)).boolEnum () ;
                         if (kBoolTrue == test_6) {
-                          inCompiler->printMessage (callExtensionGetter_outputStyle ((const cPtr_gtlContext *) ioArgument_context.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 86))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 86)) ;
+                          inCompiler->printMessage (callExtensionGetter_outputStyle ((const cPtr_gtlContext *) ioArgument_context.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 87))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 87)) ;
                           {
                           ioArgument_context.insulate (HERE) ;
                           cPtr_gtlContext * ptr_2836 = (cPtr_gtlContext *) ioArgument_context.ptr () ;
-                          callExtensionSetter_setDebugger ((cPtr_gtlContext *) ptr_2836, GALGAS_bool (false), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 87)) ;
+                          callExtensionSetter_setDebugger ((cPtr_gtlContext *) ptr_2836, GALGAS_bool (false), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 88)) ;
                           }
-                          callExtensionMethod_execute ((const cPtr_gtlInstruction *) var_command_2340.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 88)) ;
+                          callExtensionMethod_execute ((const cPtr_gtlInstruction *) var_command_2340.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 89)) ;
                           {
                           ioArgument_context.insulate (HERE) ;
                           cPtr_gtlContext * ptr_2951 = (cPtr_gtlContext *) ioArgument_context.ptr () ;
-                          callExtensionSetter_setDebugger ((cPtr_gtlContext *) ptr_2951, GALGAS_bool (true), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 89)) ;
+                          callExtensionSetter_setDebugger ((cPtr_gtlContext *) ptr_2951, GALGAS_bool (true), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 90)) ;
                           }
-                          inCompiler->printMessage (function_endc (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 90))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 90)) ;
+                          inCompiler->printMessage (function_endc (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 91))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 91)) ;
                         }
                       }
                     }
                   }
-                loop_2187 = callExtensionGetter_loopOnCommand ((const cPtr_gtlContext *) ioArgument_context.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 93)).isValid () ;
+                loop_2187 = callExtensionGetter_loopOnCommand ((const cPtr_gtlContext *) ioArgument_context.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 94)).isValid () ;
                 if (loop_2187) {
-                  loop_2187 = callExtensionGetter_loopOnCommand ((const cPtr_gtlContext *) ioArgument_context.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 93)).boolValue () ;
+                  loop_2187 = callExtensionGetter_loopOnCommand ((const cPtr_gtlContext *) ioArgument_context.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 94)).boolValue () ;
                 }
                 if (loop_2187 && (0 == variant_2187)) {
                   loop_2187 = false ;
-                  inCompiler->loopRunTimeVariantError (SOURCE_FILE ("gtl_instructions.galgas", 73)) ;
+                  inCompiler->loopRunTimeVariantError (SOURCE_FILE ("gtl_instructions.galgas", 74)) ;
                 }
                 if (loop_2187) {
                   variant_2187 -- ;
@@ -11671,38 +12442,87 @@ void extensionMethod_execute (const GALGAS_gtlInstructionList inObject,
             }
           }
         }
-        var_lastErrorCount_1628 = GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_instructions.galgas", 96)) ;
-        callExtensionMethod_execute ((const cPtr_gtlInstruction *) enumerator_1661.current_instruction (HERE).ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 97)) ;
+        var_lastErrorCount_1628 = GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_instructions.galgas", 97)) ;
+        callExtensionMethod_execute ((const cPtr_gtlInstruction *) enumerator_1661.current_instruction (HERE).ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 98)) ;
         enumerator_1661.gotoNextObject () ;
-        index_1650.increment_operation (inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 63)) ;
+        index_1650.increment_operation (inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 64)) ;
       }
       {
       ioArgument_context.insulate (HERE) ;
       cPtr_gtlContext * ptr_3216 = (cPtr_gtlContext *) ioArgument_context.ptr () ;
-      callExtensionSetter_popInstructionList ((cPtr_gtlContext *) ptr_3216, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 99)) ;
+      callExtensionSetter_popInstructionList ((cPtr_gtlContext *) ptr_3216, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 100)) ;
       }
     }
   }
   if (kBoolFalse == test_0) {
-    const GALGAS_gtlInstructionList temp_7 = inObject ;
-    cEnumerator_gtlInstructionList enumerator_3262 (temp_7, kENUMERATION_UP) ;
-    while (enumerator_3262.hasCurrentObject ()) {
-      enumGalgasBool test_8 = kBoolTrue ;
-      if (kBoolTrue == test_8) {
-        test_8 = GALGAS_bool (kIsEqual, GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_instructions.galgas", 102)).objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
-        if (kBoolTrue == test_8) {
-          callExtensionMethod_execute ((const cPtr_gtlInstruction *) enumerator_3262.current_instruction (HERE).ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 103)) ;
+    enumGalgasBool test_7 = kBoolTrue ;
+    if (kBoolTrue == test_7) {
+      test_7 = GALGAS_bool (gOption_gtl_5F_options_profile.getter_value ()).boolEnum () ;
+      if (kBoolTrue == test_7) {
+        const GALGAS_gtlInstructionList temp_8 = inObject ;
+        cEnumerator_gtlInstructionList enumerator_3290 (temp_8, kENUMERATION_UP) ;
+        while (enumerator_3290.hasCurrentObject ()) {
           enumGalgasBool test_9 = kBoolTrue ;
           if (kBoolTrue == test_9) {
-            test_9 = GALGAS_bool (kIsNotEqual, GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_instructions.galgas", 104)).objectCompare (GALGAS_uint ((uint32_t) 0U))).operator_and (ioArgument_context.getter_propagateError (SOURCE_FILE ("gtl_instructions.galgas", 104)) COMMA_SOURCE_FILE ("gtl_instructions.galgas", 104)).boolEnum () ;
+            test_9 = GALGAS_bool (kIsEqual, GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_instructions.galgas", 103)).objectCompare (var_startErrorCount_1648)).boolEnum () ;
             if (kBoolTrue == test_9) {
-              TC_Array <C_FixItDescription> fixItArray10 ;
-              inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlInstruction *) enumerator_3262.current_instruction (HERE).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 105)), GALGAS_string ("runtime error"), fixItArray10  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 105)) ;
+              GALGAS_timer var_timer_3353 = GALGAS_timer::constructor_start (SOURCE_FILE ("gtl_instructions.galgas", 104)) ;
+              callExtensionMethod_execute ((const cPtr_gtlInstruction *) enumerator_3290.current_instruction (HERE).ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 105)) ;
+              {
+              ioArgument_lib.insulate (HERE) ;
+              cPtr_library * ptr_3450 = (cPtr_library *) ioArgument_lib.ptr () ;
+              callExtensionSetter_profileInstruction ((cPtr_library *) ptr_3450, enumerator_3290.current_instruction (HERE), var_timer_3353, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 106)) ;
+              }
+              enumGalgasBool test_10 = kBoolTrue ;
+              if (kBoolTrue == test_10) {
+                test_10 = GALGAS_bool (kIsNotEqual, GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_instructions.galgas", 107)).objectCompare (var_startErrorCount_1648)).operator_and (ioArgument_context.getter_propagateError (SOURCE_FILE ("gtl_instructions.galgas", 107)) COMMA_SOURCE_FILE ("gtl_instructions.galgas", 107)).boolEnum () ;
+                if (kBoolTrue == test_10) {
+                  TC_Array <C_FixItDescription> fixItArray11 ;
+                  inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlInstruction *) enumerator_3290.current_instruction (HERE).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 108)), GALGAS_string ("runtime error"), fixItArray11  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 108)) ;
+                }
+              }
+            }
+          }
+          enumerator_3290.gotoNextObject () ;
+        }
+      }
+    }
+    if (kBoolFalse == test_7) {
+      const GALGAS_gtlInstructionList temp_12 = inObject ;
+      cEnumerator_gtlInstructionList enumerator_3262 (temp_12, kENUMERATION_UP) ;
+      while (enumerator_3262.hasCurrentObject ()) {
+        enumGalgasBool test_13 = kBoolTrue ;
+        if (kBoolTrue == test_13) {
+          test_13 = GALGAS_bool (kIsEqual, GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_instructions.galgas", 114)).objectCompare (var_startErrorCount_1648)).boolEnum () ;
+          if (kBoolTrue == test_13) {
+            callExtensionMethod_execute ((const cPtr_gtlInstruction *) enumerator_3262.current_instruction (HERE).ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 115)) ;
+            enumGalgasBool test_14 = kBoolTrue ;
+            if (kBoolTrue == test_14) {
+              test_14 = GALGAS_bool (kIsNotEqual, GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_instructions.galgas", 116)).objectCompare (var_startErrorCount_1648)).operator_and (ioArgument_context.getter_propagateError (SOURCE_FILE ("gtl_instructions.galgas", 116)) COMMA_SOURCE_FILE ("gtl_instructions.galgas", 116)).boolEnum () ;
+              if (kBoolTrue == test_14) {
+                TC_Array <C_FixItDescription> fixItArray15 ;
+                inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlInstruction *) enumerator_3262.current_instruction (HERE).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 117)), GALGAS_string ("runtime error"), fixItArray15  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 117)) ;
+              }
             }
           }
         }
+        enumerator_3262.gotoNextObject () ;
+      }
+    }
+  }
+  enumGalgasBool test_16 = kBoolTrue ;
+  if (kBoolTrue == test_16) {
+    test_16 = GALGAS_bool (kIsSupOrEqual, ioArgument_outputString.getter_length (SOURCE_FILE ("gtl_instructions.galgas", 123)).objectCompare (GALGAS_uint ((uint32_t) 65536U))).boolEnum () ;
+    if (kBoolTrue == test_16) {
+      enumGalgasBool test_17 = kBoolTrue ;
+      if (kBoolTrue == test_17) {
+        test_17 = GALGAS_bool (kIsNotEqual, ioArgument_lib.getter_outputFile (SOURCE_FILE ("gtl_instructions.galgas", 124)).objectCompare (GALGAS_string::makeEmptyString ())).boolEnum () ;
+        if (kBoolTrue == test_17) {
+          {
+          ioArgument_outputString.setter_appendLinesToFile (ioArgument_lib.getter_outputFile (SOURCE_FILE ("gtl_instructions.galgas", 125)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 125)) ;
+          }
+        }
       }
-      enumerator_3262.gotoNextObject () ;
     }
   }
 }
@@ -14035,12 +14855,12 @@ static void extensionMethod_gtlAbstractSortInstruction_swap (const cPtr_gtlAbstr
                                                              const GALGAS_uint constinArgument_index_32_,
                                                              C_Compiler * inCompiler
                                                              COMMA_UNUSED_LOCATION_ARGS) {
-  GALGAS_gtlData var_temp_29391 = ioArgument_aList.getter_valueAtIndex (constinArgument_index_31_, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 978)) ;
+  GALGAS_gtlData var_temp_29391 = ioArgument_aList.getter_valueAtIndex (constinArgument_index_31_, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1050)) ;
   {
-  ioArgument_aList.setter_setValueAtIndex (ioArgument_aList.getter_valueAtIndex (constinArgument_index_32_, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 979)), constinArgument_index_31_, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 979)) ;
+  ioArgument_aList.setter_setValueAtIndex (ioArgument_aList.getter_valueAtIndex (constinArgument_index_32_, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1051)), constinArgument_index_31_, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1051)) ;
   }
   {
-  ioArgument_aList.setter_setValueAtIndex (var_temp_29391, constinArgument_index_32_, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 980)) ;
+  ioArgument_aList.setter_setValueAtIndex (var_temp_29391, constinArgument_index_32_, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1052)) ;
   }
 }
 //----------------------------------------------------------------------------------------------------------------------
@@ -14122,13 +14942,13 @@ static void extensionMethod_gtlAbstractSortInstruction_partition (const cPtr_gtl
                                                                   COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlAbstractSortInstruction * object = inObject ;
   macroValidSharedObject (object, cPtr_gtlAbstractSortInstruction) ;
-  GALGAS_gtlData var_pivot_29674 = ioArgument_aList.getter_valueAtIndex (ioArgument_pivotIndex, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 989)) ;
+  GALGAS_gtlData var_pivot_29674 = ioArgument_aList.getter_valueAtIndex (ioArgument_pivotIndex, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1061)) ;
   const GALGAS_gtlAbstractSortInstruction temp_0 = object ;
-  callExtensionMethod_swap ((const cPtr_gtlAbstractSortInstruction *) temp_0.ptr (), ioArgument_aList, ioArgument_pivotIndex, constinArgument_max, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 990)) ;
+  callExtensionMethod_swap ((const cPtr_gtlAbstractSortInstruction *) temp_0.ptr (), ioArgument_aList, ioArgument_pivotIndex, constinArgument_max, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1062)) ;
   GALGAS_uint var_storeIndex_29767 = constinArgument_min ;
   GALGAS_uint var_i_29783 = constinArgument_min ;
-  if (constinArgument_max.substract_operation (constinArgument_min, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 993)).isValid ()) {
-    uint32_t variant_29796 = constinArgument_max.substract_operation (constinArgument_min, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 993)).uintValue () ;
+  if (constinArgument_max.substract_operation (constinArgument_min, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1065)).isValid ()) {
+    uint32_t variant_29796 = constinArgument_max.substract_operation (constinArgument_min, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1065)).uintValue () ;
     bool loop_29796 = true ;
     while (loop_29796) {
       loop_29796 = GALGAS_bool (kIsStrictInf, var_i_29783.objectCompare (constinArgument_max)).isValid () ;
@@ -14137,26 +14957,26 @@ static void extensionMethod_gtlAbstractSortInstruction_partition (const cPtr_gtl
       }
       if (loop_29796 && (0 == variant_29796)) {
         loop_29796 = false ;
-        inCompiler->loopRunTimeVariantError (SOURCE_FILE ("gtl_instructions.galgas", 993)) ;
+        inCompiler->loopRunTimeVariantError (SOURCE_FILE ("gtl_instructions.galgas", 1065)) ;
       }
       if (loop_29796) {
         variant_29796 -- ;
         enumGalgasBool test_1 = kBoolTrue ;
         if (kBoolTrue == test_1) {
           const GALGAS_gtlAbstractSortInstruction temp_2 = object ;
-          test_1 = GALGAS_bool (kIsEqual, callExtensionGetter_compare ((const cPtr_gtlAbstractSortInstruction *) temp_2.ptr (), ioArgument_aList.getter_valueAtIndex (var_i_29783, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 995)), var_pivot_29674, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 995)).objectCompare (GALGAS_sint ((int32_t) 1L).operator_unary_minus (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 995)))).boolEnum () ;
+          test_1 = GALGAS_bool (kIsEqual, callExtensionGetter_compare ((const cPtr_gtlAbstractSortInstruction *) temp_2.ptr (), ioArgument_aList.getter_valueAtIndex (var_i_29783, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1067)), var_pivot_29674, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1067)).objectCompare (GALGAS_sint ((int32_t) 1L).operator_unary_minus (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1067)))).boolEnum () ;
           if (kBoolTrue == test_1) {
             const GALGAS_gtlAbstractSortInstruction temp_3 = object ;
-            callExtensionMethod_swap ((const cPtr_gtlAbstractSortInstruction *) temp_3.ptr (), ioArgument_aList, var_i_29783, var_storeIndex_29767, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 996)) ;
-            var_storeIndex_29767.increment_operation (inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 997)) ;
+            callExtensionMethod_swap ((const cPtr_gtlAbstractSortInstruction *) temp_3.ptr (), ioArgument_aList, var_i_29783, var_storeIndex_29767, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1068)) ;
+            var_storeIndex_29767.increment_operation (inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1069)) ;
           }
         }
-        var_i_29783.increment_operation (inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 999)) ;
+        var_i_29783.increment_operation (inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1071)) ;
       }
     }
   }
   const GALGAS_gtlAbstractSortInstruction temp_4 = object ;
-  callExtensionMethod_swap ((const cPtr_gtlAbstractSortInstruction *) temp_4.ptr (), ioArgument_aList, var_storeIndex_29767, constinArgument_max, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1001)) ;
+  callExtensionMethod_swap ((const cPtr_gtlAbstractSortInstruction *) temp_4.ptr (), ioArgument_aList, var_storeIndex_29767, constinArgument_max, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1073)) ;
   ioArgument_pivotIndex = var_storeIndex_29767 ;
 }
 //----------------------------------------------------------------------------------------------------------------------
@@ -14240,13 +15060,13 @@ static void extensionMethod_gtlAbstractSortInstruction_sort (const cPtr_gtlAbstr
   if (kBoolTrue == test_0) {
     test_0 = GALGAS_bool (kIsStrictInf, constinArgument_min.objectCompare (constinArgument_max)).boolEnum () ;
     if (kBoolTrue == test_0) {
-      GALGAS_uint var_pivotIndex_30179 = constinArgument_max.add_operation (constinArgument_min, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1011)).divide_operation (GALGAS_uint ((uint32_t) 2U), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1011)) ;
+      GALGAS_uint var_pivotIndex_30179 = constinArgument_max.add_operation (constinArgument_min, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1083)).divide_operation (GALGAS_uint ((uint32_t) 2U), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1083)) ;
       const GALGAS_gtlAbstractSortInstruction temp_1 = object ;
-      callExtensionMethod_partition ((const cPtr_gtlAbstractSortInstruction *) temp_1.ptr (), ioArgument_aList, constinArgument_min, constinArgument_max, var_pivotIndex_30179, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1012)) ;
+      callExtensionMethod_partition ((const cPtr_gtlAbstractSortInstruction *) temp_1.ptr (), ioArgument_aList, constinArgument_min, constinArgument_max, var_pivotIndex_30179, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1084)) ;
       const GALGAS_gtlAbstractSortInstruction temp_2 = object ;
-      callExtensionMethod_sort ((const cPtr_gtlAbstractSortInstruction *) temp_2.ptr (), ioArgument_aList, constinArgument_min, var_pivotIndex_30179, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1013)) ;
+      callExtensionMethod_sort ((const cPtr_gtlAbstractSortInstruction *) temp_2.ptr (), ioArgument_aList, constinArgument_min, var_pivotIndex_30179, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1085)) ;
       const GALGAS_gtlAbstractSortInstruction temp_3 = object ;
-      callExtensionMethod_sort ((const cPtr_gtlAbstractSortInstruction *) temp_3.ptr (), ioArgument_aList, var_pivotIndex_30179.add_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1014)), constinArgument_max, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1014)) ;
+      callExtensionMethod_sort ((const cPtr_gtlAbstractSortInstruction *) temp_3.ptr (), ioArgument_aList, var_pivotIndex_30179.add_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1086)), constinArgument_max, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1086)) ;
     }
   }
 }
@@ -14533,7 +15353,7 @@ static GALGAS_sint extensionGetter_gtlSortStatementStructInstruction_compareElem
   macroValidSharedObject (object, cPtr_gtlSortStatementStructInstruction) ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = GALGAS_bool (kIsStrictSup, inArgument_keyList.getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1063)).objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
+    test_0 = GALGAS_bool (kIsStrictSup, inArgument_keyList.getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1135)).objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
     if (kBoolTrue == test_0) {
       enumGalgasBool test_1 = kBoolTrue ;
       if (kBoolTrue == test_1) {
@@ -14548,7 +15368,7 @@ static GALGAS_sint extensionGetter_gtlSortStatementStructInstruction_compareElem
                 if (NULL != dynamic_cast <const cPtr_gtlStruct *> (constinArgument_s_31_.ptr ())) {
                   temp_3 = (cPtr_gtlStruct *) constinArgument_s_31_.ptr () ;
                 }else{
-                  inCompiler->castError ("gtlStruct", constinArgument_s_31_.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1066)) ;
+                  inCompiler->castError ("gtlStruct", constinArgument_s_31_.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1138)) ;
                 }
               }
               GALGAS_gtlStruct var_s_31_Struct_31666 = temp_3 ;
@@ -14557,51 +15377,51 @@ static GALGAS_sint extensionGetter_gtlSortStatementStructInstruction_compareElem
                 if (NULL != dynamic_cast <const cPtr_gtlStruct *> (constinArgument_s_32_.ptr ())) {
                   temp_4 = (cPtr_gtlStruct *) constinArgument_s_32_.ptr () ;
                 }else{
-                  inCompiler->castError ("gtlStruct", constinArgument_s_32_.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1067)) ;
+                  inCompiler->castError ("gtlStruct", constinArgument_s_32_.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1139)) ;
                 }
               }
               GALGAS_gtlStruct var_s_32_Struct_31713 = temp_4 ;
               GALGAS_lstring var_field_31776 ;
               GALGAS_lsint var_order_31790 ;
               {
-              inArgument_keyList.setter_popFirst (var_field_31776, var_order_31790, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1068)) ;
+              inArgument_keyList.setter_popFirst (var_field_31776, var_order_31790, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1140)) ;
               }
               GALGAS_gtlData var_s_31_Field_31846 ;
-              var_s_31_Struct_31666.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 1069)).method_get (var_field_31776, var_s_31_Field_31846, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1069)) ;
+              var_s_31_Struct_31666.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 1141)).method_get (var_field_31776, var_s_31_Field_31846, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1141)) ;
               GALGAS_gtlData var_s_32_Field_31902 ;
-              var_s_32_Struct_31713.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 1070)).method_get (var_field_31776, var_s_32_Field_31902, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1070)) ;
+              var_s_32_Struct_31713.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 1142)).method_get (var_field_31776, var_s_32_Field_31902, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1142)) ;
               enumGalgasBool test_5 = kBoolTrue ;
               if (kBoolTrue == test_5) {
-                test_5 = callExtensionGetter_bool ((const cPtr_gtlData *) callExtensionGetter_ltOp ((const cPtr_gtlData *) var_s_31_Field_31846.ptr (), var_s_32_Field_31902, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1071)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1078)).boolEnum () ;
+                test_5 = callExtensionGetter_bool ((const cPtr_gtlData *) callExtensionGetter_ltOp ((const cPtr_gtlData *) var_s_31_Field_31846.ptr (), var_s_32_Field_31902, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1143)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1150)).boolEnum () ;
                 if (kBoolTrue == test_5) {
-                  result_result = GALGAS_sint ((int32_t) 1L).operator_unary_minus (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1072)).multiply_operation (var_order_31790.getter_sint (SOURCE_FILE ("gtl_instructions.galgas", 1072)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1072)) ;
+                  result_result = GALGAS_sint ((int32_t) 1L).operator_unary_minus (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1144)).multiply_operation (var_order_31790.getter_sint (SOURCE_FILE ("gtl_instructions.galgas", 1144)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1144)) ;
                 }
               }
               if (kBoolFalse == test_5) {
                 enumGalgasBool test_6 = kBoolTrue ;
                 if (kBoolTrue == test_6) {
-                  test_6 = callExtensionGetter_bool ((const cPtr_gtlData *) callExtensionGetter_gtOp ((const cPtr_gtlData *) var_s_31_Field_31846.ptr (), var_s_32_Field_31902, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1074)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1077)).boolEnum () ;
+                  test_6 = callExtensionGetter_bool ((const cPtr_gtlData *) callExtensionGetter_gtOp ((const cPtr_gtlData *) var_s_31_Field_31846.ptr (), var_s_32_Field_31902, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1146)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1149)).boolEnum () ;
                   if (kBoolTrue == test_6) {
-                    result_result = GALGAS_sint ((int32_t) 1L).multiply_operation (var_order_31790.getter_sint (SOURCE_FILE ("gtl_instructions.galgas", 1075)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1075)) ;
+                    result_result = GALGAS_sint ((int32_t) 1L).multiply_operation (var_order_31790.getter_sint (SOURCE_FILE ("gtl_instructions.galgas", 1147)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1147)) ;
                   }
                 }
                 if (kBoolFalse == test_6) {
                   const GALGAS_gtlSortStatementStructInstruction temp_7 = object ;
-                  result_result = callExtensionGetter_compareElements ((const cPtr_gtlSortStatementStructInstruction *) temp_7.ptr (), constinArgument_s_31_, constinArgument_s_32_, inArgument_keyList, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1077)) ;
+                  result_result = callExtensionGetter_compareElements ((const cPtr_gtlSortStatementStructInstruction *) temp_7.ptr (), constinArgument_s_31_, constinArgument_s_32_, inArgument_keyList, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1149)) ;
                 }
               }
             }
           }
           if (kBoolFalse == test_2) {
             TC_Array <C_FixItDescription> fixItArray8 ;
-            inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlData *) constinArgument_s_32_.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1081)), GALGAS_string ("struct expected"), fixItArray8  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1081)) ;
+            inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlData *) constinArgument_s_32_.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1153)), GALGAS_string ("struct expected"), fixItArray8  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1153)) ;
             result_result.drop () ; // Release error dropped variable
           }
         }
       }
       if (kBoolFalse == test_1) {
         TC_Array <C_FixItDescription> fixItArray9 ;
-        inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlData *) constinArgument_s_31_.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1084)), GALGAS_string ("struct expected"), fixItArray9  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1084)) ;
+        inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlData *) constinArgument_s_31_.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1156)), GALGAS_string ("struct expected"), fixItArray9  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1156)) ;
         result_result.drop () ; // Release error dropped variable
       }
     }
@@ -14882,16 +15702,16 @@ static void extensionMethod_gtlVariablesInstruction_displayShort (const cPtr_gtl
   if (constinArgument_vars.isValid ()) {
     if (constinArgument_vars.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlStruct) {
       GALGAS_gtlStruct cast_34135_variableMap ((cPtr_gtlStruct *) constinArgument_vars.ptr ()) ;
-      cEnumerator_gtlVarMap enumerator_34183 (cast_34135_variableMap.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 1157)), kENUMERATION_UP) ;
+      cEnumerator_gtlVarMap enumerator_34183 (cast_34135_variableMap.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 1229)), kENUMERATION_UP) ;
       while (enumerator_34183.hasCurrentObject ()) {
-        inCompiler->printMessage (enumerator_34183.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1158)).add_operation (GALGAS_string (" >\n"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1158))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1158)) ;
-        inCompiler->printMessage (callExtensionGetter_desc ((const cPtr_gtlData *) enumerator_34183.current_value (HERE).ptr (), GALGAS_uint ((uint32_t) 4U), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1159))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1159)) ;
+        inCompiler->printMessage (enumerator_34183.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1230)).add_operation (GALGAS_string (" >\n"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1230))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1230)) ;
+        inCompiler->printMessage (callExtensionGetter_desc ((const cPtr_gtlData *) enumerator_34183.current_value (HERE).ptr (), GALGAS_uint ((uint32_t) 4U), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1231))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1231)) ;
         enumerator_34183.gotoNextObject () ;
       }
     }else{
       const GALGAS_gtlVariablesInstruction temp_0 = object ;
       TC_Array <C_FixItDescription> fixItArray1 ;
-      inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlVariablesInstruction *) temp_0.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1162)), GALGAS_string ("INTERNAL ERROR. a variable map should be a @gtlStruct"), fixItArray1  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1162)) ;
+      inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlVariablesInstruction *) temp_0.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1234)), GALGAS_string ("INTERNAL ERROR. a variable map should be a @gtlStruct"), fixItArray1  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1234)) ;
     }
   }
 }
@@ -14968,30 +15788,30 @@ static void extensionMethod_gtlVariablesInstruction_displayLong (const cPtr_gtlV
                                                                  COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlVariablesInstruction * object = inObject ;
   macroValidSharedObject (object, cPtr_gtlVariablesInstruction) ;
-  GALGAS_string var_delimitor_34440 = GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (61)), GALGAS_uint ((uint32_t) 79U)  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1169)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1169)) ;
-  GALGAS_string var_varDelim_34518 = GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (45)), GALGAS_uint ((uint32_t) 79U)  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1170)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1170)) ;
-  GALGAS_string var_separator_34598 = GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (61)), GALGAS_uint ((uint32_t) 17U)  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1171)) ;
-  inCompiler->printMessage (var_separator_34598.add_operation (GALGAS_string (" Variables "), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1172)).add_operation (var_separator_34598, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1172)).add_operation (GALGAS_string ("= Displayed from "), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1173)).add_operation (var_separator_34598, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1173)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1174))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1172)) ;
-  inCompiler->printMessage (object->mProperty_where.getter_locationString (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1175)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1175))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1175)) ;
-  inCompiler->printMessage (var_delimitor_34440  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1176)) ;
+  GALGAS_string var_delimitor_34440 = GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (61)), GALGAS_uint ((uint32_t) 79U)  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1241)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1241)) ;
+  GALGAS_string var_varDelim_34518 = GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (45)), GALGAS_uint ((uint32_t) 79U)  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1242)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1242)) ;
+  GALGAS_string var_separator_34598 = GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (61)), GALGAS_uint ((uint32_t) 17U)  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1243)) ;
+  inCompiler->printMessage (var_separator_34598.add_operation (GALGAS_string (" Variables "), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1244)).add_operation (var_separator_34598, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1244)).add_operation (GALGAS_string ("= Displayed from "), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1245)).add_operation (var_separator_34598, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1245)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1246))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1244)) ;
+  inCompiler->printMessage (object->mProperty_where.getter_locationString (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1247)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1247))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1247)) ;
+  inCompiler->printMessage (var_delimitor_34440  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1248)) ;
   if (constinArgument_vars.isValid ()) {
     if (constinArgument_vars.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlStruct) {
       GALGAS_gtlStruct cast_34860_variableMap ((cPtr_gtlStruct *) constinArgument_vars.ptr ()) ;
-      cEnumerator_gtlVarMap enumerator_34908 (cast_34860_variableMap.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 1179)), kENUMERATION_UP) ;
+      cEnumerator_gtlVarMap enumerator_34908 (cast_34860_variableMap.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 1251)), kENUMERATION_UP) ;
       while (enumerator_34908.hasCurrentObject ()) {
-        inCompiler->printMessage (var_varDelim_34518  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1180)) ;
-        inCompiler->printMessage (enumerator_34908.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1181)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1181))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1181)) ;
-        inCompiler->printMessage (var_varDelim_34518  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1182)) ;
-        inCompiler->printMessage (callExtensionGetter_desc ((const cPtr_gtlData *) enumerator_34908.current_value (HERE).ptr (), GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1183))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1183)) ;
+        inCompiler->printMessage (var_varDelim_34518  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1252)) ;
+        inCompiler->printMessage (enumerator_34908.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1253)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1253))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1253)) ;
+        inCompiler->printMessage (var_varDelim_34518  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1254)) ;
+        inCompiler->printMessage (callExtensionGetter_desc ((const cPtr_gtlData *) enumerator_34908.current_value (HERE).ptr (), GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1255))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1255)) ;
         enumerator_34908.gotoNextObject () ;
       }
     }else{
       const GALGAS_gtlVariablesInstruction temp_0 = object ;
       TC_Array <C_FixItDescription> fixItArray1 ;
-      inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlVariablesInstruction *) temp_0.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1186)), GALGAS_string ("INTERNAL ERROR. a variable map should be a @gtlStruct"), fixItArray1  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1186)) ;
+      inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlVariablesInstruction *) temp_0.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1258)), GALGAS_string ("INTERNAL ERROR. a variable map should be a @gtlStruct"), fixItArray1  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1258)) ;
     }
   }
-  inCompiler->printMessage (var_delimitor_34440  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1188)) ;
+  inCompiler->printMessage (var_delimitor_34440  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1260)) ;
 }
 //----------------------------------------------------------------------------------------------------------------------
 
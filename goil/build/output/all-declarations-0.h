@@ -1395,6 +1395,332 @@ void extensionSetter_getTemplate (class GALGAS_gtlTemplateMap & ioObject,
                                   class C_Compiler * inCompiler
                                   COMMA_LOCATION_ARGS) ;
 
+//----------------------------------------------------------------------------------------------------------------------
+//
+// Phase 1: @gtlProfileMap map
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+class cMapElement_gtlProfileMap ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+extern const char * kSearchErrorMessage_gtlProfileMap_get ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+class GALGAS_gtlProfileMap : public AC_GALGAS_map {
+//--------------------------------- Default constructor
+  public : GALGAS_gtlProfileMap (void) ;
+
+//--------------------------------- Handle copy
+  public : GALGAS_gtlProfileMap (const GALGAS_gtlProfileMap & inSource) ;
+  public : GALGAS_gtlProfileMap & operator = (const GALGAS_gtlProfileMap & inSource) ;
+  
+//-- Start of generic part --*
+
+//--------------------------------- Object cloning
+  protected : virtual AC_GALGAS_root * clonedObject (void) const ;
+
+//--------------------------------- Object extraction
+  public : static GALGAS_gtlProfileMap extractObject (const GALGAS_object & inObject,
+                                                      C_Compiler * inCompiler
+                                                      COMMA_LOCATION_ARGS) ;
+
+//--------------------------------- GALGAS constructors
+  public : static class GALGAS_gtlProfileMap constructor_emptyMap (LOCATION_ARGS) ;
+
+  public : static class GALGAS_gtlProfileMap constructor_mapWithMapToOverride (const class GALGAS_gtlProfileMap & inOperand0
+                                                                               COMMA_LOCATION_ARGS) ;
+
+//--------------------------------- += operator (with list of field expressions)
+  public : VIRTUAL_IN_DEBUG void addAssign_operation (const class GALGAS_lstring & inOperand0,
+                                                      const class GALGAS_uint & inOperand1,
+                                                      const class GALGAS_uint & inOperand2,
+                                                      const class GALGAS_uint & inOperand3,
+                                                      const class GALGAS_uint & inOperand4,
+                                                      const class GALGAS_uint_36__34_ & inOperand5,
+                                                      C_Compiler * inCompiler
+                                                      COMMA_LOCATION_ARGS) ;
+
+//--------------------------------- Setters
+  public : VIRTUAL_IN_DEBUG void setter_put (class GALGAS_lstring constinArgument0,
+                                             class GALGAS_uint constinArgument1,
+                                             class GALGAS_uint constinArgument2,
+                                             class GALGAS_uint constinArgument3,
+                                             class GALGAS_uint constinArgument4,
+                                             class GALGAS_uint_36__34_ constinArgument5,
+                                             C_Compiler * inCompiler
+                                             COMMA_LOCATION_ARGS) ;
+
+  public : VIRTUAL_IN_DEBUG void setter_setAllocatedBytesForKey (class GALGAS_uint_36__34_ constinArgument0,
+                                                                 class GALGAS_string constinArgument1,
+                                                                 C_Compiler * inCompiler
+                                                                 COMMA_LOCATION_ARGS) ;
+
+  public : VIRTUAL_IN_DEBUG void setter_setAllocationsForKey (class GALGAS_uint constinArgument0,
+                                                              class GALGAS_string constinArgument1,
+                                                              C_Compiler * inCompiler
+                                                              COMMA_LOCATION_ARGS) ;
+
+  public : VIRTUAL_IN_DEBUG void setter_setCountForKey (class GALGAS_uint constinArgument0,
+                                                        class GALGAS_string constinArgument1,
+                                                        C_Compiler * inCompiler
+                                                        COMMA_LOCATION_ARGS) ;
+
+  public : VIRTUAL_IN_DEBUG void setter_setCpuForKey (class GALGAS_uint constinArgument0,
+                                                      class GALGAS_string constinArgument1,
+                                                      C_Compiler * inCompiler
+                                                      COMMA_LOCATION_ARGS) ;
+
+  public : VIRTUAL_IN_DEBUG void setter_setTimeForKey (class GALGAS_uint constinArgument0,
+                                                       class GALGAS_string constinArgument1,
+                                                       C_Compiler * inCompiler
+                                                       COMMA_LOCATION_ARGS) ;
+
+
+//--------------------------------- Instance Methods
+  public : VIRTUAL_IN_DEBUG void method_get (class GALGAS_lstring constinArgument0,
+                                             class GALGAS_uint & outArgument1,
+                                             class GALGAS_uint & outArgument2,
+                                             class GALGAS_uint & outArgument3,
+                                             class GALGAS_uint & outArgument4,
+                                             class GALGAS_uint_36__34_ & outArgument5,
+                                             C_Compiler * inCompiler
+                                             COMMA_LOCATION_ARGS) const ;
+
+//--------------------------------- Class Methods
+
+//--------------------------------- Getters
+  public : VIRTUAL_IN_DEBUG class GALGAS_uint_36__34_ getter_allocatedBytesForKey (const class GALGAS_string & constinOperand0,
+                                                                                   C_Compiler * inCompiler
+                                                                                   COMMA_LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_uint getter_allocationsForKey (const class GALGAS_string & constinOperand0,
+                                                                        C_Compiler * inCompiler
+                                                                        COMMA_LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_uint getter_countForKey (const class GALGAS_string & constinOperand0,
+                                                                  C_Compiler * inCompiler
+                                                                  COMMA_LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_uint getter_cpuForKey (const class GALGAS_string & constinOperand0,
+                                                                C_Compiler * inCompiler
+                                                                COMMA_LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_gtlProfileMap getter_overriddenMap (C_Compiler * inCompiler
+                                                                             COMMA_LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_uint getter_timeForKey (const class GALGAS_string & constinOperand0,
+                                                                 C_Compiler * inCompiler
+                                                                 COMMA_LOCATION_ARGS) const ;
+
+
+//--------------------------------- Optional Methods
+  public : VIRTUAL_IN_DEBUG bool optional_searchKey (const class GALGAS_string & constinOperand0,
+                                                     class GALGAS_uint & outOperand1,
+                                                     class GALGAS_uint & outOperand2,
+                                                     class GALGAS_uint & outOperand3,
+                                                     class GALGAS_uint & outOperand4,
+                                                     class GALGAS_uint_36__34_ & outOperand5) const ;
+
+
+//--------------------------------- Introspection
+  public : VIRTUAL_IN_DEBUG const C_galgas_type_descriptor * staticTypeDescriptor (void) const ;
+  public : VIRTUAL_IN_DEBUG cMapElement_gtlProfileMap * readWriteAccessForWithInstruction (C_Compiler * inCompiler,
+                                                                                           const GALGAS_string & inKey
+                                                                                           COMMA_LOCATION_ARGS) ;
+
+//--------------------------------- Friend
+
+  friend class cEnumerator_gtlProfileMap ;
+ 
+} ; // End of GALGAS_gtlProfileMap class
+
+//----------------------------------------------------------------------------------------------------------------------
+//   Enumerator declaration                                                                      
+//----------------------------------------------------------------------------------------------------------------------
+
+class cEnumerator_gtlProfileMap : public cGenericAbstractEnumerator {
+  public : cEnumerator_gtlProfileMap (const GALGAS_gtlProfileMap & inEnumeratedObject,
+                                      const typeEnumerationOrder inOrder) ;
+
+//--- Current element access
+  public : class GALGAS_lstring current_lkey (LOCATION_ARGS) const ;
+  public : class GALGAS_uint current_count (LOCATION_ARGS) const ;
+  public : class GALGAS_uint current_time (LOCATION_ARGS) const ;
+  public : class GALGAS_uint current_cpu (LOCATION_ARGS) const ;
+  public : class GALGAS_uint current_allocations (LOCATION_ARGS) const ;
+  public : class GALGAS_uint_36__34_ current_allocatedBytes (LOCATION_ARGS) const ;
+//--- Current element access
+  public : class GALGAS_gtlProfileMap_2D_element current (LOCATION_ARGS) const ;
+} ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+extern const C_galgas_type_descriptor kTypeDescriptor_GALGAS_gtlProfileMap ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+// Phase 2: class for element of '@gtlProfileMap' map
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+class cMapElement_gtlProfileMap : public cMapElement {
+//--- Map attributes
+  public : GALGAS_uint mProperty_count ;
+  public : GALGAS_uint mProperty_time ;
+  public : GALGAS_uint mProperty_cpu ;
+  public : GALGAS_uint mProperty_allocations ;
+  public : GALGAS_uint_36__34_ mProperty_allocatedBytes ;
+
+//--- Constructor
+  public : cMapElement_gtlProfileMap (const GALGAS_lstring & inKey,
+                                      const GALGAS_uint & in_count,
+                                      const GALGAS_uint & in_time,
+                                      const GALGAS_uint & in_cpu,
+                                      const GALGAS_uint & in_allocations,
+                                      const GALGAS_uint_36__34_ & in_allocatedBytes
+                                      COMMA_LOCATION_ARGS) ;
+
+//--- Virtual method for comparing elements
+  public : virtual typeComparisonResult compare (const cCollectionElement * inOperand) const ;
+
+//--- Virtual method that checks that all attributes are valid
+  public : virtual bool isValid (void) const ;
+
+//--- Virtual method that returns a copy of current object
+  public : virtual cMapElement * copy (void) ;
+
+//--- Description
+ public : virtual void description (C_String & ioString, const int32_t inIndentation) const ;
+} ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+// Phase 1: @gtlProfileMap_2D_element struct
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+class GALGAS_gtlProfileMap_2D_element : public AC_GALGAS_root {
+//--------------------------------- Properties
+  public : GALGAS_lstring mProperty_lkey ;
+
+  public : GALGAS_uint mProperty_count ;
+
+  public : GALGAS_uint mProperty_time ;
+
+  public : GALGAS_uint mProperty_cpu ;
+
+  public : GALGAS_uint mProperty_allocations ;
+
+  public : GALGAS_uint_36__34_ mProperty_allocatedBytes ;
+
+//--------------------------------- Accessors
+  public : VIRTUAL_IN_DEBUG bool isValid (void) const ;
+  public : VIRTUAL_IN_DEBUG void drop (void) ;
+
+//--------------------------------- Default GALGAS constructor
+  public : static GALGAS_gtlProfileMap_2D_element constructor_default (LOCATION_ARGS) ;
+
+//--------------------------------- Default constructor
+  public : GALGAS_gtlProfileMap_2D_element (void) ;
+
+//--------------------------------- Virtual destructor (in debug mode)
+  public : virtual ~ GALGAS_gtlProfileMap_2D_element (void) ;
+
+//--------------------------------- Native constructor
+  public : GALGAS_gtlProfileMap_2D_element (const GALGAS_lstring & in_lkey,
+                                            const GALGAS_uint & in_count,
+                                            const GALGAS_uint & in_time,
+                                            const GALGAS_uint & in_cpu,
+                                            const GALGAS_uint & in_allocations,
+                                            const GALGAS_uint_36__34_ & in_allocatedBytes) ;
+
+//-- Start of generic part --*
+
+//--------------------------------- Object cloning
+  protected : virtual AC_GALGAS_root * clonedObject (void) const ;
+
+//--------------------------------- Object extraction
+  public : static GALGAS_gtlProfileMap_2D_element extractObject (const GALGAS_object & inObject,
+                                                                 C_Compiler * inCompiler
+                                                                 COMMA_LOCATION_ARGS) ;
+
+//--------------------------------- GALGAS constructors
+  public : static class GALGAS_gtlProfileMap_2D_element constructor_new (const class GALGAS_lstring & inOperand0,
+                                                                         const class GALGAS_uint & inOperand1,
+                                                                         const class GALGAS_uint & inOperand2,
+                                                                         const class GALGAS_uint & inOperand3,
+                                                                         const class GALGAS_uint & inOperand4,
+                                                                         const class GALGAS_uint_36__34_ & inOperand5
+                                                                         COMMA_LOCATION_ARGS) ;
+
+//--------------------------------- Implementation of getter 'description'
+  public : VIRTUAL_IN_DEBUG void description (C_String & ioString,
+                                              const int32_t inIndentation) const ;
+//--------------------------------- Comparison
+  public : typeComparisonResult objectCompare (const GALGAS_gtlProfileMap_2D_element & inOperand) const ;
+
+//--------------------------------- Setters
+
+//--------------------------------- Instance Methods
+//--------------------------------- Class Methods
+
+//--------------------------------- Getters
+  public : VIRTUAL_IN_DEBUG class GALGAS_uint_36__34_ getter_allocatedBytes (LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_uint getter_allocations (LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_uint getter_count (LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_uint getter_cpu (LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_lstring getter_lkey (LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_uint getter_time (LOCATION_ARGS) const ;
+
+
+//--------------------------------- Optional Methods
+
+//--------------------------------- Introspection
+  public : VIRTUAL_IN_DEBUG const C_galgas_type_descriptor * staticTypeDescriptor (void) const ;
+ 
+} ; // End of GALGAS_gtlProfileMap_2D_element class
+
+
+//----------------------------------------------------------------------------------------------------------------------
+
+extern const C_galgas_type_descriptor kTypeDescriptor_GALGAS_gtlProfileMap_2D_element ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Extension setter '@gtlProfileMap addCosts'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+void extensionSetter_addCosts (class GALGAS_gtlProfileMap & ioObject,
+                               const class GALGAS_string constin_key,
+                               const class GALGAS_uint constin_count,
+                               const class GALGAS_uint constin_time,
+                               const class GALGAS_uint constin_cpu,
+                               const class GALGAS_uint constin_allocations,
+                               const class GALGAS_uint_36__34_ constin_allocatedBytes,
+                               class C_Compiler * inCompiler
+                               COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Extension setter '@gtlProfileMap addSample'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+void extensionSetter_addSample (class GALGAS_gtlProfileMap & ioObject,
+                                const class GALGAS_string constin_key,
+                                const class GALGAS_timer constin_timer,
+                                class C_Compiler * inCompiler
+                                COMMA_LOCATION_ARGS) ;
+
 //----------------------------------------------------------------------------------------------------------------------
 //
 // Phase 1: @debugCommandInput class
@@ -2414,7 +2740,11 @@ class GALGAS_library : public AC_GALGAS_class {
                                                         const class GALGAS_gtlGetterMap & inOperand1,
                                                         const class GALGAS_gtlSetterMap & inOperand2,
                                                         const class GALGAS_gtlTemplateMap & inOperand3,
-                                                        const class GALGAS_stringset & inOperand4
+                                                        const class GALGAS_stringset & inOperand4,
+                                                        const class GALGAS_gtlProfileMap & inOperand5,
+                                                        const class GALGAS_gtlProfileMap & inOperand6,
+                                                        const class GALGAS_string & inOperand7,
+                                                        const class GALGAS_string & inOperand8
                                                         COMMA_LOCATION_ARGS) ;
 
 //--------------------------------- Comparison
@@ -2430,9 +2760,21 @@ class GALGAS_library : public AC_GALGAS_class {
   public : VIRTUAL_IN_DEBUG void setter_setGetterMap (class GALGAS_gtlGetterMap inArgument0
                                                       COMMA_LOCATION_ARGS) ;
 
+  public : VIRTUAL_IN_DEBUG void setter_setLineProfile (class GALGAS_gtlProfileMap inArgument0
+                                                        COMMA_LOCATION_ARGS) ;
+
+  public : VIRTUAL_IN_DEBUG void setter_setOutputFile (class GALGAS_string inArgument0
+                                                       COMMA_LOCATION_ARGS) ;
+
+  public : VIRTUAL_IN_DEBUG void setter_setProfileStack (class GALGAS_string inArgument0
+                                                         COMMA_LOCATION_ARGS) ;
+
   public : VIRTUAL_IN_DEBUG void setter_setSetterMap (class GALGAS_gtlSetterMap inArgument0
                                                       COMMA_LOCATION_ARGS) ;
 
+  public : VIRTUAL_IN_DEBUG void setter_setStackProfile (class GALGAS_gtlProfileMap inArgument0
+                                                         COMMA_LOCATION_ARGS) ;
+
   public : VIRTUAL_IN_DEBUG void setter_setTemplateMap (class GALGAS_gtlTemplateMap inArgument0
                                                         COMMA_LOCATION_ARGS) ;
 
@@ -2447,8 +2789,16 @@ class GALGAS_library : public AC_GALGAS_class {
 
   public : VIRTUAL_IN_DEBUG class GALGAS_gtlGetterMap getter_getterMap (LOCATION_ARGS) const ;
 
+  public : VIRTUAL_IN_DEBUG class GALGAS_gtlProfileMap getter_lineProfile (LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_string getter_outputFile (LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_string getter_profileStack (LOCATION_ARGS) const ;
+
   public : VIRTUAL_IN_DEBUG class GALGAS_gtlSetterMap getter_setterMap (LOCATION_ARGS) const ;
 
+  public : VIRTUAL_IN_DEBUG class GALGAS_gtlProfileMap getter_stackProfile (LOCATION_ARGS) const ;
+
   public : VIRTUAL_IN_DEBUG class GALGAS_gtlTemplateMap getter_templateMap (LOCATION_ARGS) const ;
 
 
@@ -3401,13 +3751,21 @@ class cPtr_library : public acPtr_class {
   public : GALGAS_gtlSetterMap mProperty_setterMap ;
   public : GALGAS_gtlTemplateMap mProperty_templateMap ;
   public : GALGAS_stringset mProperty_doneImports ;
+  public : GALGAS_gtlProfileMap mProperty_lineProfile ;
+  public : GALGAS_gtlProfileMap mProperty_stackProfile ;
+  public : GALGAS_string mProperty_profileStack ;
+  public : GALGAS_string mProperty_outputFile ;
 
 //--- Constructor
   public : cPtr_library (const GALGAS_gtlFuncMap & in_funcMap,
                          const GALGAS_gtlGetterMap & in_getterMap,
                          const GALGAS_gtlSetterMap & in_setterMap,
                          const GALGAS_gtlTemplateMap & in_templateMap,
-                         const GALGAS_stringset & in_doneImports
+                         const GALGAS_stringset & in_doneImports,
+                         const GALGAS_gtlProfileMap & in_lineProfile,
+                         const GALGAS_gtlProfileMap & in_stackProfile,
+                         const GALGAS_string & in_profileStack,
+                         const GALGAS_string & in_outputFile
                          COMMA_LOCATION_ARGS) ;
 
 //--- Duplication
@@ -3424,6 +3782,14 @@ class cPtr_library : public acPtr_class {
   public : VIRTUAL_IN_DEBUG void setter_setTemplateMap (GALGAS_gtlTemplateMap inValue COMMA_LOCATION_ARGS) ;
   public : VIRTUAL_IN_DEBUG GALGAS_stringset getter_doneImports (LOCATION_ARGS) const ;
   public : VIRTUAL_IN_DEBUG void setter_setDoneImports (GALGAS_stringset inValue COMMA_LOCATION_ARGS) ;
+  public : VIRTUAL_IN_DEBUG GALGAS_gtlProfileMap getter_lineProfile (LOCATION_ARGS) const ;
+  public : VIRTUAL_IN_DEBUG void setter_setLineProfile (GALGAS_gtlProfileMap inValue COMMA_LOCATION_ARGS) ;
+  public : VIRTUAL_IN_DEBUG GALGAS_gtlProfileMap getter_stackProfile (LOCATION_ARGS) const ;
+  public : VIRTUAL_IN_DEBUG void setter_setStackProfile (GALGAS_gtlProfileMap inValue COMMA_LOCATION_ARGS) ;
+  public : VIRTUAL_IN_DEBUG GALGAS_string getter_profileStack (LOCATION_ARGS) const ;
+  public : VIRTUAL_IN_DEBUG void setter_setProfileStack (GALGAS_string inValue COMMA_LOCATION_ARGS) ;
+  public : VIRTUAL_IN_DEBUG GALGAS_string getter_outputFile (LOCATION_ARGS) const ;
+  public : VIRTUAL_IN_DEBUG void setter_setOutputFile (GALGAS_string inValue COMMA_LOCATION_ARGS) ;
 //--- Description
   public : virtual void description (C_String & ioString,
                                      const int32_t inIndentation) const ;
@@ -3434,6 +3800,31 @@ class cPtr_library : public acPtr_class {
 
 } ;
 
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Extension setter '@library profileInstruction'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+typedef void (*extensionSetterSignature_library_profileInstruction) (class cPtr_library * inObject,
+                                                                     const class GALGAS_gtlInstruction constinArgument0,
+                                                                     const class GALGAS_timer constinArgument1,
+                                                                     class C_Compiler * inCompiler
+                                                                     COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void enterExtensionSetter_profileInstruction (const int32_t inClassIndex,
+                                              extensionSetterSignature_library_profileInstruction inModifier) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void callExtensionSetter_profileInstruction (class cPtr_library * inObject,
+                                             const GALGAS_gtlInstruction constin_instruction,
+                                             const GALGAS_timer constin_timer,
+                                             C_Compiler * inCompiler
+                                             COMMA_LOCATION_ARGS) ;
+
 //----------------------------------------------------------------------------------------------------------------------
 //
 //LEXIQUE gtl_5F_scanner
@@ -11072,6 +11463,26 @@ class cPtr_gtlXorExpression : public cPtr_gtlBinaryExpression {
 class GALGAS_lstring function_emptylstring (class C_Compiler * inCompiler
                                             COMMA_LOCATION_ARGS) ;
 
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Function 'literalKind'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+class GALGAS_uint function_literalKind (class GALGAS_gtlExpression inArgument0,
+                                        class C_Compiler * inCompiler
+                                        COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Function 'foldConstants'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+class GALGAS_gtlExpression function_foldConstants (class GALGAS_gtlExpression inArgument0,
+                                                   class C_Compiler * inCompiler
+                                                   COMMA_LOCATION_ARGS) ;
+
 //----------------------------------------------------------------------------------------------------------------------
 //
 //Extension getter '@lstring gtlType' (as function)
@@ -11091,6 +11502,8 @@ class GALGAS_type extensionGetter_gtlType (const class GALGAS_lstring & inObject
 
 extern C_BoolCommandLineOption gOption_gtl_5F_options_debug ;
 
+extern C_BoolCommandLineOption gOption_gtl_5F_options_profile ;
+
 extern C_BoolCommandLineOption gOption_gtl_5F_options_warnDeprecated ;
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -11099,6 +11512,8 @@ extern C_BoolCommandLineOption gOption_gtl_5F_options_warnDeprecated ;
 //
 //----------------------------------------------------------------------------------------------------------------------
 
+extern C_UIntCommandLineOption gOption_gtl_5F_options_jobs ;
+
 //----------------------------------------------------------------------------------------------------------------------
 //
 //                              String options                                                   
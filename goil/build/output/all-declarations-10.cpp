@@ -21,7 +21,7 @@ static GALGAS_gtlData extensionGetter_gtlStruct_leOp (const cPtr_gtlData * inObj
   const cPtr_gtlStruct * object = (const cPtr_gtlStruct *) inObject ;
   macroValidSharedObject (object, cPtr_gtlStruct) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("struct forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3386)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("struct forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3389)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -52,7 +52,7 @@ static GALGAS_type extensionGetter_gtlStruct_embeddedType (const cPtr_gtlData *
   const cPtr_gtlStruct * object = (const cPtr_gtlStruct *) inObject ;
   macroValidSharedObject (object, cPtr_gtlStruct) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("struct forbidden as built in function argument"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3391)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("struct forbidden as built in function argument"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3394)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -82,7 +82,7 @@ static void extensionMethod_gtlStruct_addMyValue (const cPtr_gtlData * inObject,
                                                   COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlStruct * object = (const cPtr_gtlStruct *) inObject ;
   macroValidSharedObject (object, cPtr_gtlStruct) ;
-  ioArgument_objectList.addAssign_operation (object->mProperty_value.getter_object (SOURCE_FILE ("gtl_data_types.galgas", 3396))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3396)) ;
+  ioArgument_objectList.addAssign_operation (object->mProperty_value.getter_object (SOURCE_FILE ("gtl_data_types.galgas", 3399))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3399)) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -114,71 +114,71 @@ static GALGAS_gtlData extensionGetter_gtlStruct_performGetter (const cPtr_gtlDat
   macroValidSharedObject (object, cPtr_gtlStruct) ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = GALGAS_bool (kIsEqual, GALGAS_string ("map").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3409)))).boolEnum () ;
+    test_0 = GALGAS_bool (kIsEqual, GALGAS_string ("map").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3412)))).boolEnum () ;
     if (kBoolTrue == test_0) {
       {
-      routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3410)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3410)) ;
+      routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3413)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3413)) ;
       }
-      result_result = GALGAS_gtlMap::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3412)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3413)), object->mProperty_value  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3411)) ;
+      result_result = GALGAS_gtlMap::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3415)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3416)), object->mProperty_value  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3414)) ;
     }
   }
   if (kBoolFalse == test_0) {
     enumGalgasBool test_1 = kBoolTrue ;
     if (kBoolTrue == test_1) {
-      test_1 = GALGAS_bool (kIsEqual, GALGAS_string ("type").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3416)))).boolEnum () ;
+      test_1 = GALGAS_bool (kIsEqual, GALGAS_string ("type").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3419)))).boolEnum () ;
       if (kBoolTrue == test_1) {
         {
-        routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3417)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3417)) ;
+        routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3420)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3420)) ;
         }
         const GALGAS_gtlStruct temp_2 = object ;
-        result_result = GALGAS_gtlType::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3419)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3419)), temp_2.getter_dynamicType (SOURCE_FILE ("gtl_data_types.galgas", 3419))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3418)) ;
+        result_result = GALGAS_gtlType::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3422)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3422)), temp_2.getter_dynamicType (SOURCE_FILE ("gtl_data_types.galgas", 3422))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3421)) ;
       }
     }
     if (kBoolFalse == test_1) {
       enumGalgasBool test_3 = kBoolTrue ;
       if (kBoolTrue == test_3) {
-        test_3 = GALGAS_bool (kIsEqual, GALGAS_string ("isANumber").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3421)))).boolEnum () ;
+        test_3 = GALGAS_bool (kIsEqual, GALGAS_string ("isANumber").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3424)))).boolEnum () ;
         if (kBoolTrue == test_3) {
           {
-          routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3422)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3422)) ;
+          routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3425)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3425)) ;
           }
-          result_result = GALGAS_gtlBool::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3424)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3424)), GALGAS_bool (false)  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3423)) ;
+          result_result = GALGAS_gtlBool::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3427)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3427)), GALGAS_bool (false)  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3426)) ;
         }
       }
       if (kBoolFalse == test_3) {
         enumGalgasBool test_4 = kBoolTrue ;
         if (kBoolTrue == test_4) {
-          test_4 = GALGAS_bool (kIsEqual, GALGAS_string ("description").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3426)))).boolEnum () ;
+          test_4 = GALGAS_bool (kIsEqual, GALGAS_string ("description").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3429)))).boolEnum () ;
           if (kBoolTrue == test_4) {
             {
-            routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3427)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3427)) ;
+            routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3430)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3430)) ;
             }
-            result_result = GALGAS_gtlString::constructor_new (object->mProperty_meta.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3429)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3429)), object->mProperty_meta.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3429))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3428)) ;
+            result_result = GALGAS_gtlString::constructor_new (object->mProperty_meta.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3432)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3432)), object->mProperty_meta.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3432))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3431)) ;
           }
         }
         if (kBoolFalse == test_4) {
           enumGalgasBool test_5 = kBoolTrue ;
           if (kBoolTrue == test_5) {
-            test_5 = callExtensionGetter_getterExists ((const cPtr_library *) constinArgument_lib.ptr (), GALGAS_string ("struct"), constinArgument_methodName, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3431)).boolEnum () ;
+            test_5 = callExtensionGetter_getterExists ((const cPtr_library *) constinArgument_lib.ptr (), GALGAS_string ("struct"), constinArgument_methodName, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3434)).boolEnum () ;
             if (kBoolTrue == test_5) {
               const GALGAS_gtlStruct temp_6 = object ;
-              result_result = callExtensionGetter_callGetter ((const cPtr_gtlGetter *) callExtensionGetter_getGetter ((const cPtr_library *) constinArgument_lib.ptr (), GALGAS_string ("struct"), constinArgument_methodName, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3432)).ptr (), constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3433)), constinArgument_context, constinArgument_lib, temp_6, constinArgument_arguments, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3432)) ;
+              result_result = callExtensionGetter_callGetter ((const cPtr_gtlGetter *) callExtensionGetter_getGetter ((const cPtr_library *) constinArgument_lib.ptr (), GALGAS_string ("struct"), constinArgument_methodName, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3435)).ptr (), constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3436)), constinArgument_context, constinArgument_lib, temp_6, constinArgument_arguments, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3435)) ;
             }
           }
           if (kBoolFalse == test_5) {
             enumGalgasBool test_7 = kBoolTrue ;
             if (kBoolTrue == test_7) {
-              test_7 = GALGAS_bool (kIsEqual, GALGAS_string ("location").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3439)))).boolEnum () ;
+              test_7 = GALGAS_bool (kIsEqual, GALGAS_string ("location").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3442)))).boolEnum () ;
               if (kBoolTrue == test_7) {
                 {
-                routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3440)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3440)) ;
+                routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3443)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3443)) ;
                 }
-                result_result = GALGAS_gtlString::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3442)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3442)), object->mProperty_where.getter_locationString (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3442))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3441)) ;
+                result_result = GALGAS_gtlString::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3445)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3445)), object->mProperty_where.getter_locationString (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3445))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3444)) ;
               }
             }
             if (kBoolFalse == test_7) {
               TC_Array <C_FixItDescription> fixItArray8 ;
-              inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3445)), GALGAS_string ("unknown getter '").add_operation (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3445)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3445)).add_operation (GALGAS_string ("' for struct target"), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3445)), fixItArray8  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3445)) ;
+              inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3448)), GALGAS_string ("unknown getter '").add_operation (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3448)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3448)).add_operation (GALGAS_string ("' for struct target"), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3448)), fixItArray8  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3448)) ;
               result_result.drop () ; // Release error dropped variable
             }
           }
@@ -219,61 +219,61 @@ static void extensionSetter_gtlStruct_performSetter (cPtr_gtlData * inObject,
   macroValidSharedObject (object, cPtr_gtlStruct) ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = GALGAS_bool (kIsEqual, GALGAS_string ("setDescription").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3459)))).boolEnum () ;
+    test_0 = GALGAS_bool (kIsEqual, GALGAS_string ("setDescription").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3462)))).boolEnum () ;
     if (kBoolTrue == test_0) {
       {
-      routine_argumentsCheck (constinArgument_methodName, function_stringArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3460)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3460)) ;
+      routine_argumentsCheck (constinArgument_methodName, function_stringArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3463)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3463)) ;
       }
       GALGAS_gtlString temp_1 ;
-      if (constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3461)).isValid ()) {
-        if (NULL != dynamic_cast <const cPtr_gtlString *> (constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3461)).ptr ())) {
-          temp_1 = (cPtr_gtlString *) constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3461)).ptr () ;
+      if (constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3464)).isValid ()) {
+        if (NULL != dynamic_cast <const cPtr_gtlString *> (constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3464)).ptr ())) {
+          temp_1 = (cPtr_gtlString *) constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3464)).ptr () ;
         }else{
-          inCompiler->castError ("gtlString", constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3461)).ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3461)) ;
+          inCompiler->castError ("gtlString", constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3464)).ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3464)) ;
         }
       }
       GALGAS_gtlString var_descriptionToSet_108319 = temp_1 ;
       {
-      object->setter_setMeta (callExtensionGetter_lstring ((const cPtr_gtlString *) var_descriptionToSet_108319.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3462)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3462)) ;
+      object->setter_setMeta (callExtensionGetter_lstring ((const cPtr_gtlString *) var_descriptionToSet_108319.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3465)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3465)) ;
       }
-      object->mProperty_where = constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3463)) ;
+      object->mProperty_where = constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3466)) ;
     }
   }
   if (kBoolFalse == test_0) {
     enumGalgasBool test_2 = kBoolTrue ;
     if (kBoolTrue == test_2) {
-      test_2 = GALGAS_bool (kIsEqual, GALGAS_string ("touch").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3464)))).boolEnum () ;
+      test_2 = GALGAS_bool (kIsEqual, GALGAS_string ("touch").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3467)))).boolEnum () ;
       if (kBoolTrue == test_2) {
         {
-        routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3465)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3465)) ;
+        routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3468)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3468)) ;
         }
-        object->mProperty_where = constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3466)) ;
+        object->mProperty_where = constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3469)) ;
       }
     }
     if (kBoolFalse == test_2) {
       enumGalgasBool test_3 = kBoolTrue ;
       if (kBoolTrue == test_3) {
-        test_3 = callExtensionGetter_setterExists ((const cPtr_library *) constinArgument_lib.ptr (), GALGAS_string ("struct"), constinArgument_methodName, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3467)).boolEnum () ;
+        test_3 = callExtensionGetter_setterExists ((const cPtr_library *) constinArgument_lib.ptr (), GALGAS_string ("struct"), constinArgument_methodName, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3470)).boolEnum () ;
         if (kBoolTrue == test_3) {
           const GALGAS_gtlStruct temp_4 = object ;
           GALGAS_gtlData var_copy_108617 = temp_4 ;
-          callExtensionMethod_callSetter ((const cPtr_gtlSetter *) callExtensionGetter_getSetter ((const cPtr_library *) constinArgument_lib.ptr (), GALGAS_string ("struct"), constinArgument_methodName, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3469)).ptr (), constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3470)), constinArgument_context, constinArgument_lib, var_copy_108617, constinArgument_arguments, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3469)) ;
+          callExtensionMethod_callSetter ((const cPtr_gtlSetter *) callExtensionGetter_getSetter ((const cPtr_library *) constinArgument_lib.ptr (), GALGAS_string ("struct"), constinArgument_methodName, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3472)).ptr (), constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3473)), constinArgument_context, constinArgument_lib, var_copy_108617, constinArgument_arguments, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3472)) ;
           GALGAS_gtlStruct temp_5 ;
           if (var_copy_108617.isValid ()) {
             if (NULL != dynamic_cast <const cPtr_gtlStruct *> (var_copy_108617.ptr ())) {
               temp_5 = (cPtr_gtlStruct *) var_copy_108617.ptr () ;
             }else{
-              inCompiler->castError ("gtlStruct", var_copy_108617.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3476)) ;
+              inCompiler->castError ("gtlStruct", var_copy_108617.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3479)) ;
             }
           }
-          object->mProperty_value = temp_5.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 3476)) ;
-          object->mProperty_where = var_copy_108617.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 3477)) ;
-          object->mProperty_meta = var_copy_108617.getter_meta (SOURCE_FILE ("gtl_data_types.galgas", 3478)) ;
+          object->mProperty_value = temp_5.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 3479)) ;
+          object->mProperty_where = var_copy_108617.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 3480)) ;
+          object->mProperty_meta = var_copy_108617.getter_meta (SOURCE_FILE ("gtl_data_types.galgas", 3481)) ;
         }
       }
       if (kBoolFalse == test_3) {
         TC_Array <C_FixItDescription> fixItArray6 ;
-        inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3480)), GALGAS_string ("unknown setter '").add_operation (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3480)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3480)).add_operation (GALGAS_string ("' for struct target"), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3480)), fixItArray6  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3480)) ;
+        inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3483)), GALGAS_string ("unknown setter '").add_operation (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3483)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3483)).add_operation (GALGAS_string ("' for struct target"), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3483)), fixItArray6  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3483)) ;
       }
     }
   }
@@ -305,14 +305,14 @@ static void extensionMethod_gtlStruct_structField (const cPtr_gtlData * inObject
   macroValidSharedObject (object, cPtr_gtlStruct) ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = object->mProperty_value.getter_hasKey (constinArgument_name.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3492)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3492)).boolEnum () ;
+    test_0 = object->mProperty_value.getter_hasKey (constinArgument_name.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3495)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3495)).boolEnum () ;
     if (kBoolTrue == test_0) {
-      object->mProperty_value.method_get (constinArgument_name, outArgument_result, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3493)) ;
+      object->mProperty_value.method_get (constinArgument_name, outArgument_result, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3496)) ;
       outArgument_found = GALGAS_bool (true) ;
     }
   }
   if (kBoolFalse == test_0) {
-    outArgument_result = GALGAS_gtlUnconstructed::constructor_new (constinArgument_name.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3496)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3496))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3496)) ;
+    outArgument_result = GALGAS_gtlUnconstructed::constructor_new (constinArgument_name.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3499)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3499))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3499)) ;
     outArgument_found = GALGAS_bool (false) ;
   }
 }
@@ -343,13 +343,13 @@ static GALGAS_gtlData extensionGetter_gtlStruct_resultField (const cPtr_gtlData
   macroValidSharedObject (object, cPtr_gtlStruct) ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = object->mProperty_value.getter_hasKey (constinArgument_name.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3505)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3505)).boolEnum () ;
+    test_0 = object->mProperty_value.getter_hasKey (constinArgument_name.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3508)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3508)).boolEnum () ;
     if (kBoolTrue == test_0) {
-      object->mProperty_value.method_get (constinArgument_name, result_result, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3506)) ;
+      object->mProperty_value.method_get (constinArgument_name, result_result, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3509)) ;
     }
   }
   if (kBoolFalse == test_0) {
-    result_result = GALGAS_gtlUnconstructed::constructor_new (constinArgument_name.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3508)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3508))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3508)) ;
+    result_result = GALGAS_gtlUnconstructed::constructor_new (constinArgument_name.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3511)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3511))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3511)) ;
   }
 //---
   return result_result ;
@@ -380,7 +380,7 @@ static GALGAS_bool extensionGetter_gtlStruct_hasStructField (const cPtr_gtlData
   GALGAS_bool result_result ; // Returned variable
   const cPtr_gtlStruct * object = (const cPtr_gtlStruct *) inObject ;
   macroValidSharedObject (object, cPtr_gtlStruct) ;
-  result_result = object->mProperty_value.getter_hasKey (constinArgument_name.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3519)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3519)) ;
+  result_result = object->mProperty_value.getter_hasKey (constinArgument_name.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3522)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3522)) ;
 //---
   return result_result ;
 }
@@ -411,7 +411,7 @@ static void extensionSetter_gtlStruct_setStructField (cPtr_gtlData * inObject,
   cPtr_gtlStruct * object = (cPtr_gtlStruct *) inObject ;
   macroValidSharedObject (object, cPtr_gtlStruct) ;
   {
-  extensionSetter_replaceOrCreate (object->mProperty_value, constinArgument_name, constinArgument_data, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3529)) ;
+  extensionSetter_replaceOrCreate (object->mProperty_value, constinArgument_name, constinArgument_data, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3532)) ;
   }
 }
 //----------------------------------------------------------------------------------------------------------------------
@@ -440,7 +440,7 @@ static void extensionSetter_gtlStruct_setStructFieldAtLevel (cPtr_gtlData * inOb
   cPtr_gtlStruct * object = (cPtr_gtlStruct *) inObject ;
   macroValidSharedObject (object, cPtr_gtlStruct) ;
   {
-  extensionSetter_replaceOrCreateAtLevel (object->mProperty_value, constinArgument_name, constinArgument_data, constinArgument_level, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3540)) ;
+  extensionSetter_replaceOrCreateAtLevel (object->mProperty_value, constinArgument_name, constinArgument_data, constinArgument_level, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3543)) ;
   }
 }
 //----------------------------------------------------------------------------------------------------------------------
@@ -468,7 +468,7 @@ static void extensionSetter_gtlStruct_deleteStructField (cPtr_gtlData * inObject
   macroValidSharedObject (object, cPtr_gtlStruct) ;
   {
   GALGAS_gtlData joker_110926 ; // Joker input parameter
-  object->mProperty_value.setter_del (constinArgument_name, joker_110926, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3549)) ;
+  object->mProperty_value.setter_del (constinArgument_name, joker_110926, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3552)) ;
   }
 }
 //----------------------------------------------------------------------------------------------------------------------
@@ -495,15 +495,15 @@ static GALGAS_string extensionGetter_gtlList_desc (const cPtr_gtlData * inObject
   GALGAS_string result_result ; // Returned variable
   const cPtr_gtlList * object = (const cPtr_gtlList *) inObject ;
   macroValidSharedObject (object, cPtr_gtlList) ;
-  result_result = GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (32)), constinArgument_tab  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3561)).add_operation (GALGAS_string ("list: @(\n"), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3561)) ;
+  result_result = GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (32)), constinArgument_tab  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3564)).add_operation (GALGAS_string ("list: @(\n"), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3564)) ;
   cEnumerator_list enumerator_111340 (object->mProperty_value, kENUMERATION_UP) ;
   GALGAS_uint index_111328 ((uint32_t) 0) ;
   while (enumerator_111340.hasCurrentObject ()) {
-    result_result.plusAssign_operation(GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (32)), constinArgument_tab.add_operation (GALGAS_uint ((uint32_t) 4U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3564))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3564)).add_operation (index_111328.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3565)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3564)).add_operation (GALGAS_string (" :>\n"), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3565)).add_operation (callExtensionGetter_desc ((const cPtr_gtlData *) enumerator_111340.current_value (HERE).ptr (), constinArgument_tab.add_operation (GALGAS_uint ((uint32_t) 8U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3566)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3566)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3565)), inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3564)) ;
+    result_result.plusAssign_operation(GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (32)), constinArgument_tab.add_operation (GALGAS_uint ((uint32_t) 4U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3567))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3567)).add_operation (index_111328.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3568)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3567)).add_operation (GALGAS_string (" :>\n"), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3568)).add_operation (callExtensionGetter_desc ((const cPtr_gtlData *) enumerator_111340.current_value (HERE).ptr (), constinArgument_tab.add_operation (GALGAS_uint ((uint32_t) 8U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3569)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3569)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3568)), inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3567)) ;
     enumerator_111340.gotoNextObject () ;
-    index_111328.increment_operation (inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3563)) ;
+    index_111328.increment_operation (inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3566)) ;
   }
-  result_result.plusAssign_operation(GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (32)), constinArgument_tab  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3568)).add_operation (GALGAS_string (")\n"), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3568)), inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3568)) ;
+  result_result.plusAssign_operation(GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (32)), constinArgument_tab  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3571)).add_operation (GALGAS_string (")\n"), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3571)), inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3571)) ;
 //---
   return result_result ;
 }
@@ -533,7 +533,7 @@ static GALGAS_string extensionGetter_gtlList_string (const cPtr_gtlData * inObje
   const cPtr_gtlList * object = (const cPtr_gtlList *) inObject ;
   macroValidSharedObject (object, cPtr_gtlList) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("list forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3572)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("list forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3575)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -564,7 +564,7 @@ static GALGAS_lstring extensionGetter_gtlList_lstring (const cPtr_gtlData * inOb
   const cPtr_gtlList * object = (const cPtr_gtlList *) inObject ;
   macroValidSharedObject (object, cPtr_gtlList) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("list forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3576)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("list forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3579)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -595,7 +595,7 @@ static GALGAS_bool extensionGetter_gtlList_bool (const cPtr_gtlData * inObject,
   const cPtr_gtlList * object = (const cPtr_gtlList *) inObject ;
   macroValidSharedObject (object, cPtr_gtlList) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("cannot cast a list to a bool"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3580)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("cannot cast a list to a bool"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3583)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -626,7 +626,7 @@ static GALGAS_bigint extensionGetter_gtlList_int (const cPtr_gtlData * inObject,
   const cPtr_gtlList * object = (const cPtr_gtlList *) inObject ;
   macroValidSharedObject (object, cPtr_gtlList) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("cannot cast a list to an int"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3584)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("cannot cast a list to an int"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3587)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -657,7 +657,7 @@ static GALGAS_double extensionGetter_gtlList_float (const cPtr_gtlData * inObjec
   const cPtr_gtlList * object = (const cPtr_gtlList *) inObject ;
   macroValidSharedObject (object, cPtr_gtlList) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("cannot cast a list to a float"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3588)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("cannot cast a list to a float"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3591)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -688,7 +688,7 @@ static GALGAS_gtlData extensionGetter_gtlList_plusOp (const cPtr_gtlData * inObj
   const cPtr_gtlList * object = (const cPtr_gtlList *) inObject ;
   macroValidSharedObject (object, cPtr_gtlList) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("list forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3592)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("list forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3595)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -719,7 +719,7 @@ static GALGAS_gtlData extensionGetter_gtlList_minusOp (const cPtr_gtlData * inOb
   const cPtr_gtlList * object = (const cPtr_gtlList *) inObject ;
   macroValidSharedObject (object, cPtr_gtlList) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("list forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3596)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("list forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3599)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -750,7 +750,7 @@ static GALGAS_gtlData extensionGetter_gtlList_notOp (const cPtr_gtlData * inObje
   const cPtr_gtlList * object = (const cPtr_gtlList *) inObject ;
   macroValidSharedObject (object, cPtr_gtlList) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("list forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3600)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("list forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3603)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -782,8 +782,8 @@ static GALGAS_gtlData extensionGetter_gtlList_addOp (const cPtr_gtlData * inObje
   const cPtr_gtlList * object = (const cPtr_gtlList *) inObject ;
   macroValidSharedObject (object, cPtr_gtlList) ;
   GALGAS_list var_res_112459 = object->mProperty_value ;
-  var_res_112459.addAssign_operation (constinArgument_right  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3605)) ;
-  result_result = GALGAS_gtlList::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3606)), var_res_112459  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3606)) ;
+  var_res_112459.addAssign_operation (constinArgument_right  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3608)) ;
+  result_result = GALGAS_gtlList::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3609)), var_res_112459  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3609)) ;
 //---
   return result_result ;
 }
@@ -814,7 +814,7 @@ static GALGAS_gtlData extensionGetter_gtlList_subOp (const cPtr_gtlData * inObje
   const cPtr_gtlList * object = (const cPtr_gtlList *) inObject ;
   macroValidSharedObject (object, cPtr_gtlList) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("list forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3610)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("list forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3613)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -846,7 +846,7 @@ static GALGAS_gtlData extensionGetter_gtlList_mulOp (const cPtr_gtlData * inObje
   const cPtr_gtlList * object = (const cPtr_gtlList *) inObject ;
   macroValidSharedObject (object, cPtr_gtlList) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("list forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3614)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("list forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3617)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -878,7 +878,7 @@ static GALGAS_gtlData extensionGetter_gtlList_divOp (const cPtr_gtlData * inObje
   const cPtr_gtlList * object = (const cPtr_gtlList *) inObject ;
   macroValidSharedObject (object, cPtr_gtlList) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("list forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3618)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("list forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3621)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -910,7 +910,7 @@ static GALGAS_gtlData extensionGetter_gtlList_modOp (const cPtr_gtlData * inObje
   const cPtr_gtlList * object = (const cPtr_gtlList *) inObject ;
   macroValidSharedObject (object, cPtr_gtlList) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("list forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3622)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("list forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3625)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -942,7 +942,7 @@ static GALGAS_gtlData extensionGetter_gtlList_andOp (const cPtr_gtlData * inObje
   const cPtr_gtlList * object = (const cPtr_gtlList *) inObject ;
   macroValidSharedObject (object, cPtr_gtlList) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("list forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3626)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("list forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3629)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -982,15 +982,15 @@ static GALGAS_gtlData extensionGetter_gtlList_orOp (const cPtr_gtlData * inObjec
         if (NULL != dynamic_cast <const cPtr_gtlList *> (constinArgument_right.ptr ())) {
           temp_1 = (cPtr_gtlList *) constinArgument_right.ptr () ;
         }else{
-          inCompiler->castError ("gtlList", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3634)) ;
+          inCompiler->castError ("gtlList", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3637)) ;
         }
       }
-      result_result = GALGAS_gtlList::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3633)), object->mProperty_value.add_operation (temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 3634)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3634))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3631)) ;
+      result_result = GALGAS_gtlList::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3636)), object->mProperty_value.add_operation (temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 3637)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3637))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3634)) ;
     }
   }
   if (kBoolFalse == test_0) {
     TC_Array <C_FixItDescription> fixItArray2 ;
-    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 3637)), GALGAS_string ("list expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3637)) ;
+    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 3640)), GALGAS_string ("list expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3640)) ;
     result_result.drop () ; // Release error dropped variable
   }
 //---
@@ -1023,7 +1023,7 @@ static GALGAS_gtlData extensionGetter_gtlList_xorOp (const cPtr_gtlData * inObje
   const cPtr_gtlList * object = (const cPtr_gtlList *) inObject ;
   macroValidSharedObject (object, cPtr_gtlList) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("list forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3642)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("list forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3645)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -1055,7 +1055,7 @@ static GALGAS_gtlData extensionGetter_gtlList_slOp (const cPtr_gtlData * inObjec
   const cPtr_gtlList * object = (const cPtr_gtlList *) inObject ;
   macroValidSharedObject (object, cPtr_gtlList) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("list forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3646)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("list forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3649)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -1087,7 +1087,7 @@ static GALGAS_gtlData extensionGetter_gtlList_srOp (const cPtr_gtlData * inObjec
   const cPtr_gtlList * object = (const cPtr_gtlList *) inObject ;
   macroValidSharedObject (object, cPtr_gtlList) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("list forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3650)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("list forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3653)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -1127,14 +1127,14 @@ static GALGAS_gtlData extensionGetter_gtlList_neqOp (const cPtr_gtlData * inObje
         if (NULL != dynamic_cast <const cPtr_gtlList *> (constinArgument_right.ptr ())) {
           temp_1 = (cPtr_gtlList *) constinArgument_right.ptr () ;
         }else{
-          inCompiler->castError ("gtlList", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3655)) ;
+          inCompiler->castError ("gtlList", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3658)) ;
         }
       }
-      GALGAS_list var_rValue_113937 = temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 3655)) ;
+      GALGAS_list var_rValue_113937 = temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 3658)) ;
       GALGAS_bool var_equal_113981 ;
       enumGalgasBool test_2 = kBoolTrue ;
       if (kBoolTrue == test_2) {
-        test_2 = GALGAS_bool (kIsNotEqual, object->mProperty_value.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3657)).objectCompare (var_rValue_113937.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3657)))).boolEnum () ;
+        test_2 = GALGAS_bool (kIsNotEqual, object->mProperty_value.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3660)).objectCompare (var_rValue_113937.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3660)))).boolEnum () ;
         if (kBoolTrue == test_2) {
           var_equal_113981 = GALGAS_bool (false) ;
         }
@@ -1144,17 +1144,17 @@ static GALGAS_gtlData extensionGetter_gtlList_neqOp (const cPtr_gtlData * inObje
         cEnumerator_list enumerator_114101 (object->mProperty_value, kENUMERATION_UP) ;
         cEnumerator_list enumerator_114120 (var_rValue_113937, kENUMERATION_UP) ;
         while (enumerator_114101.hasCurrentObject () && enumerator_114120.hasCurrentObject ()) {
-          var_equal_113981 = var_equal_113981.operator_and (callExtensionGetter_bool ((const cPtr_gtlData *) callExtensionGetter_eqOp ((const cPtr_gtlData *) enumerator_114101.current_value (HERE).ptr (), enumerator_114120.current_value (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3662)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3662)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3662)) ;
+          var_equal_113981 = var_equal_113981.operator_and (callExtensionGetter_bool ((const cPtr_gtlData *) callExtensionGetter_eqOp ((const cPtr_gtlData *) enumerator_114101.current_value (HERE).ptr (), enumerator_114120.current_value (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3665)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3665)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3665)) ;
           enumerator_114101.gotoNextObject () ;
           enumerator_114120.gotoNextObject () ;
         }
       }
-      result_result = GALGAS_gtlBool::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3665)), var_equal_113981.operator_not (SOURCE_FILE ("gtl_data_types.galgas", 3665))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3665)) ;
+      result_result = GALGAS_gtlBool::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3668)), var_equal_113981.operator_not (SOURCE_FILE ("gtl_data_types.galgas", 3668))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3668)) ;
     }
   }
   if (kBoolFalse == test_0) {
     TC_Array <C_FixItDescription> fixItArray3 ;
-    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 3667)), GALGAS_string ("list expected"), fixItArray3  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3667)) ;
+    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 3670)), GALGAS_string ("list expected"), fixItArray3  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3670)) ;
     result_result.drop () ; // Release error dropped variable
   }
 //---
@@ -1195,14 +1195,14 @@ static GALGAS_gtlData extensionGetter_gtlList_eqOp (const cPtr_gtlData * inObjec
         if (NULL != dynamic_cast <const cPtr_gtlList *> (constinArgument_right.ptr ())) {
           temp_1 = (cPtr_gtlList *) constinArgument_right.ptr () ;
         }else{
-          inCompiler->castError ("gtlList", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3673)) ;
+          inCompiler->castError ("gtlList", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3676)) ;
         }
       }
-      GALGAS_list var_rValue_114434 = temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 3673)) ;
+      GALGAS_list var_rValue_114434 = temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 3676)) ;
       GALGAS_bool var_equal_114478 ;
       enumGalgasBool test_2 = kBoolTrue ;
       if (kBoolTrue == test_2) {
-        test_2 = GALGAS_bool (kIsNotEqual, object->mProperty_value.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3675)).objectCompare (var_rValue_114434.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3675)))).boolEnum () ;
+        test_2 = GALGAS_bool (kIsNotEqual, object->mProperty_value.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3678)).objectCompare (var_rValue_114434.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3678)))).boolEnum () ;
         if (kBoolTrue == test_2) {
           var_equal_114478 = GALGAS_bool (false) ;
         }
@@ -1212,17 +1212,17 @@ static GALGAS_gtlData extensionGetter_gtlList_eqOp (const cPtr_gtlData * inObjec
         cEnumerator_list enumerator_114598 (object->mProperty_value, kENUMERATION_UP) ;
         cEnumerator_list enumerator_114617 (var_rValue_114434, kENUMERATION_UP) ;
         while (enumerator_114598.hasCurrentObject () && enumerator_114617.hasCurrentObject ()) {
-          var_equal_114478 = var_equal_114478.operator_and (callExtensionGetter_bool ((const cPtr_gtlData *) callExtensionGetter_eqOp ((const cPtr_gtlData *) enumerator_114598.current_value (HERE).ptr (), enumerator_114617.current_value (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3680)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3680)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3680)) ;
+          var_equal_114478 = var_equal_114478.operator_and (callExtensionGetter_bool ((const cPtr_gtlData *) callExtensionGetter_eqOp ((const cPtr_gtlData *) enumerator_114598.current_value (HERE).ptr (), enumerator_114617.current_value (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3683)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3683)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3683)) ;
           enumerator_114598.gotoNextObject () ;
           enumerator_114617.gotoNextObject () ;
         }
       }
-      result_result = GALGAS_gtlBool::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3683)), var_equal_114478  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3683)) ;
+      result_result = GALGAS_gtlBool::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3686)), var_equal_114478  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3686)) ;
     }
   }
   if (kBoolFalse == test_0) {
     TC_Array <C_FixItDescription> fixItArray3 ;
-    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 3685)), GALGAS_string ("list expected"), fixItArray3  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3685)) ;
+    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 3688)), GALGAS_string ("list expected"), fixItArray3  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3688)) ;
     result_result.drop () ; // Release error dropped variable
   }
 //---
@@ -1255,7 +1255,7 @@ static GALGAS_gtlData extensionGetter_gtlList_gtOp (const cPtr_gtlData * inObjec
   const cPtr_gtlList * object = (const cPtr_gtlList *) inObject ;
   macroValidSharedObject (object, cPtr_gtlList) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("a list does not support the > operator"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3690)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("a list does not support the > operator"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3693)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -1287,7 +1287,7 @@ static GALGAS_gtlData extensionGetter_gtlList_geOp (const cPtr_gtlData * inObjec
   const cPtr_gtlList * object = (const cPtr_gtlList *) inObject ;
   macroValidSharedObject (object, cPtr_gtlList) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("a list does not support the >= operator"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3694)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("a list does not support the >= operator"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3697)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -1319,7 +1319,7 @@ static GALGAS_gtlData extensionGetter_gtlList_ltOp (const cPtr_gtlData * inObjec
   const cPtr_gtlList * object = (const cPtr_gtlList *) inObject ;
   macroValidSharedObject (object, cPtr_gtlList) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("a list does not support the < operator"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3698)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("a list does not support the < operator"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3701)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -1351,7 +1351,7 @@ static GALGAS_gtlData extensionGetter_gtlList_leOp (const cPtr_gtlData * inObjec
   const cPtr_gtlList * object = (const cPtr_gtlList *) inObject ;
   macroValidSharedObject (object, cPtr_gtlList) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("a list does not support the <= operator"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3702)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("a list does not support the <= operator"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3705)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -1382,7 +1382,7 @@ static GALGAS_type extensionGetter_gtlList_embeddedType (const cPtr_gtlData * in
   const cPtr_gtlList * object = (const cPtr_gtlList *) inObject ;
   macroValidSharedObject (object, cPtr_gtlList) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("list forbidden as built in function argument"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3707)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("list forbidden as built in function argument"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3710)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -1412,7 +1412,7 @@ static void extensionMethod_gtlList_addMyValue (const cPtr_gtlData * inObject,
                                                 COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlList * object = (const cPtr_gtlList *) inObject ;
   macroValidSharedObject (object, cPtr_gtlList) ;
-  ioArgument_objectList.addAssign_operation (object->mProperty_value.getter_object (SOURCE_FILE ("gtl_data_types.galgas", 3712))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3712)) ;
+  ioArgument_objectList.addAssign_operation (object->mProperty_value.getter_object (SOURCE_FILE ("gtl_data_types.galgas", 3715))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3715)) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -1444,55 +1444,55 @@ static GALGAS_gtlData extensionGetter_gtlList_performGetter (const cPtr_gtlData
   macroValidSharedObject (object, cPtr_gtlList) ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = GALGAS_bool (kIsEqual, GALGAS_string ("length").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3725)))).boolEnum () ;
+    test_0 = GALGAS_bool (kIsEqual, GALGAS_string ("length").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3728)))).boolEnum () ;
     if (kBoolTrue == test_0) {
       {
-      routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3726)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3726)) ;
+      routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3729)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3729)) ;
       }
-      result_result = GALGAS_gtlInt::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3728)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3729)), object->mProperty_value.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3730)).getter_bigint (SOURCE_FILE ("gtl_data_types.galgas", 3730))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3727)) ;
+      result_result = GALGAS_gtlInt::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3731)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3732)), object->mProperty_value.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3733)).getter_bigint (SOURCE_FILE ("gtl_data_types.galgas", 3733))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3730)) ;
     }
   }
   if (kBoolFalse == test_0) {
     enumGalgasBool test_1 = kBoolTrue ;
     if (kBoolTrue == test_1) {
-      test_1 = GALGAS_bool (kIsEqual, GALGAS_string ("first").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3732)))).boolEnum () ;
+      test_1 = GALGAS_bool (kIsEqual, GALGAS_string ("first").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3735)))).boolEnum () ;
       if (kBoolTrue == test_1) {
         {
-        routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3733)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3733)) ;
+        routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3736)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3736)) ;
         }
-        object->mProperty_value.method_first (result_result, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3734)) ;
+        object->mProperty_value.method_first (result_result, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3737)) ;
       }
     }
     if (kBoolFalse == test_1) {
       enumGalgasBool test_2 = kBoolTrue ;
       if (kBoolTrue == test_2) {
-        test_2 = GALGAS_bool (kIsEqual, GALGAS_string ("last").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3735)))).boolEnum () ;
+        test_2 = GALGAS_bool (kIsEqual, GALGAS_string ("last").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3738)))).boolEnum () ;
         if (kBoolTrue == test_2) {
           {
-          routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3736)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3736)) ;
+          routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3739)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3739)) ;
           }
-          object->mProperty_value.method_last (result_result, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3737)) ;
+          object->mProperty_value.method_last (result_result, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3740)) ;
         }
       }
       if (kBoolFalse == test_2) {
         enumGalgasBool test_3 = kBoolTrue ;
         if (kBoolTrue == test_3) {
-          test_3 = GALGAS_bool (kIsEqual, GALGAS_string ("elementAtIndex").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3738)))).boolEnum () ;
+          test_3 = GALGAS_bool (kIsEqual, GALGAS_string ("elementAtIndex").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3741)))).boolEnum () ;
           if (kBoolTrue == test_3) {
             {
-            routine_argumentsCheck (constinArgument_methodName, function_intArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3739)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3739)) ;
+            routine_argumentsCheck (constinArgument_methodName, function_intArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3742)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3742)) ;
             }
-            GALGAS_uint var_index_116626 = callExtensionGetter_int ((const cPtr_gtlData *) constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3740)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3740)).getter_uint (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3740)) ;
+            GALGAS_uint var_index_116626 = callExtensionGetter_int ((const cPtr_gtlData *) constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3743)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3743)).getter_uint (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3743)) ;
             enumGalgasBool test_4 = kBoolTrue ;
             if (kBoolTrue == test_4) {
-              test_4 = GALGAS_bool (kIsStrictInf, var_index_116626.objectCompare (object->mProperty_value.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3741)))).boolEnum () ;
+              test_4 = GALGAS_bool (kIsStrictInf, var_index_116626.objectCompare (object->mProperty_value.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3744)))).boolEnum () ;
               if (kBoolTrue == test_4) {
-                result_result = object->mProperty_value.getter_valueAtIndex (var_index_116626, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3742)) ;
+                result_result = object->mProperty_value.getter_valueAtIndex (var_index_116626, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3745)) ;
               }
             }
             if (kBoolFalse == test_4) {
               TC_Array <C_FixItDescription> fixItArray5 ;
-              inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3744)), GALGAS_string ("index out of bounds"), fixItArray5  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3744)) ;
+              inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3747)), GALGAS_string ("index out of bounds"), fixItArray5  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3747)) ;
               result_result.drop () ; // Release error dropped variable
             }
           }
@@ -1500,17 +1500,17 @@ static GALGAS_gtlData extensionGetter_gtlList_performGetter (const cPtr_gtlData
         if (kBoolFalse == test_3) {
           enumGalgasBool test_6 = kBoolTrue ;
           if (kBoolTrue == test_6) {
-            test_6 = GALGAS_bool (kIsEqual, GALGAS_string ("subListTo").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3746)))).boolEnum () ;
+            test_6 = GALGAS_bool (kIsEqual, GALGAS_string ("subListTo").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3749)))).boolEnum () ;
             if (kBoolTrue == test_6) {
               {
-              routine_argumentsCheck (constinArgument_methodName, function_intArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3747)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3747)) ;
+              routine_argumentsCheck (constinArgument_methodName, function_intArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3750)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3750)) ;
               }
-              GALGAS_uint var_index_116938 = callExtensionGetter_int ((const cPtr_gtlData *) constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3748)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3748)).getter_uint (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3748)) ;
+              GALGAS_uint var_index_116938 = callExtensionGetter_int ((const cPtr_gtlData *) constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3751)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3751)).getter_uint (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3751)) ;
               enumGalgasBool test_7 = kBoolTrue ;
               if (kBoolTrue == test_7) {
-                test_7 = GALGAS_bool (kIsStrictInf, var_index_116938.objectCompare (object->mProperty_value.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3749)))).boolEnum () ;
+                test_7 = GALGAS_bool (kIsStrictInf, var_index_116938.objectCompare (object->mProperty_value.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3752)))).boolEnum () ;
                 if (kBoolTrue == test_7) {
-                  result_result = GALGAS_gtlList::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3751)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3752)), object->mProperty_value.getter_subListToIndex (var_index_116938, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3753))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3750)) ;
+                  result_result = GALGAS_gtlList::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3754)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3755)), object->mProperty_value.getter_subListToIndex (var_index_116938, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3756))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3753)) ;
                 }
               }
               if (kBoolFalse == test_7) {
@@ -1522,65 +1522,65 @@ static GALGAS_gtlData extensionGetter_gtlList_performGetter (const cPtr_gtlData
           if (kBoolFalse == test_6) {
             enumGalgasBool test_9 = kBoolTrue ;
             if (kBoolTrue == test_9) {
-              test_9 = GALGAS_bool (kIsEqual, GALGAS_string ("subListFrom").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3758)))).boolEnum () ;
+              test_9 = GALGAS_bool (kIsEqual, GALGAS_string ("subListFrom").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3761)))).boolEnum () ;
               if (kBoolTrue == test_9) {
                 {
-                routine_argumentsCheck (constinArgument_methodName, function_intArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3759)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3759)) ;
+                routine_argumentsCheck (constinArgument_methodName, function_intArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3762)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3762)) ;
                 }
-                GALGAS_uint var_index_117292 = callExtensionGetter_int ((const cPtr_gtlData *) constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3760)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3760)).getter_uint (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3760)) ;
+                GALGAS_uint var_index_117292 = callExtensionGetter_int ((const cPtr_gtlData *) constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3763)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3763)).getter_uint (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3763)) ;
                 enumGalgasBool test_10 = kBoolTrue ;
                 if (kBoolTrue == test_10) {
-                  test_10 = GALGAS_bool (kIsStrictInf, var_index_117292.objectCompare (object->mProperty_value.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3761)))).boolEnum () ;
+                  test_10 = GALGAS_bool (kIsStrictInf, var_index_117292.objectCompare (object->mProperty_value.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3764)))).boolEnum () ;
                   if (kBoolTrue == test_10) {
-                    result_result = GALGAS_gtlList::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3763)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3764)), object->mProperty_value.getter_subListFromIndex (var_index_117292, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3765))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3762)) ;
+                    result_result = GALGAS_gtlList::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3766)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3767)), object->mProperty_value.getter_subListFromIndex (var_index_117292, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3768))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3765)) ;
                   }
                 }
                 if (kBoolFalse == test_10) {
-                  result_result = GALGAS_gtlList::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3769)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3770)), GALGAS_list::constructor_emptyList (SOURCE_FILE ("gtl_data_types.galgas", 3771))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3768)) ;
+                  result_result = GALGAS_gtlList::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3772)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3773)), GALGAS_list::constructor_emptyList (SOURCE_FILE ("gtl_data_types.galgas", 3774))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3771)) ;
                 }
               }
             }
             if (kBoolFalse == test_9) {
               enumGalgasBool test_11 = kBoolTrue ;
               if (kBoolTrue == test_11) {
-                test_11 = GALGAS_bool (kIsEqual, GALGAS_string ("subList").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3774)))).boolEnum () ;
+                test_11 = GALGAS_bool (kIsEqual, GALGAS_string ("subList").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3777)))).boolEnum () ;
                 if (kBoolTrue == test_11) {
                   {
-                  routine_argumentsCheck (constinArgument_methodName, function_intIntArguments (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3775)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3775)) ;
+                  routine_argumentsCheck (constinArgument_methodName, function_intIntArguments (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3778)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3778)) ;
                   }
-                  GALGAS_uint var_start_117734 = callExtensionGetter_int ((const cPtr_gtlData *) constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3776)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3776)).getter_uint (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3776)) ;
-                  GALGAS_uint var_length_117787 = callExtensionGetter_int ((const cPtr_gtlData *) constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3777)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3777)).getter_uint (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3777)) ;
+                  GALGAS_uint var_start_117734 = callExtensionGetter_int ((const cPtr_gtlData *) constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3779)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3779)).getter_uint (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3779)) ;
+                  GALGAS_uint var_length_117787 = callExtensionGetter_int ((const cPtr_gtlData *) constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3780)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3780)).getter_uint (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3780)) ;
                   enumGalgasBool test_12 = kBoolTrue ;
                   if (kBoolTrue == test_12) {
-                    test_12 = GALGAS_bool (kIsStrictInf, var_start_117734.objectCompare (object->mProperty_value.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3778)))).boolEnum () ;
+                    test_12 = GALGAS_bool (kIsStrictInf, var_start_117734.objectCompare (object->mProperty_value.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3781)))).boolEnum () ;
                     if (kBoolTrue == test_12) {
                       enumGalgasBool test_13 = kBoolTrue ;
                       if (kBoolTrue == test_13) {
-                        test_13 = GALGAS_bool (kIsStrictSup, var_start_117734.add_operation (var_length_117787, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3779)).objectCompare (object->mProperty_value.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3779)))).boolEnum () ;
+                        test_13 = GALGAS_bool (kIsStrictSup, var_start_117734.add_operation (var_length_117787, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3782)).objectCompare (object->mProperty_value.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3782)))).boolEnum () ;
                         if (kBoolTrue == test_13) {
-                          var_length_117787 = object->mProperty_value.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3780)).substract_operation (var_start_117734, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3780)) ;
+                          var_length_117787 = object->mProperty_value.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3783)).substract_operation (var_start_117734, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3783)) ;
                         }
                       }
-                      result_result = GALGAS_gtlList::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3783)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3784)), object->mProperty_value.getter_subListWithRange (GALGAS_range::constructor_new (var_start_117734, var_length_117787  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3785)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3785))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3782)) ;
+                      result_result = GALGAS_gtlList::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3786)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3787)), object->mProperty_value.getter_subListWithRange (GALGAS_range::constructor_new (var_start_117734, var_length_117787  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3788)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3788))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3785)) ;
                     }
                   }
                   if (kBoolFalse == test_12) {
-                    result_result = GALGAS_gtlList::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3789)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3790)), GALGAS_list::constructor_emptyList (SOURCE_FILE ("gtl_data_types.galgas", 3791))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3788)) ;
+                    result_result = GALGAS_gtlList::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3792)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3793)), GALGAS_list::constructor_emptyList (SOURCE_FILE ("gtl_data_types.galgas", 3794))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3791)) ;
                   }
                 }
               }
               if (kBoolFalse == test_11) {
                 enumGalgasBool test_14 = kBoolTrue ;
                 if (kBoolTrue == test_14) {
-                  test_14 = GALGAS_bool (kIsEqual, GALGAS_string ("mapBy").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3794)))).boolEnum () ;
+                  test_14 = GALGAS_bool (kIsEqual, GALGAS_string ("mapBy").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3797)))).boolEnum () ;
                   if (kBoolTrue == test_14) {
                     {
-                    routine_argumentsCheck (constinArgument_methodName, function_anyArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3795)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3795)) ;
+                    routine_argumentsCheck (constinArgument_methodName, function_anyArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3798)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3798)) ;
                     }
-                    GALGAS_lstring var_key_118346 = callExtensionGetter_lstring ((const cPtr_gtlData *) constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3796)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3796)) ;
-                    GALGAS_gtlVarMap var_resultMap_118410 = GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("gtl_data_types.galgas", 3797)) ;
+                    GALGAS_lstring var_key_118346 = callExtensionGetter_lstring ((const cPtr_gtlData *) constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3799)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3799)) ;
+                    GALGAS_gtlVarMap var_resultMap_118410 = GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("gtl_data_types.galgas", 3800)) ;
                     const GALGAS_gtlList temp_15 = object ;
-                    cEnumerator_list enumerator_118453 (temp_15.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 3798)), kENUMERATION_UP) ;
+                    cEnumerator_list enumerator_118453 (temp_15.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 3801)), kENUMERATION_UP) ;
                     GALGAS_uint index_118430 ((uint32_t) 0) ;
                     while (enumerator_118453.hasCurrentObject ()) {
                       if (enumerator_118453.current_value (HERE).isValid ()) {
@@ -1588,185 +1588,185 @@ static GALGAS_gtlData extensionGetter_gtlList_performGetter (const cPtr_gtlData
                           GALGAS_gtlStruct cast_118516_itemStruct ((cPtr_gtlStruct *) enumerator_118453.current_value (HERE).ptr ()) ;
                           enumGalgasBool test_16 = kBoolTrue ;
                           if (kBoolTrue == test_16) {
-                            test_16 = cast_118516_itemStruct.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 3801)).getter_hasKey (var_key_118346.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3801)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3801)).boolEnum () ;
+                            test_16 = cast_118516_itemStruct.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 3804)).getter_hasKey (var_key_118346.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3804)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3804)).boolEnum () ;
                             if (kBoolTrue == test_16) {
                               GALGAS_gtlData var_keyValue_118633 ;
-                              cast_118516_itemStruct.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 3802)).method_get (var_key_118346, var_keyValue_118633, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3802)) ;
+                              cast_118516_itemStruct.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 3805)).method_get (var_key_118346, var_keyValue_118633, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3805)) ;
                               {
-                              var_resultMap_118410.setter_put (callExtensionGetter_lstring ((const cPtr_gtlData *) var_keyValue_118633.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3804)), enumerator_118453.current_value (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3803)) ;
+                              var_resultMap_118410.setter_put (callExtensionGetter_lstring ((const cPtr_gtlData *) var_keyValue_118633.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3807)), enumerator_118453.current_value (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3806)) ;
                               }
                             }
                           }
                           if (kBoolFalse == test_16) {
                             TC_Array <C_FixItDescription> fixItArray17 ;
-                            inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3808)), GALGAS_string ("item at index ").add_operation (index_118430.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3808)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3808)).add_operation (GALGAS_string (" does not have field named "), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3808)).add_operation (var_key_118346.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3809)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3809)), fixItArray17  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3808)) ;
+                            inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3811)), GALGAS_string ("item at index ").add_operation (index_118430.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3811)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3811)).add_operation (GALGAS_string (" does not have field named "), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3811)).add_operation (var_key_118346.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3812)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3812)), fixItArray17  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3811)) ;
                           }
                         }else if (enumerator_118453.current_value (HERE).dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlMap) {
                           GALGAS_gtlMap cast_118882_itemMap ((cPtr_gtlMap *) enumerator_118453.current_value (HERE).ptr ()) ;
                           enumGalgasBool test_18 = kBoolTrue ;
                           if (kBoolTrue == test_18) {
-                            test_18 = cast_118882_itemMap.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 3812)).getter_hasKey (var_key_118346.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3812)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3812)).boolEnum () ;
+                            test_18 = cast_118882_itemMap.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 3815)).getter_hasKey (var_key_118346.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3815)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3815)).boolEnum () ;
                             if (kBoolTrue == test_18) {
                               GALGAS_gtlData var_keyValue_118993 ;
-                              cast_118882_itemMap.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 3813)).method_get (var_key_118346, var_keyValue_118993, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3813)) ;
+                              cast_118882_itemMap.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 3816)).method_get (var_key_118346, var_keyValue_118993, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3816)) ;
                               {
-                              var_resultMap_118410.setter_put (callExtensionGetter_lstring ((const cPtr_gtlData *) var_keyValue_118993.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3815)), enumerator_118453.current_value (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3814)) ;
+                              var_resultMap_118410.setter_put (callExtensionGetter_lstring ((const cPtr_gtlData *) var_keyValue_118993.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3818)), enumerator_118453.current_value (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3817)) ;
                               }
                             }
                           }
                           if (kBoolFalse == test_18) {
                             TC_Array <C_FixItDescription> fixItArray19 ;
-                            inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3819)), GALGAS_string ("item at index ").add_operation (index_118430.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3819)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3819)).add_operation (GALGAS_string (" does not have field named "), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3819)).add_operation (var_key_118346.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3820)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3820)), fixItArray19  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3819)) ;
+                            inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3822)), GALGAS_string ("item at index ").add_operation (index_118430.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3822)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3822)).add_operation (GALGAS_string (" does not have field named "), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3822)).add_operation (var_key_118346.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3823)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3823)), fixItArray19  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3822)) ;
                           }
                         }else{
                           TC_Array <C_FixItDescription> fixItArray20 ;
-                          inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3823)), GALGAS_string ("list of struct expected"), fixItArray20  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3823)) ;
+                          inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3826)), GALGAS_string ("list of struct expected"), fixItArray20  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3826)) ;
                         }
                       }
                       enumerator_118453.gotoNextObject () ;
-                      index_118430.increment_operation (inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3798)) ;
+                      index_118430.increment_operation (inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3801)) ;
                     }
-                    result_result = GALGAS_gtlMap::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3826)), var_resultMap_118410  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3826)) ;
+                    result_result = GALGAS_gtlMap::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3829)), var_resultMap_118410  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3829)) ;
                   }
                 }
                 if (kBoolFalse == test_14) {
                   enumGalgasBool test_21 = kBoolTrue ;
                   if (kBoolTrue == test_21) {
-                    test_21 = GALGAS_bool (kIsEqual, GALGAS_string ("set").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3827)))).boolEnum () ;
+                    test_21 = GALGAS_bool (kIsEqual, GALGAS_string ("set").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3830)))).boolEnum () ;
                     if (kBoolTrue == test_21) {
                       {
-                      routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3828)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3828)) ;
+                      routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3831)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3831)) ;
                       }
-                      GALGAS_lstringset var_resultSet_119492 = GALGAS_lstringset::constructor_emptyMap (SOURCE_FILE ("gtl_data_types.galgas", 3829)) ;
+                      GALGAS_lstringset var_resultSet_119492 = GALGAS_lstringset::constructor_emptyMap (SOURCE_FILE ("gtl_data_types.galgas", 3832)) ;
                       cEnumerator_list enumerator_119528 (object->mProperty_value, kENUMERATION_UP) ;
                       while (enumerator_119528.hasCurrentObject ()) {
-                        GALGAS_lstring var_itemKey_119554 = callExtensionGetter_lstring ((const cPtr_gtlData *) enumerator_119528.current_value (HERE).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3831)) ;
+                        GALGAS_lstring var_itemKey_119554 = callExtensionGetter_lstring ((const cPtr_gtlData *) enumerator_119528.current_value (HERE).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3834)) ;
                         enumGalgasBool test_22 = kBoolTrue ;
                         if (kBoolTrue == test_22) {
-                          test_22 = var_resultSet_119492.getter_hasKey (var_itemKey_119554.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3832)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3832)).boolEnum () ;
+                          test_22 = var_resultSet_119492.getter_hasKey (var_itemKey_119554.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3835)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3835)).boolEnum () ;
                           if (kBoolTrue == test_22) {
                             {
-                            var_resultSet_119492.setter_del (var_itemKey_119554, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3833)) ;
+                            var_resultSet_119492.setter_del (var_itemKey_119554, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3836)) ;
                             }
                           }
                         }
                         {
-                        var_resultSet_119492.setter_put (var_itemKey_119554, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3835)) ;
+                        var_resultSet_119492.setter_put (var_itemKey_119554, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3838)) ;
                         }
                         enumerator_119528.gotoNextObject () ;
                       }
-                      result_result = GALGAS_gtlSet::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3838)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3838)), var_resultSet_119492  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3837)) ;
+                      result_result = GALGAS_gtlSet::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3841)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3841)), var_resultSet_119492  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3840)) ;
                     }
                   }
                   if (kBoolFalse == test_21) {
                     enumGalgasBool test_23 = kBoolTrue ;
                     if (kBoolTrue == test_23) {
-                      test_23 = GALGAS_bool (kIsEqual, GALGAS_string ("setBy").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3840)))).boolEnum () ;
+                      test_23 = GALGAS_bool (kIsEqual, GALGAS_string ("setBy").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3843)))).boolEnum () ;
                       if (kBoolTrue == test_23) {
                         {
-                        routine_argumentsCheck (constinArgument_methodName, function_stringArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3841)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3841)) ;
+                        routine_argumentsCheck (constinArgument_methodName, function_stringArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3844)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3844)) ;
                         }
-                        GALGAS_lstring var_key_119909 = callExtensionGetter_lstring ((const cPtr_gtlData *) constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3842)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3842)) ;
-                        GALGAS_lstringset var_resultSet_119974 = GALGAS_lstringset::constructor_emptyMap (SOURCE_FILE ("gtl_data_types.galgas", 3843)) ;
+                        GALGAS_lstring var_key_119909 = callExtensionGetter_lstring ((const cPtr_gtlData *) constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3845)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3845)) ;
+                        GALGAS_lstringset var_resultSet_119974 = GALGAS_lstringset::constructor_emptyMap (SOURCE_FILE ("gtl_data_types.galgas", 3846)) ;
                         cEnumerator_list enumerator_120010 (object->mProperty_value, kENUMERATION_UP) ;
                         while (enumerator_120010.hasCurrentObject ()) {
                           GALGAS_gtlData var_field_120058 ;
                           GALGAS_bool joker_120060 ; // Joker input parameter
-                          callExtensionMethod_structField ((const cPtr_gtlData *) enumerator_120010.current_value (HERE).ptr (), var_key_119909, var_field_120058, joker_120060, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3845)) ;
-                          GALGAS_lstring var_resKey_120084 = callExtensionGetter_lstring ((const cPtr_gtlData *) var_field_120058.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3846)) ;
+                          callExtensionMethod_structField ((const cPtr_gtlData *) enumerator_120010.current_value (HERE).ptr (), var_key_119909, var_field_120058, joker_120060, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3848)) ;
+                          GALGAS_lstring var_resKey_120084 = callExtensionGetter_lstring ((const cPtr_gtlData *) var_field_120058.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3849)) ;
                           enumGalgasBool test_24 = kBoolTrue ;
                           if (kBoolTrue == test_24) {
-                            test_24 = var_resultSet_119974.getter_hasKey (var_resKey_120084.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3847)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3847)).boolEnum () ;
+                            test_24 = var_resultSet_119974.getter_hasKey (var_resKey_120084.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3850)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3850)).boolEnum () ;
                             if (kBoolTrue == test_24) {
                               {
-                              var_resultSet_119974.setter_del (var_resKey_120084, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3848)) ;
+                              var_resultSet_119974.setter_del (var_resKey_120084, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3851)) ;
                               }
                             }
                           }
                           {
-                          var_resultSet_119974.setter_put (var_resKey_120084, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3850)) ;
+                          var_resultSet_119974.setter_put (var_resKey_120084, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3853)) ;
                           }
                           enumerator_120010.gotoNextObject () ;
                         }
-                        result_result = GALGAS_gtlSet::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3853)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3853)), var_resultSet_119974  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3852)) ;
+                        result_result = GALGAS_gtlSet::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3856)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3856)), var_resultSet_119974  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3855)) ;
                       }
                     }
                     if (kBoolFalse == test_23) {
                       enumGalgasBool test_25 = kBoolTrue ;
                       if (kBoolTrue == test_25) {
-                        test_25 = GALGAS_bool (kIsEqual, GALGAS_string ("componentsJoinedByString").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3855)))).boolEnum () ;
+                        test_25 = GALGAS_bool (kIsEqual, GALGAS_string ("componentsJoinedByString").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3858)))).boolEnum () ;
                         if (kBoolTrue == test_25) {
                           {
-                          routine_argumentsCheck (constinArgument_methodName, function_stringArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3856)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3856)) ;
+                          routine_argumentsCheck (constinArgument_methodName, function_stringArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3859)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3859)) ;
                           }
-                          GALGAS_string var_joiner_120439 = callExtensionGetter_string ((const cPtr_gtlData *) constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3857)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3857)) ;
+                          GALGAS_string var_joiner_120439 = callExtensionGetter_string ((const cPtr_gtlData *) constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3860)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3860)) ;
                           GALGAS_string var_stringResult_120502 = GALGAS_string::makeEmptyString () ;
                           cEnumerator_list enumerator_120531 (object->mProperty_value, kENUMERATION_UP) ;
                           while (enumerator_120531.hasCurrentObject ()) {
-                            var_stringResult_120502 = var_stringResult_120502.add_operation (callExtensionGetter_string ((const cPtr_gtlData *) enumerator_120531.current_value (HERE).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3861)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3861)) ;
+                            var_stringResult_120502 = var_stringResult_120502.add_operation (callExtensionGetter_string ((const cPtr_gtlData *) enumerator_120531.current_value (HERE).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3864)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3864)) ;
                             if (enumerator_120531.hasNextObject ()) {
-                              var_stringResult_120502 = var_stringResult_120502.add_operation (var_joiner_120439, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3863)) ;
+                              var_stringResult_120502 = var_stringResult_120502.add_operation (var_joiner_120439, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3866)) ;
                             }
                             enumerator_120531.gotoNextObject () ;
                           }
-                          result_result = GALGAS_gtlString::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3866)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3866)), var_stringResult_120502  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3865)) ;
+                          result_result = GALGAS_gtlString::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3869)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3869)), var_stringResult_120502  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3868)) ;
                         }
                       }
                       if (kBoolFalse == test_25) {
                         enumGalgasBool test_26 = kBoolTrue ;
                         if (kBoolTrue == test_26) {
-                          test_26 = GALGAS_bool (kIsEqual, GALGAS_string ("type").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3868)))).boolEnum () ;
+                          test_26 = GALGAS_bool (kIsEqual, GALGAS_string ("type").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3871)))).boolEnum () ;
                           if (kBoolTrue == test_26) {
                             {
-                            routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3869)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3869)) ;
+                            routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3872)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3872)) ;
                             }
                             const GALGAS_gtlList temp_27 = object ;
-                            result_result = GALGAS_gtlType::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3871)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3871)), temp_27.getter_dynamicType (SOURCE_FILE ("gtl_data_types.galgas", 3871))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3870)) ;
+                            result_result = GALGAS_gtlType::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3874)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3874)), temp_27.getter_dynamicType (SOURCE_FILE ("gtl_data_types.galgas", 3874))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3873)) ;
                           }
                         }
                         if (kBoolFalse == test_26) {
                           enumGalgasBool test_28 = kBoolTrue ;
                           if (kBoolTrue == test_28) {
-                            test_28 = GALGAS_bool (kIsEqual, GALGAS_string ("isANumber").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3873)))).boolEnum () ;
+                            test_28 = GALGAS_bool (kIsEqual, GALGAS_string ("isANumber").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3876)))).boolEnum () ;
                             if (kBoolTrue == test_28) {
                               {
-                              routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3874)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3874)) ;
+                              routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3877)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3877)) ;
                               }
-                              result_result = GALGAS_gtlBool::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3876)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3876)), GALGAS_bool (false)  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3875)) ;
+                              result_result = GALGAS_gtlBool::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3879)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3879)), GALGAS_bool (false)  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3878)) ;
                             }
                           }
                           if (kBoolFalse == test_28) {
                             enumGalgasBool test_29 = kBoolTrue ;
                             if (kBoolTrue == test_29) {
-                              test_29 = GALGAS_bool (kIsEqual, GALGAS_string ("description").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3878)))).boolEnum () ;
+                              test_29 = GALGAS_bool (kIsEqual, GALGAS_string ("description").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3881)))).boolEnum () ;
                               if (kBoolTrue == test_29) {
                                 {
-                                routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3879)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3879)) ;
+                                routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3882)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3882)) ;
                                 }
-                                result_result = GALGAS_gtlString::constructor_new (object->mProperty_meta.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3881)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3881)), object->mProperty_meta.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3881))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3880)) ;
+                                result_result = GALGAS_gtlString::constructor_new (object->mProperty_meta.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3884)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3884)), object->mProperty_meta.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3884))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3883)) ;
                               }
                             }
                             if (kBoolFalse == test_29) {
                               enumGalgasBool test_30 = kBoolTrue ;
                               if (kBoolTrue == test_30) {
-                                test_30 = GALGAS_bool (kIsEqual, GALGAS_string ("where").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3883)))).boolEnum () ;
+                                test_30 = GALGAS_bool (kIsEqual, GALGAS_string ("where").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3886)))).boolEnum () ;
                                 if (kBoolTrue == test_30) {
                                   enumGalgasBool test_31 = kBoolTrue ;
                                   if (kBoolTrue == test_31) {
-                                    test_31 = GALGAS_bool (kIsStrictInf, constinArgument_arguments.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3884)).objectCompare (GALGAS_uint ((uint32_t) 1U))).operator_or (GALGAS_bool (kIsStrictSup, constinArgument_arguments.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3884)).objectCompare (GALGAS_uint ((uint32_t) 2U))) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3884)).boolEnum () ;
+                                    test_31 = GALGAS_bool (kIsStrictInf, constinArgument_arguments.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3887)).objectCompare (GALGAS_uint ((uint32_t) 1U))).operator_or (GALGAS_bool (kIsStrictSup, constinArgument_arguments.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3887)).objectCompare (GALGAS_uint ((uint32_t) 2U))) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3887)).boolEnum () ;
                                     if (kBoolTrue == test_31) {
                                       TC_Array <C_FixItDescription> fixItArray32 ;
-                                      inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3885)), GALGAS_string ("where expects 1 ou 2 arguments. ").add_operation (constinArgument_arguments.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3886)).getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3885)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3885)).add_operation (GALGAS_string (" arguments provided."), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3886)), fixItArray32  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3885)) ;
+                                      inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3888)), GALGAS_string ("where expects 1 ou 2 arguments. ").add_operation (constinArgument_arguments.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3889)).getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3888)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3888)).add_operation (GALGAS_string (" arguments provided."), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3889)), fixItArray32  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3888)) ;
                                       result_result.drop () ; // Release error dropped variable
                                     }
                                   }
                                   if (kBoolFalse == test_31) {
                                     enumGalgasBool test_33 = kBoolTrue ;
                                     if (kBoolTrue == test_33) {
-                                      test_33 = GALGAS_bool (kIsNotEqual, constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3888)).getter_dynamicType (SOURCE_FILE ("gtl_data_types.galgas", 3888)).objectCompare (GALGAS_type (& kTypeDescriptor_GALGAS_gtlExpr))).boolEnum () ;
+                                      test_33 = GALGAS_bool (kIsNotEqual, constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3891)).getter_dynamicType (SOURCE_FILE ("gtl_data_types.galgas", 3891)).objectCompare (GALGAS_type (& kTypeDescriptor_GALGAS_gtlExpr))).boolEnum () ;
                                       if (kBoolTrue == test_33) {
                                         TC_Array <C_FixItDescription> fixItArray34 ;
-                                        inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3889)), GALGAS_string ("expression expected for argument 1"), fixItArray34  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3889)) ;
+                                        inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3892)), GALGAS_string ("expression expected for argument 1"), fixItArray34  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3892)) ;
                                         result_result.drop () ; // Release error dropped variable
                                       }
                                     }
@@ -1774,24 +1774,24 @@ static GALGAS_gtlData extensionGetter_gtlList_performGetter (const cPtr_gtlData
                                       GALGAS_gtlStruct var_vars_121724 ;
                                       enumGalgasBool test_35 = kBoolTrue ;
                                       if (kBoolTrue == test_35) {
-                                        test_35 = GALGAS_bool (kIsEqual, constinArgument_arguments.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3892)).objectCompare (GALGAS_uint ((uint32_t) 2U))).boolEnum () ;
+                                        test_35 = GALGAS_bool (kIsEqual, constinArgument_arguments.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3895)).objectCompare (GALGAS_uint ((uint32_t) 2U))).boolEnum () ;
                                         if (kBoolTrue == test_35) {
                                           enumGalgasBool test_36 = kBoolTrue ;
                                           if (kBoolTrue == test_36) {
-                                            test_36 = GALGAS_bool (kIsNotEqual, constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3893)).getter_dynamicType (SOURCE_FILE ("gtl_data_types.galgas", 3893)).objectCompare (GALGAS_type (& kTypeDescriptor_GALGAS_gtlStruct))).boolEnum () ;
+                                            test_36 = GALGAS_bool (kIsNotEqual, constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3896)).getter_dynamicType (SOURCE_FILE ("gtl_data_types.galgas", 3896)).objectCompare (GALGAS_type (& kTypeDescriptor_GALGAS_gtlStruct))).boolEnum () ;
                                             if (kBoolTrue == test_36) {
                                               TC_Array <C_FixItDescription> fixItArray37 ;
-                                              inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3894)), GALGAS_string ("struct expected for argument 1"), fixItArray37  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3894)) ;
+                                              inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3897)), GALGAS_string ("struct expected for argument 1"), fixItArray37  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3897)) ;
                                               var_vars_121724.drop () ; // Release error dropped variable
                                             }
                                           }
                                           if (kBoolFalse == test_36) {
                                             GALGAS_gtlStruct temp_38 ;
-                                            if (constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3896)).isValid ()) {
-                                              if (NULL != dynamic_cast <const cPtr_gtlStruct *> (constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3896)).ptr ())) {
-                                                temp_38 = (cPtr_gtlStruct *) constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3896)).ptr () ;
+                                            if (constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3899)).isValid ()) {
+                                              if (NULL != dynamic_cast <const cPtr_gtlStruct *> (constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3899)).ptr ())) {
+                                                temp_38 = (cPtr_gtlStruct *) constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3899)).ptr () ;
                                               }else{
-                                                inCompiler->castError ("gtlStruct", constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3896)).ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3896)) ;
+                                                inCompiler->castError ("gtlStruct", constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3899)).ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3899)) ;
                                               }
                                             }
                                             var_vars_121724 = temp_38 ;
@@ -1799,36 +1799,36 @@ static GALGAS_gtlData extensionGetter_gtlList_performGetter (const cPtr_gtlData
                                         }
                                       }
                                       if (kBoolFalse == test_35) {
-                                        var_vars_121724 = GALGAS_gtlStruct::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3899)), GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("gtl_data_types.galgas", 3899))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3899)) ;
+                                        var_vars_121724 = GALGAS_gtlStruct::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3902)), GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("gtl_data_types.galgas", 3902))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3902)) ;
                                       }
                                       GALGAS_gtlExpr temp_39 ;
-                                      if (constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3901)).isValid ()) {
-                                        if (NULL != dynamic_cast <const cPtr_gtlExpr *> (constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3901)).ptr ())) {
-                                          temp_39 = (cPtr_gtlExpr *) constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3901)).ptr () ;
+                                      if (constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3904)).isValid ()) {
+                                        if (NULL != dynamic_cast <const cPtr_gtlExpr *> (constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3904)).ptr ())) {
+                                          temp_39 = (cPtr_gtlExpr *) constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3904)).ptr () ;
                                         }else{
-                                          inCompiler->castError ("gtlExpr", constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3901)).ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3901)) ;
+                                          inCompiler->castError ("gtlExpr", constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3904)).ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3904)) ;
                                         }
                                       }
-                                      GALGAS_gtlExpression var_expr_122111 = temp_39.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 3901)) ;
-                                      GALGAS_list var_resultList_122185 = GALGAS_list::constructor_emptyList (SOURCE_FILE ("gtl_data_types.galgas", 3902)) ;
+                                      GALGAS_gtlExpression var_expr_122111 = temp_39.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 3904)) ;
+                                      GALGAS_list var_resultList_122185 = GALGAS_list::constructor_emptyList (SOURCE_FILE ("gtl_data_types.galgas", 3905)) ;
                                       cEnumerator_list enumerator_122226 (object->mProperty_value, kENUMERATION_UP) ;
                                       while (enumerator_122226.hasCurrentObject ()) {
                                         {
                                         var_vars_121724.insulate (HERE) ;
                                         cPtr_gtlStruct * ptr_122255 = (cPtr_gtlStruct *) var_vars_121724.ptr () ;
-                                        callExtensionSetter_setStructField ((cPtr_gtlStruct *) ptr_122255, GALGAS_lstring::constructor_new (GALGAS_string ("__item__"), enumerator_122226.current_value (HERE).getter_where (SOURCE_FILE ("gtl_data_types.galgas", 3905))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3905)), enumerator_122226.current_value (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3905)) ;
+                                        callExtensionSetter_setStructField ((cPtr_gtlStruct *) ptr_122255, GALGAS_lstring::constructor_new (GALGAS_string ("__item__"), enumerator_122226.current_value (HERE).getter_where (SOURCE_FILE ("gtl_data_types.galgas", 3908))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3908)), enumerator_122226.current_value (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3908)) ;
                                         }
-                                        GALGAS_gtlData var_evalResult_122349 = callExtensionGetter_eval ((const cPtr_gtlExpression *) var_expr_122111.ptr (), constinArgument_context, var_vars_121724, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3906)) ;
+                                        GALGAS_gtlData var_evalResult_122349 = callExtensionGetter_eval ((const cPtr_gtlExpression *) var_expr_122111.ptr (), constinArgument_context, var_vars_121724, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3909)) ;
                                         enumGalgasBool test_40 = kBoolTrue ;
                                         if (kBoolTrue == test_40) {
-                                          test_40 = callExtensionGetter_bool ((const cPtr_gtlData *) var_evalResult_122349.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3907)).boolEnum () ;
+                                          test_40 = callExtensionGetter_bool ((const cPtr_gtlData *) var_evalResult_122349.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3910)).boolEnum () ;
                                           if (kBoolTrue == test_40) {
-                                            var_resultList_122185.addAssign_operation (enumerator_122226.current_value (HERE)  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3908)) ;
+                                            var_resultList_122185.addAssign_operation (enumerator_122226.current_value (HERE)  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3911)) ;
                                           }
                                         }
                                         enumerator_122226.gotoNextObject () ;
                                       }
-                                      result_result = GALGAS_gtlList::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3912)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3913)), var_resultList_122185  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3911)) ;
+                                      result_result = GALGAS_gtlList::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3915)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3916)), var_resultList_122185  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3914)) ;
                                     }
                                   }
                                 }
@@ -1836,26 +1836,26 @@ static GALGAS_gtlData extensionGetter_gtlList_performGetter (const cPtr_gtlData
                               if (kBoolFalse == test_30) {
                                 enumGalgasBool test_41 = kBoolTrue ;
                                 if (kBoolTrue == test_41) {
-                                  test_41 = callExtensionGetter_getterExists ((const cPtr_library *) constinArgument_lib.ptr (), GALGAS_string ("list"), constinArgument_methodName, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3918)).boolEnum () ;
+                                  test_41 = callExtensionGetter_getterExists ((const cPtr_library *) constinArgument_lib.ptr (), GALGAS_string ("list"), constinArgument_methodName, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3921)).boolEnum () ;
                                   if (kBoolTrue == test_41) {
                                     const GALGAS_gtlList temp_42 = object ;
-                                    result_result = callExtensionGetter_callGetter ((const cPtr_gtlGetter *) callExtensionGetter_getGetter ((const cPtr_library *) constinArgument_lib.ptr (), GALGAS_string ("list"), constinArgument_methodName, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3919)).ptr (), constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3920)), constinArgument_context, constinArgument_lib, temp_42, constinArgument_arguments, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3919)) ;
+                                    result_result = callExtensionGetter_callGetter ((const cPtr_gtlGetter *) callExtensionGetter_getGetter ((const cPtr_library *) constinArgument_lib.ptr (), GALGAS_string ("list"), constinArgument_methodName, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3922)).ptr (), constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3923)), constinArgument_context, constinArgument_lib, temp_42, constinArgument_arguments, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3922)) ;
                                   }
                                 }
                                 if (kBoolFalse == test_41) {
                                   enumGalgasBool test_43 = kBoolTrue ;
                                   if (kBoolTrue == test_43) {
-                                    test_43 = GALGAS_bool (kIsEqual, GALGAS_string ("location").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3926)))).boolEnum () ;
+                                    test_43 = GALGAS_bool (kIsEqual, GALGAS_string ("location").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3929)))).boolEnum () ;
                                     if (kBoolTrue == test_43) {
                                       {
-                                      routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3927)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3927)) ;
+                                      routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3930)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3930)) ;
                                       }
-                                      result_result = GALGAS_gtlString::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3929)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3929)), object->mProperty_where.getter_locationString (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3929))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3928)) ;
+                                      result_result = GALGAS_gtlString::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3932)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3932)), object->mProperty_where.getter_locationString (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3932))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3931)) ;
                                     }
                                   }
                                   if (kBoolFalse == test_43) {
                                     TC_Array <C_FixItDescription> fixItArray44 ;
-                                    inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3932)), GALGAS_string ("unknown getter '").add_operation (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3932)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3932)).add_operation (GALGAS_string ("' for list target"), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3932)), fixItArray44  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3932)) ;
+                                    inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3935)), GALGAS_string ("unknown getter '").add_operation (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3935)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3935)).add_operation (GALGAS_string ("' for list target"), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3935)), fixItArray44  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3935)) ;
                                     result_result.drop () ; // Release error dropped variable
                                   }
                                 }
@@ -1907,86 +1907,86 @@ static void extensionSetter_gtlList_performSetter (cPtr_gtlData * inObject,
   macroValidSharedObject (object, cPtr_gtlList) ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = GALGAS_bool (kIsEqual, GALGAS_string ("setDescription").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3946)))).boolEnum () ;
+    test_0 = GALGAS_bool (kIsEqual, GALGAS_string ("setDescription").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3949)))).boolEnum () ;
     if (kBoolTrue == test_0) {
       {
-      routine_argumentsCheck (constinArgument_methodName, function_stringArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3947)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3947)) ;
+      routine_argumentsCheck (constinArgument_methodName, function_stringArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3950)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3950)) ;
       }
       GALGAS_gtlString temp_1 ;
-      if (constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3948)).isValid ()) {
-        if (NULL != dynamic_cast <const cPtr_gtlString *> (constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3948)).ptr ())) {
-          temp_1 = (cPtr_gtlString *) constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3948)).ptr () ;
+      if (constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3951)).isValid ()) {
+        if (NULL != dynamic_cast <const cPtr_gtlString *> (constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3951)).ptr ())) {
+          temp_1 = (cPtr_gtlString *) constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3951)).ptr () ;
         }else{
-          inCompiler->castError ("gtlString", constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3948)).ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3948)) ;
+          inCompiler->castError ("gtlString", constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3951)).ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3951)) ;
         }
       }
       GALGAS_gtlString var_descriptionToSet_123599 = temp_1 ;
       {
-      object->setter_setMeta (callExtensionGetter_lstring ((const cPtr_gtlString *) var_descriptionToSet_123599.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3949)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3949)) ;
+      object->setter_setMeta (callExtensionGetter_lstring ((const cPtr_gtlString *) var_descriptionToSet_123599.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3952)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3952)) ;
       }
-      object->mProperty_where = constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3950)) ;
+      object->mProperty_where = constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3953)) ;
     }
   }
   if (kBoolFalse == test_0) {
     enumGalgasBool test_2 = kBoolTrue ;
     if (kBoolTrue == test_2) {
-      test_2 = GALGAS_bool (kIsEqual, GALGAS_string ("touch").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3951)))).boolEnum () ;
+      test_2 = GALGAS_bool (kIsEqual, GALGAS_string ("touch").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3954)))).boolEnum () ;
       if (kBoolTrue == test_2) {
         {
-        routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3952)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3952)) ;
+        routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3955)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3955)) ;
         }
-        object->mProperty_where = constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3953)) ;
+        object->mProperty_where = constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3956)) ;
       }
     }
     if (kBoolFalse == test_2) {
       enumGalgasBool test_3 = kBoolTrue ;
       if (kBoolTrue == test_3) {
-        test_3 = GALGAS_bool (kIsEqual, GALGAS_string ("insert").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3954)))).boolEnum () ;
+        test_3 = GALGAS_bool (kIsEqual, GALGAS_string ("insert").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3957)))).boolEnum () ;
         if (kBoolTrue == test_3) {
           {
-          routine_argumentsCheck (constinArgument_methodName, function_intAnyArguments (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3955)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3955)) ;
+          routine_argumentsCheck (constinArgument_methodName, function_intAnyArguments (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3958)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3958)) ;
           }
-          GALGAS_uint var_insertIndex_123950 = callExtensionGetter_int ((const cPtr_gtlData *) constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3956)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3956)).getter_uint (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3956)) ;
-          GALGAS_gtlData var_node_124003 = constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3957)) ;
+          GALGAS_uint var_insertIndex_123950 = callExtensionGetter_int ((const cPtr_gtlData *) constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3959)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3959)).getter_uint (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3959)) ;
+          GALGAS_gtlData var_node_124003 = constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3960)) ;
           enumGalgasBool test_4 = kBoolTrue ;
           if (kBoolTrue == test_4) {
-            test_4 = GALGAS_bool (kIsStrictInf, var_insertIndex_123950.objectCompare (object->mProperty_value.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3958)))).boolEnum () ;
+            test_4 = GALGAS_bool (kIsStrictInf, var_insertIndex_123950.objectCompare (object->mProperty_value.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3961)))).boolEnum () ;
             if (kBoolTrue == test_4) {
               {
-              object->mProperty_value.setter_insertAtIndex (var_node_124003, var_insertIndex_123950, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3959)) ;
+              object->mProperty_value.setter_insertAtIndex (var_node_124003, var_insertIndex_123950, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3962)) ;
               }
             }
           }
           if (kBoolFalse == test_4) {
-            object->mProperty_value.addAssign_operation (var_node_124003  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3961)) ;
+            object->mProperty_value.addAssign_operation (var_node_124003  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3964)) ;
           }
-          object->mProperty_where = constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3963)) ;
+          object->mProperty_where = constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3966)) ;
         }
       }
       if (kBoolFalse == test_3) {
         enumGalgasBool test_5 = kBoolTrue ;
         if (kBoolTrue == test_5) {
-          test_5 = callExtensionGetter_setterExists ((const cPtr_library *) constinArgument_lib.ptr (), GALGAS_string ("list"), constinArgument_methodName, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3964)).boolEnum () ;
+          test_5 = callExtensionGetter_setterExists ((const cPtr_library *) constinArgument_lib.ptr (), GALGAS_string ("list"), constinArgument_methodName, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3967)).boolEnum () ;
           if (kBoolTrue == test_5) {
             const GALGAS_gtlList temp_6 = object ;
             GALGAS_gtlData var_copy_124253 = temp_6 ;
-            callExtensionMethod_callSetter ((const cPtr_gtlSetter *) callExtensionGetter_getSetter ((const cPtr_library *) constinArgument_lib.ptr (), GALGAS_string ("list"), constinArgument_methodName, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3966)).ptr (), constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3967)), constinArgument_context, constinArgument_lib, var_copy_124253, constinArgument_arguments, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3966)) ;
+            callExtensionMethod_callSetter ((const cPtr_gtlSetter *) callExtensionGetter_getSetter ((const cPtr_library *) constinArgument_lib.ptr (), GALGAS_string ("list"), constinArgument_methodName, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3969)).ptr (), constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3970)), constinArgument_context, constinArgument_lib, var_copy_124253, constinArgument_arguments, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3969)) ;
             GALGAS_gtlList temp_7 ;
             if (var_copy_124253.isValid ()) {
               if (NULL != dynamic_cast <const cPtr_gtlList *> (var_copy_124253.ptr ())) {
                 temp_7 = (cPtr_gtlList *) var_copy_124253.ptr () ;
               }else{
-                inCompiler->castError ("gtlList", var_copy_124253.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3973)) ;
+                inCompiler->castError ("gtlList", var_copy_124253.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3976)) ;
               }
             }
-            object->mProperty_value = temp_7.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 3973)) ;
-            object->mProperty_where = var_copy_124253.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 3974)) ;
-            object->mProperty_meta = var_copy_124253.getter_meta (SOURCE_FILE ("gtl_data_types.galgas", 3975)) ;
+            object->mProperty_value = temp_7.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 3976)) ;
+            object->mProperty_where = var_copy_124253.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 3977)) ;
+            object->mProperty_meta = var_copy_124253.getter_meta (SOURCE_FILE ("gtl_data_types.galgas", 3978)) ;
           }
         }
         if (kBoolFalse == test_5) {
           TC_Array <C_FixItDescription> fixItArray8 ;
-          inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3977)), GALGAS_string ("unknown setter '").add_operation (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3977)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3977)).add_operation (GALGAS_string ("' for list target"), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3977)), fixItArray8  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3977)) ;
+          inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 3980)), GALGAS_string ("unknown setter '").add_operation (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 3980)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3980)).add_operation (GALGAS_string ("' for list target"), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3980)), fixItArray8  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3980)) ;
         }
       }
     }
@@ -2017,7 +2017,7 @@ static void extensionSetter_gtlList_setItemAtIndex (cPtr_gtlData * inObject,
   cPtr_gtlList * object = (cPtr_gtlList *) inObject ;
   macroValidSharedObject (object, cPtr_gtlList) ;
   {
-  object->mProperty_value.setter_setValueAtIndex (constinArgument_data, constinArgument_index.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 3985)).getter_uint (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3985)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3985)) ;
+  object->mProperty_value.setter_setValueAtIndex (constinArgument_data, constinArgument_index.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 3988)).getter_uint (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3988)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3988)) ;
   }
 }
 //----------------------------------------------------------------------------------------------------------------------
@@ -2043,28 +2043,28 @@ static void extensionSetter_gtlList_deleteItemAtIndex (cPtr_gtlData * inObject,
                                                        COMMA_UNUSED_LOCATION_ARGS) {
   cPtr_gtlList * object = (cPtr_gtlList *) inObject ;
   macroValidSharedObject (object, cPtr_gtlList) ;
-  GALGAS_uint var_indexUint_124810 = constinArgument_index.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 3991)).getter_uint (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3991)) ;
+  GALGAS_uint var_indexUint_124810 = constinArgument_index.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 3994)).getter_uint (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3994)) ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = GALGAS_bool (kIsStrictInf, var_indexUint_124810.objectCompare (object->mProperty_value.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3992)))).boolEnum () ;
+    test_0 = GALGAS_bool (kIsStrictInf, var_indexUint_124810.objectCompare (object->mProperty_value.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3995)))).boolEnum () ;
     if (kBoolTrue == test_0) {
       enumGalgasBool test_1 = kBoolTrue ;
       if (kBoolTrue == test_1) {
         test_1 = GALGAS_bool (kIsEqual, var_indexUint_124810.objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
         if (kBoolTrue == test_1) {
-          object->mProperty_value = object->mProperty_value.getter_subListFromIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3994)) ;
+          object->mProperty_value = object->mProperty_value.getter_subListFromIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3997)) ;
         }
       }
       if (kBoolFalse == test_1) {
         enumGalgasBool test_2 = kBoolTrue ;
         if (kBoolTrue == test_2) {
-          test_2 = GALGAS_bool (kIsEqual, var_indexUint_124810.objectCompare (object->mProperty_value.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3995)).substract_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3995)))).boolEnum () ;
+          test_2 = GALGAS_bool (kIsEqual, var_indexUint_124810.objectCompare (object->mProperty_value.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 3998)).substract_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3998)))).boolEnum () ;
           if (kBoolTrue == test_2) {
-            object->mProperty_value = object->mProperty_value.getter_subListToIndex (var_indexUint_124810.substract_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3996)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3996)) ;
+            object->mProperty_value = object->mProperty_value.getter_subListToIndex (var_indexUint_124810.substract_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3999)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3999)) ;
           }
         }
         if (kBoolFalse == test_2) {
-          object->mProperty_value = object->mProperty_value.getter_subListToIndex (var_indexUint_124810.substract_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3998)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3998)).add_operation (object->mProperty_value.getter_subListFromIndex (var_indexUint_124810.add_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3999)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3999)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 3998)) ;
+          object->mProperty_value = object->mProperty_value.getter_subListToIndex (var_indexUint_124810.substract_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4001)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4001)).add_operation (object->mProperty_value.getter_subListFromIndex (var_indexUint_124810.add_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4002)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4002)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4001)) ;
         }
       }
     }
@@ -2094,7 +2094,7 @@ static void extensionMethod_gtlList_itemAtIndex (const cPtr_gtlData * inObject,
                                                  COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlList * object = (const cPtr_gtlList *) inObject ;
   macroValidSharedObject (object, cPtr_gtlList) ;
-  outArgument_data = object->mProperty_value.getter_valueAtIndex (constinArgument_index.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4008)).getter_uint (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4008)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4008)) ;
+  outArgument_data = object->mProperty_value.getter_valueAtIndex (constinArgument_index.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4011)).getter_uint (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4011)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4011)) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -2121,7 +2121,7 @@ static GALGAS_bool extensionGetter_gtlList_hasItemAtIndex (const cPtr_gtlData *
   GALGAS_bool result_result ; // Returned variable
   const cPtr_gtlList * object = (const cPtr_gtlList *) inObject ;
   macroValidSharedObject (object, cPtr_gtlList) ;
-  result_result = GALGAS_bool (kIsStrictSup, object->mProperty_value.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 4015)).objectCompare (constinArgument_index.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4015)).getter_uint (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4015)))) ;
+  result_result = GALGAS_bool (kIsStrictSup, object->mProperty_value.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 4018)).objectCompare (constinArgument_index.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4018)).getter_uint (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4018)))) ;
 //---
   return result_result ;
 }
@@ -2150,7 +2150,7 @@ static void extensionSetter_gtlList_appendItem (cPtr_gtlData * inObject,
                                                 COMMA_UNUSED_LOCATION_ARGS) {
   cPtr_gtlList * object = (cPtr_gtlList *) inObject ;
   macroValidSharedObject (object, cPtr_gtlList) ;
-  object->mProperty_value.addAssign_operation (constinArgument_item  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4021)) ;
+  object->mProperty_value.addAssign_operation (constinArgument_item  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4024)) ;
 }
 //----------------------------------------------------------------------------------------------------------------------
 
@@ -2176,13 +2176,13 @@ static GALGAS_string extensionGetter_gtlMap_desc (const cPtr_gtlData * inObject,
   GALGAS_string result_result ; // Returned variable
   const cPtr_gtlMap * object = (const cPtr_gtlMap *) inObject ;
   macroValidSharedObject (object, cPtr_gtlMap) ;
-  result_result = GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (32)), constinArgument_tab  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4033)).add_operation (GALGAS_string ("map: @[\n"), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4033)) ;
+  result_result = GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (32)), constinArgument_tab  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4036)).add_operation (GALGAS_string ("map: @[\n"), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4036)) ;
   cEnumerator_gtlVarMap enumerator_125929 (object->mProperty_value, kENUMERATION_UP) ;
   while (enumerator_125929.hasCurrentObject ()) {
-    result_result.plusAssign_operation(GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (32)), constinArgument_tab.add_operation (GALGAS_uint ((uint32_t) 4U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4036))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4036)).add_operation (GALGAS_string ("\""), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4036)).add_operation (enumerator_125929.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4037)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4037)).add_operation (GALGAS_string ("\" :>\n"), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4037)).add_operation (callExtensionGetter_desc ((const cPtr_gtlData *) enumerator_125929.current_value (HERE).ptr (), constinArgument_tab.add_operation (GALGAS_uint ((uint32_t) 8U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4038)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4038)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4037)), inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4036)) ;
+    result_result.plusAssign_operation(GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (32)), constinArgument_tab.add_operation (GALGAS_uint ((uint32_t) 4U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4039))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4039)).add_operation (GALGAS_string ("\""), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4039)).add_operation (enumerator_125929.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4040)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4040)).add_operation (GALGAS_string ("\" :>\n"), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4040)).add_operation (callExtensionGetter_desc ((const cPtr_gtlData *) enumerator_125929.current_value (HERE).ptr (), constinArgument_tab.add_operation (GALGAS_uint ((uint32_t) 8U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4041)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4041)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4040)), inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4039)) ;
     enumerator_125929.gotoNextObject () ;
   }
-  result_result.plusAssign_operation(GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (32)), constinArgument_tab  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4040)).add_operation (GALGAS_string ("]\n"), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4040)), inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4040)) ;
+  result_result.plusAssign_operation(GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (32)), constinArgument_tab  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4043)).add_operation (GALGAS_string ("]\n"), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4043)), inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4043)) ;
 //---
   return result_result ;
 }
@@ -2212,7 +2212,7 @@ static GALGAS_string extensionGetter_gtlMap_string (const cPtr_gtlData * inObjec
   const cPtr_gtlMap * object = (const cPtr_gtlMap *) inObject ;
   macroValidSharedObject (object, cPtr_gtlMap) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4044)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4047)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -2243,7 +2243,7 @@ static GALGAS_lstring extensionGetter_gtlMap_lstring (const cPtr_gtlData * inObj
   const cPtr_gtlMap * object = (const cPtr_gtlMap *) inObject ;
   macroValidSharedObject (object, cPtr_gtlMap) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4048)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4051)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -2274,7 +2274,7 @@ static GALGAS_bool extensionGetter_gtlMap_bool (const cPtr_gtlData * inObject,
   const cPtr_gtlMap * object = (const cPtr_gtlMap *) inObject ;
   macroValidSharedObject (object, cPtr_gtlMap) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("cannot cast a map to a bool"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4052)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("cannot cast a map to a bool"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4055)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -2305,7 +2305,7 @@ static GALGAS_bigint extensionGetter_gtlMap_int (const cPtr_gtlData * inObject,
   const cPtr_gtlMap * object = (const cPtr_gtlMap *) inObject ;
   macroValidSharedObject (object, cPtr_gtlMap) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("cannot cast a map to an int"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4056)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("cannot cast a map to an int"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4059)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -2336,7 +2336,7 @@ static GALGAS_double extensionGetter_gtlMap_float (const cPtr_gtlData * inObject
   const cPtr_gtlMap * object = (const cPtr_gtlMap *) inObject ;
   macroValidSharedObject (object, cPtr_gtlMap) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("cannot cast a map to a float"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4060)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("cannot cast a map to a float"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4063)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -2367,7 +2367,7 @@ static GALGAS_gtlData extensionGetter_gtlMap_plusOp (const cPtr_gtlData * inObje
   const cPtr_gtlMap * object = (const cPtr_gtlMap *) inObject ;
   macroValidSharedObject (object, cPtr_gtlMap) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4064)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4067)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -2398,7 +2398,7 @@ static GALGAS_gtlData extensionGetter_gtlMap_minusOp (const cPtr_gtlData * inObj
   const cPtr_gtlMap * object = (const cPtr_gtlMap *) inObject ;
   macroValidSharedObject (object, cPtr_gtlMap) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4068)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4071)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -2429,7 +2429,7 @@ static GALGAS_gtlData extensionGetter_gtlMap_notOp (const cPtr_gtlData * inObjec
   const cPtr_gtlMap * object = (const cPtr_gtlMap *) inObject ;
   macroValidSharedObject (object, cPtr_gtlMap) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4072)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4075)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -2461,7 +2461,7 @@ static GALGAS_gtlData extensionGetter_gtlMap_addOp (const cPtr_gtlData * inObjec
   const cPtr_gtlMap * object = (const cPtr_gtlMap *) inObject ;
   macroValidSharedObject (object, cPtr_gtlMap) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4076)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4079)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -2493,7 +2493,7 @@ static GALGAS_gtlData extensionGetter_gtlMap_subOp (const cPtr_gtlData * inObjec
   const cPtr_gtlMap * object = (const cPtr_gtlMap *) inObject ;
   macroValidSharedObject (object, cPtr_gtlMap) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4080)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4083)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -2525,7 +2525,7 @@ static GALGAS_gtlData extensionGetter_gtlMap_mulOp (const cPtr_gtlData * inObjec
   const cPtr_gtlMap * object = (const cPtr_gtlMap *) inObject ;
   macroValidSharedObject (object, cPtr_gtlMap) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4084)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4087)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -2557,7 +2557,7 @@ static GALGAS_gtlData extensionGetter_gtlMap_divOp (const cPtr_gtlData * inObjec
   const cPtr_gtlMap * object = (const cPtr_gtlMap *) inObject ;
   macroValidSharedObject (object, cPtr_gtlMap) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4088)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4091)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -2589,7 +2589,7 @@ static GALGAS_gtlData extensionGetter_gtlMap_modOp (const cPtr_gtlData * inObjec
   const cPtr_gtlMap * object = (const cPtr_gtlMap *) inObject ;
   macroValidSharedObject (object, cPtr_gtlMap) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4092)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4095)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -2621,7 +2621,7 @@ static GALGAS_gtlData extensionGetter_gtlMap_andOp (const cPtr_gtlData * inObjec
   const cPtr_gtlMap * object = (const cPtr_gtlMap *) inObject ;
   macroValidSharedObject (object, cPtr_gtlMap) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4096)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4099)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -2653,7 +2653,7 @@ static GALGAS_gtlData extensionGetter_gtlMap_orOp (const cPtr_gtlData * inObject
   const cPtr_gtlMap * object = (const cPtr_gtlMap *) inObject ;
   macroValidSharedObject (object, cPtr_gtlMap) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4100)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4103)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -2685,7 +2685,7 @@ static GALGAS_gtlData extensionGetter_gtlMap_xorOp (const cPtr_gtlData * inObjec
   const cPtr_gtlMap * object = (const cPtr_gtlMap *) inObject ;
   macroValidSharedObject (object, cPtr_gtlMap) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4104)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4107)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -2717,7 +2717,7 @@ static GALGAS_gtlData extensionGetter_gtlMap_slOp (const cPtr_gtlData * inObject
   const cPtr_gtlMap * object = (const cPtr_gtlMap *) inObject ;
   macroValidSharedObject (object, cPtr_gtlMap) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4108)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4111)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -2749,7 +2749,7 @@ static GALGAS_gtlData extensionGetter_gtlMap_srOp (const cPtr_gtlData * inObject
   const cPtr_gtlMap * object = (const cPtr_gtlMap *) inObject ;
   macroValidSharedObject (object, cPtr_gtlMap) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4112)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4115)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -2789,14 +2789,14 @@ static GALGAS_gtlData extensionGetter_gtlMap_neqOp (const cPtr_gtlData * inObjec
         if (NULL != dynamic_cast <const cPtr_gtlMap *> (constinArgument_right.ptr ())) {
           temp_1 = (cPtr_gtlMap *) constinArgument_right.ptr () ;
         }else{
-          inCompiler->castError ("gtlMap", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4117)) ;
+          inCompiler->castError ("gtlMap", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4120)) ;
         }
       }
-      GALGAS_gtlVarMap var_rValue_128298 = temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4117)) ;
+      GALGAS_gtlVarMap var_rValue_128298 = temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4120)) ;
       GALGAS_bool var_equal_128341 ;
       enumGalgasBool test_2 = kBoolTrue ;
       if (kBoolTrue == test_2) {
-        test_2 = GALGAS_bool (kIsNotEqual, object->mProperty_value.getter_count (SOURCE_FILE ("gtl_data_types.galgas", 4119)).objectCompare (var_rValue_128298.getter_count (SOURCE_FILE ("gtl_data_types.galgas", 4119)))).boolEnum () ;
+        test_2 = GALGAS_bool (kIsNotEqual, object->mProperty_value.getter_count (SOURCE_FILE ("gtl_data_types.galgas", 4122)).objectCompare (var_rValue_128298.getter_count (SOURCE_FILE ("gtl_data_types.galgas", 4122)))).boolEnum () ;
         if (kBoolTrue == test_2) {
           var_equal_128341 = GALGAS_bool (false) ;
         }
@@ -2807,11 +2807,11 @@ static GALGAS_gtlData extensionGetter_gtlMap_neqOp (const cPtr_gtlData * inObjec
         while (enumerator_128466.hasCurrentObject ()) {
           enumGalgasBool test_3 = kBoolTrue ;
           if (kBoolTrue == test_3) {
-            test_3 = var_rValue_128298.getter_hasKey (enumerator_128466.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4124)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4124)).boolEnum () ;
+            test_3 = var_rValue_128298.getter_hasKey (enumerator_128466.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4127)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4127)).boolEnum () ;
             if (kBoolTrue == test_3) {
               GALGAS_gtlData var_rData_128551 ;
-              var_rValue_128298.method_get (enumerator_128466.current_lkey (HERE), var_rData_128551, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4125)) ;
-              var_equal_128341 = var_equal_128341.operator_and (callExtensionGetter_bool ((const cPtr_gtlData *) callExtensionGetter_eqOp ((const cPtr_gtlData *) enumerator_128466.current_value (HERE).ptr (), var_rData_128551, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4126)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4126)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4126)) ;
+              var_rValue_128298.method_get (enumerator_128466.current_lkey (HERE), var_rData_128551, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4128)) ;
+              var_equal_128341 = var_equal_128341.operator_and (callExtensionGetter_bool ((const cPtr_gtlData *) callExtensionGetter_eqOp ((const cPtr_gtlData *) enumerator_128466.current_value (HERE).ptr (), var_rData_128551, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4129)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4129)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4129)) ;
             }
           }
           if (kBoolFalse == test_3) {
@@ -2820,12 +2820,12 @@ static GALGAS_gtlData extensionGetter_gtlMap_neqOp (const cPtr_gtlData * inObjec
           enumerator_128466.gotoNextObject () ;
         }
       }
-      result_result = GALGAS_gtlBool::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4132)), var_equal_128341.operator_not (SOURCE_FILE ("gtl_data_types.galgas", 4132))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4132)) ;
+      result_result = GALGAS_gtlBool::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4135)), var_equal_128341.operator_not (SOURCE_FILE ("gtl_data_types.galgas", 4135))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4135)) ;
     }
   }
   if (kBoolFalse == test_0) {
     TC_Array <C_FixItDescription> fixItArray4 ;
-    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4134)), GALGAS_string ("struct expected"), fixItArray4  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4134)) ;
+    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4137)), GALGAS_string ("struct expected"), fixItArray4  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4137)) ;
     result_result.drop () ; // Release error dropped variable
   }
 //---
@@ -2866,14 +2866,14 @@ static GALGAS_gtlData extensionGetter_gtlMap_eqOp (const cPtr_gtlData * inObject
         if (NULL != dynamic_cast <const cPtr_gtlMap *> (constinArgument_right.ptr ())) {
           temp_1 = (cPtr_gtlMap *) constinArgument_right.ptr () ;
         }else{
-          inCompiler->castError ("gtlMap", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4140)) ;
+          inCompiler->castError ("gtlMap", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4143)) ;
         }
       }
-      GALGAS_gtlVarMap var_rValue_128921 = temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4140)) ;
+      GALGAS_gtlVarMap var_rValue_128921 = temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4143)) ;
       GALGAS_bool var_equal_128964 ;
       enumGalgasBool test_2 = kBoolTrue ;
       if (kBoolTrue == test_2) {
-        test_2 = GALGAS_bool (kIsNotEqual, object->mProperty_value.getter_count (SOURCE_FILE ("gtl_data_types.galgas", 4142)).objectCompare (var_rValue_128921.getter_count (SOURCE_FILE ("gtl_data_types.galgas", 4142)))).boolEnum () ;
+        test_2 = GALGAS_bool (kIsNotEqual, object->mProperty_value.getter_count (SOURCE_FILE ("gtl_data_types.galgas", 4145)).objectCompare (var_rValue_128921.getter_count (SOURCE_FILE ("gtl_data_types.galgas", 4145)))).boolEnum () ;
         if (kBoolTrue == test_2) {
           var_equal_128964 = GALGAS_bool (false) ;
         }
@@ -2884,11 +2884,11 @@ static GALGAS_gtlData extensionGetter_gtlMap_eqOp (const cPtr_gtlData * inObject
         while (enumerator_129089.hasCurrentObject ()) {
           enumGalgasBool test_3 = kBoolTrue ;
           if (kBoolTrue == test_3) {
-            test_3 = var_rValue_128921.getter_hasKey (enumerator_129089.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4147)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4147)).boolEnum () ;
+            test_3 = var_rValue_128921.getter_hasKey (enumerator_129089.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4150)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4150)).boolEnum () ;
             if (kBoolTrue == test_3) {
               GALGAS_gtlData var_rData_129174 ;
-              var_rValue_128921.method_get (enumerator_129089.current_lkey (HERE), var_rData_129174, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4148)) ;
-              var_equal_128964 = var_equal_128964.operator_and (callExtensionGetter_bool ((const cPtr_gtlData *) callExtensionGetter_eqOp ((const cPtr_gtlData *) enumerator_129089.current_value (HERE).ptr (), var_rData_129174, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4149)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4149)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4149)) ;
+              var_rValue_128921.method_get (enumerator_129089.current_lkey (HERE), var_rData_129174, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4151)) ;
+              var_equal_128964 = var_equal_128964.operator_and (callExtensionGetter_bool ((const cPtr_gtlData *) callExtensionGetter_eqOp ((const cPtr_gtlData *) enumerator_129089.current_value (HERE).ptr (), var_rData_129174, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4152)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4152)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4152)) ;
             }
           }
           if (kBoolFalse == test_3) {
@@ -2897,12 +2897,12 @@ static GALGAS_gtlData extensionGetter_gtlMap_eqOp (const cPtr_gtlData * inObject
           enumerator_129089.gotoNextObject () ;
         }
       }
-      result_result = GALGAS_gtlBool::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4155)), var_equal_128964  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4155)) ;
+      result_result = GALGAS_gtlBool::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4158)), var_equal_128964  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4158)) ;
     }
   }
   if (kBoolFalse == test_0) {
     TC_Array <C_FixItDescription> fixItArray4 ;
-    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4157)), GALGAS_string ("struct expected"), fixItArray4  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4157)) ;
+    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4160)), GALGAS_string ("struct expected"), fixItArray4  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4160)) ;
     result_result.drop () ; // Release error dropped variable
   }
 //---
@@ -2935,7 +2935,7 @@ static GALGAS_gtlData extensionGetter_gtlMap_gtOp (const cPtr_gtlData * inObject
   const cPtr_gtlMap * object = (const cPtr_gtlMap *) inObject ;
   macroValidSharedObject (object, cPtr_gtlMap) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("a map does not support the > operator"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4162)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("a map does not support the > operator"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4165)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -2967,7 +2967,7 @@ static GALGAS_gtlData extensionGetter_gtlMap_geOp (const cPtr_gtlData * inObject
   const cPtr_gtlMap * object = (const cPtr_gtlMap *) inObject ;
   macroValidSharedObject (object, cPtr_gtlMap) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("a map does not support the >= operator"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4166)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("a map does not support the >= operator"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4169)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -2999,7 +2999,7 @@ static GALGAS_gtlData extensionGetter_gtlMap_ltOp (const cPtr_gtlData * inObject
   const cPtr_gtlMap * object = (const cPtr_gtlMap *) inObject ;
   macroValidSharedObject (object, cPtr_gtlMap) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("a map does not support the < operator"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4170)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("a map does not support the < operator"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4173)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -3031,7 +3031,7 @@ static GALGAS_gtlData extensionGetter_gtlMap_leOp (const cPtr_gtlData * inObject
   const cPtr_gtlMap * object = (const cPtr_gtlMap *) inObject ;
   macroValidSharedObject (object, cPtr_gtlMap) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("a map does not support the <= operator"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4174)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("a map does not support the <= operator"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4177)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -3062,7 +3062,7 @@ static GALGAS_type extensionGetter_gtlMap_embeddedType (const cPtr_gtlData * inO
   const cPtr_gtlMap * object = (const cPtr_gtlMap *) inObject ;
   macroValidSharedObject (object, cPtr_gtlMap) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map forbidden as built in function argument"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4179)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map forbidden as built in function argument"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4182)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -3092,7 +3092,7 @@ static void extensionMethod_gtlMap_addMyValue (const cPtr_gtlData * inObject,
                                                COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlMap * object = (const cPtr_gtlMap *) inObject ;
   macroValidSharedObject (object, cPtr_gtlMap) ;
-  ioArgument_objectList.addAssign_operation (object->mProperty_value.getter_object (SOURCE_FILE ("gtl_data_types.galgas", 4184))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4184)) ;
+  ioArgument_objectList.addAssign_operation (object->mProperty_value.getter_object (SOURCE_FILE ("gtl_data_types.galgas", 4187))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4187)) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -3124,76 +3124,76 @@ static GALGAS_gtlData extensionGetter_gtlMap_performGetter (const cPtr_gtlData *
   macroValidSharedObject (object, cPtr_gtlMap) ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = GALGAS_bool (kIsEqual, GALGAS_string ("length").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4197)))).boolEnum () ;
+    test_0 = GALGAS_bool (kIsEqual, GALGAS_string ("length").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4200)))).boolEnum () ;
     if (kBoolTrue == test_0) {
       {
-      routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4198)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4198)) ;
+      routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4201)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4201)) ;
       }
-      result_result = GALGAS_gtlInt::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4200)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4201)), object->mProperty_value.getter_count (SOURCE_FILE ("gtl_data_types.galgas", 4202)).getter_bigint (SOURCE_FILE ("gtl_data_types.galgas", 4202))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4199)) ;
+      result_result = GALGAS_gtlInt::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4203)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4204)), object->mProperty_value.getter_count (SOURCE_FILE ("gtl_data_types.galgas", 4205)).getter_bigint (SOURCE_FILE ("gtl_data_types.galgas", 4205))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4202)) ;
     }
   }
   if (kBoolFalse == test_0) {
     enumGalgasBool test_1 = kBoolTrue ;
     if (kBoolTrue == test_1) {
-      test_1 = GALGAS_bool (kIsEqual, GALGAS_string ("type").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4204)))).boolEnum () ;
+      test_1 = GALGAS_bool (kIsEqual, GALGAS_string ("type").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4207)))).boolEnum () ;
       if (kBoolTrue == test_1) {
         {
-        routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4205)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4205)) ;
+        routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4208)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4208)) ;
         }
         const GALGAS_gtlMap temp_2 = object ;
-        result_result = GALGAS_gtlType::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4207)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4207)), temp_2.getter_dynamicType (SOURCE_FILE ("gtl_data_types.galgas", 4207))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4206)) ;
+        result_result = GALGAS_gtlType::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4210)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4210)), temp_2.getter_dynamicType (SOURCE_FILE ("gtl_data_types.galgas", 4210))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4209)) ;
       }
     }
     if (kBoolFalse == test_1) {
       enumGalgasBool test_3 = kBoolTrue ;
       if (kBoolTrue == test_3) {
-        test_3 = GALGAS_bool (kIsEqual, GALGAS_string ("isANumber").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4209)))).boolEnum () ;
+        test_3 = GALGAS_bool (kIsEqual, GALGAS_string ("isANumber").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4212)))).boolEnum () ;
         if (kBoolTrue == test_3) {
           {
-          routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4210)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4210)) ;
+          routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4213)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4213)) ;
           }
-          result_result = GALGAS_gtlBool::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4212)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4212)), GALGAS_bool (false)  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4211)) ;
+          result_result = GALGAS_gtlBool::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4215)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4215)), GALGAS_bool (false)  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4214)) ;
         }
       }
       if (kBoolFalse == test_3) {
         enumGalgasBool test_4 = kBoolTrue ;
         if (kBoolTrue == test_4) {
-          test_4 = GALGAS_bool (kIsEqual, GALGAS_string ("list").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4214)))).boolEnum () ;
+          test_4 = GALGAS_bool (kIsEqual, GALGAS_string ("list").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4217)))).boolEnum () ;
           if (kBoolTrue == test_4) {
             {
-            routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4215)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4215)) ;
+            routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4218)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4218)) ;
             }
-            GALGAS_list var_resultList_131343 = GALGAS_list::constructor_emptyList (SOURCE_FILE ("gtl_data_types.galgas", 4216)) ;
+            GALGAS_list var_resultList_131343 = GALGAS_list::constructor_emptyList (SOURCE_FILE ("gtl_data_types.galgas", 4219)) ;
             const GALGAS_gtlMap temp_5 = object ;
-            cEnumerator_gtlVarMap enumerator_131391 (temp_5.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4217)), kENUMERATION_UP) ;
+            cEnumerator_gtlVarMap enumerator_131391 (temp_5.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4220)), kENUMERATION_UP) ;
             while (enumerator_131391.hasCurrentObject ()) {
-              var_resultList_131343.addAssign_operation (enumerator_131391.current_value (HERE)  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4218)) ;
+              var_resultList_131343.addAssign_operation (enumerator_131391.current_value (HERE)  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4221)) ;
               enumerator_131391.gotoNextObject () ;
             }
-            result_result = GALGAS_gtlList::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4220)), var_resultList_131343  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4220)) ;
+            result_result = GALGAS_gtlList::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4223)), var_resultList_131343  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4223)) ;
           }
         }
         if (kBoolFalse == test_4) {
           enumGalgasBool test_6 = kBoolTrue ;
           if (kBoolTrue == test_6) {
-            test_6 = GALGAS_bool (kIsEqual, GALGAS_string ("where").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4221)))).boolEnum () ;
+            test_6 = GALGAS_bool (kIsEqual, GALGAS_string ("where").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4224)))).boolEnum () ;
             if (kBoolTrue == test_6) {
               enumGalgasBool test_7 = kBoolTrue ;
               if (kBoolTrue == test_7) {
-                test_7 = GALGAS_bool (kIsStrictInf, constinArgument_arguments.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 4222)).objectCompare (GALGAS_uint ((uint32_t) 1U))).operator_or (GALGAS_bool (kIsStrictSup, constinArgument_arguments.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 4222)).objectCompare (GALGAS_uint ((uint32_t) 2U))) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4222)).boolEnum () ;
+                test_7 = GALGAS_bool (kIsStrictInf, constinArgument_arguments.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 4225)).objectCompare (GALGAS_uint ((uint32_t) 1U))).operator_or (GALGAS_bool (kIsStrictSup, constinArgument_arguments.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 4225)).objectCompare (GALGAS_uint ((uint32_t) 2U))) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4225)).boolEnum () ;
                 if (kBoolTrue == test_7) {
                   TC_Array <C_FixItDescription> fixItArray8 ;
-                  inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4223)), GALGAS_string ("where expects 1 ou 2 arguments. ").add_operation (constinArgument_arguments.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 4224)).getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4223)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4223)).add_operation (GALGAS_string (" arguments provided."), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4224)), fixItArray8  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4223)) ;
+                  inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4226)), GALGAS_string ("where expects 1 ou 2 arguments. ").add_operation (constinArgument_arguments.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 4227)).getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4226)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4226)).add_operation (GALGAS_string (" arguments provided."), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4227)), fixItArray8  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4226)) ;
                   result_result.drop () ; // Release error dropped variable
                 }
               }
               if (kBoolFalse == test_7) {
                 enumGalgasBool test_9 = kBoolTrue ;
                 if (kBoolTrue == test_9) {
-                  test_9 = GALGAS_bool (kIsNotEqual, constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4226)).getter_dynamicType (SOURCE_FILE ("gtl_data_types.galgas", 4226)).objectCompare (GALGAS_type (& kTypeDescriptor_GALGAS_gtlExpr))).boolEnum () ;
+                  test_9 = GALGAS_bool (kIsNotEqual, constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4229)).getter_dynamicType (SOURCE_FILE ("gtl_data_types.galgas", 4229)).objectCompare (GALGAS_type (& kTypeDescriptor_GALGAS_gtlExpr))).boolEnum () ;
                   if (kBoolTrue == test_9) {
                     TC_Array <C_FixItDescription> fixItArray10 ;
-                    inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4227)), GALGAS_string ("expression expected for argument 1"), fixItArray10  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4227)) ;
+                    inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4230)), GALGAS_string ("expression expected for argument 1"), fixItArray10  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4230)) ;
                     result_result.drop () ; // Release error dropped variable
                   }
                 }
@@ -3201,24 +3201,24 @@ static GALGAS_gtlData extensionGetter_gtlMap_performGetter (const cPtr_gtlData *
                   GALGAS_gtlStruct var_vars_131913 ;
                   enumGalgasBool test_11 = kBoolTrue ;
                   if (kBoolTrue == test_11) {
-                    test_11 = GALGAS_bool (kIsEqual, constinArgument_arguments.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 4230)).objectCompare (GALGAS_uint ((uint32_t) 2U))).boolEnum () ;
+                    test_11 = GALGAS_bool (kIsEqual, constinArgument_arguments.getter_length (SOURCE_FILE ("gtl_data_types.galgas", 4233)).objectCompare (GALGAS_uint ((uint32_t) 2U))).boolEnum () ;
                     if (kBoolTrue == test_11) {
                       enumGalgasBool test_12 = kBoolTrue ;
                       if (kBoolTrue == test_12) {
-                        test_12 = GALGAS_bool (kIsNotEqual, constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4231)).getter_dynamicType (SOURCE_FILE ("gtl_data_types.galgas", 4231)).objectCompare (GALGAS_type (& kTypeDescriptor_GALGAS_gtlStruct))).boolEnum () ;
+                        test_12 = GALGAS_bool (kIsNotEqual, constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4234)).getter_dynamicType (SOURCE_FILE ("gtl_data_types.galgas", 4234)).objectCompare (GALGAS_type (& kTypeDescriptor_GALGAS_gtlStruct))).boolEnum () ;
                         if (kBoolTrue == test_12) {
                           TC_Array <C_FixItDescription> fixItArray13 ;
-                          inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4232)), GALGAS_string ("struct expected for argument 1"), fixItArray13  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4232)) ;
+                          inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4235)), GALGAS_string ("struct expected for argument 1"), fixItArray13  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4235)) ;
                           var_vars_131913.drop () ; // Release error dropped variable
                         }
                       }
                       if (kBoolFalse == test_12) {
                         GALGAS_gtlStruct temp_14 ;
-                        if (constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4234)).isValid ()) {
-                          if (NULL != dynamic_cast <const cPtr_gtlStruct *> (constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4234)).ptr ())) {
-                            temp_14 = (cPtr_gtlStruct *) constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4234)).ptr () ;
+                        if (constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4237)).isValid ()) {
+                          if (NULL != dynamic_cast <const cPtr_gtlStruct *> (constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4237)).ptr ())) {
+                            temp_14 = (cPtr_gtlStruct *) constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4237)).ptr () ;
                           }else{
-                            inCompiler->castError ("gtlStruct", constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4234)).ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4234)) ;
+                            inCompiler->castError ("gtlStruct", constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4237)).ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4237)) ;
                           }
                         }
                         var_vars_131913 = temp_14 ;
@@ -3226,38 +3226,38 @@ static GALGAS_gtlData extensionGetter_gtlMap_performGetter (const cPtr_gtlData *
                     }
                   }
                   if (kBoolFalse == test_11) {
-                    var_vars_131913 = GALGAS_gtlStruct::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4237)), GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("gtl_data_types.galgas", 4237))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4237)) ;
+                    var_vars_131913 = GALGAS_gtlStruct::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4240)), GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("gtl_data_types.galgas", 4240))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4240)) ;
                   }
                   GALGAS_gtlExpr temp_15 ;
-                  if (constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4239)).isValid ()) {
-                    if (NULL != dynamic_cast <const cPtr_gtlExpr *> (constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4239)).ptr ())) {
-                      temp_15 = (cPtr_gtlExpr *) constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4239)).ptr () ;
+                  if (constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4242)).isValid ()) {
+                    if (NULL != dynamic_cast <const cPtr_gtlExpr *> (constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4242)).ptr ())) {
+                      temp_15 = (cPtr_gtlExpr *) constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4242)).ptr () ;
                     }else{
-                      inCompiler->castError ("gtlExpr", constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4239)).ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4239)) ;
+                      inCompiler->castError ("gtlExpr", constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4242)).ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4242)) ;
                     }
                   }
-                  GALGAS_gtlExpression var_expr_132300 = temp_15.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4239)) ;
-                  GALGAS_gtlVarMap var_resultMap_132378 = GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("gtl_data_types.galgas", 4240)) ;
+                  GALGAS_gtlExpression var_expr_132300 = temp_15.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4242)) ;
+                  GALGAS_gtlVarMap var_resultMap_132378 = GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("gtl_data_types.galgas", 4243)) ;
                   cEnumerator_gtlVarMap enumerator_132422 (object->mProperty_value, kENUMERATION_UP) ;
                   while (enumerator_132422.hasCurrentObject ()) {
                     {
                     var_vars_131913.insulate (HERE) ;
                     cPtr_gtlStruct * ptr_132451 = (cPtr_gtlStruct *) var_vars_131913.ptr () ;
-                    callExtensionSetter_setStructField ((cPtr_gtlStruct *) ptr_132451, GALGAS_lstring::constructor_new (GALGAS_string ("__item__"), enumerator_132422.current_value (HERE).getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4243))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4243)), enumerator_132422.current_value (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4243)) ;
+                    callExtensionSetter_setStructField ((cPtr_gtlStruct *) ptr_132451, GALGAS_lstring::constructor_new (GALGAS_string ("__item__"), enumerator_132422.current_value (HERE).getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4246))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4246)), enumerator_132422.current_value (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4246)) ;
                     }
-                    GALGAS_gtlData var_evalResult_132545 = callExtensionGetter_eval ((const cPtr_gtlExpression *) var_expr_132300.ptr (), constinArgument_context, var_vars_131913, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4244)) ;
+                    GALGAS_gtlData var_evalResult_132545 = callExtensionGetter_eval ((const cPtr_gtlExpression *) var_expr_132300.ptr (), constinArgument_context, var_vars_131913, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4247)) ;
                     enumGalgasBool test_16 = kBoolTrue ;
                     if (kBoolTrue == test_16) {
-                      test_16 = callExtensionGetter_bool ((const cPtr_gtlData *) var_evalResult_132545.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4245)).boolEnum () ;
+                      test_16 = callExtensionGetter_bool ((const cPtr_gtlData *) var_evalResult_132545.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4248)).boolEnum () ;
                       if (kBoolTrue == test_16) {
                         {
-                        var_resultMap_132378.setter_put (enumerator_132422.current_lkey (HERE), enumerator_132422.current_value (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4246)) ;
+                        var_resultMap_132378.setter_put (enumerator_132422.current_lkey (HERE), enumerator_132422.current_value (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4249)) ;
                         }
                       }
                     }
                     enumerator_132422.gotoNextObject () ;
                   }
-                  result_result = GALGAS_gtlMap::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4250)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4251)), var_resultMap_132378  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4249)) ;
+                  result_result = GALGAS_gtlMap::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4253)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4254)), var_resultMap_132378  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4252)) ;
                 }
               }
             }
@@ -3265,37 +3265,37 @@ static GALGAS_gtlData extensionGetter_gtlMap_performGetter (const cPtr_gtlData *
           if (kBoolFalse == test_6) {
             enumGalgasBool test_17 = kBoolTrue ;
             if (kBoolTrue == test_17) {
-              test_17 = GALGAS_bool (kIsEqual, GALGAS_string ("description").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4256)))).boolEnum () ;
+              test_17 = GALGAS_bool (kIsEqual, GALGAS_string ("description").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4259)))).boolEnum () ;
               if (kBoolTrue == test_17) {
                 {
-                routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4257)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4257)) ;
+                routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4260)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4260)) ;
                 }
-                result_result = GALGAS_gtlString::constructor_new (object->mProperty_meta.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4259)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4259)), object->mProperty_meta.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4259))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4258)) ;
+                result_result = GALGAS_gtlString::constructor_new (object->mProperty_meta.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4262)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4262)), object->mProperty_meta.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4262))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4261)) ;
               }
             }
             if (kBoolFalse == test_17) {
               enumGalgasBool test_18 = kBoolTrue ;
               if (kBoolTrue == test_18) {
-                test_18 = callExtensionGetter_getterExists ((const cPtr_library *) constinArgument_lib.ptr (), GALGAS_string ("map"), constinArgument_methodName, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4261)).boolEnum () ;
+                test_18 = callExtensionGetter_getterExists ((const cPtr_library *) constinArgument_lib.ptr (), GALGAS_string ("map"), constinArgument_methodName, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4264)).boolEnum () ;
                 if (kBoolTrue == test_18) {
                   const GALGAS_gtlMap temp_19 = object ;
-                  result_result = callExtensionGetter_callGetter ((const cPtr_gtlGetter *) callExtensionGetter_getGetter ((const cPtr_library *) constinArgument_lib.ptr (), GALGAS_string ("map"), constinArgument_methodName, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4262)).ptr (), constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4263)), constinArgument_context, constinArgument_lib, temp_19, constinArgument_arguments, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4262)) ;
+                  result_result = callExtensionGetter_callGetter ((const cPtr_gtlGetter *) callExtensionGetter_getGetter ((const cPtr_library *) constinArgument_lib.ptr (), GALGAS_string ("map"), constinArgument_methodName, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4265)).ptr (), constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4266)), constinArgument_context, constinArgument_lib, temp_19, constinArgument_arguments, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4265)) ;
                 }
               }
               if (kBoolFalse == test_18) {
                 enumGalgasBool test_20 = kBoolTrue ;
                 if (kBoolTrue == test_20) {
-                  test_20 = GALGAS_bool (kIsEqual, GALGAS_string ("location").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4269)))).boolEnum () ;
+                  test_20 = GALGAS_bool (kIsEqual, GALGAS_string ("location").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4272)))).boolEnum () ;
                   if (kBoolTrue == test_20) {
                     {
-                    routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4270)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4270)) ;
+                    routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4273)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4273)) ;
                     }
-                    result_result = GALGAS_gtlString::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4272)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4272)), object->mProperty_where.getter_locationString (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4272))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4271)) ;
+                    result_result = GALGAS_gtlString::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4275)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4275)), object->mProperty_where.getter_locationString (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4275))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4274)) ;
                   }
                 }
                 if (kBoolFalse == test_20) {
                   TC_Array <C_FixItDescription> fixItArray21 ;
-                  inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4275)), GALGAS_string ("unknown getter '").add_operation (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4275)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4275)).add_operation (GALGAS_string ("' for map target"), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4275)), fixItArray21  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4275)) ;
+                  inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4278)), GALGAS_string ("unknown getter '").add_operation (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4278)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4278)).add_operation (GALGAS_string ("' for map target"), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4278)), fixItArray21  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4278)) ;
                   result_result.drop () ; // Release error dropped variable
                 }
               }
@@ -3338,61 +3338,61 @@ static void extensionSetter_gtlMap_performSetter (cPtr_gtlData * inObject,
   macroValidSharedObject (object, cPtr_gtlMap) ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = GALGAS_bool (kIsEqual, GALGAS_string ("setDescription").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4289)))).boolEnum () ;
+    test_0 = GALGAS_bool (kIsEqual, GALGAS_string ("setDescription").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4292)))).boolEnum () ;
     if (kBoolTrue == test_0) {
       {
-      routine_argumentsCheck (constinArgument_methodName, function_stringArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4290)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4290)) ;
+      routine_argumentsCheck (constinArgument_methodName, function_stringArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4293)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4293)) ;
       }
       GALGAS_gtlString temp_1 ;
-      if (constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4291)).isValid ()) {
-        if (NULL != dynamic_cast <const cPtr_gtlString *> (constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4291)).ptr ())) {
-          temp_1 = (cPtr_gtlString *) constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4291)).ptr () ;
+      if (constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4294)).isValid ()) {
+        if (NULL != dynamic_cast <const cPtr_gtlString *> (constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4294)).ptr ())) {
+          temp_1 = (cPtr_gtlString *) constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4294)).ptr () ;
         }else{
-          inCompiler->castError ("gtlString", constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4291)).ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4291)) ;
+          inCompiler->castError ("gtlString", constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4294)).ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4294)) ;
         }
       }
       GALGAS_gtlString var_descriptionToSet_133965 = temp_1 ;
       {
-      object->setter_setMeta (callExtensionGetter_lstring ((const cPtr_gtlString *) var_descriptionToSet_133965.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4292)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4292)) ;
+      object->setter_setMeta (callExtensionGetter_lstring ((const cPtr_gtlString *) var_descriptionToSet_133965.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4295)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4295)) ;
       }
-      object->mProperty_where = constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4293)) ;
+      object->mProperty_where = constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4296)) ;
     }
   }
   if (kBoolFalse == test_0) {
     enumGalgasBool test_2 = kBoolTrue ;
     if (kBoolTrue == test_2) {
-      test_2 = GALGAS_bool (kIsEqual, GALGAS_string ("touch").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4294)))).boolEnum () ;
+      test_2 = GALGAS_bool (kIsEqual, GALGAS_string ("touch").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4297)))).boolEnum () ;
       if (kBoolTrue == test_2) {
         {
-        routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4295)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4295)) ;
+        routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4298)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4298)) ;
         }
-        object->mProperty_where = constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4296)) ;
+        object->mProperty_where = constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4299)) ;
       }
     }
     if (kBoolFalse == test_2) {
       enumGalgasBool test_3 = kBoolTrue ;
       if (kBoolTrue == test_3) {
-        test_3 = callExtensionGetter_setterExists ((const cPtr_library *) constinArgument_lib.ptr (), GALGAS_string ("map"), constinArgument_methodName, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4297)).boolEnum () ;
+        test_3 = callExtensionGetter_setterExists ((const cPtr_library *) constinArgument_lib.ptr (), GALGAS_string ("map"), constinArgument_methodName, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4300)).boolEnum () ;
         if (kBoolTrue == test_3) {
           const GALGAS_gtlMap temp_4 = object ;
           GALGAS_gtlData var_copy_134260 = temp_4 ;
-          callExtensionMethod_callSetter ((const cPtr_gtlSetter *) callExtensionGetter_getSetter ((const cPtr_library *) constinArgument_lib.ptr (), GALGAS_string ("map"), constinArgument_methodName, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4299)).ptr (), constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4300)), constinArgument_context, constinArgument_lib, var_copy_134260, constinArgument_arguments, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4299)) ;
+          callExtensionMethod_callSetter ((const cPtr_gtlSetter *) callExtensionGetter_getSetter ((const cPtr_library *) constinArgument_lib.ptr (), GALGAS_string ("map"), constinArgument_methodName, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4302)).ptr (), constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4303)), constinArgument_context, constinArgument_lib, var_copy_134260, constinArgument_arguments, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4302)) ;
           GALGAS_gtlMap temp_5 ;
           if (var_copy_134260.isValid ()) {
             if (NULL != dynamic_cast <const cPtr_gtlMap *> (var_copy_134260.ptr ())) {
               temp_5 = (cPtr_gtlMap *) var_copy_134260.ptr () ;
             }else{
-              inCompiler->castError ("gtlMap", var_copy_134260.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4306)) ;
+              inCompiler->castError ("gtlMap", var_copy_134260.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4309)) ;
             }
           }
-          object->mProperty_value = temp_5.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4306)) ;
-          object->mProperty_where = var_copy_134260.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4307)) ;
-          object->mProperty_meta = var_copy_134260.getter_meta (SOURCE_FILE ("gtl_data_types.galgas", 4308)) ;
+          object->mProperty_value = temp_5.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4309)) ;
+          object->mProperty_where = var_copy_134260.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4310)) ;
+          object->mProperty_meta = var_copy_134260.getter_meta (SOURCE_FILE ("gtl_data_types.galgas", 4311)) ;
         }
       }
       if (kBoolFalse == test_3) {
         TC_Array <C_FixItDescription> fixItArray6 ;
-        inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4310)), GALGAS_string ("unknown setter '").add_operation (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4310)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4310)).add_operation (GALGAS_string ("' for map target"), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4310)), fixItArray6  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4310)) ;
+        inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4313)), GALGAS_string ("unknown setter '").add_operation (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4313)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4313)).add_operation (GALGAS_string ("' for map target"), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4313)), fixItArray6  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4313)) ;
       }
     }
   }
@@ -3422,7 +3422,7 @@ static void extensionSetter_gtlMap_setMapItem (cPtr_gtlData * inObject,
   cPtr_gtlMap * object = (cPtr_gtlMap *) inObject ;
   macroValidSharedObject (object, cPtr_gtlMap) ;
   {
-  extensionSetter_replaceOrCreate (object->mProperty_value, constinArgument_name, constinArgument_data, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4321)) ;
+  extensionSetter_replaceOrCreate (object->mProperty_value, constinArgument_name, constinArgument_data, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4324)) ;
   }
 }
 //----------------------------------------------------------------------------------------------------------------------
@@ -3450,7 +3450,7 @@ static void extensionSetter_gtlMap_deleteMapItem (cPtr_gtlData * inObject,
   macroValidSharedObject (object, cPtr_gtlMap) ;
   {
   GALGAS_gtlData joker_134977 ; // Joker input parameter
-  object->mProperty_value.setter_del (constinArgument_name, joker_134977, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4327)) ;
+  object->mProperty_value.setter_del (constinArgument_name, joker_134977, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4330)) ;
   }
 }
 //----------------------------------------------------------------------------------------------------------------------
@@ -3479,13 +3479,13 @@ static void extensionMethod_gtlMap_mapItem (const cPtr_gtlData * inObject,
   macroValidSharedObject (object, cPtr_gtlMap) ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = object->mProperty_value.getter_hasKey (constinArgument_name.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4334)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4334)).boolEnum () ;
+    test_0 = object->mProperty_value.getter_hasKey (constinArgument_name.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4337)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4337)).boolEnum () ;
     if (kBoolTrue == test_0) {
-      object->mProperty_value.method_get (constinArgument_name, outArgument_result, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4335)) ;
+      object->mProperty_value.method_get (constinArgument_name, outArgument_result, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4338)) ;
     }
   }
   if (kBoolFalse == test_0) {
-    outArgument_result = GALGAS_gtlUnconstructed::constructor_new (constinArgument_name.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4337)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4337))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4337)) ;
+    outArgument_result = GALGAS_gtlUnconstructed::constructor_new (constinArgument_name.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4340)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4340))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4340)) ;
   }
 }
 
@@ -3513,7 +3513,7 @@ static GALGAS_bool extensionGetter_gtlMap_hasMapItem (const cPtr_gtlData * inObj
   GALGAS_bool result_result ; // Returned variable
   const cPtr_gtlMap * object = (const cPtr_gtlMap *) inObject ;
   macroValidSharedObject (object, cPtr_gtlMap) ;
-  result_result = object->mProperty_value.getter_hasKey (constinArgument_name.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4345)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4345)) ;
+  result_result = object->mProperty_value.getter_hasKey (constinArgument_name.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4348)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4348)) ;
 //---
   return result_result ;
 }
@@ -3543,7 +3543,7 @@ static GALGAS_string extensionGetter_gtlExpr_desc (const cPtr_gtlData * inObject
   GALGAS_string result_result ; // Returned variable
   const cPtr_gtlExpr * object = (const cPtr_gtlExpr *) inObject ;
   macroValidSharedObject (object, cPtr_gtlExpr) ;
-  result_result = GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (32)), constinArgument_tab  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4357)).add_operation (GALGAS_string ("expression: @\? "), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4357)).add_operation (callExtensionGetter_stringRepresentation ((const cPtr_gtlExpression *) object->mProperty_value.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4358)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4358)).add_operation (GALGAS_string (" \?\n"), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4358)) ;
+  result_result = GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (32)), constinArgument_tab  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4360)).add_operation (GALGAS_string ("expression: @\? "), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4360)).add_operation (callExtensionGetter_stringRepresentation ((const cPtr_gtlExpression *) object->mProperty_value.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4361)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4361)).add_operation (GALGAS_string (" \?\n"), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4361)) ;
 //---
   return result_result ;
 }
@@ -3573,7 +3573,7 @@ static GALGAS_string extensionGetter_gtlExpr_string (const cPtr_gtlData * inObje
   const cPtr_gtlExpr * object = (const cPtr_gtlExpr *) inObject ;
   macroValidSharedObject (object, cPtr_gtlExpr) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("expression forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4362)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("expression forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4365)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -3604,7 +3604,7 @@ static GALGAS_lstring extensionGetter_gtlExpr_lstring (const cPtr_gtlData * inOb
   const cPtr_gtlExpr * object = (const cPtr_gtlExpr *) inObject ;
   macroValidSharedObject (object, cPtr_gtlExpr) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("expression forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4366)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("expression forbidden"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4369)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -3635,7 +3635,7 @@ static GALGAS_bool extensionGetter_gtlExpr_bool (const cPtr_gtlData * inObject,
   const cPtr_gtlExpr * object = (const cPtr_gtlExpr *) inObject ;
   macroValidSharedObject (object, cPtr_gtlExpr) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("cannot cast an expression to a bool"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4370)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("cannot cast an expression to a bool"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4373)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -3666,7 +3666,7 @@ static GALGAS_bigint extensionGetter_gtlExpr_int (const cPtr_gtlData * inObject,
   const cPtr_gtlExpr * object = (const cPtr_gtlExpr *) inObject ;
   macroValidSharedObject (object, cPtr_gtlExpr) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("cannot cast an expression to an int"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4374)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("cannot cast an expression to an int"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4377)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -3697,7 +3697,7 @@ static GALGAS_double extensionGetter_gtlExpr_float (const cPtr_gtlData * inObjec
   const cPtr_gtlExpr * object = (const cPtr_gtlExpr *) inObject ;
   macroValidSharedObject (object, cPtr_gtlExpr) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("cannot cast an expression to a float"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4378)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("cannot cast an expression to a float"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4381)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -3757,7 +3757,7 @@ static GALGAS_gtlData extensionGetter_gtlExpr_minusOp (const cPtr_gtlData * inOb
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlExpr * object = (const cPtr_gtlExpr *) inObject ;
   macroValidSharedObject (object, cPtr_gtlExpr) ;
-  result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4388)), GALGAS_gtlMinusExpression::constructor_new (object->mProperty_where, object->mProperty_value  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4389))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4386)) ;
+  result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4391)), GALGAS_gtlMinusExpression::constructor_new (object->mProperty_where, object->mProperty_value  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4392))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4389)) ;
 //---
   return result_result ;
 }
@@ -3786,7 +3786,7 @@ static GALGAS_gtlData extensionGetter_gtlExpr_notOp (const cPtr_gtlData * inObje
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlExpr * object = (const cPtr_gtlExpr *) inObject ;
   macroValidSharedObject (object, cPtr_gtlExpr) ;
-  result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4396)), GALGAS_gtlNotExpression::constructor_new (object->mProperty_where, object->mProperty_value  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4397))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4394)) ;
+  result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4399)), GALGAS_gtlNotExpression::constructor_new (object->mProperty_where, object->mProperty_value  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4400))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4397)) ;
 //---
   return result_result ;
 }
@@ -3825,15 +3825,15 @@ static GALGAS_gtlData extensionGetter_gtlExpr_addOp (const cPtr_gtlData * inObje
         if (NULL != dynamic_cast <const cPtr_gtlExpr *> (constinArgument_right.ptr ())) {
           temp_1 = (cPtr_gtlExpr *) constinArgument_right.ptr () ;
         }else{
-          inCompiler->castError ("gtlExpr", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4406)) ;
+          inCompiler->castError ("gtlExpr", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4409)) ;
         }
       }
-      result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4405)), GALGAS_gtlAddExpression::constructor_new (object->mProperty_where, object->mProperty_value, temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4406))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4406))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4403)) ;
+      result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4408)), GALGAS_gtlAddExpression::constructor_new (object->mProperty_where, object->mProperty_value, temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4409))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4409))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4406)) ;
     }
   }
   if (kBoolFalse == test_0) {
     TC_Array <C_FixItDescription> fixItArray2 ;
-    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4409)), GALGAS_string ("Expression expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4409)) ;
+    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4412)), GALGAS_string ("Expression expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4412)) ;
     result_result.drop () ; // Release error dropped variable
   }
 //---
@@ -3874,15 +3874,15 @@ static GALGAS_gtlData extensionGetter_gtlExpr_subOp (const cPtr_gtlData * inObje
         if (NULL != dynamic_cast <const cPtr_gtlExpr *> (constinArgument_right.ptr ())) {
           temp_1 = (cPtr_gtlExpr *) constinArgument_right.ptr () ;
         }else{
-          inCompiler->castError ("gtlExpr", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4418)) ;
+          inCompiler->castError ("gtlExpr", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4421)) ;
         }
       }
-      result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4417)), GALGAS_gtlSubstractExpression::constructor_new (object->mProperty_where, object->mProperty_value, temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4418))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4418))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4415)) ;
+      result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4420)), GALGAS_gtlSubstractExpression::constructor_new (object->mProperty_where, object->mProperty_value, temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4421))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4421))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4418)) ;
     }
   }
   if (kBoolFalse == test_0) {
     TC_Array <C_FixItDescription> fixItArray2 ;
-    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4421)), GALGAS_string ("Expression expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4421)) ;
+    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4424)), GALGAS_string ("Expression expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4424)) ;
     result_result.drop () ; // Release error dropped variable
   }
 //---
@@ -3923,15 +3923,15 @@ static GALGAS_gtlData extensionGetter_gtlExpr_mulOp (const cPtr_gtlData * inObje
         if (NULL != dynamic_cast <const cPtr_gtlExpr *> (constinArgument_right.ptr ())) {
           temp_1 = (cPtr_gtlExpr *) constinArgument_right.ptr () ;
         }else{
-          inCompiler->castError ("gtlExpr", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4430)) ;
+          inCompiler->castError ("gtlExpr", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4433)) ;
         }
       }
-      result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4429)), GALGAS_gtlMultiplyExpression::constructor_new (object->mProperty_where, object->mProperty_value, temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4430))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4430))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4427)) ;
+      result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4432)), GALGAS_gtlMultiplyExpression::constructor_new (object->mProperty_where, object->mProperty_value, temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4433))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4433))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4430)) ;
     }
   }
   if (kBoolFalse == test_0) {
     TC_Array <C_FixItDescription> fixItArray2 ;
-    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4433)), GALGAS_string ("Expression expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4433)) ;
+    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4436)), GALGAS_string ("Expression expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4436)) ;
     result_result.drop () ; // Release error dropped variable
   }
 //---
@@ -3972,15 +3972,15 @@ static GALGAS_gtlData extensionGetter_gtlExpr_divOp (const cPtr_gtlData * inObje
         if (NULL != dynamic_cast <const cPtr_gtlExpr *> (constinArgument_right.ptr ())) {
           temp_1 = (cPtr_gtlExpr *) constinArgument_right.ptr () ;
         }else{
-          inCompiler->castError ("gtlExpr", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4442)) ;
+          inCompiler->castError ("gtlExpr", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4445)) ;
         }
       }
-      result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4441)), GALGAS_gtlDivideExpression::constructor_new (object->mProperty_where, object->mProperty_value, temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4442))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4442))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4439)) ;
+      result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4444)), GALGAS_gtlDivideExpression::constructor_new (object->mProperty_where, object->mProperty_value, temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4445))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4445))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4442)) ;
     }
   }
   if (kBoolFalse == test_0) {
     TC_Array <C_FixItDescription> fixItArray2 ;
-    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4445)), GALGAS_string ("Expression expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4445)) ;
+    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4448)), GALGAS_string ("Expression expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4448)) ;
     result_result.drop () ; // Release error dropped variable
   }
 //---
@@ -4021,15 +4021,15 @@ static GALGAS_gtlData extensionGetter_gtlExpr_modOp (const cPtr_gtlData * inObje
         if (NULL != dynamic_cast <const cPtr_gtlExpr *> (constinArgument_right.ptr ())) {
           temp_1 = (cPtr_gtlExpr *) constinArgument_right.ptr () ;
         }else{
-          inCompiler->castError ("gtlExpr", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4454)) ;
+          inCompiler->castError ("gtlExpr", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4457)) ;
         }
       }
-      result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4453)), GALGAS_gtlModulusExpression::constructor_new (object->mProperty_where, object->mProperty_value, temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4454))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4454))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4451)) ;
+      result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4456)), GALGAS_gtlModulusExpression::constructor_new (object->mProperty_where, object->mProperty_value, temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4457))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4457))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4454)) ;
     }
   }
   if (kBoolFalse == test_0) {
     TC_Array <C_FixItDescription> fixItArray2 ;
-    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4457)), GALGAS_string ("Expression expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4457)) ;
+    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4460)), GALGAS_string ("Expression expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4460)) ;
     result_result.drop () ; // Release error dropped variable
   }
 //---
@@ -4070,15 +4070,15 @@ static GALGAS_gtlData extensionGetter_gtlExpr_andOp (const cPtr_gtlData * inObje
         if (NULL != dynamic_cast <const cPtr_gtlExpr *> (constinArgument_right.ptr ())) {
           temp_1 = (cPtr_gtlExpr *) constinArgument_right.ptr () ;
         }else{
-          inCompiler->castError ("gtlExpr", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4466)) ;
+          inCompiler->castError ("gtlExpr", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4469)) ;
         }
       }
-      result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4465)), GALGAS_gtlAndExpression::constructor_new (object->mProperty_where, object->mProperty_value, temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4466))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4466))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4463)) ;
+      result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4468)), GALGAS_gtlAndExpression::constructor_new (object->mProperty_where, object->mProperty_value, temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4469))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4469))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4466)) ;
     }
   }
   if (kBoolFalse == test_0) {
     TC_Array <C_FixItDescription> fixItArray2 ;
-    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4469)), GALGAS_string ("Expression expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4469)) ;
+    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4472)), GALGAS_string ("Expression expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4472)) ;
     result_result.drop () ; // Release error dropped variable
   }
 //---
@@ -4119,15 +4119,15 @@ static GALGAS_gtlData extensionGetter_gtlExpr_orOp (const cPtr_gtlData * inObjec
         if (NULL != dynamic_cast <const cPtr_gtlExpr *> (constinArgument_right.ptr ())) {
           temp_1 = (cPtr_gtlExpr *) constinArgument_right.ptr () ;
         }else{
-          inCompiler->castError ("gtlExpr", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4478)) ;
+          inCompiler->castError ("gtlExpr", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4481)) ;
         }
       }
-      result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4477)), GALGAS_gtlOrExpression::constructor_new (object->mProperty_where, object->mProperty_value, temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4478))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4478))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4475)) ;
+      result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4480)), GALGAS_gtlOrExpression::constructor_new (object->mProperty_where, object->mProperty_value, temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4481))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4481))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4478)) ;
     }
   }
   if (kBoolFalse == test_0) {
     TC_Array <C_FixItDescription> fixItArray2 ;
-    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4481)), GALGAS_string ("Expression expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4481)) ;
+    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4484)), GALGAS_string ("Expression expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4484)) ;
     result_result.drop () ; // Release error dropped variable
   }
 //---
@@ -4168,15 +4168,15 @@ static GALGAS_gtlData extensionGetter_gtlExpr_xorOp (const cPtr_gtlData * inObje
         if (NULL != dynamic_cast <const cPtr_gtlExpr *> (constinArgument_right.ptr ())) {
           temp_1 = (cPtr_gtlExpr *) constinArgument_right.ptr () ;
         }else{
-          inCompiler->castError ("gtlExpr", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4490)) ;
+          inCompiler->castError ("gtlExpr", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4493)) ;
         }
       }
-      result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4489)), GALGAS_gtlXorExpression::constructor_new (object->mProperty_where, object->mProperty_value, temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4490))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4490))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4487)) ;
+      result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4492)), GALGAS_gtlXorExpression::constructor_new (object->mProperty_where, object->mProperty_value, temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4493))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4493))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4490)) ;
     }
   }
   if (kBoolFalse == test_0) {
     TC_Array <C_FixItDescription> fixItArray2 ;
-    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4493)), GALGAS_string ("Expression expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4493)) ;
+    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4496)), GALGAS_string ("Expression expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4496)) ;
     result_result.drop () ; // Release error dropped variable
   }
 //---
@@ -4217,15 +4217,15 @@ static GALGAS_gtlData extensionGetter_gtlExpr_slOp (const cPtr_gtlData * inObjec
         if (NULL != dynamic_cast <const cPtr_gtlExpr *> (constinArgument_right.ptr ())) {
           temp_1 = (cPtr_gtlExpr *) constinArgument_right.ptr () ;
         }else{
-          inCompiler->castError ("gtlExpr", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4502)) ;
+          inCompiler->castError ("gtlExpr", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4505)) ;
         }
       }
-      result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4501)), GALGAS_gtlShiftLeftExpression::constructor_new (object->mProperty_where, object->mProperty_value, temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4502))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4502))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4499)) ;
+      result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4504)), GALGAS_gtlShiftLeftExpression::constructor_new (object->mProperty_where, object->mProperty_value, temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4505))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4505))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4502)) ;
     }
   }
   if (kBoolFalse == test_0) {
     TC_Array <C_FixItDescription> fixItArray2 ;
-    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4505)), GALGAS_string ("Expression expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4505)) ;
+    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4508)), GALGAS_string ("Expression expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4508)) ;
     result_result.drop () ; // Release error dropped variable
   }
 //---
@@ -4266,15 +4266,15 @@ static GALGAS_gtlData extensionGetter_gtlExpr_srOp (const cPtr_gtlData * inObjec
         if (NULL != dynamic_cast <const cPtr_gtlExpr *> (constinArgument_right.ptr ())) {
           temp_1 = (cPtr_gtlExpr *) constinArgument_right.ptr () ;
         }else{
-          inCompiler->castError ("gtlExpr", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4514)) ;
+          inCompiler->castError ("gtlExpr", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4517)) ;
         }
       }
-      result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4513)), GALGAS_gtlShiftRightExpression::constructor_new (object->mProperty_where, object->mProperty_value, temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4514))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4514))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4511)) ;
+      result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4516)), GALGAS_gtlShiftRightExpression::constructor_new (object->mProperty_where, object->mProperty_value, temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4517))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4517))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4514)) ;
     }
   }
   if (kBoolFalse == test_0) {
     TC_Array <C_FixItDescription> fixItArray2 ;
-    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4517)), GALGAS_string ("Expression expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4517)) ;
+    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4520)), GALGAS_string ("Expression expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4520)) ;
     result_result.drop () ; // Release error dropped variable
   }
 //---
@@ -4315,15 +4315,15 @@ static GALGAS_gtlData extensionGetter_gtlExpr_neqOp (const cPtr_gtlData * inObje
         if (NULL != dynamic_cast <const cPtr_gtlExpr *> (constinArgument_right.ptr ())) {
           temp_1 = (cPtr_gtlExpr *) constinArgument_right.ptr () ;
         }else{
-          inCompiler->castError ("gtlExpr", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4526)) ;
+          inCompiler->castError ("gtlExpr", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4529)) ;
         }
       }
-      result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4525)), GALGAS_gtlNotEqualExpression::constructor_new (object->mProperty_where, object->mProperty_value, temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4526))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4526))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4523)) ;
+      result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4528)), GALGAS_gtlNotEqualExpression::constructor_new (object->mProperty_where, object->mProperty_value, temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4529))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4529))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4526)) ;
     }
   }
   if (kBoolFalse == test_0) {
     TC_Array <C_FixItDescription> fixItArray2 ;
-    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4529)), GALGAS_string ("Expression expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4529)) ;
+    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4532)), GALGAS_string ("Expression expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4532)) ;
     result_result.drop () ; // Release error dropped variable
   }
 //---
@@ -4364,15 +4364,15 @@ static GALGAS_gtlData extensionGetter_gtlExpr_eqOp (const cPtr_gtlData * inObjec
         if (NULL != dynamic_cast <const cPtr_gtlExpr *> (constinArgument_right.ptr ())) {
           temp_1 = (cPtr_gtlExpr *) constinArgument_right.ptr () ;
         }else{
-          inCompiler->castError ("gtlExpr", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4538)) ;
+          inCompiler->castError ("gtlExpr", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4541)) ;
         }
       }
-      result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4537)), GALGAS_gtlEqualExpression::constructor_new (object->mProperty_where, object->mProperty_value, temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4538))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4538))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4535)) ;
+      result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4540)), GALGAS_gtlEqualExpression::constructor_new (object->mProperty_where, object->mProperty_value, temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4541))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4541))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4538)) ;
     }
   }
   if (kBoolFalse == test_0) {
     TC_Array <C_FixItDescription> fixItArray2 ;
-    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4541)), GALGAS_string ("Expression expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4541)) ;
+    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4544)), GALGAS_string ("Expression expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4544)) ;
     result_result.drop () ; // Release error dropped variable
   }
 //---
@@ -4413,15 +4413,15 @@ static GALGAS_gtlData extensionGetter_gtlExpr_gtOp (const cPtr_gtlData * inObjec
         if (NULL != dynamic_cast <const cPtr_gtlExpr *> (constinArgument_right.ptr ())) {
           temp_1 = (cPtr_gtlExpr *) constinArgument_right.ptr () ;
         }else{
-          inCompiler->castError ("gtlExpr", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4550)) ;
+          inCompiler->castError ("gtlExpr", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4553)) ;
         }
       }
-      result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4549)), GALGAS_gtlGreaterThanExpression::constructor_new (object->mProperty_where, object->mProperty_value, temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4550))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4550))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4547)) ;
+      result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4552)), GALGAS_gtlGreaterThanExpression::constructor_new (object->mProperty_where, object->mProperty_value, temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4553))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4553))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4550)) ;
     }
   }
   if (kBoolFalse == test_0) {
     TC_Array <C_FixItDescription> fixItArray2 ;
-    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4553)), GALGAS_string ("Expression expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4553)) ;
+    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4556)), GALGAS_string ("Expression expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4556)) ;
     result_result.drop () ; // Release error dropped variable
   }
 //---
@@ -4462,15 +4462,15 @@ static GALGAS_gtlData extensionGetter_gtlExpr_geOp (const cPtr_gtlData * inObjec
         if (NULL != dynamic_cast <const cPtr_gtlExpr *> (constinArgument_right.ptr ())) {
           temp_1 = (cPtr_gtlExpr *) constinArgument_right.ptr () ;
         }else{
-          inCompiler->castError ("gtlExpr", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4562)) ;
+          inCompiler->castError ("gtlExpr", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4565)) ;
         }
       }
-      result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4561)), GALGAS_gtlGreaterOrEqualExpression::constructor_new (object->mProperty_where, object->mProperty_value, temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4562))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4562))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4559)) ;
+      result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4564)), GALGAS_gtlGreaterOrEqualExpression::constructor_new (object->mProperty_where, object->mProperty_value, temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4565))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4565))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4562)) ;
     }
   }
   if (kBoolFalse == test_0) {
     TC_Array <C_FixItDescription> fixItArray2 ;
-    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4565)), GALGAS_string ("Expression expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4565)) ;
+    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4568)), GALGAS_string ("Expression expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4568)) ;
     result_result.drop () ; // Release error dropped variable
   }
 //---
@@ -4511,15 +4511,15 @@ static GALGAS_gtlData extensionGetter_gtlExpr_ltOp (const cPtr_gtlData * inObjec
         if (NULL != dynamic_cast <const cPtr_gtlExpr *> (constinArgument_right.ptr ())) {
           temp_1 = (cPtr_gtlExpr *) constinArgument_right.ptr () ;
         }else{
-          inCompiler->castError ("gtlExpr", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4574)) ;
+          inCompiler->castError ("gtlExpr", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4577)) ;
         }
       }
-      result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4573)), GALGAS_gtlLowerThanExpression::constructor_new (object->mProperty_where, object->mProperty_value, temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4574))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4574))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4571)) ;
+      result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4576)), GALGAS_gtlLowerThanExpression::constructor_new (object->mProperty_where, object->mProperty_value, temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4577))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4577))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4574)) ;
     }
   }
   if (kBoolFalse == test_0) {
     TC_Array <C_FixItDescription> fixItArray2 ;
-    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4577)), GALGAS_string ("Expression expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4577)) ;
+    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4580)), GALGAS_string ("Expression expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4580)) ;
     result_result.drop () ; // Release error dropped variable
   }
 //---
@@ -4560,15 +4560,15 @@ static GALGAS_gtlData extensionGetter_gtlExpr_leOp (const cPtr_gtlData * inObjec
         if (NULL != dynamic_cast <const cPtr_gtlExpr *> (constinArgument_right.ptr ())) {
           temp_1 = (cPtr_gtlExpr *) constinArgument_right.ptr () ;
         }else{
-          inCompiler->castError ("gtlExpr", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4586)) ;
+          inCompiler->castError ("gtlExpr", constinArgument_right.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4589)) ;
         }
       }
-      result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4585)), GALGAS_gtlLowerOrEqualExpression::constructor_new (object->mProperty_where, object->mProperty_value, temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4586))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4586))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4583)) ;
+      result_result = GALGAS_gtlExpr::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4588)), GALGAS_gtlLowerOrEqualExpression::constructor_new (object->mProperty_where, object->mProperty_value, temp_1.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4589))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4589))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4586)) ;
     }
   }
   if (kBoolFalse == test_0) {
     TC_Array <C_FixItDescription> fixItArray2 ;
-    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4589)), GALGAS_string ("Expression expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4589)) ;
+    inCompiler->emitSemanticError (constinArgument_right.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4592)), GALGAS_string ("Expression expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4592)) ;
     result_result.drop () ; // Release error dropped variable
   }
 //---
@@ -4600,7 +4600,7 @@ static GALGAS_type extensionGetter_gtlExpr_embeddedType (const cPtr_gtlData * in
   const cPtr_gtlExpr * object = (const cPtr_gtlExpr *) inObject ;
   macroValidSharedObject (object, cPtr_gtlExpr) ;
   TC_Array <C_FixItDescription> fixItArray0 ;
-  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("expression forbidden as built in function argument"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4595)) ;
+  inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("expression forbidden as built in function argument"), fixItArray0  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4598)) ;
   result_result.drop () ; // Release error dropped variable
 //---
   return result_result ;
@@ -4630,7 +4630,7 @@ static void extensionMethod_gtlExpr_addMyValue (const cPtr_gtlData * inObject,
                                                 COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlExpr * object = (const cPtr_gtlExpr *) inObject ;
   macroValidSharedObject (object, cPtr_gtlExpr) ;
-  ioArgument_objectList.addAssign_operation (object->mProperty_value.getter_object (SOURCE_FILE ("gtl_data_types.galgas", 4600))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4600)) ;
+  ioArgument_objectList.addAssign_operation (object->mProperty_value.getter_object (SOURCE_FILE ("gtl_data_types.galgas", 4603))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4603)) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -4662,72 +4662,72 @@ static GALGAS_gtlData extensionGetter_gtlExpr_performGetter (const cPtr_gtlData
   macroValidSharedObject (object, cPtr_gtlExpr) ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = GALGAS_bool (kIsEqual, constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4613)).objectCompare (GALGAS_string ("eval"))).boolEnum () ;
+    test_0 = GALGAS_bool (kIsEqual, constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4616)).objectCompare (GALGAS_string ("eval"))).boolEnum () ;
     if (kBoolTrue == test_0) {
       {
-      routine_argumentsCheck (constinArgument_methodName, function_structArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4614)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4614)) ;
+      routine_argumentsCheck (constinArgument_methodName, function_structArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4617)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4617)) ;
       }
-      GALGAS_gtlData var_vars_142624 = constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4615)) ;
-      result_result = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_value.ptr (), constinArgument_context, var_vars_142624, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4616)) ;
+      GALGAS_gtlData var_vars_142624 = constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4618)) ;
+      result_result = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_value.ptr (), constinArgument_context, var_vars_142624, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4619)) ;
     }
   }
   if (kBoolFalse == test_0) {
     enumGalgasBool test_1 = kBoolTrue ;
     if (kBoolTrue == test_1) {
-      test_1 = GALGAS_bool (kIsEqual, GALGAS_string ("type").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4617)))).boolEnum () ;
+      test_1 = GALGAS_bool (kIsEqual, GALGAS_string ("type").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4620)))).boolEnum () ;
       if (kBoolTrue == test_1) {
         {
-        routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4618)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4618)) ;
+        routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4621)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4621)) ;
         }
         const GALGAS_gtlExpr temp_2 = object ;
-        result_result = GALGAS_gtlType::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4620)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4620)), temp_2.getter_dynamicType (SOURCE_FILE ("gtl_data_types.galgas", 4620))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4619)) ;
+        result_result = GALGAS_gtlType::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4623)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4623)), temp_2.getter_dynamicType (SOURCE_FILE ("gtl_data_types.galgas", 4623))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4622)) ;
       }
     }
     if (kBoolFalse == test_1) {
       enumGalgasBool test_3 = kBoolTrue ;
       if (kBoolTrue == test_3) {
-        test_3 = GALGAS_bool (kIsEqual, GALGAS_string ("isANumber").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4622)))).boolEnum () ;
+        test_3 = GALGAS_bool (kIsEqual, GALGAS_string ("isANumber").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4625)))).boolEnum () ;
         if (kBoolTrue == test_3) {
           {
-          routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4623)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4623)) ;
+          routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4626)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4626)) ;
           }
-          result_result = GALGAS_gtlBool::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4625)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4625)), GALGAS_bool (false)  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4624)) ;
+          result_result = GALGAS_gtlBool::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4628)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4628)), GALGAS_bool (false)  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4627)) ;
         }
       }
       if (kBoolFalse == test_3) {
         enumGalgasBool test_4 = kBoolTrue ;
         if (kBoolTrue == test_4) {
-          test_4 = GALGAS_bool (kIsEqual, GALGAS_string ("description").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4627)))).boolEnum () ;
+          test_4 = GALGAS_bool (kIsEqual, GALGAS_string ("description").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4630)))).boolEnum () ;
           if (kBoolTrue == test_4) {
             {
-            routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4628)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4628)) ;
+            routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4631)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4631)) ;
             }
-            result_result = GALGAS_gtlString::constructor_new (object->mProperty_meta.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4630)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4630)), object->mProperty_meta.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4630))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4629)) ;
+            result_result = GALGAS_gtlString::constructor_new (object->mProperty_meta.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4633)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4633)), object->mProperty_meta.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4633))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4632)) ;
           }
         }
         if (kBoolFalse == test_4) {
           enumGalgasBool test_5 = kBoolTrue ;
           if (kBoolTrue == test_5) {
-            test_5 = GALGAS_bool (kIsEqual, GALGAS_string ("location").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4632)))).boolEnum () ;
+            test_5 = GALGAS_bool (kIsEqual, GALGAS_string ("location").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4635)))).boolEnum () ;
             if (kBoolTrue == test_5) {
               {
-              routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4633)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4633)) ;
+              routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4636)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4636)) ;
               }
-              result_result = GALGAS_gtlString::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4635)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4635)), object->mProperty_where.getter_locationString (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4635))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4634)) ;
+              result_result = GALGAS_gtlString::constructor_new (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4638)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4638)), object->mProperty_where.getter_locationString (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4638))  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4637)) ;
             }
           }
           if (kBoolFalse == test_5) {
             enumGalgasBool test_6 = kBoolTrue ;
             if (kBoolTrue == test_6) {
-              test_6 = callExtensionGetter_getterExists ((const cPtr_library *) constinArgument_lib.ptr (), GALGAS_string ("expression"), constinArgument_methodName, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4637)).boolEnum () ;
+              test_6 = callExtensionGetter_getterExists ((const cPtr_library *) constinArgument_lib.ptr (), GALGAS_string ("expression"), constinArgument_methodName, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4640)).boolEnum () ;
               if (kBoolTrue == test_6) {
                 const GALGAS_gtlExpr temp_7 = object ;
-                result_result = callExtensionGetter_callGetter ((const cPtr_gtlGetter *) callExtensionGetter_getGetter ((const cPtr_library *) constinArgument_lib.ptr (), GALGAS_string ("expression"), constinArgument_methodName, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4638)).ptr (), constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4639)), constinArgument_context, constinArgument_lib, temp_7, constinArgument_arguments, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4638)) ;
+                result_result = callExtensionGetter_callGetter ((const cPtr_gtlGetter *) callExtensionGetter_getGetter ((const cPtr_library *) constinArgument_lib.ptr (), GALGAS_string ("expression"), constinArgument_methodName, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4641)).ptr (), constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4642)), constinArgument_context, constinArgument_lib, temp_7, constinArgument_arguments, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4641)) ;
               }
             }
             if (kBoolFalse == test_6) {
               TC_Array <C_FixItDescription> fixItArray8 ;
-              inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4646)), GALGAS_string ("unknown getter '").add_operation (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4646)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4646)).add_operation (GALGAS_string ("' for expression target"), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4646)), fixItArray8  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4646)) ;
+              inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4649)), GALGAS_string ("unknown getter '").add_operation (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4649)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4649)).add_operation (GALGAS_string ("' for expression target"), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4649)), fixItArray8  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4649)) ;
               result_result.drop () ; // Release error dropped variable
             }
           }
@@ -4768,61 +4768,61 @@ static void extensionSetter_gtlExpr_performSetter (cPtr_gtlData * inObject,
   macroValidSharedObject (object, cPtr_gtlExpr) ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = GALGAS_bool (kIsEqual, GALGAS_string ("setDescription").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4660)))).boolEnum () ;
+    test_0 = GALGAS_bool (kIsEqual, GALGAS_string ("setDescription").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4663)))).boolEnum () ;
     if (kBoolTrue == test_0) {
       {
-      routine_argumentsCheck (constinArgument_methodName, function_stringArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4661)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4661)) ;
+      routine_argumentsCheck (constinArgument_methodName, function_stringArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4664)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4664)) ;
       }
       GALGAS_gtlString temp_1 ;
-      if (constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4662)).isValid ()) {
-        if (NULL != dynamic_cast <const cPtr_gtlString *> (constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4662)).ptr ())) {
-          temp_1 = (cPtr_gtlString *) constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4662)).ptr () ;
+      if (constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4665)).isValid ()) {
+        if (NULL != dynamic_cast <const cPtr_gtlString *> (constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4665)).ptr ())) {
+          temp_1 = (cPtr_gtlString *) constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4665)).ptr () ;
         }else{
-          inCompiler->castError ("gtlString", constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4662)).ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4662)) ;
+          inCompiler->castError ("gtlString", constinArgument_arguments.getter_dataAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4665)).ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4665)) ;
         }
       }
       GALGAS_gtlString var_descriptionToSet_144268 = temp_1 ;
       {
-      object->setter_setMeta (callExtensionGetter_lstring ((const cPtr_gtlString *) var_descriptionToSet_144268.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4663)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4663)) ;
+      object->setter_setMeta (callExtensionGetter_lstring ((const cPtr_gtlString *) var_descriptionToSet_144268.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4666)) COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4666)) ;
       }
-      object->mProperty_where = constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4664)) ;
+      object->mProperty_where = constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4667)) ;
     }
   }
   if (kBoolFalse == test_0) {
     enumGalgasBool test_2 = kBoolTrue ;
     if (kBoolTrue == test_2) {
-      test_2 = GALGAS_bool (kIsEqual, GALGAS_string ("touch").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4665)))).boolEnum () ;
+      test_2 = GALGAS_bool (kIsEqual, GALGAS_string ("touch").objectCompare (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4668)))).boolEnum () ;
       if (kBoolTrue == test_2) {
         {
-        routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4666)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4666)) ;
+        routine_argumentsCheck (constinArgument_methodName, function_noArgument (inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4669)), constinArgument_arguments, inCompiler  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4669)) ;
         }
-        object->mProperty_where = constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4667)) ;
+        object->mProperty_where = constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4670)) ;
       }
     }
     if (kBoolFalse == test_2) {
       enumGalgasBool test_3 = kBoolTrue ;
       if (kBoolTrue == test_3) {
-        test_3 = callExtensionGetter_setterExists ((const cPtr_library *) constinArgument_lib.ptr (), GALGAS_string ("expression"), constinArgument_methodName, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4668)).boolEnum () ;
+        test_3 = callExtensionGetter_setterExists ((const cPtr_library *) constinArgument_lib.ptr (), GALGAS_string ("expression"), constinArgument_methodName, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4671)).boolEnum () ;
         if (kBoolTrue == test_3) {
           const GALGAS_gtlExpr temp_4 = object ;
           GALGAS_gtlData var_copy_144570 = temp_4 ;
-          callExtensionMethod_callSetter ((const cPtr_gtlSetter *) callExtensionGetter_getSetter ((const cPtr_library *) constinArgument_lib.ptr (), GALGAS_string ("expression"), constinArgument_methodName, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4670)).ptr (), constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4671)), constinArgument_context, constinArgument_lib, var_copy_144570, constinArgument_arguments, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4670)) ;
+          callExtensionMethod_callSetter ((const cPtr_gtlSetter *) callExtensionGetter_getSetter ((const cPtr_library *) constinArgument_lib.ptr (), GALGAS_string ("expression"), constinArgument_methodName, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4673)).ptr (), constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4674)), constinArgument_context, constinArgument_lib, var_copy_144570, constinArgument_arguments, inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4673)) ;
           GALGAS_gtlExpr temp_5 ;
           if (var_copy_144570.isValid ()) {
             if (NULL != dynamic_cast <const cPtr_gtlExpr *> (var_copy_144570.ptr ())) {
               temp_5 = (cPtr_gtlExpr *) var_copy_144570.ptr () ;
             }else{
-              inCompiler->castError ("gtlExpr", var_copy_144570.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4677)) ;
+              inCompiler->castError ("gtlExpr", var_copy_144570.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4680)) ;
             }
           }
-          object->mProperty_value = temp_5.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4677)) ;
-          object->mProperty_where = var_copy_144570.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4678)) ;
-          object->mProperty_meta = var_copy_144570.getter_meta (SOURCE_FILE ("gtl_data_types.galgas", 4679)) ;
+          object->mProperty_value = temp_5.getter_value (SOURCE_FILE ("gtl_data_types.galgas", 4680)) ;
+          object->mProperty_where = var_copy_144570.getter_where (SOURCE_FILE ("gtl_data_types.galgas", 4681)) ;
+          object->mProperty_meta = var_copy_144570.getter_meta (SOURCE_FILE ("gtl_data_types.galgas", 4682)) ;
         }
       }
       if (kBoolFalse == test_3) {
         TC_Array <C_FixItDescription> fixItArray6 ;
-        inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4681)), GALGAS_string ("unknown setter '").add_operation (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4681)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4681)).add_operation (GALGAS_string ("' for expression target"), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4681)), fixItArray6  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4681)) ;
+        inCompiler->emitSemanticError (constinArgument_methodName.getter_location (SOURCE_FILE ("gtl_data_types.galgas", 4684)), GALGAS_string ("unknown setter '").add_operation (constinArgument_methodName.getter_string (SOURCE_FILE ("gtl_data_types.galgas", 4684)), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4684)).add_operation (GALGAS_string ("' for expression target"), inCompiler COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4684)), fixItArray6  COMMA_SOURCE_FILE ("gtl_data_types.galgas", 4684)) ;
       }
     }
   }
@@ -4853,7 +4853,7 @@ static void extensionMethod_gtlLetUnconstructedInstruction_execute (const cPtr_g
                                                                     COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlLetUnconstructedInstruction * object = (const cPtr_gtlLetUnconstructedInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlLetUnconstructedInstruction) ;
-  extensionMethod_set (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, GALGAS_gtlUnconstructed::constructor_new (callExtensionGetter_location ((const cPtr_gtlVarItem *) object->mProperty_lValue.getter_itemAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 126)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 126)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 126))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 125)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 125)) ;
+  extensionMethod_set (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, GALGAS_gtlUnconstructed::constructor_new (callExtensionGetter_location ((const cPtr_gtlVarItem *) object->mProperty_lValue.getter_itemAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 144)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 144)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 144))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 143)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 143)) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -4882,7 +4882,7 @@ static void extensionMethod_gtlLetInstruction_execute (const cPtr_gtlInstruction
                                                        COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlLetInstruction * object = (const cPtr_gtlLetInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlLetInstruction) ;
-  extensionMethod_set (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rValue.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 149)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 149)) ;
+  extensionMethod_set (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rValue.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 167)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 167)) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -4911,7 +4911,7 @@ static void extensionMethod_gtlLetAddInstruction_execute (const cPtr_gtlInstruct
                                                           COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlLetAddInstruction * object = (const cPtr_gtlLetAddInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlLetAddInstruction) ;
-  extensionMethod_set (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, callExtensionGetter_addOp ((const cPtr_gtlData *) extensionGetter_get (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 167)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rValue.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 168)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 167)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 163)) ;
+  extensionMethod_set (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, callExtensionGetter_addOp ((const cPtr_gtlData *) extensionGetter_get (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 185)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rValue.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 186)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 185)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 181)) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -4940,7 +4940,7 @@ static void extensionMethod_gtlLetSubstractInstruction_execute (const cPtr_gtlIn
                                                                 COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlLetSubstractInstruction * object = (const cPtr_gtlLetSubstractInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlLetSubstractInstruction) ;
-  extensionMethod_set (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, callExtensionGetter_subOp ((const cPtr_gtlData *) extensionGetter_get (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 187)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rValue.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 188)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 187)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 183)) ;
+  extensionMethod_set (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, callExtensionGetter_subOp ((const cPtr_gtlData *) extensionGetter_get (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 205)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rValue.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 206)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 205)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 201)) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -4969,7 +4969,7 @@ static void extensionMethod_gtlLetMultiplyInstruction_execute (const cPtr_gtlIns
                                                                COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlLetMultiplyInstruction * object = (const cPtr_gtlLetMultiplyInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlLetMultiplyInstruction) ;
-  extensionMethod_set (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, callExtensionGetter_mulOp ((const cPtr_gtlData *) extensionGetter_get (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 207)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rValue.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 208)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 207)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 203)) ;
+  extensionMethod_set (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, callExtensionGetter_mulOp ((const cPtr_gtlData *) extensionGetter_get (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 225)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rValue.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 226)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 225)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 221)) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -4998,7 +4998,7 @@ static void extensionMethod_gtlLetDivideInstruction_execute (const cPtr_gtlInstr
                                                              COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlLetDivideInstruction * object = (const cPtr_gtlLetDivideInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlLetDivideInstruction) ;
-  extensionMethod_set (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, callExtensionGetter_divOp ((const cPtr_gtlData *) extensionGetter_get (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 227)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rValue.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 228)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 227)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 223)) ;
+  extensionMethod_set (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, callExtensionGetter_divOp ((const cPtr_gtlData *) extensionGetter_get (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 245)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rValue.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 246)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 245)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 241)) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -5027,7 +5027,7 @@ static void extensionMethod_gtlLetModuloInstruction_execute (const cPtr_gtlInstr
                                                              COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlLetModuloInstruction * object = (const cPtr_gtlLetModuloInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlLetModuloInstruction) ;
-  extensionMethod_set (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, callExtensionGetter_divOp ((const cPtr_gtlData *) extensionGetter_get (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 247)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rValue.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 248)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 247)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 243)) ;
+  extensionMethod_set (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, callExtensionGetter_divOp ((const cPtr_gtlData *) extensionGetter_get (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 265)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rValue.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 266)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 265)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 261)) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -5056,7 +5056,7 @@ static void extensionMethod_gtlLetShiftLeftInstruction_execute (const cPtr_gtlIn
                                                                 COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlLetShiftLeftInstruction * object = (const cPtr_gtlLetShiftLeftInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlLetShiftLeftInstruction) ;
-  extensionMethod_set (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, callExtensionGetter_slOp ((const cPtr_gtlData *) extensionGetter_get (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 267)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rValue.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 268)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 267)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 263)) ;
+  extensionMethod_set (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, callExtensionGetter_slOp ((const cPtr_gtlData *) extensionGetter_get (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 285)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rValue.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 286)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 285)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 281)) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -5085,7 +5085,7 @@ static void extensionMethod_gtlLetShiftRightInstruction_execute (const cPtr_gtlI
                                                                  COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlLetShiftRightInstruction * object = (const cPtr_gtlLetShiftRightInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlLetShiftRightInstruction) ;
-  extensionMethod_set (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, callExtensionGetter_srOp ((const cPtr_gtlData *) extensionGetter_get (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 287)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rValue.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 288)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 287)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 283)) ;
+  extensionMethod_set (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, callExtensionGetter_srOp ((const cPtr_gtlData *) extensionGetter_get (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 305)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rValue.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 306)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 305)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 301)) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -5114,7 +5114,7 @@ static void extensionMethod_gtlLetAndInstruction_execute (const cPtr_gtlInstruct
                                                           COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlLetAndInstruction * object = (const cPtr_gtlLetAndInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlLetAndInstruction) ;
-  extensionMethod_set (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, callExtensionGetter_andOp ((const cPtr_gtlData *) extensionGetter_get (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 307)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rValue.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 308)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 307)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 303)) ;
+  extensionMethod_set (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, callExtensionGetter_andOp ((const cPtr_gtlData *) extensionGetter_get (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 325)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rValue.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 326)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 325)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 321)) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -5143,7 +5143,7 @@ static void extensionMethod_gtlLetOrInstruction_execute (const cPtr_gtlInstructi
                                                          COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlLetOrInstruction * object = (const cPtr_gtlLetOrInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlLetOrInstruction) ;
-  extensionMethod_set (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, callExtensionGetter_orOp ((const cPtr_gtlData *) extensionGetter_get (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 327)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rValue.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 328)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 327)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 323)) ;
+  extensionMethod_set (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, callExtensionGetter_orOp ((const cPtr_gtlData *) extensionGetter_get (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 345)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rValue.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 346)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 345)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 341)) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -5172,7 +5172,7 @@ static void extensionMethod_gtlLetXorInstruction_execute (const cPtr_gtlInstruct
                                                           COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlLetXorInstruction * object = (const cPtr_gtlLetXorInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlLetXorInstruction) ;
-  extensionMethod_set (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, callExtensionGetter_xorOp ((const cPtr_gtlData *) extensionGetter_get (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 347)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rValue.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 348)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 347)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 343)) ;
+  extensionMethod_set (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, callExtensionGetter_xorOp ((const cPtr_gtlData *) extensionGetter_get (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 365)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rValue.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 366)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 365)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 361)) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -5201,7 +5201,7 @@ static void extensionMethod_gtlUnletInstruction_execute (const cPtr_gtlInstructi
                                                          COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlUnletInstruction * object = (const cPtr_gtlUnletInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlUnletInstruction) ;
-  extensionMethod_delete (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 363)) ;
+  extensionMethod_delete (object->mProperty_lValue, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 381)) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -5230,7 +5230,7 @@ static void extensionMethod_gtlTemplateStringInstruction_execute (const cPtr_gtl
                                                                   COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlTemplateStringInstruction * object = (const cPtr_gtlTemplateStringInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlTemplateStringInstruction) ;
-  ioArgument_outputString.plusAssign_operation(object->mProperty_value, inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 383)) ;
+  ioArgument_outputString.plusAssign_operation(object->mProperty_value, inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 401)) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -5259,7 +5259,7 @@ static void extensionMethod_gtlEmitInstruction_execute (const cPtr_gtlInstructio
                                                         COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlEmitInstruction * object = (const cPtr_gtlEmitInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlEmitInstruction) ;
-  ioArgument_outputString.plusAssign_operation(callExtensionGetter_string ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rValue.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 399)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 399)), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 399)) ;
+  ioArgument_outputString.plusAssign_operation(callExtensionGetter_string ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rValue.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 417)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 417)), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 417)) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -5288,49 +5288,113 @@ static void extensionMethod_gtlWriteToInstruction_execute (const cPtr_gtlInstruc
                                                            COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlWriteToInstruction * object = (const cPtr_gtlWriteToInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlWriteToInstruction) ;
-  GALGAS_uint var_currentErrorCount_12222 = GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_instructions.galgas", 418)) ;
-  GALGAS_string var_fullFileName_12264 = callExtensionGetter_string ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_fileNameExpression.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 419)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 419)) ;
-  GALGAS_gtlString var_fileName_12343 = GALGAS_gtlString::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 422)), var_fullFileName_12264.getter_lastPathComponent (SOURCE_FILE ("gtl_instructions.galgas", 423))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 420)) ;
-  GALGAS_gtlString var_filePath_12446 = GALGAS_gtlString::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 427)), var_fullFileName_12264.getter_nativePathWithUnixPath (SOURCE_FILE ("gtl_instructions.galgas", 428))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 425)) ;
+  GALGAS_uint var_currentErrorCount_12222 = GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_instructions.galgas", 436)) ;
+  GALGAS_string var_fullFileName_12264 = callExtensionGetter_string ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_fileNameExpression.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 437)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 437)) ;
+  GALGAS_gtlString var_fileName_12343 = GALGAS_gtlString::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 440)), var_fullFileName_12264.getter_lastPathComponent (SOURCE_FILE ("gtl_instructions.galgas", 441))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 438)) ;
+  GALGAS_gtlString var_filePath_12446 = GALGAS_gtlString::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 445)), var_fullFileName_12264.getter_nativePathWithUnixPath (SOURCE_FILE ("gtl_instructions.galgas", 446))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 443)) ;
   GALGAS_string var_result_12551 = GALGAS_string::makeEmptyString () ;
   GALGAS_gtlData var_varsCopy_12576 = ioArgument_vars ;
   {
   var_varsCopy_12576.insulate (HERE) ;
   cPtr_gtlData * ptr_12678 = (cPtr_gtlData *) var_varsCopy_12576.ptr () ;
-  callExtensionSetter_setStructFieldAtLevel ((cPtr_gtlData *) ptr_12678, GALGAS_lstring::constructor_new (GALGAS_string ("FILENAME"), object->mProperty_where  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 435)), var_fileName_12343, GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 434)) ;
+  callExtensionSetter_setStructFieldAtLevel ((cPtr_gtlData *) ptr_12678, GALGAS_lstring::constructor_new (GALGAS_string ("FILENAME"), object->mProperty_where  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 453)), var_fileName_12343, GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 452)) ;
   }
   {
   var_varsCopy_12576.insulate (HERE) ;
   cPtr_gtlData * ptr_12777 = (cPtr_gtlData *) var_varsCopy_12576.ptr () ;
-  callExtensionSetter_setStructFieldAtLevel ((cPtr_gtlData *) ptr_12777, GALGAS_lstring::constructor_new (GALGAS_string ("FILEPATH"), object->mProperty_where  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 440)), var_filePath_12446, GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 439)) ;
+  callExtensionSetter_setStructFieldAtLevel ((cPtr_gtlData *) ptr_12777, GALGAS_lstring::constructor_new (GALGAS_string ("FILEPATH"), object->mProperty_where  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 458)), var_filePath_12446, GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 457)) ;
   }
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = GALGAS_bool (kIsEqual, var_currentErrorCount_12222.objectCompare (GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_instructions.galgas", 445)))).boolEnum () ;
+    test_0 = GALGAS_bool (kIsEqual, var_currentErrorCount_12222.objectCompare (GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_instructions.galgas", 463)))).boolEnum () ;
     if (kBoolTrue == test_0) {
-      extensionMethod_execute (object->mProperty_instructions, ioArgument_context, var_varsCopy_12576, ioArgument_lib, var_result_12551, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 446)) ;
-      enumGalgasBool test_1 = kBoolTrue ;
-      if (kBoolTrue == test_1) {
-        test_1 = GALGAS_bool (kIsEqual, var_currentErrorCount_12222.objectCompare (GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_instructions.galgas", 447)))).boolEnum () ;
-        if (kBoolTrue == test_1) {
-          enumGalgasBool test_2 = kBoolTrue ;
-          if (kBoolTrue == test_2) {
-            test_2 = object->mProperty_isExecutable.boolEnum () ;
-            if (kBoolTrue == test_2) {
-              GALGAS_string var_directory_13083 = var_fullFileName_12264.getter_stringByDeletingLastPathComponent (SOURCE_FILE ("gtl_instructions.galgas", 449)) ;
-              enumGalgasBool test_3 = kBoolTrue ;
-              if (kBoolTrue == test_3) {
-                test_3 = GALGAS_bool (kIsNotEqual, var_directory_13083.objectCompare (GALGAS_string::makeEmptyString ())).boolEnum () ;
-                if (kBoolTrue == test_3) {
-                  var_directory_13083.method_makeDirectory (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 450)) ;
-                }
+      GALGAS_bool var_watch_13793 = GALGAS_bool (gOption_goil_5F_options_watch.getter_value ()) ;
+      GALGAS_bool test_1 = var_watch_13793 ;
+      if (kBoolTrue == test_1.boolEnum ()) {
+        test_1 = function_outputIsUpToDate (var_fullFileName_12264, var_varsCopy_12576, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 467)) ;
+      }
+      GALGAS_bool var_upToDate_13845 = test_1 ;
+      enumGalgasBool test_2 = kBoolTrue ;
+      if (kBoolTrue == test_2) {
+        GALGAS_bool test_3 = var_upToDate_13845.operator_not (SOURCE_FILE ("gtl_instructions.galgas", 470)) ;
+        if (kBoolTrue == test_3.boolEnum ()) {
+          test_3 = GALGAS_application::constructor_startOutputJob (function_outputJobCount (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 470)) COMMA_SOURCE_FILE ("gtl_instructions.galgas", 470)) ;
+        }
+        test_2 = test_3.boolEnum () ;
+        if (kBoolTrue == test_2) {
+          GALGAS_uint var_currentWarningCount_14104 = GALGAS_uint::constructor_warningCount (SOURCE_FILE ("gtl_instructions.galgas", 471)) ;
+          GALGAS_gtlData var_entryVars_14160 = var_varsCopy_12576 ;
+          enumGalgasBool test_4 = kBoolTrue ;
+          if (kBoolTrue == test_4) {
+            test_4 = var_watch_13793.boolEnum () ;
+            if (kBoolTrue == test_4) {
+              GALGAS_application::class_method_beginOutputDependencies (SOURCE_FILE ("gtl_instructions.galgas", 474)) ;
+              GALGAS_application::class_method_addOutputFileDependency (object->mProperty_where.getter_file (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 475))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 475)) ;
+            }
+          }
+          GALGAS_string var_partFileName_13011 = var_fullFileName_12264.add_operation (GALGAS_string (".part"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 479)) ;
+          GALGAS_string::class_method_deleteFileIfExists (var_partFileName_13011, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 480)) ;
+          GALGAS_string var_enclosingOutputFile_13105 = ioArgument_lib.getter_outputFile (SOURCE_FILE ("gtl_instructions.galgas", 481)) ;
+          {
+          ioArgument_lib.setter_setOutputFile (var_partFileName_13011 COMMA_SOURCE_FILE ("gtl_instructions.galgas", 482)) ;
+          }
+          enumGalgasBool test_5 = kBoolTrue ;
+          if (kBoolTrue == test_5) {
+            test_5 = GALGAS_bool (gOption_gtl_5F_options_profile.getter_value ()).boolEnum () ;
+            if (kBoolTrue == test_5) {
+              GALGAS_timer var_timer_13148 = GALGAS_timer::constructor_start (SOURCE_FILE ("gtl_instructions.galgas", 484)) ;
+              GALGAS_string var_callerStack_13276 ;
+              {
+              ioArgument_lib.insulate (HERE) ;
+              cPtr_library * ptr_13175 = (cPtr_library *) ioArgument_lib.ptr () ;
+              callExtensionSetter_enterProfileFrame ((cPtr_library *) ptr_13175, GALGAS_string ("write to ").add_operation (var_fullFileName_12264.getter_lastPathComponent (SOURCE_FILE ("gtl_instructions.galgas", 486)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 486)), var_callerStack_13276, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 485)) ;
+              }
+              extensionMethod_execute (object->mProperty_instructions, ioArgument_context, var_varsCopy_12576, ioArgument_lib, var_result_12551, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 489)) ;
+              {
+              ioArgument_lib.insulate (HERE) ;
+              cPtr_library * ptr_13365 = (cPtr_library *) ioArgument_lib.ptr () ;
+              callExtensionSetter_leaveProfileFrame ((cPtr_library *) ptr_13365, var_callerStack_13276, var_timer_13148, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 490)) ;
               }
-              var_result_12551.method_writeToExecutableFile (var_fullFileName_12264, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 451)) ;
             }
           }
-          if (kBoolFalse == test_2) {
-            var_result_12551.method_makeDirectoryAndWriteToFile (var_fullFileName_12264, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 453)) ;
+          if (kBoolFalse == test_5) {
+            extensionMethod_execute (object->mProperty_instructions, ioArgument_context, var_varsCopy_12576, ioArgument_lib, var_result_12551, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 492)) ;
+          }
+          {
+          ioArgument_lib.setter_setOutputFile (var_enclosingOutputFile_13105 COMMA_SOURCE_FILE ("gtl_instructions.galgas", 494)) ;
+          }
+          enumGalgasBool test_6 = kBoolTrue ;
+          if (kBoolTrue == test_6) {
+            test_6 = GALGAS_bool (kIsEqual, var_currentErrorCount_12222.objectCompare (GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_instructions.galgas", 495)))).boolEnum () ;
+            if (kBoolTrue == test_6) {
+              var_result_12551.method_writeToFileWithPart (var_fullFileName_12264, var_partFileName_13011, object->mProperty_isExecutable, var_watch_13793, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 498)) ;
+            }
+          }
+          if (kBoolFalse == test_6) {
+            GALGAS_string::class_method_deleteFileIfExists (var_partFileName_13011, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 505)) ;
+          }
+          enumGalgasBool test_7 = kBoolTrue ;
+          if (kBoolTrue == test_7) {
+            test_7 = var_watch_13793.boolEnum () ;
+            if (kBoolTrue == test_7) {
+              GALGAS_application::class_method_addOutputFileDependency (var_fullFileName_12264  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 510)) ;
+              GALGAS_stringlist var_dependencies_15755 = GALGAS_application::constructor_endOutputDependencies (SOURCE_FILE ("gtl_instructions.galgas", 511)) ;
+              GALGAS_string var_record_15821 = GALGAS_string::makeEmptyString () ;
+              enumGalgasBool test_8 = kBoolTrue ;
+              if (kBoolTrue == test_8) {
+                GALGAS_bool test_9 = GALGAS_bool (kIsEqual, var_currentErrorCount_12222.objectCompare (GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_instructions.galgas", 513)))) ;
+                if (kBoolTrue == test_9.boolEnum ()) {
+                  test_9 = GALGAS_bool (kIsEqual, var_currentWarningCount_14104.objectCompare (GALGAS_uint::constructor_warningCount (SOURCE_FILE ("gtl_instructions.galgas", 514)))) ;
+                }
+                test_8 = test_9.boolEnum () ;
+                if (kBoolTrue == test_8) {
+                  var_record_15821 = function_outputRecord (var_dependencies_15755, var_entryVars_14160, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 515)) ;
+                }
+              }
+              GALGAS_application::class_method_setOutputRecord (var_fullFileName_12264, var_record_15821  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 517)) ;
+            }
           }
+          GALGAS_application::class_method_endOutputJob (SOURCE_FILE ("gtl_instructions.galgas", 519)) ;
         }
       }
     }
@@ -5366,38 +5430,39 @@ static void extensionMethod_gtlTemplateInstruction_execute (const cPtr_gtlInstru
   GALGAS_gtlContext var_newContext_13973 = ioArgument_context ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = GALGAS_bool (kIsNotEqual, GALGAS_string::makeEmptyString ().objectCompare (object->mProperty_prefix.getter_string (SOURCE_FILE ("gtl_instructions.galgas", 479)))).boolEnum () ;
+    test_0 = GALGAS_bool (kIsNotEqual, GALGAS_string::makeEmptyString ().objectCompare (object->mProperty_prefix.getter_string (SOURCE_FILE ("gtl_instructions.galgas", 544)))).boolEnum () ;
     if (kBoolTrue == test_0) {
       {
-      var_newContext_13973.setter_setPrefix (object->mProperty_prefix COMMA_SOURCE_FILE ("gtl_instructions.galgas", 480)) ;
+      var_newContext_13973.setter_setPrefix (object->mProperty_prefix COMMA_SOURCE_FILE ("gtl_instructions.galgas", 545)) ;
       }
     }
   }
   GALGAS_gtlString temp_1 ;
-  if (callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_fileName.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 486)).isValid ()) {
-    if (NULL != dynamic_cast <const cPtr_gtlString *> (callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_fileName.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 486)).ptr ())) {
-      temp_1 = (cPtr_gtlString *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_fileName.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 486)).ptr () ;
+  if (callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_fileName.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 551)).isValid ()) {
+    if (NULL != dynamic_cast <const cPtr_gtlString *> (callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_fileName.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 551)).ptr ())) {
+      temp_1 = (cPtr_gtlString *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_fileName.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 551)).ptr () ;
     }else{
-      inCompiler->castError ("gtlString", callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_fileName.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 486)).ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 486)) ;
+      inCompiler->castError ("gtlString", callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_fileName.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 551)).ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 551)) ;
     }
   }
-  GALGAS_lstring var_templateFileName_14079 = callExtensionGetter_fullTemplateFileName ((const cPtr_gtlContext *) var_newContext_13973.ptr (), ioArgument_context, ioArgument_vars, callExtensionGetter_lstring ((const cPtr_gtlString *) temp_1.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 486)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 483)) ;
+  GALGAS_lstring var_templateFileName_14079 = callExtensionGetter_fullTemplateFileName ((const cPtr_gtlContext *) var_newContext_13973.ptr (), ioArgument_context, ioArgument_vars, callExtensionGetter_lstring ((const cPtr_gtlString *) temp_1.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 551)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 548)) ;
+  GALGAS_application::class_method_addOutputFileDependency (var_templateFileName_14079.getter_string (SOURCE_FILE ("gtl_instructions.galgas", 554))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 554)) ;
   GALGAS_gtlData var_localVars_14230 ;
   {
-  var_newContext_13973.setter_setInputVars (GALGAS_gtlDataList::constructor_emptyList (SOURCE_FILE ("gtl_instructions.galgas", 490)) COMMA_SOURCE_FILE ("gtl_instructions.galgas", 490)) ;
+  var_newContext_13973.setter_setInputVars (GALGAS_gtlDataList::constructor_emptyList (SOURCE_FILE ("gtl_instructions.galgas", 557)) COMMA_SOURCE_FILE ("gtl_instructions.galgas", 557)) ;
   }
   enumGalgasBool test_2 = kBoolTrue ;
   if (kBoolTrue == test_2) {
-    test_2 = object->mProperty_isGlobal.operator_not (SOURCE_FILE ("gtl_instructions.galgas", 491)).boolEnum () ;
+    test_2 = object->mProperty_isGlobal.operator_not (SOURCE_FILE ("gtl_instructions.galgas", 558)).boolEnum () ;
     if (kBoolTrue == test_2) {
-      var_localVars_14230 = GALGAS_gtlStruct::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 493)), GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("gtl_instructions.galgas", 493))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 493)) ;
+      var_localVars_14230 = GALGAS_gtlStruct::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 560)), GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("gtl_instructions.galgas", 560))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 560)) ;
       cEnumerator_gtlExpressionList enumerator_14452 (object->mProperty_arguments, kENUMERATION_UP) ;
       while (enumerator_14452.hasCurrentObject ()) {
-        GALGAS_gtlData var_evaluedArg_14481 = callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_14452.current_expression (HERE).ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 495)) ;
+        GALGAS_gtlData var_evaluedArg_14481 = callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_14452.current_expression (HERE).ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 562)) ;
         {
         var_newContext_13973.insulate (HERE) ;
         cPtr_gtlContext * ptr_14549 = (cPtr_gtlContext *) var_newContext_13973.ptr () ;
-        callExtensionSetter_addInputVariable ((cPtr_gtlContext *) ptr_14549, var_evaluedArg_14481, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 496)) ;
+        callExtensionSetter_addInputVariable ((cPtr_gtlContext *) ptr_14549, var_evaluedArg_14481, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 563)) ;
         }
         enumerator_14452.gotoNextObject () ;
       }
@@ -5411,28 +5476,49 @@ static void extensionMethod_gtlTemplateInstruction_execute (const cPtr_gtlInstru
   {
   ioArgument_lib.insulate (HERE) ;
   cPtr_library * ptr_14633 = (cPtr_library *) ioArgument_lib.ptr () ;
-  callExtensionSetter_getTemplate ((cPtr_library *) ptr_14633, var_newContext_13973, var_templateFileName_14079, object->mProperty_ifExists, ioArgument_lib, var_found_14731, var_result_14756, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 502)) ;
+  callExtensionSetter_getTemplate ((cPtr_library *) ptr_14633, var_newContext_13973, var_templateFileName_14079, object->mProperty_ifExists, ioArgument_lib, var_found_14731, var_result_14756, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 569)) ;
   }
   enumGalgasBool test_3 = kBoolTrue ;
   if (kBoolTrue == test_3) {
     test_3 = var_found_14731.boolEnum () ;
     if (kBoolTrue == test_3) {
-      callExtensionMethod_execute ((const cPtr_gtlTemplate *) var_result_14756.ptr (), var_newContext_13973, var_localVars_14230, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 512)) ;
+      enumGalgasBool test_4 = kBoolTrue ;
+      if (kBoolTrue == test_4) {
+        test_4 = GALGAS_bool (gOption_gtl_5F_options_profile.getter_value ()).boolEnum () ;
+        if (kBoolTrue == test_4) {
+          GALGAS_timer var_timer_14964 = GALGAS_timer::constructor_start (SOURCE_FILE ("gtl_instructions.galgas", 580)) ;
+          GALGAS_string var_callerStack_15094 ;
+          {
+          ioArgument_lib.insulate (HERE) ;
+          cPtr_library * ptr_14991 = (cPtr_library *) ioArgument_lib.ptr () ;
+          callExtensionSetter_enterProfileFrame ((cPtr_library *) ptr_14991, var_result_14756.getter_path (SOURCE_FILE ("gtl_instructions.galgas", 582)).getter_lastPathComponent (SOURCE_FILE ("gtl_instructions.galgas", 582)).getter_stringByDeletingPathExtension (SOURCE_FILE ("gtl_instructions.galgas", 582)), var_callerStack_15094, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 581)) ;
+          }
+          callExtensionMethod_execute ((const cPtr_gtlTemplate *) var_result_14756.ptr (), var_newContext_13973, var_localVars_14230, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 585)) ;
+          {
+          ioArgument_lib.insulate (HERE) ;
+          cPtr_library * ptr_15183 = (cPtr_library *) ioArgument_lib.ptr () ;
+          callExtensionSetter_leaveProfileFrame ((cPtr_library *) ptr_15183, var_callerStack_15094, var_timer_14964, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 586)) ;
+          }
+        }
+      }
+      if (kBoolFalse == test_4) {
+        callExtensionMethod_execute ((const cPtr_gtlTemplate *) var_result_14756.ptr (), var_newContext_13973, var_localVars_14230, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 588)) ;
+      }
     }
   }
   if (kBoolFalse == test_3) {
-    enumGalgasBool test_4 = kBoolTrue ;
-    if (kBoolTrue == test_4) {
-      test_4 = object->mProperty_ifExists.boolEnum () ;
-      if (kBoolTrue == test_4) {
-        GALGAS_gtlData var_localMap_14898 = callExtensionGetter_overrideMap ((const cPtr_gtlData *) ioArgument_vars.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 515)) ;
-        extensionMethod_execute (object->mProperty_instructionsIfNotFound, ioArgument_context, var_localMap_14898, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 516)) ;
-        ioArgument_vars = callExtensionGetter_overriddenMap ((const cPtr_gtlData *) var_localMap_14898.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 517)) ;
+    enumGalgasBool test_5 = kBoolTrue ;
+    if (kBoolTrue == test_5) {
+      test_5 = object->mProperty_ifExists.boolEnum () ;
+      if (kBoolTrue == test_5) {
+        GALGAS_gtlData var_localMap_14898 = callExtensionGetter_overrideMap ((const cPtr_gtlData *) ioArgument_vars.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 592)) ;
+        extensionMethod_execute (object->mProperty_instructionsIfNotFound, ioArgument_context, var_localMap_14898, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 593)) ;
+        ioArgument_vars = callExtensionGetter_overriddenMap ((const cPtr_gtlData *) var_localMap_14898.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 594)) ;
       }
     }
   }
   {
-  ioArgument_context.setter_setDebuggerContext (var_newContext_13973.getter_debuggerContext (SOURCE_FILE ("gtl_instructions.galgas", 521)) COMMA_SOURCE_FILE ("gtl_instructions.galgas", 521)) ;
+  ioArgument_context.setter_setDebuggerContext (var_newContext_13973.getter_debuggerContext (SOURCE_FILE ("gtl_instructions.galgas", 598)) COMMA_SOURCE_FILE ("gtl_instructions.galgas", 598)) ;
   }
 }
 
@@ -5462,36 +5548,8 @@ static void extensionMethod_gtlGetColumnInstruction_execute (const cPtr_gtlInstr
                                                              COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlGetColumnInstruction * object = (const cPtr_gtlGetColumnInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlGetColumnInstruction) ;
-  GALGAS_string var_value_15665 = GALGAS_string::makeEmptyString () ;
-  GALGAS_bool var_searchEndOfLine_15694 = GALGAS_bool (true) ;
-  GALGAS_uint var_index_15715 = ioArgument_outputString.getter_length (SOURCE_FILE ("gtl_instructions.galgas", 540)) ;
-  if (ioArgument_outputString.getter_length (SOURCE_FILE ("gtl_instructions.galgas", 541)).isValid ()) {
-    uint32_t variant_15746 = ioArgument_outputString.getter_length (SOURCE_FILE ("gtl_instructions.galgas", 541)).uintValue () ;
-    bool loop_15746 = true ;
-    while (loop_15746) {
-      loop_15746 = GALGAS_bool (kIsStrictSup, var_index_15715.objectCompare (GALGAS_uint ((uint32_t) 0U))).operator_and (var_searchEndOfLine_15694 COMMA_SOURCE_FILE ("gtl_instructions.galgas", 541)).isValid () ;
-      if (loop_15746) {
-        loop_15746 = GALGAS_bool (kIsStrictSup, var_index_15715.objectCompare (GALGAS_uint ((uint32_t) 0U))).operator_and (var_searchEndOfLine_15694 COMMA_SOURCE_FILE ("gtl_instructions.galgas", 541)).boolValue () ;
-      }
-      if (loop_15746 && (0 == variant_15746)) {
-        loop_15746 = false ;
-        inCompiler->loopRunTimeVariantError (SOURCE_FILE ("gtl_instructions.galgas", 541)) ;
-      }
-      if (loop_15746) {
-        variant_15746 -- ;
-        var_searchEndOfLine_15694 = GALGAS_bool (kIsNotEqual, ioArgument_outputString.getter_characterAtIndex (var_index_15715.substract_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 542)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 542)).objectCompare (GALGAS_char (TO_UNICODE (10)))) ;
-        var_index_15715.decrement_operation (inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 543)) ;
-        enumGalgasBool test_0 = kBoolTrue ;
-        if (kBoolTrue == test_0) {
-          test_0 = var_searchEndOfLine_15694.boolEnum () ;
-          if (kBoolTrue == test_0) {
-            var_value_15665.plusAssign_operation(GALGAS_string (" "), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 545)) ;
-          }
-        }
-      }
-    }
-  }
-  extensionMethod_set (object->mProperty_destVariable, ioArgument_context, ioArgument_vars, ioArgument_lib, GALGAS_gtlString::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 552)), var_value_15665  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 552)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 548)) ;
+  GALGAS_string var_value_15741 = GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (32)), ioArgument_outputString.getter_currentColumn (SOURCE_FILE ("gtl_instructions.galgas", 618))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 616)) ;
+  extensionMethod_set (object->mProperty_destVariable, ioArgument_context, ioArgument_vars, ioArgument_lib, GALGAS_gtlString::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 624)), var_value_15741  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 624)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 620)) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -5520,13 +5578,13 @@ static void extensionMethod_gtlIfStatementInstruction_execute (const cPtr_gtlIns
                                                                COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlIfStatementInstruction * object = (const cPtr_gtlIfStatementInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlIfStatementInstruction) ;
-  GALGAS_gtlData var_localMap_16676 = callExtensionGetter_overrideMap ((const cPtr_gtlData *) ioArgument_vars.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 576)) ;
+  GALGAS_gtlData var_localMap_16676 = callExtensionGetter_overrideMap ((const cPtr_gtlData *) ioArgument_vars.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 648)) ;
   GALGAS_bool var_noConditionMatching_16728 = GALGAS_bool (true) ;
   cEnumerator_gtlThenElsifStatementList enumerator_16761 (object->mProperty_thenElsifList, kENUMERATION_UP) ;
   bool bool_0 = var_noConditionMatching_16728.isValidAndTrue () ;
   if (enumerator_16761.hasCurrentObject () && bool_0) {
     while (enumerator_16761.hasCurrentObject () && bool_0) {
-      GALGAS_gtlData var_dataCondition_16817 = callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_16761.current_condition (HERE).ptr (), ioArgument_context, var_localMap_16676, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 580)) ;
+      GALGAS_gtlData var_dataCondition_16817 = callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_16761.current_condition (HERE).ptr (), ioArgument_context, var_localMap_16676, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 652)) ;
       enumGalgasBool test_1 = kBoolTrue ;
       if (kBoolTrue == test_1) {
         test_1 = GALGAS_bool (var_dataCondition_16817.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlBool).boolEnum () ;
@@ -5536,15 +5594,15 @@ static void extensionMethod_gtlIfStatementInstruction_execute (const cPtr_gtlIns
             if (NULL != dynamic_cast <const cPtr_gtlBool *> (var_dataCondition_16817.ptr ())) {
               temp_2 = (cPtr_gtlBool *) var_dataCondition_16817.ptr () ;
             }else{
-              inCompiler->castError ("gtlBool", var_dataCondition_16817.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 582)) ;
+              inCompiler->castError ("gtlBool", var_dataCondition_16817.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 654)) ;
             }
           }
-          GALGAS_bool var_boolCondition_16927 = temp_2.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 582)) ;
+          GALGAS_bool var_boolCondition_16927 = temp_2.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 654)) ;
           enumGalgasBool test_3 = kBoolTrue ;
           if (kBoolTrue == test_3) {
             test_3 = var_boolCondition_16927.boolEnum () ;
             if (kBoolTrue == test_3) {
-              extensionMethod_execute (enumerator_16761.current_instructionList (HERE), ioArgument_context, var_localMap_16676, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 584)) ;
+              extensionMethod_execute (enumerator_16761.current_instructionList (HERE), ioArgument_context, var_localMap_16676, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 656)) ;
               var_noConditionMatching_16728 = GALGAS_bool (false) ;
             }
           }
@@ -5552,7 +5610,7 @@ static void extensionMethod_gtlIfStatementInstruction_execute (const cPtr_gtlIns
       }
       if (kBoolFalse == test_1) {
         TC_Array <C_FixItDescription> fixItArray4 ;
-        inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlData *) var_dataCondition_16817.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 588)), GALGAS_string ("bool expected"), fixItArray4  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 588)) ;
+        inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlData *) var_dataCondition_16817.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 660)), GALGAS_string ("bool expected"), fixItArray4  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 660)) ;
       }
       enumerator_16761.gotoNextObject () ;
       if (enumerator_16761.hasCurrentObject ()) {
@@ -5564,10 +5622,10 @@ static void extensionMethod_gtlIfStatementInstruction_execute (const cPtr_gtlIns
   if (kBoolTrue == test_5) {
     test_5 = var_noConditionMatching_16728.boolEnum () ;
     if (kBoolTrue == test_5) {
-      extensionMethod_execute (object->mProperty_elseList, ioArgument_context, var_localMap_16676, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 592)) ;
+      extensionMethod_execute (object->mProperty_elseList, ioArgument_context, var_localMap_16676, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 664)) ;
     }
   }
-  ioArgument_vars = callExtensionGetter_overriddenMap ((const cPtr_gtlData *) var_localMap_16676.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 595)) ;
+  ioArgument_vars = callExtensionGetter_overriddenMap ((const cPtr_gtlData *) var_localMap_16676.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 667)) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -5596,27 +5654,27 @@ static void extensionMethod_gtlForeachStatementInstruction_execute (const cPtr_g
                                                                     COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlForeachStatementInstruction * object = (const cPtr_gtlForeachStatementInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlForeachStatementInstruction) ;
-  GALGAS_gtlData var_localMap_20501 = callExtensionGetter_overrideMap ((const cPtr_gtlData *) ioArgument_vars.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 706)) ;
-  GALGAS_gtlData var_iterableData_20546 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_iterable.ptr (), ioArgument_context, var_localMap_20501, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 707)) ;
+  GALGAS_gtlData var_localMap_20501 = callExtensionGetter_overrideMap ((const cPtr_gtlData *) ioArgument_vars.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 778)) ;
+  GALGAS_gtlData var_iterableData_20546 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_iterable.ptr (), ioArgument_context, var_localMap_20501, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 779)) ;
   if (var_iterableData_20546.isValid ()) {
     if (var_iterableData_20546.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlMap) {
       GALGAS_gtlMap cast_20639_iterableMap ((cPtr_gtlMap *) var_iterableData_20546.ptr ()) ;
       const GALGAS_gtlForeachStatementInstruction temp_0 = object ;
-      callExtensionMethod_iterateOnMap ((const cPtr_gtlForeachStatementInstruction *) temp_0.ptr (), ioArgument_context, var_localMap_20501, ioArgument_lib, ioArgument_outputString, cast_20639_iterableMap, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 710)) ;
+      callExtensionMethod_iterateOnMap ((const cPtr_gtlForeachStatementInstruction *) temp_0.ptr (), ioArgument_context, var_localMap_20501, ioArgument_lib, ioArgument_outputString, cast_20639_iterableMap, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 782)) ;
     }else if (var_iterableData_20546.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlList) {
       GALGAS_gtlList cast_20751_iterableList ((cPtr_gtlList *) var_iterableData_20546.ptr ()) ;
       const GALGAS_gtlForeachStatementInstruction temp_1 = object ;
-      callExtensionMethod_iterateOnList ((const cPtr_gtlForeachStatementInstruction *) temp_1.ptr (), ioArgument_context, var_localMap_20501, ioArgument_lib, ioArgument_outputString, cast_20751_iterableList, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 712)) ;
+      callExtensionMethod_iterateOnList ((const cPtr_gtlForeachStatementInstruction *) temp_1.ptr (), ioArgument_context, var_localMap_20501, ioArgument_lib, ioArgument_outputString, cast_20751_iterableList, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 784)) ;
     }else if (var_iterableData_20546.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlSet) {
       GALGAS_gtlSet cast_20864_iterableSet ((cPtr_gtlSet *) var_iterableData_20546.ptr ()) ;
       const GALGAS_gtlForeachStatementInstruction temp_2 = object ;
-      callExtensionMethod_iterateOnSet ((const cPtr_gtlForeachStatementInstruction *) temp_2.ptr (), ioArgument_context, var_localMap_20501, ioArgument_lib, ioArgument_outputString, cast_20864_iterableSet, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 714)) ;
+      callExtensionMethod_iterateOnSet ((const cPtr_gtlForeachStatementInstruction *) temp_2.ptr (), ioArgument_context, var_localMap_20501, ioArgument_lib, ioArgument_outputString, cast_20864_iterableSet, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 786)) ;
     }else{
       TC_Array <C_FixItDescription> fixItArray3 ;
-      inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlExpression *) object->mProperty_iterable.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 716)), GALGAS_string ("Map, list or set expected"), fixItArray3  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 716)) ;
+      inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlExpression *) object->mProperty_iterable.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 788)), GALGAS_string ("Map, list or set expected"), fixItArray3  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 788)) ;
     }
   }
-  ioArgument_vars = callExtensionGetter_overriddenMap ((const cPtr_gtlData *) var_localMap_20501.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 718)) ;
+  ioArgument_vars = callExtensionGetter_overriddenMap ((const cPtr_gtlData *) var_localMap_20501.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 790)) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -5645,30 +5703,30 @@ static void extensionMethod_gtlForStatementInstruction_execute (const cPtr_gtlIn
                                                                 COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlForStatementInstruction * object = (const cPtr_gtlForStatementInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlForStatementInstruction) ;
-  GALGAS_lstring var_indexName_21608 = GALGAS_lstring::constructor_new (GALGAS_string ("INDEX"), object->mProperty_where  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 737)) ;
-  GALGAS_gtlData var_localMap_21652 = callExtensionGetter_overrideMap ((const cPtr_gtlData *) ioArgument_vars.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 738)) ;
+  GALGAS_lstring var_indexName_21608 = GALGAS_lstring::constructor_new (GALGAS_string ("INDEX"), object->mProperty_where  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 809)) ;
+  GALGAS_gtlData var_localMap_21652 = callExtensionGetter_overrideMap ((const cPtr_gtlData *) ioArgument_vars.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 810)) ;
   cEnumerator_gtlExpressionList enumerator_21694 (object->mProperty_iterable, kENUMERATION_UP) ;
   GALGAS_uint index_21679 ((uint32_t) 0) ;
   while (enumerator_21694.hasCurrentObject ()) {
-    GALGAS_gtlData var_value_21726 = callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_21694.current_expression (HERE).ptr (), ioArgument_context, var_localMap_21652, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 741)) ;
+    GALGAS_gtlData var_value_21726 = callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_21694.current_expression (HERE).ptr (), ioArgument_context, var_localMap_21652, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 813)) ;
     {
     var_localMap_21652.insulate (HERE) ;
     cPtr_gtlData * ptr_21786 = (cPtr_gtlData *) var_localMap_21652.ptr () ;
-    callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_21786, object->mProperty_identifier, var_value_21726, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 742)) ;
+    callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_21786, object->mProperty_identifier, var_value_21726, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 814)) ;
     }
     {
     var_localMap_21652.insulate (HERE) ;
     cPtr_gtlData * ptr_21837 = (cPtr_gtlData *) var_localMap_21652.ptr () ;
-    callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_21837, var_indexName_21608, GALGAS_gtlInt::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 745)), index_21679.getter_bigint (SOURCE_FILE ("gtl_instructions.galgas", 745))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 745)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 743)) ;
+    callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_21837, var_indexName_21608, GALGAS_gtlInt::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 817)), index_21679.getter_bigint (SOURCE_FILE ("gtl_instructions.galgas", 817))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 817)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 815)) ;
     }
-    extensionMethod_execute (object->mProperty_doList, ioArgument_context, var_localMap_21652, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 747)) ;
+    extensionMethod_execute (object->mProperty_doList, ioArgument_context, var_localMap_21652, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 819)) ;
     if (enumerator_21694.hasNextObject ()) {
-      extensionMethod_execute (object->mProperty_betweenList, ioArgument_context, var_localMap_21652, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 749)) ;
+      extensionMethod_execute (object->mProperty_betweenList, ioArgument_context, var_localMap_21652, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 821)) ;
     }
     enumerator_21694.gotoNextObject () ;
-    index_21679.increment_operation (inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 739)) ;
+    index_21679.increment_operation (inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 811)) ;
   }
-  ioArgument_vars = callExtensionGetter_overriddenMap ((const cPtr_gtlData *) var_localMap_21652.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 751)) ;
+  ioArgument_vars = callExtensionGetter_overriddenMap ((const cPtr_gtlData *) var_localMap_21652.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 823)) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -5697,10 +5755,10 @@ static void extensionMethod_gtlLoopStatementInstruction_execute (const cPtr_gtlI
                                                                  COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlLoopStatementInstruction * object = (const cPtr_gtlLoopStatementInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlLoopStatementInstruction) ;
-  GALGAS_gtlData var_localMap_22822 = callExtensionGetter_overrideMap ((const cPtr_gtlData *) ioArgument_vars.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 775)) ;
-  GALGAS_gtlData var_startData_22864 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_start.ptr (), ioArgument_context, var_localMap_22822, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 776)) ;
-  GALGAS_gtlData var_stopData_22923 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_stop.ptr (), ioArgument_context, var_localMap_22822, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 777)) ;
-  GALGAS_gtlData var_stepData_22983 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_step.ptr (), ioArgument_context, var_localMap_22822, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 778)) ;
+  GALGAS_gtlData var_localMap_22822 = callExtensionGetter_overrideMap ((const cPtr_gtlData *) ioArgument_vars.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 847)) ;
+  GALGAS_gtlData var_startData_22864 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_start.ptr (), ioArgument_context, var_localMap_22822, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 848)) ;
+  GALGAS_gtlData var_stopData_22923 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_stop.ptr (), ioArgument_context, var_localMap_22822, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 849)) ;
+  GALGAS_gtlData var_stepData_22983 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_step.ptr (), ioArgument_context, var_localMap_22822, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 850)) ;
   GALGAS_bigint var_startVal_23042 ;
   GALGAS_bigint var_stopVal_23060 ;
   GALGAS_bigint var_stepVal_23078 ;
@@ -5713,15 +5771,15 @@ static void extensionMethod_gtlLoopStatementInstruction_execute (const cPtr_gtlI
         if (NULL != dynamic_cast <const cPtr_gtlInt *> (var_startData_22864.ptr ())) {
           temp_1 = (cPtr_gtlInt *) var_startData_22864.ptr () ;
         }else{
-          inCompiler->castError ("gtlInt", var_startData_22864.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 783)) ;
+          inCompiler->castError ("gtlInt", var_startData_22864.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 855)) ;
         }
       }
-      var_startVal_23042 = temp_1.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 783)) ;
+      var_startVal_23042 = temp_1.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 855)) ;
     }
   }
   if (kBoolFalse == test_0) {
     TC_Array <C_FixItDescription> fixItArray2 ;
-    inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlExpression *) object->mProperty_start.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 785)), GALGAS_string ("int expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 785)) ;
+    inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlExpression *) object->mProperty_start.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 857)), GALGAS_string ("int expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 857)) ;
     var_startVal_23042.drop () ; // Release error dropped variable
   }
   enumGalgasBool test_3 = kBoolTrue ;
@@ -5733,15 +5791,15 @@ static void extensionMethod_gtlLoopStatementInstruction_execute (const cPtr_gtlI
         if (NULL != dynamic_cast <const cPtr_gtlInt *> (var_stopData_22923.ptr ())) {
           temp_4 = (cPtr_gtlInt *) var_stopData_22923.ptr () ;
         }else{
-          inCompiler->castError ("gtlInt", var_stopData_22923.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 788)) ;
+          inCompiler->castError ("gtlInt", var_stopData_22923.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 860)) ;
         }
       }
-      var_stopVal_23060 = temp_4.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 788)) ;
+      var_stopVal_23060 = temp_4.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 860)) ;
     }
   }
   if (kBoolFalse == test_3) {
     TC_Array <C_FixItDescription> fixItArray5 ;
-    inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlExpression *) object->mProperty_stop.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 790)), GALGAS_string ("int expected"), fixItArray5  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 790)) ;
+    inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlExpression *) object->mProperty_stop.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 862)), GALGAS_string ("int expected"), fixItArray5  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 862)) ;
     var_stopVal_23060.drop () ; // Release error dropped variable
   }
   enumGalgasBool test_6 = kBoolTrue ;
@@ -5753,31 +5811,31 @@ static void extensionMethod_gtlLoopStatementInstruction_execute (const cPtr_gtlI
         if (NULL != dynamic_cast <const cPtr_gtlInt *> (var_stepData_22983.ptr ())) {
           temp_7 = (cPtr_gtlInt *) var_stepData_22983.ptr () ;
         }else{
-          inCompiler->castError ("gtlInt", var_stepData_22983.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 793)) ;
+          inCompiler->castError ("gtlInt", var_stepData_22983.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 865)) ;
         }
       }
-      var_stepVal_23078 = temp_7.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 793)).multiply_operation (object->mProperty_upDown.getter_bigint (SOURCE_FILE ("gtl_instructions.galgas", 793)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 793)) ;
+      var_stepVal_23078 = temp_7.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 865)).multiply_operation (object->mProperty_upDown.getter_bigint (SOURCE_FILE ("gtl_instructions.galgas", 865)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 865)) ;
     }
   }
   if (kBoolFalse == test_6) {
     TC_Array <C_FixItDescription> fixItArray8 ;
-    inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlExpression *) object->mProperty_step.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 795)), GALGAS_string ("int expected"), fixItArray8  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 795)) ;
+    inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlExpression *) object->mProperty_step.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 867)), GALGAS_string ("int expected"), fixItArray8  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 867)) ;
     var_stepVal_23078.drop () ; // Release error dropped variable
   }
-  GALGAS_bigint var_direction_23540 = GALGAS_bigint ("1", inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 797)) ;
+  GALGAS_bigint var_direction_23540 = GALGAS_bigint ("1", inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 869)) ;
   enumGalgasBool test_9 = kBoolTrue ;
   if (kBoolTrue == test_9) {
-    test_9 = GALGAS_bool (kIsStrictInf, var_stepVal_23078.objectCompare (GALGAS_bigint ("0", inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 798)))).boolEnum () ;
+    test_9 = GALGAS_bool (kIsStrictInf, var_stepVal_23078.objectCompare (GALGAS_bigint ("0", inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 870)))).boolEnum () ;
     if (kBoolTrue == test_9) {
-      var_direction_23540 = GALGAS_bigint ("-1", inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 798)) ;
+      var_direction_23540 = GALGAS_bigint ("-1", inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 870)) ;
     }
   }
   enumGalgasBool test_10 = kBoolTrue ;
   if (kBoolTrue == test_10) {
-    test_10 = GALGAS_bool (kIsSupOrEqual, var_stopVal_23060.substract_operation (var_startVal_23042, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 799)).multiply_operation (var_direction_23540, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 799)).objectCompare (GALGAS_bigint ("0", inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 799)))).boolEnum () ;
+    test_10 = GALGAS_bool (kIsSupOrEqual, var_stopVal_23060.substract_operation (var_startVal_23042, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 871)).multiply_operation (var_direction_23540, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 871)).objectCompare (GALGAS_bigint ("0", inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 871)))).boolEnum () ;
     if (kBoolTrue == test_10) {
-      extensionMethod_execute (object->mProperty_beforeList, ioArgument_context, var_localMap_22822, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 800)) ;
-      GALGAS_uint var_count_23724 = var_stopVal_23060.substract_operation (var_startVal_23042, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 801)).multiply_operation (var_direction_23540, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 801)).add_operation (GALGAS_sint_36__34_ ((int64_t) 1LL).getter_bigint (SOURCE_FILE ("gtl_instructions.galgas", 801)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 801)).getter_uint (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 801)) ;
+      extensionMethod_execute (object->mProperty_beforeList, ioArgument_context, var_localMap_22822, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 872)) ;
+      GALGAS_uint var_count_23724 = var_stopVal_23060.substract_operation (var_startVal_23042, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 873)).multiply_operation (var_direction_23540, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 873)).add_operation (GALGAS_sint_36__34_ ((int64_t) 1LL).getter_bigint (SOURCE_FILE ("gtl_instructions.galgas", 873)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 873)).getter_uint (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 873)) ;
       if (var_count_23724.isValid ()) {
         uint32_t variant_23781 = var_count_23724.uintValue () ;
         bool loop_23781 = true ;
@@ -5785,28 +5843,28 @@ static void extensionMethod_gtlLoopStatementInstruction_execute (const cPtr_gtlI
             {
             var_localMap_22822.insulate (HERE) ;
             cPtr_gtlData * ptr_23807 = (cPtr_gtlData *) var_localMap_22822.ptr () ;
-            callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_23807, object->mProperty_identifier, GALGAS_gtlInt::constructor_new (object->mProperty_identifier.getter_location (SOURCE_FILE ("gtl_instructions.galgas", 805)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 805)), var_startVal_23042  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 805)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 803)) ;
+            callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_23807, object->mProperty_identifier, GALGAS_gtlInt::constructor_new (object->mProperty_identifier.getter_location (SOURCE_FILE ("gtl_instructions.galgas", 877)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 877)), var_startVal_23042  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 877)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 875)) ;
             }
-            extensionMethod_execute (object->mProperty_doList, ioArgument_context, var_localMap_22822, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 807)) ;
-            var_startVal_23042 = var_startVal_23042.add_operation (var_stepVal_23078, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 808)) ;
-          loop_23781 = GALGAS_bool (kIsSupOrEqual, var_stopVal_23060.substract_operation (var_startVal_23042, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 809)).multiply_operation (var_direction_23540, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 809)).objectCompare (GALGAS_bigint ("0", inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 809)))).isValid () ;
+            extensionMethod_execute (object->mProperty_doList, ioArgument_context, var_localMap_22822, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 879)) ;
+            var_startVal_23042 = var_startVal_23042.add_operation (var_stepVal_23078, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 880)) ;
+          loop_23781 = GALGAS_bool (kIsSupOrEqual, var_stopVal_23060.substract_operation (var_startVal_23042, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 881)).multiply_operation (var_direction_23540, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 881)).objectCompare (GALGAS_bigint ("0", inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 881)))).isValid () ;
           if (loop_23781) {
-            loop_23781 = GALGAS_bool (kIsSupOrEqual, var_stopVal_23060.substract_operation (var_startVal_23042, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 809)).multiply_operation (var_direction_23540, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 809)).objectCompare (GALGAS_bigint ("0", inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 809)))).boolValue () ;
+            loop_23781 = GALGAS_bool (kIsSupOrEqual, var_stopVal_23060.substract_operation (var_startVal_23042, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 881)).multiply_operation (var_direction_23540, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 881)).objectCompare (GALGAS_bigint ("0", inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 881)))).boolValue () ;
           }
           if (loop_23781 && (0 == variant_23781)) {
             loop_23781 = false ;
-            inCompiler->loopRunTimeVariantError (SOURCE_FILE ("gtl_instructions.galgas", 802)) ;
+            inCompiler->loopRunTimeVariantError (SOURCE_FILE ("gtl_instructions.galgas", 874)) ;
           }
           if (loop_23781) {
             variant_23781 -- ;
-            extensionMethod_execute (object->mProperty_betweenList, ioArgument_context, var_localMap_22822, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 810)) ;
+            extensionMethod_execute (object->mProperty_betweenList, ioArgument_context, var_localMap_22822, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 882)) ;
           }
         }
       }
-      extensionMethod_execute (object->mProperty_afterList, ioArgument_context, var_localMap_22822, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 812)) ;
+      extensionMethod_execute (object->mProperty_afterList, ioArgument_context, var_localMap_22822, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 884)) ;
     }
   }
-  ioArgument_vars = callExtensionGetter_overriddenMap ((const cPtr_gtlData *) var_localMap_22822.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 814)) ;
+  ioArgument_vars = callExtensionGetter_overriddenMap ((const cPtr_gtlData *) var_localMap_22822.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 886)) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -5835,9 +5893,9 @@ static void extensionMethod_gtlRepeatStatementInstruction_execute (const cPtr_gt
                                                                    COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlRepeatStatementInstruction * object = (const cPtr_gtlRepeatStatementInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlRepeatStatementInstruction) ;
-  GALGAS_gtlData var_localMap_24820 = callExtensionGetter_overrideMap ((const cPtr_gtlData *) ioArgument_vars.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 833)) ;
+  GALGAS_gtlData var_localMap_24820 = callExtensionGetter_overrideMap ((const cPtr_gtlData *) ioArgument_vars.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 905)) ;
   GALGAS_bool var_boolCondition_24863 = GALGAS_bool (false) ;
-  GALGAS_gtlData var_limitData_24892 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_limit.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 835)) ;
+  GALGAS_gtlData var_limitData_24892 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_limit.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 907)) ;
   GALGAS_uint var_limitVal_24944 ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
@@ -5848,41 +5906,41 @@ static void extensionMethod_gtlRepeatStatementInstruction_execute (const cPtr_gt
         if (NULL != dynamic_cast <const cPtr_gtlInt *> (var_limitData_24892.ptr ())) {
           temp_1 = (cPtr_gtlInt *) var_limitData_24892.ptr () ;
         }else{
-          inCompiler->castError ("gtlInt", var_limitData_24892.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 839)) ;
+          inCompiler->castError ("gtlInt", var_limitData_24892.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 911)) ;
         }
       }
-      var_limitVal_24944 = temp_1.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 839)).getter_uint (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 839)) ;
+      var_limitVal_24944 = temp_1.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 911)).getter_uint (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 911)) ;
     }
   }
   if (kBoolFalse == test_0) {
     TC_Array <C_FixItDescription> fixItArray2 ;
-    inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlExpression *) object->mProperty_limit.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 841)), GALGAS_string ("int exprected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 841)) ;
+    inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlExpression *) object->mProperty_limit.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 913)), GALGAS_string ("int exprected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 913)) ;
     var_limitVal_24944.drop () ; // Release error dropped variable
   }
   if (var_limitVal_24944.isValid ()) {
     uint32_t variant_25100 = var_limitVal_24944.uintValue () ;
     bool loop_25100 = true ;
     while (loop_25100) {
-        extensionMethod_execute (object->mProperty_continueList, ioArgument_context, var_localMap_24820, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 845)) ;
-        GALGAS_gtlData var_conditionData_25207 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_condition.ptr (), ioArgument_context, var_localMap_24820, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 846)) ;
+        extensionMethod_execute (object->mProperty_continueList, ioArgument_context, var_localMap_24820, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 917)) ;
+        GALGAS_gtlData var_conditionData_25207 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_condition.ptr (), ioArgument_context, var_localMap_24820, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 918)) ;
         enumGalgasBool test_3 = kBoolTrue ;
         if (kBoolTrue == test_3) {
-          test_3 = GALGAS_bool (kIsEqual, var_conditionData_25207.getter_dynamicType (SOURCE_FILE ("gtl_instructions.galgas", 847)).objectCompare (GALGAS_type (& kTypeDescriptor_GALGAS_gtlBool))).boolEnum () ;
+          test_3 = GALGAS_bool (kIsEqual, var_conditionData_25207.getter_dynamicType (SOURCE_FILE ("gtl_instructions.galgas", 919)).objectCompare (GALGAS_type (& kTypeDescriptor_GALGAS_gtlBool))).boolEnum () ;
           if (kBoolTrue == test_3) {
             GALGAS_gtlBool temp_4 ;
             if (var_conditionData_25207.isValid ()) {
               if (NULL != dynamic_cast <const cPtr_gtlBool *> (var_conditionData_25207.ptr ())) {
                 temp_4 = (cPtr_gtlBool *) var_conditionData_25207.ptr () ;
               }else{
-                inCompiler->castError ("gtlBool", var_conditionData_25207.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 848)) ;
+                inCompiler->castError ("gtlBool", var_conditionData_25207.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 920)) ;
               }
             }
-            var_boolCondition_24863 = temp_4.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 848)) ;
+            var_boolCondition_24863 = temp_4.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 920)) ;
           }
         }
         if (kBoolFalse == test_3) {
           TC_Array <C_FixItDescription> fixItArray5 ;
-          inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlData *) var_conditionData_25207.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 850)), GALGAS_string ("bool expected"), fixItArray5  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 850)) ;
+          inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlData *) var_conditionData_25207.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 922)), GALGAS_string ("bool expected"), fixItArray5  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 922)) ;
         }
       loop_25100 = var_boolCondition_24863.isValid () ;
       if (loop_25100) {
@@ -5890,15 +5948,15 @@ static void extensionMethod_gtlRepeatStatementInstruction_execute (const cPtr_gt
       }
       if (loop_25100 && (0 == variant_25100)) {
         loop_25100 = false ;
-        inCompiler->loopRunTimeVariantError (SOURCE_FILE ("gtl_instructions.galgas", 844)) ;
+        inCompiler->loopRunTimeVariantError (SOURCE_FILE ("gtl_instructions.galgas", 916)) ;
       }
       if (loop_25100) {
         variant_25100 -- ;
-        extensionMethod_execute (object->mProperty_doList, ioArgument_context, var_localMap_24820, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 853)) ;
+        extensionMethod_execute (object->mProperty_doList, ioArgument_context, var_localMap_24820, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 925)) ;
       }
     }
   }
-  ioArgument_vars = callExtensionGetter_overriddenMap ((const cPtr_gtlData *) var_localMap_24820.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 855)) ;
+  ioArgument_vars = callExtensionGetter_overriddenMap ((const cPtr_gtlData *) var_localMap_24820.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 927)) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -5936,31 +5994,31 @@ static void extensionMethod_gtlErrorStatementInstruction_execute (const cPtr_gtl
     }
   }
   if (kBoolFalse == test_0) {
-    var_errorLocation_26088 = extensionGetter_get (object->mProperty_identifier, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 877)).getter_where (SOURCE_FILE ("gtl_instructions.galgas", 877)) ;
+    var_errorLocation_26088 = extensionGetter_get (object->mProperty_identifier, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 949)).getter_where (SOURCE_FILE ("gtl_instructions.galgas", 949)) ;
   }
-  GALGAS_gtlData var_errorMessageData_26243 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_errorMessage.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 879)) ;
+  GALGAS_gtlData var_errorMessageData_26243 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_errorMessage.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 951)) ;
   enumGalgasBool test_1 = kBoolTrue ;
   if (kBoolTrue == test_1) {
-    test_1 = GALGAS_bool (kIsEqual, var_errorMessageData_26243.getter_dynamicType (SOURCE_FILE ("gtl_instructions.galgas", 880)).objectCompare (GALGAS_type (& kTypeDescriptor_GALGAS_gtlString))).boolEnum () ;
+    test_1 = GALGAS_bool (kIsEqual, var_errorMessageData_26243.getter_dynamicType (SOURCE_FILE ("gtl_instructions.galgas", 952)).objectCompare (GALGAS_type (& kTypeDescriptor_GALGAS_gtlString))).boolEnum () ;
     if (kBoolTrue == test_1) {
       GALGAS_gtlString temp_2 ;
       if (var_errorMessageData_26243.isValid ()) {
         if (NULL != dynamic_cast <const cPtr_gtlString *> (var_errorMessageData_26243.ptr ())) {
           temp_2 = (cPtr_gtlString *) var_errorMessageData_26243.ptr () ;
         }else{
-          inCompiler->castError ("gtlString", var_errorMessageData_26243.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 881)) ;
+          inCompiler->castError ("gtlString", var_errorMessageData_26243.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 953)) ;
         }
       }
       TC_Array <C_FixItDescription> fixItArray3 ;
-      inCompiler->emitSemanticError (var_errorLocation_26088, temp_2.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 881)), fixItArray3  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 881)) ;
+      inCompiler->emitSemanticError (var_errorLocation_26088, temp_2.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 953)), fixItArray3  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 953)) ;
       {
-      ioArgument_context.setter_setPropagateError (GALGAS_bool (false) COMMA_SOURCE_FILE ("gtl_instructions.galgas", 882)) ;
+      ioArgument_context.setter_setPropagateError (GALGAS_bool (false) COMMA_SOURCE_FILE ("gtl_instructions.galgas", 954)) ;
       }
     }
   }
   if (kBoolFalse == test_1) {
     TC_Array <C_FixItDescription> fixItArray4 ;
-    inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlExpression *) object->mProperty_errorMessage.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 884)), GALGAS_string ("string expected"), fixItArray4  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 884)) ;
+    inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlExpression *) object->mProperty_errorMessage.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 956)), GALGAS_string ("string expected"), fixItArray4  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 956)) ;
   }
 }
 
@@ -5999,28 +6057,28 @@ static void extensionMethod_gtlWarningStatementInstruction_execute (const cPtr_g
     }
   }
   if (kBoolFalse == test_0) {
-    var_warningLocation_27064 = extensionGetter_get (object->mProperty_identifier, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 907)).getter_where (SOURCE_FILE ("gtl_instructions.galgas", 907)) ;
+    var_warningLocation_27064 = extensionGetter_get (object->mProperty_identifier, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 979)).getter_where (SOURCE_FILE ("gtl_instructions.galgas", 979)) ;
   }
-  GALGAS_gtlData var_warningMessageData_27225 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_warningMessage.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 909)) ;
+  GALGAS_gtlData var_warningMessageData_27225 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_warningMessage.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 981)) ;
   enumGalgasBool test_1 = kBoolTrue ;
   if (kBoolTrue == test_1) {
-    test_1 = GALGAS_bool (kIsEqual, var_warningMessageData_27225.getter_dynamicType (SOURCE_FILE ("gtl_instructions.galgas", 910)).objectCompare (GALGAS_type (& kTypeDescriptor_GALGAS_gtlString))).boolEnum () ;
+    test_1 = GALGAS_bool (kIsEqual, var_warningMessageData_27225.getter_dynamicType (SOURCE_FILE ("gtl_instructions.galgas", 982)).objectCompare (GALGAS_type (& kTypeDescriptor_GALGAS_gtlString))).boolEnum () ;
     if (kBoolTrue == test_1) {
       GALGAS_gtlString temp_2 ;
       if (var_warningMessageData_27225.isValid ()) {
         if (NULL != dynamic_cast <const cPtr_gtlString *> (var_warningMessageData_27225.ptr ())) {
           temp_2 = (cPtr_gtlString *) var_warningMessageData_27225.ptr () ;
         }else{
-          inCompiler->castError ("gtlString", var_warningMessageData_27225.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 911)) ;
+          inCompiler->castError ("gtlString", var_warningMessageData_27225.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 983)) ;
         }
       }
       TC_Array <C_FixItDescription> fixItArray3 ;
-      inCompiler->emitSemanticWarning (var_warningLocation_27064, temp_2.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 911)), fixItArray3  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 911)) ;
+      inCompiler->emitSemanticWarning (var_warningLocation_27064, temp_2.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 983)), fixItArray3  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 983)) ;
     }
   }
   if (kBoolFalse == test_1) {
     TC_Array <C_FixItDescription> fixItArray4 ;
-    inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlExpression *) object->mProperty_warningMessage.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 913)), GALGAS_string ("string expected"), fixItArray4  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 913)) ;
+    inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlExpression *) object->mProperty_warningMessage.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 985)), GALGAS_string ("string expected"), fixItArray4  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 985)) ;
   }
 }
 
@@ -6050,13 +6108,13 @@ static void extensionMethod_gtlPrintStatementInstruction_execute (const cPtr_gtl
                                                                   COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlPrintStatementInstruction * object = (const cPtr_gtlPrintStatementInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlPrintStatementInstruction) ;
-  GALGAS_string var_messageToPrintString_27988 = callExtensionGetter_string ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_messageToPrint.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 932)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 932)) ;
-  inCompiler->printMessage (var_messageToPrintString_27988  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 933)) ;
+  GALGAS_string var_messageToPrintString_27988 = callExtensionGetter_string ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_messageToPrint.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1004)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1004)) ;
+  inCompiler->printMessage (var_messageToPrintString_27988  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1005)) ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
     test_0 = object->mProperty_carriageReturn.boolEnum () ;
     if (kBoolTrue == test_0) {
-      inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 934)) ;
+      inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1006)) ;
     }
   }
 }
@@ -6087,8 +6145,8 @@ static void extensionMethod_gtlDisplayStatementInstruction_execute (const cPtr_g
                                                                     COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlDisplayStatementInstruction * object = (const cPtr_gtlDisplayStatementInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlDisplayStatementInstruction) ;
-  GALGAS_gtlData var_variable_28597 = extensionGetter_get (object->mProperty_variablePath, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 950)) ;
-  inCompiler->printMessage (extensionGetter_stringPath (object->mProperty_variablePath, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 951)).add_operation (GALGAS_string (" from "), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 951)).add_operation (object->mProperty_where.getter_locationString (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 952)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 952)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 952)).add_operation (callExtensionGetter_desc ((const cPtr_gtlData *) var_variable_28597.ptr (), GALGAS_uint ((uint32_t) 4U), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 953)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 952))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 951)) ;
+  GALGAS_gtlData var_variable_28597 = extensionGetter_get (object->mProperty_variablePath, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1022)) ;
+  inCompiler->printMessage (extensionGetter_stringPath (object->mProperty_variablePath, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1023)).add_operation (GALGAS_string (" from "), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1023)).add_operation (object->mProperty_where.getter_locationString (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1024)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1024)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1024)).add_operation (callExtensionGetter_desc ((const cPtr_gtlData *) var_variable_28597.ptr (), GALGAS_uint ((uint32_t) 4U), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1025)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1024))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1023)) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -6117,26 +6175,26 @@ static void extensionMethod_gtlAbstractSortInstruction_execute (const cPtr_gtlIn
                                                                 COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlAbstractSortInstruction * object = (const cPtr_gtlAbstractSortInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlAbstractSortInstruction) ;
-  GALGAS_gtlData var_variable_30522 = extensionGetter_get (object->mProperty_variablePath, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1024)) ;
+  GALGAS_gtlData var_variable_30522 = extensionGetter_get (object->mProperty_variablePath, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1096)) ;
   if (var_variable_30522.isValid ()) {
     if (var_variable_30522.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlList) {
       GALGAS_gtlList cast_30611_variableList ((cPtr_gtlList *) var_variable_30522.ptr ()) ;
-      GALGAS_list var_listToSort_30633 = cast_30611_variableList.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 1027)) ;
-      GALGAS_uint var_length_30673 = var_listToSort_30633.getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1028)) ;
+      GALGAS_list var_listToSort_30633 = cast_30611_variableList.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 1099)) ;
+      GALGAS_uint var_length_30673 = var_listToSort_30633.getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1100)) ;
       enumGalgasBool test_0 = kBoolTrue ;
       if (kBoolTrue == test_0) {
         test_0 = GALGAS_bool (kIsStrictSup, var_length_30673.objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
         if (kBoolTrue == test_0) {
           const GALGAS_gtlAbstractSortInstruction temp_1 = object ;
-          callExtensionMethod_sort ((const cPtr_gtlAbstractSortInstruction *) temp_1.ptr (), var_listToSort_30633, GALGAS_uint ((uint32_t) 0U), var_length_30673.substract_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1030)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1030)) ;
+          callExtensionMethod_sort ((const cPtr_gtlAbstractSortInstruction *) temp_1.ptr (), var_listToSort_30633, GALGAS_uint ((uint32_t) 0U), var_length_30673.substract_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1102)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1102)) ;
         }
       }
-      extensionMethod_set (object->mProperty_variablePath, ioArgument_context, ioArgument_vars, ioArgument_lib, GALGAS_gtlList::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1036)), var_listToSort_30633  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1036)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1032)) ;
+      extensionMethod_set (object->mProperty_variablePath, ioArgument_context, ioArgument_vars, ioArgument_lib, GALGAS_gtlList::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1108)), var_listToSort_30633  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1108)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1104)) ;
     }else{
       GALGAS_gtlVarItem var_lastComponent_30958 ;
-      object->mProperty_variablePath.method_last (var_lastComponent_30958, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1039)) ;
+      object->mProperty_variablePath.method_last (var_lastComponent_30958, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1111)) ;
       TC_Array <C_FixItDescription> fixItArray2 ;
-      inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlVarItem *) var_lastComponent_30958.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1040)), GALGAS_string ("list expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1040)) ;
+      inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlVarItem *) var_lastComponent_30958.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1112)), GALGAS_string ("list expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1112)) ;
     }
   }
 }
@@ -6167,7 +6225,7 @@ static GALGAS_sint extensionGetter_gtlSortStatementStructInstruction_compare (co
   const cPtr_gtlSortStatementStructInstruction * object = (const cPtr_gtlSortStatementStructInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlSortStatementStructInstruction) ;
   const GALGAS_gtlSortStatementStructInstruction temp_0 = object ;
-  result_result = callExtensionGetter_compareElements ((const cPtr_gtlSortStatementStructInstruction *) temp_0.ptr (), constinArgument_s_31_, constinArgument_s_32_, object->mProperty_sortingKey, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1054)) ;
+  result_result = callExtensionGetter_compareElements ((const cPtr_gtlSortStatementStructInstruction *) temp_0.ptr (), constinArgument_s_31_, constinArgument_s_32_, object->mProperty_sortingKey, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1126)) ;
 //---
   return result_result ;
 }
@@ -6200,17 +6258,17 @@ static GALGAS_sint extensionGetter_gtlSortStatementInstruction_compare (const cP
   macroValidSharedObject (object, cPtr_gtlSortStatementInstruction) ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = callExtensionGetter_bool ((const cPtr_gtlData *) callExtensionGetter_ltOp ((const cPtr_gtlData *) constinArgument_s_31_.ptr (), constinArgument_s_32_, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1101)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1108)).boolEnum () ;
+    test_0 = callExtensionGetter_bool ((const cPtr_gtlData *) callExtensionGetter_ltOp ((const cPtr_gtlData *) constinArgument_s_31_.ptr (), constinArgument_s_32_, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1173)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1180)).boolEnum () ;
     if (kBoolTrue == test_0) {
-      result_result = GALGAS_sint ((int32_t) 1L).operator_unary_minus (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1102)).multiply_operation (object->mProperty_order.getter_sint (SOURCE_FILE ("gtl_instructions.galgas", 1102)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1102)) ;
+      result_result = GALGAS_sint ((int32_t) 1L).operator_unary_minus (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1174)).multiply_operation (object->mProperty_order.getter_sint (SOURCE_FILE ("gtl_instructions.galgas", 1174)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1174)) ;
     }
   }
   if (kBoolFalse == test_0) {
     enumGalgasBool test_1 = kBoolTrue ;
     if (kBoolTrue == test_1) {
-      test_1 = callExtensionGetter_bool ((const cPtr_gtlData *) callExtensionGetter_gtOp ((const cPtr_gtlData *) constinArgument_s_31_.ptr (), constinArgument_s_32_, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1104)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1107)).boolEnum () ;
+      test_1 = callExtensionGetter_bool ((const cPtr_gtlData *) callExtensionGetter_gtOp ((const cPtr_gtlData *) constinArgument_s_31_.ptr (), constinArgument_s_32_, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1176)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1179)).boolEnum () ;
       if (kBoolTrue == test_1) {
-        result_result = GALGAS_sint ((int32_t) 1L).multiply_operation (object->mProperty_order.getter_sint (SOURCE_FILE ("gtl_instructions.galgas", 1105)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1105)) ;
+        result_result = GALGAS_sint ((int32_t) 1L).multiply_operation (object->mProperty_order.getter_sint (SOURCE_FILE ("gtl_instructions.galgas", 1177)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1177)) ;
       }
     }
     if (kBoolFalse == test_1) {
@@ -6248,7 +6306,7 @@ static void extensionMethod_gtlTabStatementInstruction_execute (const cPtr_gtlIn
                                                                 COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlTabStatementInstruction * object = (const cPtr_gtlTabStatementInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlTabStatementInstruction) ;
-  GALGAS_gtlData var_tabValueData_33232 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_tabValue.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1125)) ;
+  GALGAS_gtlData var_tabValueData_33232 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_tabValue.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1197)) ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
     test_0 = GALGAS_bool (var_tabValueData_33232.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlInt).boolEnum () ;
@@ -6258,21 +6316,21 @@ static void extensionMethod_gtlTabStatementInstruction_execute (const cPtr_gtlIn
         if (NULL != dynamic_cast <const cPtr_gtlInt *> (var_tabValueData_33232.ptr ())) {
           temp_1 = (cPtr_gtlInt *) var_tabValueData_33232.ptr () ;
         }else{
-          inCompiler->castError ("gtlInt", var_tabValueData_33232.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1127)) ;
+          inCompiler->castError ("gtlInt", var_tabValueData_33232.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1199)) ;
         }
       }
       GALGAS_gtlInt var_tabValueInt_33331 = temp_1 ;
-      GALGAS_uint var_currentColumn_33381 = ioArgument_outputString.getter_currentColumn (SOURCE_FILE ("gtl_instructions.galgas", 1128)) ;
+      GALGAS_uint var_currentColumn_33381 = ioArgument_outputString.getter_currentColumn (SOURCE_FILE ("gtl_instructions.galgas", 1200)) ;
       enumGalgasBool test_2 = kBoolTrue ;
       if (kBoolTrue == test_2) {
-        test_2 = GALGAS_bool (kIsSupOrEqual, var_tabValueInt_33331.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 1129)).objectCompare (GALGAS_bigint ("0", inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1129)))).boolEnum () ;
+        test_2 = GALGAS_bool (kIsSupOrEqual, var_tabValueInt_33331.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 1201)).objectCompare (GALGAS_bigint ("0", inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1201)))).boolEnum () ;
         if (kBoolTrue == test_2) {
-          GALGAS_uint var_tabColumn_33473 = var_tabValueInt_33331.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 1130)).getter_uint (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1130)) ;
+          GALGAS_uint var_tabColumn_33473 = var_tabValueInt_33331.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 1202)).getter_uint (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1202)) ;
           enumGalgasBool test_3 = kBoolTrue ;
           if (kBoolTrue == test_3) {
             test_3 = GALGAS_bool (kIsStrictSup, var_tabColumn_33473.objectCompare (var_currentColumn_33381)).boolEnum () ;
             if (kBoolTrue == test_3) {
-              ioArgument_outputString.plusAssign_operation(GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (32)), var_tabColumn_33473.substract_operation (var_currentColumn_33381, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1134)).substract_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1134))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1132)), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1132)) ;
+              ioArgument_outputString.plusAssign_operation(GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (32)), var_tabColumn_33473.substract_operation (var_currentColumn_33381, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1206)).substract_operation (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1206))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1204)), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1204)) ;
             }
           }
         }
@@ -6281,7 +6339,7 @@ static void extensionMethod_gtlTabStatementInstruction_execute (const cPtr_gtlIn
   }
   if (kBoolFalse == test_0) {
     TC_Array <C_FixItDescription> fixItArray4 ;
-    inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlData *) var_tabValueData_33232.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1140)), GALGAS_string ("int expected"), fixItArray4  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1140)) ;
+    inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlData *) var_tabValueData_33232.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1212)), GALGAS_string ("int expected"), fixItArray4  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1212)) ;
   }
 }
 
@@ -6316,12 +6374,12 @@ static void extensionMethod_gtlVariablesInstruction_execute (const cPtr_gtlInstr
     test_0 = object->mProperty_shortDisplay.boolEnum () ;
     if (kBoolTrue == test_0) {
       const GALGAS_gtlVariablesInstruction temp_1 = object ;
-      callExtensionMethod_displayShort ((const cPtr_gtlVariablesInstruction *) temp_1.ptr (), ioArgument_vars, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1198)) ;
+      callExtensionMethod_displayShort ((const cPtr_gtlVariablesInstruction *) temp_1.ptr (), ioArgument_vars, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1270)) ;
     }
   }
   if (kBoolFalse == test_0) {
     const GALGAS_gtlVariablesInstruction temp_2 = object ;
-    callExtensionMethod_displayLong ((const cPtr_gtlVariablesInstruction *) temp_2.ptr (), ioArgument_vars, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1200)) ;
+    callExtensionMethod_displayLong ((const cPtr_gtlVariablesInstruction *) temp_2.ptr (), ioArgument_vars, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1272)) ;
   }
 }
 
@@ -6351,116 +6409,116 @@ static void extensionMethod_gtlLibrariesInstruction_execute (const cPtr_gtlInstr
                                                              COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlLibrariesInstruction * object = (const cPtr_gtlLibrariesInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlLibrariesInstruction) ;
-  GALGAS_string var_delimitor_35855 = GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (61)), GALGAS_uint ((uint32_t) 79U)  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1215)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1215)) ;
-  GALGAS_string var_varDelim_35933 = GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (45)), GALGAS_uint ((uint32_t) 79U)  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1216)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1216)) ;
-  GALGAS_string var_separator_36013 = GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (61)), GALGAS_uint ((uint32_t) 17U)  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1217)) ;
-  inCompiler->printMessage (var_separator_36013.add_operation (GALGAS_string (" Libraries "), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1218)).add_operation (var_separator_36013, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1218)).add_operation (GALGAS_string ("= Displayed from "), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1219)).add_operation (var_separator_36013, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1219)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1220))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1218)) ;
-  inCompiler->printMessage (object->mProperty_where.getter_locationString (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1221)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1221))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1221)) ;
-  inCompiler->printMessage (var_delimitor_35855  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1222)) ;
-  inCompiler->printMessage (GALGAS_string (" Functions \n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1223)) ;
-  inCompiler->printMessage (var_varDelim_35933  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1224)) ;
+  GALGAS_string var_delimitor_35855 = GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (61)), GALGAS_uint ((uint32_t) 79U)  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1287)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1287)) ;
+  GALGAS_string var_varDelim_35933 = GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (45)), GALGAS_uint ((uint32_t) 79U)  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1288)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1288)) ;
+  GALGAS_string var_separator_36013 = GALGAS_string::constructor_stringWithSequenceOfCharacters (GALGAS_char (TO_UNICODE (61)), GALGAS_uint ((uint32_t) 17U)  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1289)) ;
+  inCompiler->printMessage (var_separator_36013.add_operation (GALGAS_string (" Libraries "), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1290)).add_operation (var_separator_36013, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1290)).add_operation (GALGAS_string ("= Displayed from "), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1291)).add_operation (var_separator_36013, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1291)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1292))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1290)) ;
+  inCompiler->printMessage (object->mProperty_where.getter_locationString (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1293)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1293))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1293)) ;
+  inCompiler->printMessage (var_delimitor_35855  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1294)) ;
+  inCompiler->printMessage (GALGAS_string (" Functions \n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1295)) ;
+  inCompiler->printMessage (var_varDelim_35933  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1296)) ;
   GALGAS_uint var_lineSize_36292 = GALGAS_uint ((uint32_t) 0U) ;
-  cEnumerator_gtlFuncMap enumerator_36328 (ioArgument_lib.getter_funcMap (SOURCE_FILE ("gtl_instructions.galgas", 1226)), kENUMERATION_UP) ;
+  cEnumerator_gtlFuncMap enumerator_36328 (ioArgument_lib.getter_funcMap (SOURCE_FILE ("gtl_instructions.galgas", 1298)), kENUMERATION_UP) ;
   const bool bool_0 = true ;
   if (enumerator_36328.hasCurrentObject () && bool_0) {
     while (enumerator_36328.hasCurrentObject () && bool_0) {
       enumGalgasBool test_1 = kBoolTrue ;
       if (kBoolTrue == test_1) {
-        test_1 = GALGAS_bool (kIsStrictSup, var_lineSize_36292.add_operation (enumerator_36328.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1227)).getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1227)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1227)).objectCompare (GALGAS_uint ((uint32_t) 75U))).boolEnum () ;
+        test_1 = GALGAS_bool (kIsStrictSup, var_lineSize_36292.add_operation (enumerator_36328.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1299)).getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1299)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1299)).objectCompare (GALGAS_uint ((uint32_t) 75U))).boolEnum () ;
         if (kBoolTrue == test_1) {
           var_lineSize_36292 = GALGAS_uint ((uint32_t) 0U) ;
-          inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1229)) ;
+          inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1301)) ;
         }
       }
-      inCompiler->printMessage (enumerator_36328.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1231))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1231)) ;
-      var_lineSize_36292.plusAssign_operation(enumerator_36328.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1232)).getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1232)), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1232)) ;
+      inCompiler->printMessage (enumerator_36328.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1303))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1303)) ;
+      var_lineSize_36292.plusAssign_operation(enumerator_36328.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1304)).getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1304)), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1304)) ;
       enumerator_36328.gotoNextObject () ;
       if (enumerator_36328.hasCurrentObject () && bool_0) {
-        inCompiler->printMessage (GALGAS_string (", ")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1234)) ;
-        var_lineSize_36292.plusAssign_operation(GALGAS_uint ((uint32_t) 2U), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1235)) ;
+        inCompiler->printMessage (GALGAS_string (", ")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1306)) ;
+        var_lineSize_36292.plusAssign_operation(GALGAS_uint ((uint32_t) 2U), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1307)) ;
       }
     }
-    inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1237)) ;
+    inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1309)) ;
   }
-  inCompiler->printMessage (var_delimitor_35855  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1239)) ;
-  inCompiler->printMessage (GALGAS_string (" Getters \n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1240)) ;
-  inCompiler->printMessage (var_varDelim_35933  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1241)) ;
+  inCompiler->printMessage (var_delimitor_35855  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1311)) ;
+  inCompiler->printMessage (GALGAS_string (" Getters \n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1312)) ;
+  inCompiler->printMessage (var_varDelim_35933  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1313)) ;
   var_lineSize_36292 = GALGAS_uint ((uint32_t) 0U) ;
-  cEnumerator_gtlGetterMap enumerator_36681 (ioArgument_lib.getter_getterMap (SOURCE_FILE ("gtl_instructions.galgas", 1243)), kENUMERATION_UP) ;
+  cEnumerator_gtlGetterMap enumerator_36681 (ioArgument_lib.getter_getterMap (SOURCE_FILE ("gtl_instructions.galgas", 1315)), kENUMERATION_UP) ;
   const bool bool_2 = true ;
   if (enumerator_36681.hasCurrentObject () && bool_2) {
     while (enumerator_36681.hasCurrentObject () && bool_2) {
       enumGalgasBool test_3 = kBoolTrue ;
       if (kBoolTrue == test_3) {
-        test_3 = GALGAS_bool (kIsStrictSup, var_lineSize_36292.add_operation (enumerator_36681.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1244)).getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1244)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1244)).objectCompare (GALGAS_uint ((uint32_t) 75U))).boolEnum () ;
+        test_3 = GALGAS_bool (kIsStrictSup, var_lineSize_36292.add_operation (enumerator_36681.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1316)).getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1316)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1316)).objectCompare (GALGAS_uint ((uint32_t) 75U))).boolEnum () ;
         if (kBoolTrue == test_3) {
           var_lineSize_36292 = GALGAS_uint ((uint32_t) 0U) ;
-          inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1246)) ;
+          inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1318)) ;
         }
       }
-      inCompiler->printMessage (enumerator_36681.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1248))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1248)) ;
-      var_lineSize_36292.plusAssign_operation(enumerator_36681.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1249)).getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1249)), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1249)) ;
+      inCompiler->printMessage (enumerator_36681.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1320))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1320)) ;
+      var_lineSize_36292.plusAssign_operation(enumerator_36681.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1321)).getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1321)), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1321)) ;
       enumerator_36681.gotoNextObject () ;
       if (enumerator_36681.hasCurrentObject () && bool_2) {
-        inCompiler->printMessage (GALGAS_string (", ")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1251)) ;
-        var_lineSize_36292.plusAssign_operation(GALGAS_uint ((uint32_t) 2U), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1252)) ;
+        inCompiler->printMessage (GALGAS_string (", ")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1323)) ;
+        var_lineSize_36292.plusAssign_operation(GALGAS_uint ((uint32_t) 2U), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1324)) ;
       }
     }
-    inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1254)) ;
+    inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1326)) ;
   }
-  inCompiler->printMessage (var_delimitor_35855  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1256)) ;
-  inCompiler->printMessage (GALGAS_string (" Setters \n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1257)) ;
-  inCompiler->printMessage (var_varDelim_35933  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1258)) ;
+  inCompiler->printMessage (var_delimitor_35855  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1328)) ;
+  inCompiler->printMessage (GALGAS_string (" Setters \n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1329)) ;
+  inCompiler->printMessage (var_varDelim_35933  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1330)) ;
   var_lineSize_36292 = GALGAS_uint ((uint32_t) 0U) ;
-  cEnumerator_gtlSetterMap enumerator_37034 (ioArgument_lib.getter_setterMap (SOURCE_FILE ("gtl_instructions.galgas", 1260)), kENUMERATION_UP) ;
+  cEnumerator_gtlSetterMap enumerator_37034 (ioArgument_lib.getter_setterMap (SOURCE_FILE ("gtl_instructions.galgas", 1332)), kENUMERATION_UP) ;
   const bool bool_4 = true ;
   if (enumerator_37034.hasCurrentObject () && bool_4) {
     while (enumerator_37034.hasCurrentObject () && bool_4) {
       enumGalgasBool test_5 = kBoolTrue ;
       if (kBoolTrue == test_5) {
-        test_5 = GALGAS_bool (kIsStrictSup, var_lineSize_36292.add_operation (enumerator_37034.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1261)).getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1261)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1261)).objectCompare (GALGAS_uint ((uint32_t) 75U))).boolEnum () ;
+        test_5 = GALGAS_bool (kIsStrictSup, var_lineSize_36292.add_operation (enumerator_37034.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1333)).getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1333)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1333)).objectCompare (GALGAS_uint ((uint32_t) 75U))).boolEnum () ;
         if (kBoolTrue == test_5) {
           var_lineSize_36292 = GALGAS_uint ((uint32_t) 0U) ;
-          inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1263)) ;
+          inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1335)) ;
         }
       }
-      inCompiler->printMessage (enumerator_37034.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1265))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1265)) ;
-      var_lineSize_36292.plusAssign_operation(enumerator_37034.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1266)).getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1266)), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1266)) ;
+      inCompiler->printMessage (enumerator_37034.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1337))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1337)) ;
+      var_lineSize_36292.plusAssign_operation(enumerator_37034.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1338)).getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1338)), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1338)) ;
       enumerator_37034.gotoNextObject () ;
       if (enumerator_37034.hasCurrentObject () && bool_4) {
-        inCompiler->printMessage (GALGAS_string (", ")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1268)) ;
-        var_lineSize_36292.plusAssign_operation(GALGAS_uint ((uint32_t) 2U), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1269)) ;
+        inCompiler->printMessage (GALGAS_string (", ")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1340)) ;
+        var_lineSize_36292.plusAssign_operation(GALGAS_uint ((uint32_t) 2U), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1341)) ;
       }
     }
-    inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1271)) ;
+    inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1343)) ;
   }
-  inCompiler->printMessage (var_delimitor_35855  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1273)) ;
-  inCompiler->printMessage (GALGAS_string (" Templates \n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1274)) ;
-  inCompiler->printMessage (var_varDelim_35933  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1275)) ;
+  inCompiler->printMessage (var_delimitor_35855  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1345)) ;
+  inCompiler->printMessage (GALGAS_string (" Templates \n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1346)) ;
+  inCompiler->printMessage (var_varDelim_35933  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1347)) ;
   var_lineSize_36292 = GALGAS_uint ((uint32_t) 0U) ;
-  cEnumerator_gtlTemplateMap enumerator_37391 (ioArgument_lib.getter_templateMap (SOURCE_FILE ("gtl_instructions.galgas", 1277)), kENUMERATION_UP) ;
+  cEnumerator_gtlTemplateMap enumerator_37391 (ioArgument_lib.getter_templateMap (SOURCE_FILE ("gtl_instructions.galgas", 1349)), kENUMERATION_UP) ;
   const bool bool_6 = true ;
   if (enumerator_37391.hasCurrentObject () && bool_6) {
     while (enumerator_37391.hasCurrentObject () && bool_6) {
       enumGalgasBool test_7 = kBoolTrue ;
       if (kBoolTrue == test_7) {
-        test_7 = GALGAS_bool (kIsStrictSup, var_lineSize_36292.add_operation (enumerator_37391.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1278)).getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1278)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1278)).objectCompare (GALGAS_uint ((uint32_t) 75U))).boolEnum () ;
+        test_7 = GALGAS_bool (kIsStrictSup, var_lineSize_36292.add_operation (enumerator_37391.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1350)).getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1350)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1350)).objectCompare (GALGAS_uint ((uint32_t) 75U))).boolEnum () ;
         if (kBoolTrue == test_7) {
           var_lineSize_36292 = GALGAS_uint ((uint32_t) 0U) ;
-          inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1280)) ;
+          inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1352)) ;
         }
       }
-      inCompiler->printMessage (enumerator_37391.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1282))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1282)) ;
-      var_lineSize_36292.plusAssign_operation(enumerator_37391.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1283)).getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1283)), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1283)) ;
+      inCompiler->printMessage (enumerator_37391.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1354))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1354)) ;
+      var_lineSize_36292.plusAssign_operation(enumerator_37391.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 1355)).getter_length (SOURCE_FILE ("gtl_instructions.galgas", 1355)), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1355)) ;
       enumerator_37391.gotoNextObject () ;
       if (enumerator_37391.hasCurrentObject () && bool_6) {
-        inCompiler->printMessage (GALGAS_string (", ")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1285)) ;
-        var_lineSize_36292.plusAssign_operation(GALGAS_uint ((uint32_t) 2U), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1286)) ;
+        inCompiler->printMessage (GALGAS_string (", ")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1357)) ;
+        var_lineSize_36292.plusAssign_operation(GALGAS_uint ((uint32_t) 2U), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1358)) ;
       }
     }
-    inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1288)) ;
+    inCompiler->printMessage (GALGAS_string ("\n")  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1360)) ;
   }
-  inCompiler->printMessage (var_delimitor_35855  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1290)) ;
+  inCompiler->printMessage (var_delimitor_35855  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1362)) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -6489,19 +6547,19 @@ static void extensionMethod_gtlSetterCallInstruction_execute (const cPtr_gtlInst
                                                               COMMA_UNUSED_LOCATION_ARGS) {
   const cPtr_gtlSetterCallInstruction * object = (const cPtr_gtlSetterCallInstruction *) inObject ;
   macroValidSharedObject (object, cPtr_gtlSetterCallInstruction) ;
-  GALGAS_gtlDataList var_dataArguments_38209 = GALGAS_gtlDataList::constructor_emptyList (SOURCE_FILE ("gtl_instructions.galgas", 1308)) ;
+  GALGAS_gtlDataList var_dataArguments_38209 = GALGAS_gtlDataList::constructor_emptyList (SOURCE_FILE ("gtl_instructions.galgas", 1380)) ;
   cEnumerator_gtlExpressionList enumerator_38244 (object->mProperty_arguments, kENUMERATION_UP) ;
   while (enumerator_38244.hasCurrentObject ()) {
-    var_dataArguments_38209.addAssign_operation (callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_38244.current_expression (HERE).ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1310))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1310)) ;
+    var_dataArguments_38209.addAssign_operation (callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_38244.current_expression (HERE).ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1382))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1382)) ;
     enumerator_38244.gotoNextObject () ;
   }
-  GALGAS_gtlData var_targetData_38335 = extensionGetter_get (object->mProperty_target, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1312)) ;
+  GALGAS_gtlData var_targetData_38335 = extensionGetter_get (object->mProperty_target, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1384)) ;
   {
   var_targetData_38335.insulate (HERE) ;
   cPtr_gtlData * ptr_38386 = (cPtr_gtlData *) var_targetData_38335.ptr () ;
-  callExtensionSetter_performSetter ((cPtr_gtlData *) ptr_38386, object->mProperty_setterName, var_dataArguments_38209, ioArgument_context, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1313)) ;
+  callExtensionSetter_performSetter ((cPtr_gtlData *) ptr_38386, object->mProperty_setterName, var_dataArguments_38209, ioArgument_context, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1385)) ;
   }
-  extensionMethod_set (object->mProperty_target, ioArgument_context, ioArgument_vars, ioArgument_lib, var_targetData_38335, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1314)) ;
+  extensionMethod_set (object->mProperty_target, ioArgument_context, ioArgument_vars, ioArgument_lib, var_targetData_38335, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1386)) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -6536,7 +6594,7 @@ static void extensionMethod_gtlInputStatementInstruction_execute (const cPtr_gtl
     {
     ioArgument_context.insulate (HERE) ;
     cPtr_gtlContext * ptr_39022 = (cPtr_gtlContext *) ioArgument_context.ptr () ;
-    callExtensionSetter_popFirstInputArg ((cPtr_gtlContext *) ptr_39022, enumerator_39004.current_name (HERE).getter_location (SOURCE_FILE ("gtl_instructions.galgas", 1331)), var_arg_39059, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1331)) ;
+    callExtensionSetter_popFirstInputArg ((cPtr_gtlContext *) ptr_39022, enumerator_39004.current_name (HERE).getter_location (SOURCE_FILE ("gtl_instructions.galgas", 1403)), var_arg_39059, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1403)) ;
     }
     enumGalgasBool test_0 = kBoolTrue ;
     if (kBoolTrue == test_0) {
@@ -6544,12 +6602,12 @@ static void extensionMethod_gtlInputStatementInstruction_execute (const cPtr_gtl
       if (kBoolTrue == test_0) {
         enumGalgasBool test_1 = kBoolTrue ;
         if (kBoolTrue == test_1) {
-          test_1 = GALGAS_bool (kIsNotEqual, enumerator_39004.current_type (HERE).objectCompare (var_arg_39059.getter_dynamicType (SOURCE_FILE ("gtl_instructions.galgas", 1333)))).boolEnum () ;
+          test_1 = GALGAS_bool (kIsNotEqual, enumerator_39004.current_type (HERE).objectCompare (var_arg_39059.getter_dynamicType (SOURCE_FILE ("gtl_instructions.galgas", 1405)))).boolEnum () ;
           if (kBoolTrue == test_1) {
             TC_Array <C_FixItDescription> fixItArray2 ;
-            inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlData *) var_arg_39059.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1334)), GALGAS_string ("mistyped argument, ").add_operation (extensionGetter_typeName (var_arg_39059.getter_dynamicType (SOURCE_FILE ("gtl_instructions.galgas", 1334)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1334)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1334)).add_operation (GALGAS_string (" provided"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1334)), fixItArray2  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1334)) ;
+            inCompiler->emitSemanticError (callExtensionGetter_location ((const cPtr_gtlData *) var_arg_39059.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1406)), GALGAS_string ("mistyped argument, ").add_operation (extensionGetter_typeName (var_arg_39059.getter_dynamicType (SOURCE_FILE ("gtl_instructions.galgas", 1406)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1406)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1406)).add_operation (GALGAS_string (" provided"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1406)), fixItArray2  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1406)) ;
             TC_Array <C_FixItDescription> fixItArray3 ;
-            inCompiler->emitSemanticError (enumerator_39004.current_name (HERE).getter_location (SOURCE_FILE ("gtl_instructions.galgas", 1335)), extensionGetter_typeName (enumerator_39004.current_type (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1335)).add_operation (GALGAS_string (" expected"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1335)), fixItArray3  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1335)) ;
+            inCompiler->emitSemanticError (enumerator_39004.current_name (HERE).getter_location (SOURCE_FILE ("gtl_instructions.galgas", 1407)), extensionGetter_typeName (enumerator_39004.current_type (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1407)).add_operation (GALGAS_string (" expected"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1407)), fixItArray3  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1407)) ;
           }
         }
       }
@@ -6557,7 +6615,7 @@ static void extensionMethod_gtlInputStatementInstruction_execute (const cPtr_gtl
     {
     ioArgument_vars.insulate (HERE) ;
     cPtr_gtlData * ptr_39286 = (cPtr_gtlData *) ioArgument_vars.ptr () ;
-    callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_39286, enumerator_39004.current_name (HERE), var_arg_39059, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1338)) ;
+    callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_39286, enumerator_39004.current_name (HERE), var_arg_39059, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 1410)) ;
     }
     enumerator_39004.gotoNextObject () ;
   }
@@ -7146,7 +7204,8 @@ C_galgas_function_descriptor functionDescriptor_homeDir ("homeDir",
 GALGAS_string function_currentDateTime (C_Compiler * /* inCompiler */
                                         COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_string result_result ; // Returned variable
-  result_result = GALGAS_string::constructor_stringWithCurrentDateTime (SOURCE_FILE ("gtl_functions.galgas", 166)) ;
+  GALGAS_application::class_method_addOutputVolatileDependency (SOURCE_FILE ("gtl_functions.galgas", 167)) ;
+  result_result = GALGAS_string::constructor_stringWithCurrentDateTime (SOURCE_FILE ("gtl_functions.galgas", 168)) ;
 //---
   return result_result ;
 }
@@ -7186,7 +7245,7 @@ C_galgas_function_descriptor functionDescriptor_currentDateTime ("currentDateTim
 GALGAS_bigint function_max_38_bitsUnsignedInt (C_Compiler * /* inCompiler */
                                                COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_bigint result_result ; // Returned variable
-  result_result = GALGAS_uint ((uint32_t) 255U).getter_bigint (SOURCE_FILE ("gtl_functions.galgas", 174)) ;
+  result_result = GALGAS_uint ((uint32_t) 255U).getter_bigint (SOURCE_FILE ("gtl_functions.galgas", 176)) ;
 //---
   return result_result ;
 }
@@ -7226,7 +7285,7 @@ C_galgas_function_descriptor functionDescriptor_max_38_bitsUnsignedInt ("max8bit
 GALGAS_bigint function_max_38_bitsSignedInt (C_Compiler * /* inCompiler */
                                              COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_bigint result_result ; // Returned variable
-  result_result = GALGAS_uint ((uint32_t) 127U).getter_bigint (SOURCE_FILE ("gtl_functions.galgas", 182)) ;
+  result_result = GALGAS_uint ((uint32_t) 127U).getter_bigint (SOURCE_FILE ("gtl_functions.galgas", 184)) ;
 //---
   return result_result ;
 }
@@ -7266,7 +7325,7 @@ C_galgas_function_descriptor functionDescriptor_max_38_bitsSignedInt ("max8bitsS
 GALGAS_bigint function_min_38_bitsSignedInt (C_Compiler * inCompiler
                                              COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_bigint result_result ; // Returned variable
-  result_result = GALGAS_sint ((int32_t) 128L).operator_unary_minus (inCompiler COMMA_SOURCE_FILE ("gtl_functions.galgas", 190)).getter_bigint (SOURCE_FILE ("gtl_functions.galgas", 190)) ;
+  result_result = GALGAS_sint ((int32_t) 128L).operator_unary_minus (inCompiler COMMA_SOURCE_FILE ("gtl_functions.galgas", 192)).getter_bigint (SOURCE_FILE ("gtl_functions.galgas", 192)) ;
 //---
   return result_result ;
 }
@@ -7306,7 +7365,7 @@ C_galgas_function_descriptor functionDescriptor_min_38_bitsSignedInt ("min8bitsS
 GALGAS_bigint function_max_31__36_bitsUnsignedInt (C_Compiler * /* inCompiler */
                                                    COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_bigint result_result ; // Returned variable
-  result_result = GALGAS_uint ((uint32_t) 65535U).getter_bigint (SOURCE_FILE ("gtl_functions.galgas", 198)) ;
+  result_result = GALGAS_uint ((uint32_t) 65535U).getter_bigint (SOURCE_FILE ("gtl_functions.galgas", 200)) ;
 //---
   return result_result ;
 }
@@ -7346,7 +7405,7 @@ C_galgas_function_descriptor functionDescriptor_max_31__36_bitsUnsignedInt ("max
 GALGAS_bigint function_max_31__36_bitsSignedInt (C_Compiler * /* inCompiler */
                                                  COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_bigint result_result ; // Returned variable
-  result_result = GALGAS_uint ((uint32_t) 32767U).getter_bigint (SOURCE_FILE ("gtl_functions.galgas", 206)) ;
+  result_result = GALGAS_uint ((uint32_t) 32767U).getter_bigint (SOURCE_FILE ("gtl_functions.galgas", 208)) ;
 //---
   return result_result ;
 }
@@ -7386,7 +7445,7 @@ C_galgas_function_descriptor functionDescriptor_max_31__36_bitsSignedInt ("max16
 GALGAS_bigint function_min_31__36_bitsSignedInt (C_Compiler * inCompiler
                                                  COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_bigint result_result ; // Returned variable
-  result_result = GALGAS_sint ((int32_t) 32768L).operator_unary_minus (inCompiler COMMA_SOURCE_FILE ("gtl_functions.galgas", 214)).getter_bigint (SOURCE_FILE ("gtl_functions.galgas", 214)) ;
+  result_result = GALGAS_sint ((int32_t) 32768L).operator_unary_minus (inCompiler COMMA_SOURCE_FILE ("gtl_functions.galgas", 216)).getter_bigint (SOURCE_FILE ("gtl_functions.galgas", 216)) ;
 //---
   return result_result ;
 }
@@ -7426,7 +7485,7 @@ C_galgas_function_descriptor functionDescriptor_min_31__36_bitsSignedInt ("min16
 GALGAS_bigint function_max_33__32_bitsUnsignedInt (C_Compiler * /* inCompiler */
                                                    COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_bigint result_result ; // Returned variable
-  result_result = GALGAS_uint::constructor_max (SOURCE_FILE ("gtl_functions.galgas", 222)).getter_bigint (SOURCE_FILE ("gtl_functions.galgas", 222)) ;
+  result_result = GALGAS_uint::constructor_max (SOURCE_FILE ("gtl_functions.galgas", 224)).getter_bigint (SOURCE_FILE ("gtl_functions.galgas", 224)) ;
 //---
   return result_result ;
 }
@@ -7466,7 +7525,7 @@ C_galgas_function_descriptor functionDescriptor_max_33__32_bitsUnsignedInt ("max
 GALGAS_bigint function_max_33__32_bitsSignedInt (C_Compiler * /* inCompiler */
                                                  COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_bigint result_result ; // Returned variable
-  result_result = GALGAS_sint::constructor_max (SOURCE_FILE ("gtl_functions.galgas", 230)).getter_bigint (SOURCE_FILE ("gtl_functions.galgas", 230)) ;
+  result_result = GALGAS_sint::constructor_max (SOURCE_FILE ("gtl_functions.galgas", 232)).getter_bigint (SOURCE_FILE ("gtl_functions.galgas", 232)) ;
 //---
   return result_result ;
 }
@@ -7506,7 +7565,7 @@ C_galgas_function_descriptor functionDescriptor_max_33__32_bitsSignedInt ("max32
 GALGAS_bigint function_min_33__32_bitsSignedInt (C_Compiler * /* inCompiler */
                                                  COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_bigint result_result ; // Returned variable
-  result_result = GALGAS_sint::constructor_min (SOURCE_FILE ("gtl_functions.galgas", 238)).getter_bigint (SOURCE_FILE ("gtl_functions.galgas", 238)) ;
+  result_result = GALGAS_sint::constructor_min (SOURCE_FILE ("gtl_functions.galgas", 240)).getter_bigint (SOURCE_FILE ("gtl_functions.galgas", 240)) ;
 //---
   return result_result ;
 }
@@ -7546,7 +7605,7 @@ C_galgas_function_descriptor functionDescriptor_min_33__32_bitsSignedInt ("min32
 GALGAS_bigint function_max_36__34_bitsUnsignedInt (C_Compiler * /* inCompiler */
                                                    COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_bigint result_result ; // Returned variable
-  result_result = GALGAS_uint_36__34_::constructor_max (SOURCE_FILE ("gtl_functions.galgas", 246)).getter_bigint (SOURCE_FILE ("gtl_functions.galgas", 246)) ;
+  result_result = GALGAS_uint_36__34_::constructor_max (SOURCE_FILE ("gtl_functions.galgas", 248)).getter_bigint (SOURCE_FILE ("gtl_functions.galgas", 248)) ;
 //---
   return result_result ;
 }
@@ -7586,7 +7645,7 @@ C_galgas_function_descriptor functionDescriptor_max_36__34_bitsUnsignedInt ("max
 GALGAS_bigint function_max_36__34_bitsSignedInt (C_Compiler * /* inCompiler */
                                                  COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_bigint result_result ; // Returned variable
-  result_result = GALGAS_sint_36__34_::constructor_max (SOURCE_FILE ("gtl_functions.galgas", 254)).getter_bigint (SOURCE_FILE ("gtl_functions.galgas", 254)) ;
+  result_result = GALGAS_sint_36__34_::constructor_max (SOURCE_FILE ("gtl_functions.galgas", 256)).getter_bigint (SOURCE_FILE ("gtl_functions.galgas", 256)) ;
 //---
   return result_result ;
 }
@@ -7626,7 +7685,7 @@ C_galgas_function_descriptor functionDescriptor_max_36__34_bitsSignedInt ("max64
 GALGAS_bigint function_min_36__34_bitsSignedInt (C_Compiler * /* inCompiler */
                                                  COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_bigint result_result ; // Returned variable
-  result_result = GALGAS_sint_36__34_::constructor_min (SOURCE_FILE ("gtl_functions.galgas", 262)).getter_bigint (SOURCE_FILE ("gtl_functions.galgas", 262)) ;
+  result_result = GALGAS_sint_36__34_::constructor_min (SOURCE_FILE ("gtl_functions.galgas", 264)).getter_bigint (SOURCE_FILE ("gtl_functions.galgas", 264)) ;
 //---
   return result_result ;
 }
@@ -7666,7 +7725,7 @@ C_galgas_function_descriptor functionDescriptor_min_36__34_bitsSignedInt ("min64
 GALGAS_double function_pi (C_Compiler * /* inCompiler */
                            COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_double result_result ; // Returned variable
-  result_result = GALGAS_double::constructor_pi (SOURCE_FILE ("gtl_functions.galgas", 270)) ;
+  result_result = GALGAS_double::constructor_pi (SOURCE_FILE ("gtl_functions.galgas", 272)) ;
 //---
   return result_result ;
 }
@@ -7709,6 +7768,12 @@ C_BoolCommandLineOption gOption_gtl_5F_options_debug ("gtl_options",
                                          "debug",
                                          "Execute the GTL templates in debug mode") ;
 
+C_BoolCommandLineOption gOption_gtl_5F_options_profile ("gtl_options",
+                                         "profile",
+                                         0,
+                                         "profile",
+                                         "Profile the execution of goil and of the GTL templates") ;
+
 C_BoolCommandLineOption gOption_gtl_5F_options_warnDeprecated ("gtl_options",
                                          "warnDeprecated",
                                          0,
@@ -7721,6 +7786,13 @@ C_BoolCommandLineOption gOption_gtl_5F_options_warnDeprecated ("gtl_options",
 //
 //----------------------------------------------------------------------------------------------------------------------
 
+C_UIntCommandLineOption gOption_gtl_5F_options_jobs ("gtl_options",
+                                         "jobs",
+                                         0,
+                                         "jobs",
+                                         "Execute the write to instructions of the GTL templates in up to jobs processes",
+                                         1) ;
+
 //----------------------------------------------------------------------------------------------------------------------
 //
 //                              String options                                                   
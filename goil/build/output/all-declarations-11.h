@@ -554,6 +554,189 @@ void routine_errorNoFileFound (const class GALGAS_stringlist constinArgument0,
                                class C_Compiler * inCompiler
                                COMMA_LOCATION_ARGS) ;
 
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Function 'inputFiles'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+class GALGAS_stringlist function_inputFiles (const class GALGAS_string & constinArgument0,
+                                             const class GALGAS_string & constinArgument1,
+                                             class C_Compiler * inCompiler
+                                             COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Function 'snapshotFormat'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+class GALGAS_string function_snapshotFormat (class C_Compiler * inCompiler
+                                             COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Function 'snapshotFile'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+class GALGAS_string function_snapshotFile (const class GALGAS_string & constinArgument0,
+                                           class C_Compiler * inCompiler
+                                           COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Function 'snapshotKey'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+class GALGAS_string function_snapshotKey (class C_Compiler * inCompiler
+                                          COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Function 'snapshotString'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+class GALGAS_string function_snapshotString (const class GALGAS_string & constinArgument0,
+                                             class C_Compiler * inCompiler
+                                             COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Function 'stringFromSnapshot'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+class GALGAS_string function_stringFromSnapshot (const class GALGAS_string & constinArgument0,
+                                                 class C_Compiler * inCompiler
+                                                 COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Routine 'appendSnapshotLocation'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+void routine_appendSnapshotLocation (const class GALGAS_location constinArgument0,
+                                     const class GALGAS_stringlist constinArgument1,
+                                     class GALGAS_string & ioArgument2,
+                                     class GALGAS_bool & ioArgument3,
+                                     class C_Compiler * inCompiler
+                                     COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Function 'locationFromSnapshot'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+class GALGAS_location function_locationFromSnapshot (const class GALGAS_string & constinArgument0,
+                                                     const class GALGAS_lstringlist & constinArgument1,
+                                                     class C_Compiler * inCompiler
+                                                     COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Routine 'appendSnapshotRecord'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+void routine_appendSnapshotRecord (const class GALGAS_string constinArgument0,
+                                   const class GALGAS_gtlData constinArgument1,
+                                   const class GALGAS_string constinArgument2,
+                                   const class GALGAS_stringlist constinArgument3,
+                                   class GALGAS_string & ioArgument4,
+                                   class GALGAS_bool & ioArgument5,
+                                   class C_Compiler * inCompiler
+                                   COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Routine 'appendSnapshotMap'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+void routine_appendSnapshotMap (const class GALGAS_gtlVarMap constinArgument0,
+                                const class GALGAS_stringlist constinArgument1,
+                                class GALGAS_string & ioArgument2,
+                                class GALGAS_bool & ioArgument3,
+                                class C_Compiler * inCompiler
+                                COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Routine 'appendSnapshot'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+void routine_appendSnapshot (const class GALGAS_gtlData constinArgument0,
+                             const class GALGAS_stringlist constinArgument1,
+                             class GALGAS_string & ioArgument2,
+                             class GALGAS_bool & ioArgument3,
+                             class C_Compiler * inCompiler
+                             COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Routine 'readSnapshotMap'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+void routine_readSnapshotMap (const class GALGAS_stringlist constinArgument0,
+                              class GALGAS_uint & ioArgument1,
+                              const class GALGAS_lstringlist constinArgument2,
+                              const class GALGAS_uint constinArgument3,
+                              class GALGAS_gtlVarMap & outArgument4,
+                              class C_Compiler * inCompiler
+                              COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Routine 'readSnapshot'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+void routine_readSnapshot (const class GALGAS_stringlist constinArgument0,
+                           class GALGAS_uint & ioArgument1,
+                           const class GALGAS_lstringlist constinArgument2,
+                           class GALGAS_gtlData & outArgument3,
+                           class C_Compiler * inCompiler
+                           COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Routine 'loadSnapshot'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+void routine_loadSnapshot (const class GALGAS_string constinArgument0,
+                           class GALGAS_gtlData & outArgument1,
+                           class GALGAS_bool & outArgument2,
+                           class C_Compiler * inCompiler
+                           COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Routine 'compileOIL'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+void routine_compileOIL (const class GALGAS_lstring constinArgument0,
+                         class C_Compiler * inCompiler
+                         COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Routine 'watchOIL'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+void routine_watchOIL (const class GALGAS_lstring constinArgument0,
+                       class C_Compiler * inCompiler
+                       COMMA_LOCATION_ARGS) ;
+
 //----------------------------------------------------------------------------------------------------------------------
 //
 //Function 'attributeAllowsAuto'
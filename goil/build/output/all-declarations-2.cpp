@@ -8332,65 +8332,146 @@ GALGAS_objectKindMap GALGAS_objectKindMap::extractObject (const GALGAS_object &
 
 //---------------------------------------------------------------------------------------------------------------------*
 
-void cParser_goil_5F_syntax::rule_goil_5F_syntax_start_i0_ (C_Lexique_goil_5F_lexique * inCompiler) {
-  GALGAS_implementation var_imp_955 = GALGAS_implementation::constructor_new (GALGAS_implementationMap::constructor_emptyMap (SOURCE_FILE ("goil_syntax.galgas", 39))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 39)) ;
-  GALGAS_applicationDefinition var_application_1049 = function_emptyApplicationDefinition (inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 40)) ;
-  GALGAS_string var_fileIncludeList_1107 = GALGAS_string::makeEmptyString () ;
-  GALGAS_lstring var_version_1178 ;
-  GALGAS_lstring var_desc_1194 = function_lstringWith (GALGAS_string::makeEmptyString (), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 46)) ;
-  nt_OIL_5F_version_ (var_version_1178, var_desc_1194, inCompiler) ;
+void cParser_goil_5F_syntax::rule_goil_5F_syntax_start_i0_ (GALGAS_string & ioArgument_configKey,
+                                                            GALGAS_implementation & ioArgument_configImp,
+                                                            GALGAS_applicationDefinition & ioArgument_configApplication,
+                                                            GALGAS_string & ioArgument_configIncludeList,
+                                                            GALGAS_library & ioArgument_lib,
+                                                            GALGAS_gtlData & outArgument_templateData,
+                                                            C_Lexique_goil_5F_lexique * inCompiler) {
+  outArgument_templateData.drop () ; // Release 'out' argument
+  GALGAS_gtlProfileMap var_phases_1411 = GALGAS_gtlProfileMap::constructor_emptyMap (SOURCE_FILE ("goil_syntax.galgas", 49)) ;
+  GALGAS_timer var_timer_1439 = GALGAS_timer::constructor_start (SOURCE_FILE ("goil_syntax.galgas", 50)) ;
+  GALGAS_implementation var_imp_1472 = GALGAS_implementation::constructor_new (GALGAS_implementationMap::constructor_emptyMap (SOURCE_FILE ("goil_syntax.galgas", 51))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 51)) ;
+  GALGAS_applicationDefinition var_application_1558 = function_emptyApplicationDefinition (inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 52)) ;
+  outArgument_templateData = GALGAS_gtlUnconstructed::constructor_new (GALGAS_location::constructor_nowhere (SOURCE_FILE ("goil_syntax.galgas", 53)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 53))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 53)) ;
+  GALGAS_string var_fileIncludeList_1681 = GALGAS_string::makeEmptyString () ;
+  GALGAS_uint var_startErrorCount_1778 = GALGAS_uint::constructor_errorCount (SOURCE_FILE ("goil_syntax.galgas", 57)) ;
+  GALGAS_uint var_startWarningCount_1821 = GALGAS_uint::constructor_warningCount (SOURCE_FILE ("goil_syntax.galgas", 58)) ;
+  GALGAS_lstring var_version_1918 ;
+  GALGAS_lstring var_desc_1937 = function_lstringWith (GALGAS_string::makeEmptyString (), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 62)) ;
+  nt_OIL_5F_version_ (var_version_1918, var_desc_1937, inCompiler) ;
   {
-  var_application_1049.setter_setVersion (var_version_1178 COMMA_SOURCE_FILE ("goil_syntax.galgas", 48)) ;
+  var_application_1558.setter_setVersion (var_version_1918 COMMA_SOURCE_FILE ("goil_syntax.galgas", 64)) ;
   }
   {
-  var_application_1049.setter_setVersionDescription (var_desc_1194 COMMA_SOURCE_FILE ("goil_syntax.galgas", 49)) ;
-  }
-  GALGAS_string var_config_5F_file_5F_name_1358 = GALGAS_string (gOption_goil_5F_options_config.getter_value ()) ;
-  GALGAS_stringlist var_configFiles_1452 = function_allTemplateFilePaths (GALGAS_string ("config"), var_config_5F_file_5F_name_1358.add_operation (GALGAS_string (".oil"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 54)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 54)) ;
-  cEnumerator_stringlist enumerator_1663 (var_configFiles_1452, kENUMERATION_DOWN) ;
-  while (enumerator_1663.hasCurrentObject ()) {
-    cGrammar_goil_5F_file_5F_level_5F_include::_performSourceFileParsing_ (inCompiler, function_lstringWith (enumerator_1663.current_mValue (HERE), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 58)), var_imp_955, var_application_1049, var_fileIncludeList_1107, GALGAS_bool (false)  COMMA_SOURCE_FILE ("goil_syntax.galgas", 58)) ;
-    enumerator_1663.gotoNextObject () ;
-  }
-  GALGAS_stringlist var_configVersionFiles_1868 = function_allTemplateFilePaths (GALGAS_string ("config"), var_config_5F_file_5F_name_1358.add_operation (var_version_1178.getter_string (SOURCE_FILE ("goil_syntax.galgas", 62)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 62)).add_operation (GALGAS_string (".oil"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 62)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 62)) ;
-  cEnumerator_stringlist enumerator_1981 (var_configVersionFiles_1868, kENUMERATION_DOWN) ;
-  while (enumerator_1981.hasCurrentObject ()) {
-    cGrammar_goil_5F_file_5F_level_5F_include::_performSourceFileParsing_ (inCompiler, function_lstringWith (enumerator_1981.current_mValue (HERE), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 65)), var_imp_955, var_application_1049, var_fileIncludeList_1107, GALGAS_bool (false)  COMMA_SOURCE_FILE ("goil_syntax.galgas", 65)) ;
-    enumerator_1981.gotoNextObject () ;
-  }
-  nt_file_ (var_imp_955, var_application_1049, var_fileIncludeList_1107, GALGAS_bool (true), inCompiler) ;
-  callExtensionMethod_checkObjectReferences ((const cPtr_implementation *) var_imp_955.ptr (), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 83)) ;
+  var_application_1558.setter_setVersionDescription (var_desc_1937 COMMA_SOURCE_FILE ("goil_syntax.galgas", 65)) ;
+  }
+  GALGAS_string var_config_5F_file_5F_name_2089 = GALGAS_string (gOption_goil_5F_options_config.getter_value ()) ;
+  GALGAS_stringlist var_configFiles_2188 = function_allTemplateFilePaths (GALGAS_string ("config"), var_config_5F_file_5F_name_2089.add_operation (GALGAS_string (".oil"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 70)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 70)) ;
+  GALGAS_stringlist var_configVersionFiles_2332 = function_allTemplateFilePaths (GALGAS_string ("config"), var_config_5F_file_5F_name_2089.add_operation (var_version_1918.getter_string (SOURCE_FILE ("goil_syntax.galgas", 72)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 72)).add_operation (GALGAS_string (".oil"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 72)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 72)) ;
+  GALGAS_string var_key_2535 = GALGAS_string::makeEmptyString () ;
+  cEnumerator_stringlist enumerator_2550 (var_configFiles_2188, kENUMERATION_UP) ;
+  while (enumerator_2550.hasCurrentObject ()) {
+    var_key_2535.plusAssign_operation(enumerator_2550.current_mValue (HERE).add_operation (GALGAS_string ("\t"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 77)).add_operation (GALGAS_string::constructor_stringWithContentsOfFile (enumerator_2550.current_mValue (HERE), inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 77)).getter_md_35_ (SOURCE_FILE ("goil_syntax.galgas", 77)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 77)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 77)), inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 77)) ;
+    enumerator_2550.gotoNextObject () ;
+  }
+  cEnumerator_stringlist enumerator_2676 (var_configVersionFiles_2332, kENUMERATION_UP) ;
+  while (enumerator_2676.hasCurrentObject ()) {
+    var_key_2535.plusAssign_operation(enumerator_2676.current_mValue (HERE).add_operation (GALGAS_string ("\t"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 80)).add_operation (GALGAS_string::constructor_stringWithContentsOfFile (enumerator_2676.current_mValue (HERE), inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 80)).getter_md_35_ (SOURCE_FILE ("goil_syntax.galgas", 80)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 80)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 80)), inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 80)) ;
+    enumerator_2676.gotoNextObject () ;
+  }
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = GALGAS_bool (kIsEqual, GALGAS_uint::constructor_errorCount (SOURCE_FILE ("goil_syntax.galgas", 85)).objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
+    test_0 = GALGAS_bool (kIsEqual, var_key_2535.objectCompare (ioArgument_configKey)).boolEnum () ;
     if (kBoolTrue == test_0) {
+      var_imp_1472 = ioArgument_configImp ;
+      var_application_1558 = ioArgument_configApplication ;
+      var_fileIncludeList_1681 = ioArgument_configIncludeList ;
+      {
+      var_application_1558.setter_setVersion (var_version_1918 COMMA_SOURCE_FILE ("goil_syntax.galgas", 86)) ;
+      }
       {
-      routine_setDefaults (var_imp_955, var_application_1049, inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 86)) ;
+      var_application_1558.setter_setVersionDescription (var_desc_1937 COMMA_SOURCE_FILE ("goil_syntax.galgas", 87)) ;
       }
     }
   }
-  enumGalgasBool test_1 = kBoolTrue ;
-  if (kBoolTrue == test_1) {
-    test_1 = GALGAS_bool (kIsEqual, GALGAS_uint::constructor_errorCount (SOURCE_FILE ("goil_syntax.galgas", 93)).objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
+  if (kBoolFalse == test_0) {
+    cEnumerator_stringlist enumerator_3150 (var_configFiles_2188, kENUMERATION_DOWN) ;
+    while (enumerator_3150.hasCurrentObject ()) {
+      cGrammar_goil_5F_file_5F_level_5F_include::_performSourceFileParsing_ (inCompiler, function_lstringWith (enumerator_3150.current_mValue (HERE), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 92)), var_imp_1472, var_application_1558, var_fileIncludeList_1681, GALGAS_bool (false)  COMMA_SOURCE_FILE ("goil_syntax.galgas", 92)) ;
+      enumerator_3150.gotoNextObject () ;
+    }
+    cEnumerator_stringlist enumerator_3307 (var_configVersionFiles_2332, kENUMERATION_DOWN) ;
+    while (enumerator_3307.hasCurrentObject ()) {
+      cGrammar_goil_5F_file_5F_level_5F_include::_performSourceFileParsing_ (inCompiler, function_lstringWith (enumerator_3307.current_mValue (HERE), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 96)), var_imp_1472, var_application_1558, var_fileIncludeList_1681, GALGAS_bool (false)  COMMA_SOURCE_FILE ("goil_syntax.galgas", 96)) ;
+      enumerator_3307.gotoNextObject () ;
+    }
+    enumGalgasBool test_1 = kBoolTrue ;
     if (kBoolTrue == test_1) {
-      {
-      routine_verifyAll (var_imp_955, var_application_1049, inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 94)) ;
+      test_1 = GALGAS_bool (kIsEqual, GALGAS_uint::constructor_errorCount (SOURCE_FILE ("goil_syntax.galgas", 98)).objectCompare (var_startErrorCount_1778)).operator_and (GALGAS_bool (kIsEqual, GALGAS_uint::constructor_warningCount (SOURCE_FILE ("goil_syntax.galgas", 98)).objectCompare (var_startWarningCount_1821)) COMMA_SOURCE_FILE ("goil_syntax.galgas", 98)).boolEnum () ;
+      if (kBoolTrue == test_1) {
+        ioArgument_configKey = var_key_2535 ;
+        ioArgument_configImp = var_imp_1472 ;
+        ioArgument_configApplication = var_application_1558 ;
+        ioArgument_configIncludeList = var_fileIncludeList_1681 ;
       }
     }
+    if (kBoolFalse == test_1) {
+      ioArgument_configKey = GALGAS_string::makeEmptyString () ;
+    }
+  }
+  nt_file_ (var_imp_1472, var_application_1558, var_fileIncludeList_1681, GALGAS_bool (true), inCompiler) ;
+  callExtensionMethod_checkObjectReferences ((const cPtr_implementation *) var_imp_1472.ptr (), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 123)) ;
+  {
+  extensionSetter_addSample (var_phases_1411, GALGAS_string ("parsing"), var_timer_1439, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 124)) ;
   }
   enumGalgasBool test_2 = kBoolTrue ;
   if (kBoolTrue == test_2) {
-    test_2 = GALGAS_bool (kIsEqual, GALGAS_uint::constructor_errorCount (SOURCE_FILE ("goil_syntax.galgas", 96)).objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
+    test_2 = GALGAS_bool (kIsEqual, GALGAS_uint::constructor_errorCount (SOURCE_FILE ("goil_syntax.galgas", 126)).objectCompare (var_startErrorCount_1778)).boolEnum () ;
     if (kBoolTrue == test_2) {
-      GALGAS_gtlData var_templateData_2847 = callExtensionGetter_templateData ((const cPtr_applicationDefinition *) var_application_1049.ptr (), var_imp_955, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 97)) ;
+      var_timer_1439 = GALGAS_timer::constructor_start (SOURCE_FILE ("goil_syntax.galgas", 127)) ;
       {
-      routine_generate_5F_all (var_templateData_2847, inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 100)) ;
+      routine_setDefaults (var_imp_1472, var_application_1558, inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 128)) ;
+      }
+      {
+      extensionSetter_addSample (var_phases_1411, GALGAS_string ("setDefaults"), var_timer_1439, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 129)) ;
       }
     }
   }
-  var_fileIncludeList_1107 = GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 103)).getter_lastPathComponent (SOURCE_FILE ("goil_syntax.galgas", 103)).add_operation (GALGAS_string (":"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 103)).add_operation (var_fileIncludeList_1107, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 103)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 103)) ;
-  GALGAS_string var_oilDepFileName_3150 = GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 104)).getter_stringByDeletingLastPathComponent (SOURCE_FILE ("goil_syntax.galgas", 104)).add_operation (GALGAS_string ("/build/"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 104)).add_operation (GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 105)).getter_lastPathComponent (SOURCE_FILE ("goil_syntax.galgas", 105)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 105)).add_operation (GALGAS_string (".dep"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 105)) ;
-  var_fileIncludeList_1107.method_writeToFile (var_oilDepFileName_3150, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 107)) ;
+  enumGalgasBool test_3 = kBoolTrue ;
+  if (kBoolTrue == test_3) {
+    test_3 = GALGAS_bool (kIsEqual, GALGAS_uint::constructor_errorCount (SOURCE_FILE ("goil_syntax.galgas", 136)).objectCompare (var_startErrorCount_1778)).boolEnum () ;
+    if (kBoolTrue == test_3) {
+      var_timer_1439 = GALGAS_timer::constructor_start (SOURCE_FILE ("goil_syntax.galgas", 137)) ;
+      {
+      routine_verifyAll (var_imp_1472, var_application_1558, inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 138)) ;
+      }
+      {
+      extensionSetter_addSample (var_phases_1411, GALGAS_string ("verifyAll"), var_timer_1439, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 139)) ;
+      }
+    }
+  }
+  enumGalgasBool test_4 = kBoolTrue ;
+  if (kBoolTrue == test_4) {
+    test_4 = GALGAS_bool (kIsEqual, GALGAS_uint::constructor_errorCount (SOURCE_FILE ("goil_syntax.galgas", 141)).objectCompare (var_startErrorCount_1778)).boolEnum () ;
+    if (kBoolTrue == test_4) {
+      var_timer_1439 = GALGAS_timer::constructor_start (SOURCE_FILE ("goil_syntax.galgas", 142)) ;
+      outArgument_templateData = callExtensionGetter_templateData ((const cPtr_applicationDefinition *) var_application_1558.ptr (), var_imp_1472, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 143)) ;
+      {
+      extensionSetter_addSample (var_phases_1411, GALGAS_string ("templateData"), var_timer_1439, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 144)) ;
+      }
+      enumGalgasBool test_5 = kBoolTrue ;
+      if (kBoolTrue == test_5) {
+        test_5 = GALGAS_bool (kIsEqual, GALGAS_uint::constructor_warningCount (SOURCE_FILE ("goil_syntax.galgas", 148)).objectCompare (var_startWarningCount_1821)).operator_and (GALGAS_bool (gOption_goil_5F_options_watch.getter_value ()).operator_not (SOURCE_FILE ("goil_syntax.galgas", 148)) COMMA_SOURCE_FILE ("goil_syntax.galgas", 148)).boolEnum () ;
+        if (kBoolTrue == test_5) {
+          var_timer_1439 = GALGAS_timer::constructor_start (SOURCE_FILE ("goil_syntax.galgas", 149)) ;
+          {
+          routine_saveSnapshot (outArgument_templateData, inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 150)) ;
+          }
+          {
+          extensionSetter_addSample (var_phases_1411, GALGAS_string ("saveSnapshot"), var_timer_1439, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 151)) ;
+          }
+        }
+      }
+      {
+      routine_generate_5F_all (outArgument_templateData, var_phases_1411, ioArgument_lib, inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 154)) ;
+      }
+    }
+  }
+  var_fileIncludeList_1681 = GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 157)).getter_lastPathComponent (SOURCE_FILE ("goil_syntax.galgas", 157)).add_operation (GALGAS_string (":"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 157)).add_operation (var_fileIncludeList_1681, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 157)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 157)) ;
+  GALGAS_string var_oilDepFileName_5353 = GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 158)).getter_stringByDeletingLastPathComponent (SOURCE_FILE ("goil_syntax.galgas", 158)).add_operation (GALGAS_string ("/build/"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 158)).add_operation (GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 159)).getter_lastPathComponent (SOURCE_FILE ("goil_syntax.galgas", 159)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 159)).add_operation (GALGAS_string (".dep"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 159)) ;
+  var_fileIncludeList_1681.method_writeToFile (var_oilDepFileName_5353, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 161)) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -8410,10 +8491,10 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_file_i1_ (GALGAS_implementation
                                                            C_Lexique_goil_5F_lexique * inCompiler) {
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = constinArgument_rootFile.operator_not (SOURCE_FILE ("goil_syntax.galgas", 116)).boolEnum () ;
+    test_0 = constinArgument_rootFile.operator_not (SOURCE_FILE ("goil_syntax.galgas", 170)).boolEnum () ;
     if (kBoolTrue == test_0) {
       ioArgument_fileIncludeList.plusAssign_operation(GALGAS_string (" \\\n"
-        " ").add_operation (GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 117)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 117)), inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 117)) ;
+        " ").add_operation (GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 171)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 171)), inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 171)) ;
     }
   }
   bool repeatFlag_1 = true ;
@@ -8465,11 +8546,11 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_sign_i2_ (GALGAS_bool & outArgu
   outArgument_signed.drop () ; // Release 'out' argument
   switch (select_goil_5F_syntax_1 (inCompiler)) {
   case 1: {
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__2D_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 128)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__2D_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 182)) ;
     outArgument_signed = GALGAS_bool (true) ;
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__2B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 130)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__2B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 184)) ;
     outArgument_signed = GALGAS_bool (false) ;
   } break ;
   case 3: {
@@ -8485,10 +8566,10 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_sign_i2_ (GALGAS_bool & outArgu
 void cParser_goil_5F_syntax::rule_goil_5F_syntax_sign_i2_parse (C_Lexique_goil_5F_lexique * inCompiler) {
   switch (select_goil_5F_syntax_1 (inCompiler)) {
   case 1: {
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__2D_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 128)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__2D_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 182)) ;
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__2B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 130)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__2B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 184)) ;
   } break ;
   case 3: {
   } break ;
@@ -8505,36 +8586,36 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_description_i3_ (GALGAS_lstring
   outArgument_desc.drop () ; // Release 'out' argument
   switch (select_goil_5F_syntax_2 (inCompiler)) {
   case 1: {
-    outArgument_desc = function_lstringWith (GALGAS_string::makeEmptyString (), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 141)) ;
+    outArgument_desc = function_lstringWith (GALGAS_string::makeEmptyString (), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 195)) ;
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__3A_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 143)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__3A_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 197)) ;
     GALGAS_lstring var_partialString_4132 ;
     var_partialString_4132 = inCompiler->synthetizedAttribute_a_5F_string () ;
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 145)) ;
-    GALGAS_string var_result_4179 = var_partialString_4132.getter_string (SOURCE_FILE ("goil_syntax.galgas", 146)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 199)) ;
+    GALGAS_string var_result_4179 = var_partialString_4132.getter_string (SOURCE_FILE ("goil_syntax.galgas", 200)) ;
     bool repeatFlag_0 = true ;
     while (repeatFlag_0) {
       switch (select_goil_5F_syntax_3 (inCompiler)) {
       case 2: {
         var_partialString_4132 = inCompiler->synthetizedAttribute_a_5F_string () ;
-        inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 149)) ;
-        GALGAS_string var_toappend_4278 = var_partialString_4132.getter_string (SOURCE_FILE ("goil_syntax.galgas", 150)) ;
+        inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 203)) ;
+        GALGAS_string var_toappend_4278 = var_partialString_4132.getter_string (SOURCE_FILE ("goil_syntax.galgas", 204)) ;
         enumGalgasBool test_1 = kBoolTrue ;
         if (kBoolTrue == test_1) {
-          test_1 = GALGAS_bool (kIsNotEqual, var_result_4179.getter_rightSubString (GALGAS_uint ((uint32_t) 2U) COMMA_SOURCE_FILE ("goil_syntax.galgas", 151)).objectCompare (GALGAS_string ("\\n"))).boolEnum () ;
+          test_1 = GALGAS_bool (kIsNotEqual, var_result_4179.getter_rightSubString (GALGAS_uint ((uint32_t) 2U) COMMA_SOURCE_FILE ("goil_syntax.galgas", 205)).objectCompare (GALGAS_string ("\\n"))).boolEnum () ;
           if (kBoolTrue == test_1) {
-            var_toappend_4278 = GALGAS_string (" ").add_operation (var_toappend_4278, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 152)) ;
+            var_toappend_4278 = GALGAS_string (" ").add_operation (var_toappend_4278, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 206)) ;
           }
         }
-        var_result_4179.plusAssign_operation(var_toappend_4278, inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 154)) ;
+        var_result_4179.plusAssign_operation(var_toappend_4278, inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 208)) ;
       } break ;
       default:
         repeatFlag_0 = false ;
         break ;
       }
     }
-    outArgument_desc = GALGAS_lstring::constructor_new (var_result_4179.getter_stringByReplacingStringByString (GALGAS_string ("\\n"), GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 156)), var_partialString_4132.getter_location (SOURCE_FILE ("goil_syntax.galgas", 156))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 156)) ;
+    outArgument_desc = GALGAS_lstring::constructor_new (var_result_4179.getter_stringByReplacingStringByString (GALGAS_string ("\\n"), GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 210)), var_partialString_4132.getter_location (SOURCE_FILE ("goil_syntax.galgas", 210))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 210)) ;
   } break ;
   default:
     break ;
@@ -8548,13 +8629,13 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_description_i3_parse (C_Lexique
   case 1: {
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__3A_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 143)) ;
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 145)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__3A_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 197)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 199)) ;
     bool repeatFlag_0 = true ;
     while (repeatFlag_0) {
       switch (select_goil_5F_syntax_3 (inCompiler)) {
       case 2: {
-        inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 149)) ;
+        inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 203)) ;
       } break ;
       default:
         repeatFlag_0 = false ;
@@ -8575,22 +8656,22 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_OIL_5F_version_i4_ (GALGAS_lstr
                                                                      C_Lexique_goil_5F_lexique * inCompiler) {
   outArgument_version.drop () ; // Release 'out' argument
   outArgument_desc.drop () ; // Release 'out' argument
-  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_OIL_5F_VERSION COMMA_SOURCE_FILE ("goil_syntax.galgas", 164)) ;
-  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__3D_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 164)) ;
+  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_OIL_5F_VERSION COMMA_SOURCE_FILE ("goil_syntax.galgas", 218)) ;
+  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__3D_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 218)) ;
   outArgument_version = inCompiler->synthetizedAttribute_a_5F_string () ;
-  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 164)) ;
+  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 218)) ;
   nt_description_ (outArgument_desc, inCompiler) ;
-  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__3B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 164)) ;
+  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__3B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 218)) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
 
 void cParser_goil_5F_syntax::rule_goil_5F_syntax_OIL_5F_version_i4_parse (C_Lexique_goil_5F_lexique * inCompiler) {
-  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_OIL_5F_VERSION COMMA_SOURCE_FILE ("goil_syntax.galgas", 164)) ;
-  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__3D_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 164)) ;
-  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 164)) ;
+  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_OIL_5F_VERSION COMMA_SOURCE_FILE ("goil_syntax.galgas", 218)) ;
+  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__3D_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 218)) ;
+  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 218)) ;
   nt_description_parse (inCompiler) ;
-  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__3B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 164)) ;
+  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__3B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 218)) ;
   inCompiler->resetTemplateString () ;
 }
 
@@ -8601,35 +8682,35 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_application_5F_definition_i5_ (
                                                                                 GALGAS_string & ioArgument_fileIncludeList,
                                                                                 const GALGAS_bool constinArgument_rootFile,
                                                                                 C_Lexique_goil_5F_lexique * inCompiler) {
-  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_CPU COMMA_SOURCE_FILE ("goil_syntax.galgas", 176)) ;
+  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_CPU COMMA_SOURCE_FILE ("goil_syntax.galgas", 230)) ;
   GALGAS_lstring var_cpuName_5078 = inCompiler->synthetizedAttribute_att_5F_token () ;
-  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_idf COMMA_SOURCE_FILE ("goil_syntax.galgas", 176)) ;
-  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 176)) ;
-  GALGAS_objectsMap var_objects_5104 = ioArgument_application.getter_objects (SOURCE_FILE ("goil_syntax.galgas", 177)) ;
+  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_idf COMMA_SOURCE_FILE ("goil_syntax.galgas", 230)) ;
+  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 230)) ;
+  GALGAS_objectsMap var_objects_5104 = ioArgument_application.getter_objects (SOURCE_FILE ("goil_syntax.galgas", 231)) ;
   nt_object_5F_definition_5F_list_ (constinArgument_imp, var_objects_5104, ioArgument_fileIncludeList, constinArgument_rootFile, inCompiler) ;
-  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7D_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 179)) ;
+  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7D_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 233)) ;
   GALGAS_lstring joker_5220 ; // Joker input parameter
   nt_description_ (joker_5220, inCompiler) ;
   joker_5220.drop () ; // Release temporary input variables (joker in source)
-  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__3B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 179)) ;
+  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__3B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 233)) ;
   {
-  ioArgument_application.setter_setName (var_cpuName_5078 COMMA_SOURCE_FILE ("goil_syntax.galgas", 180)) ;
+  ioArgument_application.setter_setName (var_cpuName_5078 COMMA_SOURCE_FILE ("goil_syntax.galgas", 234)) ;
   }
   {
-  ioArgument_application.setter_setObjects (var_objects_5104 COMMA_SOURCE_FILE ("goil_syntax.galgas", 181)) ;
+  ioArgument_application.setter_setObjects (var_objects_5104 COMMA_SOURCE_FILE ("goil_syntax.galgas", 235)) ;
   }
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
 
 void cParser_goil_5F_syntax::rule_goil_5F_syntax_application_5F_definition_i5_parse (C_Lexique_goil_5F_lexique * inCompiler) {
-  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_CPU COMMA_SOURCE_FILE ("goil_syntax.galgas", 176)) ;
-  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_idf COMMA_SOURCE_FILE ("goil_syntax.galgas", 176)) ;
-  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 176)) ;
+  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_CPU COMMA_SOURCE_FILE ("goil_syntax.galgas", 230)) ;
+  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_idf COMMA_SOURCE_FILE ("goil_syntax.galgas", 230)) ;
+  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 230)) ;
   nt_object_5F_definition_5F_list_parse (inCompiler) ;
-  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7D_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 179)) ;
+  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7D_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 233)) ;
   nt_description_parse (inCompiler) ;
-  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__3B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 179)) ;
+  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__3B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 233)) ;
   inCompiler->resetTemplateString () ;
 }
 
@@ -8645,65 +8726,65 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_object_5F_definition_5F_list_i6
     switch (select_goil_5F_syntax_4 (inCompiler)) {
     case 2: {
       GALGAS_lstring var_objectKind_5486 = inCompiler->synthetizedAttribute_att_5F_token () ;
-      inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_idf COMMA_SOURCE_FILE ("goil_syntax.galgas", 192)) ;
-      GALGAS_implementationObject var_impObjOfKind_5525 = callExtensionGetter_impObject ((const cPtr_implementation *) constinArgument_imp.ptr (), var_objectKind_5486.getter_string (SOURCE_FILE ("goil_syntax.galgas", 193)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 193)) ;
-      GALGAS_objectKind var_objectsForKind_5598 = GALGAS_objectKind::constructor_new (GALGAS_objectKindMap::constructor_emptyMap (SOURCE_FILE ("goil_syntax.galgas", 194))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 194)) ;
+      inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_idf COMMA_SOURCE_FILE ("goil_syntax.galgas", 246)) ;
+      GALGAS_implementationObject var_impObjOfKind_5525 = callExtensionGetter_impObject ((const cPtr_implementation *) constinArgument_imp.ptr (), var_objectKind_5486.getter_string (SOURCE_FILE ("goil_syntax.galgas", 247)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 247)) ;
+      GALGAS_objectKind var_objectsForKind_5598 = GALGAS_objectKind::constructor_new (GALGAS_objectKindMap::constructor_emptyMap (SOURCE_FILE ("goil_syntax.galgas", 248))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 248)) ;
       enumGalgasBool test_1 = kBoolTrue ;
       if (kBoolTrue == test_1) {
-        test_1 = ioArgument_objects.getter_hasKey (var_objectKind_5486.getter_string (SOURCE_FILE ("goil_syntax.galgas", 195)) COMMA_SOURCE_FILE ("goil_syntax.galgas", 195)).boolEnum () ;
+        test_1 = ioArgument_objects.getter_hasKey (var_objectKind_5486.getter_string (SOURCE_FILE ("goil_syntax.galgas", 249)) COMMA_SOURCE_FILE ("goil_syntax.galgas", 249)).boolEnum () ;
         if (kBoolTrue == test_1) {
           {
-          ioArgument_objects.setter_del (var_objectKind_5486, var_objectsForKind_5598, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 196)) ;
+          ioArgument_objects.setter_del (var_objectKind_5486, var_objectsForKind_5598, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 250)) ;
           }
         }
       }
       GALGAS_lstring var_objectName_5789 = inCompiler->synthetizedAttribute_att_5F_token () ;
-      inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_idf COMMA_SOURCE_FILE ("goil_syntax.galgas", 198)) ;
-      GALGAS_objectAttributes var_object_5818 = function_emptyObject (inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 199)) ;
-      GALGAS_objectKindMap var_objectsKind_5865 = var_objectsForKind_5598.getter_objects (SOURCE_FILE ("goil_syntax.galgas", 200)) ;
+      inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_idf COMMA_SOURCE_FILE ("goil_syntax.galgas", 252)) ;
+      GALGAS_objectAttributes var_object_5818 = function_emptyObject (inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 253)) ;
+      GALGAS_objectKindMap var_objectsKind_5865 = var_objectsForKind_5598.getter_objects (SOURCE_FILE ("goil_syntax.galgas", 254)) ;
       enumGalgasBool test_2 = kBoolTrue ;
       if (kBoolTrue == test_2) {
-        test_2 = GALGAS_bool (kIsEqual, var_impObjOfKind_5525.getter_multiple (SOURCE_FILE ("goil_syntax.galgas", 201)).getter_bool (SOURCE_FILE ("goil_syntax.galgas", 201)).objectCompare (GALGAS_bool (false))).boolEnum () ;
+        test_2 = GALGAS_bool (kIsEqual, var_impObjOfKind_5525.getter_multiple (SOURCE_FILE ("goil_syntax.galgas", 255)).getter_bool (SOURCE_FILE ("goil_syntax.galgas", 255)).objectCompare (GALGAS_bool (false))).boolEnum () ;
         if (kBoolTrue == test_2) {
           var_objectName_5789 = var_objectKind_5486 ;
         }
       }
       enumGalgasBool test_3 = kBoolTrue ;
       if (kBoolTrue == test_3) {
-        test_3 = var_objectsKind_5865.getter_hasKey (var_objectName_5789.getter_string (SOURCE_FILE ("goil_syntax.galgas", 207)) COMMA_SOURCE_FILE ("goil_syntax.galgas", 207)).boolEnum () ;
+        test_3 = var_objectsKind_5865.getter_hasKey (var_objectName_5789.getter_string (SOURCE_FILE ("goil_syntax.galgas", 261)) COMMA_SOURCE_FILE ("goil_syntax.galgas", 261)).boolEnum () ;
         if (kBoolTrue == test_3) {
           {
-          var_objectsKind_5865.setter_del (var_objectName_5789, var_object_5818, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 208)) ;
+          var_objectsKind_5865.setter_del (var_objectName_5789, var_object_5818, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 262)) ;
           }
         }
       }
-      inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 210)) ;
-      nt_oil_5F_declaration_5F_list_ (var_impObjOfKind_5525.getter_attributes (SOURCE_FILE ("goil_syntax.galgas", 211)), var_object_5818, inCompiler) ;
-      inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7D_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 212)) ;
+      inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 264)) ;
+      nt_oil_5F_declaration_5F_list_ (var_impObjOfKind_5525.getter_attributes (SOURCE_FILE ("goil_syntax.galgas", 265)), var_object_5818, inCompiler) ;
+      inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7D_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 266)) ;
       GALGAS_lstring var_oil_5F_desc_6424 ;
       nt_description_ (var_oil_5F_desc_6424, inCompiler) ;
-      inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__3B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 214)) ;
-      GALGAS_identifierMap var_attributes_6462 = var_object_5818.getter_objectParams (SOURCE_FILE ("goil_syntax.galgas", 215)) ;
+      inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__3B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 268)) ;
+      GALGAS_identifierMap var_attributes_6462 = var_object_5818.getter_objectParams (SOURCE_FILE ("goil_syntax.galgas", 269)) ;
       enumGalgasBool test_4 = kBoolTrue ;
       if (kBoolTrue == test_4) {
-        test_4 = var_attributes_6462.getter_hasKey (GALGAS_string ("NAME") COMMA_SOURCE_FILE ("goil_syntax.galgas", 216)).operator_not (SOURCE_FILE ("goil_syntax.galgas", 216)).boolEnum () ;
+        test_4 = var_attributes_6462.getter_hasKey (GALGAS_string ("NAME") COMMA_SOURCE_FILE ("goil_syntax.galgas", 270)).operator_not (SOURCE_FILE ("goil_syntax.galgas", 270)).boolEnum () ;
         if (kBoolTrue == test_4) {
           {
-          var_attributes_6462.setter_put (GALGAS_lstring::constructor_new (GALGAS_string ("NAME"), var_objectName_5789.getter_location (SOURCE_FILE ("goil_syntax.galgas", 218))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 217)), GALGAS_stringAttribute::constructor_new (var_oil_5F_desc_6424, var_objectName_5789.getter_location (SOURCE_FILE ("goil_syntax.galgas", 220)), var_objectName_5789.getter_string (SOURCE_FILE ("goil_syntax.galgas", 221))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 219)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 217)) ;
+          var_attributes_6462.setter_put (GALGAS_lstring::constructor_new (GALGAS_string ("NAME"), var_objectName_5789.getter_location (SOURCE_FILE ("goil_syntax.galgas", 272))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 271)), GALGAS_stringAttribute::constructor_new (var_oil_5F_desc_6424, var_objectName_5789.getter_location (SOURCE_FILE ("goil_syntax.galgas", 274)), var_objectName_5789.getter_string (SOURCE_FILE ("goil_syntax.galgas", 275))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 273)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 271)) ;
           }
           {
-          var_object_5818.setter_setObjectParams (var_attributes_6462 COMMA_SOURCE_FILE ("goil_syntax.galgas", 222)) ;
+          var_object_5818.setter_setObjectParams (var_attributes_6462 COMMA_SOURCE_FILE ("goil_syntax.galgas", 276)) ;
           }
         }
       }
       {
-      var_objectsKind_5865.setter_put (var_objectName_5789, var_object_5818, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 224)) ;
+      var_objectsKind_5865.setter_put (var_objectName_5789, var_object_5818, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 278)) ;
       }
       {
-      var_objectsForKind_5598.setter_setObjects (var_objectsKind_5865 COMMA_SOURCE_FILE ("goil_syntax.galgas", 225)) ;
+      var_objectsForKind_5598.setter_setObjects (var_objectsKind_5865 COMMA_SOURCE_FILE ("goil_syntax.galgas", 279)) ;
       }
       {
-      ioArgument_objects.setter_put (var_objectKind_5486, var_objectsForKind_5598, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 226)) ;
+      ioArgument_objects.setter_put (var_objectKind_5486, var_objectsForKind_5598, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 280)) ;
       }
     } break ;
     case 3: {
@@ -8723,13 +8804,13 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_object_5F_definition_5F_list_i6
   while (repeatFlag_0) {
     switch (select_goil_5F_syntax_4 (inCompiler)) {
     case 2: {
-      inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_idf COMMA_SOURCE_FILE ("goil_syntax.galgas", 192)) ;
-      inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_idf COMMA_SOURCE_FILE ("goil_syntax.galgas", 198)) ;
-      inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 210)) ;
+      inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_idf COMMA_SOURCE_FILE ("goil_syntax.galgas", 246)) ;
+      inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_idf COMMA_SOURCE_FILE ("goil_syntax.galgas", 252)) ;
+      inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 264)) ;
       nt_oil_5F_declaration_5F_list_parse (inCompiler) ;
-      inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7D_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 212)) ;
+      inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7D_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 266)) ;
       nt_description_parse (inCompiler) ;
-      inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__3B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 214)) ;
+      inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__3B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 268)) ;
     } break ;
     case 3: {
       nt_include_5F_cpu_5F_level_parse (inCompiler) ;
@@ -8749,12 +8830,12 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_boolean_i7_ (GALGAS_lbool & out
   outArgument_val.drop () ; // Release 'out' argument
   switch (select_goil_5F_syntax_5 (inCompiler)) {
   case 1: {
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_TRUE COMMA_SOURCE_FILE ("goil_syntax.galgas", 236)) ;
-    outArgument_val = GALGAS_lbool::constructor_new (GALGAS_bool (true), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 237))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 237)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_TRUE COMMA_SOURCE_FILE ("goil_syntax.galgas", 290)) ;
+    outArgument_val = GALGAS_lbool::constructor_new (GALGAS_bool (true), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 291))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 291)) ;
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_FALSE COMMA_SOURCE_FILE ("goil_syntax.galgas", 239)) ;
-    outArgument_val = GALGAS_lbool::constructor_new (GALGAS_bool (false), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 240))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 240)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_FALSE COMMA_SOURCE_FILE ("goil_syntax.galgas", 293)) ;
+    outArgument_val = GALGAS_lbool::constructor_new (GALGAS_bool (false), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 294))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 294)) ;
   } break ;
   default:
     break ;
@@ -8766,10 +8847,10 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_boolean_i7_ (GALGAS_lbool & out
 void cParser_goil_5F_syntax::rule_goil_5F_syntax_boolean_i7_parse (C_Lexique_goil_5F_lexique * inCompiler) {
   switch (select_goil_5F_syntax_5 (inCompiler)) {
   case 1: {
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_TRUE COMMA_SOURCE_FILE ("goil_syntax.galgas", 236)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_TRUE COMMA_SOURCE_FILE ("goil_syntax.galgas", 290)) ;
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_FALSE COMMA_SOURCE_FILE ("goil_syntax.galgas", 239)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_FALSE COMMA_SOURCE_FILE ("goil_syntax.galgas", 293)) ;
   } break ;
   default:
     break ;
@@ -8826,34 +8907,34 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_oil_5F_declaration_i9_ (const G
   GALGAS_lstring var_idf_7783 ;
   GALGAS_object_5F_t var_val_7799 ;
   var_idf_7783 = inCompiler->synthetizedAttribute_att_5F_token () ;
-  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_idf COMMA_SOURCE_FILE ("goil_syntax.galgas", 261)) ;
-  GALGAS_locationList temp_0 = GALGAS_locationList::constructor_emptyList (SOURCE_FILE ("goil_syntax.galgas", 265)) ;
-  temp_0.addAssign_operation (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 265))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 265)) ;
-  GALGAS_impType var_type_7871 = GALGAS_impVoid::constructor_new (temp_0, GALGAS_dataType::constructor_void (SOURCE_FILE ("goil_syntax.galgas", 265)), function_emptyLString (inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 265)), GALGAS_bool (false), GALGAS_lstringlist::constructor_emptyList (SOURCE_FILE ("goil_syntax.galgas", 265))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 265)) ;
+  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_idf COMMA_SOURCE_FILE ("goil_syntax.galgas", 315)) ;
+  GALGAS_locationList temp_0 = GALGAS_locationList::constructor_emptyList (SOURCE_FILE ("goil_syntax.galgas", 319)) ;
+  temp_0.addAssign_operation (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 319))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 319)) ;
+  GALGAS_impType var_type_7871 = GALGAS_impVoid::constructor_new (temp_0, GALGAS_dataType::constructor_void (SOURCE_FILE ("goil_syntax.galgas", 319)), function_emptyLString (inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 319)), GALGAS_bool (false), GALGAS_lstringlist::constructor_emptyList (SOURCE_FILE ("goil_syntax.galgas", 319))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 319)) ;
   GALGAS_bool var_typeOk_7970 = GALGAS_bool (false) ;
   enumGalgasBool test_1 = kBoolTrue ;
   if (kBoolTrue == test_1) {
-    test_1 = constinArgument_types.getter_hasKey (var_idf_7783.getter_string (SOURCE_FILE ("goil_syntax.galgas", 267)) COMMA_SOURCE_FILE ("goil_syntax.galgas", 267)).boolEnum () ;
+    test_1 = constinArgument_types.getter_hasKey (var_idf_7783.getter_string (SOURCE_FILE ("goil_syntax.galgas", 321)) COMMA_SOURCE_FILE ("goil_syntax.galgas", 321)).boolEnum () ;
     if (kBoolTrue == test_1) {
-      constinArgument_types.method_get (var_idf_7783, var_type_7871, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 268)) ;
+      constinArgument_types.method_get (var_idf_7783, var_type_7871, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 322)) ;
       var_typeOk_7970 = GALGAS_bool (true) ;
     }
   }
   if (kBoolFalse == test_1) {
     TC_Array <C_FixItDescription> fixItArray2 ;
-    inCompiler->emitSemanticError (var_idf_7783.getter_location (SOURCE_FILE ("goil_syntax.galgas", 271)), var_idf_7783.getter_string (SOURCE_FILE ("goil_syntax.galgas", 271)).add_operation (GALGAS_string (" is not declared in the IMPLEMENTATION"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 271)), fixItArray2  COMMA_SOURCE_FILE ("goil_syntax.galgas", 271)) ;
+    inCompiler->emitSemanticError (var_idf_7783.getter_location (SOURCE_FILE ("goil_syntax.galgas", 325)), var_idf_7783.getter_string (SOURCE_FILE ("goil_syntax.galgas", 325)).add_operation (GALGAS_string (" is not declared in the IMPLEMENTATION"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 325)), fixItArray2  COMMA_SOURCE_FILE ("goil_syntax.galgas", 325)) ;
   }
   switch (select_goil_5F_syntax_7 (inCompiler)) {
   case 1: {
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__3D_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 274)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__3D_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 328)) ;
     switch (select_goil_5F_syntax_8 (inCompiler)) {
     case 1: {
       GALGAS_lstring var_value_8254 ;
       var_value_8254 = inCompiler->synthetizedAttribute_att_5F_token () ;
-      inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_idf COMMA_SOURCE_FILE ("goil_syntax.galgas", 278)) ;
-      GALGAS_implementationObjectMap var_subTypes_8292 = GALGAS_implementationObjectMap::constructor_emptyMap (SOURCE_FILE ("goil_syntax.galgas", 279)) ;
-      GALGAS_objectAttributes var_subAttributes_8369 = function_emptyObject (inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 280)) ;
-      switch (var_type_7871.getter_type (SOURCE_FILE ("goil_syntax.galgas", 281)).enumValue ()) {
+      inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_idf COMMA_SOURCE_FILE ("goil_syntax.galgas", 332)) ;
+      GALGAS_implementationObjectMap var_subTypes_8292 = GALGAS_implementationObjectMap::constructor_emptyMap (SOURCE_FILE ("goil_syntax.galgas", 333)) ;
+      GALGAS_objectAttributes var_subAttributes_8369 = function_emptyObject (inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 334)) ;
+      switch (var_type_7871.getter_type (SOURCE_FILE ("goil_syntax.galgas", 335)).enumValue ()) {
       case GALGAS_dataType::kNotBuilt:
         break ;
       case GALGAS_dataType::kEnum_enumeration:
@@ -8863,14 +8944,14 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_oil_5F_declaration_i9_ (const G
               GALGAS_impEnumType cast_8494_enumType ((cPtr_impEnumType *) var_type_7871.ptr ()) ;
               enumGalgasBool test_3 = kBoolTrue ;
               if (kBoolTrue == test_3) {
-                test_3 = cast_8494_enumType.getter_valuesMap (SOURCE_FILE ("goil_syntax.galgas", 285)).getter_hasKey (var_value_8254.getter_string (SOURCE_FILE ("goil_syntax.galgas", 285)) COMMA_SOURCE_FILE ("goil_syntax.galgas", 285)).boolEnum () ;
+                test_3 = cast_8494_enumType.getter_valuesMap (SOURCE_FILE ("goil_syntax.galgas", 339)).getter_hasKey (var_value_8254.getter_string (SOURCE_FILE ("goil_syntax.galgas", 339)) COMMA_SOURCE_FILE ("goil_syntax.galgas", 339)).boolEnum () ;
                 if (kBoolTrue == test_3) {
-                  cast_8494_enumType.getter_valuesMap (SOURCE_FILE ("goil_syntax.galgas", 286)).method_get (var_value_8254, var_subTypes_8292, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 286)) ;
+                  cast_8494_enumType.getter_valuesMap (SOURCE_FILE ("goil_syntax.galgas", 340)).method_get (var_value_8254, var_subTypes_8292, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 340)) ;
                 }
               }
               if (kBoolFalse == test_3) {
                 TC_Array <C_FixItDescription> fixItArray4 ;
-                inCompiler->emitSemanticError (var_value_8254.getter_location (SOURCE_FILE ("goil_syntax.galgas", 288)), var_value_8254.getter_string (SOURCE_FILE ("goil_syntax.galgas", 288)).add_operation (GALGAS_string (" ENUM value undeclared. One of the following values are expected: "), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 288)).add_operation (function_valueList (cast_8494_enumType.getter_valuesMap (SOURCE_FILE ("goil_syntax.galgas", 288)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 288)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 288)), fixItArray4  COMMA_SOURCE_FILE ("goil_syntax.galgas", 288)) ;
+                inCompiler->emitSemanticError (var_value_8254.getter_location (SOURCE_FILE ("goil_syntax.galgas", 342)), var_value_8254.getter_string (SOURCE_FILE ("goil_syntax.galgas", 342)).add_operation (GALGAS_string (" ENUM value undeclared. One of the following values are expected: "), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 342)).add_operation (function_valueList (cast_8494_enumType.getter_valuesMap (SOURCE_FILE ("goil_syntax.galgas", 342)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 342)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 342)), fixItArray4  COMMA_SOURCE_FILE ("goil_syntax.galgas", 342)) ;
               }
             }
           }
@@ -8895,15 +8976,15 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_oil_5F_declaration_i9_ (const G
       case GALGAS_dataType::kEnum_boolean:
         {
           TC_Array <C_FixItDescription> fixItArray5 ;
-          inCompiler->emitSemanticError (var_idf_7783.getter_location (SOURCE_FILE ("goil_syntax.galgas", 294)), var_idf_7783.getter_string (SOURCE_FILE ("goil_syntax.galgas", 294)).add_operation (GALGAS_string (" is not an ENUM nor and IDENTIFIER nor an object reference"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 294)), fixItArray5  COMMA_SOURCE_FILE ("goil_syntax.galgas", 294)) ;
+          inCompiler->emitSemanticError (var_idf_7783.getter_location (SOURCE_FILE ("goil_syntax.galgas", 348)), var_idf_7783.getter_string (SOURCE_FILE ("goil_syntax.galgas", 348)).add_operation (GALGAS_string (" is not an ENUM nor and IDENTIFIER nor an object reference"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 348)), fixItArray5  COMMA_SOURCE_FILE ("goil_syntax.galgas", 348)) ;
         }
         break ;
       }
       switch (select_goil_5F_syntax_9 (inCompiler)) {
       case 1: {
-        inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 297)) ;
+        inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 351)) ;
         nt_oil_5F_declaration_5F_list_ (var_subTypes_8292, var_subAttributes_8369, inCompiler) ;
-        inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7D_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 299)) ;
+        inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7D_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 353)) ;
       } break ;
       case 2: {
       } break ;
@@ -8914,21 +8995,21 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_oil_5F_declaration_i9_ (const G
       nt_description_ (var_oil_5F_desc_9218, inCompiler) ;
       enumGalgasBool test_6 = kBoolTrue ;
       if (kBoolTrue == test_6) {
-        test_6 = GALGAS_bool (kIsEqual, var_type_7871.getter_type (SOURCE_FILE ("goil_syntax.galgas", 302)).objectCompare (GALGAS_dataType::constructor_enumeration (SOURCE_FILE ("goil_syntax.galgas", 302)))).boolEnum () ;
+        test_6 = GALGAS_bool (kIsEqual, var_type_7871.getter_type (SOURCE_FILE ("goil_syntax.galgas", 356)).objectCompare (GALGAS_dataType::constructor_enumeration (SOURCE_FILE ("goil_syntax.galgas", 356)))).boolEnum () ;
         if (kBoolTrue == test_6) {
-          var_val_7799 = GALGAS_enumAttribute::constructor_new (var_oil_5F_desc_9218, var_value_8254.getter_location (SOURCE_FILE ("goil_syntax.galgas", 303)), var_value_8254.getter_string (SOURCE_FILE ("goil_syntax.galgas", 303)), var_subAttributes_8369  COMMA_SOURCE_FILE ("goil_syntax.galgas", 303)) ;
+          var_val_7799 = GALGAS_enumAttribute::constructor_new (var_oil_5F_desc_9218, var_value_8254.getter_location (SOURCE_FILE ("goil_syntax.galgas", 357)), var_value_8254.getter_string (SOURCE_FILE ("goil_syntax.galgas", 357)), var_subAttributes_8369  COMMA_SOURCE_FILE ("goil_syntax.galgas", 357)) ;
         }
       }
       if (kBoolFalse == test_6) {
         enumGalgasBool test_7 = kBoolTrue ;
         if (kBoolTrue == test_7) {
-          test_7 = GALGAS_bool (kIsEqual, var_type_7871.getter_type (SOURCE_FILE ("goil_syntax.galgas", 304)).objectCompare (GALGAS_dataType::constructor_objectType (SOURCE_FILE ("goil_syntax.galgas", 304)))).boolEnum () ;
+          test_7 = GALGAS_bool (kIsEqual, var_type_7871.getter_type (SOURCE_FILE ("goil_syntax.galgas", 358)).objectCompare (GALGAS_dataType::constructor_objectType (SOURCE_FILE ("goil_syntax.galgas", 358)))).boolEnum () ;
           if (kBoolTrue == test_7) {
-            var_val_7799 = GALGAS_objectRefAttribute::constructor_new (var_oil_5F_desc_9218, var_value_8254.getter_location (SOURCE_FILE ("goil_syntax.galgas", 305)), var_value_8254  COMMA_SOURCE_FILE ("goil_syntax.galgas", 305)) ;
+            var_val_7799 = GALGAS_objectRefAttribute::constructor_new (var_oil_5F_desc_9218, var_value_8254.getter_location (SOURCE_FILE ("goil_syntax.galgas", 359)), var_value_8254  COMMA_SOURCE_FILE ("goil_syntax.galgas", 359)) ;
           }
         }
         if (kBoolFalse == test_7) {
-          var_val_7799 = GALGAS_string_5F_class::constructor_new (var_oil_5F_desc_9218, var_value_8254.getter_location (SOURCE_FILE ("goil_syntax.galgas", 307)), var_value_8254.getter_string (SOURCE_FILE ("goil_syntax.galgas", 307))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 307)) ;
+          var_val_7799 = GALGAS_string_5F_class::constructor_new (var_oil_5F_desc_9218, var_value_8254.getter_location (SOURCE_FILE ("goil_syntax.galgas", 361)), var_value_8254.getter_string (SOURCE_FILE ("goil_syntax.galgas", 361))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 361)) ;
         }
       }
     } break ;
@@ -8939,19 +9020,19 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_oil_5F_declaration_i9_ (const G
       case 1: {
         GALGAS_luint_36__34_ var_value_9724 ;
         var_value_9724 = inCompiler->synthetizedAttribute_integerNumber () ;
-        inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_uint_5F_number COMMA_SOURCE_FILE ("goil_syntax.galgas", 316)) ;
+        inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_uint_5F_number COMMA_SOURCE_FILE ("goil_syntax.galgas", 370)) ;
         GALGAS_lstring var_oil_5F_desc_9798 ;
         nt_description_ (var_oil_5F_desc_9798, inCompiler) ;
-        var_val_7799 = function_checkAndGetIntegerNumber (var_oil_5F_desc_9798, var_type_7871.getter_type (SOURCE_FILE ("goil_syntax.galgas", 318)), var_value_9724, var_sign_9646, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 318)) ;
+        var_val_7799 = function_checkAndGetIntegerNumber (var_oil_5F_desc_9798, var_type_7871.getter_type (SOURCE_FILE ("goil_syntax.galgas", 372)), var_value_9724, var_sign_9646, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 372)) ;
         if (var_type_7871.isValid ()) {
           if (var_type_7871.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_impRangedType) {
             GALGAS_impRangedType cast_9934_rangedType ((cPtr_impRangedType *) var_type_7871.ptr ()) ;
             enumGalgasBool test_8 = kBoolTrue ;
             if (kBoolTrue == test_8) {
-              test_8 = callExtensionGetter_contains ((const cPtr_attributeRange *) cast_9934_rangedType.getter_setOrRange (SOURCE_FILE ("goil_syntax.galgas", 321)).ptr (), var_val_7799, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 321)).operator_not (SOURCE_FILE ("goil_syntax.galgas", 321)).boolEnum () ;
+              test_8 = callExtensionGetter_contains ((const cPtr_attributeRange *) cast_9934_rangedType.getter_setOrRange (SOURCE_FILE ("goil_syntax.galgas", 375)).ptr (), var_val_7799, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 375)).operator_not (SOURCE_FILE ("goil_syntax.galgas", 375)).boolEnum () ;
               if (kBoolTrue == test_8) {
                 TC_Array <C_FixItDescription> fixItArray9 ;
-                inCompiler->emitSemanticError (var_value_9724.getter_location (SOURCE_FILE ("goil_syntax.galgas", 322)), GALGAS_string ("Integer out or range. Allowed values are: ").add_operation (callExtensionGetter_string ((const cPtr_attributeRange *) cast_9934_rangedType.getter_setOrRange (SOURCE_FILE ("goil_syntax.galgas", 322)).ptr (), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 322)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 322)), fixItArray9  COMMA_SOURCE_FILE ("goil_syntax.galgas", 322)) ;
+                inCompiler->emitSemanticError (var_value_9724.getter_location (SOURCE_FILE ("goil_syntax.galgas", 376)), GALGAS_string ("Integer out or range. Allowed values are: ").add_operation (callExtensionGetter_string ((const cPtr_attributeRange *) cast_9934_rangedType.getter_setOrRange (SOURCE_FILE ("goil_syntax.galgas", 376)).ptr (), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 376)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 376)), fixItArray9  COMMA_SOURCE_FILE ("goil_syntax.galgas", 376)) ;
               }
             }
           }
@@ -8960,19 +9041,19 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_oil_5F_declaration_i9_ (const G
       case 2: {
         GALGAS_ldouble var_value_10189 ;
         var_value_10189 = inCompiler->synthetizedAttribute_floatNumber () ;
-        inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_float_5F_number COMMA_SOURCE_FILE ("goil_syntax.galgas", 328)) ;
+        inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_float_5F_number COMMA_SOURCE_FILE ("goil_syntax.galgas", 382)) ;
         GALGAS_lstring var_oil_5F_desc_10264 ;
         nt_description_ (var_oil_5F_desc_10264, inCompiler) ;
-        var_val_7799 = function_checkAndGetFloatNumber (var_oil_5F_desc_10264, var_type_7871.getter_type (SOURCE_FILE ("goil_syntax.galgas", 330)), var_value_10189, var_sign_9646, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 330)) ;
+        var_val_7799 = function_checkAndGetFloatNumber (var_oil_5F_desc_10264, var_type_7871.getter_type (SOURCE_FILE ("goil_syntax.galgas", 384)), var_value_10189, var_sign_9646, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 384)) ;
         if (var_type_7871.isValid ()) {
           if (var_type_7871.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_impRangedType) {
             GALGAS_impRangedType cast_10398_rangedType ((cPtr_impRangedType *) var_type_7871.ptr ()) ;
             enumGalgasBool test_10 = kBoolTrue ;
             if (kBoolTrue == test_10) {
-              test_10 = callExtensionGetter_contains ((const cPtr_attributeRange *) cast_10398_rangedType.getter_setOrRange (SOURCE_FILE ("goil_syntax.galgas", 333)).ptr (), var_val_7799, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 333)).operator_not (SOURCE_FILE ("goil_syntax.galgas", 333)).boolEnum () ;
+              test_10 = callExtensionGetter_contains ((const cPtr_attributeRange *) cast_10398_rangedType.getter_setOrRange (SOURCE_FILE ("goil_syntax.galgas", 387)).ptr (), var_val_7799, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 387)).operator_not (SOURCE_FILE ("goil_syntax.galgas", 387)).boolEnum () ;
               if (kBoolTrue == test_10) {
                 TC_Array <C_FixItDescription> fixItArray11 ;
-                inCompiler->emitSemanticError (var_value_10189.getter_location (SOURCE_FILE ("goil_syntax.galgas", 334)), GALGAS_string ("Float out or range. Allowed values are: ").add_operation (callExtensionGetter_string ((const cPtr_attributeRange *) cast_10398_rangedType.getter_setOrRange (SOURCE_FILE ("goil_syntax.galgas", 334)).ptr (), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 334)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 334)), fixItArray11  COMMA_SOURCE_FILE ("goil_syntax.galgas", 334)) ;
+                inCompiler->emitSemanticError (var_value_10189.getter_location (SOURCE_FILE ("goil_syntax.galgas", 388)), GALGAS_string ("Float out or range. Allowed values are: ").add_operation (callExtensionGetter_string ((const cPtr_attributeRange *) cast_10398_rangedType.getter_setOrRange (SOURCE_FILE ("goil_syntax.galgas", 388)).ptr (), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 388)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 388)), fixItArray11  COMMA_SOURCE_FILE ("goil_syntax.galgas", 388)) ;
               }
             }
           }
@@ -8985,14 +9066,14 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_oil_5F_declaration_i9_ (const G
     case 3: {
       GALGAS_lbool var_value_10652 ;
       nt_boolean_ (var_value_10652, inCompiler) ;
-      GALGAS_implementationObjectMap var_subTypes_10694 = GALGAS_implementationObjectMap::constructor_emptyMap (SOURCE_FILE ("goil_syntax.galgas", 342)) ;
-      GALGAS_objectAttributes var_subAttributes_10769 = function_emptyObject (inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 343)) ;
+      GALGAS_implementationObjectMap var_subTypes_10694 = GALGAS_implementationObjectMap::constructor_emptyMap (SOURCE_FILE ("goil_syntax.galgas", 396)) ;
+      GALGAS_objectAttributes var_subAttributes_10769 = function_emptyObject (inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 397)) ;
       enumGalgasBool test_12 = kBoolTrue ;
       if (kBoolTrue == test_12) {
-        test_12 = GALGAS_bool (kIsNotEqual, var_type_7871.getter_type (SOURCE_FILE ("goil_syntax.galgas", 344)).objectCompare (GALGAS_dataType::constructor_boolean (SOURCE_FILE ("goil_syntax.galgas", 344)))).boolEnum () ;
+        test_12 = GALGAS_bool (kIsNotEqual, var_type_7871.getter_type (SOURCE_FILE ("goil_syntax.galgas", 398)).objectCompare (GALGAS_dataType::constructor_boolean (SOURCE_FILE ("goil_syntax.galgas", 398)))).boolEnum () ;
         if (kBoolTrue == test_12) {
           TC_Array <C_FixItDescription> fixItArray13 ;
-          inCompiler->emitSemanticError (var_idf_7783.getter_location (SOURCE_FILE ("goil_syntax.galgas", 345)), extensionGetter_oilType (var_type_7871.getter_type (SOURCE_FILE ("goil_syntax.galgas", 345)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 345)).add_operation (GALGAS_string (" expected, got a BOOLEAN"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 345)), fixItArray13  COMMA_SOURCE_FILE ("goil_syntax.galgas", 345)) ;
+          inCompiler->emitSemanticError (var_idf_7783.getter_location (SOURCE_FILE ("goil_syntax.galgas", 399)), extensionGetter_oilType (var_type_7871.getter_type (SOURCE_FILE ("goil_syntax.galgas", 399)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 399)).add_operation (GALGAS_string (" expected, got a BOOLEAN"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 399)), fixItArray13  COMMA_SOURCE_FILE ("goil_syntax.galgas", 399)) ;
         }
       }
       if (kBoolFalse == test_12) {
@@ -9001,30 +9082,30 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_oil_5F_declaration_i9_ (const G
             GALGAS_impBoolType cast_10972_boolType ((cPtr_impBoolType *) var_type_7871.ptr ()) ;
             enumGalgasBool test_14 = kBoolTrue ;
             if (kBoolTrue == test_14) {
-              test_14 = var_value_10652.getter_bool (SOURCE_FILE ("goil_syntax.galgas", 349)).boolEnum () ;
+              test_14 = var_value_10652.getter_bool (SOURCE_FILE ("goil_syntax.galgas", 403)).boolEnum () ;
               if (kBoolTrue == test_14) {
-                var_subTypes_10694 = cast_10972_boolType.getter_trueSubAttributes (SOURCE_FILE ("goil_syntax.galgas", 350)) ;
+                var_subTypes_10694 = cast_10972_boolType.getter_trueSubAttributes (SOURCE_FILE ("goil_syntax.galgas", 404)) ;
               }
             }
             if (kBoolFalse == test_14) {
-              var_subTypes_10694 = cast_10972_boolType.getter_falseSubAttributes (SOURCE_FILE ("goil_syntax.galgas", 352)) ;
+              var_subTypes_10694 = cast_10972_boolType.getter_falseSubAttributes (SOURCE_FILE ("goil_syntax.galgas", 406)) ;
             }
           }
         }
       }
       switch (select_goil_5F_syntax_11 (inCompiler)) {
       case 1: {
-        inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 357)) ;
+        inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 411)) ;
         enumGalgasBool test_15 = kBoolTrue ;
         if (kBoolTrue == test_15) {
-          test_15 = GALGAS_bool (kIsEqual, var_subTypes_10694.getter_count (SOURCE_FILE ("goil_syntax.galgas", 358)).objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
+          test_15 = GALGAS_bool (kIsEqual, var_subTypes_10694.getter_count (SOURCE_FILE ("goil_syntax.galgas", 412)).objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
           if (kBoolTrue == test_15) {
             TC_Array <C_FixItDescription> fixItArray16 ;
-            inCompiler->emitSemanticError (var_value_10652.getter_location (SOURCE_FILE ("goil_syntax.galgas", 359)), function_stringLBool (var_value_10652, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 359)).add_operation (GALGAS_string (" value of "), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 359)).add_operation (var_idf_7783.getter_string (SOURCE_FILE ("goil_syntax.galgas", 359)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 359)).add_operation (GALGAS_string (" has no sub-attribute"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 359)), fixItArray16  COMMA_SOURCE_FILE ("goil_syntax.galgas", 359)) ;
+            inCompiler->emitSemanticError (var_value_10652.getter_location (SOURCE_FILE ("goil_syntax.galgas", 413)), function_stringLBool (var_value_10652, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 413)).add_operation (GALGAS_string (" value of "), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 413)).add_operation (var_idf_7783.getter_string (SOURCE_FILE ("goil_syntax.galgas", 413)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 413)).add_operation (GALGAS_string (" has no sub-attribute"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 413)), fixItArray16  COMMA_SOURCE_FILE ("goil_syntax.galgas", 413)) ;
           }
         }
         nt_oil_5F_declaration_5F_list_ (var_subTypes_10694, var_subAttributes_10769, inCompiler) ;
-        inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7D_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 362)) ;
+        inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7D_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 416)) ;
       } break ;
       case 2: {
       } break ;
@@ -9033,30 +9114,30 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_oil_5F_declaration_i9_ (const G
       }
       GALGAS_lstring var_oil_5F_desc_11470 ;
       nt_description_ (var_oil_5F_desc_11470, inCompiler) ;
-      var_val_7799 = GALGAS_boolAttribute::constructor_new (var_oil_5F_desc_11470, var_idf_7783.getter_location (SOURCE_FILE ("goil_syntax.galgas", 365)), var_value_10652.getter_bool (SOURCE_FILE ("goil_syntax.galgas", 365)), var_subAttributes_10769  COMMA_SOURCE_FILE ("goil_syntax.galgas", 365)) ;
+      var_val_7799 = GALGAS_boolAttribute::constructor_new (var_oil_5F_desc_11470, var_idf_7783.getter_location (SOURCE_FILE ("goil_syntax.galgas", 419)), var_value_10652.getter_bool (SOURCE_FILE ("goil_syntax.galgas", 419)), var_subAttributes_10769  COMMA_SOURCE_FILE ("goil_syntax.galgas", 419)) ;
     } break ;
     case 4: {
       GALGAS_lstring var_literalString_11619 ;
       var_literalString_11619 = inCompiler->synthetizedAttribute_a_5F_string () ;
-      inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 369)) ;
+      inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 423)) ;
       GALGAS_lstring var_oil_5F_desc_11692 ;
       nt_description_ (var_oil_5F_desc_11692, inCompiler) ;
-      var_val_7799 = GALGAS_stringAttribute::constructor_new (var_oil_5F_desc_11692, var_literalString_11619.getter_location (SOURCE_FILE ("goil_syntax.galgas", 371)), var_literalString_11619.getter_string (SOURCE_FILE ("goil_syntax.galgas", 371))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 371)) ;
+      var_val_7799 = GALGAS_stringAttribute::constructor_new (var_oil_5F_desc_11692, var_literalString_11619.getter_location (SOURCE_FILE ("goil_syntax.galgas", 425)), var_literalString_11619.getter_string (SOURCE_FILE ("goil_syntax.galgas", 425))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 425)) ;
     } break ;
     case 5: {
-      inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_AUTO COMMA_SOURCE_FILE ("goil_syntax.galgas", 374)) ;
+      inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_AUTO COMMA_SOURCE_FILE ("goil_syntax.galgas", 428)) ;
       GALGAS_lstring var_oil_5F_desc_11865 ;
       nt_description_ (var_oil_5F_desc_11865, inCompiler) ;
       enumGalgasBool test_17 = kBoolTrue ;
       if (kBoolTrue == test_17) {
-        test_17 = callExtensionGetter_autoAllowed ((const cPtr_impType *) var_type_7871.ptr (), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 377)).boolEnum () ;
+        test_17 = callExtensionGetter_autoAllowed ((const cPtr_impType *) var_type_7871.ptr (), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 431)).boolEnum () ;
         if (kBoolTrue == test_17) {
-          var_val_7799 = GALGAS_auto::constructor_new (var_oil_5F_desc_11865, GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 378))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 378)) ;
+          var_val_7799 = GALGAS_auto::constructor_new (var_oil_5F_desc_11865, GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 432))  COMMA_SOURCE_FILE ("goil_syntax.galgas", 432)) ;
         }
       }
       if (kBoolFalse == test_17) {
         TC_Array <C_FixItDescription> fixItArray18 ;
-        inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 393)), GALGAS_string ("AUTO is not allowed"), fixItArray18  COMMA_SOURCE_FILE ("goil_syntax.galgas", 393)) ;
+        inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 447)), GALGAS_string ("AUTO is not allowed"), fixItArray18  COMMA_SOURCE_FILE ("goil_syntax.galgas", 447)) ;
         var_val_7799.drop () ; // Release error dropped variable
       }
     } break ;
@@ -9066,86 +9147,86 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_oil_5F_declaration_i9_ (const G
   } break ;
   case 2: {
     GALGAS_lstring var_name_12696 = inCompiler->synthetizedAttribute_att_5F_token () ;
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_idf COMMA_SOURCE_FILE ("goil_syntax.galgas", 397)) ;
-    GALGAS_implementationObjectMap var_subTypes_12713 = GALGAS_implementationObjectMap::constructor_emptyMap (SOURCE_FILE ("goil_syntax.galgas", 398)) ;
-    GALGAS_objectAttributes var_subAttributes_12786 = function_emptyObject (inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 399)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_idf COMMA_SOURCE_FILE ("goil_syntax.galgas", 451)) ;
+    GALGAS_implementationObjectMap var_subTypes_12713 = GALGAS_implementationObjectMap::constructor_emptyMap (SOURCE_FILE ("goil_syntax.galgas", 452)) ;
+    GALGAS_objectAttributes var_subAttributes_12786 = function_emptyObject (inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 453)) ;
     enumGalgasBool test_19 = kBoolTrue ;
     if (kBoolTrue == test_19) {
-      test_19 = GALGAS_bool (kIsNotEqual, var_type_7871.getter_type (SOURCE_FILE ("goil_syntax.galgas", 401)).objectCompare (GALGAS_dataType::constructor_structType (SOURCE_FILE ("goil_syntax.galgas", 401)))).boolEnum () ;
+      test_19 = GALGAS_bool (kIsNotEqual, var_type_7871.getter_type (SOURCE_FILE ("goil_syntax.galgas", 455)).objectCompare (GALGAS_dataType::constructor_structType (SOURCE_FILE ("goil_syntax.galgas", 455)))).boolEnum () ;
       if (kBoolTrue == test_19) {
         TC_Array <C_FixItDescription> fixItArray20 ;
-        inCompiler->emitSemanticError (var_idf_7783.getter_location (SOURCE_FILE ("goil_syntax.galgas", 402)), extensionGetter_oilType (var_type_7871.getter_type (SOURCE_FILE ("goil_syntax.galgas", 402)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 402)).add_operation (GALGAS_string (" expected, got a STRUCT"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 402)), fixItArray20  COMMA_SOURCE_FILE ("goil_syntax.galgas", 402)) ;
+        inCompiler->emitSemanticError (var_idf_7783.getter_location (SOURCE_FILE ("goil_syntax.galgas", 456)), extensionGetter_oilType (var_type_7871.getter_type (SOURCE_FILE ("goil_syntax.galgas", 456)), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 456)).add_operation (GALGAS_string (" expected, got a STRUCT"), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 456)), fixItArray20  COMMA_SOURCE_FILE ("goil_syntax.galgas", 456)) ;
       }
     }
     if (kBoolFalse == test_19) {
       if (var_type_7871.isValid ()) {
         if (var_type_7871.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_impStructType) {
           GALGAS_impStructType cast_12998_structType ((cPtr_impStructType *) var_type_7871.ptr ()) ;
-          var_subTypes_12713 = cast_12998_structType.getter_structAttributes (SOURCE_FILE ("goil_syntax.galgas", 406)) ;
+          var_subTypes_12713 = cast_12998_structType.getter_structAttributes (SOURCE_FILE ("goil_syntax.galgas", 460)) ;
         }
       }
     }
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 409)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 463)) ;
     nt_oil_5F_declaration_5F_list_ (var_subTypes_12713, var_subAttributes_12786, inCompiler) ;
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7D_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 411)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7D_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 465)) ;
     GALGAS_lstring var_oil_5F_desc_13190 ;
     nt_description_ (var_oil_5F_desc_13190, inCompiler) ;
-    var_val_7799 = GALGAS_structAttribute::constructor_new (var_oil_5F_desc_13190, GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 413)), var_name_12696, var_subAttributes_12786  COMMA_SOURCE_FILE ("goil_syntax.galgas", 413)) ;
+    var_val_7799 = GALGAS_structAttribute::constructor_new (var_oil_5F_desc_13190, GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 467)), var_name_12696, var_subAttributes_12786  COMMA_SOURCE_FILE ("goil_syntax.galgas", 467)) ;
   } break ;
   default:
     break ;
   }
-  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__3B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 415)) ;
-  GALGAS_identifierMap var_idfs_13334 = ioArgument_identifiers.getter_objectParams (SOURCE_FILE ("goil_syntax.galgas", 418)) ;
+  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__3B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 469)) ;
+  GALGAS_identifierMap var_idfs_13334 = ioArgument_identifiers.getter_objectParams (SOURCE_FILE ("goil_syntax.galgas", 472)) ;
   enumGalgasBool test_21 = kBoolTrue ;
   if (kBoolTrue == test_21) {
-    test_21 = var_type_7871.getter_multiple (SOURCE_FILE ("goil_syntax.galgas", 419)).boolEnum () ;
+    test_21 = var_type_7871.getter_multiple (SOURCE_FILE ("goil_syntax.galgas", 473)).boolEnum () ;
     if (kBoolTrue == test_21) {
       enumGalgasBool test_22 = kBoolTrue ;
       if (kBoolTrue == test_22) {
-        test_22 = var_idfs_13334.getter_hasKey (var_idf_7783.getter_string (SOURCE_FILE ("goil_syntax.galgas", 420)) COMMA_SOURCE_FILE ("goil_syntax.galgas", 420)).boolEnum () ;
+        test_22 = var_idfs_13334.getter_hasKey (var_idf_7783.getter_string (SOURCE_FILE ("goil_syntax.galgas", 474)) COMMA_SOURCE_FILE ("goil_syntax.galgas", 474)).boolEnum () ;
         if (kBoolTrue == test_22) {
           GALGAS_object_5F_t var_attributeList_13458 ;
           {
-          var_idfs_13334.setter_del (var_idf_7783, var_attributeList_13458, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 424)) ;
+          var_idfs_13334.setter_del (var_idf_7783, var_attributeList_13458, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 478)) ;
           }
           if (var_attributeList_13458.isValid ()) {
             if (var_attributeList_13458.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_multipleAttribute) {
               GALGAS_multipleAttribute cast_13652_multiAttribute ((cPtr_multipleAttribute *) var_attributeList_13458.ptr ()) ;
-              GALGAS_identifierList var_aList_13684 = cast_13652_multiAttribute.getter_items (SOURCE_FILE ("goil_syntax.galgas", 427)) ;
-              var_aList_13684.addAssign_operation (var_val_7799  COMMA_SOURCE_FILE ("goil_syntax.galgas", 428)) ;
-              var_val_7799 = GALGAS_multipleAttribute::constructor_new (function_emptyLString (inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 429)), cast_13652_multiAttribute.getter_location (SOURCE_FILE ("goil_syntax.galgas", 429)), var_aList_13684  COMMA_SOURCE_FILE ("goil_syntax.galgas", 429)) ;
+              GALGAS_identifierList var_aList_13684 = cast_13652_multiAttribute.getter_items (SOURCE_FILE ("goil_syntax.galgas", 481)) ;
+              var_aList_13684.addAssign_operation (var_val_7799  COMMA_SOURCE_FILE ("goil_syntax.galgas", 482)) ;
+              var_val_7799 = GALGAS_multipleAttribute::constructor_new (function_emptyLString (inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 483)), cast_13652_multiAttribute.getter_location (SOURCE_FILE ("goil_syntax.galgas", 483)), var_aList_13684  COMMA_SOURCE_FILE ("goil_syntax.galgas", 483)) ;
             }
           }
         }
       }
       if (kBoolFalse == test_22) {
-        GALGAS_identifierList var_aList_13874 = GALGAS_identifierList::constructor_emptyList (SOURCE_FILE ("goil_syntax.galgas", 432)) ;
-        GALGAS_object_5F_t var_defaultValue_13953 = callExtensionGetter_getDefaultValue ((const cPtr_impType *) var_type_7871.ptr (), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 434)) ;
+        GALGAS_identifierList var_aList_13874 = GALGAS_identifierList::constructor_emptyList (SOURCE_FILE ("goil_syntax.galgas", 486)) ;
+        GALGAS_object_5F_t var_defaultValue_13953 = callExtensionGetter_getDefaultValue ((const cPtr_impType *) var_type_7871.ptr (), inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 488)) ;
         if (var_defaultValue_13953.isValid ()) {
           if (var_defaultValue_13953.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_multipleAttribute) {
             GALGAS_multipleAttribute cast_14082_multiAttribute ((cPtr_multipleAttribute *) var_defaultValue_13953.ptr ()) ;
-            var_aList_13874 = cast_14082_multiAttribute.getter_items (SOURCE_FILE ("goil_syntax.galgas", 439)) ;
+            var_aList_13874 = cast_14082_multiAttribute.getter_items (SOURCE_FILE ("goil_syntax.galgas", 493)) ;
           }
         }
-        var_aList_13874.addAssign_operation (var_val_7799  COMMA_SOURCE_FILE ("goil_syntax.galgas", 444)) ;
-        var_val_7799 = GALGAS_multipleAttribute::constructor_new (function_emptyLString (inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 446)), var_val_7799.getter_location (SOURCE_FILE ("goil_syntax.galgas", 446)), var_aList_13874  COMMA_SOURCE_FILE ("goil_syntax.galgas", 446)) ;
+        var_aList_13874.addAssign_operation (var_val_7799  COMMA_SOURCE_FILE ("goil_syntax.galgas", 498)) ;
+        var_val_7799 = GALGAS_multipleAttribute::constructor_new (function_emptyLString (inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 500)), var_val_7799.getter_location (SOURCE_FILE ("goil_syntax.galgas", 500)), var_aList_13874  COMMA_SOURCE_FILE ("goil_syntax.galgas", 500)) ;
       }
     }
   }
   if (kBoolFalse == test_21) {
     enumGalgasBool test_23 = kBoolTrue ;
     if (kBoolTrue == test_23) {
-      test_23 = var_idfs_13334.getter_hasKey (var_idf_7783.getter_string (SOURCE_FILE ("goil_syntax.galgas", 449)) COMMA_SOURCE_FILE ("goil_syntax.galgas", 449)).boolEnum () ;
+      test_23 = var_idfs_13334.getter_hasKey (var_idf_7783.getter_string (SOURCE_FILE ("goil_syntax.galgas", 503)) COMMA_SOURCE_FILE ("goil_syntax.galgas", 503)).boolEnum () ;
       if (kBoolTrue == test_23) {
         GALGAS_object_5F_t var_existingObject_14558 ;
         {
-        var_idfs_13334.setter_del (var_idf_7783, var_existingObject_14558, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 453)) ;
+        var_idfs_13334.setter_del (var_idf_7783, var_existingObject_14558, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 507)) ;
         }
         {
         var_val_7799.insulate (HERE) ;
         cPtr_object_5F_t * ptr_14611 = (cPtr_object_5F_t *) var_val_7799.ptr () ;
-        callExtensionSetter_mergeSubAttributes ((cPtr_object_5F_t *) ptr_14611, var_existingObject_14558, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 454)) ;
+        callExtensionSetter_mergeSubAttributes ((cPtr_object_5F_t *) ptr_14611, var_existingObject_14558, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 508)) ;
         }
       }
     }
@@ -9155,30 +9236,30 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_oil_5F_declaration_i9_ (const G
     test_24 = var_typeOk_7970.boolEnum () ;
     if (kBoolTrue == test_24) {
       {
-      var_idfs_13334.setter_put (var_idf_7783, var_val_7799, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 458)) ;
+      var_idfs_13334.setter_put (var_idf_7783, var_val_7799, inCompiler COMMA_SOURCE_FILE ("goil_syntax.galgas", 512)) ;
       }
     }
   }
   {
-  ioArgument_identifiers.setter_setObjectParams (var_idfs_13334 COMMA_SOURCE_FILE ("goil_syntax.galgas", 460)) ;
+  ioArgument_identifiers.setter_setObjectParams (var_idfs_13334 COMMA_SOURCE_FILE ("goil_syntax.galgas", 514)) ;
   }
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
 
 void cParser_goil_5F_syntax::rule_goil_5F_syntax_oil_5F_declaration_i9_parse (C_Lexique_goil_5F_lexique * inCompiler) {
-  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_idf COMMA_SOURCE_FILE ("goil_syntax.galgas", 261)) ;
+  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_idf COMMA_SOURCE_FILE ("goil_syntax.galgas", 315)) ;
   switch (select_goil_5F_syntax_7 (inCompiler)) {
   case 1: {
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__3D_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 274)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__3D_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 328)) ;
     switch (select_goil_5F_syntax_8 (inCompiler)) {
     case 1: {
-      inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_idf COMMA_SOURCE_FILE ("goil_syntax.galgas", 278)) ;
+      inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_idf COMMA_SOURCE_FILE ("goil_syntax.galgas", 332)) ;
       switch (select_goil_5F_syntax_9 (inCompiler)) {
       case 1: {
-        inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 297)) ;
+        inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 351)) ;
         nt_oil_5F_declaration_5F_list_parse (inCompiler) ;
-        inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7D_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 299)) ;
+        inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7D_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 353)) ;
       } break ;
       case 2: {
       } break ;
@@ -9191,11 +9272,11 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_oil_5F_declaration_i9_parse (C_
       nt_sign_parse (inCompiler) ;
       switch (select_goil_5F_syntax_10 (inCompiler)) {
       case 1: {
-        inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_uint_5F_number COMMA_SOURCE_FILE ("goil_syntax.galgas", 316)) ;
+        inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_uint_5F_number COMMA_SOURCE_FILE ("goil_syntax.galgas", 370)) ;
         nt_description_parse (inCompiler) ;
       } break ;
       case 2: {
-        inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_float_5F_number COMMA_SOURCE_FILE ("goil_syntax.galgas", 328)) ;
+        inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_float_5F_number COMMA_SOURCE_FILE ("goil_syntax.galgas", 382)) ;
         nt_description_parse (inCompiler) ;
       } break ;
       default:
@@ -9206,9 +9287,9 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_oil_5F_declaration_i9_parse (C_
       nt_boolean_parse (inCompiler) ;
       switch (select_goil_5F_syntax_11 (inCompiler)) {
       case 1: {
-        inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 357)) ;
+        inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 411)) ;
         nt_oil_5F_declaration_5F_list_parse (inCompiler) ;
-        inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7D_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 362)) ;
+        inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7D_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 416)) ;
       } break ;
       case 2: {
       } break ;
@@ -9218,11 +9299,11 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_oil_5F_declaration_i9_parse (C_
       nt_description_parse (inCompiler) ;
     } break ;
     case 4: {
-      inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 369)) ;
+      inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 423)) ;
       nt_description_parse (inCompiler) ;
     } break ;
     case 5: {
-      inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_AUTO COMMA_SOURCE_FILE ("goil_syntax.galgas", 374)) ;
+      inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_AUTO COMMA_SOURCE_FILE ("goil_syntax.galgas", 428)) ;
       nt_description_parse (inCompiler) ;
     } break ;
     default:
@@ -9230,16 +9311,16 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_oil_5F_declaration_i9_parse (C_
     }
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_idf COMMA_SOURCE_FILE ("goil_syntax.galgas", 397)) ;
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 409)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_idf COMMA_SOURCE_FILE ("goil_syntax.galgas", 451)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 463)) ;
     nt_oil_5F_declaration_5F_list_parse (inCompiler) ;
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7D_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 411)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7D_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 465)) ;
     nt_description_parse (inCompiler) ;
   } break ;
   default:
     break ;
   }
-  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__3B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 415)) ;
+  inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__3B_ COMMA_SOURCE_FILE ("goil_syntax.galgas", 469)) ;
   inCompiler->resetTemplateString () ;
 }
 
@@ -9253,10 +9334,10 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_include_5F_file_5F_level_i10_ (
   GALGAS_bool var_includeIfExists_14926 = GALGAS_bool (false) ;
   switch (select_goil_5F_syntax_12 (inCompiler)) {
   case 1: {
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_include COMMA_SOURCE_FILE ("goil_syntax.galgas", 471)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_include COMMA_SOURCE_FILE ("goil_syntax.galgas", 525)) ;
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_includeifexists COMMA_SOURCE_FILE ("goil_syntax.galgas", 473)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_includeifexists COMMA_SOURCE_FILE ("goil_syntax.galgas", 527)) ;
     var_includeIfExists_14926 = GALGAS_bool (true) ;
   } break ;
   default:
@@ -9266,31 +9347,31 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_include_5F_file_5F_level_i10_ (
   switch (select_goil_5F_syntax_13 (inCompiler)) {
   case 1: {
     var_file_5F_name_15034 = inCompiler->synthetizedAttribute_a_5F_string () ;
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_g_5F_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 477)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_g_5F_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 531)) ;
     {
-    routine_file_5F_in_5F_path (var_file_5F_name_15034, inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 478)) ;
+    routine_file_5F_in_5F_path (var_file_5F_name_15034, inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 532)) ;
     }
   } break ;
   case 2: {
     var_file_5F_name_15034 = inCompiler->synthetizedAttribute_a_5F_string () ;
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 480)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 534)) ;
   } break ;
   default:
     break ;
   }
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    GALGAS_bool test_1 = var_includeIfExists_14926.operator_not (SOURCE_FILE ("goil_syntax.galgas", 482)) ;
+    GALGAS_bool test_1 = var_includeIfExists_14926.operator_not (SOURCE_FILE ("goil_syntax.galgas", 536)) ;
     if (kBoolTrue != test_1.boolEnum ()) {
       GALGAS_bool test_2 = var_includeIfExists_14926 ;
       if (kBoolTrue == test_2.boolEnum ()) {
-        test_2 = var_file_5F_name_15034.getter_string (HERE).getter_fileExists (SOURCE_FILE ("goil_syntax.galgas", 482)) ;
+        test_2 = var_file_5F_name_15034.getter_string (HERE).getter_fileExists (SOURCE_FILE ("goil_syntax.galgas", 536)) ;
       }
       test_1 = test_2 ;
     }
     test_0 = test_1.boolEnum () ;
     if (kBoolTrue == test_0) {
-      cGrammar_goil_5F_file_5F_level_5F_include::_performSourceFileParsing_ (inCompiler, var_file_5F_name_15034, ioArgument_imp, ioArgument_application, ioArgument_fileIncludeList, constinArgument_rootFile  COMMA_SOURCE_FILE ("goil_syntax.galgas", 483)) ;
+      cGrammar_goil_5F_file_5F_level_5F_include::_performSourceFileParsing_ (inCompiler, var_file_5F_name_15034, ioArgument_imp, ioArgument_application, ioArgument_fileIncludeList, constinArgument_rootFile  COMMA_SOURCE_FILE ("goil_syntax.galgas", 537)) ;
     }
   }
 }
@@ -9300,20 +9381,20 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_include_5F_file_5F_level_i10_ (
 void cParser_goil_5F_syntax::rule_goil_5F_syntax_include_5F_file_5F_level_i10_parse (C_Lexique_goil_5F_lexique * inCompiler) {
   switch (select_goil_5F_syntax_12 (inCompiler)) {
   case 1: {
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_include COMMA_SOURCE_FILE ("goil_syntax.galgas", 471)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_include COMMA_SOURCE_FILE ("goil_syntax.galgas", 525)) ;
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_includeifexists COMMA_SOURCE_FILE ("goil_syntax.galgas", 473)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_includeifexists COMMA_SOURCE_FILE ("goil_syntax.galgas", 527)) ;
   } break ;
   default:
     break ;
   }
   switch (select_goil_5F_syntax_13 (inCompiler)) {
   case 1: {
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_g_5F_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 477)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_g_5F_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 531)) ;
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 480)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 534)) ;
   } break ;
   default:
     break ;
@@ -9331,10 +9412,10 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_include_5F_cpu_5F_level_i11_ (c
   GALGAS_bool var_includeIfExists_15473 = GALGAS_bool (false) ;
   switch (select_goil_5F_syntax_14 (inCompiler)) {
   case 1: {
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_include COMMA_SOURCE_FILE ("goil_syntax.galgas", 495)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_include COMMA_SOURCE_FILE ("goil_syntax.galgas", 549)) ;
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_includeifexists COMMA_SOURCE_FILE ("goil_syntax.galgas", 497)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_includeifexists COMMA_SOURCE_FILE ("goil_syntax.galgas", 551)) ;
     var_includeIfExists_15473 = GALGAS_bool (true) ;
   } break ;
   default:
@@ -9344,31 +9425,31 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_include_5F_cpu_5F_level_i11_ (c
   switch (select_goil_5F_syntax_15 (inCompiler)) {
   case 1: {
     var_file_5F_name_15581 = inCompiler->synthetizedAttribute_a_5F_string () ;
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_g_5F_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 501)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_g_5F_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 555)) ;
     {
-    routine_file_5F_in_5F_path (var_file_5F_name_15581, inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 502)) ;
+    routine_file_5F_in_5F_path (var_file_5F_name_15581, inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 556)) ;
     }
   } break ;
   case 2: {
     var_file_5F_name_15581 = inCompiler->synthetizedAttribute_a_5F_string () ;
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 504)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 558)) ;
   } break ;
   default:
     break ;
   }
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    GALGAS_bool test_1 = var_includeIfExists_15473.operator_not (SOURCE_FILE ("goil_syntax.galgas", 506)) ;
+    GALGAS_bool test_1 = var_includeIfExists_15473.operator_not (SOURCE_FILE ("goil_syntax.galgas", 560)) ;
     if (kBoolTrue != test_1.boolEnum ()) {
       GALGAS_bool test_2 = var_includeIfExists_15473 ;
       if (kBoolTrue == test_2.boolEnum ()) {
-        test_2 = var_file_5F_name_15581.getter_string (HERE).getter_fileExists (SOURCE_FILE ("goil_syntax.galgas", 506)) ;
+        test_2 = var_file_5F_name_15581.getter_string (HERE).getter_fileExists (SOURCE_FILE ("goil_syntax.galgas", 560)) ;
       }
       test_1 = test_2 ;
     }
     test_0 = test_1.boolEnum () ;
     if (kBoolTrue == test_0) {
-      cGrammar_goil_5F_cpu_5F_level_5F_include::_performSourceFileParsing_ (inCompiler, var_file_5F_name_15581, constinArgument_imp, ioArgument_objects, ioArgument_fileIncludeList, constinArgument_rootFile  COMMA_SOURCE_FILE ("goil_syntax.galgas", 507)) ;
+      cGrammar_goil_5F_cpu_5F_level_5F_include::_performSourceFileParsing_ (inCompiler, var_file_5F_name_15581, constinArgument_imp, ioArgument_objects, ioArgument_fileIncludeList, constinArgument_rootFile  COMMA_SOURCE_FILE ("goil_syntax.galgas", 561)) ;
     }
   }
 }
@@ -9378,20 +9459,20 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_include_5F_cpu_5F_level_i11_ (c
 void cParser_goil_5F_syntax::rule_goil_5F_syntax_include_5F_cpu_5F_level_i11_parse (C_Lexique_goil_5F_lexique * inCompiler) {
   switch (select_goil_5F_syntax_14 (inCompiler)) {
   case 1: {
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_include COMMA_SOURCE_FILE ("goil_syntax.galgas", 495)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_include COMMA_SOURCE_FILE ("goil_syntax.galgas", 549)) ;
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_includeifexists COMMA_SOURCE_FILE ("goil_syntax.galgas", 497)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_includeifexists COMMA_SOURCE_FILE ("goil_syntax.galgas", 551)) ;
   } break ;
   default:
     break ;
   }
   switch (select_goil_5F_syntax_15 (inCompiler)) {
   case 1: {
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_g_5F_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 501)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_g_5F_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 555)) ;
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 504)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 558)) ;
   } break ;
   default:
     break ;
@@ -9407,10 +9488,10 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_include_5F_object_5F_level_i12_
   GALGAS_bool var_includeIfExists_15988 = GALGAS_bool (false) ;
   switch (select_goil_5F_syntax_16 (inCompiler)) {
   case 1: {
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_include COMMA_SOURCE_FILE ("goil_syntax.galgas", 517)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_include COMMA_SOURCE_FILE ("goil_syntax.galgas", 571)) ;
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_includeifexists COMMA_SOURCE_FILE ("goil_syntax.galgas", 519)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_includeifexists COMMA_SOURCE_FILE ("goil_syntax.galgas", 573)) ;
     var_includeIfExists_15988 = GALGAS_bool (true) ;
   } break ;
   default:
@@ -9420,31 +9501,31 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_include_5F_object_5F_level_i12_
   switch (select_goil_5F_syntax_17 (inCompiler)) {
   case 1: {
     var_file_5F_name_16096 = inCompiler->synthetizedAttribute_a_5F_string () ;
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_g_5F_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 523)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_g_5F_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 577)) ;
     {
-    routine_file_5F_in_5F_path (var_file_5F_name_16096, inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 524)) ;
+    routine_file_5F_in_5F_path (var_file_5F_name_16096, inCompiler  COMMA_SOURCE_FILE ("goil_syntax.galgas", 578)) ;
     }
   } break ;
   case 2: {
     var_file_5F_name_16096 = inCompiler->synthetizedAttribute_a_5F_string () ;
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 526)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 580)) ;
   } break ;
   default:
     break ;
   }
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    GALGAS_bool test_1 = var_includeIfExists_15988.operator_not (SOURCE_FILE ("goil_syntax.galgas", 528)) ;
+    GALGAS_bool test_1 = var_includeIfExists_15988.operator_not (SOURCE_FILE ("goil_syntax.galgas", 582)) ;
     if (kBoolTrue != test_1.boolEnum ()) {
       GALGAS_bool test_2 = var_includeIfExists_15988 ;
       if (kBoolTrue == test_2.boolEnum ()) {
-        test_2 = var_file_5F_name_16096.getter_string (HERE).getter_fileExists (SOURCE_FILE ("goil_syntax.galgas", 528)) ;
+        test_2 = var_file_5F_name_16096.getter_string (HERE).getter_fileExists (SOURCE_FILE ("goil_syntax.galgas", 582)) ;
       }
       test_1 = test_2 ;
     }
     test_0 = test_1.boolEnum () ;
     if (kBoolTrue == test_0) {
-      cGrammar_goil_5F_object_5F_level_5F_include::_performSourceFileParsing_ (inCompiler, var_file_5F_name_16096, constinArgument_types, ioArgument_identifiers  COMMA_SOURCE_FILE ("goil_syntax.galgas", 529)) ;
+      cGrammar_goil_5F_object_5F_level_5F_include::_performSourceFileParsing_ (inCompiler, var_file_5F_name_16096, constinArgument_types, ioArgument_identifiers  COMMA_SOURCE_FILE ("goil_syntax.galgas", 583)) ;
     }
   }
 }
@@ -9454,20 +9535,20 @@ void cParser_goil_5F_syntax::rule_goil_5F_syntax_include_5F_object_5F_level_i12_
 void cParser_goil_5F_syntax::rule_goil_5F_syntax_include_5F_object_5F_level_i12_parse (C_Lexique_goil_5F_lexique * inCompiler) {
   switch (select_goil_5F_syntax_16 (inCompiler)) {
   case 1: {
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_include COMMA_SOURCE_FILE ("goil_syntax.galgas", 517)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_include COMMA_SOURCE_FILE ("goil_syntax.galgas", 571)) ;
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_includeifexists COMMA_SOURCE_FILE ("goil_syntax.galgas", 519)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_includeifexists COMMA_SOURCE_FILE ("goil_syntax.galgas", 573)) ;
   } break ;
   default:
     break ;
   }
   switch (select_goil_5F_syntax_17 (inCompiler)) {
   case 1: {
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_g_5F_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 523)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_g_5F_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 577)) ;
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 526)) ;
+    inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_string COMMA_SOURCE_FILE ("goil_syntax.galgas", 580)) ;
   } break ;
   default:
     break ;
@@ -10075,8 +10156,14 @@ void cGrammar_goil_5F_object_5F_level_5F_include::nt_start_parse (C_Lexique_goil
   rule_goil_5F_syntax_start_i0_parse(inLexique) ;
 }
 
-void cGrammar_goil_5F_object_5F_level_5F_include::nt_start_ (C_Lexique_goil_5F_lexique * inLexique) {
-  rule_goil_5F_syntax_start_i0_(inLexique) ;
+void cGrammar_goil_5F_object_5F_level_5F_include::nt_start_ (GALGAS_string & parameter_1,
+                                GALGAS_implementation & parameter_2,
+                                GALGAS_applicationDefinition & parameter_3,
+                                GALGAS_string & parameter_4,
+                                GALGAS_library & parameter_5,
+                                GALGAS_gtlData & parameter_6,
+                                C_Lexique_goil_5F_lexique * inLexique) {
+  rule_goil_5F_syntax_start_i0_(parameter_1, parameter_2, parameter_3, parameter_4, parameter_5, parameter_6, inLexique) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -11151,8 +11238,14 @@ void cGrammar_goil_5F_cpu_5F_level_5F_include::nt_start_parse (C_Lexique_goil_5F
   rule_goil_5F_syntax_start_i0_parse(inLexique) ;
 }
 
-void cGrammar_goil_5F_cpu_5F_level_5F_include::nt_start_ (C_Lexique_goil_5F_lexique * inLexique) {
-  rule_goil_5F_syntax_start_i0_(inLexique) ;
+void cGrammar_goil_5F_cpu_5F_level_5F_include::nt_start_ (GALGAS_string & parameter_1,
+                                GALGAS_implementation & parameter_2,
+                                GALGAS_applicationDefinition & parameter_3,
+                                GALGAS_string & parameter_4,
+                                GALGAS_library & parameter_5,
+                                GALGAS_gtlData & parameter_6,
+                                C_Lexique_goil_5F_lexique * inLexique) {
+  rule_goil_5F_syntax_start_i0_(parameter_1, parameter_2, parameter_3, parameter_4, parameter_5, parameter_6, inLexique) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -5204,13 +5204,25 @@ class cParser_goil_5F_syntax {
 
   protected : virtual void nt_sign_parse (class C_Lexique_goil_5F_lexique * inLexique) = 0 ;
 
-  protected : virtual void nt_start_ (class C_Lexique_goil_5F_lexique * inLexique) = 0 ;
+  protected : virtual void nt_start_ (class GALGAS_string & ioArgument0,
+                                      class GALGAS_implementation & ioArgument1,
+                                      class GALGAS_applicationDefinition & ioArgument2,
+                                      class GALGAS_string & ioArgument3,
+                                      class GALGAS_library & ioArgument4,
+                                      class GALGAS_gtlData & outArgument5,
+                                      class C_Lexique_goil_5F_lexique * inLexique) = 0 ;
 
   protected : virtual void nt_start_parse (class C_Lexique_goil_5F_lexique * inLexique) = 0 ;
 
 
 //--- Rule declarations
-  protected : void rule_goil_5F_syntax_start_i0_ (C_Lexique_goil_5F_lexique * inLexique) ;
+  protected : void rule_goil_5F_syntax_start_i0_ (GALGAS_string & ioArgument0,
+                                                  GALGAS_implementation & ioArgument1,
+                                                  GALGAS_applicationDefinition & ioArgument2,
+                                                  GALGAS_string & ioArgument3,
+                                                  GALGAS_library & ioArgument4,
+                                                  GALGAS_gtlData & outArgument5,
+                                                  C_Lexique_goil_5F_lexique * inLexique) ;
 
   protected : void rule_goil_5F_syntax_start_i0_parse (C_Lexique_goil_5F_lexique * inLexique) ;
 
@@ -6775,6 +6787,25 @@ class GALGAS_lstring function_emptyLString (class C_Compiler * inCompiler
 class GALGAS_objectAttributes function_emptyObject (class C_Compiler * inCompiler
                                                     COMMA_LOCATION_ARGS) ;
 
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Function 'generationDate'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+class GALGAS_string function_generationDate (class C_Compiler * inCompiler
+                                             COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Routine 'saveSnapshot'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+void routine_saveSnapshot (const class GALGAS_gtlData constinArgument0,
+                           class C_Compiler * inCompiler
+                           COMMA_LOCATION_ARGS) ;
+
 //----------------------------------------------------------------------------------------------------------------------
 //
 //Function 'stringLBool'
@@ -6795,6 +6826,16 @@ class GALGAS_string function_valueList (const class GALGAS_enumValues & constinA
                                         class C_Compiler * inCompiler
                                         COMMA_LOCATION_ARGS) ;
 
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Function 'passedOptions'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+class GALGAS_gtlData function_passedOptions (const class GALGAS_location & constinArgument0,
+                                             class C_Compiler * inCompiler
+                                             COMMA_LOCATION_ARGS) ;
+
 //----------------------------------------------------------------------------------------------------------------------
 //
 //Extension getter '@applicationDefinition templateData'
@@ -7023,7 +7064,13 @@ class cGrammar_goil_5F_cpu_5F_level_5F_include : public cParser_goil_5F_syntax {
   public : virtual void nt_start_parse (C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //----------- '' label
-  public : virtual void nt_start_ (C_Lexique_goil_5F_lexique * inCompiler) ;
+  public : virtual void nt_start_ (GALGAS_string & ioArgument0,
+                                   GALGAS_implementation & ioArgument1,
+                                   GALGAS_applicationDefinition & ioArgument2,
+                                   GALGAS_string & ioArgument3,
+                                   GALGAS_library & ioArgument4,
+                                   GALGAS_gtlData & outArgument5,
+                                   C_Lexique_goil_5F_lexique * inCompiler) ;
 
   public : virtual int32_t select_goil_5F_syntax_0 (C_Lexique_goil_5F_lexique *) ;
 
@@ -7081,6 +7128,7 @@ class cParser_implementation_5F_parser {
 
   protected : virtual void nt_boolean_5F_options_ (class GALGAS_lstring & outArgument0,
                                                    class GALGAS_impType & outArgument1,
+                                                   class GALGAS_implementationMap & ioArgument2,
                                                    class C_Lexique_goil_5F_lexique * inLexique) = 0 ;
 
   protected : virtual void nt_boolean_5F_options_parse (class C_Lexique_goil_5F_lexique * inLexique) = 0 ;
@@ -7091,12 +7139,14 @@ class cParser_implementation_5F_parser {
   protected : virtual void nt_description_parse (class C_Lexique_goil_5F_lexique * inLexique) = 0 ;
 
   protected : virtual void nt_enum_5F_item_ (class GALGAS_enumValues & ioArgument0,
+                                             class GALGAS_implementationMap & ioArgument1,
                                              class C_Lexique_goil_5F_lexique * inLexique) = 0 ;
 
   protected : virtual void nt_enum_5F_item_parse (class C_Lexique_goil_5F_lexique * inLexique) = 0 ;
 
   protected : virtual void nt_enum_5F_options_ (class GALGAS_lstring & outArgument0,
                                                 class GALGAS_impType & outArgument1,
+                                                class GALGAS_implementationMap & ioArgument2,
                                                 class C_Lexique_goil_5F_lexique * inLexique) = 0 ;
 
   protected : virtual void nt_enum_5F_options_parse (class C_Lexique_goil_5F_lexique * inLexique) = 0 ;
@@ -7117,6 +7167,7 @@ class cParser_implementation_5F_parser {
   protected : virtual void nt_implementation_5F_definition_parse (class C_Lexique_goil_5F_lexique * inLexique) = 0 ;
 
   protected : virtual void nt_implementation_5F_list_ (class GALGAS_implementationObjectMap & ioArgument0,
+                                                       class GALGAS_implementationMap & ioArgument1,
                                                        class C_Lexique_goil_5F_lexique * inLexique) = 0 ;
 
   protected : virtual void nt_implementation_5F_list_parse (class C_Lexique_goil_5F_lexique * inLexique) = 0 ;
@@ -7133,6 +7184,7 @@ class cParser_implementation_5F_parser {
 
   protected : virtual void nt_implementation_5F_type_ (class GALGAS_lstring & outArgument0,
                                                        class GALGAS_impType & outArgument1,
+                                                       class GALGAS_implementationMap & ioArgument2,
                                                        class C_Lexique_goil_5F_lexique * inLexique) = 0 ;
 
   protected : virtual void nt_implementation_5F_type_parse (class C_Lexique_goil_5F_lexique * inLexique) = 0 ;
@@ -7143,6 +7195,7 @@ class cParser_implementation_5F_parser {
   protected : virtual void nt_include_5F_implementation_5F_level_parse (class C_Lexique_goil_5F_lexique * inLexique) = 0 ;
 
   protected : virtual void nt_include_5F_type_5F_level_ (class GALGAS_implementationObjectMap & ioArgument0,
+                                                         class GALGAS_implementationMap & ioArgument1,
                                                          class C_Lexique_goil_5F_lexique * inLexique) = 0 ;
 
   protected : virtual void nt_include_5F_type_5F_level_parse (class C_Lexique_goil_5F_lexique * inLexique) = 0 ;
@@ -7203,6 +7256,7 @@ class cParser_implementation_5F_parser {
 
   protected : virtual void nt_struct_5F_options_ (class GALGAS_lstring & outArgument0,
                                                   class GALGAS_impType & outArgument1,
+                                                  class GALGAS_implementationMap & ioArgument2,
                                                   class C_Lexique_goil_5F_lexique * inLexique) = 0 ;
 
   protected : virtual void nt_struct_5F_options_parse (class C_Lexique_goil_5F_lexique * inLexique) = 0 ;
@@ -7237,6 +7291,7 @@ class cParser_implementation_5F_parser {
   protected : void rule_implementation_5F_parser_include_5F_implementation_5F_level_i2_parse (C_Lexique_goil_5F_lexique * inLexique) ;
 
   protected : void rule_implementation_5F_parser_include_5F_type_5F_level_i3_ (GALGAS_implementationObjectMap & ioArgument0,
+                                                                               GALGAS_implementationMap & ioArgument1,
                                                                                C_Lexique_goil_5F_lexique * inLexique) ;
 
   protected : void rule_implementation_5F_parser_include_5F_type_5F_level_i3_parse (C_Lexique_goil_5F_lexique * inLexique) ;
@@ -7247,18 +7302,21 @@ class cParser_implementation_5F_parser {
   protected : void rule_implementation_5F_parser_implementation_5F_objects_i4_parse (C_Lexique_goil_5F_lexique * inLexique) ;
 
   protected : void rule_implementation_5F_parser_implementation_5F_list_i5_ (GALGAS_implementationObjectMap & ioArgument0,
+                                                                             GALGAS_implementationMap & ioArgument1,
                                                                              C_Lexique_goil_5F_lexique * inLexique) ;
 
   protected : void rule_implementation_5F_parser_implementation_5F_list_i5_parse (C_Lexique_goil_5F_lexique * inLexique) ;
 
   protected : void rule_implementation_5F_parser_implementation_5F_type_i6_ (GALGAS_lstring & outArgument0,
                                                                              GALGAS_impType & outArgument1,
+                                                                             GALGAS_implementationMap & ioArgument2,
                                                                              C_Lexique_goil_5F_lexique * inLexique) ;
 
   protected : void rule_implementation_5F_parser_implementation_5F_type_i6_parse (C_Lexique_goil_5F_lexique * inLexique) ;
 
   protected : void rule_implementation_5F_parser_struct_5F_options_i7_ (GALGAS_lstring & outArgument0,
                                                                         GALGAS_impType & outArgument1,
+                                                                        GALGAS_implementationMap & ioArgument2,
                                                                         C_Lexique_goil_5F_lexique * inLexique) ;
 
   protected : void rule_implementation_5F_parser_struct_5F_options_i7_parse (C_Lexique_goil_5F_lexique * inLexique) ;
@@ -7278,17 +7336,20 @@ class cParser_implementation_5F_parser {
 
   protected : void rule_implementation_5F_parser_boolean_5F_options_i10_ (GALGAS_lstring & outArgument0,
                                                                           GALGAS_impType & outArgument1,
+                                                                          GALGAS_implementationMap & ioArgument2,
                                                                           C_Lexique_goil_5F_lexique * inLexique) ;
 
   protected : void rule_implementation_5F_parser_boolean_5F_options_i10_parse (C_Lexique_goil_5F_lexique * inLexique) ;
 
   protected : void rule_implementation_5F_parser_enum_5F_item_i11_ (GALGAS_enumValues & ioArgument0,
+                                                                    GALGAS_implementationMap & ioArgument1,
                                                                     C_Lexique_goil_5F_lexique * inLexique) ;
 
   protected : void rule_implementation_5F_parser_enum_5F_item_i11_parse (C_Lexique_goil_5F_lexique * inLexique) ;
 
   protected : void rule_implementation_5F_parser_enum_5F_options_i12_ (GALGAS_lstring & outArgument0,
                                                                        GALGAS_impType & outArgument1,
+                                                                       GALGAS_implementationMap & ioArgument2,
                                                                        C_Lexique_goil_5F_lexique * inLexique) ;
 
   protected : void rule_implementation_5F_parser_enum_5F_options_i12_parse (C_Lexique_goil_5F_lexique * inLexique) ;
@@ -7460,6 +7521,7 @@ class cGrammar_goil_5F_file_5F_level_5F_include : public cParser_goil_5F_syntax,
 //----------- '' label
   public : virtual void nt_boolean_5F_options_ (GALGAS_lstring & outArgument0,
                                                 GALGAS_impType & outArgument1,
+                                                GALGAS_implementationMap & ioArgument2,
                                                 C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //------------------------------------- 'description' non terminal
@@ -7476,6 +7538,7 @@ class cGrammar_goil_5F_file_5F_level_5F_include : public cParser_goil_5F_syntax,
 
 //----------- '' label
   public : virtual void nt_enum_5F_item_ (GALGAS_enumValues & ioArgument0,
+                                          GALGAS_implementationMap & ioArgument1,
                                           C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //------------------------------------- 'enum_options' non terminal
@@ -7485,6 +7548,7 @@ class cGrammar_goil_5F_file_5F_level_5F_include : public cParser_goil_5F_syntax,
 //----------- '' label
   public : virtual void nt_enum_5F_options_ (GALGAS_lstring & outArgument0,
                                              GALGAS_impType & outArgument1,
+                                             GALGAS_implementationMap & ioArgument2,
                                              C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //------------------------------------- 'file' non terminal
@@ -7558,6 +7622,7 @@ class cGrammar_goil_5F_file_5F_level_5F_include : public cParser_goil_5F_syntax,
 
 //----------- '' label
   public : virtual void nt_implementation_5F_list_ (GALGAS_implementationObjectMap & ioArgument0,
+                                                    GALGAS_implementationMap & ioArgument1,
                                                     C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //------------------------------------- 'implementation_object_list' non terminal
@@ -7583,6 +7648,7 @@ class cGrammar_goil_5F_file_5F_level_5F_include : public cParser_goil_5F_syntax,
 //----------- '' label
   public : virtual void nt_implementation_5F_type_ (GALGAS_lstring & outArgument0,
                                                     GALGAS_impType & outArgument1,
+                                                    GALGAS_implementationMap & ioArgument2,
                                                     C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //------------------------------------- 'include_cpu_level' non terminal
@@ -7630,6 +7696,7 @@ class cGrammar_goil_5F_file_5F_level_5F_include : public cParser_goil_5F_syntax,
 
 //----------- '' label
   public : virtual void nt_include_5F_type_5F_level_ (GALGAS_implementationObjectMap & ioArgument0,
+                                                      GALGAS_implementationMap & ioArgument1,
                                                       C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //------------------------------------- 'int_or_float' non terminal
@@ -7738,7 +7805,13 @@ class cGrammar_goil_5F_file_5F_level_5F_include : public cParser_goil_5F_syntax,
   public : virtual void nt_start_parse (C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //----------- '' label
-  public : virtual void nt_start_ (C_Lexique_goil_5F_lexique * inCompiler) ;
+  public : virtual void nt_start_ (GALGAS_string & ioArgument0,
+                                   GALGAS_implementation & ioArgument1,
+                                   GALGAS_applicationDefinition & ioArgument2,
+                                   GALGAS_string & ioArgument3,
+                                   GALGAS_library & ioArgument4,
+                                   GALGAS_gtlData & outArgument5,
+                                   C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //------------------------------------- 'string_options' non terminal
 //--- 'parse' label
@@ -7756,6 +7829,7 @@ class cGrammar_goil_5F_file_5F_level_5F_include : public cParser_goil_5F_syntax,
 //----------- '' label
   public : virtual void nt_struct_5F_options_ (GALGAS_lstring & outArgument0,
                                                GALGAS_impType & outArgument1,
+                                               GALGAS_implementationMap & ioArgument2,
                                                C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //------------------------------------- 'type_options' non terminal
@@ -8035,7 +8109,13 @@ class cGrammar_goil_5F_object_5F_level_5F_include : public cParser_goil_5F_synta
   public : virtual void nt_start_parse (C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //----------- '' label
-  public : virtual void nt_start_ (C_Lexique_goil_5F_lexique * inCompiler) ;
+  public : virtual void nt_start_ (GALGAS_string & ioArgument0,
+                                   GALGAS_implementation & ioArgument1,
+                                   GALGAS_applicationDefinition & ioArgument2,
+                                   GALGAS_string & ioArgument3,
+                                   GALGAS_library & ioArgument4,
+                                   GALGAS_gtlData & outArgument5,
+                                   C_Lexique_goil_5F_lexique * inCompiler) ;
 
   public : virtual int32_t select_goil_5F_syntax_0 (C_Lexique_goil_5F_lexique *) ;
 
@@ -8084,12 +8164,16 @@ class cGrammar_goil_5F_object_5F_level_5F_include : public cParser_goil_5F_synta
 
 extern C_BoolCommandLineOption gOption_goil_5F_options_arxmlDisplayOil ;
 
+extern C_BoolCommandLineOption gOption_goil_5F_options_footprint ;
+
 extern C_BoolCommandLineOption gOption_goil_5F_options_generate_5F_log ;
 
 extern C_BoolCommandLineOption gOption_goil_5F_options_pierreOption ;
 
 extern C_BoolCommandLineOption gOption_goil_5F_options_warnMultiple ;
 
+extern C_BoolCommandLineOption gOption_goil_5F_options_watch ;
+
 //----------------------------------------------------------------------------------------------------------------------
 //
 //                               UInt options                                                    
@@ -8139,6 +8223,8 @@ void routine_file_5F_in_5F_path (class GALGAS_lstring & ioArgument0,
 //----------------------------------------------------------------------------------------------------------------------
 
 void routine_generate_5F_all (class GALGAS_gtlData inArgument0,
+                              class GALGAS_gtlProfileMap inArgument1,
+                              class GALGAS_library & ioArgument2,
                               class C_Compiler * inCompiler
                               COMMA_LOCATION_ARGS) ;
 
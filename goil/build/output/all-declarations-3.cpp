@@ -5230,6 +5230,18 @@ typeComparisonResult cPtr_library::dynamicObjectCompare (const acPtr_class * inO
   if (kOperandEqual == result) {
     result = mProperty_doneImports.objectCompare (p->mProperty_doneImports) ;
   }
+  if (kOperandEqual == result) {
+    result = mProperty_lineProfile.objectCompare (p->mProperty_lineProfile) ;
+  }
+  if (kOperandEqual == result) {
+    result = mProperty_stackProfile.objectCompare (p->mProperty_stackProfile) ;
+  }
+  if (kOperandEqual == result) {
+    result = mProperty_profileStack.objectCompare (p->mProperty_profileStack) ;
+  }
+  if (kOperandEqual == result) {
+    result = mProperty_outputFile.objectCompare (p->mProperty_outputFile) ;
+  }
   return result ;
 }
 
@@ -5265,7 +5277,11 @@ GALGAS_library GALGAS_library::constructor_default (LOCATION_ARGS) {
                                           GALGAS_gtlGetterMap::constructor_emptyMap (HERE),
                                           GALGAS_gtlSetterMap::constructor_emptyMap (HERE),
                                           GALGAS_gtlTemplateMap::constructor_emptyMap (HERE),
-                                          GALGAS_stringset::constructor_emptySet (HERE)
+                                          GALGAS_stringset::constructor_emptySet (HERE),
+                                          GALGAS_gtlProfileMap::constructor_emptyMap (HERE),
+                                          GALGAS_gtlProfileMap::constructor_emptyMap (HERE),
+                                          GALGAS_string::constructor_default (HERE),
+                                          GALGAS_string::constructor_default (HERE)
                                           COMMA_THERE) ;
 }
 
@@ -5282,11 +5298,15 @@ GALGAS_library GALGAS_library::constructor_new (const GALGAS_gtlFuncMap & inAttr
                                                 const GALGAS_gtlGetterMap & inAttribute_getterMap,
                                                 const GALGAS_gtlSetterMap & inAttribute_setterMap,
                                                 const GALGAS_gtlTemplateMap & inAttribute_templateMap,
-                                                const GALGAS_stringset & inAttribute_doneImports
+                                                const GALGAS_stringset & inAttribute_doneImports,
+                                                const GALGAS_gtlProfileMap & inAttribute_lineProfile,
+                                                const GALGAS_gtlProfileMap & inAttribute_stackProfile,
+                                                const GALGAS_string & inAttribute_profileStack,
+                                                const GALGAS_string & inAttribute_outputFile
                                                 COMMA_LOCATION_ARGS) {
   GALGAS_library result ;
-  if (inAttribute_funcMap.isValid () && inAttribute_getterMap.isValid () && inAttribute_setterMap.isValid () && inAttribute_templateMap.isValid () && inAttribute_doneImports.isValid ()) {
-    macroMyNew (result.mObjectPtr, cPtr_library (inAttribute_funcMap, inAttribute_getterMap, inAttribute_setterMap, inAttribute_templateMap, inAttribute_doneImports COMMA_THERE)) ;
+  if (inAttribute_funcMap.isValid () && inAttribute_getterMap.isValid () && inAttribute_setterMap.isValid () && inAttribute_templateMap.isValid () && inAttribute_doneImports.isValid () && inAttribute_lineProfile.isValid () && inAttribute_stackProfile.isValid () && inAttribute_profileStack.isValid () && inAttribute_outputFile.isValid ()) {
+    macroMyNew (result.mObjectPtr, cPtr_library (inAttribute_funcMap, inAttribute_getterMap, inAttribute_setterMap, inAttribute_templateMap, inAttribute_doneImports, inAttribute_lineProfile, inAttribute_stackProfile, inAttribute_profileStack, inAttribute_outputFile COMMA_THERE)) ;
   }
   return result ;
 }
@@ -5383,6 +5403,78 @@ GALGAS_stringset cPtr_library::getter_doneImports (UNUSED_LOCATION_ARGS) const {
 
 //----------------------------------------------------------------------------------------------------------------------
 
+GALGAS_gtlProfileMap GALGAS_library::getter_lineProfile (UNUSED_LOCATION_ARGS) const {
+  GALGAS_gtlProfileMap result ;
+  if (NULL != mObjectPtr) {
+    const cPtr_library * p = (const cPtr_library *) mObjectPtr ;
+    macroValidSharedObject (p, cPtr_library) ;
+    result = p->mProperty_lineProfile ;
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_gtlProfileMap cPtr_library::getter_lineProfile (UNUSED_LOCATION_ARGS) const {
+  return mProperty_lineProfile ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_gtlProfileMap GALGAS_library::getter_stackProfile (UNUSED_LOCATION_ARGS) const {
+  GALGAS_gtlProfileMap result ;
+  if (NULL != mObjectPtr) {
+    const cPtr_library * p = (const cPtr_library *) mObjectPtr ;
+    macroValidSharedObject (p, cPtr_library) ;
+    result = p->mProperty_stackProfile ;
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_gtlProfileMap cPtr_library::getter_stackProfile (UNUSED_LOCATION_ARGS) const {
+  return mProperty_stackProfile ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_string GALGAS_library::getter_profileStack (UNUSED_LOCATION_ARGS) const {
+  GALGAS_string result ;
+  if (NULL != mObjectPtr) {
+    const cPtr_library * p = (const cPtr_library *) mObjectPtr ;
+    macroValidSharedObject (p, cPtr_library) ;
+    result = p->mProperty_profileStack ;
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_string cPtr_library::getter_profileStack (UNUSED_LOCATION_ARGS) const {
+  return mProperty_profileStack ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_string GALGAS_library::getter_outputFile (UNUSED_LOCATION_ARGS) const {
+  GALGAS_string result ;
+  if (NULL != mObjectPtr) {
+    const cPtr_library * p = (const cPtr_library *) mObjectPtr ;
+    macroValidSharedObject (p, cPtr_library) ;
+    result = p->mProperty_outputFile ;
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_string cPtr_library::getter_outputFile (UNUSED_LOCATION_ARGS) const {
+  return mProperty_outputFile ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
 void GALGAS_library::setter_setFuncMap (GALGAS_gtlFuncMap inValue
                                         COMMA_LOCATION_ARGS) {
   if (NULL != mObjectPtr) {
@@ -5476,6 +5568,82 @@ void cPtr_library::setter_setDoneImports (GALGAS_stringset inValue
   mProperty_doneImports = inValue ;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+
+void GALGAS_library::setter_setLineProfile (GALGAS_gtlProfileMap inValue
+                                            COMMA_LOCATION_ARGS) {
+  if (NULL != mObjectPtr) {
+    insulate (THERE) ;
+    cPtr_library * p = (cPtr_library *) mObjectPtr ;
+    macroValidSharedObject (p, cPtr_library) ;
+    p->mProperty_lineProfile = inValue ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void cPtr_library::setter_setLineProfile (GALGAS_gtlProfileMap inValue
+                                          COMMA_UNUSED_LOCATION_ARGS) {
+  mProperty_lineProfile = inValue ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void GALGAS_library::setter_setStackProfile (GALGAS_gtlProfileMap inValue
+                                             COMMA_LOCATION_ARGS) {
+  if (NULL != mObjectPtr) {
+    insulate (THERE) ;
+    cPtr_library * p = (cPtr_library *) mObjectPtr ;
+    macroValidSharedObject (p, cPtr_library) ;
+    p->mProperty_stackProfile = inValue ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void cPtr_library::setter_setStackProfile (GALGAS_gtlProfileMap inValue
+                                           COMMA_UNUSED_LOCATION_ARGS) {
+  mProperty_stackProfile = inValue ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void GALGAS_library::setter_setProfileStack (GALGAS_string inValue
+                                             COMMA_LOCATION_ARGS) {
+  if (NULL != mObjectPtr) {
+    insulate (THERE) ;
+    cPtr_library * p = (cPtr_library *) mObjectPtr ;
+    macroValidSharedObject (p, cPtr_library) ;
+    p->mProperty_profileStack = inValue ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void cPtr_library::setter_setProfileStack (GALGAS_string inValue
+                                           COMMA_UNUSED_LOCATION_ARGS) {
+  mProperty_profileStack = inValue ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void GALGAS_library::setter_setOutputFile (GALGAS_string inValue
+                                           COMMA_LOCATION_ARGS) {
+  if (NULL != mObjectPtr) {
+    insulate (THERE) ;
+    cPtr_library * p = (cPtr_library *) mObjectPtr ;
+    macroValidSharedObject (p, cPtr_library) ;
+    p->mProperty_outputFile = inValue ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void cPtr_library::setter_setOutputFile (GALGAS_string inValue
+                                         COMMA_UNUSED_LOCATION_ARGS) {
+  mProperty_outputFile = inValue ;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 //Pointer class for @library class
 //----------------------------------------------------------------------------------------------------------------------
@@ -5484,14 +5652,22 @@ cPtr_library::cPtr_library (const GALGAS_gtlFuncMap & in_funcMap,
                             const GALGAS_gtlGetterMap & in_getterMap,
                             const GALGAS_gtlSetterMap & in_setterMap,
                             const GALGAS_gtlTemplateMap & in_templateMap,
-                            const GALGAS_stringset & in_doneImports
+                            const GALGAS_stringset & in_doneImports,
+                            const GALGAS_gtlProfileMap & in_lineProfile,
+                            const GALGAS_gtlProfileMap & in_stackProfile,
+                            const GALGAS_string & in_profileStack,
+                            const GALGAS_string & in_outputFile
                             COMMA_LOCATION_ARGS) :
 acPtr_class (THERE),
 mProperty_funcMap (in_funcMap),
 mProperty_getterMap (in_getterMap),
 mProperty_setterMap (in_setterMap),
 mProperty_templateMap (in_templateMap),
-mProperty_doneImports (in_doneImports) {
+mProperty_doneImports (in_doneImports),
+mProperty_lineProfile (in_lineProfile),
+mProperty_stackProfile (in_stackProfile),
+mProperty_profileStack (in_profileStack),
+mProperty_outputFile (in_outputFile) {
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -5512,6 +5688,14 @@ void cPtr_library::description (C_String & ioString,
   mProperty_templateMap.description (ioString, inIndentation+1) ;
   ioString << ", " ;
   mProperty_doneImports.description (ioString, inIndentation+1) ;
+  ioString << ", " ;
+  mProperty_lineProfile.description (ioString, inIndentation+1) ;
+  ioString << ", " ;
+  mProperty_stackProfile.description (ioString, inIndentation+1) ;
+  ioString << ", " ;
+  mProperty_profileStack.description (ioString, inIndentation+1) ;
+  ioString << ", " ;
+  mProperty_outputFile.description (ioString, inIndentation+1) ;
   ioString << "]" ;
 }
 
@@ -5519,7 +5703,7 @@ void cPtr_library::description (C_String & ioString,
 
 acPtr_class * cPtr_library::duplicate (LOCATION_ARGS) const {
   acPtr_class * ptr = NULL ;
-  macroMyNew (ptr, cPtr_library (mProperty_funcMap, mProperty_getterMap, mProperty_setterMap, mProperty_templateMap, mProperty_doneImports COMMA_THERE)) ;
+  macroMyNew (ptr, cPtr_library (mProperty_funcMap, mProperty_getterMap, mProperty_setterMap, mProperty_templateMap, mProperty_doneImports, mProperty_lineProfile, mProperty_stackProfile, mProperty_profileStack, mProperty_outputFile COMMA_THERE)) ;
   return ptr ;
 }
 
@@ -5626,7 +5810,7 @@ static GALGAS_bool extensionGetter_library_functionExists (const cPtr_library *
   GALGAS_bool result_exists ; // Returned variable
   const cPtr_library * object = inObject ;
   macroValidSharedObject (object, cPtr_library) ;
-  result_exists = object->mProperty_funcMap.getter_hasKey (constinArgument_name.getter_string (SOURCE_FILE ("gtl_types.galgas", 330)) COMMA_SOURCE_FILE ("gtl_types.galgas", 330)) ;
+  result_exists = object->mProperty_funcMap.getter_hasKey (constinArgument_name.getter_string (SOURCE_FILE ("gtl_types.galgas", 339)) COMMA_SOURCE_FILE ("gtl_types.galgas", 339)) ;
 //---
   return result_exists ;
 }
@@ -5709,7 +5893,7 @@ static GALGAS_gtlFunction extensionGetter_library_getFunction (const cPtr_librar
   GALGAS_gtlFunction result_aFunction ; // Returned variable
   const cPtr_library * object = inObject ;
   macroValidSharedObject (object, cPtr_library) ;
-  object->mProperty_funcMap.method_get (constinArgument_name, result_aFunction, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 337)) ;
+  object->mProperty_funcMap.method_get (constinArgument_name, result_aFunction, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 346)) ;
 //---
   return result_aFunction ;
 }
@@ -5789,7 +5973,7 @@ static void extensionSetter_library_putFunction (cPtr_library * inObject,
   cPtr_library * object = inObject ;
   macroValidSharedObject (object, cPtr_library) ;
   {
-  object->mProperty_funcMap.setter_put (constinArgument_name, constinArgument_aFunction, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 344)) ;
+  object->mProperty_funcMap.setter_put (constinArgument_name, constinArgument_aFunction, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 353)) ;
   }
 }
 //----------------------------------------------------------------------------------------------------------------------
@@ -5871,7 +6055,7 @@ static GALGAS_bool extensionGetter_library_getterExists (const cPtr_library * in
   GALGAS_bool result_exists ; // Returned variable
   const cPtr_library * object = inObject ;
   macroValidSharedObject (object, cPtr_library) ;
-  result_exists = object->mProperty_getterMap.getter_hasKey (constinArgument_type.add_operation (constinArgument_name.getter_string (SOURCE_FILE ("gtl_types.galgas", 352)), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 352)) COMMA_SOURCE_FILE ("gtl_types.galgas", 352)) ;
+  result_exists = object->mProperty_getterMap.getter_hasKey (constinArgument_type.add_operation (constinArgument_name.getter_string (SOURCE_FILE ("gtl_types.galgas", 361)), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 361)) COMMA_SOURCE_FILE ("gtl_types.galgas", 361)) ;
 //---
   return result_exists ;
 }
@@ -5956,7 +6140,7 @@ static GALGAS_gtlGetter extensionGetter_library_getGetter (const cPtr_library *
   GALGAS_gtlGetter result_aGetter ; // Returned variable
   const cPtr_library * object = inObject ;
   macroValidSharedObject (object, cPtr_library) ;
-  object->mProperty_getterMap.method_get (GALGAS_lstring::constructor_new (constinArgument_type.add_operation (constinArgument_name.getter_string (SOURCE_FILE ("gtl_types.galgas", 360)), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 360)), constinArgument_name.getter_location (SOURCE_FILE ("gtl_types.galgas", 360))  COMMA_SOURCE_FILE ("gtl_types.galgas", 360)), result_aGetter, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 360)) ;
+  object->mProperty_getterMap.method_get (GALGAS_lstring::constructor_new (constinArgument_type.add_operation (constinArgument_name.getter_string (SOURCE_FILE ("gtl_types.galgas", 369)), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 369)), constinArgument_name.getter_location (SOURCE_FILE ("gtl_types.galgas", 369))  COMMA_SOURCE_FILE ("gtl_types.galgas", 369)), result_aGetter, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 369)) ;
 //---
   return result_aGetter ;
 }
@@ -6036,7 +6220,7 @@ static void extensionSetter_library_putGetter (cPtr_library * inObject,
   cPtr_library * object = inObject ;
   macroValidSharedObject (object, cPtr_library) ;
   {
-  object->mProperty_getterMap.setter_put (constinArgument_name, constinArgument_aGetter, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 367)) ;
+  object->mProperty_getterMap.setter_put (constinArgument_name, constinArgument_aGetter, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 376)) ;
   }
 }
 //----------------------------------------------------------------------------------------------------------------------
@@ -6118,7 +6302,7 @@ static GALGAS_bool extensionGetter_library_setterExists (const cPtr_library * in
   GALGAS_bool result_exists ; // Returned variable
   const cPtr_library * object = inObject ;
   macroValidSharedObject (object, cPtr_library) ;
-  result_exists = object->mProperty_setterMap.getter_hasKey (constinArgument_type.add_operation (constinArgument_name.getter_string (SOURCE_FILE ("gtl_types.galgas", 375)), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 375)) COMMA_SOURCE_FILE ("gtl_types.galgas", 375)) ;
+  result_exists = object->mProperty_setterMap.getter_hasKey (constinArgument_type.add_operation (constinArgument_name.getter_string (SOURCE_FILE ("gtl_types.galgas", 384)), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 384)) COMMA_SOURCE_FILE ("gtl_types.galgas", 384)) ;
 //---
   return result_exists ;
 }
@@ -6203,7 +6387,7 @@ static GALGAS_gtlSetter extensionGetter_library_getSetter (const cPtr_library *
   GALGAS_gtlSetter result_aSetter ; // Returned variable
   const cPtr_library * object = inObject ;
   macroValidSharedObject (object, cPtr_library) ;
-  object->mProperty_setterMap.method_get (GALGAS_lstring::constructor_new (constinArgument_type.add_operation (constinArgument_name.getter_string (SOURCE_FILE ("gtl_types.galgas", 383)), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 383)), constinArgument_name.getter_location (SOURCE_FILE ("gtl_types.galgas", 383))  COMMA_SOURCE_FILE ("gtl_types.galgas", 383)), result_aSetter, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 383)) ;
+  object->mProperty_setterMap.method_get (GALGAS_lstring::constructor_new (constinArgument_type.add_operation (constinArgument_name.getter_string (SOURCE_FILE ("gtl_types.galgas", 392)), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 392)), constinArgument_name.getter_location (SOURCE_FILE ("gtl_types.galgas", 392))  COMMA_SOURCE_FILE ("gtl_types.galgas", 392)), result_aSetter, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 392)) ;
 //---
   return result_aSetter ;
 }
@@ -6283,7 +6467,7 @@ static void extensionSetter_library_putSetter (cPtr_library * inObject,
   cPtr_library * object = inObject ;
   macroValidSharedObject (object, cPtr_library) ;
   {
-  object->mProperty_setterMap.setter_put (constinArgument_name, constinArgument_aSetter, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 390)) ;
+  object->mProperty_setterMap.setter_put (constinArgument_name, constinArgument_aSetter, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 399)) ;
   }
 }
 //----------------------------------------------------------------------------------------------------------------------
@@ -6363,7 +6547,7 @@ static GALGAS_bool extensionGetter_library_hasImport (const cPtr_library * inObj
   GALGAS_bool result_result ; // Returned variable
   const cPtr_library * object = inObject ;
   macroValidSharedObject (object, cPtr_library) ;
-  result_result = object->mProperty_doneImports.getter_hasKey (constinArgument_importPath COMMA_SOURCE_FILE ("gtl_types.galgas", 397)) ;
+  result_result = object->mProperty_doneImports.getter_hasKey (constinArgument_importPath COMMA_SOURCE_FILE ("gtl_types.galgas", 406)) ;
 //---
   return result_result ;
 }
@@ -6440,7 +6624,7 @@ static void extensionSetter_library_doImport (cPtr_library * inObject,
                                               COMMA_UNUSED_LOCATION_ARGS) {
   cPtr_library * object = inObject ;
   macroValidSharedObject (object, cPtr_library) ;
-  object->mProperty_doneImports.addAssign_operation (constinArgument_importPath  COMMA_SOURCE_FILE ("gtl_types.galgas", 403)) ;
+  object->mProperty_doneImports.addAssign_operation (constinArgument_importPath  COMMA_SOURCE_FILE ("gtl_types.galgas", 412)) ;
 }
 //----------------------------------------------------------------------------------------------------------------------
 
@@ -6526,7 +6710,7 @@ static void extensionSetter_library_getTemplate (cPtr_library * inObject,
   cPtr_library * object = inObject ;
   macroValidSharedObject (object, cPtr_library) ;
   {
-  extensionSetter_getTemplate (object->mProperty_templateMap, constinArgument_context, inArgument_path, inArgument_ifExists, ioArgument_lib, outArgument_found, outArgument_result, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 415)) ;
+  extensionSetter_getTemplate (object->mProperty_templateMap, constinArgument_context, inArgument_path, inArgument_ifExists, ioArgument_lib, outArgument_found, outArgument_result, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 424)) ;
   }
 }
 //----------------------------------------------------------------------------------------------------------------------
@@ -6547,6 +6731,399 @@ static void freeExtensionModifier_library_getTemplate (void) {
 C_PrologueEpilogue gSetter_library_getTemplate (defineExtensionSetter_library_getTemplate,
                                                 freeExtensionModifier_library_getTemplate) ;
 
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Extension setter '@library forgetChangedFiles'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+static TC_UniqueArray <extensionSetterSignature_library_forgetChangedFiles> gExtensionModifierTable_library_forgetChangedFiles ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void enterExtensionSetter_forgetChangedFiles (const int32_t inClassIndex,
+                                              extensionSetterSignature_library_forgetChangedFiles inModifier) {
+  gExtensionModifierTable_library_forgetChangedFiles.forceObjectAtIndex (inClassIndex, inModifier, NULL COMMA_HERE) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void callExtensionSetter_forgetChangedFiles (cPtr_library * inObject,
+                                             const GALGAS_stringlist constin_changedFiles,
+                                             const GALGAS_string constin_templateExtension,
+                                             C_Compiler * inCompiler
+                                             COMMA_LOCATION_ARGS) {
+//--- Drop output arguments
+//--- Find setter
+  if (NULL != inObject) {
+    macroValidSharedObject (inObject, cPtr_library) ;
+    const C_galgas_type_descriptor * info = inObject->classDescriptor () ;
+    const int32_t classIndex = info->mSlotID ;
+    extensionSetterSignature_library_forgetChangedFiles f = NULL ;
+    if (classIndex < gExtensionModifierTable_library_forgetChangedFiles.count ()) {
+      f = gExtensionModifierTable_library_forgetChangedFiles (classIndex COMMA_HERE) ;
+    }
+    if (NULL == f) {
+       const C_galgas_type_descriptor * p = info->mSuperclassDescriptor ;
+       while ((NULL == f) && (NULL != p)) {
+         if (p->mSlotID < gExtensionModifierTable_library_forgetChangedFiles.count ()) {
+           f = gExtensionModifierTable_library_forgetChangedFiles (p->mSlotID COMMA_HERE) ;
+         }
+         p = p->mSuperclassDescriptor ;
+       }
+       gExtensionModifierTable_library_forgetChangedFiles.forceObjectAtIndex (classIndex, f, NULL COMMA_HERE) ;
+    }
+    f (inObject, constin_changedFiles, constin_templateExtension, inCompiler COMMA_THERE) ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static void extensionSetter_library_forgetChangedFiles (cPtr_library * inObject,
+                                                        const GALGAS_stringlist constinArgument_changedFiles,
+                                                        const GALGAS_string constinArgument_templateExtension,
+                                                        C_Compiler * inCompiler
+                                                        COMMA_UNUSED_LOCATION_ARGS) {
+  cPtr_library * object = inObject ;
+  macroValidSharedObject (object, cPtr_library) ;
+  GALGAS_stringset var_changed_11154 = GALGAS_stringset::constructor_emptySet (SOURCE_FILE ("gtl_types.galgas", 445)) ;
+  cEnumerator_stringlist enumerator_11180 (constinArgument_changedFiles, kENUMERATION_UP) ;
+  while (enumerator_11180.hasCurrentObject ()) {
+    var_changed_11154.addAssign_operation (enumerator_11180.current_mValue (HERE).getter_stringByStandardizingPath (SOURCE_FILE ("gtl_types.galgas", 447))  COMMA_SOURCE_FILE ("gtl_types.galgas", 447)) ;
+    enumerator_11180.gotoNextObject () ;
+  }
+  GALGAS_bool var_moduleChanged_11269 = GALGAS_bool (false) ;
+  cEnumerator_stringset enumerator_11297 (object->mProperty_doneImports, kENUMERATION_UP) ;
+  while (enumerator_11297.hasCurrentObject ()) {
+    enumGalgasBool test_0 = kBoolTrue ;
+    if (kBoolTrue == test_0) {
+      test_0 = var_changed_11154.getter_hasKey (enumerator_11297.current_key (HERE).getter_stringByStandardizingPath (SOURCE_FILE ("gtl_types.galgas", 451)) COMMA_SOURCE_FILE ("gtl_types.galgas", 451)).boolEnum () ;
+      if (kBoolTrue == test_0) {
+        var_moduleChanged_11269 = GALGAS_bool (true) ;
+      }
+    }
+    enumerator_11297.gotoNextObject () ;
+  }
+  GALGAS_gtlTemplateMap var_templates_11456 = GALGAS_gtlTemplateMap::constructor_emptyMap (SOURCE_FILE ("gtl_types.galgas", 455)) ;
+  GALGAS_stringset var_parsed_11491 = GALGAS_stringset::constructor_emptySet (SOURCE_FILE ("gtl_types.galgas", 456)) ;
+  enumGalgasBool test_1 = kBoolTrue ;
+  if (kBoolTrue == test_1) {
+    test_1 = var_moduleChanged_11269.operator_not (SOURCE_FILE ("gtl_types.galgas", 457)).boolEnum () ;
+    if (kBoolTrue == test_1) {
+      cEnumerator_gtlTemplateMap enumerator_11546 (object->mProperty_templateMap, kENUMERATION_UP) ;
+      while (enumerator_11546.hasCurrentObject ()) {
+        GALGAS_string var_file_11595 = enumerator_11546.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_types.galgas", 459)).getter_stringByStandardizingPath (SOURCE_FILE ("gtl_types.galgas", 459)) ;
+        var_parsed_11491.addAssign_operation (var_file_11595  COMMA_SOURCE_FILE ("gtl_types.galgas", 460)) ;
+        enumGalgasBool test_2 = kBoolTrue ;
+        if (kBoolTrue == test_2) {
+          test_2 = var_changed_11154.getter_hasKey (var_file_11595 COMMA_SOURCE_FILE ("gtl_types.galgas", 461)).operator_not (SOURCE_FILE ("gtl_types.galgas", 461)).boolEnum () ;
+          if (kBoolTrue == test_2) {
+            var_templates_11456.setter_put (enumerator_11546.current_lkey (HERE), enumerator_11546.current_aTemplate (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 462)) ;
+          }
+        }
+        enumerator_11546.gotoNextObject () ;
+      }
+    }
+  }
+  GALGAS_bool var_templateAdded_11782 = GALGAS_bool (false) ;
+  cEnumerator_stringset enumerator_11810 (var_changed_11154, kENUMERATION_UP) ;
+  while (enumerator_11810.hasCurrentObject ()) {
+    enumGalgasBool test_3 = kBoolTrue ;
+    if (kBoolTrue == test_3) {
+      test_3 = GALGAS_bool (kIsEqual, enumerator_11810.current_key (HERE).getter_pathExtension (SOURCE_FILE ("gtl_types.galgas", 468)).objectCompare (constinArgument_templateExtension)).operator_and (var_parsed_11491.getter_hasKey (enumerator_11810.current_key (HERE) COMMA_SOURCE_FILE ("gtl_types.galgas", 468)).operator_not (SOURCE_FILE ("gtl_types.galgas", 468)) COMMA_SOURCE_FILE ("gtl_types.galgas", 468)).boolEnum () ;
+      if (kBoolTrue == test_3) {
+        var_templateAdded_11782 = GALGAS_bool (true) ;
+      }
+    }
+    enumerator_11810.gotoNextObject () ;
+  }
+  enumGalgasBool test_4 = kBoolTrue ;
+  if (kBoolTrue == test_4) {
+    test_4 = var_moduleChanged_11269.boolEnum () ;
+    if (kBoolTrue == test_4) {
+      object->mProperty_funcMap = GALGAS_gtlFuncMap::constructor_emptyMap (SOURCE_FILE ("gtl_types.galgas", 473)) ;
+      object->mProperty_getterMap = GALGAS_gtlGetterMap::constructor_emptyMap (SOURCE_FILE ("gtl_types.galgas", 474)) ;
+      object->mProperty_setterMap = GALGAS_gtlSetterMap::constructor_emptyMap (SOURCE_FILE ("gtl_types.galgas", 475)) ;
+      object->mProperty_doneImports = GALGAS_stringset::constructor_emptySet (SOURCE_FILE ("gtl_types.galgas", 476)) ;
+    }
+  }
+  enumGalgasBool test_5 = kBoolTrue ;
+  if (kBoolTrue == test_5) {
+    test_5 = var_moduleChanged_11269.operator_or (var_templateAdded_11782 COMMA_SOURCE_FILE ("gtl_types.galgas", 478)).boolEnum () ;
+    if (kBoolTrue == test_5) {
+      GALGAS_application::class_method_forgetOutputRecords (SOURCE_FILE ("gtl_types.galgas", 479)) ;
+    }
+  }
+  object->mProperty_templateMap = var_templates_11456 ;
+  object->mProperty_lineProfile = GALGAS_gtlProfileMap::constructor_emptyMap (SOURCE_FILE ("gtl_types.galgas", 482)) ;
+  object->mProperty_stackProfile = GALGAS_gtlProfileMap::constructor_emptyMap (SOURCE_FILE ("gtl_types.galgas", 483)) ;
+}
+//----------------------------------------------------------------------------------------------------------------------
+
+static void defineExtensionSetter_library_forgetChangedFiles (void) {
+  enterExtensionSetter_forgetChangedFiles (kTypeDescriptor_GALGAS_library.mSlotID,
+                                           extensionSetter_library_forgetChangedFiles) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static void freeExtensionModifier_library_forgetChangedFiles (void) {
+  gExtensionModifierTable_library_forgetChangedFiles.free () ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_PrologueEpilogue gSetter_library_forgetChangedFiles (defineExtensionSetter_library_forgetChangedFiles,
+                                                       freeExtensionModifier_library_forgetChangedFiles) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Extension setter '@library profileInstruction'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+static TC_UniqueArray <extensionSetterSignature_library_profileInstruction> gExtensionModifierTable_library_profileInstruction ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void enterExtensionSetter_profileInstruction (const int32_t inClassIndex,
+                                              extensionSetterSignature_library_profileInstruction inModifier) {
+  gExtensionModifierTable_library_profileInstruction.forceObjectAtIndex (inClassIndex, inModifier, NULL COMMA_HERE) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void callExtensionSetter_profileInstruction (cPtr_library * inObject,
+                                             const GALGAS_gtlInstruction constin_instruction,
+                                             const GALGAS_timer constin_timer,
+                                             C_Compiler * inCompiler
+                                             COMMA_LOCATION_ARGS) {
+//--- Drop output arguments
+//--- Find setter
+  if (NULL != inObject) {
+    macroValidSharedObject (inObject, cPtr_library) ;
+    const C_galgas_type_descriptor * info = inObject->classDescriptor () ;
+    const int32_t classIndex = info->mSlotID ;
+    extensionSetterSignature_library_profileInstruction f = NULL ;
+    if (classIndex < gExtensionModifierTable_library_profileInstruction.count ()) {
+      f = gExtensionModifierTable_library_profileInstruction (classIndex COMMA_HERE) ;
+    }
+    if (NULL == f) {
+       const C_galgas_type_descriptor * p = info->mSuperclassDescriptor ;
+       while ((NULL == f) && (NULL != p)) {
+         if (p->mSlotID < gExtensionModifierTable_library_profileInstruction.count ()) {
+           f = gExtensionModifierTable_library_profileInstruction (p->mSlotID COMMA_HERE) ;
+         }
+         p = p->mSuperclassDescriptor ;
+       }
+       gExtensionModifierTable_library_profileInstruction.forceObjectAtIndex (classIndex, f, NULL COMMA_HERE) ;
+    }
+    f (inObject, constin_instruction, constin_timer, inCompiler COMMA_THERE) ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static void extensionSetter_library_profileInstruction (cPtr_library * inObject,
+                                                        const GALGAS_gtlInstruction constinArgument_instruction,
+                                                        const GALGAS_timer constinArgument_timer,
+                                                        C_Compiler * inCompiler
+                                                        COMMA_UNUSED_LOCATION_ARGS) {
+  cPtr_library * object = inObject ;
+  macroValidSharedObject (object, cPtr_library) ;
+  GALGAS_location var_where_12270 = callExtensionGetter_location ((const cPtr_gtlInstruction *) constinArgument_instruction.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 543)) ;
+  enumGalgasBool test_0 = kBoolTrue ;
+  if (kBoolTrue == test_0) {
+    test_0 = var_where_12270.getter_isNowhere (SOURCE_FILE ("gtl_types.galgas", 544)).operator_not (SOURCE_FILE ("gtl_types.galgas", 544)).boolEnum () ;
+    if (kBoolTrue == test_0) {
+      {
+      extensionSetter_addSample (object->mProperty_lineProfile, var_where_12270.getter_file (inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 546)).add_operation (GALGAS_string (":"), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 546)).add_operation (var_where_12270.getter_line (inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 546)).getter_string (SOURCE_FILE ("gtl_types.galgas", 546)), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 546)), constinArgument_timer, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 545)) ;
+      }
+    }
+  }
+}
+//----------------------------------------------------------------------------------------------------------------------
+
+static void defineExtensionSetter_library_profileInstruction (void) {
+  enterExtensionSetter_profileInstruction (kTypeDescriptor_GALGAS_library.mSlotID,
+                                           extensionSetter_library_profileInstruction) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static void freeExtensionModifier_library_profileInstruction (void) {
+  gExtensionModifierTable_library_profileInstruction.free () ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_PrologueEpilogue gSetter_library_profileInstruction (defineExtensionSetter_library_profileInstruction,
+                                                       freeExtensionModifier_library_profileInstruction) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Extension setter '@library enterProfileFrame'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+static TC_UniqueArray <extensionSetterSignature_library_enterProfileFrame> gExtensionModifierTable_library_enterProfileFrame ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void enterExtensionSetter_enterProfileFrame (const int32_t inClassIndex,
+                                             extensionSetterSignature_library_enterProfileFrame inModifier) {
+  gExtensionModifierTable_library_enterProfileFrame.forceObjectAtIndex (inClassIndex, inModifier, NULL COMMA_HERE) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void callExtensionSetter_enterProfileFrame (cPtr_library * inObject,
+                                            const GALGAS_string constin_frame,
+                                            GALGAS_string & out_callerStack,
+                                            C_Compiler * inCompiler
+                                            COMMA_LOCATION_ARGS) {
+//--- Drop output arguments
+  out_callerStack.drop () ;
+//--- Find setter
+  if (NULL != inObject) {
+    macroValidSharedObject (inObject, cPtr_library) ;
+    const C_galgas_type_descriptor * info = inObject->classDescriptor () ;
+    const int32_t classIndex = info->mSlotID ;
+    extensionSetterSignature_library_enterProfileFrame f = NULL ;
+    if (classIndex < gExtensionModifierTable_library_enterProfileFrame.count ()) {
+      f = gExtensionModifierTable_library_enterProfileFrame (classIndex COMMA_HERE) ;
+    }
+    if (NULL == f) {
+       const C_galgas_type_descriptor * p = info->mSuperclassDescriptor ;
+       while ((NULL == f) && (NULL != p)) {
+         if (p->mSlotID < gExtensionModifierTable_library_enterProfileFrame.count ()) {
+           f = gExtensionModifierTable_library_enterProfileFrame (p->mSlotID COMMA_HERE) ;
+         }
+         p = p->mSuperclassDescriptor ;
+       }
+       gExtensionModifierTable_library_enterProfileFrame.forceObjectAtIndex (classIndex, f, NULL COMMA_HERE) ;
+    }
+    f (inObject, constin_frame, out_callerStack, inCompiler COMMA_THERE) ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static void extensionSetter_library_enterProfileFrame (cPtr_library * inObject,
+                                                       const GALGAS_string constinArgument_frame,
+                                                       GALGAS_string & outArgument_callerStack,
+                                                       C_Compiler * inCompiler
+                                                       COMMA_UNUSED_LOCATION_ARGS) {
+  cPtr_library * object = inObject ;
+  macroValidSharedObject (object, cPtr_library) ;
+  outArgument_callerStack = object->mProperty_profileStack ;
+  enumGalgasBool test_0 = kBoolTrue ;
+  if (kBoolTrue == test_0) {
+    test_0 = GALGAS_bool (kIsEqual, object->mProperty_profileStack.objectCompare (GALGAS_string::makeEmptyString ())).boolEnum () ;
+    if (kBoolTrue == test_0) {
+      object->mProperty_profileStack = constinArgument_frame ;
+    }
+  }
+  if (kBoolFalse == test_0) {
+    object->mProperty_profileStack.plusAssign_operation(GALGAS_string (";").add_operation (constinArgument_frame, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 560)), inCompiler  COMMA_SOURCE_FILE ("gtl_types.galgas", 560)) ;
+  }
+}
+//----------------------------------------------------------------------------------------------------------------------
+
+static void defineExtensionSetter_library_enterProfileFrame (void) {
+  enterExtensionSetter_enterProfileFrame (kTypeDescriptor_GALGAS_library.mSlotID,
+                                          extensionSetter_library_enterProfileFrame) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static void freeExtensionModifier_library_enterProfileFrame (void) {
+  gExtensionModifierTable_library_enterProfileFrame.free () ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_PrologueEpilogue gSetter_library_enterProfileFrame (defineExtensionSetter_library_enterProfileFrame,
+                                                      freeExtensionModifier_library_enterProfileFrame) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Extension setter '@library leaveProfileFrame'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+static TC_UniqueArray <extensionSetterSignature_library_leaveProfileFrame> gExtensionModifierTable_library_leaveProfileFrame ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void enterExtensionSetter_leaveProfileFrame (const int32_t inClassIndex,
+                                             extensionSetterSignature_library_leaveProfileFrame inModifier) {
+  gExtensionModifierTable_library_leaveProfileFrame.forceObjectAtIndex (inClassIndex, inModifier, NULL COMMA_HERE) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void callExtensionSetter_leaveProfileFrame (cPtr_library * inObject,
+                                            const GALGAS_string constin_callerStack,
+                                            const GALGAS_timer constin_timer,
+                                            C_Compiler * inCompiler
+                                            COMMA_LOCATION_ARGS) {
+//--- Drop output arguments
+//--- Find setter
+  if (NULL != inObject) {
+    macroValidSharedObject (inObject, cPtr_library) ;
+    const C_galgas_type_descriptor * info = inObject->classDescriptor () ;
+    const int32_t classIndex = info->mSlotID ;
+    extensionSetterSignature_library_leaveProfileFrame f = NULL ;
+    if (classIndex < gExtensionModifierTable_library_leaveProfileFrame.count ()) {
+      f = gExtensionModifierTable_library_leaveProfileFrame (classIndex COMMA_HERE) ;
+    }
+    if (NULL == f) {
+       const C_galgas_type_descriptor * p = info->mSuperclassDescriptor ;
+       while ((NULL == f) && (NULL != p)) {
+         if (p->mSlotID < gExtensionModifierTable_library_leaveProfileFrame.count ()) {
+           f = gExtensionModifierTable_library_leaveProfileFrame (p->mSlotID COMMA_HERE) ;
+         }
+         p = p->mSuperclassDescriptor ;
+       }
+       gExtensionModifierTable_library_leaveProfileFrame.forceObjectAtIndex (classIndex, f, NULL COMMA_HERE) ;
+    }
+    f (inObject, constin_callerStack, constin_timer, inCompiler COMMA_THERE) ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static void extensionSetter_library_leaveProfileFrame (cPtr_library * inObject,
+                                                       const GALGAS_string constinArgument_callerStack,
+                                                       const GALGAS_timer constinArgument_timer,
+                                                       C_Compiler * inCompiler
+                                                       COMMA_UNUSED_LOCATION_ARGS) {
+  cPtr_library * object = inObject ;
+  macroValidSharedObject (object, cPtr_library) ;
+  {
+  extensionSetter_addSample (object->mProperty_stackProfile, object->mProperty_profileStack, constinArgument_timer, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 568)) ;
+  }
+  object->mProperty_profileStack = constinArgument_callerStack ;
+}
+//----------------------------------------------------------------------------------------------------------------------
+
+static void defineExtensionSetter_library_leaveProfileFrame (void) {
+  enterExtensionSetter_leaveProfileFrame (kTypeDescriptor_GALGAS_library.mSlotID,
+                                          extensionSetter_library_leaveProfileFrame) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static void freeExtensionModifier_library_leaveProfileFrame (void) {
+  gExtensionModifierTable_library_leaveProfileFrame.free () ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_PrologueEpilogue gSetter_library_leaveProfileFrame (defineExtensionSetter_library_leaveProfileFrame,
+                                                      freeExtensionModifier_library_leaveProfileFrame) ;
+
 //----------------------------------------------------------------------------------------------------------------------
 //   Object comparison                                                                           
 //----------------------------------------------------------------------------------------------------------------------
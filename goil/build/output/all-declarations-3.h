@@ -2032,6 +2032,81 @@ void callExtensionSetter_getTemplate (class cPtr_library * inObject,
                                       C_Compiler * inCompiler
                                       COMMA_LOCATION_ARGS) ;
 
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Extension setter '@library forgetChangedFiles'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+typedef void (*extensionSetterSignature_library_forgetChangedFiles) (class cPtr_library * inObject,
+                                                                     const class GALGAS_stringlist constinArgument0,
+                                                                     const class GALGAS_string constinArgument1,
+                                                                     class C_Compiler * inCompiler
+                                                                     COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void enterExtensionSetter_forgetChangedFiles (const int32_t inClassIndex,
+                                              extensionSetterSignature_library_forgetChangedFiles inModifier) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void callExtensionSetter_forgetChangedFiles (class cPtr_library * inObject,
+                                             const GALGAS_stringlist constin_changedFiles,
+                                             const GALGAS_string constin_templateExtension,
+                                             C_Compiler * inCompiler
+                                             COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Extension setter '@library enterProfileFrame'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+typedef void (*extensionSetterSignature_library_enterProfileFrame) (class cPtr_library * inObject,
+                                                                    const class GALGAS_string constinArgument0,
+                                                                    class GALGAS_string & outArgument1,
+                                                                    class C_Compiler * inCompiler
+                                                                    COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void enterExtensionSetter_enterProfileFrame (const int32_t inClassIndex,
+                                             extensionSetterSignature_library_enterProfileFrame inModifier) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void callExtensionSetter_enterProfileFrame (class cPtr_library * inObject,
+                                            const GALGAS_string constin_frame,
+                                            GALGAS_string & out_callerStack,
+                                            C_Compiler * inCompiler
+                                            COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Extension setter '@library leaveProfileFrame'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+typedef void (*extensionSetterSignature_library_leaveProfileFrame) (class cPtr_library * inObject,
+                                                                    const class GALGAS_string constinArgument0,
+                                                                    const class GALGAS_timer constinArgument1,
+                                                                    class C_Compiler * inCompiler
+                                                                    COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void enterExtensionSetter_leaveProfileFrame (const int32_t inClassIndex,
+                                             extensionSetterSignature_library_leaveProfileFrame inModifier) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void callExtensionSetter_leaveProfileFrame (class cPtr_library * inObject,
+                                            const GALGAS_string constin_callerStack,
+                                            const GALGAS_timer constin_timer,
+                                            C_Compiler * inCompiler
+                                            COMMA_LOCATION_ARGS) ;
+
 //----------------------------------------------------------------------------------------------------------------------
 //
 //Extension getter '@gtlVarItemField lstringPath'
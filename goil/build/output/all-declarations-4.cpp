@@ -3497,14 +3497,17 @@ static GALGAS_gtlData extensionGetter_gtlFunction_call (const cPtr_gtlFunction *
   if (kBoolTrue == test_1) {
     test_1 = var_ok_2864.boolEnum () ;
     if (kBoolTrue == test_1) {
+      {
+      inArgument_lib.setter_setOutputFile (GALGAS_string::makeEmptyString () COMMA_SOURCE_FILE ("gtl_module.galgas", 119)) ;
+      }
       GALGAS_string var_outputString_3036 = GALGAS_string::makeEmptyString () ;
-      extensionMethod_execute (object->mProperty_instructions, inArgument_context, var_funcVariableMap_2854, inArgument_lib, var_outputString_3036, inCompiler COMMA_SOURCE_FILE ("gtl_module.galgas", 119)) ;
-      result_result = callExtensionGetter_resultField ((const cPtr_gtlData *) var_funcVariableMap_2854.ptr (), object->mProperty_returnVariable, inCompiler COMMA_SOURCE_FILE ("gtl_module.galgas", 120)) ;
+      extensionMethod_execute (object->mProperty_instructions, inArgument_context, var_funcVariableMap_2854, inArgument_lib, var_outputString_3036, inCompiler COMMA_SOURCE_FILE ("gtl_module.galgas", 121)) ;
+      result_result = callExtensionGetter_resultField ((const cPtr_gtlData *) var_funcVariableMap_2854.ptr (), object->mProperty_returnVariable, inCompiler COMMA_SOURCE_FILE ("gtl_module.galgas", 122)) ;
     }
   }
   if (kBoolFalse == test_1) {
     TC_Array <C_FixItDescription> fixItArray2 ;
-    inCompiler->emitSemanticError (constinArgument_fromLocation, GALGAS_string ("function call failed"), fixItArray2  COMMA_SOURCE_FILE ("gtl_module.galgas", 122)) ;
+    inCompiler->emitSemanticError (constinArgument_fromLocation, GALGAS_string ("function call failed"), fixItArray2  COMMA_SOURCE_FILE ("gtl_module.galgas", 124)) ;
     result_result.drop () ; // Release error dropped variable
   }
 //---
@@ -3804,11 +3807,11 @@ static GALGAS_gtlData extensionGetter_gtlGetter_callGetter (const cPtr_gtlGetter
   GALGAS_gtlData var_getterVariableMap_3682 ;
   GALGAS_bool var_ok_3692 ;
   const GALGAS_gtlGetter temp_0 = object ;
-  callExtensionMethod_checkArguments ((const cPtr_gtlGetter *) temp_0.ptr (), constinArgument_fromLocation, constinArgument_actualArguments, var_getterVariableMap_3682, var_ok_3692, inCompiler COMMA_SOURCE_FILE ("gtl_module.galgas", 140)) ;
+  callExtensionMethod_checkArguments ((const cPtr_gtlGetter *) temp_0.ptr (), constinArgument_fromLocation, constinArgument_actualArguments, var_getterVariableMap_3682, var_ok_3692, inCompiler COMMA_SOURCE_FILE ("gtl_module.galgas", 142)) ;
   {
   var_getterVariableMap_3682.insulate (HERE) ;
   cPtr_gtlData * ptr_3716 = (cPtr_gtlData *) var_getterVariableMap_3682.ptr () ;
-  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_3716, object->mProperty_returnVariable, GALGAS_gtlUnconstructed::constructor_new (object->mProperty_returnVariable.getter_location (SOURCE_FILE ("gtl_module.galgas", 144)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_module.galgas", 144))  COMMA_SOURCE_FILE ("gtl_module.galgas", 144)), inCompiler COMMA_SOURCE_FILE ("gtl_module.galgas", 142)) ;
+  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_3716, object->mProperty_returnVariable, GALGAS_gtlUnconstructed::constructor_new (object->mProperty_returnVariable.getter_location (SOURCE_FILE ("gtl_module.galgas", 146)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_module.galgas", 146))  COMMA_SOURCE_FILE ("gtl_module.galgas", 146)), inCompiler COMMA_SOURCE_FILE ("gtl_module.galgas", 144)) ;
   }
   enumGalgasBool test_1 = kBoolTrue ;
   if (kBoolTrue == test_1) {
@@ -3817,16 +3820,19 @@ static GALGAS_gtlData extensionGetter_gtlGetter_callGetter (const cPtr_gtlGetter
       {
       var_getterVariableMap_3682.insulate (HERE) ;
       cPtr_gtlData * ptr_3866 = (cPtr_gtlData *) var_getterVariableMap_3682.ptr () ;
-      callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_3866, GALGAS_lstring::constructor_new (GALGAS_string ("self"), constinArgument_fromLocation  COMMA_SOURCE_FILE ("gtl_module.galgas", 148)), constinArgument_target, inCompiler COMMA_SOURCE_FILE ("gtl_module.galgas", 147)) ;
+      callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_3866, GALGAS_lstring::constructor_new (GALGAS_string ("self"), constinArgument_fromLocation  COMMA_SOURCE_FILE ("gtl_module.galgas", 150)), constinArgument_target, inCompiler COMMA_SOURCE_FILE ("gtl_module.galgas", 149)) ;
+      }
+      {
+      inArgument_lib.setter_setOutputFile (GALGAS_string::makeEmptyString () COMMA_SOURCE_FILE ("gtl_module.galgas", 154)) ;
       }
       GALGAS_string var_outputString_3964 = GALGAS_string::makeEmptyString () ;
-      extensionMethod_execute (object->mProperty_instructions, inArgument_context, var_getterVariableMap_3682, inArgument_lib, var_outputString_3964, inCompiler COMMA_SOURCE_FILE ("gtl_module.galgas", 152)) ;
-      result_result = callExtensionGetter_resultField ((const cPtr_gtlData *) var_getterVariableMap_3682.ptr (), object->mProperty_returnVariable, inCompiler COMMA_SOURCE_FILE ("gtl_module.galgas", 153)) ;
+      extensionMethod_execute (object->mProperty_instructions, inArgument_context, var_getterVariableMap_3682, inArgument_lib, var_outputString_3964, inCompiler COMMA_SOURCE_FILE ("gtl_module.galgas", 156)) ;
+      result_result = callExtensionGetter_resultField ((const cPtr_gtlData *) var_getterVariableMap_3682.ptr (), object->mProperty_returnVariable, inCompiler COMMA_SOURCE_FILE ("gtl_module.galgas", 157)) ;
     }
   }
   if (kBoolFalse == test_1) {
     TC_Array <C_FixItDescription> fixItArray2 ;
-    inCompiler->emitSemanticError (constinArgument_fromLocation, GALGAS_string ("getter call failed"), fixItArray2  COMMA_SOURCE_FILE ("gtl_module.galgas", 155)) ;
+    inCompiler->emitSemanticError (constinArgument_fromLocation, GALGAS_string ("getter call failed"), fixItArray2  COMMA_SOURCE_FILE ("gtl_module.galgas", 159)) ;
     result_result.drop () ; // Release error dropped variable
   }
 //---
@@ -3909,7 +3915,7 @@ static GALGAS_lstring extensionGetter_gtlGetter_typedName (const cPtr_gtlGetter
   GALGAS_lstring result_result ; // Returned variable
   const cPtr_gtlGetter * object = inObject ;
   macroValidSharedObject (object, cPtr_gtlGetter) ;
-  result_result = GALGAS_lstring::constructor_new (extensionGetter_typeName (object->mProperty_targetType, inCompiler COMMA_SOURCE_FILE ("gtl_module.galgas", 162)).add_operation (object->mProperty_name.getter_string (SOURCE_FILE ("gtl_module.galgas", 162)), inCompiler COMMA_SOURCE_FILE ("gtl_module.galgas", 162)), object->mProperty_where  COMMA_SOURCE_FILE ("gtl_module.galgas", 162)) ;
+  result_result = GALGAS_lstring::constructor_new (extensionGetter_typeName (object->mProperty_targetType, inCompiler COMMA_SOURCE_FILE ("gtl_module.galgas", 166)).add_operation (object->mProperty_name.getter_string (SOURCE_FILE ("gtl_module.galgas", 166)), inCompiler COMMA_SOURCE_FILE ("gtl_module.galgas", 166)), object->mProperty_where  COMMA_SOURCE_FILE ("gtl_module.galgas", 166)) ;
 //---
   return result_result ;
 }
@@ -4196,26 +4202,29 @@ static void extensionMethod_gtlSetter_callSetter (const cPtr_gtlSetter * inObjec
   GALGAS_gtlData var_setterVariableMap_4709 ;
   GALGAS_bool var_ok_4719 ;
   const GALGAS_gtlSetter temp_0 = object ;
-  callExtensionMethod_checkArguments ((const cPtr_gtlSetter *) temp_0.ptr (), constinArgument_fromLocation, constinArgument_actualArguments, var_setterVariableMap_4709, var_ok_4719, inCompiler COMMA_SOURCE_FILE ("gtl_module.galgas", 178)) ;
+  callExtensionMethod_checkArguments ((const cPtr_gtlSetter *) temp_0.ptr (), constinArgument_fromLocation, constinArgument_actualArguments, var_setterVariableMap_4709, var_ok_4719, inCompiler COMMA_SOURCE_FILE ("gtl_module.galgas", 182)) ;
   enumGalgasBool test_1 = kBoolTrue ;
   if (kBoolTrue == test_1) {
     test_1 = var_ok_4719.boolEnum () ;
     if (kBoolTrue == test_1) {
-      GALGAS_lstring var_selfName_4759 = GALGAS_lstring::constructor_new (GALGAS_string ("self"), constinArgument_fromLocation  COMMA_SOURCE_FILE ("gtl_module.galgas", 181)) ;
+      GALGAS_lstring var_selfName_4759 = GALGAS_lstring::constructor_new (GALGAS_string ("self"), constinArgument_fromLocation  COMMA_SOURCE_FILE ("gtl_module.galgas", 185)) ;
       {
       var_setterVariableMap_4709.insulate (HERE) ;
       cPtr_gtlData * ptr_4817 = (cPtr_gtlData *) var_setterVariableMap_4709.ptr () ;
-      callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_4817, var_selfName_4759, ioArgument_target, inCompiler COMMA_SOURCE_FILE ("gtl_module.galgas", 182)) ;
+      callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_4817, var_selfName_4759, ioArgument_target, inCompiler COMMA_SOURCE_FILE ("gtl_module.galgas", 186)) ;
+      }
+      {
+      inArgument_lib.setter_setOutputFile (GALGAS_string::makeEmptyString () COMMA_SOURCE_FILE ("gtl_module.galgas", 191)) ;
       }
       GALGAS_string var_outputString_4893 = GALGAS_string::makeEmptyString () ;
-      extensionMethod_execute (object->mProperty_instructions, inArgument_context, var_setterVariableMap_4709, inArgument_lib, var_outputString_4893, inCompiler COMMA_SOURCE_FILE ("gtl_module.galgas", 187)) ;
+      extensionMethod_execute (object->mProperty_instructions, inArgument_context, var_setterVariableMap_4709, inArgument_lib, var_outputString_4893, inCompiler COMMA_SOURCE_FILE ("gtl_module.galgas", 193)) ;
       GALGAS_bool joker_5031 ; // Joker input parameter
-      callExtensionMethod_structField ((const cPtr_gtlData *) var_setterVariableMap_4709.ptr (), var_selfName_4759, ioArgument_target, joker_5031, inCompiler COMMA_SOURCE_FILE ("gtl_module.galgas", 188)) ;
+      callExtensionMethod_structField ((const cPtr_gtlData *) var_setterVariableMap_4709.ptr (), var_selfName_4759, ioArgument_target, joker_5031, inCompiler COMMA_SOURCE_FILE ("gtl_module.galgas", 194)) ;
     }
   }
   if (kBoolFalse == test_1) {
     TC_Array <C_FixItDescription> fixItArray2 ;
-    inCompiler->emitSemanticError (constinArgument_fromLocation, GALGAS_string ("setter call failed"), fixItArray2  COMMA_SOURCE_FILE ("gtl_module.galgas", 190)) ;
+    inCompiler->emitSemanticError (constinArgument_fromLocation, GALGAS_string ("setter call failed"), fixItArray2  COMMA_SOURCE_FILE ("gtl_module.galgas", 196)) ;
   }
 }
 //----------------------------------------------------------------------------------------------------------------------
@@ -4293,7 +4302,7 @@ static GALGAS_lstring extensionGetter_gtlSetter_typedName (const cPtr_gtlSetter
   GALGAS_lstring result_result ; // Returned variable
   const cPtr_gtlSetter * object = inObject ;
   macroValidSharedObject (object, cPtr_gtlSetter) ;
-  result_result = GALGAS_lstring::constructor_new (extensionGetter_typeName (object->mProperty_targetType, inCompiler COMMA_SOURCE_FILE ("gtl_module.galgas", 197)).add_operation (object->mProperty_name.getter_string (SOURCE_FILE ("gtl_module.galgas", 197)), inCompiler COMMA_SOURCE_FILE ("gtl_module.galgas", 197)), object->mProperty_where  COMMA_SOURCE_FILE ("gtl_module.galgas", 197)) ;
+  result_result = GALGAS_lstring::constructor_new (extensionGetter_typeName (object->mProperty_targetType, inCompiler COMMA_SOURCE_FILE ("gtl_module.galgas", 203)).add_operation (object->mProperty_name.getter_string (SOURCE_FILE ("gtl_module.galgas", 203)), inCompiler COMMA_SOURCE_FILE ("gtl_module.galgas", 203)), object->mProperty_where  COMMA_SOURCE_FILE ("gtl_module.galgas", 203)) ;
 //---
   return result_result ;
 }
@@ -7812,42 +7821,42 @@ static void extensionMethod_gtlForeachStatementInstruction_iterateOnMap (const c
   const cPtr_gtlForeachStatementInstruction * object = inObject ;
   macroValidSharedObject (object, cPtr_gtlForeachStatementInstruction) ;
   GALGAS_lstring temp_0 ;
-  const enumGalgasBool test_1 = GALGAS_bool (kIsEqual, GALGAS_string::makeEmptyString ().objectCompare (object->mProperty_keyName.getter_string (SOURCE_FILE ("gtl_instructions.galgas", 619)))).boolEnum () ;
+  const enumGalgasBool test_1 = GALGAS_bool (kIsEqual, GALGAS_string::makeEmptyString ().objectCompare (object->mProperty_keyName.getter_string (SOURCE_FILE ("gtl_instructions.galgas", 691)))).boolEnum () ;
   if (kBoolTrue == test_1) {
-    temp_0 = GALGAS_lstring::constructor_new (GALGAS_string ("KEY"), object->mProperty_keyName.getter_location (SOURCE_FILE ("gtl_instructions.galgas", 620))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 620)) ;
+    temp_0 = GALGAS_lstring::constructor_new (GALGAS_string ("KEY"), object->mProperty_keyName.getter_location (SOURCE_FILE ("gtl_instructions.galgas", 692))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 692)) ;
   }else if (kBoolFalse == test_1) {
     temp_0 = object->mProperty_keyName ;
   }
   GALGAS_lstring var_actualKeyName_18042 = temp_0 ;
-  cEnumerator_gtlVarMap enumerator_18155 (constinArgument_iterableMap.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 625)), kENUMERATION_UP) ;
+  cEnumerator_gtlVarMap enumerator_18155 (constinArgument_iterableMap.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 697)), kENUMERATION_UP) ;
   GALGAS_uint index_18129 ((uint32_t) 0) ;
   const bool bool_2 = true ;
   if (enumerator_18155.hasCurrentObject () && bool_2) {
-    extensionMethod_execute (object->mProperty_beforeList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 627)) ;
+    extensionMethod_execute (object->mProperty_beforeList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 699)) ;
     while (enumerator_18155.hasCurrentObject () && bool_2) {
       {
       ioArgument_vars.insulate (HERE) ;
       cPtr_gtlData * ptr_18252 = (cPtr_gtlData *) ioArgument_vars.ptr () ;
-      callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_18252, object->mProperty_variableName, enumerator_18155.current_value (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 629)) ;
+      callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_18252, object->mProperty_variableName, enumerator_18155.current_value (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 701)) ;
       }
       {
       ioArgument_vars.insulate (HERE) ;
       cPtr_gtlData * ptr_18301 = (cPtr_gtlData *) ioArgument_vars.ptr () ;
-      callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_18301, var_actualKeyName_18042, GALGAS_gtlString::constructor_new (object->mProperty_keyName.getter_location (SOURCE_FILE ("gtl_instructions.galgas", 631)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 631)), enumerator_18155.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 631))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 631)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 630)) ;
+      callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_18301, var_actualKeyName_18042, GALGAS_gtlString::constructor_new (object->mProperty_keyName.getter_location (SOURCE_FILE ("gtl_instructions.galgas", 703)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 703)), enumerator_18155.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 703))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 703)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 702)) ;
       }
       {
       ioArgument_vars.insulate (HERE) ;
       cPtr_gtlData * ptr_18415 = (cPtr_gtlData *) ioArgument_vars.ptr () ;
-      callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_18415, object->mProperty_indexName, GALGAS_gtlInt::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 634)), index_18129.getter_bigint (SOURCE_FILE ("gtl_instructions.galgas", 634))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 634)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 633)) ;
+      callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_18415, object->mProperty_indexName, GALGAS_gtlInt::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 706)), index_18129.getter_bigint (SOURCE_FILE ("gtl_instructions.galgas", 706))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 706)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 705)) ;
       }
-      extensionMethod_execute (object->mProperty_doList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 636)) ;
+      extensionMethod_execute (object->mProperty_doList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 708)) ;
       enumerator_18155.gotoNextObject () ;
       index_18129.increment () ;
       if (enumerator_18155.hasCurrentObject () && bool_2) {
-        extensionMethod_execute (object->mProperty_betweenList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 638)) ;
+        extensionMethod_execute (object->mProperty_betweenList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 710)) ;
       }
     }
-    extensionMethod_execute (object->mProperty_afterList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 640)) ;
+    extensionMethod_execute (object->mProperty_afterList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 712)) ;
   }
 }
 //----------------------------------------------------------------------------------------------------------------------
@@ -7933,36 +7942,36 @@ static void extensionMethod_gtlForeachStatementInstruction_iterateOnList (const
   macroValidSharedObject (object, cPtr_gtlForeachStatementInstruction) ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = GALGAS_bool (kIsNotEqual, GALGAS_string::makeEmptyString ().objectCompare (object->mProperty_keyName.getter_string (SOURCE_FILE ("gtl_instructions.galgas", 651)))).boolEnum () ;
+    test_0 = GALGAS_bool (kIsNotEqual, GALGAS_string::makeEmptyString ().objectCompare (object->mProperty_keyName.getter_string (SOURCE_FILE ("gtl_instructions.galgas", 723)))).boolEnum () ;
     if (kBoolTrue == test_0) {
       TC_Array <C_FixItDescription> fixItArray1 ;
-      inCompiler->emitSemanticWarning (object->mProperty_keyName.getter_location (SOURCE_FILE ("gtl_instructions.galgas", 652)), GALGAS_string ("a key variable cannot be define when iterating on a list"), fixItArray1  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 652)) ;
+      inCompiler->emitSemanticWarning (object->mProperty_keyName.getter_location (SOURCE_FILE ("gtl_instructions.galgas", 724)), GALGAS_string ("a key variable cannot be define when iterating on a list"), fixItArray1  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 724)) ;
     }
   }
-  cEnumerator_list enumerator_19048 (constinArgument_iterableList.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 654)), kENUMERATION_UP) ;
+  cEnumerator_list enumerator_19048 (constinArgument_iterableList.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 726)), kENUMERATION_UP) ;
   GALGAS_uint index_19021 ((uint32_t) 0) ;
   const bool bool_2 = true ;
   if (enumerator_19048.hasCurrentObject () && bool_2) {
-    extensionMethod_execute (object->mProperty_beforeList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 656)) ;
+    extensionMethod_execute (object->mProperty_beforeList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 728)) ;
     while (enumerator_19048.hasCurrentObject () && bool_2) {
       {
       ioArgument_vars.insulate (HERE) ;
       cPtr_gtlData * ptr_19145 = (cPtr_gtlData *) ioArgument_vars.ptr () ;
-      callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_19145, object->mProperty_variableName, enumerator_19048.current_value (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 658)) ;
+      callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_19145, object->mProperty_variableName, enumerator_19048.current_value (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 730)) ;
       }
       {
       ioArgument_vars.insulate (HERE) ;
       cPtr_gtlData * ptr_19194 = (cPtr_gtlData *) ioArgument_vars.ptr () ;
-      callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_19194, object->mProperty_indexName, GALGAS_gtlInt::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 660)), index_19021.getter_bigint (SOURCE_FILE ("gtl_instructions.galgas", 660))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 660)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 659)) ;
+      callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_19194, object->mProperty_indexName, GALGAS_gtlInt::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 732)), index_19021.getter_bigint (SOURCE_FILE ("gtl_instructions.galgas", 732))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 732)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 731)) ;
       }
-      extensionMethod_execute (object->mProperty_doList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 662)) ;
+      extensionMethod_execute (object->mProperty_doList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 734)) ;
       enumerator_19048.gotoNextObject () ;
       index_19021.increment () ;
       if (enumerator_19048.hasCurrentObject () && bool_2) {
-        extensionMethod_execute (object->mProperty_betweenList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 664)) ;
+        extensionMethod_execute (object->mProperty_betweenList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 736)) ;
       }
     }
-    extensionMethod_execute (object->mProperty_afterList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 666)) ;
+    extensionMethod_execute (object->mProperty_afterList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 738)) ;
   }
 }
 //----------------------------------------------------------------------------------------------------------------------
@@ -8048,36 +8057,36 @@ static void extensionMethod_gtlForeachStatementInstruction_iterateOnSet (const c
   macroValidSharedObject (object, cPtr_gtlForeachStatementInstruction) ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = GALGAS_bool (kIsNotEqual, GALGAS_string::makeEmptyString ().objectCompare (object->mProperty_keyName.getter_string (SOURCE_FILE ("gtl_instructions.galgas", 677)))).boolEnum () ;
+    test_0 = GALGAS_bool (kIsNotEqual, GALGAS_string::makeEmptyString ().objectCompare (object->mProperty_keyName.getter_string (SOURCE_FILE ("gtl_instructions.galgas", 749)))).boolEnum () ;
     if (kBoolTrue == test_0) {
       TC_Array <C_FixItDescription> fixItArray1 ;
-      inCompiler->emitSemanticWarning (object->mProperty_keyName.getter_location (SOURCE_FILE ("gtl_instructions.galgas", 678)), GALGAS_string ("a key variable cannot be define when iterating on a set"), fixItArray1  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 678)) ;
+      inCompiler->emitSemanticWarning (object->mProperty_keyName.getter_location (SOURCE_FILE ("gtl_instructions.galgas", 750)), GALGAS_string ("a key variable cannot be define when iterating on a set"), fixItArray1  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 750)) ;
     }
   }
-  cEnumerator_lstringset enumerator_19818 (constinArgument_iterableSet.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 680)), kENUMERATION_UP) ;
+  cEnumerator_lstringset enumerator_19818 (constinArgument_iterableSet.getter_value (SOURCE_FILE ("gtl_instructions.galgas", 752)), kENUMERATION_UP) ;
   GALGAS_uint index_19792 ((uint32_t) 0) ;
   const bool bool_2 = true ;
   if (enumerator_19818.hasCurrentObject () && bool_2) {
-    extensionMethod_execute (object->mProperty_beforeList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 682)) ;
+    extensionMethod_execute (object->mProperty_beforeList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 754)) ;
     while (enumerator_19818.hasCurrentObject () && bool_2) {
       {
       ioArgument_vars.insulate (HERE) ;
       cPtr_gtlData * ptr_19915 = (cPtr_gtlData *) ioArgument_vars.ptr () ;
-      callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_19915, object->mProperty_variableName, GALGAS_gtlString::constructor_new (enumerator_19818.current_lkey (HERE).getter_location (SOURCE_FILE ("gtl_instructions.galgas", 686)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 686)), enumerator_19818.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 686))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 686)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 684)) ;
+      callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_19915, object->mProperty_variableName, GALGAS_gtlString::constructor_new (enumerator_19818.current_lkey (HERE).getter_location (SOURCE_FILE ("gtl_instructions.galgas", 758)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 758)), enumerator_19818.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_instructions.galgas", 758))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 758)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 756)) ;
       }
       {
       ioArgument_vars.insulate (HERE) ;
       cPtr_gtlData * ptr_20022 = (cPtr_gtlData *) ioArgument_vars.ptr () ;
-      callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_20022, object->mProperty_indexName, GALGAS_gtlInt::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 689)), index_19792.getter_bigint (SOURCE_FILE ("gtl_instructions.galgas", 689))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 689)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 688)) ;
+      callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_20022, object->mProperty_indexName, GALGAS_gtlInt::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 761)), index_19792.getter_bigint (SOURCE_FILE ("gtl_instructions.galgas", 761))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 761)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 760)) ;
       }
-      extensionMethod_execute (object->mProperty_doList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 691)) ;
+      extensionMethod_execute (object->mProperty_doList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 763)) ;
       enumerator_19818.gotoNextObject () ;
       index_19792.increment () ;
       if (enumerator_19818.hasCurrentObject () && bool_2) {
-        extensionMethod_execute (object->mProperty_betweenList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 693)) ;
+        extensionMethod_execute (object->mProperty_betweenList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 765)) ;
       }
     }
-    extensionMethod_execute (object->mProperty_afterList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 695)) ;
+    extensionMethod_execute (object->mProperty_afterList, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 767)) ;
   }
 }
 //----------------------------------------------------------------------------------------------------------------------
@@ -8296,6 +8296,7 @@ void cParser_implementation_5F_parser::rule_implementation_5F_parser_include_5F_
 //---------------------------------------------------------------------------------------------------------------------*
 
 void cParser_implementation_5F_parser::rule_implementation_5F_parser_include_5F_type_5F_level_i3_ (GALGAS_implementationObjectMap & ioArgument_objectAttributes,
+                                                                                                   GALGAS_implementationMap & ioArgument_includeCache,
                                                                                                    C_Lexique_goil_5F_lexique * inCompiler) {
   GALGAS_bool var_includeIfExists_1820 = GALGAS_bool (false) ;
   switch (select_implementation_5F_parser_3 (inCompiler)) {
@@ -8337,7 +8338,51 @@ void cParser_implementation_5F_parser::rule_implementation_5F_parser_include_5F_
     }
     test_0 = test_1.boolEnum () ;
     if (kBoolTrue == test_0) {
-      cGrammar_goil_5F_type_5F_level_5F_include::_performSourceFileParsing_ (inCompiler, var_file_5F_name_1928, ioArgument_objectAttributes  COMMA_SOURCE_FILE ("implementation_parser.galgas", 90)) ;
+      GALGAS_implementationObjectMap var_includedAttributes_2521 ;
+      enumGalgasBool test_3 = kBoolTrue ;
+      if (kBoolTrue == test_3) {
+        test_3 = ioArgument_includeCache.getter_hasKey (var_file_5F_name_1928.getter_string (SOURCE_FILE ("implementation_parser.galgas", 97)) COMMA_SOURCE_FILE ("implementation_parser.galgas", 97)).boolEnum () ;
+        if (kBoolTrue == test_3) {
+          GALGAS_implementationObject var_included_2646 ;
+          ioArgument_includeCache.method_get (var_file_5F_name_1928, var_included_2646, inCompiler COMMA_SOURCE_FILE ("implementation_parser.galgas", 98)) ;
+          var_includedAttributes_2521 = var_included_2646.getter_attributes (SOURCE_FILE ("implementation_parser.galgas", 99)) ;
+        }
+      }
+      if (kBoolFalse == test_3) {
+        var_includedAttributes_2521 = GALGAS_implementationObjectMap::constructor_emptyMap (SOURCE_FILE ("implementation_parser.galgas", 101)) ;
+        cGrammar_goil_5F_type_5F_level_5F_include::_performSourceFileParsing_ (inCompiler, var_file_5F_name_1928, var_includedAttributes_2521, ioArgument_includeCache  COMMA_SOURCE_FILE ("implementation_parser.galgas", 102)) ;
+        {
+        ioArgument_includeCache.setter_put (var_file_5F_name_1928, GALGAS_implementationObject::constructor_new (GALGAS_lbool::constructor_new (GALGAS_bool (false), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("implementation_parser.galgas", 103))  COMMA_SOURCE_FILE ("implementation_parser.galgas", 103)), var_includedAttributes_2521  COMMA_SOURCE_FILE ("implementation_parser.galgas", 103)), inCompiler COMMA_SOURCE_FILE ("implementation_parser.galgas", 103)) ;
+        }
+      }
+      GALGAS_bool var_redefined_2983 = GALGAS_bool (false) ;
+      cEnumerator_implementationObjectMap enumerator_3024 (var_includedAttributes_2521, kENUMERATION_UP) ;
+      while (enumerator_3024.hasCurrentObject ()) {
+        enumGalgasBool test_4 = kBoolTrue ;
+        if (kBoolTrue == test_4) {
+          test_4 = ioArgument_objectAttributes.getter_hasKey (enumerator_3024.current_lkey (HERE).getter_string (SOURCE_FILE ("implementation_parser.galgas", 107)) COMMA_SOURCE_FILE ("implementation_parser.galgas", 107)).boolEnum () ;
+          if (kBoolTrue == test_4) {
+            var_redefined_2983 = GALGAS_bool (true) ;
+          }
+        }
+        enumerator_3024.gotoNextObject () ;
+      }
+      enumGalgasBool test_5 = kBoolTrue ;
+      if (kBoolTrue == test_5) {
+        test_5 = var_redefined_2983.boolEnum () ;
+        if (kBoolTrue == test_5) {
+          cGrammar_goil_5F_type_5F_level_5F_include::_performSourceFileParsing_ (inCompiler, var_file_5F_name_1928, ioArgument_objectAttributes, ioArgument_includeCache  COMMA_SOURCE_FILE ("implementation_parser.galgas", 112)) ;
+        }
+      }
+      if (kBoolFalse == test_5) {
+        cEnumerator_implementationObjectMap enumerator_3276 (var_includedAttributes_2521, kENUMERATION_UP) ;
+        while (enumerator_3276.hasCurrentObject ()) {
+          {
+          ioArgument_objectAttributes.setter_put (enumerator_3276.current_lkey (HERE), enumerator_3276.current_type (HERE), inCompiler COMMA_SOURCE_FILE ("implementation_parser.galgas", 115)) ;
+          }
+          enumerator_3276.gotoNextObject () ;
+        }
+      }
     }
   }
 }
@@ -8389,8 +8434,9 @@ void cParser_implementation_5F_parser::rule_implementation_5F_parser_implementat
     break ;
   }
   GALGAS_implementationObjectMap var_objectAttributes_2592 = GALGAS_implementationObjectMap::constructor_emptyMap (SOURCE_FILE ("implementation_parser.galgas", 108)) ;
+  GALGAS_implementationMap var_includeCache_3805 = GALGAS_implementationMap::constructor_emptyMap (SOURCE_FILE ("implementation_parser.galgas", 136)) ;
   inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7B_ COMMA_SOURCE_FILE ("implementation_parser.galgas", 110)) ;
-  nt_implementation_5F_list_ (var_objectAttributes_2592, inCompiler) ;
+  nt_implementation_5F_list_ (var_objectAttributes_2592, var_includeCache_3805, inCompiler) ;
   inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7D_ COMMA_SOURCE_FILE ("implementation_parser.galgas", 112)) ;
   GALGAS_implementationObject var_newObject_2697 = GALGAS_implementationObject::constructor_new (var_multiple_2375, var_objectAttributes_2592  COMMA_SOURCE_FILE ("implementation_parser.galgas", 114)) ;
   GALGAS_implementationObject var_object_2869 ;
@@ -8438,6 +8484,7 @@ void cParser_implementation_5F_parser::rule_implementation_5F_parser_implementat
 //---------------------------------------------------------------------------------------------------------------------*
 
 void cParser_implementation_5F_parser::rule_implementation_5F_parser_implementation_5F_list_i5_ (GALGAS_implementationObjectMap & ioArgument_objectAttributes,
+                                                                                                 GALGAS_implementationMap & ioArgument_includeCache,
                                                                                                  C_Lexique_goil_5F_lexique * inCompiler) {
   bool repeatFlag_0 = true ;
   while (repeatFlag_0) {
@@ -8445,7 +8492,7 @@ void cParser_implementation_5F_parser::rule_implementation_5F_parser_implementat
     case 2: {
       GALGAS_lstring var_attributeName_3301 ;
       GALGAS_impType var_type_3319 ;
-      nt_implementation_5F_type_ (var_attributeName_3301, var_type_3319, inCompiler) ;
+      nt_implementation_5F_type_ (var_attributeName_3301, var_type_3319, ioArgument_includeCache, inCompiler) ;
       enumGalgasBool test_1 = kBoolTrue ;
       if (kBoolTrue == test_1) {
         test_1 = ioArgument_objectAttributes.getter_hasKey (var_attributeName_3301.getter_string (SOURCE_FILE ("implementation_parser.galgas", 139)) COMMA_SOURCE_FILE ("implementation_parser.galgas", 139)).boolEnum () ;
@@ -8550,7 +8597,7 @@ void cParser_implementation_5F_parser::rule_implementation_5F_parser_implementat
       inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__3B_ COMMA_SOURCE_FILE ("implementation_parser.galgas", 203)) ;
     } break ;
     case 3: {
-      nt_include_5F_type_5F_level_ (ioArgument_objectAttributes, inCompiler) ;
+      nt_include_5F_type_5F_level_ (ioArgument_objectAttributes, ioArgument_includeCache, inCompiler) ;
     } break ;
     default:
       repeatFlag_0 = false ;
@@ -8584,6 +8631,7 @@ void cParser_implementation_5F_parser::rule_implementation_5F_parser_implementat
 
 void cParser_implementation_5F_parser::rule_implementation_5F_parser_implementation_5F_type_i6_ (GALGAS_lstring & outArgument_attributeName,
                                                                                                  GALGAS_impType & outArgument_type,
+                                                                                                 GALGAS_implementationMap & ioArgument_includeCache,
                                                                                                  C_Lexique_goil_5F_lexique * inCompiler) {
   outArgument_attributeName.drop () ; // Release 'out' argument
   outArgument_type.drop () ; // Release 'out' argument
@@ -8610,11 +8658,11 @@ void cParser_implementation_5F_parser::rule_implementation_5F_parser_implementat
   } break ;
   case 6: {
     inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_ENUM COMMA_SOURCE_FILE ("implementation_parser.galgas", 223)) ;
-    nt_enum_5F_options_ (outArgument_attributeName, outArgument_type, inCompiler) ;
+    nt_enum_5F_options_ (outArgument_attributeName, outArgument_type, ioArgument_includeCache, inCompiler) ;
   } break ;
   case 7: {
     inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_BOOLEAN COMMA_SOURCE_FILE ("implementation_parser.galgas", 225)) ;
-    nt_boolean_5F_options_ (outArgument_attributeName, outArgument_type, inCompiler) ;
+    nt_boolean_5F_options_ (outArgument_attributeName, outArgument_type, ioArgument_includeCache, inCompiler) ;
   } break ;
   case 8: {
     inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_STRING COMMA_SOURCE_FILE ("implementation_parser.galgas", 227)) ;
@@ -8626,7 +8674,7 @@ void cParser_implementation_5F_parser::rule_implementation_5F_parser_implementat
   } break ;
   case 10: {
     inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken_STRUCT COMMA_SOURCE_FILE ("implementation_parser.galgas", 231)) ;
-    nt_struct_5F_options_ (outArgument_attributeName, outArgument_type, inCompiler) ;
+    nt_struct_5F_options_ (outArgument_attributeName, outArgument_type, ioArgument_includeCache, inCompiler) ;
   } break ;
   case 11: {
     GALGAS_lstring var_typeName_6662 ;
@@ -8697,6 +8745,7 @@ void cParser_implementation_5F_parser::rule_implementation_5F_parser_implementat
 
 void cParser_implementation_5F_parser::rule_implementation_5F_parser_struct_5F_options_i7_ (GALGAS_lstring & outArgument_name,
                                                                                             GALGAS_impType & outArgument_options,
+                                                                                            GALGAS_implementationMap & ioArgument_includeCache,
                                                                                             C_Lexique_goil_5F_lexique * inCompiler) {
   outArgument_name.drop () ; // Release 'out' argument
   outArgument_options.drop () ; // Release 'out' argument
@@ -8704,7 +8753,7 @@ void cParser_implementation_5F_parser::rule_implementation_5F_parser_struct_5F_o
   switch (select_implementation_5F_parser_8 (inCompiler)) {
   case 1: {
     inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7B_ COMMA_SOURCE_FILE ("implementation_parser.galgas", 242)) ;
-    nt_implementation_5F_list_ (var_structAttributes_6818, inCompiler) ;
+    nt_implementation_5F_list_ (var_structAttributes_6818, ioArgument_includeCache, inCompiler) ;
     inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7D_ COMMA_SOURCE_FILE ("implementation_parser.galgas", 244)) ;
   } break ;
   case 2: {
@@ -8885,6 +8934,7 @@ void cParser_implementation_5F_parser::rule_implementation_5F_parser_string_5F_o
 
 void cParser_implementation_5F_parser::rule_implementation_5F_parser_boolean_5F_options_i10_ (GALGAS_lstring & outArgument_name,
                                                                                               GALGAS_impType & outArgument_options,
+                                                                                              GALGAS_implementationMap & ioArgument_includeCache,
                                                                                               C_Lexique_goil_5F_lexique * inCompiler) {
   outArgument_name.drop () ; // Release 'out' argument
   outArgument_options.drop () ; // Release 'out' argument
@@ -8899,7 +8949,7 @@ void cParser_implementation_5F_parser::rule_implementation_5F_parser_boolean_5F_
     switch (select_implementation_5F_parser_12 (inCompiler)) {
     case 1: {
       inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7B_ COMMA_SOURCE_FILE ("implementation_parser.galgas", 320)) ;
-      nt_implementation_5F_list_ (var_trueSubAttributes_8928, inCompiler) ;
+      nt_implementation_5F_list_ (var_trueSubAttributes_8928, ioArgument_includeCache, inCompiler) ;
       inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7D_ COMMA_SOURCE_FILE ("implementation_parser.galgas", 322)) ;
     } break ;
     case 2: {
@@ -8913,7 +8963,7 @@ void cParser_implementation_5F_parser::rule_implementation_5F_parser_boolean_5F_
     switch (select_implementation_5F_parser_13 (inCompiler)) {
     case 1: {
       inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7B_ COMMA_SOURCE_FILE ("implementation_parser.galgas", 329)) ;
-      nt_implementation_5F_list_ (var_falseSubAttributes_8990, inCompiler) ;
+      nt_implementation_5F_list_ (var_falseSubAttributes_8990, ioArgument_includeCache, inCompiler) ;
       inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7D_ COMMA_SOURCE_FILE ("implementation_parser.galgas", 331)) ;
     } break ;
     case 2: {
@@ -9015,6 +9065,7 @@ void cParser_implementation_5F_parser::rule_implementation_5F_parser_boolean_5F_
 //---------------------------------------------------------------------------------------------------------------------*
 
 void cParser_implementation_5F_parser::rule_implementation_5F_parser_enum_5F_item_i11_ (GALGAS_enumValues & ioArgument_items,
+                                                                                        GALGAS_implementationMap & ioArgument_includeCache,
                                                                                         C_Lexique_goil_5F_lexique * inCompiler) {
   GALGAS_lstring var_enumItem_10082 ;
   GALGAS_implementationObjectMap var_subAttributes_10102 = GALGAS_implementationObjectMap::constructor_emptyMap (SOURCE_FILE ("implementation_parser.galgas", 357)) ;
@@ -9022,7 +9073,7 @@ void cParser_implementation_5F_parser::rule_implementation_5F_parser_enum_5F_ite
   switch (select_implementation_5F_parser_15 (inCompiler)) {
   case 1: {
     inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7B_ COMMA_SOURCE_FILE ("implementation_parser.galgas", 360)) ;
-    nt_implementation_5F_list_ (var_subAttributes_10102, inCompiler) ;
+    nt_implementation_5F_list_ (var_subAttributes_10102, ioArgument_includeCache, inCompiler) ;
     inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__7D_ COMMA_SOURCE_FILE ("implementation_parser.galgas", 362)) ;
   } break ;
   case 2: {
@@ -9057,6 +9108,7 @@ void cParser_implementation_5F_parser::rule_implementation_5F_parser_enum_5F_ite
 
 void cParser_implementation_5F_parser::rule_implementation_5F_parser_enum_5F_options_i12_ (GALGAS_lstring & outArgument_name,
                                                                                            GALGAS_impType & outArgument_options,
+                                                                                           GALGAS_implementationMap & ioArgument_includeCache,
                                                                                            C_Lexique_goil_5F_lexique * inCompiler) {
   outArgument_name.drop () ; // Release 'out' argument
   outArgument_options.drop () ; // Release 'out' argument
@@ -9064,13 +9116,13 @@ void cParser_implementation_5F_parser::rule_implementation_5F_parser_enum_5F_opt
   nt_with_5F_auto_ (var_withAuto_10374, inCompiler) ;
   GALGAS_enumValues var_items_10410 = GALGAS_enumValues::constructor_emptyMap (SOURCE_FILE ("implementation_parser.galgas", 372)) ;
   inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__5B_ COMMA_SOURCE_FILE ("implementation_parser.galgas", 373)) ;
-  nt_enum_5F_item_ (var_items_10410, inCompiler) ;
+  nt_enum_5F_item_ (var_items_10410, ioArgument_includeCache, inCompiler) ;
   bool repeatFlag_0 = true ;
   while (repeatFlag_0) {
     switch (select_implementation_5F_parser_16 (inCompiler)) {
     case 2: {
       inCompiler->acceptTerminal (C_Lexique_goil_5F_lexique::kToken__2C_ COMMA_SOURCE_FILE ("implementation_parser.galgas", 377)) ;
-      nt_enum_5F_item_ (var_items_10410, inCompiler) ;
+      nt_enum_5F_item_ (var_items_10410, ioArgument_includeCache, inCompiler) ;
     } break ;
     default:
       repeatFlag_0 = false ;
@@ -11202,8 +11254,14 @@ void cGrammar_goil_5F_file_5F_level_5F_include::nt_start_parse (C_Lexique_goil_5
   rule_goil_5F_syntax_start_i0_parse(inLexique) ;
 }
 
-void cGrammar_goil_5F_file_5F_level_5F_include::nt_start_ (C_Lexique_goil_5F_lexique * inLexique) {
-  rule_goil_5F_syntax_start_i0_(inLexique) ;
+void cGrammar_goil_5F_file_5F_level_5F_include::nt_start_ (GALGAS_string & parameter_1,
+                                GALGAS_implementation & parameter_2,
+                                GALGAS_applicationDefinition & parameter_3,
+                                GALGAS_string & parameter_4,
+                                GALGAS_library & parameter_5,
+                                GALGAS_gtlData & parameter_6,
+                                C_Lexique_goil_5F_lexique * inLexique) {
+  rule_goil_5F_syntax_start_i0_(parameter_1, parameter_2, parameter_3, parameter_4, parameter_5, parameter_6, inLexique) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -11541,8 +11599,9 @@ void cGrammar_goil_5F_file_5F_level_5F_include::nt_include_5F_type_5F_level_pars
 }
 
 void cGrammar_goil_5F_file_5F_level_5F_include::nt_include_5F_type_5F_level_ (GALGAS_implementationObjectMap & parameter_1,
+                                GALGAS_implementationMap & parameter_2,
                                 C_Lexique_goil_5F_lexique * inLexique) {
-  rule_implementation_5F_parser_include_5F_type_5F_level_i3_(parameter_1, inLexique) ;
+  rule_implementation_5F_parser_include_5F_type_5F_level_i3_(parameter_1, parameter_2, inLexique) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -11571,8 +11630,9 @@ void cGrammar_goil_5F_file_5F_level_5F_include::nt_implementation_5F_list_parse
 }
 
 void cGrammar_goil_5F_file_5F_level_5F_include::nt_implementation_5F_list_ (GALGAS_implementationObjectMap & parameter_1,
+                                GALGAS_implementationMap & parameter_2,
                                 C_Lexique_goil_5F_lexique * inLexique) {
-  rule_implementation_5F_parser_implementation_5F_list_i5_(parameter_1, inLexique) ;
+  rule_implementation_5F_parser_implementation_5F_list_i5_(parameter_1, parameter_2, inLexique) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -11587,8 +11647,9 @@ void cGrammar_goil_5F_file_5F_level_5F_include::nt_implementation_5F_type_parse
 
 void cGrammar_goil_5F_file_5F_level_5F_include::nt_implementation_5F_type_ (GALGAS_lstring & parameter_1,
                                 GALGAS_impType & parameter_2,
+                                GALGAS_implementationMap & parameter_3,
                                 C_Lexique_goil_5F_lexique * inLexique) {
-  rule_implementation_5F_parser_implementation_5F_type_i6_(parameter_1, parameter_2, inLexique) ;
+  rule_implementation_5F_parser_implementation_5F_type_i6_(parameter_1, parameter_2, parameter_3, inLexique) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -11603,8 +11664,9 @@ void cGrammar_goil_5F_file_5F_level_5F_include::nt_struct_5F_options_parse (C_Le
 
 void cGrammar_goil_5F_file_5F_level_5F_include::nt_struct_5F_options_ (GALGAS_lstring & parameter_1,
                                 GALGAS_impType & parameter_2,
+                                GALGAS_implementationMap & parameter_3,
                                 C_Lexique_goil_5F_lexique * inLexique) {
-  rule_implementation_5F_parser_struct_5F_options_i7_(parameter_1, parameter_2, inLexique) ;
+  rule_implementation_5F_parser_struct_5F_options_i7_(parameter_1, parameter_2, parameter_3, inLexique) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -11652,8 +11714,9 @@ void cGrammar_goil_5F_file_5F_level_5F_include::nt_boolean_5F_options_parse (C_L
 
 void cGrammar_goil_5F_file_5F_level_5F_include::nt_boolean_5F_options_ (GALGAS_lstring & parameter_1,
                                 GALGAS_impType & parameter_2,
+                                GALGAS_implementationMap & parameter_3,
                                 C_Lexique_goil_5F_lexique * inLexique) {
-  rule_implementation_5F_parser_boolean_5F_options_i10_(parameter_1, parameter_2, inLexique) ;
+  rule_implementation_5F_parser_boolean_5F_options_i10_(parameter_1, parameter_2, parameter_3, inLexique) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -11667,8 +11730,9 @@ void cGrammar_goil_5F_file_5F_level_5F_include::nt_enum_5F_item_parse (C_Lexique
 }
 
 void cGrammar_goil_5F_file_5F_level_5F_include::nt_enum_5F_item_ (GALGAS_enumValues & parameter_1,
+                                GALGAS_implementationMap & parameter_2,
                                 C_Lexique_goil_5F_lexique * inLexique) {
-  rule_implementation_5F_parser_enum_5F_item_i11_(parameter_1, inLexique) ;
+  rule_implementation_5F_parser_enum_5F_item_i11_(parameter_1, parameter_2, inLexique) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -11683,8 +11747,9 @@ void cGrammar_goil_5F_file_5F_level_5F_include::nt_enum_5F_options_parse (C_Lexi
 
 void cGrammar_goil_5F_file_5F_level_5F_include::nt_enum_5F_options_ (GALGAS_lstring & parameter_1,
                                 GALGAS_impType & parameter_2,
+                                GALGAS_implementationMap & parameter_3,
                                 C_Lexique_goil_5F_lexique * inLexique) {
-  rule_implementation_5F_parser_enum_5F_options_i12_(parameter_1, parameter_2, inLexique) ;
+  rule_implementation_5F_parser_enum_5F_options_i12_(parameter_1, parameter_2, parameter_3, inLexique) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -13825,8 +13890,14 @@ void cGrammar_goil_5F_implementation_5F_level_5F_include::nt_start_parse (C_Lexi
   rule_goil_5F_syntax_start_i0_parse(inLexique) ;
 }
 
-void cGrammar_goil_5F_implementation_5F_level_5F_include::nt_start_ (C_Lexique_goil_5F_lexique * inLexique) {
-  rule_goil_5F_syntax_start_i0_(inLexique) ;
+void cGrammar_goil_5F_implementation_5F_level_5F_include::nt_start_ (GALGAS_string & parameter_1,
+                                GALGAS_implementation & parameter_2,
+                                GALGAS_applicationDefinition & parameter_3,
+                                GALGAS_string & parameter_4,
+                                GALGAS_library & parameter_5,
+                                GALGAS_gtlData & parameter_6,
+                                C_Lexique_goil_5F_lexique * inLexique) {
+  rule_goil_5F_syntax_start_i0_(parameter_1, parameter_2, parameter_3, parameter_4, parameter_5, parameter_6, inLexique) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -14158,8 +14229,9 @@ void cGrammar_goil_5F_implementation_5F_level_5F_include::nt_include_5F_type_5F_
 }
 
 void cGrammar_goil_5F_implementation_5F_level_5F_include::nt_include_5F_type_5F_level_ (GALGAS_implementationObjectMap & parameter_1,
+                                GALGAS_implementationMap & parameter_2,
                                 C_Lexique_goil_5F_lexique * inLexique) {
-  rule_implementation_5F_parser_include_5F_type_5F_level_i3_(parameter_1, inLexique) ;
+  rule_implementation_5F_parser_include_5F_type_5F_level_i3_(parameter_1, parameter_2, inLexique) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -14188,8 +14260,9 @@ void cGrammar_goil_5F_implementation_5F_level_5F_include::nt_implementation_5F_l
 }
 
 void cGrammar_goil_5F_implementation_5F_level_5F_include::nt_implementation_5F_list_ (GALGAS_implementationObjectMap & parameter_1,
+                                GALGAS_implementationMap & parameter_2,
                                 C_Lexique_goil_5F_lexique * inLexique) {
-  rule_implementation_5F_parser_implementation_5F_list_i5_(parameter_1, inLexique) ;
+  rule_implementation_5F_parser_implementation_5F_list_i5_(parameter_1, parameter_2, inLexique) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -14204,8 +14277,9 @@ void cGrammar_goil_5F_implementation_5F_level_5F_include::nt_implementation_5F_t
 
 void cGrammar_goil_5F_implementation_5F_level_5F_include::nt_implementation_5F_type_ (GALGAS_lstring & parameter_1,
                                 GALGAS_impType & parameter_2,
+                                GALGAS_implementationMap & parameter_3,
                                 C_Lexique_goil_5F_lexique * inLexique) {
-  rule_implementation_5F_parser_implementation_5F_type_i6_(parameter_1, parameter_2, inLexique) ;
+  rule_implementation_5F_parser_implementation_5F_type_i6_(parameter_1, parameter_2, parameter_3, inLexique) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -14220,8 +14294,9 @@ void cGrammar_goil_5F_implementation_5F_level_5F_include::nt_struct_5F_options_p
 
 void cGrammar_goil_5F_implementation_5F_level_5F_include::nt_struct_5F_options_ (GALGAS_lstring & parameter_1,
                                 GALGAS_impType & parameter_2,
+                                GALGAS_implementationMap & parameter_3,
                                 C_Lexique_goil_5F_lexique * inLexique) {
-  rule_implementation_5F_parser_struct_5F_options_i7_(parameter_1, parameter_2, inLexique) ;
+  rule_implementation_5F_parser_struct_5F_options_i7_(parameter_1, parameter_2, parameter_3, inLexique) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -14269,8 +14344,9 @@ void cGrammar_goil_5F_implementation_5F_level_5F_include::nt_boolean_5F_options_
 
 void cGrammar_goil_5F_implementation_5F_level_5F_include::nt_boolean_5F_options_ (GALGAS_lstring & parameter_1,
                                 GALGAS_impType & parameter_2,
+                                GALGAS_implementationMap & parameter_3,
                                 C_Lexique_goil_5F_lexique * inLexique) {
-  rule_implementation_5F_parser_boolean_5F_options_i10_(parameter_1, parameter_2, inLexique) ;
+  rule_implementation_5F_parser_boolean_5F_options_i10_(parameter_1, parameter_2, parameter_3, inLexique) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -14284,8 +14360,9 @@ void cGrammar_goil_5F_implementation_5F_level_5F_include::nt_enum_5F_item_parse
 }
 
 void cGrammar_goil_5F_implementation_5F_level_5F_include::nt_enum_5F_item_ (GALGAS_enumValues & parameter_1,
+                                GALGAS_implementationMap & parameter_2,
                                 C_Lexique_goil_5F_lexique * inLexique) {
-  rule_implementation_5F_parser_enum_5F_item_i11_(parameter_1, inLexique) ;
+  rule_implementation_5F_parser_enum_5F_item_i11_(parameter_1, parameter_2, inLexique) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -14300,8 +14377,9 @@ void cGrammar_goil_5F_implementation_5F_level_5F_include::nt_enum_5F_options_par
 
 void cGrammar_goil_5F_implementation_5F_level_5F_include::nt_enum_5F_options_ (GALGAS_lstring & parameter_1,
                                 GALGAS_impType & parameter_2,
+                                GALGAS_implementationMap & parameter_3,
                                 C_Lexique_goil_5F_lexique * inLexique) {
-  rule_implementation_5F_parser_enum_5F_options_i12_(parameter_1, parameter_2, inLexique) ;
+  rule_implementation_5F_parser_enum_5F_options_i12_(parameter_1, parameter_2, parameter_3, inLexique) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -1731,6 +1731,7 @@ class cGrammar_goil_5F_implementation_5F_level_5F_include : public cParser_goil_
 //----------- '' label
   public : virtual void nt_boolean_5F_options_ (GALGAS_lstring & outArgument0,
                                                 GALGAS_impType & outArgument1,
+                                                GALGAS_implementationMap & ioArgument2,
                                                 C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //------------------------------------- 'description' non terminal
@@ -1747,6 +1748,7 @@ class cGrammar_goil_5F_implementation_5F_level_5F_include : public cParser_goil_
 
 //----------- '' label
   public : virtual void nt_enum_5F_item_ (GALGAS_enumValues & ioArgument0,
+                                          GALGAS_implementationMap & ioArgument1,
                                           C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //------------------------------------- 'enum_options' non terminal
@@ -1756,6 +1758,7 @@ class cGrammar_goil_5F_implementation_5F_level_5F_include : public cParser_goil_
 //----------- '' label
   public : virtual void nt_enum_5F_options_ (GALGAS_lstring & outArgument0,
                                              GALGAS_impType & outArgument1,
+                                             GALGAS_implementationMap & ioArgument2,
                                              C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //------------------------------------- 'file' non terminal
@@ -1799,6 +1802,7 @@ class cGrammar_goil_5F_implementation_5F_level_5F_include : public cParser_goil_
 
 //----------- '' label
   public : virtual void nt_implementation_5F_list_ (GALGAS_implementationObjectMap & ioArgument0,
+                                                    GALGAS_implementationMap & ioArgument1,
                                                     C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //------------------------------------- 'implementation_object_list' non terminal
@@ -1848,6 +1852,7 @@ class cGrammar_goil_5F_implementation_5F_level_5F_include : public cParser_goil_
 //----------- '' label
   public : virtual void nt_implementation_5F_type_ (GALGAS_lstring & outArgument0,
                                                     GALGAS_impType & outArgument1,
+                                                    GALGAS_implementationMap & ioArgument2,
                                                     C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //------------------------------------- 'include_cpu_level' non terminal
@@ -1895,6 +1900,7 @@ class cGrammar_goil_5F_implementation_5F_level_5F_include : public cParser_goil_
 
 //----------- '' label
   public : virtual void nt_include_5F_type_5F_level_ (GALGAS_implementationObjectMap & ioArgument0,
+                                                      GALGAS_implementationMap & ioArgument1,
                                                       C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //------------------------------------- 'int_or_float' non terminal
@@ -2003,7 +2009,13 @@ class cGrammar_goil_5F_implementation_5F_level_5F_include : public cParser_goil_
   public : virtual void nt_start_parse (C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //----------- '' label
-  public : virtual void nt_start_ (C_Lexique_goil_5F_lexique * inCompiler) ;
+  public : virtual void nt_start_ (GALGAS_string & ioArgument0,
+                                   GALGAS_implementation & ioArgument1,
+                                   GALGAS_applicationDefinition & ioArgument2,
+                                   GALGAS_string & ioArgument3,
+                                   GALGAS_library & ioArgument4,
+                                   GALGAS_gtlData & outArgument5,
+                                   C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //------------------------------------- 'string_options' non terminal
 //--- 'parse' label
@@ -2021,6 +2033,7 @@ class cGrammar_goil_5F_implementation_5F_level_5F_include : public cParser_goil_
 //----------- '' label
   public : virtual void nt_struct_5F_options_ (GALGAS_lstring & outArgument0,
                                                GALGAS_impType & outArgument1,
+                                               GALGAS_implementationMap & ioArgument2,
                                                C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //------------------------------------- 'type_options' non terminal
@@ -2182,6 +2195,7 @@ class cGrammar_goil_5F_type_5F_level_5F_include : public cParser_goil_5F_syntax,
 //----------- '' label
   public : virtual void nt_boolean_5F_options_ (GALGAS_lstring & outArgument0,
                                                 GALGAS_impType & outArgument1,
+                                                GALGAS_implementationMap & ioArgument2,
                                                 C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //------------------------------------- 'description' non terminal
@@ -2198,6 +2212,7 @@ class cGrammar_goil_5F_type_5F_level_5F_include : public cParser_goil_5F_syntax,
 
 //----------- '' label
   public : virtual void nt_enum_5F_item_ (GALGAS_enumValues & ioArgument0,
+                                          GALGAS_implementationMap & ioArgument1,
                                           C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //------------------------------------- 'enum_options' non terminal
@@ -2207,6 +2222,7 @@ class cGrammar_goil_5F_type_5F_level_5F_include : public cParser_goil_5F_syntax,
 //----------- '' label
   public : virtual void nt_enum_5F_options_ (GALGAS_lstring & outArgument0,
                                              GALGAS_impType & outArgument1,
+                                             GALGAS_implementationMap & ioArgument2,
                                              C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //------------------------------------- 'file' non terminal
@@ -2250,18 +2266,21 @@ class cGrammar_goil_5F_type_5F_level_5F_include : public cParser_goil_5F_syntax,
 
 //----------- '' label
   public : virtual void nt_implementation_5F_list_ (GALGAS_implementationObjectMap & ioArgument0,
+                                                    GALGAS_implementationMap & ioArgument1,
                                                     C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //--- Start symbol
   public : static void _performSourceFileParsing_ (C_Compiler * inCompiler,
                                                    GALGAS_lstring inFileName,
-                                                   GALGAS_implementationObjectMap & ioArgument0
+                                                   GALGAS_implementationObjectMap & ioArgument0,
+                                                   GALGAS_implementationMap & ioArgument1
                                                    COMMA_LOCATION_ARGS) ;
 
   public : static void _performSourceStringParsing_ (C_Compiler * inCompiler,
                                                      GALGAS_string inSourceString,
                                                      GALGAS_string inNameString,
-                                                     GALGAS_implementationObjectMap & ioArgument0
+                                                     GALGAS_implementationObjectMap & ioArgument0,
+                                                     GALGAS_implementationMap & ioArgument1
                                                      COMMA_LOCATION_ARGS) ;
 
 //--- Indexing
@@ -2299,6 +2318,7 @@ class cGrammar_goil_5F_type_5F_level_5F_include : public cParser_goil_5F_syntax,
 //----------- '' label
   public : virtual void nt_implementation_5F_type_ (GALGAS_lstring & outArgument0,
                                                     GALGAS_impType & outArgument1,
+                                                    GALGAS_implementationMap & ioArgument2,
                                                     C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //------------------------------------- 'include_cpu_level' non terminal
@@ -2346,6 +2366,7 @@ class cGrammar_goil_5F_type_5F_level_5F_include : public cParser_goil_5F_syntax,
 
 //----------- '' label
   public : virtual void nt_include_5F_type_5F_level_ (GALGAS_implementationObjectMap & ioArgument0,
+                                                      GALGAS_implementationMap & ioArgument1,
                                                       C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //------------------------------------- 'int_or_float' non terminal
@@ -2454,7 +2475,13 @@ class cGrammar_goil_5F_type_5F_level_5F_include : public cParser_goil_5F_syntax,
   public : virtual void nt_start_parse (C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //----------- '' label
-  public : virtual void nt_start_ (C_Lexique_goil_5F_lexique * inCompiler) ;
+  public : virtual void nt_start_ (GALGAS_string & ioArgument0,
+                                   GALGAS_implementation & ioArgument1,
+                                   GALGAS_applicationDefinition & ioArgument2,
+                                   GALGAS_string & ioArgument3,
+                                   GALGAS_library & ioArgument4,
+                                   GALGAS_gtlData & outArgument5,
+                                   C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //------------------------------------- 'string_options' non terminal
 //--- 'parse' label
@@ -2472,6 +2499,7 @@ class cGrammar_goil_5F_type_5F_level_5F_include : public cParser_goil_5F_syntax,
 //----------- '' label
   public : virtual void nt_struct_5F_options_ (GALGAS_lstring & outArgument0,
                                                GALGAS_impType & outArgument1,
+                                               GALGAS_implementationMap & ioArgument2,
                                                C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //------------------------------------- 'type_options' non terminal
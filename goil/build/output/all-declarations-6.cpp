@@ -1495,8 +1495,14 @@ void cGrammar_goil_5F_type_5F_level_5F_include::nt_start_parse (C_Lexique_goil_5
   rule_goil_5F_syntax_start_i0_parse(inLexique) ;
 }
 
-void cGrammar_goil_5F_type_5F_level_5F_include::nt_start_ (C_Lexique_goil_5F_lexique * inLexique) {
-  rule_goil_5F_syntax_start_i0_(inLexique) ;
+void cGrammar_goil_5F_type_5F_level_5F_include::nt_start_ (GALGAS_string & parameter_1,
+                                GALGAS_implementation & parameter_2,
+                                GALGAS_applicationDefinition & parameter_3,
+                                GALGAS_string & parameter_4,
+                                GALGAS_library & parameter_5,
+                                GALGAS_gtlData & parameter_6,
+                                C_Lexique_goil_5F_lexique * inLexique) {
+  rule_goil_5F_syntax_start_i0_(parameter_1, parameter_2, parameter_3, parameter_4, parameter_5, parameter_6, inLexique) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -1739,8 +1745,9 @@ void cGrammar_goil_5F_type_5F_level_5F_include::nt_include_5F_type_5F_level_pars
 }
 
 void cGrammar_goil_5F_type_5F_level_5F_include::nt_include_5F_type_5F_level_ (GALGAS_implementationObjectMap & parameter_1,
+                                GALGAS_implementationMap & parameter_2,
                                 C_Lexique_goil_5F_lexique * inLexique) {
-  rule_implementation_5F_parser_include_5F_type_5F_level_i3_(parameter_1, inLexique) ;
+  rule_implementation_5F_parser_include_5F_type_5F_level_i3_(parameter_1, parameter_2, inLexique) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -1769,8 +1776,9 @@ void cGrammar_goil_5F_type_5F_level_5F_include::nt_implementation_5F_list_parse
 }
 
 void cGrammar_goil_5F_type_5F_level_5F_include::nt_implementation_5F_list_ (GALGAS_implementationObjectMap & parameter_1,
+                                GALGAS_implementationMap & parameter_2,
                                 C_Lexique_goil_5F_lexique * inLexique) {
-  rule_implementation_5F_parser_implementation_5F_list_i5_(parameter_1, inLexique) ;
+  rule_implementation_5F_parser_implementation_5F_list_i5_(parameter_1, parameter_2, inLexique) ;
 }
 
 void cGrammar_goil_5F_type_5F_level_5F_include::performIndexing (C_Compiler * /* inCompiler */,
@@ -1806,7 +1814,8 @@ void cGrammar_goil_5F_type_5F_level_5F_include::performOnlySyntaxAnalysis (C_Com
 
 void cGrammar_goil_5F_type_5F_level_5F_include::_performSourceFileParsing_ (C_Compiler * inCompiler,
                                 GALGAS_lstring inFilePath,
-                                GALGAS_implementationObjectMap &  parameter_1
+                                GALGAS_implementationObjectMap &  parameter_1,
+                                GALGAS_implementationMap &  parameter_2
                                 COMMA_LOCATION_ARGS) {
   if (inFilePath.isValid ()) {
     const GALGAS_string filePathAsString = inFilePath.getter_string (HERE) ;
@@ -1822,7 +1831,7 @@ void cGrammar_goil_5F_type_5F_level_5F_include::_performSourceFileParsing_ (C_Co
                                                       gFirstProductionIndexes_goil_type_level_include, gDecision_goil_type_level_include, gDecisionIndexes_goil_type_level_include, 448) ;
       if (ok && ! executionModeIsSyntaxAnalysisOnly ()) {
         cGrammar_goil_5F_type_5F_level_5F_include grammar ;
-        grammar.nt_implementation_5F_list_ (parameter_1, scanner) ;
+        grammar.nt_implementation_5F_list_ (parameter_1, parameter_2, scanner) ;
         }
       }else{
         C_String message ;
@@ -1845,7 +1854,8 @@ void cGrammar_goil_5F_type_5F_level_5F_include::_performSourceFileParsing_ (C_Co
 void cGrammar_goil_5F_type_5F_level_5F_include::_performSourceStringParsing_ (C_Compiler * inCompiler,
                                 GALGAS_string inSourceString,
                                 GALGAS_string inNameString,
-                                GALGAS_implementationObjectMap &  parameter_1
+                                GALGAS_implementationObjectMap &  parameter_1,
+                                GALGAS_implementationMap &  parameter_2
                                 COMMA_UNUSED_LOCATION_ARGS) {
   if (inSourceString.isValid () && inNameString.isValid ()) {
     const C_String sourceString = inSourceString.stringValue () ;
@@ -1856,7 +1866,7 @@ void cGrammar_goil_5F_type_5F_level_5F_include::_performSourceStringParsing_ (C_
                                                     gFirstProductionIndexes_goil_type_level_include, gDecision_goil_type_level_include, gDecisionIndexes_goil_type_level_include, 448) ;
     if (ok && ! executionModeIsSyntaxAnalysisOnly ()) {
       cGrammar_goil_5F_type_5F_level_5F_include grammar ;
-      grammar.nt_implementation_5F_list_ (parameter_1, scanner) ;
+      grammar.nt_implementation_5F_list_ (parameter_1, parameter_2, scanner) ;
     }
     macroDetachSharedObject (scanner) ;
   }
@@ -1874,8 +1884,9 @@ void cGrammar_goil_5F_type_5F_level_5F_include::nt_implementation_5F_type_parse
 
 void cGrammar_goil_5F_type_5F_level_5F_include::nt_implementation_5F_type_ (GALGAS_lstring & parameter_1,
                                 GALGAS_impType & parameter_2,
+                                GALGAS_implementationMap & parameter_3,
                                 C_Lexique_goil_5F_lexique * inLexique) {
-  rule_implementation_5F_parser_implementation_5F_type_i6_(parameter_1, parameter_2, inLexique) ;
+  rule_implementation_5F_parser_implementation_5F_type_i6_(parameter_1, parameter_2, parameter_3, inLexique) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -1890,8 +1901,9 @@ void cGrammar_goil_5F_type_5F_level_5F_include::nt_struct_5F_options_parse (C_Le
 
 void cGrammar_goil_5F_type_5F_level_5F_include::nt_struct_5F_options_ (GALGAS_lstring & parameter_1,
                                 GALGAS_impType & parameter_2,
+                                GALGAS_implementationMap & parameter_3,
                                 C_Lexique_goil_5F_lexique * inLexique) {
-  rule_implementation_5F_parser_struct_5F_options_i7_(parameter_1, parameter_2, inLexique) ;
+  rule_implementation_5F_parser_struct_5F_options_i7_(parameter_1, parameter_2, parameter_3, inLexique) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -1939,8 +1951,9 @@ void cGrammar_goil_5F_type_5F_level_5F_include::nt_boolean_5F_options_parse (C_L
 
 void cGrammar_goil_5F_type_5F_level_5F_include::nt_boolean_5F_options_ (GALGAS_lstring & parameter_1,
                                 GALGAS_impType & parameter_2,
+                                GALGAS_implementationMap & parameter_3,
                                 C_Lexique_goil_5F_lexique * inLexique) {
-  rule_implementation_5F_parser_boolean_5F_options_i10_(parameter_1, parameter_2, inLexique) ;
+  rule_implementation_5F_parser_boolean_5F_options_i10_(parameter_1, parameter_2, parameter_3, inLexique) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -1954,8 +1967,9 @@ void cGrammar_goil_5F_type_5F_level_5F_include::nt_enum_5F_item_parse (C_Lexique
 }
 
 void cGrammar_goil_5F_type_5F_level_5F_include::nt_enum_5F_item_ (GALGAS_enumValues & parameter_1,
+                                GALGAS_implementationMap & parameter_2,
                                 C_Lexique_goil_5F_lexique * inLexique) {
-  rule_implementation_5F_parser_enum_5F_item_i11_(parameter_1, inLexique) ;
+  rule_implementation_5F_parser_enum_5F_item_i11_(parameter_1, parameter_2, inLexique) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -1970,8 +1984,9 @@ void cGrammar_goil_5F_type_5F_level_5F_include::nt_enum_5F_options_parse (C_Lexi
 
 void cGrammar_goil_5F_type_5F_level_5F_include::nt_enum_5F_options_ (GALGAS_lstring & parameter_1,
                                 GALGAS_impType & parameter_2,
+                                GALGAS_implementationMap & parameter_3,
                                 C_Lexique_goil_5F_lexique * inLexique) {
-  rule_implementation_5F_parser_enum_5F_options_i12_(parameter_1, parameter_2, inLexique) ;
+  rule_implementation_5F_parser_enum_5F_options_i12_(parameter_1, parameter_2, parameter_3, inLexique) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -3077,30 +3092,32 @@ void cParser_arxml_5F_parser::rule_arxml_5F_parser_arxml_5F_start_5F_symbol_i0_
   GALGAS_applicationDefinition var_application_1024 = function_emptyApplicationDefinition (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 37)) ;
   GALGAS_string var_fileIncludeList_1081 = GALGAS_string::makeEmptyString () ;
   GALGAS_bool var_debug_1100 = GALGAS_bool (false) ;
-  GALGAS_string var_s_1226 = GALGAS_string::constructor_retrieveAndResetTemplateString (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 44)) ;
+  GALGAS_gtlProfileMap var_phases_1178 = GALGAS_gtlProfileMap::constructor_emptyMap (SOURCE_FILE ("arxml_parser.galgas", 41)) ;
+  GALGAS_timer var_timer_1212 = GALGAS_timer::constructor_start (SOURCE_FILE ("arxml_parser.galgas", 42)) ;
+  GALGAS_string var_s_1226 = GALGAS_string::constructor_retrieveAndResetTemplateString (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 47)) ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = GALGAS_bool (kIsStrictSup, var_s_1226.getter_length (SOURCE_FILE ("arxml_parser.galgas", 45)).objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
+    test_0 = GALGAS_bool (kIsStrictSup, var_s_1226.getter_length (SOURCE_FILE ("arxml_parser.galgas", 48)).objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
     if (kBoolTrue == test_0) {
       TC_Array <C_FixItDescription> fixItArray1 ;
-      inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 46)), GALGAS_string ("No character is allowed before XML header"), fixItArray1  COMMA_SOURCE_FILE ("arxml_parser.galgas", 46)) ;
+      inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 49)), GALGAS_string ("No character is allowed before XML header"), fixItArray1  COMMA_SOURCE_FILE ("arxml_parser.galgas", 49)) ;
     }
   }
-  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3C__3F_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 49)) ;
+  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3C__3F_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 52)) ;
   GALGAS_lstring var_name_1404 = inCompiler->synthetizedAttribute_tokenString () ;
-  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 50)) ;
-  GALGAS_arxmlAttributeMap var_attributes_1437 = GALGAS_arxmlAttributeMap::constructor_emptyMap (SOURCE_FILE ("arxml_parser.galgas", 52)) ;
+  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 53)) ;
+  GALGAS_arxmlAttributeMap var_attributes_1437 = GALGAS_arxmlAttributeMap::constructor_emptyMap (SOURCE_FILE ("arxml_parser.galgas", 55)) ;
   bool repeatFlag_2 = true ;
   while (repeatFlag_2) {
     switch (select_arxml_5F_parser_0 (inCompiler)) {
     case 2: {
       GALGAS_lstring var_attributeName_1505 = inCompiler->synthetizedAttribute_tokenString () ;
-      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 55)) ;
-      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3D_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 56)) ;
+      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 58)) ;
+      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3D_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 59)) ;
       GALGAS_lstring var_attributeValue_1554 = inCompiler->synthetizedAttribute_tokenString () ;
-      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_value COMMA_SOURCE_FILE ("arxml_parser.galgas", 57)) ;
+      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_value COMMA_SOURCE_FILE ("arxml_parser.galgas", 60)) ;
       {
-      var_attributes_1437.setter_insertKey (var_attributeName_1505, var_attributeValue_1554, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 58)) ;
+      var_attributes_1437.setter_insertKey (var_attributeName_1505, var_attributeValue_1554, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 61)) ;
       }
     } break ;
     default:
@@ -3108,121 +3125,141 @@ void cParser_arxml_5F_parser::rule_arxml_5F_parser_arxml_5F_start_5F_symbol_i0_
       break ;
     }
   }
-  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3F__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 60)) ;
-  GALGAS_arxmlNodeList var_nodes_1668 = GALGAS_arxmlNodeList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 62)) ;
+  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3F__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 63)) ;
+  GALGAS_arxmlNodeList var_nodes_1668 = GALGAS_arxmlNodeList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 65)) ;
   nt_element_5F_list_ (var_nodes_1668, constinArgument_includeComments, constinArgument_doNotCondenseWhiteSpaces, inCompiler) ;
-  outArgument_rootNode = GALGAS_arxmlElementNode::constructor_new (var_name_1404, var_attributes_1437, var_nodes_1668  COMMA_SOURCE_FILE ("arxml_parser.galgas", 68)) ;
-  GALGAS_lstring var_autosarVersion_1992 = function_lstringWith (GALGAS_string::makeEmptyString (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 79)) ;
-  GALGAS_lstring var_autosarDescription_2041 = function_lstringWith (GALGAS_string::makeEmptyString (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 80)) ;
+  outArgument_rootNode = GALGAS_arxmlElementNode::constructor_new (var_name_1404, var_attributes_1437, var_nodes_1668  COMMA_SOURCE_FILE ("arxml_parser.galgas", 71)) ;
+  {
+  extensionSetter_addSample (var_phases_1178, GALGAS_string ("parsing"), var_timer_1212, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 76)) ;
+  }
+  var_timer_1212 = GALGAS_timer::constructor_start (SOURCE_FILE ("arxml_parser.galgas", 77)) ;
+  GALGAS_lstring var_autosarVersion_1992 = function_lstringWith (GALGAS_string::makeEmptyString (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 84)) ;
+  GALGAS_lstring var_autosarDescription_2041 = function_lstringWith (GALGAS_string::makeEmptyString (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 85)) ;
   {
-  routine_getAutosarVersion (outArgument_rootNode, var_autosarVersion_1992, var_autosarDescription_2041, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 81)) ;
+  routine_getAutosarVersion (outArgument_rootNode, var_autosarVersion_1992, var_autosarDescription_2041, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 86)) ;
   }
   enumGalgasBool test_3 = kBoolTrue ;
   if (kBoolTrue == test_3) {
     test_3 = GALGAS_bool (kIsEqual, var_autosarVersion_1992.getter_string (HERE).objectCompare (GALGAS_string::makeEmptyString ())).boolEnum () ;
     if (kBoolTrue == test_3) {
       TC_Array <C_FixItDescription> fixItArray4 ;
-      inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 84)), GALGAS_string ("[TPS_ECUC_06005][TPS_ECUC_08053] : Missing AUTOSAR version"), fixItArray4  COMMA_SOURCE_FILE ("arxml_parser.galgas", 84)) ;
+      inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 89)), GALGAS_string ("[TPS_ECUC_06005][TPS_ECUC_08053] : Missing AUTOSAR version"), fixItArray4  COMMA_SOURCE_FILE ("arxml_parser.galgas", 89)) ;
     }
   }
-  GALGAS_stringlist var_autosarVlist_2349 = var_autosarVersion_1992.getter_string (HERE).getter_componentsSeparatedByString (GALGAS_string (".") COMMA_SOURCE_FILE ("arxml_parser.galgas", 88)) ;
+  GALGAS_stringlist var_autosarVlist_2349 = var_autosarVersion_1992.getter_string (HERE).getter_componentsSeparatedByString (GALGAS_string (".") COMMA_SOURCE_FILE ("arxml_parser.galgas", 93)) ;
   GALGAS_string var_versionFirst_2450 ;
   {
-  var_autosarVlist_2349.setter_popFirst (var_versionFirst_2450, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 89)) ;
+  var_autosarVlist_2349.setter_popFirst (var_versionFirst_2450, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 94)) ;
   }
   GALGAS_string var_versionSecond_2501 ;
   {
-  var_autosarVlist_2349.setter_popFirst (var_versionSecond_2501, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 90)) ;
+  var_autosarVlist_2349.setter_popFirst (var_versionSecond_2501, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 95)) ;
   }
-  GALGAS_lstring var_autosarShortVersion_2533 = GALGAS_lstring::constructor_new (var_versionFirst_2450.add_operation (GALGAS_string ("."), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 91)).add_operation (var_versionSecond_2501, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 91)), var_autosarVersion_1992.getter_location (SOURCE_FILE ("arxml_parser.galgas", 92))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 91)) ;
+  GALGAS_lstring var_autosarShortVersion_2533 = GALGAS_lstring::constructor_new (var_versionFirst_2450.add_operation (GALGAS_string ("."), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 96)).add_operation (var_versionSecond_2501, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 96)), var_autosarVersion_1992.getter_location (SOURCE_FILE ("arxml_parser.galgas", 97))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 96)) ;
   {
   routine_displayOil (GALGAS_string ("\n"
-    "OIL_VERSION = \"").add_operation (var_autosarShortVersion_2533.getter_string (SOURCE_FILE ("arxml_parser.galgas", 93)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 93)).add_operation (GALGAS_string ("\";\n"
-    "\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 93)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 93)) ;
+    "OIL_VERSION = \"").add_operation (var_autosarShortVersion_2533.getter_string (SOURCE_FILE ("arxml_parser.galgas", 98)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 98)).add_operation (GALGAS_string ("\";\n"
+    "\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 98)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 98)) ;
   }
   {
-  var_application_1024.setter_setVersion (var_autosarShortVersion_2533 COMMA_SOURCE_FILE ("arxml_parser.galgas", 95)) ;
+  var_application_1024.setter_setVersion (var_autosarShortVersion_2533 COMMA_SOURCE_FILE ("arxml_parser.galgas", 100)) ;
   }
   {
-  var_application_1024.setter_setVersionDescription (var_autosarDescription_2041 COMMA_SOURCE_FILE ("arxml_parser.galgas", 96)) ;
+  var_application_1024.setter_setVersionDescription (var_autosarDescription_2041 COMMA_SOURCE_FILE ("arxml_parser.galgas", 101)) ;
   }
-  GALGAS_string var_autosarVersionNoDot_3034 = var_autosarVersion_1992.getter_string (HERE).getter_stringByReplacingStringByString (GALGAS_string ("."), GALGAS_string ("-"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 105)) ;
-  GALGAS_string var_autosarMetaFile_3185 = GALGAS_string ("AUTOSAR_").add_operation (var_autosarVersionNoDot_3034, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 107)).add_operation (GALGAS_string (".xsd"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 107)) ;
-  GALGAS_string var_filePath_3248 = function_templates_5F_directory (GALGAS_string ("arxmlMeta"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 108)).add_operation (var_autosarMetaFile_3185, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 108)) ;
+  GALGAS_string var_autosarVersionNoDot_3034 = var_autosarVersion_1992.getter_string (HERE).getter_stringByReplacingStringByString (GALGAS_string ("."), GALGAS_string ("-"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 110)) ;
+  GALGAS_string var_autosarMetaFile_3185 = GALGAS_string ("AUTOSAR_").add_operation (var_autosarVersionNoDot_3034, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 112)).add_operation (GALGAS_string (".xsd"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 112)) ;
+  GALGAS_string var_filePath_3248 = function_templates_5F_directory (GALGAS_string ("arxmlMeta"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 113)).add_operation (var_autosarMetaFile_3185, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 113)) ;
   GALGAS_arxmlMetaClassMap var_classMap_3332 ;
   enumGalgasBool test_5 = kBoolTrue ;
   if (kBoolTrue == test_5) {
-    test_5 = var_filePath_3248.getter_fileExists (SOURCE_FILE ("arxml_parser.galgas", 111)).operator_not (SOURCE_FILE ("arxml_parser.galgas", 111)).boolEnum () ;
+    test_5 = var_filePath_3248.getter_fileExists (SOURCE_FILE ("arxml_parser.galgas", 116)).operator_not (SOURCE_FILE ("arxml_parser.galgas", 116)).boolEnum () ;
     if (kBoolTrue == test_5) {
       TC_Array <C_FixItDescription> fixItArray6 ;
-      inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 112)), GALGAS_string ("The corresponding metafile ").add_operation (var_filePath_3248, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 112)).add_operation (GALGAS_string (" does not"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 112)).add_operation (GALGAS_string (" exists. The Metamodel can be found here : "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 112)).add_operation (GALGAS_string ("http://www.autosar.org/specification -> Methodology and Templates -> "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 113)).add_operation (GALGAS_string ("Templates -> AUTOSAR_MMOD_XMLSchema.zip."), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 114)), fixItArray6  COMMA_SOURCE_FILE ("arxml_parser.galgas", 112)) ;
+      inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 117)), GALGAS_string ("The corresponding metafile ").add_operation (var_filePath_3248, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 117)).add_operation (GALGAS_string (" does not"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 117)).add_operation (GALGAS_string (" exists. The Metamodel can be found here : "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 117)).add_operation (GALGAS_string ("http://www.autosar.org/specification -> Methodology and Templates -> "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 118)).add_operation (GALGAS_string ("Templates -> AUTOSAR_MMOD_XMLSchema.zip."), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 119)), fixItArray6  COMMA_SOURCE_FILE ("arxml_parser.galgas", 117)) ;
     }
   }
   var_classMap_3332.drop () ;
-  cGrammar_arxmlmetaparser_5F_grammar::_performSourceFileParsing_ (inCompiler, function_lstringWith (var_filePath_3248, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 118)), var_classMap_3332, var_debug_1100  COMMA_SOURCE_FILE ("arxml_parser.galgas", 118)) ;
+  cGrammar_arxmlmetaparser_5F_grammar::_performSourceFileParsing_ (inCompiler, function_lstringWith (var_filePath_3248, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 123)), var_classMap_3332, var_debug_1100  COMMA_SOURCE_FILE ("arxml_parser.galgas", 123)) ;
   GALGAS_arxmlElementValue var_rootValue_3902 ;
   {
-  routine_nodeToClass (outArgument_rootNode, var_classMap_3332, var_rootValue_3902, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 124)) ;
+  routine_nodeToClass (outArgument_rootNode, var_classMap_3332, var_rootValue_3902, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 129)) ;
   }
   {
-  routine_includeConfigs (var_imp_930, var_application_1024, var_fileIncludeList_1081, var_autosarShortVersion_2533, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 136)) ;
+  routine_includeConfigs (var_imp_930, var_application_1024, var_fileIncludeList_1081, var_autosarShortVersion_2533, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 141)) ;
   }
   {
-  routine_convertToOil (var_imp_930, var_application_1024, var_rootValue_3902, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 143)) ;
+  routine_convertToOil (var_imp_930, var_application_1024, var_rootValue_3902, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 148)) ;
+  }
+  callExtensionMethod_checkObjectReferences ((const cPtr_implementation *) var_imp_930.ptr (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 159)) ;
+  {
+  extensionSetter_addSample (var_phases_1178, GALGAS_string ("arxmlConversion"), var_timer_1212, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 160)) ;
   }
-  callExtensionMethod_checkObjectReferences ((const cPtr_implementation *) var_imp_930.ptr (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 154)) ;
   enumGalgasBool test_7 = kBoolTrue ;
   if (kBoolTrue == test_7) {
-    test_7 = GALGAS_bool (kIsEqual, GALGAS_uint::constructor_errorCount (SOURCE_FILE ("arxml_parser.galgas", 156)).objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
+    test_7 = GALGAS_bool (kIsEqual, GALGAS_uint::constructor_errorCount (SOURCE_FILE ("arxml_parser.galgas", 162)).objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
     if (kBoolTrue == test_7) {
+      var_timer_1212 = GALGAS_timer::constructor_start (SOURCE_FILE ("arxml_parser.galgas", 163)) ;
       {
-      routine_setDefaults (var_imp_930, var_application_1024, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 157)) ;
+      routine_setDefaults (var_imp_930, var_application_1024, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 164)) ;
+      }
+      {
+      extensionSetter_addSample (var_phases_1178, GALGAS_string ("setDefaults"), var_timer_1212, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 165)) ;
       }
     }
   }
   enumGalgasBool test_8 = kBoolTrue ;
   if (kBoolTrue == test_8) {
-    test_8 = GALGAS_bool (kIsEqual, GALGAS_uint::constructor_errorCount (SOURCE_FILE ("arxml_parser.galgas", 164)).objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
+    test_8 = GALGAS_bool (kIsEqual, GALGAS_uint::constructor_errorCount (SOURCE_FILE ("arxml_parser.galgas", 172)).objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
     if (kBoolTrue == test_8) {
+      var_timer_1212 = GALGAS_timer::constructor_start (SOURCE_FILE ("arxml_parser.galgas", 173)) ;
+      {
+      routine_verifyAll (var_imp_930, var_application_1024, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 174)) ;
+      }
       {
-      routine_verifyAll (var_imp_930, var_application_1024, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 165)) ;
+      extensionSetter_addSample (var_phases_1178, GALGAS_string ("verifyAll"), var_timer_1212, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 175)) ;
       }
     }
   }
   enumGalgasBool test_9 = kBoolTrue ;
   if (kBoolTrue == test_9) {
-    test_9 = GALGAS_bool (kIsEqual, GALGAS_uint::constructor_errorCount (SOURCE_FILE ("arxml_parser.galgas", 167)).objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
+    test_9 = GALGAS_bool (kIsEqual, GALGAS_uint::constructor_errorCount (SOURCE_FILE ("arxml_parser.galgas", 177)).objectCompare (GALGAS_uint ((uint32_t) 0U))).boolEnum () ;
     if (kBoolTrue == test_9) {
-      GALGAS_gtlData var_templateData_5217 = callExtensionGetter_templateData ((const cPtr_applicationDefinition *) var_application_1024.ptr (), var_imp_930, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 168)) ;
+      var_timer_1212 = GALGAS_timer::constructor_start (SOURCE_FILE ("arxml_parser.galgas", 178)) ;
+      GALGAS_gtlData var_templateData_5217 = callExtensionGetter_templateData ((const cPtr_applicationDefinition *) var_application_1024.ptr (), var_imp_930, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 179)) ;
+      {
+      extensionSetter_addSample (var_phases_1178, GALGAS_string ("templateData"), var_timer_1212, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 180)) ;
+      }
       {
-      routine_generate_5F_all (var_templateData_5217, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 171)) ;
+      GALGAS_library var_lib_5791 = function_emptyLib (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 183)) ;
+      routine_generate_5F_all (var_templateData_5217, var_phases_1178, var_lib_5791, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 184)) ;
       }
     }
   }
-  var_fileIncludeList_1081 = GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 174)).getter_lastPathComponent (SOURCE_FILE ("arxml_parser.galgas", 174)).add_operation (GALGAS_string (":"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 174)).add_operation (var_fileIncludeList_1081, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 174)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 174)) ;
-  GALGAS_string var_oilDepFileName_5528 = GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 175)).getter_stringByDeletingLastPathComponent (SOURCE_FILE ("arxml_parser.galgas", 175)).add_operation (GALGAS_string ("/build/"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 175)).add_operation (GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 176)).getter_lastPathComponent (SOURCE_FILE ("arxml_parser.galgas", 176)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 176)).add_operation (GALGAS_string (".dep"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 176)) ;
-  var_fileIncludeList_1081.method_writeToFile (var_oilDepFileName_5528, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 178)) ;
+  var_fileIncludeList_1081 = GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 187)).getter_lastPathComponent (SOURCE_FILE ("arxml_parser.galgas", 187)).add_operation (GALGAS_string (":"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 187)).add_operation (var_fileIncludeList_1081, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 187)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 187)) ;
+  GALGAS_string var_oilDepFileName_5528 = GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 188)).getter_stringByDeletingLastPathComponent (SOURCE_FILE ("arxml_parser.galgas", 188)).add_operation (GALGAS_string ("/build/"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 188)).add_operation (GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 189)).getter_lastPathComponent (SOURCE_FILE ("arxml_parser.galgas", 189)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 189)).add_operation (GALGAS_string (".dep"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 189)) ;
+  var_fileIncludeList_1081.method_writeToFile (var_oilDepFileName_5528, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 191)) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
 
 void cParser_arxml_5F_parser::rule_arxml_5F_parser_arxml_5F_start_5F_symbol_i0_parse (C_Lexique_arxml_5F_scanner * inCompiler) {
-  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3C__3F_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 49)) ;
-  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 50)) ;
+  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3C__3F_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 52)) ;
+  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 53)) ;
   bool repeatFlag_0 = true ;
   while (repeatFlag_0) {
     switch (select_arxml_5F_parser_0 (inCompiler)) {
     case 2: {
-      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 55)) ;
-      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3D_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 56)) ;
-      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_value COMMA_SOURCE_FILE ("arxml_parser.galgas", 57)) ;
+      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 58)) ;
+      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3D_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 59)) ;
+      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_value COMMA_SOURCE_FILE ("arxml_parser.galgas", 60)) ;
     } break ;
     default:
       repeatFlag_0 = false ;
       break ;
     }
   }
-  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3F__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 60)) ;
+  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3F__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 63)) ;
   nt_element_5F_list_parse (inCompiler) ;
   inCompiler->resetTemplateString () ;
 }
@@ -3238,7 +3275,7 @@ void cParser_arxml_5F_parser::rule_arxml_5F_parser_element_5F_list_i1_ (GALGAS_a
     switch (select_arxml_5F_parser_1 (inCompiler)) {
     case 2: {
       {
-      routine_addText (ioArgument_nodes, constinArgument_doNotCondenseWhiteSpaces, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 193)) ;
+      routine_addText (ioArgument_nodes, constinArgument_doNotCondenseWhiteSpaces, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 206)) ;
       }
       nt_element_ (ioArgument_nodes, constinArgument_includeComments, constinArgument_doNotCondenseWhiteSpaces, inCompiler) ;
     } break ;
@@ -3273,12 +3310,12 @@ void cParser_arxml_5F_parser::rule_arxml_5F_parser_element_i2_ (GALGAS_arxmlNode
                                                                 const GALGAS_bool /* constinArgument_doNotCondenseWhiteSpaces */,
                                                                 C_Lexique_arxml_5F_scanner * inCompiler) {
   GALGAS_lstring var_commentString_6443 = inCompiler->synthetizedAttribute_tokenString () ;
-  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_comment COMMA_SOURCE_FILE ("arxml_parser.galgas", 210)) ;
+  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_comment COMMA_SOURCE_FILE ("arxml_parser.galgas", 223)) ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
     test_0 = constinArgument_includeComments.boolEnum () ;
     if (kBoolTrue == test_0) {
-      ioArgument_nodes.addAssign_operation (GALGAS_arxmlCommentNode::constructor_new (var_commentString_6443  COMMA_SOURCE_FILE ("arxml_parser.galgas", 212))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 212)) ;
+      ioArgument_nodes.addAssign_operation (GALGAS_arxmlCommentNode::constructor_new (var_commentString_6443  COMMA_SOURCE_FILE ("arxml_parser.galgas", 225))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 225)) ;
     }
   }
 }
@@ -3286,7 +3323,7 @@ void cParser_arxml_5F_parser::rule_arxml_5F_parser_element_i2_ (GALGAS_arxmlNode
 //---------------------------------------------------------------------------------------------------------------------*
 
 void cParser_arxml_5F_parser::rule_arxml_5F_parser_element_i2_parse (C_Lexique_arxml_5F_scanner * inCompiler) {
-  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_comment COMMA_SOURCE_FILE ("arxml_parser.galgas", 210)) ;
+  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_comment COMMA_SOURCE_FILE ("arxml_parser.galgas", 223)) ;
   inCompiler->resetTemplateString () ;
 }
 
@@ -3296,21 +3333,21 @@ void cParser_arxml_5F_parser::rule_arxml_5F_parser_element_i3_ (GALGAS_arxmlNode
                                                                 const GALGAS_bool constinArgument_includeComments,
                                                                 const GALGAS_bool constinArgument_doNotCondenseWhiteSpaces,
                                                                 C_Lexique_arxml_5F_scanner * inCompiler) {
-  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3C_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 223)) ;
+  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3C_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 236)) ;
   GALGAS_lstring var_name_6768 = inCompiler->synthetizedAttribute_tokenString () ;
-  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 224)) ;
-  GALGAS_arxmlAttributeMap var_attributeMap_6802 = GALGAS_arxmlAttributeMap::constructor_emptyMap (SOURCE_FILE ("arxml_parser.galgas", 225)) ;
+  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 237)) ;
+  GALGAS_arxmlAttributeMap var_attributeMap_6802 = GALGAS_arxmlAttributeMap::constructor_emptyMap (SOURCE_FILE ("arxml_parser.galgas", 238)) ;
   bool repeatFlag_0 = true ;
   while (repeatFlag_0) {
     switch (select_arxml_5F_parser_2 (inCompiler)) {
     case 2: {
       GALGAS_lstring var_attributeName_6870 = inCompiler->synthetizedAttribute_tokenString () ;
-      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 228)) ;
-      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3D_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 229)) ;
+      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 241)) ;
+      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3D_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 242)) ;
       GALGAS_lstring var_attributeValue_6919 = inCompiler->synthetizedAttribute_tokenString () ;
-      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_value COMMA_SOURCE_FILE ("arxml_parser.galgas", 230)) ;
+      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_value COMMA_SOURCE_FILE ("arxml_parser.galgas", 243)) ;
       {
-      var_attributeMap_6802.setter_insertKey (var_attributeName_6870, var_attributeValue_6919, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 231)) ;
+      var_attributeMap_6802.setter_insertKey (var_attributeName_6870, var_attributeValue_6919, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 244)) ;
       }
     } break ;
     default:
@@ -3318,48 +3355,48 @@ void cParser_arxml_5F_parser::rule_arxml_5F_parser_element_i3_ (GALGAS_arxmlNode
       break ;
     }
   }
-  GALGAS_arxmlNodeList var_nodeList_7014 = GALGAS_arxmlNodeList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 234)) ;
+  GALGAS_arxmlNodeList var_nodeList_7014 = GALGAS_arxmlNodeList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 247)) ;
   switch (select_arxml_5F_parser_3 (inCompiler)) {
   case 1: {
-    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__2F__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 236)) ;
+    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__2F__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 249)) ;
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 238)) ;
+    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 251)) ;
     nt_element_5F_list_ (var_nodeList_7014, constinArgument_includeComments, constinArgument_doNotCondenseWhiteSpaces, inCompiler) ;
     {
-    routine_addText (var_nodeList_7014, constinArgument_doNotCondenseWhiteSpaces, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 244)) ;
+    routine_addText (var_nodeList_7014, constinArgument_doNotCondenseWhiteSpaces, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 257)) ;
     }
-    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3C__2F_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 246)) ;
+    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3C__2F_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 259)) ;
     GALGAS_lstring var_closingName_7253 = inCompiler->synthetizedAttribute_tokenString () ;
-    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 247)) ;
+    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 260)) ;
     enumGalgasBool test_1 = kBoolTrue ;
     if (kBoolTrue == test_1) {
-      test_1 = GALGAS_bool (kIsNotEqual, var_closingName_7253.getter_string (SOURCE_FILE ("arxml_parser.galgas", 248)).objectCompare (var_name_6768.getter_string (SOURCE_FILE ("arxml_parser.galgas", 248)))).boolEnum () ;
+      test_1 = GALGAS_bool (kIsNotEqual, var_closingName_7253.getter_string (SOURCE_FILE ("arxml_parser.galgas", 261)).objectCompare (var_name_6768.getter_string (SOURCE_FILE ("arxml_parser.galgas", 261)))).boolEnum () ;
       if (kBoolTrue == test_1) {
         TC_Array <C_FixItDescription> fixItArray2 ;
-        inCompiler->emitSemanticError (var_closingName_7253.getter_location (SOURCE_FILE ("arxml_parser.galgas", 249)), GALGAS_string ("incorrect closing tag </").add_operation (var_closingName_7253.getter_string (SOURCE_FILE ("arxml_parser.galgas", 249)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 249)).add_operation (GALGAS_string ("> instead of </"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 250)).add_operation (var_name_6768.getter_string (SOURCE_FILE ("arxml_parser.galgas", 250)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 250)).add_operation (GALGAS_string (">"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 250)), fixItArray2  COMMA_SOURCE_FILE ("arxml_parser.galgas", 249)) ;
+        inCompiler->emitSemanticError (var_closingName_7253.getter_location (SOURCE_FILE ("arxml_parser.galgas", 262)), GALGAS_string ("incorrect closing tag </").add_operation (var_closingName_7253.getter_string (SOURCE_FILE ("arxml_parser.galgas", 262)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 262)).add_operation (GALGAS_string ("> instead of </"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 263)).add_operation (var_name_6768.getter_string (SOURCE_FILE ("arxml_parser.galgas", 263)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 263)).add_operation (GALGAS_string (">"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 263)), fixItArray2  COMMA_SOURCE_FILE ("arxml_parser.galgas", 262)) ;
       }
     }
-    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 252)) ;
+    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 265)) ;
   } break ;
   default:
     break ;
   }
-  ioArgument_nodes.addAssign_operation (GALGAS_arxmlElementNode::constructor_new (var_name_6768, var_attributeMap_6802, var_nodeList_7014  COMMA_SOURCE_FILE ("arxml_parser.galgas", 255))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 255)) ;
+  ioArgument_nodes.addAssign_operation (GALGAS_arxmlElementNode::constructor_new (var_name_6768, var_attributeMap_6802, var_nodeList_7014  COMMA_SOURCE_FILE ("arxml_parser.galgas", 268))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 268)) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
 
 void cParser_arxml_5F_parser::rule_arxml_5F_parser_element_i3_parse (C_Lexique_arxml_5F_scanner * inCompiler) {
-  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3C_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 223)) ;
-  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 224)) ;
+  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3C_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 236)) ;
+  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 237)) ;
   bool repeatFlag_0 = true ;
   while (repeatFlag_0) {
     switch (select_arxml_5F_parser_2 (inCompiler)) {
     case 2: {
-      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 228)) ;
-      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3D_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 229)) ;
-      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_value COMMA_SOURCE_FILE ("arxml_parser.galgas", 230)) ;
+      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 241)) ;
+      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3D_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 242)) ;
+      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_value COMMA_SOURCE_FILE ("arxml_parser.galgas", 243)) ;
     } break ;
     default:
       repeatFlag_0 = false ;
@@ -3368,14 +3405,14 @@ void cParser_arxml_5F_parser::rule_arxml_5F_parser_element_i3_parse (C_Lexique_a
   }
   switch (select_arxml_5F_parser_3 (inCompiler)) {
   case 1: {
-    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__2F__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 236)) ;
+    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__2F__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 249)) ;
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 238)) ;
+    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 251)) ;
     nt_element_5F_list_parse (inCompiler) ;
-    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3C__2F_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 246)) ;
-    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 247)) ;
-    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 252)) ;
+    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3C__2F_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 259)) ;
+    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 260)) ;
+    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 265)) ;
   } break ;
   default:
     break ;
@@ -255,6 +255,15 @@ class GALGAS_string function_templates_5F_directory (class GALGAS_string inArgum
                                                      class C_Compiler * inCompiler
                                                      COMMA_LOCATION_ARGS) ;
 
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Function 'emptyLib'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+class GALGAS_library function_emptyLib (class C_Compiler * inCompiler
+                                        COMMA_LOCATION_ARGS) ;
+
 //----------------------------------------------------------------------------------------------------------------------
 //
 //Parser class 'arxmlmetaparser_syntax' declaration
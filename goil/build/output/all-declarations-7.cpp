@@ -7555,6 +7555,66 @@ static void freeExtensionModifier_gtlContext_getCommand (void) {
 C_PrologueEpilogue gSetter_gtlContext_getCommand (defineExtensionSetter_gtlContext_getCommand,
                                                   freeExtensionModifier_gtlContext_getCommand) ;
 
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Function 'passedOptions'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_gtlData function_passedOptions (const GALGAS_location & constinArgument_here,
+                                       C_Compiler * inCompiler
+                                       COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_gtlData result_opts ; // Returned variable
+  result_opts = GALGAS_gtlStruct::constructor_new (constinArgument_here, function_lstring (GALGAS_string ("Passed options"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 196)), GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("systemConfig.galgas", 197))  COMMA_SOURCE_FILE ("systemConfig.galgas", 194)) ;
+  GALGAS_string var_optionString_5984 = extensionGetter_trimRight (extensionGetter_trimLeft (GALGAS_string (gOption_goil_5F_options_passOption.getter_value ()), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 199)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 199)) ;
+  enumGalgasBool test_0 = kBoolTrue ;
+  if (kBoolTrue == test_0) {
+    GALGAS_bool test_1 = GALGAS_bool (kIsStrictSup, var_optionString_5984.getter_length (SOURCE_FILE ("systemConfig.galgas", 200)).objectCompare (GALGAS_uint ((uint32_t) 0U))) ;
+    if (kBoolTrue != test_1.boolEnum ()) {
+      test_1 = GALGAS_bool (gOption_goil_5F_options_pierreOption.getter_value ()) ;
+    }
+    test_0 = test_1.boolEnum () ;
+    if (kBoolTrue == test_0) {
+      result_opts.drop () ;
+      cGrammar_options_5F_grammar::_performSourceStringParsing_ (inCompiler, GALGAS_string (gOption_goil_5F_options_passOption.getter_value ()), GALGAS_string ("Passed options"), result_opts  COMMA_SOURCE_FILE ("systemConfig.galgas", 201)) ;
+    }
+  }
+//---
+  return result_opts ;
+}
+
+
+//----------------------------------------------------------------------------------------------------------------------
+//  Function introspection                                                                       
+//----------------------------------------------------------------------------------------------------------------------
+
+static const C_galgas_type_descriptor * functionArgs_passedOptions [2] = {
+  & kTypeDescriptor_GALGAS_location,
+  NULL
+} ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static GALGAS_object functionWithGenericHeader_passedOptions (C_Compiler * inCompiler,
+                                                              const cObjectArray & inEffectiveParameterArray,
+                                                              const GALGAS_location & /* inErrorLocation */
+                                                              COMMA_LOCATION_ARGS) {
+  const GALGAS_location operand0 = GALGAS_location::extractObject (inEffectiveParameterArray.objectAtIndex (0 COMMA_HERE),
+                                                                   inCompiler
+                                                                   COMMA_THERE) ;
+  return function_passedOptions (operand0,
+                                 inCompiler
+                                 COMMA_THERE).getter_object (THERE) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_galgas_function_descriptor functionDescriptor_passedOptions ("passedOptions",
+                                                               functionWithGenericHeader_passedOptions,
+                                                               & kTypeDescriptor_GALGAS_gtlData,
+                                                               1,
+                                                               functionArgs_passedOptions) ;
+
 //----------------------------------------------------------------------------------------------------------------------
 //
 //Extension getter '@applicationDefinition templateData'
@@ -7614,142 +7674,133 @@ static GALGAS_gtlData extensionGetter_applicationDefinition_templateData (const
   GALGAS_gtlData result_cfg ; // Returned variable
   const cPtr_applicationDefinition * object = inObject ;
   macroValidSharedObject (object, cPtr_applicationDefinition) ;
-  result_cfg = GALGAS_gtlStruct::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 190)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 190)), GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("systemConfig.galgas", 190))  COMMA_SOURCE_FILE ("systemConfig.galgas", 190)) ;
+  result_cfg = GALGAS_gtlStruct::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 209)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 209)), GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("systemConfig.galgas", 209))  COMMA_SOURCE_FILE ("systemConfig.galgas", 209)) ;
   {
   result_cfg.insulate (HERE) ;
   cPtr_gtlData * ptr_5806 = (cPtr_gtlData *) result_cfg.ptr () ;
-  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_5806, GALGAS_lstring::constructor_new (GALGAS_string ("OILFILENAME"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 196))  COMMA_SOURCE_FILE ("systemConfig.galgas", 196)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 198)), function_lstring (GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 199)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 199)), GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 200)).getter_lastPathComponent (SOURCE_FILE ("systemConfig.galgas", 200))  COMMA_SOURCE_FILE ("systemConfig.galgas", 197)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 195)) ;
+  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_5806, GALGAS_lstring::constructor_new (GALGAS_string ("OILFILENAME"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 215))  COMMA_SOURCE_FILE ("systemConfig.galgas", 215)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 217)), function_lstring (GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 218)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 218)), GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 219)).getter_lastPathComponent (SOURCE_FILE ("systemConfig.galgas", 219))  COMMA_SOURCE_FILE ("systemConfig.galgas", 216)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 214)) ;
   }
   {
   result_cfg.insulate (HERE) ;
   cPtr_gtlData * ptr_6031 = (cPtr_gtlData *) result_cfg.ptr () ;
-  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_6031, GALGAS_lstring::constructor_new (GALGAS_string ("CPUNAME"), object->mProperty_name.getter_location (SOURCE_FILE ("systemConfig.galgas", 205))  COMMA_SOURCE_FILE ("systemConfig.galgas", 205)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 206)), function_lstring (GALGAS_string ("name of the CPU object"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 206)), object->mProperty_name.getter_string (SOURCE_FILE ("systemConfig.galgas", 206))  COMMA_SOURCE_FILE ("systemConfig.galgas", 206)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 204)) ;
+  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_6031, GALGAS_lstring::constructor_new (GALGAS_string ("CPUNAME"), object->mProperty_name.getter_location (SOURCE_FILE ("systemConfig.galgas", 224))  COMMA_SOURCE_FILE ("systemConfig.galgas", 224)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 225)), function_lstring (GALGAS_string ("name of the CPU object"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 225)), object->mProperty_name.getter_string (SOURCE_FILE ("systemConfig.galgas", 225))  COMMA_SOURCE_FILE ("systemConfig.galgas", 225)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 223)) ;
   }
   {
   result_cfg.insulate (HERE) ;
   cPtr_gtlData * ptr_6185 = (cPtr_gtlData *) result_cfg.ptr () ;
-  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_6185, GALGAS_lstring::constructor_new (GALGAS_string ("CPUDESCRIPTION"), object->mProperty_cpuDescription.getter_location (SOURCE_FILE ("systemConfig.galgas", 210))  COMMA_SOURCE_FILE ("systemConfig.galgas", 210)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 211)), function_lstring (GALGAS_string ("description of the CPU object"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 211)), object->mProperty_cpuDescription.getter_string (SOURCE_FILE ("systemConfig.galgas", 211))  COMMA_SOURCE_FILE ("systemConfig.galgas", 211)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 209)) ;
+  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_6185, GALGAS_lstring::constructor_new (GALGAS_string ("CPUDESCRIPTION"), object->mProperty_cpuDescription.getter_location (SOURCE_FILE ("systemConfig.galgas", 229))  COMMA_SOURCE_FILE ("systemConfig.galgas", 229)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 230)), function_lstring (GALGAS_string ("description of the CPU object"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 230)), object->mProperty_cpuDescription.getter_string (SOURCE_FILE ("systemConfig.galgas", 230))  COMMA_SOURCE_FILE ("systemConfig.galgas", 230)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 228)) ;
   }
   {
   result_cfg.insulate (HERE) ;
   cPtr_gtlData * ptr_6373 = (cPtr_gtlData *) result_cfg.ptr () ;
-  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_6373, GALGAS_lstring::constructor_new (GALGAS_string ("OILVERSION"), object->mProperty_version.getter_location (SOURCE_FILE ("systemConfig.galgas", 215))  COMMA_SOURCE_FILE ("systemConfig.galgas", 215)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 216)), object->mProperty_versionDescription, object->mProperty_version.getter_string (SOURCE_FILE ("systemConfig.galgas", 216))  COMMA_SOURCE_FILE ("systemConfig.galgas", 216)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 214)) ;
+  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_6373, GALGAS_lstring::constructor_new (GALGAS_string ("OILVERSION"), object->mProperty_version.getter_location (SOURCE_FILE ("systemConfig.galgas", 234))  COMMA_SOURCE_FILE ("systemConfig.galgas", 234)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 235)), object->mProperty_versionDescription, object->mProperty_version.getter_string (SOURCE_FILE ("systemConfig.galgas", 235))  COMMA_SOURCE_FILE ("systemConfig.galgas", 235)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 233)) ;
   }
   {
   result_cfg.insulate (HERE) ;
   cPtr_gtlData * ptr_6520 = (cPtr_gtlData *) result_cfg.ptr () ;
-  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_6520, GALGAS_lstring::constructor_new (GALGAS_string ("OILDESCRIPTION"), object->mProperty_versionDescription.getter_location (SOURCE_FILE ("systemConfig.galgas", 220))  COMMA_SOURCE_FILE ("systemConfig.galgas", 220)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 221)), object->mProperty_versionDescription, object->mProperty_versionDescription.getter_string (SOURCE_FILE ("systemConfig.galgas", 221))  COMMA_SOURCE_FILE ("systemConfig.galgas", 221)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 219)) ;
+  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_6520, GALGAS_lstring::constructor_new (GALGAS_string ("OILDESCRIPTION"), object->mProperty_versionDescription.getter_location (SOURCE_FILE ("systemConfig.galgas", 239))  COMMA_SOURCE_FILE ("systemConfig.galgas", 239)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 240)), object->mProperty_versionDescription, object->mProperty_versionDescription.getter_string (SOURCE_FILE ("systemConfig.galgas", 240))  COMMA_SOURCE_FILE ("systemConfig.galgas", 240)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 238)) ;
   }
   {
   result_cfg.insulate (HERE) ;
   cPtr_gtlData * ptr_6693 = (cPtr_gtlData *) result_cfg.ptr () ;
-  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_6693, GALGAS_lstring::constructor_new (GALGAS_string ("TIMESTAMP"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 225))  COMMA_SOURCE_FILE ("systemConfig.galgas", 225)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 227)), function_lstring (GALGAS_string ("timestamp of OIL compiling"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 228)), GALGAS_string::constructor_stringWithCurrentDateTime (SOURCE_FILE ("systemConfig.galgas", 229))  COMMA_SOURCE_FILE ("systemConfig.galgas", 226)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 224)) ;
+  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_6693, GALGAS_lstring::constructor_new (GALGAS_string ("TIMESTAMP"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 244))  COMMA_SOURCE_FILE ("systemConfig.galgas", 244)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 246)), function_lstring (GALGAS_string ("timestamp of OIL compiling"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 247)), function_generationDate (inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 248))  COMMA_SOURCE_FILE ("systemConfig.galgas", 245)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 243)) ;
   }
   {
   result_cfg.insulate (HERE) ;
   cPtr_gtlData * ptr_6899 = (cPtr_gtlData *) result_cfg.ptr () ;
-  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_6899, GALGAS_lstring::constructor_new (GALGAS_string ("PROJECT"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 234))  COMMA_SOURCE_FILE ("systemConfig.galgas", 234)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 236)), function_lstring (GALGAS_string ("project name"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 237)), function_projectName (inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 238)).getter_lastPathComponent (SOURCE_FILE ("systemConfig.galgas", 238))  COMMA_SOURCE_FILE ("systemConfig.galgas", 235)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 233)) ;
+  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_6899, GALGAS_lstring::constructor_new (GALGAS_string ("PROJECT"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 253))  COMMA_SOURCE_FILE ("systemConfig.galgas", 253)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 255)), function_lstring (GALGAS_string ("project name"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 256)), function_projectName (inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 257)).getter_lastPathComponent (SOURCE_FILE ("systemConfig.galgas", 257))  COMMA_SOURCE_FILE ("systemConfig.galgas", 254)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 252)) ;
   }
   {
   result_cfg.insulate (HERE) ;
   cPtr_gtlData * ptr_7090 = (cPtr_gtlData *) result_cfg.ptr () ;
-  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_7090, GALGAS_lstring::constructor_new (GALGAS_string ("TARGET"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 243))  COMMA_SOURCE_FILE ("systemConfig.galgas", 243)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 245)), function_lstring (GALGAS_string ("target architecture/chip/board"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 246)), GALGAS_string (gOption_goil_5F_options_target_5F_platform.getter_value ())  COMMA_SOURCE_FILE ("systemConfig.galgas", 244)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 242)) ;
+  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_7090, GALGAS_lstring::constructor_new (GALGAS_string ("TARGET"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 262))  COMMA_SOURCE_FILE ("systemConfig.galgas", 262)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 264)), function_lstring (GALGAS_string ("target architecture/chip/board"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 265)), GALGAS_string (gOption_goil_5F_options_target_5F_platform.getter_value ())  COMMA_SOURCE_FILE ("systemConfig.galgas", 263)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 261)) ;
   }
   {
   result_cfg.insulate (HERE) ;
   cPtr_gtlData * ptr_7305 = (cPtr_gtlData *) result_cfg.ptr () ;
-  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_7305, GALGAS_lstring::constructor_new (GALGAS_string ("TEMPLATEPATH"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 252))  COMMA_SOURCE_FILE ("systemConfig.galgas", 252)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 254)), function_lstring (GALGAS_string ("path of the templates used"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 255)), GALGAS_string (gOption_goil_5F_options_template_5F_dir.getter_value ())  COMMA_SOURCE_FILE ("systemConfig.galgas", 253)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 251)) ;
+  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_7305, GALGAS_lstring::constructor_new (GALGAS_string ("TEMPLATEPATH"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 271))  COMMA_SOURCE_FILE ("systemConfig.galgas", 271)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 273)), function_lstring (GALGAS_string ("path of the templates used"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 274)), GALGAS_string (gOption_goil_5F_options_template_5F_dir.getter_value ())  COMMA_SOURCE_FILE ("systemConfig.galgas", 272)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 270)) ;
   }
   {
   result_cfg.insulate (HERE) ;
   cPtr_gtlData * ptr_7521 = (cPtr_gtlData *) result_cfg.ptr () ;
-  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_7521, GALGAS_lstring::constructor_new (GALGAS_string ("ARCH"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 261))  COMMA_SOURCE_FILE ("systemConfig.galgas", 261)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 262)), function_lstring (GALGAS_string ("target architecture"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 262)), function_arch (inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 262))  COMMA_SOURCE_FILE ("systemConfig.galgas", 262)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 260)) ;
+  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_7521, GALGAS_lstring::constructor_new (GALGAS_string ("ARCH"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 280))  COMMA_SOURCE_FILE ("systemConfig.galgas", 280)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 281)), function_lstring (GALGAS_string ("target architecture"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 281)), function_arch (inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 281))  COMMA_SOURCE_FILE ("systemConfig.galgas", 281)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 279)) ;
   }
   {
   result_cfg.insulate (HERE) ;
   cPtr_gtlData * ptr_7663 = (cPtr_gtlData *) result_cfg.ptr () ;
-  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_7663, GALGAS_lstring::constructor_new (GALGAS_string ("CHIP"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 266))  COMMA_SOURCE_FILE ("systemConfig.galgas", 266)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 267)), function_lstring (GALGAS_string ("target chip"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 267)), function_chip (inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 267))  COMMA_SOURCE_FILE ("systemConfig.galgas", 267)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 265)) ;
+  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_7663, GALGAS_lstring::constructor_new (GALGAS_string ("CHIP"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 285))  COMMA_SOURCE_FILE ("systemConfig.galgas", 285)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 286)), function_lstring (GALGAS_string ("target chip"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 286)), function_chip (inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 286))  COMMA_SOURCE_FILE ("systemConfig.galgas", 286)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 284)) ;
   }
   {
   result_cfg.insulate (HERE) ;
   cPtr_gtlData * ptr_7796 = (cPtr_gtlData *) result_cfg.ptr () ;
-  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_7796, GALGAS_lstring::constructor_new (GALGAS_string ("BOARD"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 271))  COMMA_SOURCE_FILE ("systemConfig.galgas", 271)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 272)), function_lstring (GALGAS_string ("target board"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 272)), function_board (inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 272))  COMMA_SOURCE_FILE ("systemConfig.galgas", 272)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 270)) ;
+  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_7796, GALGAS_lstring::constructor_new (GALGAS_string ("BOARD"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 290))  COMMA_SOURCE_FILE ("systemConfig.galgas", 290)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 291)), function_lstring (GALGAS_string ("target board"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 291)), function_board (inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 291))  COMMA_SOURCE_FILE ("systemConfig.galgas", 291)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 289)) ;
   }
   {
   result_cfg.insulate (HERE) ;
   cPtr_gtlData * ptr_7932 = (cPtr_gtlData *) result_cfg.ptr () ;
-  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_7932, GALGAS_lstring::constructor_new (GALGAS_string ("TARGETPATHLIST"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 276))  COMMA_SOURCE_FILE ("systemConfig.galgas", 276)), GALGAS_gtlList::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 277)), function_lstring (GALGAS_string ("target path list"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 277)), function_targetPathList (inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 277))  COMMA_SOURCE_FILE ("systemConfig.galgas", 277)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 275)) ;
+  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_7932, GALGAS_lstring::constructor_new (GALGAS_string ("TARGETPATHLIST"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 295))  COMMA_SOURCE_FILE ("systemConfig.galgas", 295)), GALGAS_gtlList::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 296)), function_lstring (GALGAS_string ("target path list"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 296)), function_targetPathList (inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 296))  COMMA_SOURCE_FILE ("systemConfig.galgas", 296)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 294)) ;
   }
   {
   result_cfg.insulate (HERE) ;
   cPtr_gtlData * ptr_8089 = (cPtr_gtlData *) result_cfg.ptr () ;
-  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_8089, GALGAS_lstring::constructor_new (GALGAS_string ("LOGFILE"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 281))  COMMA_SOURCE_FILE ("systemConfig.galgas", 281)), GALGAS_gtlBool::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 283)), function_lstring (GALGAS_string ("Generated a logfile"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 284)), GALGAS_bool (gOption_goil_5F_options_generate_5F_log.getter_value ())  COMMA_SOURCE_FILE ("systemConfig.galgas", 282)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 280)) ;
+  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_8089, GALGAS_lstring::constructor_new (GALGAS_string ("LOGFILE"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 300))  COMMA_SOURCE_FILE ("systemConfig.galgas", 300)), GALGAS_gtlBool::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 302)), function_lstring (GALGAS_string ("Generated a logfile"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 303)), GALGAS_bool (gOption_goil_5F_options_generate_5F_log.getter_value ())  COMMA_SOURCE_FILE ("systemConfig.galgas", 301)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 299)) ;
   }
   {
   result_cfg.insulate (HERE) ;
-  cPtr_gtlData * ptr_8291 = (cPtr_gtlData *) result_cfg.ptr () ;
-  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_8291, GALGAS_lstring::constructor_new (GALGAS_string ("EOF"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 290))  COMMA_SOURCE_FILE ("systemConfig.galgas", 290)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 292)), function_lstring (GALGAS_string ("End of file location"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 293)), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 294)).getter_locationString (inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 294))  COMMA_SOURCE_FILE ("systemConfig.galgas", 291)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 289)) ;
+  cPtr_gtlData * ptr_8187 = (cPtr_gtlData *) result_cfg.ptr () ;
+  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_8187, GALGAS_lstring::constructor_new (GALGAS_string ("FOOTPRINT"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 309))  COMMA_SOURCE_FILE ("systemConfig.galgas", 309)), GALGAS_gtlBool::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 311)), function_lstring (GALGAS_string ("Generate a footprint report"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 312)), GALGAS_bool (gOption_goil_5F_options_footprint.getter_value ())  COMMA_SOURCE_FILE ("systemConfig.galgas", 310)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 308)) ;
   }
-  GALGAS_gtlData var_opts_8509 = GALGAS_gtlStruct::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 300)), function_lstring (GALGAS_string ("Passed options"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 301)), GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("systemConfig.galgas", 302))  COMMA_SOURCE_FILE ("systemConfig.galgas", 299)) ;
-  GALGAS_string var_optionString_8614 = extensionGetter_trimRight (extensionGetter_trimLeft (GALGAS_string (gOption_goil_5F_options_passOption.getter_value ()), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 304)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 304)) ;
-  enumGalgasBool test_0 = kBoolTrue ;
-  if (kBoolTrue == test_0) {
-    GALGAS_bool test_1 = GALGAS_bool (kIsStrictSup, var_optionString_8614.getter_length (SOURCE_FILE ("systemConfig.galgas", 305)).objectCompare (GALGAS_uint ((uint32_t) 0U))) ;
-    if (kBoolTrue != test_1.boolEnum ()) {
-      test_1 = GALGAS_bool (gOption_goil_5F_options_pierreOption.getter_value ()) ;
-    }
-    test_0 = test_1.boolEnum () ;
-    if (kBoolTrue == test_0) {
-      var_opts_8509.drop () ;
-      cGrammar_options_5F_grammar::_performSourceStringParsing_ (inCompiler, GALGAS_string (gOption_goil_5F_options_passOption.getter_value ()), GALGAS_string ("Passed options"), var_opts_8509  COMMA_SOURCE_FILE ("systemConfig.galgas", 306)) ;
-    }
+  {
+  result_cfg.insulate (HERE) ;
+  cPtr_gtlData * ptr_8291 = (cPtr_gtlData *) result_cfg.ptr () ;
+  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_8291, GALGAS_lstring::constructor_new (GALGAS_string ("EOF"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 309))  COMMA_SOURCE_FILE ("systemConfig.galgas", 309)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 311)), function_lstring (GALGAS_string ("End of file location"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 312)), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 313)).getter_locationString (inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 313))  COMMA_SOURCE_FILE ("systemConfig.galgas", 310)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 308)) ;
   }
   {
   result_cfg.insulate (HERE) ;
   cPtr_gtlData * ptr_8871 = (cPtr_gtlData *) result_cfg.ptr () ;
-  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_8871, GALGAS_lstring::constructor_new (GALGAS_string ("PASSEDOPTIONS"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 310))  COMMA_SOURCE_FILE ("systemConfig.galgas", 310)), var_opts_8509, inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 309)) ;
+  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_8871, GALGAS_lstring::constructor_new (GALGAS_string ("PASSEDOPTIONS"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 327))  COMMA_SOURCE_FILE ("systemConfig.galgas", 327)), function_passedOptions (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 328)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 328)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 326)) ;
   }
   cEnumerator_objectsMap enumerator_8968 (object->mProperty_objects, kENUMERATION_UP) ;
   while (enumerator_8968.hasCurrentObject ()) {
     GALGAS_implementationObject var_implementationObject_9208 ;
-    constinArgument_imp.getter_imp (SOURCE_FILE ("systemConfig.galgas", 318)).method_get (enumerator_8968.current_lkey (HERE), var_implementationObject_9208, inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 318)) ;
-    enumGalgasBool test_2 = kBoolTrue ;
-    if (kBoolTrue == test_2) {
-      test_2 = var_implementationObject_9208.getter_multiple (SOURCE_FILE ("systemConfig.galgas", 319)).getter_bool (SOURCE_FILE ("systemConfig.galgas", 319)).boolEnum () ;
-      if (kBoolTrue == test_2) {
+    constinArgument_imp.getter_imp (SOURCE_FILE ("systemConfig.galgas", 326)).method_get (enumerator_8968.current_lkey (HERE), var_implementationObject_9208, inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 326)) ;
+    enumGalgasBool test_0 = kBoolTrue ;
+    if (kBoolTrue == test_0) {
+      test_0 = var_implementationObject_9208.getter_multiple (SOURCE_FILE ("systemConfig.galgas", 327)).getter_bool (SOURCE_FILE ("systemConfig.galgas", 327)).boolEnum () ;
+      if (kBoolTrue == test_0) {
         GALGAS_gtlList var_objs_9280 = GALGAS_gtlList::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 320)), enumerator_8968.current_lkey (HERE), GALGAS_list::constructor_emptyList (SOURCE_FILE ("systemConfig.galgas", 320))  COMMA_SOURCE_FILE ("systemConfig.galgas", 320)) ;
-        cEnumerator_objectKindMap enumerator_9357 (enumerator_8968.current_objectsOfKind (HERE).getter_objects (SOURCE_FILE ("systemConfig.galgas", 321)), kENUMERATION_UP) ;
+        cEnumerator_objectKindMap enumerator_9357 (enumerator_8968.current_objectsOfKind (HERE).getter_objects (SOURCE_FILE ("systemConfig.galgas", 329)), kENUMERATION_UP) ;
         while (enumerator_9357.hasCurrentObject ()) {
-          GALGAS_gtlData var_attrs_9383 = callExtensionGetter_fieldMap ((const cPtr_objectAttributes *) enumerator_9357.current_attributes (HERE).ptr (), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 322)) ;
+          GALGAS_gtlData var_attrs_9383 = callExtensionGetter_fieldMap ((const cPtr_objectAttributes *) enumerator_9357.current_attributes (HERE).ptr (), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 330)) ;
           {
           var_objs_9280.insulate (HERE) ;
           cPtr_gtlList * ptr_9432 = (cPtr_gtlList *) var_objs_9280.ptr () ;
-          callExtensionSetter_appendItem ((cPtr_gtlList *) ptr_9432, var_attrs_9383, inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 324)) ;
+          callExtensionSetter_appendItem ((cPtr_gtlList *) ptr_9432, var_attrs_9383, inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 332)) ;
           }
           enumerator_9357.gotoNextObject () ;
         }
         {
         result_cfg.insulate (HERE) ;
         cPtr_gtlData * ptr_9474 = (cPtr_gtlData *) result_cfg.ptr () ;
-        callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_9474, enumerator_8968.current_lkey (HERE), var_objs_9280, inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 326)) ;
+        callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_9474, enumerator_8968.current_lkey (HERE), var_objs_9280, inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 334)) ;
         }
       }
     }
-    if (kBoolFalse == test_2) {
-      enumGalgasBool test_3 = kBoolTrue ;
-      if (kBoolTrue == test_3) {
-        test_3 = GALGAS_bool (kIsEqual, enumerator_8968.current_objectsOfKind (HERE).getter_objects (SOURCE_FILE ("systemConfig.galgas", 332)).getter_count (SOURCE_FILE ("systemConfig.galgas", 332)).objectCompare (GALGAS_uint ((uint32_t) 1U))).boolEnum () ;
-        if (kBoolTrue == test_3) {
-          GALGAS_gtlData var_attrs_9639 = GALGAS_gtlStruct::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 333)), enumerator_8968.current_lkey (HERE), GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("systemConfig.galgas", 333))  COMMA_SOURCE_FILE ("systemConfig.galgas", 333)) ;
-          cEnumerator_objectKindMap enumerator_9727 (enumerator_8968.current_objectsOfKind (HERE).getter_objects (SOURCE_FILE ("systemConfig.galgas", 334)), kENUMERATION_UP) ;
+    if (kBoolFalse == test_0) {
+      enumGalgasBool test_1 = kBoolTrue ;
+      if (kBoolTrue == test_1) {
+        test_1 = GALGAS_bool (kIsEqual, enumerator_8968.current_objectsOfKind (HERE).getter_objects (SOURCE_FILE ("systemConfig.galgas", 340)).getter_count (SOURCE_FILE ("systemConfig.galgas", 340)).objectCompare (GALGAS_uint ((uint32_t) 1U))).boolEnum () ;
+        if (kBoolTrue == test_1) {
+          GALGAS_gtlData var_attrs_9639 = GALGAS_gtlStruct::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 341)), enumerator_8968.current_lkey (HERE), GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("systemConfig.galgas", 341))  COMMA_SOURCE_FILE ("systemConfig.galgas", 341)) ;
+          cEnumerator_objectKindMap enumerator_9727 (enumerator_8968.current_objectsOfKind (HERE).getter_objects (SOURCE_FILE ("systemConfig.galgas", 342)), kENUMERATION_UP) ;
           while (enumerator_9727.hasCurrentObject ()) {
-            var_attrs_9639 = callExtensionGetter_fieldMap ((const cPtr_objectAttributes *) enumerator_9727.current_attributes (HERE).ptr (), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 335)) ;
+            var_attrs_9639 = callExtensionGetter_fieldMap ((const cPtr_objectAttributes *) enumerator_9727.current_attributes (HERE).ptr (), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 343)) ;
             enumerator_9727.gotoNextObject () ;
           }
           {
           result_cfg.insulate (HERE) ;
           cPtr_gtlData * ptr_9797 = (cPtr_gtlData *) result_cfg.ptr () ;
-          callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_9797, enumerator_8968.current_lkey (HERE), var_attrs_9639, inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 337)) ;
+          callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_9797, enumerator_8968.current_lkey (HERE), var_attrs_9639, inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 345)) ;
           }
         }
       }
@@ -9550,8 +9601,14 @@ void cGrammar_goil_5F_grammar::nt_start_parse (C_Lexique_goil_5F_lexique * inLex
   rule_goil_5F_syntax_start_i0_parse(inLexique) ;
 }
 
-void cGrammar_goil_5F_grammar::nt_start_ (C_Lexique_goil_5F_lexique * inLexique) {
-  rule_goil_5F_syntax_start_i0_(inLexique) ;
+void cGrammar_goil_5F_grammar::nt_start_ (GALGAS_string & parameter_1,
+                                GALGAS_implementation & parameter_2,
+                                GALGAS_applicationDefinition & parameter_3,
+                                GALGAS_string & parameter_4,
+                                GALGAS_library & parameter_5,
+                                GALGAS_gtlData & parameter_6,
+                                C_Lexique_goil_5F_lexique * inLexique) {
+  rule_goil_5F_syntax_start_i0_(parameter_1, parameter_2, parameter_3, parameter_4, parameter_5, parameter_6, inLexique) ;
 }
 
 void cGrammar_goil_5F_grammar::performIndexing (C_Compiler * /* inCompiler */,
@@ -9586,7 +9643,13 @@ void cGrammar_goil_5F_grammar::performOnlySyntaxAnalysis (C_Compiler * inCompile
 //---------------------------------------------------------------------------------------------------------------------*
 
 void cGrammar_goil_5F_grammar::_performSourceFileParsing_ (C_Compiler * inCompiler,
-                                GALGAS_lstring inFilePath
+                                GALGAS_lstring inFilePath,
+                                GALGAS_string &  parameter_1,
+                                GALGAS_implementation &  parameter_2,
+                                GALGAS_applicationDefinition &  parameter_3,
+                                GALGAS_string &  parameter_4,
+                                GALGAS_library &  parameter_5,
+                                GALGAS_gtlData &  parameter_6
                                 COMMA_LOCATION_ARGS) {
   if (inFilePath.isValid ()) {
     const GALGAS_string filePathAsString = inFilePath.getter_string (HERE) ;
@@ -9602,7 +9665,7 @@ void cGrammar_goil_5F_grammar::_performSourceFileParsing_ (C_Compiler * inCompil
                                                       gFirstProductionIndexes_goil_grammar, gDecision_goil_grammar, gDecisionIndexes_goil_grammar, 448) ;
       if (ok && ! executionModeIsSyntaxAnalysisOnly ()) {
         cGrammar_goil_5F_grammar grammar ;
-        grammar.nt_start_ (scanner) ;
+        grammar.nt_start_ (parameter_1, parameter_2, parameter_3, parameter_4, parameter_5, parameter_6, scanner) ;
         }
       }else{
         C_String message ;
@@ -9624,7 +9687,13 @@ void cGrammar_goil_5F_grammar::_performSourceFileParsing_ (C_Compiler * inCompil
 
 void cGrammar_goil_5F_grammar::_performSourceStringParsing_ (C_Compiler * inCompiler,
                                 GALGAS_string inSourceString,
-                                GALGAS_string inNameString
+                                GALGAS_string inNameString,
+                                GALGAS_string &  parameter_1,
+                                GALGAS_implementation &  parameter_2,
+                                GALGAS_applicationDefinition &  parameter_3,
+                                GALGAS_string &  parameter_4,
+                                GALGAS_library &  parameter_5,
+                                GALGAS_gtlData &  parameter_6
                                 COMMA_UNUSED_LOCATION_ARGS) {
   if (inSourceString.isValid () && inNameString.isValid ()) {
     const C_String sourceString = inSourceString.stringValue () ;
@@ -9635,7 +9704,7 @@ void cGrammar_goil_5F_grammar::_performSourceStringParsing_ (C_Compiler * inComp
                                                     gFirstProductionIndexes_goil_grammar, gDecision_goil_grammar, gDecisionIndexes_goil_grammar, 448) ;
     if (ok && ! executionModeIsSyntaxAnalysisOnly ()) {
       cGrammar_goil_5F_grammar grammar ;
-      grammar.nt_start_ (scanner) ;
+      grammar.nt_start_ (parameter_1, parameter_2, parameter_3, parameter_4, parameter_5, parameter_6, scanner) ;
     }
     macroDetachSharedObject (scanner) ;
   }
@@ -9881,8 +9950,9 @@ void cGrammar_goil_5F_grammar::nt_include_5F_type_5F_level_parse (C_Lexique_goil
 }
 
 void cGrammar_goil_5F_grammar::nt_include_5F_type_5F_level_ (GALGAS_implementationObjectMap & parameter_1,
+                                GALGAS_implementationMap & parameter_2,
                                 C_Lexique_goil_5F_lexique * inLexique) {
-  rule_implementation_5F_parser_include_5F_type_5F_level_i3_(parameter_1, inLexique) ;
+  rule_implementation_5F_parser_include_5F_type_5F_level_i3_(parameter_1, parameter_2, inLexique) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -9911,8 +9981,9 @@ void cGrammar_goil_5F_grammar::nt_implementation_5F_list_parse (C_Lexique_goil_5
 }
 
 void cGrammar_goil_5F_grammar::nt_implementation_5F_list_ (GALGAS_implementationObjectMap & parameter_1,
+                                GALGAS_implementationMap & parameter_2,
                                 C_Lexique_goil_5F_lexique * inLexique) {
-  rule_implementation_5F_parser_implementation_5F_list_i5_(parameter_1, inLexique) ;
+  rule_implementation_5F_parser_implementation_5F_list_i5_(parameter_1, parameter_2, inLexique) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -9927,8 +9998,9 @@ void cGrammar_goil_5F_grammar::nt_implementation_5F_type_parse (C_Lexique_goil_5
 
 void cGrammar_goil_5F_grammar::nt_implementation_5F_type_ (GALGAS_lstring & parameter_1,
                                 GALGAS_impType & parameter_2,
+                                GALGAS_implementationMap & parameter_3,
                                 C_Lexique_goil_5F_lexique * inLexique) {
-  rule_implementation_5F_parser_implementation_5F_type_i6_(parameter_1, parameter_2, inLexique) ;
+  rule_implementation_5F_parser_implementation_5F_type_i6_(parameter_1, parameter_2, parameter_3, inLexique) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -9943,8 +10015,9 @@ void cGrammar_goil_5F_grammar::nt_struct_5F_options_parse (C_Lexique_goil_5F_lex
 
 void cGrammar_goil_5F_grammar::nt_struct_5F_options_ (GALGAS_lstring & parameter_1,
                                 GALGAS_impType & parameter_2,
+                                GALGAS_implementationMap & parameter_3,
                                 C_Lexique_goil_5F_lexique * inLexique) {
-  rule_implementation_5F_parser_struct_5F_options_i7_(parameter_1, parameter_2, inLexique) ;
+  rule_implementation_5F_parser_struct_5F_options_i7_(parameter_1, parameter_2, parameter_3, inLexique) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -9992,8 +10065,9 @@ void cGrammar_goil_5F_grammar::nt_boolean_5F_options_parse (C_Lexique_goil_5F_le
 
 void cGrammar_goil_5F_grammar::nt_boolean_5F_options_ (GALGAS_lstring & parameter_1,
                                 GALGAS_impType & parameter_2,
+                                GALGAS_implementationMap & parameter_3,
                                 C_Lexique_goil_5F_lexique * inLexique) {
-  rule_implementation_5F_parser_boolean_5F_options_i10_(parameter_1, parameter_2, inLexique) ;
+  rule_implementation_5F_parser_boolean_5F_options_i10_(parameter_1, parameter_2, parameter_3, inLexique) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -10007,8 +10081,9 @@ void cGrammar_goil_5F_grammar::nt_enum_5F_item_parse (C_Lexique_goil_5F_lexique
 }
 
 void cGrammar_goil_5F_grammar::nt_enum_5F_item_ (GALGAS_enumValues & parameter_1,
+                                GALGAS_implementationMap & parameter_2,
                                 C_Lexique_goil_5F_lexique * inLexique) {
-  rule_implementation_5F_parser_enum_5F_item_i11_(parameter_1, inLexique) ;
+  rule_implementation_5F_parser_enum_5F_item_i11_(parameter_1, parameter_2, inLexique) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -10023,8 +10098,9 @@ void cGrammar_goil_5F_grammar::nt_enum_5F_options_parse (C_Lexique_goil_5F_lexiq
 
 void cGrammar_goil_5F_grammar::nt_enum_5F_options_ (GALGAS_lstring & parameter_1,
                                 GALGAS_impType & parameter_2,
+                                GALGAS_implementationMap & parameter_3,
                                 C_Lexique_goil_5F_lexique * inLexique) {
-  rule_implementation_5F_parser_enum_5F_options_i12_(parameter_1, parameter_2, inLexique) ;
+  rule_implementation_5F_parser_enum_5F_options_i12_(parameter_1, parameter_2, parameter_3, inLexique) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
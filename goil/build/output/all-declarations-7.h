@@ -936,6 +936,16 @@ class GALGAS_string function_chip (class C_Compiler * inCompiler
 class GALGAS_string function_projectName (class C_Compiler * inCompiler
                                           COMMA_LOCATION_ARGS) ;
 
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Function 'projectDirectory'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+class GALGAS_string function_projectDirectory (const class GALGAS_string & constinArgument0,
+                                               class C_Compiler * inCompiler
+                                               COMMA_LOCATION_ARGS) ;
+
 //----------------------------------------------------------------------------------------------------------------------
 //
 //Function 'targetPathList'
@@ -1084,6 +1094,7 @@ class cGrammar_goil_5F_grammar : public cParser_goil_5F_syntax,
 //----------- '' label
   public : virtual void nt_boolean_5F_options_ (GALGAS_lstring & outArgument0,
                                                 GALGAS_impType & outArgument1,
+                                                GALGAS_implementationMap & ioArgument2,
                                                 C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //------------------------------------- 'description' non terminal
@@ -1100,6 +1111,7 @@ class cGrammar_goil_5F_grammar : public cParser_goil_5F_syntax,
 
 //----------- '' label
   public : virtual void nt_enum_5F_item_ (GALGAS_enumValues & ioArgument0,
+                                          GALGAS_implementationMap & ioArgument1,
                                           C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //------------------------------------- 'enum_options' non terminal
@@ -1109,6 +1121,7 @@ class cGrammar_goil_5F_grammar : public cParser_goil_5F_syntax,
 //----------- '' label
   public : virtual void nt_enum_5F_options_ (GALGAS_lstring & outArgument0,
                                              GALGAS_impType & outArgument1,
+                                             GALGAS_implementationMap & ioArgument2,
                                              C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //------------------------------------- 'file' non terminal
@@ -1152,6 +1165,7 @@ class cGrammar_goil_5F_grammar : public cParser_goil_5F_syntax,
 
 //----------- '' label
   public : virtual void nt_implementation_5F_list_ (GALGAS_implementationObjectMap & ioArgument0,
+                                                    GALGAS_implementationMap & ioArgument1,
                                                     C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //------------------------------------- 'implementation_object_list' non terminal
@@ -1177,6 +1191,7 @@ class cGrammar_goil_5F_grammar : public cParser_goil_5F_syntax,
 //----------- '' label
   public : virtual void nt_implementation_5F_type_ (GALGAS_lstring & outArgument0,
                                                     GALGAS_impType & outArgument1,
+                                                    GALGAS_implementationMap & ioArgument2,
                                                     C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //------------------------------------- 'include_cpu_level' non terminal
@@ -1224,6 +1239,7 @@ class cGrammar_goil_5F_grammar : public cParser_goil_5F_syntax,
 
 //----------- '' label
   public : virtual void nt_include_5F_type_5F_level_ (GALGAS_implementationObjectMap & ioArgument0,
+                                                      GALGAS_implementationMap & ioArgument1,
                                                       C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //------------------------------------- 'int_or_float' non terminal
@@ -1332,16 +1348,34 @@ class cGrammar_goil_5F_grammar : public cParser_goil_5F_syntax,
   public : virtual void nt_start_parse (C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //----------- '' label
-  public : virtual void nt_start_ (C_Lexique_goil_5F_lexique * inCompiler) ;
+  public : virtual void nt_start_ (GALGAS_string & ioArgument0,
+                                   GALGAS_implementation & ioArgument1,
+                                   GALGAS_applicationDefinition & ioArgument2,
+                                   GALGAS_string & ioArgument3,
+                                   GALGAS_library & ioArgument4,
+                                   GALGAS_gtlData & outArgument5,
+                                   C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //--- Start symbol
   public : static void _performSourceFileParsing_ (C_Compiler * inCompiler,
-                                                   GALGAS_lstring inFileName
+                                                   GALGAS_lstring inFileName,
+                                                   GALGAS_string & ioArgument0,
+                                                   GALGAS_implementation & ioArgument1,
+                                                   GALGAS_applicationDefinition & ioArgument2,
+                                                   GALGAS_string & ioArgument3,
+                                                   GALGAS_library & ioArgument4,
+                                                   GALGAS_gtlData & outArgument5
                                                    COMMA_LOCATION_ARGS) ;
 
   public : static void _performSourceStringParsing_ (C_Compiler * inCompiler,
                                                      GALGAS_string inSourceString,
-                                                     GALGAS_string inNameString
+                                                     GALGAS_string inNameString,
+                                                     GALGAS_string & ioArgument0,
+                                                     GALGAS_implementation & ioArgument1,
+                                                     GALGAS_applicationDefinition & ioArgument2,
+                                                     GALGAS_string & ioArgument3,
+                                                     GALGAS_library & ioArgument4,
+                                                     GALGAS_gtlData & outArgument5
                                                      COMMA_LOCATION_ARGS) ;
 
 //--- Indexing
@@ -1372,6 +1406,7 @@ class cGrammar_goil_5F_grammar : public cParser_goil_5F_syntax,
 //----------- '' label
   public : virtual void nt_struct_5F_options_ (GALGAS_lstring & outArgument0,
                                                GALGAS_impType & outArgument1,
+                                               GALGAS_implementationMap & ioArgument2,
                                                C_Lexique_goil_5F_lexique * inCompiler) ;
 
 //------------------------------------- 'type_options' non terminal
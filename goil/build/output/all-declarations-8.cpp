@@ -6026,74 +6026,33 @@ int32_t cGrammar_gtl_5F_grammar::select_gtl_5F_instruction_5F_parser_6 (C_Lexiqu
 
 //----------------------------------------------------------------------------------------------------------------------
 //
-//Function 'invokeGTL'
+//Routine 'invokeGTL'
 //
 //----------------------------------------------------------------------------------------------------------------------
 
-GALGAS_string function_invokeGTL (GALGAS_gtlString inArgument_rootTemplateFileName,
-                                  GALGAS_gtlContext inArgument_context,
-                                  GALGAS_gtlData inArgument_vars,
-                                  C_Compiler * inCompiler
-                                  COMMA_UNUSED_LOCATION_ARGS) {
-  GALGAS_string result_result ; // Returned variable
-  result_result = GALGAS_string::makeEmptyString () ;
-  GALGAS_library var_lib_1098 = function_emptyLib (inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 36)) ;
+void routine_invokeGTL (GALGAS_gtlString inArgument_rootTemplateFileName,
+                        GALGAS_gtlContext inArgument_context,
+                        GALGAS_gtlData inArgument_vars,
+                        GALGAS_library & ioArgument_lib,
+                        GALGAS_string & outArgument_result,
+                        C_Compiler * inCompiler
+                        COMMA_UNUSED_LOCATION_ARGS) {
+  outArgument_result.drop () ; // Release 'out' argument
+  outArgument_result = GALGAS_string::makeEmptyString () ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
     test_0 = GALGAS_bool (gOption_gtl_5F_options_debug.getter_value ()).boolEnum () ;
     if (kBoolTrue == test_0) {
       inCompiler->printMessage (GALGAS_string ("Starting debugger, type help for command list\n")  COMMA_SOURCE_FILE ("gtl_interface.galgas", 39)) ;
-      extensionMethod_loadCommandFile (GALGAS_string (".gtlinit"), inArgument_context, inArgument_vars, var_lib_1098, inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 40)) ;
+      extensionMethod_loadCommandFile (GALGAS_string (".gtlinit"), inArgument_context, inArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 40)) ;
     }
   }
-  GALGAS_gtlTemplateInstruction var_rootTemplateInstruction_1367 = GALGAS_gtlTemplateInstruction::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("gtl_interface.galgas", 45)), GALGAS_string::makeEmptyString (), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 47)), GALGAS_gtlTerminal::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("gtl_interface.galgas", 49)), inArgument_rootTemplateFileName  COMMA_SOURCE_FILE ("gtl_interface.galgas", 48)), GALGAS_bool (false), GALGAS_bool (true), GALGAS_gtlExpressionList::constructor_emptyList (SOURCE_FILE ("gtl_interface.galgas", 54)), GALGAS_gtlInstructionList::constructor_emptyList (SOURCE_FILE ("gtl_interface.galgas", 55))  COMMA_SOURCE_FILE ("gtl_interface.galgas", 44)) ;
-  callExtensionMethod_execute ((const cPtr_gtlTemplateInstruction *) var_rootTemplateInstruction_1367.ptr (), inArgument_context, inArgument_vars, var_lib_1098, result_result, inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 59)) ;
-//---
-  return result_result ;
+  GALGAS_gtlTemplateInstruction var_rootTemplateInstruction_1367 = GALGAS_gtlTemplateInstruction::constructor_new (inArgument_rootTemplateFileName.getter_where (SOURCE_FILE ("gtl_interface.galgas", 45)), GALGAS_string::makeEmptyString (), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 47)), GALGAS_gtlTerminal::constructor_new (inArgument_rootTemplateFileName.getter_where (SOURCE_FILE ("gtl_interface.galgas", 49)), inArgument_rootTemplateFileName  COMMA_SOURCE_FILE ("gtl_interface.galgas", 48)), GALGAS_bool (false), GALGAS_bool (true), GALGAS_gtlExpressionList::constructor_emptyList (SOURCE_FILE ("gtl_interface.galgas", 54)), GALGAS_gtlInstructionList::constructor_emptyList (SOURCE_FILE ("gtl_interface.galgas", 55))  COMMA_SOURCE_FILE ("gtl_interface.galgas", 44)) ;
+  callExtensionMethod_execute ((const cPtr_gtlTemplateInstruction *) var_rootTemplateInstruction_1367.ptr (), inArgument_context, inArgument_vars, ioArgument_lib, outArgument_result, inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 59)) ;
+  GALGAS_application::class_method_waitOutputJobs (SOURCE_FILE ("gtl_interface.galgas", 66)) ;
 }
 
 
-//----------------------------------------------------------------------------------------------------------------------
-//  Function introspection                                                                       
-//----------------------------------------------------------------------------------------------------------------------
-
-static const C_galgas_type_descriptor * functionArgs_invokeGTL [4] = {
-  & kTypeDescriptor_GALGAS_gtlString,
-  & kTypeDescriptor_GALGAS_gtlContext,
-  & kTypeDescriptor_GALGAS_gtlData,
-  NULL
-} ;
-
-//----------------------------------------------------------------------------------------------------------------------
-
-static GALGAS_object functionWithGenericHeader_invokeGTL (C_Compiler * inCompiler,
-                                                          const cObjectArray & inEffectiveParameterArray,
-                                                          const GALGAS_location & /* inErrorLocation */
-                                                          COMMA_LOCATION_ARGS) {
-  const GALGAS_gtlString operand0 = GALGAS_gtlString::extractObject (inEffectiveParameterArray.objectAtIndex (0 COMMA_HERE),
-                                                                     inCompiler
-                                                                     COMMA_THERE) ;
-  const GALGAS_gtlContext operand1 = GALGAS_gtlContext::extractObject (inEffectiveParameterArray.objectAtIndex (1 COMMA_HERE),
-                                                                       inCompiler
-                                                                       COMMA_THERE) ;
-  const GALGAS_gtlData operand2 = GALGAS_gtlData::extractObject (inEffectiveParameterArray.objectAtIndex (2 COMMA_HERE),
-                                                                 inCompiler
-                                                                 COMMA_THERE) ;
-  return function_invokeGTL (operand0,
-                             operand1,
-                             operand2,
-                             inCompiler
-                             COMMA_THERE).getter_object (THERE) ;
-}
-
-//----------------------------------------------------------------------------------------------------------------------
-
-C_galgas_function_descriptor functionDescriptor_invokeGTL ("invokeGTL",
-                                                           functionWithGenericHeader_invokeGTL,
-                                                           & kTypeDescriptor_GALGAS_string,
-                                                           3,
-                                                           functionArgs_invokeGTL) ;
-
 //----------------------------------------------------------------------------------------------------------------------
 //
 //Function 'emptyVarContainer'
@@ -6103,7 +6062,7 @@ C_galgas_function_descriptor functionDescriptor_invokeGTL ("invokeGTL",
 GALGAS_gtlData function_emptyVarContainer (C_Compiler * inCompiler
                                            COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_gtlData result_result ; // Returned variable
-  result_result = GALGAS_gtlStruct::constructor_new (GALGAS_location::constructor_nowhere (SOURCE_FILE ("gtl_interface.galgas", 73)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 73)), GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("gtl_interface.galgas", 73))  COMMA_SOURCE_FILE ("gtl_interface.galgas", 73)) ;
+  result_result = GALGAS_gtlStruct::constructor_new (GALGAS_location::constructor_nowhere (SOURCE_FILE ("gtl_interface.galgas", 75)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 75)), GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("gtl_interface.galgas", 75))  COMMA_SOURCE_FILE ("gtl_interface.galgas", 75)) ;
 //---
   return result_result ;
 }
@@ -6144,7 +6103,7 @@ GALGAS_gtlString function_lstringToGtlString (GALGAS_lstring inArgument_input,
                                               C_Compiler * inCompiler
                                               COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_gtlString result_output ; // Returned variable
-  result_output = GALGAS_gtlString::constructor_new (inArgument_input.getter_location (SOURCE_FILE ("gtl_interface.galgas", 83)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 83)), inArgument_input.getter_string (SOURCE_FILE ("gtl_interface.galgas", 83))  COMMA_SOURCE_FILE ("gtl_interface.galgas", 83)) ;
+  result_output = GALGAS_gtlString::constructor_new (inArgument_input.getter_location (SOURCE_FILE ("gtl_interface.galgas", 85)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 85)), inArgument_input.getter_string (SOURCE_FILE ("gtl_interface.galgas", 85))  COMMA_SOURCE_FILE ("gtl_interface.galgas", 85)) ;
 //---
   return result_output ;
 }
@@ -6191,7 +6150,7 @@ GALGAS_gtlString function_stringToGtlString (GALGAS_string inArgument_input,
                                              C_Compiler * inCompiler
                                              COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_gtlString result_output ; // Returned variable
-  result_output = GALGAS_gtlString::constructor_new (GALGAS_location::constructor_nowhere (SOURCE_FILE ("gtl_interface.galgas", 93)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 93)), inArgument_input  COMMA_SOURCE_FILE ("gtl_interface.galgas", 93)) ;
+  result_output = GALGAS_gtlString::constructor_new (GALGAS_location::constructor_nowhere (SOURCE_FILE ("gtl_interface.galgas", 95)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 95)), inArgument_input  COMMA_SOURCE_FILE ("gtl_interface.galgas", 95)) ;
 //---
   return result_output ;
 }
@@ -6228,6 +6187,562 @@ C_galgas_function_descriptor functionDescriptor_stringToGtlString ("stringToGtlS
                                                                    1,
                                                                    functionArgs_stringToGtlString) ;
 
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Function 'jsonString'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_string function_jsonString (const GALGAS_string & constinArgument_input,
+                                   C_Compiler * inCompiler
+                                   COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_string result_output ; // Returned variable
+  result_output = GALGAS_string ("\"").add_operation (constinArgument_input.getter_stringByReplacingStringByString (GALGAS_string ("\\"), GALGAS_string ("\\\\"), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 105)).getter_stringByReplacingStringByString (GALGAS_string ("\""), GALGAS_string ("\\\""), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 105)), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 105)).add_operation (GALGAS_string ("\""), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 106)) ;
+//---
+  return result_output ;
+}
+
+
+//----------------------------------------------------------------------------------------------------------------------
+//  Function introspection                                                                       
+//----------------------------------------------------------------------------------------------------------------------
+
+static const C_galgas_type_descriptor * functionArgs_jsonString [2] = {
+  & kTypeDescriptor_GALGAS_string,
+  NULL
+} ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static GALGAS_object functionWithGenericHeader_jsonString (C_Compiler * inCompiler,
+                                                           const cObjectArray & inEffectiveParameterArray,
+                                                           const GALGAS_location & /* inErrorLocation */
+                                                           COMMA_LOCATION_ARGS) {
+  const GALGAS_string operand0 = GALGAS_string::extractObject (inEffectiveParameterArray.objectAtIndex (0 COMMA_HERE),
+                                                               inCompiler
+                                                               COMMA_THERE) ;
+  return function_jsonString (operand0,
+                              inCompiler
+                              COMMA_THERE).getter_object (THERE) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_galgas_function_descriptor functionDescriptor_jsonString ("jsonString",
+                                                            functionWithGenericHeader_jsonString,
+                                                            & kTypeDescriptor_GALGAS_string,
+                                                            1,
+                                                            functionArgs_jsonString) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Function 'selfDuration'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_uint function_selfDuration (const GALGAS_uint & constinArgument_total,
+                                   const GALGAS_uint & constinArgument_callees,
+                                   C_Compiler * inCompiler
+                                   COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_uint result_result ; // Returned variable
+  enumGalgasBool test_0 = kBoolTrue ;
+  if (kBoolTrue == test_0) {
+    test_0 = GALGAS_bool (kIsStrictInf, constinArgument_callees.objectCompare (constinArgument_total)).boolEnum () ;
+    if (kBoolTrue == test_0) {
+      result_result = constinArgument_total.substract_operation (constinArgument_callees, inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 120)) ;
+    }
+  }
+  if (kBoolFalse == test_0) {
+    result_result = GALGAS_uint ((uint32_t) 0U) ;
+  }
+//---
+  return result_result ;
+}
+
+
+//----------------------------------------------------------------------------------------------------------------------
+//  Function introspection                                                                       
+//----------------------------------------------------------------------------------------------------------------------
+
+static const C_galgas_type_descriptor * functionArgs_selfDuration [3] = {
+  & kTypeDescriptor_GALGAS_uint,
+  & kTypeDescriptor_GALGAS_uint,
+  NULL
+} ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static GALGAS_object functionWithGenericHeader_selfDuration (C_Compiler * inCompiler,
+                                                             const cObjectArray & inEffectiveParameterArray,
+                                                             const GALGAS_location & /* inErrorLocation */
+                                                             COMMA_LOCATION_ARGS) {
+  const GALGAS_uint operand0 = GALGAS_uint::extractObject (inEffectiveParameterArray.objectAtIndex (0 COMMA_HERE),
+                                                           inCompiler
+                                                           COMMA_THERE) ;
+  const GALGAS_uint operand1 = GALGAS_uint::extractObject (inEffectiveParameterArray.objectAtIndex (1 COMMA_HERE),
+                                                           inCompiler
+                                                           COMMA_THERE) ;
+  return function_selfDuration (operand0,
+                                operand1,
+                                inCompiler
+                                COMMA_THERE).getter_object (THERE) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_galgas_function_descriptor functionDescriptor_selfDuration ("selfDuration",
+                                                              functionWithGenericHeader_selfDuration,
+                                                              & kTypeDescriptor_GALGAS_uint,
+                                                              2,
+                                                              functionArgs_selfDuration) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Function 'profileCosts'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_string function_profileCosts (const GALGAS_string & constinArgument_prefix,
+                                     const GALGAS_uint & constinArgument_time,
+                                     const GALGAS_uint & constinArgument_cpu,
+                                     const GALGAS_uint & constinArgument_allocations,
+                                     const GALGAS_uint_36__34_ & constinArgument_allocatedBytes,
+                                     C_Compiler * inCompiler
+                                     COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_string result_output ; // Returned variable
+  result_output = GALGAS_string ("\"").add_operation (constinArgument_prefix, inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 138)).add_operation (GALGAS_string ("time_ms\": "), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 138)).add_operation (constinArgument_time.getter_string (SOURCE_FILE ("gtl_interface.galgas", 138)), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 138)).add_operation (GALGAS_string (", \""), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 139)).add_operation (constinArgument_prefix, inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 139)).add_operation (GALGAS_string ("cpu_us\": "), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 139)).add_operation (constinArgument_cpu.getter_string (SOURCE_FILE ("gtl_interface.galgas", 139)), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 139)).add_operation (GALGAS_string (", \""), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 140)).add_operation (constinArgument_prefix, inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 140)).add_operation (GALGAS_string ("allocations\": "), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 140)).add_operation (constinArgument_allocations.getter_string (SOURCE_FILE ("gtl_interface.galgas", 140)), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 140)).add_operation (GALGAS_string (", \""), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 141)).add_operation (constinArgument_prefix, inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 141)).add_operation (GALGAS_string ("allocated_bytes\": "), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 141)).add_operation (constinArgument_allocatedBytes.getter_string (SOURCE_FILE ("gtl_interface.galgas", 141)), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 141)) ;
+//---
+  return result_output ;
+}
+
+
+//----------------------------------------------------------------------------------------------------------------------
+//  Function introspection                                                                       
+//----------------------------------------------------------------------------------------------------------------------
+
+static const C_galgas_type_descriptor * functionArgs_profileCosts [6] = {
+  & kTypeDescriptor_GALGAS_string,
+  & kTypeDescriptor_GALGAS_uint,
+  & kTypeDescriptor_GALGAS_uint,
+  & kTypeDescriptor_GALGAS_uint,
+  & kTypeDescriptor_GALGAS_uint_36__34_,
+  NULL
+} ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static GALGAS_object functionWithGenericHeader_profileCosts (C_Compiler * inCompiler,
+                                                             const cObjectArray & inEffectiveParameterArray,
+                                                             const GALGAS_location & /* inErrorLocation */
+                                                             COMMA_LOCATION_ARGS) {
+  const GALGAS_string operand0 = GALGAS_string::extractObject (inEffectiveParameterArray.objectAtIndex (0 COMMA_HERE),
+                                                               inCompiler
+                                                               COMMA_THERE) ;
+  const GALGAS_uint operand1 = GALGAS_uint::extractObject (inEffectiveParameterArray.objectAtIndex (1 COMMA_HERE),
+                                                           inCompiler
+                                                           COMMA_THERE) ;
+  const GALGAS_uint operand2 = GALGAS_uint::extractObject (inEffectiveParameterArray.objectAtIndex (2 COMMA_HERE),
+                                                           inCompiler
+                                                           COMMA_THERE) ;
+  const GALGAS_uint operand3 = GALGAS_uint::extractObject (inEffectiveParameterArray.objectAtIndex (3 COMMA_HERE),
+                                                           inCompiler
+                                                           COMMA_THERE) ;
+  const GALGAS_uint_36__34_ operand4 = GALGAS_uint_36__34_::extractObject (inEffectiveParameterArray.objectAtIndex (4 COMMA_HERE),
+                                                                           inCompiler
+                                                                           COMMA_THERE) ;
+  return function_profileCosts (operand0,
+                                operand1,
+                                operand2,
+                                operand3,
+                                operand4,
+                                inCompiler
+                                COMMA_THERE).getter_object (THERE) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_galgas_function_descriptor functionDescriptor_profileCosts ("profileCosts",
+                                                              functionWithGenericHeader_profileCosts,
+                                                              & kTypeDescriptor_GALGAS_string,
+                                                              5,
+                                                              functionArgs_profileCosts) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Routine 'writeGTLProfile'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+void routine_writeGTLProfile (const GALGAS_gtlProfileMap constinArgument_phases,
+                              const GALGAS_library constinArgument_lib,
+                              const GALGAS_string constinArgument_filePath,
+                              C_Compiler * inCompiler
+                              COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_gtlProfileMap var_calleeProfile_5265 = GALGAS_gtlProfileMap::constructor_emptyMap (SOURCE_FILE ("gtl_interface.galgas", 157)) ;
+  cEnumerator_gtlProfileMap enumerator_5293 (constinArgument_lib.getter_stackProfile (SOURCE_FILE ("gtl_interface.galgas", 158)), kENUMERATION_UP) ;
+  while (enumerator_5293.hasCurrentObject ()) {
+    GALGAS_stringlist var_frames_5341 = enumerator_5293.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_interface.galgas", 159)).getter_componentsSeparatedByString (GALGAS_string (";") COMMA_SOURCE_FILE ("gtl_interface.galgas", 159)) ;
+    enumGalgasBool test_0 = kBoolTrue ;
+    if (kBoolTrue == test_0) {
+      test_0 = GALGAS_bool (kIsStrictSup, var_frames_5341.getter_length (SOURCE_FILE ("gtl_interface.galgas", 160)).objectCompare (GALGAS_uint ((uint32_t) 1U))).boolEnum () ;
+      if (kBoolTrue == test_0) {
+        extensionSetter_addCosts (var_calleeProfile_5265, GALGAS_string::constructor_componentsJoinedByString (var_frames_5341.getter_subListToIndex (var_frames_5341.getter_length (SOURCE_FILE ("gtl_interface.galgas", 163)).substract_operation (GALGAS_uint ((uint32_t) 2U), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 163)), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 163)), GALGAS_string (";")  COMMA_SOURCE_FILE ("gtl_interface.galgas", 162)), enumerator_5293.current_count (HERE), enumerator_5293.current_time (HERE), enumerator_5293.current_cpu (HERE), enumerator_5293.current_allocations (HERE), enumerator_5293.current_allocatedBytes (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 161)) ;
+      }
+    }
+    enumerator_5293.gotoNextObject () ;
+  }
+  GALGAS_string var_json_5708 = GALGAS_string ("{\n  \"phases\": {") ;
+  cEnumerator_gtlProfileMap enumerator_5738 (constinArgument_phases, kENUMERATION_UP) ;
+  while (enumerator_5738.hasCurrentObject ()) {
+    var_json_5708.plusAssign_operation(GALGAS_string ("\n    ").add_operation (function_jsonString (enumerator_5738.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_interface.galgas", 177)), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 177)), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 177)).add_operation (GALGAS_string (": { "), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 177)).add_operation (function_profileCosts (GALGAS_string::makeEmptyString (), enumerator_5738.current_time (HERE), enumerator_5738.current_cpu (HERE), enumerator_5738.current_allocations (HERE), enumerator_5738.current_allocatedBytes (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 178)), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 178)).add_operation (GALGAS_string (" }"), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 178)), inCompiler  COMMA_SOURCE_FILE ("gtl_interface.galgas", 177)) ;
+    if (enumerator_5738.hasNextObject ()) {
+      var_json_5708.plusAssign_operation(GALGAS_string (","), inCompiler  COMMA_SOURCE_FILE ("gtl_interface.galgas", 180)) ;
+    }
+    enumerator_5738.gotoNextObject () ;
+  }
+  var_json_5708.plusAssign_operation(GALGAS_string ("\n  },\n  \"stacks\": {"), inCompiler  COMMA_SOURCE_FILE ("gtl_interface.galgas", 182)) ;
+  GALGAS_string var_cpuFolded_5972 = GALGAS_string::makeEmptyString () ;
+  GALGAS_string var_allocationFolded_5997 = GALGAS_string::makeEmptyString () ;
+  cEnumerator_gtlProfileMap enumerator_6021 (constinArgument_lib.getter_stackProfile (SOURCE_FILE ("gtl_interface.galgas", 185)), kENUMERATION_UP) ;
+  while (enumerator_6021.hasCurrentObject ()) {
+    GALGAS_uint var_selfTime_6063 = enumerator_6021.current_time (HERE) ;
+    GALGAS_uint var_selfCpu_6089 = enumerator_6021.current_cpu (HERE) ;
+    GALGAS_uint var_selfAllocations_6113 = enumerator_6021.current_allocations (HERE) ;
+    GALGAS_uint_36__34_ var_selfAllocatedBytes_6155 = enumerator_6021.current_allocatedBytes (HERE) ;
+    enumGalgasBool test_1 = kBoolTrue ;
+    if (kBoolTrue == test_1) {
+      test_1 = var_calleeProfile_5265.getter_hasKey (enumerator_6021.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_interface.galgas", 190)) COMMA_SOURCE_FILE ("gtl_interface.galgas", 190)).boolEnum () ;
+      if (kBoolTrue == test_1) {
+        var_selfTime_6063 = function_selfDuration (enumerator_6021.current_time (HERE), var_calleeProfile_5265.getter_timeForKey (enumerator_6021.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_interface.galgas", 191)), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 191)), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 191)) ;
+        var_selfCpu_6089 = function_selfDuration (enumerator_6021.current_cpu (HERE), var_calleeProfile_5265.getter_cpuForKey (enumerator_6021.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_interface.galgas", 192)), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 192)), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 192)) ;
+        var_selfAllocations_6113.minusAssign_operation(var_calleeProfile_5265.getter_allocationsForKey (enumerator_6021.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_interface.galgas", 194)), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 194)), inCompiler  COMMA_SOURCE_FILE ("gtl_interface.galgas", 194)) ;
+        var_selfAllocatedBytes_6155.minusAssign_operation(var_calleeProfile_5265.getter_allocatedBytesForKey (enumerator_6021.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_interface.galgas", 195)), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 195)), inCompiler  COMMA_SOURCE_FILE ("gtl_interface.galgas", 195)) ;
+      }
+    }
+    var_json_5708.plusAssign_operation(GALGAS_string ("\n    ").add_operation (function_jsonString (enumerator_6021.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_interface.galgas", 197)), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 197)), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 197)).add_operation (GALGAS_string (": { \"count\": "), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 198)).add_operation (enumerator_6021.current_count (HERE).getter_string (SOURCE_FILE ("gtl_interface.galgas", 198)), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 198)).add_operation (GALGAS_string (", "), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 198)).add_operation (function_profileCosts (GALGAS_string::makeEmptyString (), enumerator_6021.current_time (HERE), enumerator_6021.current_cpu (HERE), enumerator_6021.current_allocations (HERE), enumerator_6021.current_allocatedBytes (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 199)), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 199)).add_operation (GALGAS_string (", "), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 199)).add_operation (function_profileCosts (GALGAS_string ("self_"), var_selfTime_6063, var_selfCpu_6089, var_selfAllocations_6113, var_selfAllocatedBytes_6155, inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 200)), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 200)).add_operation (GALGAS_string (" }"), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 201)), inCompiler  COMMA_SOURCE_FILE ("gtl_interface.galgas", 197)) ;
+    var_cpuFolded_5972.plusAssign_operation(enumerator_6021.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_interface.galgas", 202)).add_operation (GALGAS_string (" "), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 202)).add_operation (var_selfCpu_6089.getter_string (SOURCE_FILE ("gtl_interface.galgas", 202)), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 202)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 202)), inCompiler  COMMA_SOURCE_FILE ("gtl_interface.galgas", 202)) ;
+    var_allocationFolded_5997.plusAssign_operation(enumerator_6021.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_interface.galgas", 203)).add_operation (GALGAS_string (" "), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 203)).add_operation (var_selfAllocations_6113.getter_string (SOURCE_FILE ("gtl_interface.galgas", 203)), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 203)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 203)), inCompiler  COMMA_SOURCE_FILE ("gtl_interface.galgas", 203)) ;
+    if (enumerator_6021.hasNextObject ()) {
+      var_json_5708.plusAssign_operation(GALGAS_string (","), inCompiler  COMMA_SOURCE_FILE ("gtl_interface.galgas", 205)) ;
+    }
+    enumerator_6021.gotoNextObject () ;
+  }
+  var_json_5708.plusAssign_operation(GALGAS_string ("\n  },\n  \"lines\": {"), inCompiler  COMMA_SOURCE_FILE ("gtl_interface.galgas", 207)) ;
+  cEnumerator_gtlProfileMap enumerator_7131 (constinArgument_lib.getter_lineProfile (SOURCE_FILE ("gtl_interface.galgas", 208)), kENUMERATION_UP) ;
+  while (enumerator_7131.hasCurrentObject ()) {
+    var_json_5708.plusAssign_operation(GALGAS_string ("\n    ").add_operation (function_jsonString (enumerator_7131.current_lkey (HERE).getter_string (SOURCE_FILE ("gtl_interface.galgas", 209)), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 209)), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 209)).add_operation (GALGAS_string (": { \"count\": "), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 210)).add_operation (enumerator_7131.current_count (HERE).getter_string (SOURCE_FILE ("gtl_interface.galgas", 210)), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 210)).add_operation (GALGAS_string (", "), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 210)).add_operation (function_profileCosts (GALGAS_string::makeEmptyString (), enumerator_7131.current_time (HERE), enumerator_7131.current_cpu (HERE), enumerator_7131.current_allocations (HERE), enumerator_7131.current_allocatedBytes (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 211)), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 211)).add_operation (GALGAS_string (" }"), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 211)), inCompiler  COMMA_SOURCE_FILE ("gtl_interface.galgas", 209)) ;
+    if (enumerator_7131.hasNextObject ()) {
+      var_json_5708.plusAssign_operation(GALGAS_string (","), inCompiler  COMMA_SOURCE_FILE ("gtl_interface.galgas", 213)) ;
+    }
+    enumerator_7131.gotoNextObject () ;
+  }
+  var_json_5708.plusAssign_operation(GALGAS_string ("\n  }\n}\n"), inCompiler  COMMA_SOURCE_FILE ("gtl_interface.galgas", 215)) ;
+  var_json_5708.method_writeToFile (constinArgument_filePath.add_operation (GALGAS_string (".json"), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 217)), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 217)) ;
+  var_cpuFolded_5972.method_writeToFile (constinArgument_filePath.add_operation (GALGAS_string (".folded"), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 218)), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 218)) ;
+  var_allocationFolded_5997.method_writeToFile (constinArgument_filePath.add_operation (GALGAS_string (".alloc.folded"), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 219)), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 219)) ;
+}
+
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Function 'outputJobCount'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_uint function_outputJobCount (C_Compiler * /* inCompiler */
+                                     COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_uint result_count ; // Returned variable
+  enumGalgasBool test_0 = kBoolTrue ;
+  if (kBoolTrue == test_0) {
+    GALGAS_bool test_1 = GALGAS_bool (gOption_gtl_5F_options_profile.getter_value ()) ;
+    if (kBoolTrue != test_1.boolEnum ()) {
+      test_1 = GALGAS_bool (gOption_gtl_5F_options_debug.getter_value ()) ;
+    }
+    GALGAS_bool test_2 = test_1 ;
+    if (kBoolTrue != test_2.boolEnum ()) {
+      test_2 = GALGAS_bool (gOption_goil_5F_options_watch.getter_value ()) ;
+    }
+    test_0 = test_2.boolEnum () ;
+    if (kBoolTrue == test_0) {
+      result_count = GALGAS_uint ((uint32_t) 1U) ;
+    }
+  }
+  if (kBoolFalse == test_0) {
+    result_count = GALGAS_uint (gOption_gtl_5F_options_jobs.getter_value ()) ;
+  }
+//---
+  return result_count ;
+}
+
+
+//----------------------------------------------------------------------------------------------------------------------
+//  Function introspection                                                                       
+//----------------------------------------------------------------------------------------------------------------------
+
+static const C_galgas_type_descriptor * functionArgs_outputJobCount [1] = {
+  NULL
+} ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static GALGAS_object functionWithGenericHeader_outputJobCount (C_Compiler * inCompiler,
+                                                               const cObjectArray & /* inEffectiveParameterArray */,
+                                                               const GALGAS_location & /* inErrorLocation */
+                                                               COMMA_LOCATION_ARGS) {
+  return function_outputJobCount (inCompiler COMMA_THERE).getter_object (THERE) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_galgas_function_descriptor functionDescriptor_outputJobCount ("outputJobCount",
+                                                                functionWithGenericHeader_outputJobCount,
+                                                                & kTypeDescriptor_GALGAS_uint,
+                                                                0,
+                                                                functionArgs_outputJobCount) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Function 'outputDependencyState'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_string function_outputDependencyState (const GALGAS_string & constinArgument_dependency,
+                                              const GALGAS_gtlData & constinArgument_vars,
+                                              C_Compiler * inCompiler
+                                              COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_string result_state ; // Returned variable
+  GALGAS_stringlist var_fields_9134 = constinArgument_dependency.getter_componentsSeparatedByString (GALGAS_string ("\t") COMMA_SOURCE_FILE ("gtl_interface.galgas", 253)) ;
+  GALGAS_string var_name_9200 = var_fields_9134.getter_mValueAtIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 254)) ;
+  enumGalgasBool test_0 = kBoolTrue ;
+  if (kBoolTrue == test_0) {
+    test_0 = GALGAS_bool (kIsEqual, var_fields_9134.getter_mValueAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 255)).objectCompare (GALGAS_string ("file"))).boolEnum () ;
+    if (kBoolTrue == test_0) {
+      enumGalgasBool test_1 = kBoolTrue ;
+      if (kBoolTrue == test_1) {
+        test_1 = var_name_9200.getter_fileExists (SOURCE_FILE ("gtl_interface.galgas", 256)).boolEnum () ;
+        if (kBoolTrue == test_1) {
+          result_state = GALGAS_string::constructor_stringWithContentsOfFile (var_name_9200, inCompiler  COMMA_SOURCE_FILE ("gtl_interface.galgas", 257)).getter_md_35_ (SOURCE_FILE ("gtl_interface.galgas", 257)) ;
+        }
+      }
+      if (kBoolFalse == test_1) {
+        result_state = GALGAS_string ("-") ;
+      }
+    }
+  }
+  if (kBoolFalse == test_0) {
+    enumGalgasBool test_2 = kBoolTrue ;
+    if (kBoolTrue == test_2) {
+      test_2 = GALGAS_bool (kIsEqual, var_name_9200.objectCompare (GALGAS_string ("*"))).boolEnum () ;
+      if (kBoolTrue == test_2) {
+        result_state = callExtensionGetter_desc ((const cPtr_gtlData *) constinArgument_vars.ptr (), GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 262)).getter_md_35_ (SOURCE_FILE ("gtl_interface.galgas", 262)) ;
+      }
+    }
+    if (kBoolFalse == test_2) {
+      GALGAS_gtlData var_variable_9530 ;
+      GALGAS_bool var_found_9546 ;
+      callExtensionMethod_structField ((const cPtr_gtlData *) constinArgument_vars.ptr (), GALGAS_lstring::constructor_new (var_name_9200, GALGAS_location::constructor_nowhere (SOURCE_FILE ("gtl_interface.galgas", 264))  COMMA_SOURCE_FILE ("gtl_interface.galgas", 264)), var_variable_9530, var_found_9546, inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 264)) ;
+      enumGalgasBool test_3 = kBoolTrue ;
+      if (kBoolTrue == test_3) {
+        test_3 = var_found_9546.boolEnum () ;
+        if (kBoolTrue == test_3) {
+          result_state = callExtensionGetter_desc ((const cPtr_gtlData *) var_variable_9530.ptr (), GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 266)).getter_md_35_ (SOURCE_FILE ("gtl_interface.galgas", 266)) ;
+        }
+      }
+      if (kBoolFalse == test_3) {
+        result_state = GALGAS_string ("-") ;
+      }
+    }
+  }
+//---
+  return result_state ;
+}
+
+
+//----------------------------------------------------------------------------------------------------------------------
+//  Function introspection                                                                       
+//----------------------------------------------------------------------------------------------------------------------
+
+static const C_galgas_type_descriptor * functionArgs_outputDependencyState [3] = {
+  & kTypeDescriptor_GALGAS_string,
+  & kTypeDescriptor_GALGAS_gtlData,
+  NULL
+} ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static GALGAS_object functionWithGenericHeader_outputDependencyState (C_Compiler * inCompiler,
+                                                                      const cObjectArray & inEffectiveParameterArray,
+                                                                      const GALGAS_location & /* inErrorLocation */
+                                                                      COMMA_LOCATION_ARGS) {
+  const GALGAS_string operand0 = GALGAS_string::extractObject (inEffectiveParameterArray.objectAtIndex (0 COMMA_HERE),
+                                                               inCompiler
+                                                               COMMA_THERE) ;
+  const GALGAS_gtlData operand1 = GALGAS_gtlData::extractObject (inEffectiveParameterArray.objectAtIndex (1 COMMA_HERE),
+                                                                 inCompiler
+                                                                 COMMA_THERE) ;
+  return function_outputDependencyState (operand0,
+                                         operand1,
+                                         inCompiler
+                                         COMMA_THERE).getter_object (THERE) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_galgas_function_descriptor functionDescriptor_outputDependencyState ("outputDependencyState",
+                                                                       functionWithGenericHeader_outputDependencyState,
+                                                                       & kTypeDescriptor_GALGAS_string,
+                                                                       2,
+                                                                       functionArgs_outputDependencyState) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Function 'outputRecord'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_string function_outputRecord (const GALGAS_stringlist & constinArgument_dependencies,
+                                     const GALGAS_gtlData & constinArgument_vars,
+                                     C_Compiler * inCompiler
+                                     COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_string result_record ; // Returned variable
+  result_record = GALGAS_string::makeEmptyString () ;
+  GALGAS_bool var_isVolatile_10092 = GALGAS_bool (false) ;
+  cEnumerator_stringlist enumerator_10117 (constinArgument_dependencies, kENUMERATION_UP) ;
+  while (enumerator_10117.hasCurrentObject ()) {
+    enumGalgasBool test_0 = kBoolTrue ;
+    if (kBoolTrue == test_0) {
+      test_0 = GALGAS_bool (kIsEqual, enumerator_10117.current_mValue (HERE).objectCompare (GALGAS_string ("volatile"))).boolEnum () ;
+      if (kBoolTrue == test_0) {
+        var_isVolatile_10092 = GALGAS_bool (true) ;
+      }
+    }
+    if (kBoolFalse == test_0) {
+      result_record.plusAssign_operation(enumerator_10117.current_mValue (HERE).add_operation (GALGAS_string ("\t"), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 288)).add_operation (function_outputDependencyState (enumerator_10117.current_mValue (HERE), constinArgument_vars, inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 288)), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 288)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 288)), inCompiler  COMMA_SOURCE_FILE ("gtl_interface.galgas", 288)) ;
+    }
+    enumerator_10117.gotoNextObject () ;
+  }
+  enumGalgasBool test_1 = kBoolTrue ;
+  if (kBoolTrue == test_1) {
+    test_1 = var_isVolatile_10092.boolEnum () ;
+    if (kBoolTrue == test_1) {
+      result_record = GALGAS_string::makeEmptyString () ;
+    }
+  }
+//---
+  return result_record ;
+}
+
+
+//----------------------------------------------------------------------------------------------------------------------
+//  Function introspection                                                                       
+//----------------------------------------------------------------------------------------------------------------------
+
+static const C_galgas_type_descriptor * functionArgs_outputRecord [3] = {
+  & kTypeDescriptor_GALGAS_stringlist,
+  & kTypeDescriptor_GALGAS_gtlData,
+  NULL
+} ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static GALGAS_object functionWithGenericHeader_outputRecord (C_Compiler * inCompiler,
+                                                             const cObjectArray & inEffectiveParameterArray,
+                                                             const GALGAS_location & /* inErrorLocation */
+                                                             COMMA_LOCATION_ARGS) {
+  const GALGAS_stringlist operand0 = GALGAS_stringlist::extractObject (inEffectiveParameterArray.objectAtIndex (0 COMMA_HERE),
+                                                                       inCompiler
+                                                                       COMMA_THERE) ;
+  const GALGAS_gtlData operand1 = GALGAS_gtlData::extractObject (inEffectiveParameterArray.objectAtIndex (1 COMMA_HERE),
+                                                                 inCompiler
+                                                                 COMMA_THERE) ;
+  return function_outputRecord (operand0,
+                                operand1,
+                                inCompiler
+                                COMMA_THERE).getter_object (THERE) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_galgas_function_descriptor functionDescriptor_outputRecord ("outputRecord",
+                                                              functionWithGenericHeader_outputRecord,
+                                                              & kTypeDescriptor_GALGAS_string,
+                                                              2,
+                                                              functionArgs_outputRecord) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Function 'outputIsUpToDate'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_bool function_outputIsUpToDate (const GALGAS_string & constinArgument_fileName,
+                                       const GALGAS_gtlData & constinArgument_vars,
+                                       C_Compiler * inCompiler
+                                       COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_bool result_upToDate ; // Returned variable
+  GALGAS_string var_record_10724 = GALGAS_application::constructor_outputRecord (constinArgument_fileName  COMMA_SOURCE_FILE ("gtl_interface.galgas", 305)) ;
+  GALGAS_bool test_0 = GALGAS_bool (kIsNotEqual, var_record_10724.objectCompare (GALGAS_string::makeEmptyString ())) ;
+  if (kBoolTrue == test_0.boolEnum ()) {
+    test_0 = constinArgument_fileName.getter_fileExists (SOURCE_FILE ("gtl_interface.galgas", 306)) ;
+  }
+  result_upToDate = test_0 ;
+  cEnumerator_stringlist enumerator_10830 (var_record_10724.getter_componentsSeparatedByString (GALGAS_string ("\n") COMMA_SOURCE_FILE ("gtl_interface.galgas", 307)), kENUMERATION_UP) ;
+  while (enumerator_10830.hasCurrentObject ()) {
+    enumGalgasBool test_1 = kBoolTrue ;
+    if (kBoolTrue == test_1) {
+      GALGAS_bool test_2 = result_upToDate ;
+      if (kBoolTrue == test_2.boolEnum ()) {
+        test_2 = GALGAS_bool (kIsNotEqual, enumerator_10830.current_mValue (HERE).objectCompare (GALGAS_string::makeEmptyString ())) ;
+      }
+      test_1 = test_2.boolEnum () ;
+      if (kBoolTrue == test_1) {
+        GALGAS_stringlist var_fields_10939 = enumerator_10830.current_mValue (HERE).getter_componentsSeparatedByString (GALGAS_string ("\t") COMMA_SOURCE_FILE ("gtl_interface.galgas", 309)) ;
+        result_upToDate = GALGAS_bool (kIsEqual, var_fields_10939.getter_mValueAtIndex (GALGAS_uint ((uint32_t) 2U), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 310)).objectCompare (function_outputDependencyState (var_fields_10939.getter_mValueAtIndex (GALGAS_uint ((uint32_t) 0U), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 311)).add_operation (GALGAS_string ("\t"), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 311)).add_operation (var_fields_10939.getter_mValueAtIndex (GALGAS_uint ((uint32_t) 1U), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 311)), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 311)), constinArgument_vars, inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 310)))) ;
+      }
+    }
+    enumerator_10830.gotoNextObject () ;
+  }
+//---
+  return result_upToDate ;
+}
+
+
+//----------------------------------------------------------------------------------------------------------------------
+//  Function introspection                                                                       
+//----------------------------------------------------------------------------------------------------------------------
+
+static const C_galgas_type_descriptor * functionArgs_outputIsUpToDate [3] = {
+  & kTypeDescriptor_GALGAS_string,
+  & kTypeDescriptor_GALGAS_gtlData,
+  NULL
+} ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static GALGAS_object functionWithGenericHeader_outputIsUpToDate (C_Compiler * inCompiler,
+                                                                 const cObjectArray & inEffectiveParameterArray,
+                                                                 const GALGAS_location & /* inErrorLocation */
+                                                                 COMMA_LOCATION_ARGS) {
+  const GALGAS_string operand0 = GALGAS_string::extractObject (inEffectiveParameterArray.objectAtIndex (0 COMMA_HERE),
+                                                               inCompiler
+                                                               COMMA_THERE) ;
+  const GALGAS_gtlData operand1 = GALGAS_gtlData::extractObject (inEffectiveParameterArray.objectAtIndex (1 COMMA_HERE),
+                                                                 inCompiler
+                                                                 COMMA_THERE) ;
+  return function_outputIsUpToDate (operand0,
+                                    operand1,
+                                    inCompiler
+                                    COMMA_THERE).getter_object (THERE) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_galgas_function_descriptor functionDescriptor_outputIsUpToDate ("outputIsUpToDate",
+                                                                  functionWithGenericHeader_outputIsUpToDate,
+                                                                  & kTypeDescriptor_GALGAS_bool,
+                                                                  2,
+                                                                  functionArgs_outputIsUpToDate) ;
+
 //----------------------------------------------------------------------------------------------------------------------
 //
 //Function 'emptyContext'
@@ -6339,7 +6854,7 @@ C_galgas_function_descriptor functionDescriptor_pathWithExtension ("pathWithExte
 GALGAS_library function_emptyLib (C_Compiler * /* inCompiler */
                                   COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_library result_result ; // Returned variable
-  result_result = GALGAS_library::constructor_new (GALGAS_gtlFuncMap::constructor_emptyMap (SOURCE_FILE ("gtl_types.galgas", 323)), GALGAS_gtlGetterMap::constructor_emptyMap (SOURCE_FILE ("gtl_types.galgas", 323)), GALGAS_gtlSetterMap::constructor_emptyMap (SOURCE_FILE ("gtl_types.galgas", 323)), GALGAS_gtlTemplateMap::constructor_emptyMap (SOURCE_FILE ("gtl_types.galgas", 323)), GALGAS_stringset::constructor_emptySet (SOURCE_FILE ("gtl_types.galgas", 323))  COMMA_SOURCE_FILE ("gtl_types.galgas", 323)) ;
+  result_result = GALGAS_library::constructor_new (GALGAS_gtlFuncMap::constructor_emptyMap (SOURCE_FILE ("gtl_types.galgas", 330)), GALGAS_gtlGetterMap::constructor_emptyMap (SOURCE_FILE ("gtl_types.galgas", 330)), GALGAS_gtlSetterMap::constructor_emptyMap (SOURCE_FILE ("gtl_types.galgas", 330)), GALGAS_gtlTemplateMap::constructor_emptyMap (SOURCE_FILE ("gtl_types.galgas", 330)), GALGAS_stringset::constructor_emptySet (SOURCE_FILE ("gtl_types.galgas", 330)), GALGAS_gtlProfileMap::constructor_emptyMap (SOURCE_FILE ("gtl_types.galgas", 331)), GALGAS_gtlProfileMap::constructor_emptyMap (SOURCE_FILE ("gtl_types.galgas", 331)), GALGAS_string::makeEmptyString (), GALGAS_string::makeEmptyString ()  COMMA_SOURCE_FILE ("gtl_types.galgas", 329)) ;
 //---
   return result_result ;
 }
@@ -6590,6 +7105,147 @@ C_galgas_function_descriptor functionDescriptor_wantGtlList ("wantGtlList",
                                                              1,
                                                              functionArgs_wantGtlList) ;
 
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Function 'literalKind'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_uint function_literalKind (GALGAS_gtlExpression inArgument_expression,
+                                  C_Compiler * inCompiler
+                                  COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_uint result_kind ; // Returned variable
+  result_kind = GALGAS_uint ((uint32_t) 0U) ;
+  if (GALGAS_bool (inArgument_expression.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlTerminal).boolEnum () == kBoolTrue) {
+    GALGAS_gtlTerminal temp_0 ;
+    if (inArgument_expression.isValid ()) {
+      if (NULL != dynamic_cast <const cPtr_gtlTerminal *> (inArgument_expression.ptr ())) {
+        temp_0 = (cPtr_gtlTerminal *) inArgument_expression.ptr () ;
+      }else{
+        inCompiler->castError ("gtlTerminal", inArgument_expression.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1275)) ;
+      }
+    }
+    GALGAS_gtlData var_value = temp_0.getter_value (SOURCE_FILE ("gtl_expressions.galgas", 1275)) ;
+    if (GALGAS_bool (var_value.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlInt).boolEnum () == kBoolTrue) {
+      result_kind = GALGAS_uint ((uint32_t) 1U) ;
+    }else if (GALGAS_bool (var_value.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlBool).boolEnum () == kBoolTrue) {
+      result_kind = GALGAS_uint ((uint32_t) 2U) ;
+    }
+  }
+//---
+  return result_kind ;
+}
+
+
+//----------------------------------------------------------------------------------------------------------------------
+//  Function introspection                                                                       
+//----------------------------------------------------------------------------------------------------------------------
+
+static const C_galgas_type_descriptor * functionArgs_literalKind [2] = {
+  & kTypeDescriptor_GALGAS_gtlExpression,
+  NULL
+} ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static GALGAS_object functionWithGenericHeader_literalKind (C_Compiler * inCompiler,
+                                                            const cObjectArray & inEffectiveParameterArray,
+                                                            const GALGAS_location & /* inErrorLocation */
+                                                            COMMA_LOCATION_ARGS) {
+  const GALGAS_gtlExpression operand0 = GALGAS_gtlExpression::extractObject (inEffectiveParameterArray.objectAtIndex (0 COMMA_HERE),
+                                                                             inCompiler
+                                                                             COMMA_THERE) ;
+  return function_literalKind (operand0,
+                               inCompiler
+                               COMMA_THERE).getter_object (THERE) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_galgas_function_descriptor functionDescriptor_literalKind ("literalKind",
+                                                             functionWithGenericHeader_literalKind,
+                                                             & kTypeDescriptor_GALGAS_uint,
+                                                             1,
+                                                             functionArgs_literalKind) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Function 'foldConstants'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_gtlExpression function_foldConstants (GALGAS_gtlExpression inArgument_expression,
+                                             C_Compiler * inCompiler
+                                             COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_gtlExpression result_result ; // Returned variable
+  GALGAS_bool var_foldable = GALGAS_bool (false) ;
+  if (inArgument_expression.isValid ()) {
+    if (NULL != dynamic_cast <const cPtr_gtlUnaryExpression *> (inArgument_expression.ptr ())) {
+      GALGAS_gtlUnaryExpression cast_unaryExpression ((cPtr_gtlUnaryExpression *) inArgument_expression.ptr ()) ;
+      GALGAS_uint var_kind = function_literalKind (cast_unaryExpression.getter_son (SOURCE_FILE ("gtl_expressions.galgas", 1292)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1292)) ;
+      var_foldable = GALGAS_bool (kIsEqual, var_kind.objectCompare (GALGAS_uint ((uint32_t) 1U))).operator_or (GALGAS_bool (kIsEqual, var_kind.objectCompare (GALGAS_uint ((uint32_t) 2U))).operator_and (GALGAS_bool (inArgument_expression.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlNotExpression).operator_or (GALGAS_bool (inArgument_expression.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlParenthesizedExpression) COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1295)) COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1294)) COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1293)) ;
+    }else if (NULL != dynamic_cast <const cPtr_gtlBinaryExpression *> (inArgument_expression.ptr ())) {
+      GALGAS_gtlBinaryExpression cast_binaryExpression ((cPtr_gtlBinaryExpression *) inArgument_expression.ptr ()) ;
+      GALGAS_uint var_kind = function_literalKind (cast_binaryExpression.getter_lSon (SOURCE_FILE ("gtl_expressions.galgas", 1298)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1298)) ;
+      enumGalgasBool test_0 = GALGAS_bool (kIsNotEqual, var_kind.objectCompare (GALGAS_uint ((uint32_t) 0U))).operator_and (GALGAS_bool (kIsEqual, var_kind.objectCompare (function_literalKind (cast_binaryExpression.getter_rSon (SOURCE_FILE ("gtl_expressions.galgas", 1299)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1299)))) COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1299)).boolEnum () ;
+      if (kBoolTrue == test_0) {
+        const C_galgas_type_descriptor * descriptor = inArgument_expression.dynamicTypeDescriptor () ;
+        var_foldable = GALGAS_bool ((descriptor != & kTypeDescriptor_GALGAS_gtlDivideExpression) &&
+                                    (descriptor != & kTypeDescriptor_GALGAS_gtlModulusExpression) &&
+                                    (descriptor != & kTypeDescriptor_GALGAS_gtlShiftLeftExpression) &&
+                                    (descriptor != & kTypeDescriptor_GALGAS_gtlShiftRightExpression)) ;
+        enumGalgasBool test_1 = GALGAS_bool (kIsEqual, var_kind.objectCompare (GALGAS_uint ((uint32_t) 2U))).boolEnum () ;
+        if (kBoolTrue == test_1) {
+          var_foldable = var_foldable.operator_and (GALGAS_bool ((descriptor != & kTypeDescriptor_GALGAS_gtlAddExpression) &&
+                                                                 (descriptor != & kTypeDescriptor_GALGAS_gtlSubstractExpression) &&
+                                                                 (descriptor != & kTypeDescriptor_GALGAS_gtlMultiplyExpression)) COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1305)) ;
+        }
+      }
+    }
+  }
+  enumGalgasBool test_2 = var_foldable.boolEnum () ;
+  if (kBoolTrue == test_2) {
+    const GALGAS_location location = callExtensionGetter_location ((const cPtr_gtlExpression *) inArgument_expression.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1314)) ;
+    result_result = GALGAS_gtlTerminal::constructor_new (location, callExtensionGetter_eval ((const cPtr_gtlExpression *) inArgument_expression.ptr (), function_emptyContext (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1316)), GALGAS_gtlUnconstructed::constructor_new (location, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1317))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1317)), function_emptyLib (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1318)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1315))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1313)) ;
+  }else if (kBoolFalse == test_2) {
+    result_result = inArgument_expression ;
+  }
+//---
+  return result_result ;
+}
+
+
+//----------------------------------------------------------------------------------------------------------------------
+//  Function introspection                                                                       
+//----------------------------------------------------------------------------------------------------------------------
+
+static const C_galgas_type_descriptor * functionArgs_foldConstants [2] = {
+  & kTypeDescriptor_GALGAS_gtlExpression,
+  NULL
+} ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static GALGAS_object functionWithGenericHeader_foldConstants (C_Compiler * inCompiler,
+                                                              const cObjectArray & inEffectiveParameterArray,
+                                                              const GALGAS_location & /* inErrorLocation */
+                                                              COMMA_LOCATION_ARGS) {
+  const GALGAS_gtlExpression operand0 = GALGAS_gtlExpression::extractObject (inEffectiveParameterArray.objectAtIndex (0 COMMA_HERE),
+                                                                             inCompiler
+                                                                             COMMA_THERE) ;
+  return function_foldConstants (operand0,
+                                 inCompiler
+                                 COMMA_THERE).getter_object (THERE) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_galgas_function_descriptor functionDescriptor_foldConstants ("foldConstants",
+                                                               functionWithGenericHeader_foldConstants,
+                                                               & kTypeDescriptor_GALGAS_gtlExpression,
+                                                               1,
+                                                               functionArgs_foldConstants) ;
+
 //----------------------------------------------------------------------------------------------------------------------
 //
 //Overriding extension getter '@gtlVarItemField location'
@@ -7758,9 +8414,9 @@ static GALGAS_gtlData extensionGetter_gtlVarRef_eval (const cPtr_gtlExpression *
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlVarRef * object = (const cPtr_gtlVarRef *) inObject ;
   macroValidSharedObject (object, cPtr_gtlVarRef) ;
-  result_result = extensionGetter_get (object->mProperty_variableName, constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 931)) ;
+  result_result = extensionGetter_get (object->mProperty_variableName, constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 939)) ;
   {
-  result_result.setter_setWhere (object->mProperty_where COMMA_SOURCE_FILE ("gtl_expressions.galgas", 932)) ;
+  result_result.setter_setWhere (object->mProperty_where COMMA_SOURCE_FILE ("gtl_expressions.galgas", 940)) ;
   }
 //---
   return result_result ;
@@ -7791,6 +8447,7 @@ static GALGAS_gtlData extensionGetter_gtlAllVarsRef_eval (const cPtr_gtlExpressi
                                                           C_Compiler * /* inCompiler */
                                                           COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_gtlData result_result ; // Returned variable
+  GALGAS_application::class_method_addOutputVariableDependency (GALGAS_string ("*")  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 954)) ;
   result_result = constinArgument_vars ;
 //---
   return result_result ;
@@ -7823,9 +8480,9 @@ static GALGAS_gtlData extensionGetter_gtlParenthesizedExpression_eval (const cPt
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlParenthesizedExpression * object = (const cPtr_gtlParenthesizedExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlParenthesizedExpression) ;
-  result_result = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_son.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 962)) ;
+  result_result = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_son.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 971)) ;
   {
-  result_result.setter_setWhere (object->mProperty_where COMMA_SOURCE_FILE ("gtl_expressions.galgas", 963)) ;
+  result_result.setter_setWhere (object->mProperty_where COMMA_SOURCE_FILE ("gtl_expressions.galgas", 972)) ;
   }
 //---
   return result_result ;
@@ -7858,7 +8515,7 @@ static GALGAS_gtlData extensionGetter_gtlMinusExpression_eval (const cPtr_gtlExp
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlMinusExpression * object = (const cPtr_gtlMinusExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlMinusExpression) ;
-  result_result = callExtensionGetter_minusOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_son.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 977)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 977)) ;
+  result_result = callExtensionGetter_minusOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_son.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 986)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 986)) ;
 //---
   return result_result ;
 }
@@ -7890,7 +8547,7 @@ static GALGAS_gtlData extensionGetter_gtlPlusExpression_eval (const cPtr_gtlExpr
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlPlusExpression * object = (const cPtr_gtlPlusExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlPlusExpression) ;
-  result_result = callExtensionGetter_plusOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_son.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 991)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 991)) ;
+  result_result = callExtensionGetter_plusOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_son.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1000)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1000)) ;
 //---
   return result_result ;
 }
@@ -7922,7 +8579,7 @@ static GALGAS_gtlData extensionGetter_gtlNotExpression_eval (const cPtr_gtlExpre
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlNotExpression * object = (const cPtr_gtlNotExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlNotExpression) ;
-  result_result = callExtensionGetter_notOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_son.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1005)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1005)) ;
+  result_result = callExtensionGetter_notOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_son.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1014)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1014)) ;
 //---
   return result_result ;
 }
@@ -7954,7 +8611,7 @@ static GALGAS_gtlData extensionGetter_gtlAddExpression_eval (const cPtr_gtlExpre
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlAddExpression * object = (const cPtr_gtlAddExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlAddExpression) ;
-  result_result = callExtensionGetter_addOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_lSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1021)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1022)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1021)) ;
+  result_result = callExtensionGetter_addOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_lSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1030)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1031)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1030)) ;
 //---
   return result_result ;
 }
@@ -7986,7 +8643,7 @@ static GALGAS_gtlData extensionGetter_gtlSubstractExpression_eval (const cPtr_gt
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlSubstractExpression * object = (const cPtr_gtlSubstractExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlSubstractExpression) ;
-  result_result = callExtensionGetter_subOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_lSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1036)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1037)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1036)) ;
+  result_result = callExtensionGetter_subOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_lSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1045)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1046)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1045)) ;
 //---
   return result_result ;
 }
@@ -8018,7 +8675,7 @@ static GALGAS_gtlData extensionGetter_gtlMultiplyExpression_eval (const cPtr_gtl
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlMultiplyExpression * object = (const cPtr_gtlMultiplyExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlMultiplyExpression) ;
-  result_result = callExtensionGetter_mulOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_lSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1051)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1052)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1051)) ;
+  result_result = callExtensionGetter_mulOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_lSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1060)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1061)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1060)) ;
 //---
   return result_result ;
 }
@@ -8050,7 +8707,7 @@ static GALGAS_gtlData extensionGetter_gtlDivideExpression_eval (const cPtr_gtlEx
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlDivideExpression * object = (const cPtr_gtlDivideExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlDivideExpression) ;
-  result_result = callExtensionGetter_divOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_lSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1066)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1067)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1066)) ;
+  result_result = callExtensionGetter_divOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_lSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1075)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1076)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1075)) ;
 //---
   return result_result ;
 }
@@ -8082,7 +8739,7 @@ static GALGAS_gtlData extensionGetter_gtlModulusExpression_eval (const cPtr_gtlE
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlModulusExpression * object = (const cPtr_gtlModulusExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlModulusExpression) ;
-  result_result = callExtensionGetter_modOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_lSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1081)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1082)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1081)) ;
+  result_result = callExtensionGetter_modOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_lSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1090)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1091)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1090)) ;
 //---
   return result_result ;
 }
@@ -8114,7 +8771,7 @@ static GALGAS_gtlData extensionGetter_gtlAndExpression_eval (const cPtr_gtlExpre
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlAndExpression * object = (const cPtr_gtlAndExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlAndExpression) ;
-  result_result = callExtensionGetter_andOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_lSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1096)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1097)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1096)) ;
+  result_result = callExtensionGetter_andOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_lSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1105)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1106)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1105)) ;
 //---
   return result_result ;
 }
@@ -8146,7 +8803,7 @@ static GALGAS_gtlData extensionGetter_gtlOrExpression_eval (const cPtr_gtlExpres
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlOrExpression * object = (const cPtr_gtlOrExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlOrExpression) ;
-  result_result = callExtensionGetter_orOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_lSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1111)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1112)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1111)) ;
+  result_result = callExtensionGetter_orOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_lSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1120)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1121)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1120)) ;
 //---
   return result_result ;
 }
@@ -8178,7 +8835,7 @@ static GALGAS_gtlData extensionGetter_gtlXorExpression_eval (const cPtr_gtlExpre
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlXorExpression * object = (const cPtr_gtlXorExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlXorExpression) ;
-  result_result = callExtensionGetter_xorOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_lSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1126)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1127)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1126)) ;
+  result_result = callExtensionGetter_xorOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_lSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1135)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1136)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1135)) ;
 //---
   return result_result ;
 }
@@ -8210,7 +8867,7 @@ static GALGAS_gtlData extensionGetter_gtlShiftLeftExpression_eval (const cPtr_gt
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlShiftLeftExpression * object = (const cPtr_gtlShiftLeftExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlShiftLeftExpression) ;
-  result_result = callExtensionGetter_slOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_lSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1141)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1142)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1141)) ;
+  result_result = callExtensionGetter_slOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_lSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1150)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1151)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1150)) ;
 //---
   return result_result ;
 }
@@ -8242,7 +8899,7 @@ static GALGAS_gtlData extensionGetter_gtlShiftRightExpression_eval (const cPtr_g
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlShiftRightExpression * object = (const cPtr_gtlShiftRightExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlShiftRightExpression) ;
-  result_result = callExtensionGetter_srOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_lSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1156)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1157)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1156)) ;
+  result_result = callExtensionGetter_srOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_lSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1165)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1166)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1165)) ;
 //---
   return result_result ;
 }
@@ -8274,7 +8931,7 @@ static GALGAS_gtlData extensionGetter_gtlNotEqualExpression_eval (const cPtr_gtl
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlNotEqualExpression * object = (const cPtr_gtlNotEqualExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlNotEqualExpression) ;
-  result_result = callExtensionGetter_neqOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_lSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1171)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1172)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1171)) ;
+  result_result = callExtensionGetter_neqOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_lSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1180)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1181)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1180)) ;
 //---
   return result_result ;
 }
@@ -8306,7 +8963,7 @@ static GALGAS_gtlData extensionGetter_gtlEqualExpression_eval (const cPtr_gtlExp
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlEqualExpression * object = (const cPtr_gtlEqualExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlEqualExpression) ;
-  result_result = callExtensionGetter_eqOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_lSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1186)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1187)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1186)) ;
+  result_result = callExtensionGetter_eqOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_lSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1195)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1196)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1195)) ;
 //---
   return result_result ;
 }
@@ -8338,7 +8995,7 @@ static GALGAS_gtlData extensionGetter_gtlLowerThanExpression_eval (const cPtr_gt
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlLowerThanExpression * object = (const cPtr_gtlLowerThanExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlLowerThanExpression) ;
-  result_result = callExtensionGetter_ltOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_lSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1201)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1202)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1201)) ;
+  result_result = callExtensionGetter_ltOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_lSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1210)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1211)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1210)) ;
 //---
   return result_result ;
 }
@@ -8370,7 +9027,7 @@ static GALGAS_gtlData extensionGetter_gtlLowerOrEqualExpression_eval (const cPtr
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlLowerOrEqualExpression * object = (const cPtr_gtlLowerOrEqualExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlLowerOrEqualExpression) ;
-  result_result = callExtensionGetter_leOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_lSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1216)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1217)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1216)) ;
+  result_result = callExtensionGetter_leOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_lSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1225)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1226)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1225)) ;
 //---
   return result_result ;
 }
@@ -8402,7 +9059,7 @@ static GALGAS_gtlData extensionGetter_gtlGreaterThanExpression_eval (const cPtr_
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlGreaterThanExpression * object = (const cPtr_gtlGreaterThanExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlGreaterThanExpression) ;
-  result_result = callExtensionGetter_gtOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_lSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1231)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1232)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1231)) ;
+  result_result = callExtensionGetter_gtOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_lSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1240)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1241)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1240)) ;
 //---
   return result_result ;
 }
@@ -8434,7 +9091,7 @@ static GALGAS_gtlData extensionGetter_gtlGreaterOrEqualExpression_eval (const cP
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlGreaterOrEqualExpression * object = (const cPtr_gtlGreaterOrEqualExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlGreaterOrEqualExpression) ;
-  result_result = callExtensionGetter_geOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_lSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1246)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1247)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1246)) ;
+  result_result = callExtensionGetter_geOp ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_lSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1255)).ptr (), callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_rSon.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1256)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1255)) ;
 //---
   return result_result ;
 }
@@ -8466,14 +9123,14 @@ static GALGAS_gtlData extensionGetter_gtlGetterCallExpression_eval (const cPtr_g
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlGetterCallExpression * object = (const cPtr_gtlGetterCallExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlGetterCallExpression) ;
-  GALGAS_gtlDataList var_dataArguments_38461 = GALGAS_gtlDataList::constructor_emptyList (SOURCE_FILE ("gtl_expressions.galgas", 1265)) ;
+  GALGAS_gtlDataList var_dataArguments_38461 = GALGAS_gtlDataList::constructor_emptyList (SOURCE_FILE ("gtl_expressions.galgas", 1274)) ;
   cEnumerator_gtlExpressionList enumerator_38496 (object->mProperty_arguments, kENUMERATION_UP) ;
   while (enumerator_38496.hasCurrentObject ()) {
-    var_dataArguments_38461.addAssign_operation (callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_38496.current_expression (HERE).ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1267))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1267)) ;
+    var_dataArguments_38461.addAssign_operation (callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_38496.current_expression (HERE).ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1276))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1276)) ;
     enumerator_38496.gotoNextObject () ;
   }
-  GALGAS_gtlData var_targetData_38587 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_target.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1269)) ;
-  result_result = callExtensionGetter_performGetter ((const cPtr_gtlData *) var_targetData_38587.ptr (), object->mProperty_getterName, var_dataArguments_38461, constinArgument_context, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1270)) ;
+  GALGAS_gtlData var_targetData_38587 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_target.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1278)) ;
+  result_result = callExtensionGetter_performGetter ((const cPtr_gtlData *) var_targetData_38587.ptr (), object->mProperty_getterName, var_dataArguments_38461, constinArgument_context, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1279)) ;
 //---
   return result_result ;
 }
@@ -8504,10 +9161,10 @@ void routine_checkArgumentError (const GALGAS_lstring constinArgument_name,
                                  COMMA_UNUSED_LOCATION_ARGS) {
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = GALGAS_bool (kIsNotEqual, constinArgument_formalType.objectCompare (callExtensionGetter_embeddedType ((const cPtr_gtlData *) constinArgument_actualArgument.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1280)))).boolEnum () ;
+    test_0 = GALGAS_bool (kIsNotEqual, constinArgument_formalType.objectCompare (callExtensionGetter_embeddedType ((const cPtr_gtlData *) constinArgument_actualArgument.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1289)))).boolEnum () ;
     if (kBoolTrue == test_0) {
       TC_Array <C_FixItDescription> fixItArray1 ;
-      inCompiler->emitSemanticError (constinArgument_name.getter_location (SOURCE_FILE ("gtl_expressions.galgas", 1281)), extensionGetter_typeName (constinArgument_formalType, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1281)).add_operation (GALGAS_string (" expected for argument "), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1281)).add_operation (constinArgument_argumentNum.getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1281)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1281)).add_operation (GALGAS_string (", "), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1282)).add_operation (extensionGetter_typeName (constinArgument_actualArgument.getter_dynamicType (SOURCE_FILE ("gtl_expressions.galgas", 1282)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1282)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1282)).add_operation (GALGAS_string (" provided"), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1282)), fixItArray1  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1281)) ;
+      inCompiler->emitSemanticError (constinArgument_name.getter_location (SOURCE_FILE ("gtl_expressions.galgas", 1290)), extensionGetter_typeName (constinArgument_formalType, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1290)).add_operation (GALGAS_string (" expected for argument "), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1290)).add_operation (constinArgument_argumentNum.getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1290)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1290)).add_operation (GALGAS_string (", "), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1291)).add_operation (extensionGetter_typeName (constinArgument_actualArgument.getter_dynamicType (SOURCE_FILE ("gtl_expressions.galgas", 1291)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1291)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1291)).add_operation (GALGAS_string (" provided"), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1291)), fixItArray1  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1290)) ;
     }
   }
 }
@@ -8524,13 +9181,13 @@ GALGAS_gtlData function_validateReturnValue (const GALGAS_lstring & constinArgum
                                              C_Compiler * inCompiler
                                              COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_gtlData result_result ; // Returned variable
-  GALGAS_type var_returnedType_39188 = constinArgument_returnedValue.getter_objectDynamicType (SOURCE_FILE ("gtl_expressions.galgas", 1292)) ;
-  GALGAS_location var_loc_39240 = constinArgument_functionName.getter_location (SOURCE_FILE ("gtl_expressions.galgas", 1293)) ;
+  GALGAS_type var_returnedType_39188 = constinArgument_returnedValue.getter_objectDynamicType (SOURCE_FILE ("gtl_expressions.galgas", 1301)) ;
+  GALGAS_location var_loc_39240 = constinArgument_functionName.getter_location (SOURCE_FILE ("gtl_expressions.galgas", 1302)) ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
     test_0 = GALGAS_bool (kIsEqual, var_returnedType_39188.objectCompare (GALGAS_type (& kTypeDescriptor_GALGAS_bigint))).boolEnum () ;
     if (kBoolTrue == test_0) {
-      result_result = GALGAS_gtlInt::constructor_new (var_loc_39240, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1295)), GALGAS_bigint::extractObject (constinArgument_returnedValue, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1295))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1295)) ;
+      result_result = GALGAS_gtlInt::constructor_new (var_loc_39240, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1304)), GALGAS_bigint::extractObject (constinArgument_returnedValue, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1304))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1304)) ;
     }
   }
   if (kBoolFalse == test_0) {
@@ -8538,7 +9195,7 @@ GALGAS_gtlData function_validateReturnValue (const GALGAS_lstring & constinArgum
     if (kBoolTrue == test_2) {
       test_2 = GALGAS_bool (kIsEqual, var_returnedType_39188.objectCompare (GALGAS_type (& kTypeDescriptor_GALGAS_double))).boolEnum () ;
       if (kBoolTrue == test_2) {
-        result_result = GALGAS_gtlFloat::constructor_new (var_loc_39240, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1297)), GALGAS_double::extractObject (constinArgument_returnedValue, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1297))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1297)) ;
+        result_result = GALGAS_gtlFloat::constructor_new (var_loc_39240, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1306)), GALGAS_double::extractObject (constinArgument_returnedValue, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1306))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1306)) ;
       }
     }
     if (kBoolFalse == test_2) {
@@ -8546,7 +9203,7 @@ GALGAS_gtlData function_validateReturnValue (const GALGAS_lstring & constinArgum
       if (kBoolTrue == test_4) {
         test_4 = GALGAS_bool (kIsEqual, var_returnedType_39188.objectCompare (GALGAS_type (& kTypeDescriptor_GALGAS_string))).boolEnum () ;
         if (kBoolTrue == test_4) {
-          result_result = GALGAS_gtlString::constructor_new (var_loc_39240, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1299)), GALGAS_string::extractObject (constinArgument_returnedValue, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1299))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1299)) ;
+          result_result = GALGAS_gtlString::constructor_new (var_loc_39240, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1308)), GALGAS_string::extractObject (constinArgument_returnedValue, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1308))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1308)) ;
         }
       }
       if (kBoolFalse == test_4) {
@@ -8554,7 +9211,7 @@ GALGAS_gtlData function_validateReturnValue (const GALGAS_lstring & constinArgum
         if (kBoolTrue == test_6) {
           test_6 = GALGAS_bool (kIsEqual, var_returnedType_39188.objectCompare (GALGAS_type (& kTypeDescriptor_GALGAS_bool))).boolEnum () ;
           if (kBoolTrue == test_6) {
-            result_result = GALGAS_gtlBool::constructor_new (var_loc_39240, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1301)), GALGAS_bool::extractObject (constinArgument_returnedValue, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1301))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1301)) ;
+            result_result = GALGAS_gtlBool::constructor_new (var_loc_39240, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1310)), GALGAS_bool::extractObject (constinArgument_returnedValue, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1310))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1310)) ;
           }
         }
         if (kBoolFalse == test_6) {
@@ -8562,12 +9219,12 @@ GALGAS_gtlData function_validateReturnValue (const GALGAS_lstring & constinArgum
           if (kBoolTrue == test_8) {
             test_8 = GALGAS_bool (kIsEqual, var_returnedType_39188.objectCompare (GALGAS_type (& kTypeDescriptor_GALGAS_list))).boolEnum () ;
             if (kBoolTrue == test_8) {
-              result_result = GALGAS_gtlList::constructor_new (var_loc_39240, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1303)), GALGAS_list::extractObject (constinArgument_returnedValue, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1303))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1303)) ;
+              result_result = GALGAS_gtlList::constructor_new (var_loc_39240, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1312)), GALGAS_list::extractObject (constinArgument_returnedValue, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1312))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1312)) ;
             }
           }
           if (kBoolFalse == test_8) {
             TC_Array <C_FixItDescription> fixItArray10 ;
-            inCompiler->emitSemanticError (constinArgument_functionName.getter_location (SOURCE_FILE ("gtl_expressions.galgas", 1305)), GALGAS_string ("this function does not return a compatible type"), fixItArray10  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1305)) ;
+            inCompiler->emitSemanticError (constinArgument_functionName.getter_location (SOURCE_FILE ("gtl_expressions.galgas", 1314)), GALGAS_string ("this function does not return a compatible type"), fixItArray10  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1314)) ;
             result_result.drop () ; // Release error dropped variable
           }
         }
@@ -8630,42 +9287,42 @@ static GALGAS_gtlData extensionGetter_gtlFunctionCallExpression_eval (const cPtr
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlFunctionCallExpression * object = (const cPtr_gtlFunctionCallExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlFunctionCallExpression) ;
-  GALGAS_uint var_currentErrorCount_40468 = GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_expressions.galgas", 1324)) ;
+  GALGAS_uint var_currentErrorCount_40468 = GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_expressions.galgas", 1333)) ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = GALGAS_function::constructor_isFunctionDefined (object->mProperty_functionName.getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1326))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1326)).boolEnum () ;
+    test_0 = GALGAS_function::constructor_isFunctionDefined (object->mProperty_functionName.getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1335))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1335)).boolEnum () ;
     if (kBoolTrue == test_0) {
-      GALGAS_objectlist var_arguments_40605 = GALGAS_objectlist::constructor_emptyList (SOURCE_FILE ("gtl_expressions.galgas", 1328)) ;
-      GALGAS_gtlDataList var_dataArguments_40649 = GALGAS_gtlDataList::constructor_emptyList (SOURCE_FILE ("gtl_expressions.galgas", 1329)) ;
+      GALGAS_objectlist var_arguments_40605 = GALGAS_objectlist::constructor_emptyList (SOURCE_FILE ("gtl_expressions.galgas", 1337)) ;
+      GALGAS_gtlDataList var_dataArguments_40649 = GALGAS_gtlDataList::constructor_emptyList (SOURCE_FILE ("gtl_expressions.galgas", 1338)) ;
       cEnumerator_gtlExpressionList enumerator_40695 (object->mProperty_functionArguments, kENUMERATION_UP) ;
       while (enumerator_40695.hasCurrentObject ()) {
-        GALGAS_gtlData var_arg_40717 = callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_40695.current_expression (HERE).ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1332)) ;
-        var_dataArguments_40649.addAssign_operation (var_arg_40717  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1333)) ;
-        callExtensionMethod_addMyValue ((const cPtr_gtlData *) var_arg_40717.ptr (), var_arguments_40605, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1334)) ;
+        GALGAS_gtlData var_arg_40717 = callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_40695.current_expression (HERE).ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1341)) ;
+        var_dataArguments_40649.addAssign_operation (var_arg_40717  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1342)) ;
+        callExtensionMethod_addMyValue ((const cPtr_gtlData *) var_arg_40717.ptr (), var_arguments_40605, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1343)) ;
         enumerator_40695.gotoNextObject () ;
       }
-      GALGAS_function var_function_40856 = GALGAS_function::constructor_functionWithName (object->mProperty_functionName.getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1337))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1337)) ;
-      GALGAS_typelist var_formalParameterList_40942 = var_function_40856.getter_formalParameterTypeList (SOURCE_FILE ("gtl_expressions.galgas", 1339)) ;
+      GALGAS_function var_function_40856 = GALGAS_function::constructor_functionWithName (object->mProperty_functionName.getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1346))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1346)) ;
+      GALGAS_typelist var_formalParameterList_40942 = var_function_40856.getter_formalParameterTypeList (SOURCE_FILE ("gtl_expressions.galgas", 1348)) ;
       enumGalgasBool test_1 = kBoolTrue ;
       if (kBoolTrue == test_1) {
-        test_1 = GALGAS_bool (kIsNotEqual, var_formalParameterList_40942.getter_length (SOURCE_FILE ("gtl_expressions.galgas", 1340)).objectCompare (var_arguments_40605.getter_length (SOURCE_FILE ("gtl_expressions.galgas", 1340)))).boolEnum () ;
+        test_1 = GALGAS_bool (kIsNotEqual, var_formalParameterList_40942.getter_length (SOURCE_FILE ("gtl_expressions.galgas", 1349)).objectCompare (var_arguments_40605.getter_length (SOURCE_FILE ("gtl_expressions.galgas", 1349)))).boolEnum () ;
         if (kBoolTrue == test_1) {
           GALGAS_string temp_2 ;
-          const enumGalgasBool test_3 = GALGAS_bool (kIsStrictSup, var_arguments_40605.getter_length (SOURCE_FILE ("gtl_expressions.galgas", 1343)).objectCompare (GALGAS_uint ((uint32_t) 1U))).boolEnum () ;
+          const enumGalgasBool test_3 = GALGAS_bool (kIsStrictSup, var_arguments_40605.getter_length (SOURCE_FILE ("gtl_expressions.galgas", 1352)).objectCompare (GALGAS_uint ((uint32_t) 1U))).boolEnum () ;
           if (kBoolTrue == test_3) {
             temp_2 = GALGAS_string ("s") ;
           }else if (kBoolFalse == test_3) {
             temp_2 = GALGAS_string::makeEmptyString () ;
           }
           GALGAS_string temp_4 ;
-          const enumGalgasBool test_5 = GALGAS_bool (kIsStrictSup, var_formalParameterList_40942.getter_length (SOURCE_FILE ("gtl_expressions.galgas", 1345)).objectCompare (GALGAS_uint ((uint32_t) 1U))).boolEnum () ;
+          const enumGalgasBool test_5 = GALGAS_bool (kIsStrictSup, var_formalParameterList_40942.getter_length (SOURCE_FILE ("gtl_expressions.galgas", 1354)).objectCompare (GALGAS_uint ((uint32_t) 1U))).boolEnum () ;
           if (kBoolTrue == test_5) {
             temp_4 = GALGAS_string ("s") ;
           }else if (kBoolFalse == test_5) {
             temp_4 = GALGAS_string::makeEmptyString () ;
           }
           TC_Array <C_FixItDescription> fixItArray6 ;
-          inCompiler->emitSemanticError (object->mProperty_functionName.getter_location (SOURCE_FILE ("gtl_expressions.galgas", 1341)), GALGAS_string ("this function is invoked with ").add_operation (var_arguments_40605.getter_length (SOURCE_FILE ("gtl_expressions.galgas", 1342)).getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1341)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1341)).add_operation (GALGAS_string (" argument"), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1342)).add_operation (temp_2, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1342)).add_operation (GALGAS_string (", but requires "), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1343)).add_operation (var_formalParameterList_40942.getter_length (SOURCE_FILE ("gtl_expressions.galgas", 1344)).getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1344)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1344)).add_operation (GALGAS_string (" argument"), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1344)).add_operation (temp_4, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1344)), fixItArray6  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1341)) ;
+          inCompiler->emitSemanticError (object->mProperty_functionName.getter_location (SOURCE_FILE ("gtl_expressions.galgas", 1350)), GALGAS_string ("this function is invoked with ").add_operation (var_arguments_40605.getter_length (SOURCE_FILE ("gtl_expressions.galgas", 1351)).getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1350)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1350)).add_operation (GALGAS_string (" argument"), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1351)).add_operation (temp_2, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1351)).add_operation (GALGAS_string (", but requires "), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1352)).add_operation (var_formalParameterList_40942.getter_length (SOURCE_FILE ("gtl_expressions.galgas", 1353)).getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1353)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1353)).add_operation (GALGAS_string (" argument"), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1353)).add_operation (temp_4, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1353)), fixItArray6  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1350)) ;
           result_result.drop () ; // Release error dropped variable
         }
       }
@@ -8675,35 +9332,35 @@ static GALGAS_gtlData extensionGetter_gtlFunctionCallExpression_eval (const cPtr
         GALGAS_uint index_41377 ((uint32_t) 0) ;
         while (enumerator_41409.hasCurrentObject () && enumerator_41436.hasCurrentObject ()) {
           {
-          routine_checkArgumentError (object->mProperty_functionName, enumerator_41409.current_mValue (HERE), enumerator_41436.current_data (HERE), index_41377, inCompiler  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1349)) ;
+          routine_checkArgumentError (object->mProperty_functionName, enumerator_41409.current_mValue (HERE), enumerator_41436.current_data (HERE), index_41377, inCompiler  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1358)) ;
           }
           enumerator_41409.gotoNextObject () ;
           enumerator_41436.gotoNextObject () ;
-          index_41377.increment_operation (inCompiler  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1348)) ;
+          index_41377.increment_operation (inCompiler  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1357)) ;
         }
         enumGalgasBool test_7 = kBoolTrue ;
         if (kBoolTrue == test_7) {
-          test_7 = GALGAS_bool (kIsEqual, var_currentErrorCount_40468.objectCompare (GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_expressions.galgas", 1351)))).boolEnum () ;
+          test_7 = GALGAS_bool (kIsEqual, var_currentErrorCount_40468.objectCompare (GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_expressions.galgas", 1360)))).boolEnum () ;
           if (kBoolTrue == test_7) {
-            GALGAS_object var_returnedValue_41608 = var_function_40856.getter_invoke (var_arguments_40605, object->mProperty_functionName.getter_location (SOURCE_FILE ("gtl_expressions.galgas", 1353)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1353)) ;
-            result_result = function_validateReturnValue (object->mProperty_functionName, var_returnedValue_41608, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1354)) ;
+            GALGAS_object var_returnedValue_41608 = var_function_40856.getter_invoke (var_arguments_40605, object->mProperty_functionName.getter_location (SOURCE_FILE ("gtl_expressions.galgas", 1362)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1362)) ;
+            result_result = function_validateReturnValue (object->mProperty_functionName, var_returnedValue_41608, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1363)) ;
           }
         }
         if (kBoolFalse == test_7) {
-          result_result = GALGAS_gtlUnconstructed::constructor_new (object->mProperty_functionName.getter_location (SOURCE_FILE ("gtl_expressions.galgas", 1357)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1358))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1356)) ;
+          result_result = GALGAS_gtlUnconstructed::constructor_new (object->mProperty_functionName.getter_location (SOURCE_FILE ("gtl_expressions.galgas", 1366)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1367))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1365)) ;
         }
       }
     }
   }
   if (kBoolFalse == test_0) {
-    GALGAS_gtlFunction var_function_41916 = callExtensionGetter_getFunction ((const cPtr_library *) constinArgument_lib.ptr (), object->mProperty_functionName, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1363)) ;
-    GALGAS_gtlDataList var_arguments_41977 = GALGAS_gtlDataList::constructor_emptyList (SOURCE_FILE ("gtl_expressions.galgas", 1364)) ;
+    GALGAS_gtlFunction var_function_41916 = callExtensionGetter_getFunction ((const cPtr_library *) constinArgument_lib.ptr (), object->mProperty_functionName, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1372)) ;
+    GALGAS_gtlDataList var_arguments_41977 = GALGAS_gtlDataList::constructor_emptyList (SOURCE_FILE ("gtl_expressions.galgas", 1373)) ;
     cEnumerator_gtlExpressionList enumerator_42022 (object->mProperty_functionArguments, kENUMERATION_UP) ;
     while (enumerator_42022.hasCurrentObject ()) {
-      var_arguments_41977.addAssign_operation (callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_42022.current_expression (HERE).ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1366))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1366)) ;
+      var_arguments_41977.addAssign_operation (callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_42022.current_expression (HERE).ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1375))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1375)) ;
       enumerator_42022.gotoNextObject () ;
     }
-    result_result = callExtensionGetter_call ((const cPtr_gtlFunction *) var_function_41916.ptr (), object->mProperty_functionName.getter_location (SOURCE_FILE ("gtl_expressions.galgas", 1368)), constinArgument_context, constinArgument_lib, var_arguments_41977, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1368)) ;
+    result_result = callExtensionGetter_call ((const cPtr_gtlFunction *) var_function_41916.ptr (), object->mProperty_functionName.getter_location (SOURCE_FILE ("gtl_expressions.galgas", 1377)), constinArgument_context, constinArgument_lib, var_arguments_41977, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1377)) ;
   }
 //---
   return result_result ;
@@ -8736,7 +9393,7 @@ static GALGAS_gtlData extensionGetter_gtlExistsExpression_eval (const cPtr_gtlEx
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlExistsExpression * object = (const cPtr_gtlExistsExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlExistsExpression) ;
-  result_result = GALGAS_gtlBool::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1386)), extensionGetter_exists (object->mProperty_variable, constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1386))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1385)) ;
+  result_result = GALGAS_gtlBool::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1395)), extensionGetter_exists (object->mProperty_variable, constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1395))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1394)) ;
 //---
   return result_result ;
 }
@@ -8770,13 +9427,13 @@ static GALGAS_gtlData extensionGetter_gtlExistsDefaultExpression_eval (const cPt
   macroValidSharedObject (object, cPtr_gtlExistsDefaultExpression) ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = extensionGetter_exists (object->mProperty_variable, constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1404)).boolEnum () ;
+    test_0 = extensionGetter_exists (object->mProperty_variable, constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1413)).boolEnum () ;
     if (kBoolTrue == test_0) {
-      result_result = extensionGetter_get (object->mProperty_variable, constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1405)) ;
+      result_result = extensionGetter_get (object->mProperty_variable, constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1414)) ;
     }
   }
   if (kBoolFalse == test_0) {
-    result_result = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_defaultValue.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1407)) ;
+    result_result = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_defaultValue.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1416)) ;
   }
 //---
   return result_result ;
@@ -8809,8 +9466,8 @@ static GALGAS_gtlData extensionGetter_gtlTypeOfExpression_eval (const cPtr_gtlEx
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlTypeOfExpression * object = (const cPtr_gtlTypeOfExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlTypeOfExpression) ;
-  GALGAS_gtlData var_variableValue_43873 = extensionGetter_get (object->mProperty_variable, constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1424)) ;
-  result_result = GALGAS_gtlType::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1425)), var_variableValue_43873.getter_dynamicType (SOURCE_FILE ("gtl_expressions.galgas", 1425))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1425)) ;
+  GALGAS_gtlData var_variableValue_43873 = extensionGetter_get (object->mProperty_variable, constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1433)) ;
+  result_result = GALGAS_gtlType::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1434)), var_variableValue_43873.getter_dynamicType (SOURCE_FILE ("gtl_expressions.galgas", 1434))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1434)) ;
 //---
   return result_result ;
 }
@@ -8842,14 +9499,14 @@ static GALGAS_gtlData extensionGetter_gtlMapOfStructExpression_eval (const cPtr_
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlMapOfStructExpression * object = (const cPtr_gtlMapOfStructExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlMapOfStructExpression) ;
-  GALGAS_gtlData var_expressionValue_44465 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_expression.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1441)) ;
+  GALGAS_gtlData var_expressionValue_44465 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_expression.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1450)) ;
   if (var_expressionValue_44465.isValid ()) {
     if (var_expressionValue_44465.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlStruct) {
       GALGAS_gtlStruct cast_44571_expressionValueStruct ((cPtr_gtlStruct *) var_expressionValue_44465.ptr ()) ;
-      result_result = GALGAS_gtlMap::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1446)), cast_44571_expressionValueStruct.getter_value (SOURCE_FILE ("gtl_expressions.galgas", 1447))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1444)) ;
+      result_result = GALGAS_gtlMap::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1455)), cast_44571_expressionValueStruct.getter_value (SOURCE_FILE ("gtl_expressions.galgas", 1456))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1453)) ;
     }else{
       TC_Array <C_FixItDescription> fixItArray0 ;
-      inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("struct expected"), fixItArray0  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1450)) ;
+      inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("struct expected"), fixItArray0  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1459)) ;
       result_result.drop () ; // Release error dropped variable
     }
   }
@@ -8884,12 +9541,12 @@ static GALGAS_gtlData extensionGetter_gtlMapOfListExpression_eval (const cPtr_gt
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlMapOfListExpression * object = (const cPtr_gtlMapOfListExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlMapOfListExpression) ;
-  GALGAS_gtlData var_expressionValue_45211 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_expression.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1467)) ;
+  GALGAS_gtlData var_expressionValue_45211 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_expression.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1476)) ;
   if (var_expressionValue_45211.isValid ()) {
     if (var_expressionValue_45211.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlList) {
       GALGAS_gtlList cast_45313_expressionValueList ((cPtr_gtlList *) var_expressionValue_45211.ptr ()) ;
-      GALGAS_gtlVarMap var_resultMap_45339 = GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("gtl_expressions.galgas", 1470)) ;
-      cEnumerator_list enumerator_45397 (cast_45313_expressionValueList.getter_value (SOURCE_FILE ("gtl_expressions.galgas", 1471)), kENUMERATION_UP) ;
+      GALGAS_gtlVarMap var_resultMap_45339 = GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("gtl_expressions.galgas", 1479)) ;
+      cEnumerator_list enumerator_45397 (cast_45313_expressionValueList.getter_value (SOURCE_FILE ("gtl_expressions.galgas", 1480)), kENUMERATION_UP) ;
       GALGAS_uint index_45359 ((uint32_t) 0) ;
       while (enumerator_45397.hasCurrentObject ()) {
         if (enumerator_45397.current_value (HERE).isValid ()) {
@@ -8897,31 +9554,31 @@ static GALGAS_gtlData extensionGetter_gtlMapOfListExpression_eval (const cPtr_gt
             GALGAS_gtlStruct cast_45460_itemStruct ((cPtr_gtlStruct *) enumerator_45397.current_value (HERE).ptr ()) ;
             enumGalgasBool test_0 = kBoolTrue ;
             if (kBoolTrue == test_0) {
-              test_0 = cast_45460_itemStruct.getter_value (SOURCE_FILE ("gtl_expressions.galgas", 1474)).getter_hasKey (object->mProperty_key.getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1474)) COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1474)).boolEnum () ;
+              test_0 = cast_45460_itemStruct.getter_value (SOURCE_FILE ("gtl_expressions.galgas", 1483)).getter_hasKey (object->mProperty_key.getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1483)) COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1483)).boolEnum () ;
               if (kBoolTrue == test_0) {
                 GALGAS_gtlData var_keyValue_45577 ;
-                cast_45460_itemStruct.getter_value (SOURCE_FILE ("gtl_expressions.galgas", 1475)).method_get (object->mProperty_key, var_keyValue_45577, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1475)) ;
+                cast_45460_itemStruct.getter_value (SOURCE_FILE ("gtl_expressions.galgas", 1484)).method_get (object->mProperty_key, var_keyValue_45577, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1484)) ;
                 {
-                var_resultMap_45339.setter_put (callExtensionGetter_lstring ((const cPtr_gtlData *) var_keyValue_45577.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1477)), enumerator_45397.current_value (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1476)) ;
+                var_resultMap_45339.setter_put (callExtensionGetter_lstring ((const cPtr_gtlData *) var_keyValue_45577.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1486)), enumerator_45397.current_value (HERE), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1485)) ;
                 }
               }
             }
             if (kBoolFalse == test_0) {
               TC_Array <C_FixItDescription> fixItArray1 ;
-              inCompiler->emitSemanticError (var_expressionValue_45211.getter_where (SOURCE_FILE ("gtl_expressions.galgas", 1481)), GALGAS_string ("item at index ").add_operation (index_45359.getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1481)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1481)).add_operation (GALGAS_string (" does not have field named "), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1481)).add_operation (object->mProperty_key.getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1482)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1482)), fixItArray1  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1481)) ;
+              inCompiler->emitSemanticError (var_expressionValue_45211.getter_where (SOURCE_FILE ("gtl_expressions.galgas", 1490)), GALGAS_string ("item at index ").add_operation (index_45359.getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1490)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1490)).add_operation (GALGAS_string (" does not have field named "), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1490)).add_operation (object->mProperty_key.getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1491)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1491)), fixItArray1  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1490)) ;
             }
           }else{
             TC_Array <C_FixItDescription> fixItArray2 ;
-            inCompiler->emitSemanticError (var_expressionValue_45211.getter_where (SOURCE_FILE ("gtl_expressions.galgas", 1485)), GALGAS_string ("list of struct expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1485)) ;
+            inCompiler->emitSemanticError (var_expressionValue_45211.getter_where (SOURCE_FILE ("gtl_expressions.galgas", 1494)), GALGAS_string ("list of struct expected"), fixItArray2  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1494)) ;
           }
         }
         enumerator_45397.gotoNextObject () ;
-        index_45359.increment_operation (inCompiler  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1471)) ;
+        index_45359.increment_operation (inCompiler  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1480)) ;
       }
-      result_result = GALGAS_gtlMap::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1488)), var_resultMap_45339  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1488)) ;
+      result_result = GALGAS_gtlMap::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1497)), var_resultMap_45339  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1497)) ;
     }else{
       TC_Array <C_FixItDescription> fixItArray3 ;
-      inCompiler->emitSemanticError (var_expressionValue_45211.getter_where (SOURCE_FILE ("gtl_expressions.galgas", 1490)), GALGAS_string ("list expected"), fixItArray3  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1490)) ;
+      inCompiler->emitSemanticError (var_expressionValue_45211.getter_where (SOURCE_FILE ("gtl_expressions.galgas", 1499)), GALGAS_string ("list expected"), fixItArray3  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1499)) ;
       result_result.drop () ; // Release error dropped variable
     }
   }
@@ -8956,20 +9613,20 @@ static GALGAS_gtlData extensionGetter_gtlListOfExpression_eval (const cPtr_gtlEx
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlListOfExpression * object = (const cPtr_gtlListOfExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlListOfExpression) ;
-  GALGAS_gtlData var_expressionValue_46496 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_expression.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1507)) ;
+  GALGAS_gtlData var_expressionValue_46496 = callExtensionGetter_eval ((const cPtr_gtlExpression *) object->mProperty_expression.ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1516)) ;
   if (var_expressionValue_46496.isValid ()) {
     if (var_expressionValue_46496.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_gtlMap) {
       GALGAS_gtlMap cast_46596_expressionValueMap ((cPtr_gtlMap *) var_expressionValue_46496.ptr ()) ;
-      GALGAS_list var_resultList_46618 = GALGAS_list::constructor_emptyList (SOURCE_FILE ("gtl_expressions.galgas", 1510)) ;
-      cEnumerator_gtlVarMap enumerator_46680 (cast_46596_expressionValueMap.getter_value (SOURCE_FILE ("gtl_expressions.galgas", 1511)), kENUMERATION_UP) ;
+      GALGAS_list var_resultList_46618 = GALGAS_list::constructor_emptyList (SOURCE_FILE ("gtl_expressions.galgas", 1519)) ;
+      cEnumerator_gtlVarMap enumerator_46680 (cast_46596_expressionValueMap.getter_value (SOURCE_FILE ("gtl_expressions.galgas", 1520)), kENUMERATION_UP) ;
       while (enumerator_46680.hasCurrentObject ()) {
-        var_resultList_46618.addAssign_operation (enumerator_46680.current_value (HERE)  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1512)) ;
+        var_resultList_46618.addAssign_operation (enumerator_46680.current_value (HERE)  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1521)) ;
         enumerator_46680.gotoNextObject () ;
       }
-      result_result = GALGAS_gtlList::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1514)), var_resultList_46618  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1514)) ;
+      result_result = GALGAS_gtlList::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1523)), var_resultList_46618  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1523)) ;
     }else{
       TC_Array <C_FixItDescription> fixItArray0 ;
-      inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map expected"), fixItArray0  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1516)) ;
+      inCompiler->emitSemanticError (object->mProperty_where, GALGAS_string ("map expected"), fixItArray0  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1525)) ;
       result_result.drop () ; // Release error dropped variable
     }
   }
@@ -9004,15 +9661,15 @@ static GALGAS_gtlData extensionGetter_gtlLiteralStructExpression_eval (const cPt
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlLiteralStructExpression * object = (const cPtr_gtlLiteralStructExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlLiteralStructExpression) ;
-  GALGAS_gtlVarMap var_resultStruct_47284 = GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("gtl_expressions.galgas", 1533)) ;
+  GALGAS_gtlVarMap var_resultStruct_47284 = GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("gtl_expressions.galgas", 1542)) ;
   cEnumerator_gtlExpressionMap enumerator_47322 (object->mProperty_value, kENUMERATION_UP) ;
   while (enumerator_47322.hasCurrentObject ()) {
     {
-    var_resultStruct_47284.setter_put (enumerator_47322.current_lkey (HERE), callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_47322.current_expression (HERE).ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1535)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1535)) ;
+    var_resultStruct_47284.setter_put (enumerator_47322.current_lkey (HERE), callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_47322.current_expression (HERE).ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1544)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1544)) ;
     }
     enumerator_47322.gotoNextObject () ;
   }
-  result_result = GALGAS_gtlStruct::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1537)), var_resultStruct_47284  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1537)) ;
+  result_result = GALGAS_gtlStruct::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1546)), var_resultStruct_47284  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1546)) ;
 //---
   return result_result ;
 }
@@ -9044,15 +9701,15 @@ static GALGAS_gtlData extensionGetter_gtlLiteralMapExpression_eval (const cPtr_g
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlLiteralMapExpression * object = (const cPtr_gtlLiteralMapExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlLiteralMapExpression) ;
-  GALGAS_gtlVarMap var_resultStruct_47899 = GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("gtl_expressions.galgas", 1553)) ;
+  GALGAS_gtlVarMap var_resultStruct_47899 = GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("gtl_expressions.galgas", 1562)) ;
   cEnumerator_gtlExpressionMap enumerator_47937 (object->mProperty_value, kENUMERATION_UP) ;
   while (enumerator_47937.hasCurrentObject ()) {
     {
-    var_resultStruct_47899.setter_put (enumerator_47937.current_lkey (HERE), callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_47937.current_expression (HERE).ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1555)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1555)) ;
+    var_resultStruct_47899.setter_put (enumerator_47937.current_lkey (HERE), callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_47937.current_expression (HERE).ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1564)), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1564)) ;
     }
     enumerator_47937.gotoNextObject () ;
   }
-  result_result = GALGAS_gtlMap::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1557)), var_resultStruct_47899  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1557)) ;
+  result_result = GALGAS_gtlMap::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1566)), var_resultStruct_47899  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1566)) ;
 //---
   return result_result ;
 }
@@ -9084,13 +9741,13 @@ static GALGAS_gtlData extensionGetter_gtlLiteralListExpression_eval (const cPtr_
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlLiteralListExpression * object = (const cPtr_gtlLiteralListExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlLiteralListExpression) ;
-  GALGAS_list var_resultList_48508 = GALGAS_list::constructor_emptyList (SOURCE_FILE ("gtl_expressions.galgas", 1573)) ;
+  GALGAS_list var_resultList_48508 = GALGAS_list::constructor_emptyList (SOURCE_FILE ("gtl_expressions.galgas", 1582)) ;
   cEnumerator_gtlExpressionList enumerator_48543 (object->mProperty_value, kENUMERATION_UP) ;
   while (enumerator_48543.hasCurrentObject ()) {
-    var_resultList_48508.addAssign_operation (callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_48543.current_expression (HERE).ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1575))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1575)) ;
+    var_resultList_48508.addAssign_operation (callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_48543.current_expression (HERE).ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1584))  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1584)) ;
     enumerator_48543.gotoNextObject () ;
   }
-  result_result = GALGAS_gtlList::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1577)), var_resultList_48508  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1577)) ;
+  result_result = GALGAS_gtlList::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1586)), var_resultList_48508  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1586)) ;
 //---
   return result_result ;
 }
@@ -9122,25 +9779,25 @@ static GALGAS_gtlData extensionGetter_gtlLiteralSetExpression_eval (const cPtr_g
   GALGAS_gtlData result_result ; // Returned variable
   const cPtr_gtlLiteralSetExpression * object = (const cPtr_gtlLiteralSetExpression *) inObject ;
   macroValidSharedObject (object, cPtr_gtlLiteralSetExpression) ;
-  GALGAS_lstringset var_resultSet_49103 = GALGAS_lstringset::constructor_emptyMap (SOURCE_FILE ("gtl_expressions.galgas", 1593)) ;
+  GALGAS_lstringset var_resultSet_49103 = GALGAS_lstringset::constructor_emptyMap (SOURCE_FILE ("gtl_expressions.galgas", 1602)) ;
   cEnumerator_gtlExpressionList enumerator_49137 (object->mProperty_value, kENUMERATION_UP) ;
   while (enumerator_49137.hasCurrentObject ()) {
-    GALGAS_lstring var_itemValue_49163 = callExtensionGetter_lstring ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_49137.current_expression (HERE).ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1595)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1595)) ;
+    GALGAS_lstring var_itemValue_49163 = callExtensionGetter_lstring ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) enumerator_49137.current_expression (HERE).ptr (), constinArgument_context, constinArgument_vars, constinArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1604)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1604)) ;
     enumGalgasBool test_0 = kBoolTrue ;
     if (kBoolTrue == test_0) {
-      test_0 = var_resultSet_49103.getter_hasKey (var_itemValue_49163.getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1596)) COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1596)).boolEnum () ;
+      test_0 = var_resultSet_49103.getter_hasKey (var_itemValue_49163.getter_string (SOURCE_FILE ("gtl_expressions.galgas", 1605)) COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1605)).boolEnum () ;
       if (kBoolTrue == test_0) {
         {
-        var_resultSet_49103.setter_del (var_itemValue_49163, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1597)) ;
+        var_resultSet_49103.setter_del (var_itemValue_49163, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1606)) ;
         }
       }
     }
     {
-    var_resultSet_49103.setter_put (var_itemValue_49163, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1599)) ;
+    var_resultSet_49103.setter_put (var_itemValue_49163, inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1608)) ;
     }
     enumerator_49137.gotoNextObject () ;
   }
-  result_result = GALGAS_gtlSet::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1601)), var_resultSet_49103  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1601)) ;
+  result_result = GALGAS_gtlSet::constructor_new (object->mProperty_where, function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1610)), var_resultSet_49103  COMMA_SOURCE_FILE ("gtl_expressions.galgas", 1610)) ;
 //---
   return result_result ;
 }
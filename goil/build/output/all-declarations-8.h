@@ -10,24 +10,17 @@
 
 //----------------------------------------------------------------------------------------------------------------------
 //
-//Function 'invokeGTL'
+//Routine 'invokeGTL'
 //
 //----------------------------------------------------------------------------------------------------------------------
 
-class GALGAS_string function_invokeGTL (class GALGAS_gtlString inArgument0,
-                                        class GALGAS_gtlContext inArgument1,
-                                        class GALGAS_gtlData inArgument2,
-                                        class C_Compiler * inCompiler
-                                        COMMA_LOCATION_ARGS) ;
-
-//----------------------------------------------------------------------------------------------------------------------
-//
-//Function 'emptyLib'
-//
-//----------------------------------------------------------------------------------------------------------------------
-
-class GALGAS_library function_emptyLib (class C_Compiler * inCompiler
-                                        COMMA_LOCATION_ARGS) ;
+void routine_invokeGTL (class GALGAS_gtlString inArgument0,
+                        class GALGAS_gtlContext inArgument1,
+                        class GALGAS_gtlData inArgument2,
+                        class GALGAS_library & ioArgument3,
+                        class GALGAS_string & outArgument4,
+                        class C_Compiler * inCompiler
+                        COMMA_LOCATION_ARGS) ;
 
 //----------------------------------------------------------------------------------------------------------------------
 //
@@ -58,6 +51,95 @@ class GALGAS_gtlString function_stringToGtlString (class GALGAS_string inArgumen
                                                    class C_Compiler * inCompiler
                                                    COMMA_LOCATION_ARGS) ;
 
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Function 'jsonString'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+class GALGAS_string function_jsonString (const class GALGAS_string & constinArgument0,
+                                         class C_Compiler * inCompiler
+                                         COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Function 'selfDuration'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+class GALGAS_uint function_selfDuration (const class GALGAS_uint & constinArgument0,
+                                         const class GALGAS_uint & constinArgument1,
+                                         class C_Compiler * inCompiler
+                                         COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Function 'profileCosts'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+class GALGAS_string function_profileCosts (const class GALGAS_string & constinArgument0,
+                                           const class GALGAS_uint & constinArgument1,
+                                           const class GALGAS_uint & constinArgument2,
+                                           const class GALGAS_uint & constinArgument3,
+                                           const class GALGAS_uint_36__34_ & constinArgument4,
+                                           class C_Compiler * inCompiler
+                                           COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Routine 'writeGTLProfile'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+void routine_writeGTLProfile (const class GALGAS_gtlProfileMap constinArgument0,
+                              const class GALGAS_library constinArgument1,
+                              const class GALGAS_string constinArgument2,
+                              class C_Compiler * inCompiler
+                              COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Function 'outputJobCount'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+class GALGAS_uint function_outputJobCount (class C_Compiler * inCompiler
+                                           COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Function 'outputDependencyState'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+class GALGAS_string function_outputDependencyState (const class GALGAS_string & constinArgument0,
+                                                    const class GALGAS_gtlData & constinArgument1,
+                                                    class C_Compiler * inCompiler
+                                                    COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Function 'outputRecord'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+class GALGAS_string function_outputRecord (const class GALGAS_stringlist & constinArgument0,
+                                           const class GALGAS_gtlData & constinArgument1,
+                                           class C_Compiler * inCompiler
+                                           COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Function 'outputIsUpToDate'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+class GALGAS_bool function_outputIsUpToDate (const class GALGAS_string & constinArgument0,
+                                             const class GALGAS_gtlData & constinArgument1,
+                                             class C_Compiler * inCompiler
+                                             COMMA_LOCATION_ARGS) ;
+
 //----------------------------------------------------------------------------------------------------------------------
 //
 //Function 'emptyContext'
@@ -175,6 +175,10 @@ class GALGAS_string : public AC_GALGAS_root {
   public : typeComparisonResult objectCompare (const GALGAS_string & inOperand) const ;
 
 //--------------------------------- Setters
+  public : VIRTUAL_IN_DEBUG void setter_appendLinesToFile (class GALGAS_string constinArgument0,
+                                                           C_Compiler * inCompiler
+                                                           COMMA_LOCATION_ARGS) ;
+
   public : VIRTUAL_IN_DEBUG void setter_appendSpacesUntilColumn (class GALGAS_uint constinArgument0,
                                                                  C_Compiler * inCompiler
                                                                  COMMA_LOCATION_ARGS) ;
@@ -241,6 +245,13 @@ class GALGAS_string : public AC_GALGAS_root {
                                                                           C_Compiler * inCompiler
                                                                           COMMA_LOCATION_ARGS) const ;
 
+  public : VIRTUAL_IN_DEBUG void method_writeToFileWithPart (class GALGAS_string constinArgument0,
+                                                             class GALGAS_string constinArgument1,
+                                                             class GALGAS_bool constinArgument2,
+                                                             class GALGAS_bool constinArgument3,
+                                                             C_Compiler * inCompiler
+                                                             COMMA_LOCATION_ARGS) const ;
+
 //--------------------------------- Class Methods
   public : static void class_method_deleteFile (class GALGAS_string constinArgument0,
                                                 C_Compiler * inCompiler
@@ -795,9 +806,27 @@ class GALGAS_location : public AC_GALGAS_root {
   public : VIRTUAL_IN_DEBUG class GALGAS_uint getter_locationIndex (C_Compiler * inCompiler
                                                                     COMMA_LOCATION_ARGS) const ;
 
+  public : VIRTUAL_IN_DEBUG class GALGAS_location getter_locationInSameSource (const class GALGAS_uint & constinOperand0,
+                                                                              const class GALGAS_uint & constinOperand1,
+                                                                              const class GALGAS_uint & constinOperand2,
+                                                                              const class GALGAS_uint & constinOperand3,
+                                                                              const class GALGAS_uint & constinOperand4,
+                                                                              const class GALGAS_uint & constinOperand5,
+                                                                              C_Compiler * inCompiler
+                                                                              COMMA_LOCATION_ARGS) const ;
+
   public : VIRTUAL_IN_DEBUG class GALGAS_string getter_locationString (C_Compiler * inCompiler
                                                                        COMMA_LOCATION_ARGS) const ;
 
+  public : VIRTUAL_IN_DEBUG class GALGAS_uint getter_startColumn (C_Compiler * inCompiler
+                                                                  COMMA_LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_uint getter_startLine (C_Compiler * inCompiler
+                                                                COMMA_LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_uint getter_startLocationIndex (C_Compiler * inCompiler
+                                                                         COMMA_LOCATION_ARGS) const ;
+
 
 //--------------------------------- Optional Methods
 
@@ -2291,12 +2320,17 @@ class GALGAS_application : public AC_GALGAS_root {
                                                                  const class GALGAS_string & inOperand1
                                                                  COMMA_LOCATION_ARGS) ;
 
+  public : static class GALGAS_stringlist constructor_changedFiles (class C_Compiler * inCompiler
+                                                                    COMMA_LOCATION_ARGS) ;
+
   public : static class GALGAS_string constructor_commandLineArgumentAtIndex (const class GALGAS_uint & inOperand0,
                                                                               class C_Compiler * inCompiler
                                                                               COMMA_LOCATION_ARGS) ;
 
   public : static class GALGAS_uint constructor_commandLineArgumentCount (LOCATION_ARGS) ;
 
+  public : static class GALGAS_stringlist constructor_endOutputDependencies (LOCATION_ARGS) ;
+
   public : static class GALGAS_string constructor_galgasVersionString (LOCATION_ARGS) ;
 
   public : static class GALGAS_stringset constructor_keywordIdentifierSet (LOCATION_ARGS) ;
@@ -2304,8 +2338,17 @@ class GALGAS_application : public AC_GALGAS_root {
   public : static class GALGAS_stringlist constructor_keywordListForIdentifier (const class GALGAS_string & inOperand0
                                                                                 COMMA_LOCATION_ARGS) ;
 
+  public : static class GALGAS_string constructor_outputRecord (const class GALGAS_string & inOperand0
+                                                                COMMA_LOCATION_ARGS) ;
+
+  public : static class GALGAS__32_stringlist constructor_parsedSourceFiles (class C_Compiler * inCompiler
+                                                                             COMMA_LOCATION_ARGS) ;
+
   public : static class GALGAS_string constructor_projectVersionString (LOCATION_ARGS) ;
 
+  public : static class GALGAS_bool constructor_startOutputJob (const class GALGAS_uint & inOperand0
+                                                                COMMA_LOCATION_ARGS) ;
+
   public : static class GALGAS_string constructor_stringOptionCommentString (const class GALGAS_string & inOperand0,
                                                                              const class GALGAS_string & inOperand1
                                                                              COMMA_LOCATION_ARGS) ;
@@ -2356,11 +2399,29 @@ class GALGAS_application : public AC_GALGAS_root {
 
 //--------------------------------- Instance Methods
 //--------------------------------- Class Methods
+  public : static void class_method_addOutputFileDependency (class GALGAS_string constinArgument0
+                                                             COMMA_LOCATION_ARGS) ;
+
+  public : static void class_method_addOutputVariableDependency (class GALGAS_string constinArgument0
+                                                                 COMMA_LOCATION_ARGS) ;
+
+  public : static void class_method_addOutputVolatileDependency (LOCATION_ARGS) ;
+
+  public : static void class_method_beginOutputDependencies (LOCATION_ARGS) ;
+
+  public : static void class_method_endOutputJob (LOCATION_ARGS) ;
+
+  public : static void class_method_forgetOutputRecords (LOCATION_ARGS) ;
+
   public : static void class_method_setBoolOptionValue (class GALGAS_string constinArgument0,
                                                         class GALGAS_string constinArgument1,
                                                         class GALGAS_bool constinArgument2
                                                         COMMA_LOCATION_ARGS) ;
 
+  public : static void class_method_setOutputRecord (class GALGAS_string constinArgument0,
+                                                     class GALGAS_string constinArgument1
+                                                     COMMA_LOCATION_ARGS) ;
+
   public : static void class_method_setStringOptionValue (class GALGAS_string constinArgument0,
                                                           class GALGAS_string constinArgument1,
                                                           class GALGAS_string constinArgument2
@@ -2371,6 +2432,11 @@ class GALGAS_application : public AC_GALGAS_root {
                                                         class GALGAS_uint constinArgument2
                                                         COMMA_LOCATION_ARGS) ;
 
+  public : static void class_method_waitOutputJobs (LOCATION_ARGS) ;
+
+  public : static void class_method_watchFiles (class GALGAS_stringlist constinArgument0
+                                                COMMA_LOCATION_ARGS) ;
+
 
 //--------------------------------- Getters
 
@@ -3188,6 +3254,12 @@ class GALGAS_timer : public AC_GALGAS_root {
 //--------------------------------- Class Methods
 
 //--------------------------------- Getters
+  public : VIRTUAL_IN_DEBUG class GALGAS_uint_36__34_ getter_allocatedBytesFromStart (LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_uint getter_allocationsFromStart (LOCATION_ARGS) const ;
+
+  public : VIRTUAL_IN_DEBUG class GALGAS_uint getter_cpuUsFromStart (LOCATION_ARGS) const ;
+
   public : VIRTUAL_IN_DEBUG class GALGAS_bool getter_isRunning (LOCATION_ARGS) const ;
 
   public : VIRTUAL_IN_DEBUG class GALGAS_uint getter_msFromStart (LOCATION_ARGS) const ;
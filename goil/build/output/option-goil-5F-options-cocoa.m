@@ -23,6 +23,15 @@ void enterOptionsFor_goil_5F_options (NSMutableArray * ioBoolOptionArray,
     defaultValue:@""
   ] ;
   [ioBoolOptionArray addObject:option] ;
+  option = [[OC_GGS_CommandLineOption alloc]
+    initWithDomainName:@"goil_options"
+    identifier:@"footprint"
+    commandChar:0
+    commandString:@"footprint"
+    comment:@"Generate a RAM/ROM footprint report of the kernel data (footprint.json and footprint.txt)"
+    defaultValue:@""
+  ] ;
+  [ioBoolOptionArray addObject:option] ;
   option = [[OC_GGS_CommandLineOption alloc]
     initWithDomainName:@"goil_options"
     identifier:@"generate_log"
@@ -50,6 +59,15 @@ void enterOptionsFor_goil_5F_options (NSMutableArray * ioBoolOptionArray,
     defaultValue:@""
   ] ;
   [ioBoolOptionArray addObject:option] ;
+  option = [[OC_GGS_CommandLineOption alloc]
+    initWithDomainName:@"goil_options"
+    identifier:@"watch"
+    commandChar:0
+    commandString:@"watch"
+    comment:@"Keep running, poll the OIL files and the templates every second and generate again when they change"
+    defaultValue:@""
+  ] ;
+  [ioBoolOptionArray addObject:option] ;
   option = [[OC_GGS_CommandLineOption alloc]
     initWithDomainName:@"goil_options"
     identifier:@"config"
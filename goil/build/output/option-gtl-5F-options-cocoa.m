@@ -23,6 +23,15 @@ void enterOptionsFor_gtl_5F_options (NSMutableArray * ioBoolOptionArray,
     defaultValue:@""
   ] ;
   [ioBoolOptionArray addObject:option] ;
+  option = [[OC_GGS_CommandLineOption alloc]
+    initWithDomainName:@"gtl_options"
+    identifier:@"profile"
+    commandChar:0
+    commandString:@"profile"
+    comment:@"Profile the execution of goil and of the GTL templates"
+    defaultValue:@""
+  ] ;
+  [ioBoolOptionArray addObject:option] ;
   option = [[OC_GGS_CommandLineOption alloc]
     initWithDomainName:@"gtl_options"
     identifier:@"warnDeprecated"
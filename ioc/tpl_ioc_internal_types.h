@@ -47,6 +47,15 @@ typedef uint8 tpl_ioc_data;
 typedef P2VAR(tpl_ioc_data, TYPEDEF, OS_VAR) tpl_ioc_buffer;
 
 
+/**
+ * @typedef tpl_ioc_sequence
+ *
+ * sequence counter of a lock-free unqueued ioc. It is odd while the data
+ * are written
+ */
+typedef uint32 tpl_ioc_sequence;
+
+
 /**
  * @typedef tpl_ioc_unqueued_mo
  *
@@ -59,6 +68,9 @@ struct TPL_IOC_UNQUEUED_MO
   P2CONST(tpl_ioc_message_size, TYPEDEF, OS_CONST)  element_size;
   VAR(tpl_ioc_id, TYPEDEF)                          id;
   VAR(tpl_ioc_size, TYPEDEF)                        nb_mo;
+#if WITH_IOC_LOCK_FREE == YES
+  P2VAR(tpl_ioc_sequence, TYPEDEF, OS_VAR)          sequence;
+#endif
 };
 
 typedef struct TPL_IOC_UNQUEUED_MO tpl_ioc_unqueued_mo;
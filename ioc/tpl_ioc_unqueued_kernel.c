@@ -15,6 +15,7 @@
 /* MISRA RULE 3.1 VIOLATION: special character is used in comments for svn integration, the code can survive to this ! */
 
 #include "tpl_ioc_unqueued_kernel.h"
+#include "tpl_machine_interface.h"
 
 #define OS_START_SEC_CODE
 #include "tpl_memmap.h"
@@ -231,6 +232,150 @@ FUNC(void, OS_CODE) tpl_ioc_init_unqueued(void)
   }
 }
 
+#if WITH_IOC_LOCK_FREE == YES
+
+/*
+ * Lock-free unqueued IOC. goil selects it for a last-is-best IOC written
+ * by a single task or ISR and read from other cores only. The data are
+ * copied in the context of the caller, without the kernel lock, and
+ * protected by a sequence counter: the writer makes it odd while it copies
+ * the data, a reader copies the data again if the counter was odd or has
+ * changed during its copy. The writer never waits. A reader waits only
+ * while the writer is in the middle of a copy.
+ * The checks are the ones of the locked services. When one fails, nothing
+ * is copied and the error is returned as is: the generated IOC API then
+ * calls the locked service, which reports it to the error hook with the
+ * kernel locked.
+ */
+
+/**
+ * lock-free write of an IOC unqueued message
+ *
+ * @param ioc_id identifier of the ioc
+ * @param ioc_data pointer to the data struct to send
+ *
+ * @retval IOC_E_OK no error
+ * @retval E_OS_ID or E_OS_ACCESS in EXTENDED mode, nothing is written
+ *
+ */
+FUNC(tpl_status, OS_CODE) tpl_ioc_write_unqueued_lock_free(
+  VAR(tpl_ioc_id, AUTOMATIC) ioc_id,
+  P2CONST(tpl_ioc_message, AUTOMATIC, OS_VAR) ioc_data
+)
+{
+  P2CONST(tpl_ioc_unqueued_mo, AUTOMATIC, OS_CONST) ioc_stat;
+  P2VAR(volatile tpl_ioc_sequence, AUTOMATIC, OS_VAR) sequence;
+  P2VAR(volatile tpl_ioc_data, AUTOMATIC, OS_VAR)   data_ptr;
+  P2VAR(uint8, AUTOMATIC, AUTOMATIC)                ioc_data_ptr;
+  VAR(tpl_status, AUTOMATIC)                        result = E_OK;
+  VAR(tpl_ioc_size, AUTOMATIC)                      message;
+  VAR(tpl_ioc_message_size, AUTOMATIC)              size;
+  GET_CURRENT_CORE_ID(core_id)
+
+  /*  check a ioc_id error   */
+  CHECK_IOC_ID_ERROR(ioc_id, result)
+
+  /* check access right */
+  CHECK_ACCESS_WRITE_IOC_ID(core_id, ioc_id, result)
+
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    ioc_stat = tpl_ioc_unqueued_table[ioc_id-IOC_QUEUED_COUNT];
+    sequence = ioc_stat->sequence;
+
+    /* odd: the data are being written */
+    *sequence = *sequence + 1;
+    tpl_memory_barrier();
+
+    for(message=0; message<ioc_stat->nb_mo; message++)
+    {
+      data_ptr = ioc_stat->buffer[message];
+      size = ioc_stat->element_size[message];
+      ioc_data_ptr = ioc_data[message].data;
+      while (size > 0) {
+        *data_ptr = *ioc_data_ptr;
+        data_ptr++;
+        ioc_data_ptr++;
+        size--;
+      }
+    }
+
+    /* even again: the data are consistent */
+    tpl_memory_barrier();
+    *sequence = *sequence + 1;
+  }
+
+  return result;
+}
+
+/**
+ * lock-free read of an IOC unqueued message
+ *
+ * @param ioc_id identifier of the ioc
+ * @param ioc_data pointer to the data struct to receive
+ *
+ * @retval IOC_E_OK no error
+ * @retval E_OS_ID or E_OS_ACCESS in EXTENDED mode, nothing is read
+ *
+ */
+FUNC(tpl_status, OS_CODE) tpl_ioc_read_unqueued_lock_free(
+  VAR(tpl_ioc_id, AUTOMATIC) ioc_id,
+  P2CONST(tpl_ioc_message, AUTOMATIC, OS_VAR) ioc_data
+)
+{
+  P2CONST(tpl_ioc_unqueued_mo, AUTOMATIC, OS_CONST) ioc_stat;
+  P2VAR(volatile tpl_ioc_sequence, AUTOMATIC, OS_VAR) sequence;
+  P2VAR(volatile tpl_ioc_data, AUTOMATIC, OS_VAR)   data_ptr;
+  P2VAR(uint8, AUTOMATIC, AUTOMATIC)                ioc_data_ptr;
+  VAR(tpl_status, AUTOMATIC)                        result = E_OK;
+  VAR(tpl_ioc_size, AUTOMATIC)                      message;
+  VAR(tpl_ioc_message_size, AUTOMATIC)              size;
+  VAR(tpl_ioc_sequence, AUTOMATIC)                  start;
+  GET_CURRENT_CORE_ID(core_id)
+
+  /*  check a ioc_id error   */
+  CHECK_IOC_ID_ERROR(ioc_id, result)
+
+  /* check access right */
+  CHECK_ACCESS_READ_IOC_ID(core_id, ioc_id, result)
+
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    ioc_stat = tpl_ioc_unqueued_table[ioc_id-IOC_QUEUED_COUNT];
+    sequence = ioc_stat->sequence;
+
+    do
+    {
+      /* wait until the writer is not copying */
+      do
+      {
+        start = *sequence;
+      } while ((start & 1U) != 0U);
+      tpl_memory_barrier();
+
+      for(message=0; message<ioc_stat->nb_mo; message++)
+      {
+        data_ptr = ioc_stat->buffer[message];
+        size = ioc_stat->element_size[message];
+        ioc_data_ptr = ioc_data[message].data;
+        while (size > 0) {
+          *ioc_data_ptr = *data_ptr;
+          ioc_data_ptr++;
+          data_ptr++;
+          size--;
+        }
+      }
+
+      /* copy again if the writer has written in the meantime */
+      tpl_memory_barrier();
+    } while (*sequence != start);
+  }
+
+  return result;
+}
+
+#endif /* WITH_IOC_LOCK_FREE */
+
 #define OS_STOP_SEC_CODE
 #include "tpl_memmap.h"
 
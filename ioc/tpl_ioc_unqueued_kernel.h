@@ -50,6 +50,18 @@ extern FUNC(StatusType, OS_CODE) tpl_ioc_receive_unqueued_service(
 
 extern FUNC(void, OS_CODE) tpl_ioc_init_unqueued(void);
 
+#if WITH_IOC_LOCK_FREE == YES
+extern FUNC(tpl_status, OS_CODE) tpl_ioc_write_unqueued_lock_free(
+  VAR(tpl_ioc_id, AUTOMATIC) ioc_id,
+  P2CONST(tpl_ioc_message, AUTOMATIC, OS_VAR) ioc_data
+);
+
+extern FUNC(tpl_status, OS_CODE) tpl_ioc_read_unqueued_lock_free(
+  VAR(tpl_ioc_id, AUTOMATIC) ioc_id,
+  P2CONST(tpl_ioc_message, AUTOMATIC, OS_VAR) ioc_data
+);
+#endif /* WITH_IOC_LOCK_FREE */
+
 #define OS_STOP_SEC_CODE
 #include "tpl_memmap.h"
 
@@ -284,6 +284,26 @@ FUNC(uint8, OS_CODE) tpl_check_stack_footprint(CONST(tpl_proc_id, OS_APPL_DATA)
   return tmp;
 }
 
+#if WITH_PAINT_STACK == YES
+FUNC(uint32, OS_CODE) tpl_stack_high_water_mark(
+  CONST(tpl_proc_id, AUTOMATIC) proc_id)
+{
+  CONSTP2CONST(tpl_proc_static, AUTOMATIC, OS_APPL_DATA) the_proc =
+    TPL_STAT_PROC(proc_id);
+  CONST(uint32, AUTOMATIC) size = the_proc->stack.stack_size >> 2;
+  VAR(uint32, AUTOMATIC) unused = 0;
+
+  /* the stack grows downward, its unused part is at the bottom */
+  while ((unused < size) &&
+         (the_proc->stack.stack_zone[unused] == OS_STACK_PATTERN))
+  {
+    unused++;
+  }
+
+  return (size - unused) << 2;
+}
+#endif
+
 /*
  * tpl_sleep is used by the idle task
  */
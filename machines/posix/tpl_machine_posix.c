@@ -38,6 +38,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sys/types.h>
+#include <time.h>
 #include <unistd.h>
 #include <sys/wait.h>
 
@@ -57,19 +58,106 @@ extern FUNC(void, OS_CODE) CallTerminateISR2(void);
 #endif
 
 extern void viper_kill(void);
+extern sigset_t signal_set;
+
+/*
+ * CPU load accounting. A Trampoline process simulates one core, so the
+ * time spent in the idle task gives the load of this core.
+ * tpl_posix_idle_start is set while the idle task waits for an interrupt,
+ * the wait ends in tpl_posix_idle_exit called by the signal handler.
+ */
+STATIC struct timespec tpl_posix_startup_date;
+STATIC struct timespec tpl_posix_idle_start;
+STATIC volatile sig_atomic_t tpl_posix_in_idle = 0;
+STATIC uint64_t tpl_posix_idle_ns = 0;
+STATIC uint64_t tpl_posix_load_last_idle_ns = 0;
+STATIC uint64_t tpl_posix_load_last_elapsed_ns = 0;
+
+STATIC uint64_t tpl_posix_ns_since(CONSTP2CONST(struct timespec, AUTOMATIC, OS_VAR) from)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)(now.tv_sec - from->tv_sec) * 1000000000ULL
+           + now.tv_nsec - from->tv_nsec;
+}
+
+void tpl_posix_idle_exit(void)
+{
+    if (tpl_posix_in_idle)
+    {
+        tpl_posix_idle_ns += tpl_posix_ns_since(&tpl_posix_idle_start);
+        tpl_posix_in_idle = 0;
+    }
+}
+
+void tpl_posix_get_idle_time(
+    P2VAR(uint64_t, AUTOMATIC, OS_APPL_DATA) idle_ns,
+    P2VAR(uint64_t, AUTOMATIC, OS_APPL_DATA) elapsed_ns)
+{
+    tpl_posix_sigblock("tpl_posix_get_idle_time failed");
+    *idle_ns = tpl_posix_idle_ns;
+    *elapsed_ns = tpl_posix_ns_since(&tpl_posix_startup_date);
+    tpl_posix_sigunblock("tpl_posix_get_idle_time failed");
+}
+
+uint32 tpl_posix_cpu_load(void)
+{
+    uint64_t idle_ns;
+    uint64_t elapsed_ns;
+    uint64_t period_ns;
+    uint32 load = 0;
+
+    tpl_posix_get_idle_time(&idle_ns, &elapsed_ns);
+    period_ns = elapsed_ns - tpl_posix_load_last_elapsed_ns;
+    if (period_ns > 0)
+    {
+        load = (uint32)(1000 -
+          ((idle_ns - tpl_posix_load_last_idle_ns) * 1000) / period_ns);
+    }
+    tpl_posix_load_last_idle_ns = idle_ns;
+    tpl_posix_load_last_elapsed_ns = elapsed_ns;
+
+    return load;
+}
 
 /*
  * idle_function is used by the idle task
+ *
+ * The interrupt signals are blocked while the start of the idle period is
+ * recorded, then sigsuspend atomically restores the mask of the idle task
+ * and waits. This way no interrupt can be missed between the bookkeeping
+ * and the wait.
  */
 void idle_function(void)
 {
-    while(1) pause();
+#if WITH_POSIX_VIRTUAL_TIME == NO
+    sigset_t idle_mask;
+#endif
+
+    while(1)
+    {
+#if WITH_POSIX_VIRTUAL_TIME == YES
+        /* nothing to wait for, the virtual time jumps to the next event */
+        tpl_posix_vtime_jump();
+#else
+        sigprocmask(SIG_BLOCK, &signal_set, &idle_mask);
+        clock_gettime(CLOCK_MONOTONIC, &tpl_posix_idle_start);
+        tpl_posix_in_idle = 1;
+        sigsuspend(&idle_mask);
+        tpl_posix_idle_exit();
+        sigprocmask(SIG_SETMASK, &idle_mask, NULL);
+#endif
+    }
 }
 
 void tpl_shutdown(void)
 {
     tpl_posix_sigblock("tpl_shutdown_failed");
     viper_kill();
+#if WITH_PAINT_STACK == YES && WITH_STACK_SIZING == YES
+    tpl_posix_stack_usage_dump();
+#endif
 
     exit(0);
 }
@@ -149,8 +237,8 @@ void tpl_release_task_lock(void)
 FUNC(void, OS_CODE) tpl_init_context(
         CONST(tpl_proc_id, OS_APPL_DATA) proc_id)
 {
-    memcpy( tpl_stat_proc_table[proc_id]->context->current,
-            tpl_stat_proc_table[proc_id]->context->initial,
+    memcpy( TPL_STAT_PROC(proc_id)->context->current,
+            TPL_STAT_PROC(proc_id)->context->initial,
             sizeof(jmp_buf));
 }
 
@@ -159,8 +247,8 @@ FUNC(void, OS_CODE) tpl_init_context(
 #include "tpl_memmap.h"
 void tpl_osek_func_stub( tpl_proc_id task_id )
 {
-    tpl_proc_function func = tpl_stat_proc_table[task_id]->entry;
-    tpl_proc_type     type = tpl_stat_proc_table[task_id]->type;
+    tpl_proc_function func = TPL_STAT_PROC(task_id)->entry;
+    tpl_proc_type     type = TPL_STAT_PROC(task_id)->type;
 
     /* Avoid signal blocking due to a previous call to tpl_init_context in a OS_ISR2 context. */
     tpl_release_task_lock();
@@ -198,6 +286,8 @@ void tpl_init_machine(void)
     // TODO: invert control flow between these 2 functions
     tpl_posixvp_irq_gen_init();
 
+    clock_gettime(CLOCK_MONOTONIC, &tpl_posix_startup_date);
+
     tpl_proc_id proc_id;
 
     /* create the context of each tpl_proc */
@@ -205,6 +295,9 @@ void tpl_init_machine(void)
             proc_id < TASK_COUNT+ISR_COUNT+1;
             proc_id++)
     {
+#if WITH_PAINT_STACK == YES
+        tpl_posix_paint_stack(proc_id);
+#endif
         tpl_create_context(proc_id);
     }
 
@@ -216,7 +309,9 @@ void tpl_init_machine(void)
 
     tpl_viper_init();
 
-#if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0)
+#if WITH_POSIX_VIRTUAL_TIME == YES
+    tpl_posix_vtime_init();
+#elif ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0)
     tpl_viper_start_auto_timer(signal_for_counters,10000);  /* 10 ms */
 #endif
 
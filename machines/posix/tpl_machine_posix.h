@@ -10,12 +10,40 @@
 #ifndef tpl_machine_posix_h
 #define tpl_machine_posix_h
 
+#include <stdint.h>
+
 #include "tpl_os_internal_types.h"
 
+/*
+ * Pattern used to paint the stacks when PAINT_STACK is TRUE
+ */
+#define OS_STACK_PATTERN ((tpl_stack_word)0xDEADBEEF)
+
 #define OS_START_SEC_CODE
 #include "tpl_memmap.h"
 void tpl_osek_func_stub( tpl_proc_id task_id );
 void tpl_shutdown(void);
+
+/**
+ * Gives the time spent in the idle task and the time elapsed since
+ * the startup of the virtual processor, in nanoseconds.
+ */
+void tpl_posix_get_idle_time(
+    P2VAR(uint64_t, AUTOMATIC, OS_APPL_DATA) idle_ns,
+    P2VAR(uint64_t, AUTOMATIC, OS_APPL_DATA) elapsed_ns);
+
+/**
+ * Gives the CPU load of the simulated core, in per mille, since the
+ * previous call (or since startup for the first call).
+ */
+uint32 tpl_posix_cpu_load(void);
+
+#if WITH_POSIX_VIRTUAL_TIME == YES
+/**
+ * Gives the virtual time elapsed since the startup, in microseconds.
+ */
+FUNC(uint64_t, OS_CODE) tpl_posix_virtual_time(void);
+#endif
 #define OS_STOP_SEC_CODE
 #include "tpl_memmap.h"
 
@@ -25,17 +25,97 @@
  * $Author$
  * $URL$
  */
+#define _POSIX_C_SOURCE 200809L
+
 #include <sys/time.h>
+#include <signal.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
 
 #include "tpl_os_types.h"
 #include "tpl_machine_interface.h"
+#include "tpl_posix_internal.h"
 
 
 #if WITH_AUTOSAR_TIMING_PROTECTION == YES
 
 #include "tpl_as_timing_protec.h"
 
+#if WITH_POSIX_TP_CPU_CLOCK == YES
+
+/* Timer used for timing protection.
+ * Budgets are measured on the CPU time consumed by the Trampoline process
+ * instead of the elapsed time, so that a loaded host does not make them
+ * expire. All the procs run in the same Unix thread, so the CPU time of
+ * this thread between tpl_tp_on_start and tpl_tp_on_preempt is the
+ * execution time of the running proc. A single POSIX timer armed on the
+ * same clock is used to signal the expiration of the nearest watchdog.
+ */
+static struct timespec startup_time;
+static timer_t tp_host_timer;
+
+void tpl_start_tptimer ()
+{
+    struct sigevent event;
+
+    clock_gettime (CLOCK_THREAD_CPUTIME_ID, &startup_time);
+
+    event.sigev_notify = SIGEV_SIGNAL;
+    event.sigev_signo = signal_for_watchdog;
+    event.sigev_value.sival_ptr = &tp_host_timer;
+    if (timer_create (CLOCK_THREAD_CPUTIME_ID, &event, &tp_host_timer) == -1)
+    {
+        perror ("tpl_start_tptimer failed");
+        exit (-1);
+    }
+}
+
+/* CPU time in hundredth of seconds since system startup */
+FUNC(tpl_time, OS_CODE) tpl_get_tptimer (void)
+{
+    struct timespec time;
+    tpl_time result;
+
+    clock_gettime (CLOCK_THREAD_CPUTIME_ID, &time);
+    result =
+        (time.tv_sec - startup_time.tv_sec) * 100
+        + (time.tv_nsec - startup_time.tv_nsec) / 10000000;
+
+    return result;
+}
+
+/* Sets the watchdog to expire after delay hundredth of seconds of CPU time */
+FUNC(void, OS_CODE) tpl_set_tpwatchdog (
+        CONST(tpl_time, AUTOMATIC) delay)
+{
+    struct itimerspec watchdog;
+
+    watchdog.it_interval.tv_sec = 0;
+    watchdog.it_interval.tv_nsec = 0;
+    watchdog.it_value.tv_sec = delay / 100;
+    watchdog.it_value.tv_nsec = (delay % 100) * 10000000;
+    /* a zero it_value would disarm the timer: the budget is already over */
+    if ((watchdog.it_value.tv_sec == 0) && (watchdog.it_value.tv_nsec == 0))
+    {
+        watchdog.it_value.tv_nsec = 1;
+    }
+    timer_settime (tp_host_timer, 0, &watchdog, NULL);
+}
+
+FUNC(void, OS_CODE) tpl_cancel_tpwatchdog(void)
+{
+    struct itimerspec watchdog;
+
+    watchdog.it_interval.tv_sec = 0;
+    watchdog.it_interval.tv_nsec = 0;
+    watchdog.it_value.tv_sec = 0;
+    watchdog.it_value.tv_nsec = 0;
+    timer_settime (tp_host_timer, 0, &watchdog, NULL);
+}
+
+#else /* WITH_POSIX_TP_CPU_CLOCK */
+
 /* Timer used for timing protection
  * TODO use system timer provided by viper?
  */
@@ -46,7 +126,7 @@ void tpl_start_tptimer ()
     gettimeofday (&startup_time, NULL);  
 }
 
-/* Time in tenth of milliseconds since system startup */
+/* Time in hundredth of seconds since system startup */
 FUNC(tpl_time, OS_CODE) tpl_get_tptimer (void)
 {
     struct timeval time;
@@ -60,7 +140,7 @@ FUNC(tpl_time, OS_CODE) tpl_get_tptimer (void)
     return result;
 }
 
-/* Sets a watchdog to expire in tenth of millisec */
+/* Sets a watchdog to expire in hundredth of seconds */
 FUNC(void, OS_CODE) tpl_set_tpwatchdog (
         CONST(tpl_time, AUTOMATIC) delay)
 {
@@ -87,6 +167,8 @@ FUNC(void, OS_CODE) tpl_cancel_tpwatchdog(void)
     watchdog.it_value.tv_usec = 0;
     setitimer (ITIMER_REAL, &watchdog, NULL);
 }
+
+#endif /* WITH_POSIX_TP_CPU_CLOCK */
 #endif /* WITH_AUTOSAR_TIMING_PROTECTION */
 
 #if WITH_AUTOSAR_STACK_MONITORING == YES
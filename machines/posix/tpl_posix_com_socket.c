@@ -0,0 +1,295 @@
+/**
+ *
+ * @file tpl_posix_com_socket.c
+ *
+ * @section descr File description
+ *
+ * IPDU driver of the posix platform. Each Trampoline process is a node
+ * of a virtual bus: it binds a Unix domain datagram socket named after
+ * its pid in the bus directory and sends its IPDUs to all the other
+ * sockets of the directory. The bus directory is given by the TPL_COM_BUS
+ * environment variable and defaults to /tmp/trampoline-com.
+ *
+ * The IPDUs given in a single call to the send function are gathered in
+ * one datagram. Each IPDU is preceded by its id and its size, in the byte
+ * order of the host. The reception is signaled by SIGIO which is handled
+ * as an interrupt.
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline OS
+ *
+ * Trampoline is copyright (c) IRCCyN 2005+
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the Lesser GNU Public Licence
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+#define _DEFAULT_SOURCE
+#define _DARWIN_C_SOURCE
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "tpl_app_config.h"
+#include "tpl_os_definitions.h"
+#include "tpl_machine_posix.h"
+#include "tpl_posix_internal.h"
+
+#if WITH_EXTERNAL_COM == YES
+
+#include "tpl_com_external_com.h"
+#include "tpl_com_notification.h"
+
+#define TPL_POSIX_COM_BUS_DEFAULT "/tmp/trampoline-com"
+
+/*
+ * Largest datagram. A batch of IPDUs larger than this is split.
+ */
+#define TPL_POSIX_COM_DATAGRAM_SIZE 4096
+
+/*
+ * Largest number of nodes on the bus
+ */
+#define TPL_POSIX_COM_MAX_PEERS 32
+
+/*
+ * Header of an IPDU in a datagram
+ */
+typedef struct {
+    tpl_ipdu_id     id;
+    tpl_ipdu_size   size;
+} tpl_posix_com_header;
+
+STATIC int tpl_posix_com_fd = -1;
+STATIC struct sockaddr_un tpl_posix_com_addr;
+STATIC const char *tpl_posix_com_bus = NULL;
+
+/*
+ * The other nodes of the bus. The directory is scanned again when its
+ * modification date changes, ie when a node comes or goes.
+ */
+STATIC struct sockaddr_un tpl_posix_com_peers[TPL_POSIX_COM_MAX_PEERS];
+STATIC int tpl_posix_com_peer_count = 0;
+STATIC struct timespec tpl_posix_com_bus_date = { 0, 0 };
+
+STATIC unsigned char tpl_posix_com_datagram[TPL_POSIX_COM_DATAGRAM_SIZE];
+
+STATIC void tpl_posix_com_exit(void)
+{
+    if (tpl_posix_com_fd != -1)
+    {
+        close(tpl_posix_com_fd);
+        unlink(tpl_posix_com_addr.sun_path);
+    }
+}
+
+STATIC int tpl_posix_com_set_path(struct sockaddr_un *addr, const char *name)
+{
+    int len;
+
+    memset(addr, 0, sizeof(*addr));
+    addr->sun_family = AF_UNIX;
+    len = snprintf(addr->sun_path, sizeof(addr->sun_path), "%s/%s",
+                   tpl_posix_com_bus, name);
+    return (len > 0) && ((size_t)len < sizeof(addr->sun_path));
+}
+
+STATIC void tpl_posix_com_scan_bus(void)
+{
+    struct stat st;
+    DIR *dir;
+    struct dirent *entry;
+
+    if (stat(tpl_posix_com_bus, &st) == -1)
+    {
+        return;
+    }
+#if defined(__APPLE__)
+    if ((st.st_mtimespec.tv_sec == tpl_posix_com_bus_date.tv_sec) &&
+        (st.st_mtimespec.tv_nsec == tpl_posix_com_bus_date.tv_nsec))
+    {
+        return;
+    }
+    tpl_posix_com_bus_date = st.st_mtimespec;
+#else
+    if ((st.st_mtim.tv_sec == tpl_posix_com_bus_date.tv_sec) &&
+        (st.st_mtim.tv_nsec == tpl_posix_com_bus_date.tv_nsec))
+    {
+        return;
+    }
+    tpl_posix_com_bus_date = st.st_mtim;
+#endif
+
+    tpl_posix_com_peer_count = 0;
+    dir = opendir(tpl_posix_com_bus);
+    if (dir == NULL)
+    {
+        return;
+    }
+    while (((entry = readdir(dir)) != NULL) &&
+           (tpl_posix_com_peer_count < TPL_POSIX_COM_MAX_PEERS))
+    {
+        struct sockaddr_un *peer =
+            &tpl_posix_com_peers[tpl_posix_com_peer_count];
+        if ((entry->d_name[0] != '.') &&
+            tpl_posix_com_set_path(peer, entry->d_name) &&
+            (strcmp(peer->sun_path, tpl_posix_com_addr.sun_path) != 0))
+        {
+            tpl_posix_com_peer_count++;
+        }
+    }
+    closedir(dir);
+}
+
+/*
+ * Send a datagram to all the other nodes. The socket of a node which
+ * exited without removing it is removed. A node whose socket is full
+ * loses the datagram, as a node would miss a frame on a real bus.
+ */
+STATIC void tpl_posix_com_broadcast(size_t size)
+{
+    int i;
+
+    tpl_posix_com_scan_bus();
+    for (i = 0; i < tpl_posix_com_peer_count; i++)
+    {
+        if ((sendto(tpl_posix_com_fd, tpl_posix_com_datagram, size, 0,
+                    (struct sockaddr *)&tpl_posix_com_peers[i],
+                    sizeof(tpl_posix_com_peers[i])) == -1) &&
+            (errno == ECONNREFUSED))
+        {
+            unlink(tpl_posix_com_peers[i].sun_path);
+        }
+    }
+}
+
+FUNC(void, OS_CODE) tpl_posix_com_socket_init(void)
+{
+    char name[32];
+
+    tpl_posix_com_bus = getenv("TPL_COM_BUS");
+    if (tpl_posix_com_bus == NULL)
+    {
+        tpl_posix_com_bus = TPL_POSIX_COM_BUS_DEFAULT;
+    }
+    if ((mkdir(tpl_posix_com_bus, 0777) == -1) && (errno != EEXIST))
+    {
+        perror("tpl_posix_com_socket_init: bus directory");
+        exit(-1);
+    }
+
+    snprintf(name, sizeof(name), "%d", (int)getpid());
+    if (!tpl_posix_com_set_path(&tpl_posix_com_addr, name))
+    {
+        fprintf(stderr, "tpl_posix_com_socket_init: bus path too long\n");
+        exit(-1);
+    }
+    unlink(tpl_posix_com_addr.sun_path);
+
+    tpl_posix_com_fd = socket(AF_UNIX, SOCK_DGRAM, 0);
+    if ((tpl_posix_com_fd == -1) ||
+        (bind(tpl_posix_com_fd, (struct sockaddr *)&tpl_posix_com_addr,
+              sizeof(tpl_posix_com_addr)) == -1))
+    {
+        perror("tpl_posix_com_socket_init: socket");
+        exit(-1);
+    }
+    atexit(tpl_posix_com_exit);
+
+    /* non blocking, SIGIO is sent to the process when a datagram arrives */
+    if ((fcntl(tpl_posix_com_fd, F_SETOWN, getpid()) == -1) ||
+        (fcntl(tpl_posix_com_fd, F_SETFL, O_NONBLOCK | O_ASYNC) == -1))
+    {
+        perror("tpl_posix_com_socket_init: fcntl");
+        exit(-1);
+    }
+}
+
+FUNC(tpl_status, OS_CODE) tpl_posix_com_socket_send(
+  CONSTP2CONST(tpl_sending_ipdu, AUTOMATIC, OS_CONST) *ipdus,
+  CONST(uint16, AUTOMATIC) count)
+{
+    size_t size = 0;
+    uint16 i;
+
+    for (i = 0; i < count; i++)
+    {
+        tpl_posix_com_header header;
+        size_t ipdu_size = sizeof(header) + ipdus[i]->size;
+
+        if ((size > 0) && (size + ipdu_size > TPL_POSIX_COM_DATAGRAM_SIZE))
+        {
+            tpl_posix_com_broadcast(size);
+            size = 0;
+        }
+        if (ipdu_size <= TPL_POSIX_COM_DATAGRAM_SIZE)
+        {
+            header.id = ipdus[i]->id;
+            header.size = ipdus[i]->size;
+            memcpy(tpl_posix_com_datagram + size, &header, sizeof(header));
+            memcpy(tpl_posix_com_datagram + size + sizeof(header),
+                   ipdus[i]->buffer, ipdus[i]->size);
+            size += ipdu_size;
+        }
+    }
+    if (size > 0)
+    {
+        tpl_posix_com_broadcast(size);
+    }
+    return E_OK;
+}
+
+/*
+ * SIGIO handler, called with the interrupts disabled. All the pending
+ * datagrams are read, then the receivers are scheduled.
+ */
+void tpl_posix_com_socket_handler(void)
+{
+    unsigned char datagram[TPL_POSIX_COM_DATAGRAM_SIZE];
+    ssize_t size;
+
+    while ((size = recv(tpl_posix_com_fd, datagram, sizeof(datagram), 0)) > 0)
+    {
+        size_t offset = 0;
+        tpl_posix_com_header header;
+
+        while (offset + sizeof(header) <= (size_t)size)
+        {
+            memcpy(&header, datagram + offset, sizeof(header));
+            offset += sizeof(header);
+            if (offset + header.size > (size_t)size)
+            {
+                break;
+            }
+            tpl_com_ipdu_received(header.id, datagram + offset, header.size);
+            offset += header.size;
+        }
+    }
+    tpl_notify_receiving_mos(FROM_IT_LEVEL);
+}
+
+CONST(tpl_ipdu_driver, OS_CONST) tpl_posix_com_socket = {
+    /* initialization function  */ tpl_posix_com_socket_init,
+    /* transmission function    */ tpl_posix_com_socket_send
+};
+
+#endif /* WITH_EXTERNAL_COM */
+
+/* End of file tpl_posix_com_socket.c */
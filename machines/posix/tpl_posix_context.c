@@ -62,9 +62,9 @@ FUNC(void, OS_CODE) tpl_create_context_boot(void)
     context_owner_proc_id = new_proc_id;
 
     /* 12 & 13 : context is ready, jump back to the tpl_create_context */
-    if( 0 == setjmp(tpl_stat_proc_table[context_owner_proc_id]->context->initial) )
+    if( 0 == setjmp(TPL_STAT_PROC(context_owner_proc_id)->context->initial) )
     {
-        longjmp(tpl_stat_proc_table[IDLE_TASK_ID]->context->current, 1);
+        longjmp(TPL_STAT_PROC(IDLE_TASK_ID)->context->current, 1);
     }
 
     /* We are back for the first dispatch. Let's go */
@@ -80,7 +80,7 @@ FUNC(void, OS_CODE) tpl_create_context_boot(void)
 FUNC(void, OS_CODE) tpl_create_context_trampoline(int sigid)
 {
     /* 5 : new context created. We go back to tpl_init_context */
-    if( 0==setjmp(tpl_stat_proc_table[new_proc_id]->context->initial) )
+    if( 0==setjmp(TPL_STAT_PROC(new_proc_id)->context->initial) )
     {
         handler_has_been_triggered = TRUE;
         return;
@@ -124,8 +124,8 @@ FUNC(void, OS_CODE) tpl_create_context(
     sigaction(SIGUSR1, &new_action, &old_action);
 
     /* 3 : prepare the new stack */
-    new_stack.ss_sp = (tpl_stat_proc_table[proc_id]->stack)->stack_zone;
-    new_stack.ss_size = (tpl_stat_proc_table[proc_id]->stack)->stack_size;
+    new_stack.ss_sp = (TPL_STAT_PROC(proc_id)->stack)->stack_zone;
+    new_stack.ss_size = (TPL_STAT_PROC(proc_id)->stack)->stack_size;
     new_stack.ss_flags = 0;
     sigaltstack(&new_stack, &old_stack);
 
@@ -161,8 +161,8 @@ FUNC(void, OS_CODE) tpl_create_context(
      * 7 & 8 : we jump back to the created context.
      * This time, we are no more in signal handling mode
      */
-    if ( 0 == setjmp(tpl_stat_proc_table[IDLE_TASK_ID]->context->current) )
-        longjmp(tpl_stat_proc_table[new_proc_id]->context->initial,1);
+    if ( 0 == setjmp(TPL_STAT_PROC(IDLE_TASK_ID)->context->current) )
+        longjmp(TPL_STAT_PROC(new_proc_id)->context->initial,1);
 
     /*
      * 14 : we go back to the caller
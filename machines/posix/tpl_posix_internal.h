@@ -33,7 +33,13 @@
 extern const int signal_for_counters;
 #endif
 
+#if WITH_EXTERNAL_COM == YES
+extern const int signal_for_com;
+void tpl_posix_com_socket_handler(void);
+#endif
+
 #if WITH_AUTOSAR_TIMING_PROTECTION == YES
+extern const int signal_for_watchdog;
 void tpl_start_tptimer ();
 #endif
 
@@ -42,3 +48,20 @@ void tpl_create_context(tpl_proc_id proc_id);
 void tpl_posix_sigblock(const char* error_message);
 void tpl_posix_sigunblock(const char* error_message);
 void tpl_posix_siginit(void);
+
+void tpl_posix_idle_exit(void);
+
+#if WITH_PAINT_STACK == YES
+void tpl_posix_paint_stack(tpl_proc_id proc_id);
+#if WITH_STACK_SIZING == YES
+void tpl_posix_stack_usage_dump(void);
+#endif
+#endif
+
+#if WITH_POSIX_VIRTUAL_TIME == YES
+void tpl_posix_vtime_init(void);
+void tpl_posix_vtime_jump(void);
+#if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0)
+void tpl_posix_vtime_counter_handler(void);
+#endif
+#endif
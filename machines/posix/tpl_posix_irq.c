@@ -35,6 +35,7 @@
 #include "tpl_app_config.h"
 #include "tpl_os_interrupt_kernel.h"
 #include "tpl_machine_posix.h"
+#include "tpl_posix_internal.h"
 
 #if WITH_AUTOSAR_TIMING_PROTECTION == YES
 #include "tpl_as_timing_protec.h"
@@ -53,6 +54,9 @@ const int signal_for_watchdog = SIGALRM;
 #if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0)
 const int signal_for_counters = SIGUSR2;
 #endif
+#if WITH_EXTERNAL_COM == YES
+const int signal_for_com = SIGIO;
+#endif
 
 extern volatile int tpl_locking_depth;
 extern char tpl_user_task_lock;
@@ -126,10 +130,25 @@ void tpl_signal_handler(int sig)
     tpl_locking_depth++;
     tpl_cpt_os_task_lock++;
 
+    /* the interrupt ends the idle period if the idle task was waiting */
+    tpl_posix_idle_exit();
+
+#if WITH_EXTERNAL_COM == YES
+    if (signal_for_com == sig)
+    {
+        tpl_posix_com_socket_handler();
+    }
+    else
+    {
+#endif /* WITH_EXTERNAL_COM */
 #if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0)
     if (signal_for_counters == sig)
     {
+#if WITH_POSIX_VIRTUAL_TIME == YES
+        tpl_posix_vtime_counter_handler();
+#else
         tpl_call_counter_tick();
+#endif
     }
     else
     {
@@ -173,6 +192,9 @@ void tpl_signal_handler(int sig)
 #if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0)
     }
 #endif /* (defined WITH_AUTOSAR && !defined NO_SCHEDTABLE) || ... */
+#if WITH_EXTERNAL_COM == YES
+    }
+#endif /* WITH_EXTERNAL_COM */
 
     tpl_locking_depth--;
     tpl_cpt_os_task_lock--;
@@ -222,6 +244,9 @@ void tpl_posix_siginit(void)
 #if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0)
     sigaddset(&signal_set,signal_for_counters);
 #endif /*(defined WITH_AUTOSAR && !defined NO_SCHEDTABLE) || ... */
+#if WITH_EXTERNAL_COM == YES
+    sigaddset(&signal_set,signal_for_com);
+#endif /* WITH_EXTERNAL_COM */
 
     /*
      * init the sa structure to install the handler
@@ -243,5 +268,8 @@ void tpl_posix_siginit(void)
 #if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0)
     sigaction(signal_for_counters,&sa,NULL);
 #endif /*(defined WITH_AUTOSAR && !defined NO_SCHEDTABLE) || ... */
+#if WITH_EXTERNAL_COM == YES
+    sigaction(signal_for_com,&sa,NULL);
+#endif /* WITH_EXTERNAL_COM */
 }
 
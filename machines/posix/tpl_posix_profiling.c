@@ -0,0 +1,113 @@
+/**
+ *
+ * @file tpl_posix_profiling.c
+ *
+ * @section descr File description
+ *
+ * Machine dependant part of the service profiling for the posix platform:
+ * time source and JSON export of the profiling table.
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline OS
+ *
+ * Trampoline is copyright (c) IRCCyN 2005+
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the Lesser GNU Public Licence
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include "tpl_app_define.h" /* WITH_SERVICE_PROFILING */
+
+#if WITH_SERVICE_PROFILING == YES
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "tpl_os_profiling.h"
+#include "tpl_machine_interface.h"
+#include "tpl_app_config.h" /* proc_name_table */
+
+#define PROFILING_FILENAME "service_profile.json"
+
+#define OS_START_SEC_CODE
+#include "tpl_memmap.h"
+
+/*
+ * The profiling time is in nanoseconds. It wraps around every 4 seconds,
+ * which is far longer than a service call.
+ */
+FUNC(uint32, OS_CODE) tpl_get_profiling_time(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32)((uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec);
+}
+
+FUNC(void, OS_CODE) tpl_service_profiling_dump(void)
+{
+    FILE *file;
+    uint32 row;
+    uint32 service_id;
+    const char *separator = "";
+
+    file = fopen(PROFILING_FILENAME, "w");
+    if (file == NULL)
+    {
+        perror("[profiling] unable to open profiling file");
+        return;
+    }
+    fprintf(file, "{\n\t\"time_unit\":\"ns\",\n\t\"services\":[");
+    for (row = 0; row < TPL_PROFILING_PROC_COUNT; row++)
+    {
+        for (service_id = 0; service_id < SYSCALL_COUNT; service_id++)
+        {
+            const tpl_service_profile *profile =
+                &tpl_service_profile_table[row][service_id];
+
+            if (profile->count > 0)
+            {
+                fprintf(file,
+                    "%s\n\t\t{\n"
+                    "\t\t\t\"proc\":\"%s\",\n"
+                    "\t\t\t\"service\":\"%s\",\n"
+                    "\t\t\t\"count\":%u,\n"
+                    "\t\t\t\"switch_count\":%u,\n"
+                    "\t\t\t\"total\":%llu,\n"
+                    "\t\t\t\"max\":%u\n"
+                    "\t\t}",
+                    separator,
+                    (row < TASK_COUNT + ISR_COUNT + 1) ?
+                        proc_name_table[row] : "*none*",
+                    tpl_service_name_table[service_id],
+                    (unsigned int)profile->count,
+                    (unsigned int)profile->switch_count,
+                    ((unsigned long long)profile->total_high << 32)
+                        | profile->total_low,
+                    (unsigned int)profile->max);
+                separator = ",";
+            }
+        }
+    }
+    fprintf(file, "\n\t]\n}\n");
+    fclose(file);
+}
+
+#define OS_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+#else /* WITH_SERVICE_PROFILING == YES */
+/* ISO C forbids an empty translation unit */
+typedef int tpl_posix_profiling_unused;
+#endif /* WITH_SERVICE_PROFILING */
+
+/* End of file tpl_posix_profiling.c */
@@ -0,0 +1,117 @@
+/**
+ *
+ * @file tpl_posix_stack.c
+ *
+ * @section descr File description
+ *
+ * Stack painting for the posix platform. The stacks of the processes are
+ * painted once at startup, before their context is created. The stack
+ * high-water mark of a process is found by scanning its stack from the
+ * bottom. When the STACK_SIZING OS attribute is TRUE, the high-water marks
+ * of all the processes are written at shutdown in an OIL file giving the
+ * STACKUSAGE of each task and ISR, and goil sizes the stacks from it.
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline OS
+ *
+ * Trampoline is copyright (c) IRCCyN 2005+
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the Lesser GNU Public Licence
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+#include "tpl_app_define.h" /* WITH_PAINT_STACK, STACK_USAGE_FILE */
+
+#if WITH_PAINT_STACK == YES
+#include <stdio.h>
+
+#include "tpl_os_kernel.h"
+#include "tpl_machine_interface.h"
+#include "tpl_machine_posix.h"
+#include "tpl_app_config.h" /* proc_name_table */
+
+#define OS_START_SEC_CODE
+#include "tpl_memmap.h"
+
+FUNC(void, OS_CODE) tpl_posix_paint_stack(
+    CONST(tpl_proc_id, AUTOMATIC) proc_id)
+{
+    CONSTP2CONST(struct TPL_STACK, AUTOMATIC, OS_VAR) stack =
+        TPL_STAT_PROC(proc_id)->stack;
+    CONST(uint32, AUTOMATIC) size = stack->stack_size / sizeof(tpl_stack_word);
+    VAR(uint32, AUTOMATIC) i;
+
+    for (i = 0; i < size; i++)
+    {
+        stack->stack_zone[i] = OS_STACK_PATTERN;
+    }
+}
+
+FUNC(uint32, OS_CODE) tpl_stack_high_water_mark(
+    CONST(tpl_proc_id, AUTOMATIC) proc_id)
+{
+    CONSTP2CONST(struct TPL_STACK, AUTOMATIC, OS_VAR) stack =
+        TPL_STAT_PROC(proc_id)->stack;
+    CONST(uint32, AUTOMATIC) size = stack->stack_size / sizeof(tpl_stack_word);
+    VAR(uint32, AUTOMATIC) unused = 0;
+
+    /* the stack grows downward, its unused part is at the bottom */
+    while ((unused < size) && (stack->stack_zone[unused] == OS_STACK_PATTERN))
+    {
+        unused++;
+    }
+
+    return (size - unused) * sizeof(tpl_stack_word);
+}
+
+#if WITH_STACK_SIZING == YES
+/*
+ * The file may be included at the end of the OIL file of the application:
+ * its CPU has the name of the CPU of the application so that the objects
+ * are merged with the ones of the application.
+ * Processes sharing the same stack get the high-water mark of the stack.
+ */
+FUNC(void, OS_CODE) tpl_posix_stack_usage_dump(void)
+{
+    FILE *file;
+    tpl_proc_id proc_id;
+
+    file = fopen(STACK_USAGE_FILE, "w");
+    if (file == NULL)
+    {
+        perror("[stack] unable to open the stack usage file");
+        return;
+    }
+    fprintf(file,
+        "/*\n"
+        " * Stack usage measured by Trampoline, in bytes\n"
+        " */\n"
+        "CPU %s {\n", TARGET_CPU);
+    for (proc_id = 0; proc_id < TASK_COUNT + ISR_COUNT; proc_id++)
+    {
+        fprintf(file, "  %s %s { STACKUSAGE = %u; };\n",
+            (proc_id < TASK_COUNT) ? "TASK" : "ISR",
+            proc_name_table[proc_id],
+            (unsigned int)tpl_stack_high_water_mark(proc_id));
+    }
+    fprintf(file, "};\n");
+    fclose(file);
+}
+#endif /* WITH_STACK_SIZING */
+
+#define OS_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+#else /* WITH_PAINT_STACK == YES */
+/* ISO C forbids an empty translation unit */
+typedef int tpl_posix_stack_unused;
+#endif /* WITH_PAINT_STACK */
+
+/* End of file tpl_posix_stack.c */
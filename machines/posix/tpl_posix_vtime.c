@@ -0,0 +1,378 @@
+/**
+ *
+ * @file tpl_posix_vtime.c
+ *
+ * @section descr File description
+ *
+ * Virtual time for the posix platform. Instead of waiting for the
+ * hardware counters to be ticked by viper every 10ms, the idle task
+ * makes the time jump to the next event: the next expiry of a time
+ * object, the next periodic transmission or end of minimum delay of an
+ * IPDU, or the next stimulus read from a file. The tasks and the ISRs
+ * execute in zero virtual time, so a scenario lasting hours runs as fast
+ * as the host can execute the application and the sequence of events is
+ * the same from one run to another.
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline OS
+ *
+ * Trampoline is copyright (c) IRCCyN 2005+
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the Lesser GNU Public Licence
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tpl_app_config.h"
+#include "tpl_os.h"
+#include "tpl_os_kernel.h"
+#include "tpl_os_timeobj_kernel.h"
+#include "tpl_machine_interface.h"
+#include "tpl_machine_posix.h"
+#include "tpl_posix_internal.h"
+#if WITH_EXTERNAL_COM == YES
+#include "tpl_com_external_com.h"
+#endif
+
+#if WITH_POSIX_VIRTUAL_TIME == YES
+
+#define TPL_POSIX_VTIME_NEVER UINT64_MAX
+
+/*
+ * Largest number of ticks applied at once, so that it fits in a tpl_tick
+ */
+#define TPL_POSIX_VTIME_MAX_JUMP 0x7FFFFFFFUL
+
+/*
+ * A stimulus triggers the ISR attached to a signal at a given date
+ */
+typedef struct {
+    uint64_t    date;   /* virtual date in microseconds */
+    int         sig;    /* signal raised at this date   */
+} tpl_posix_stimulus;
+
+/*
+ * Signal names accepted in the stimuli file. They match the SOURCE
+ * attribute of the ISRs.
+ */
+typedef struct {
+    const char  *name;
+    int         sig;
+} tpl_posix_signal_name;
+
+STATIC const tpl_posix_signal_name tpl_posix_signal_names[] = {
+    { "SIGTERM", SIGTERM },
+    { "SIGQUIT", SIGQUIT },
+    { "SIGUSR2", SIGUSR2 },
+    { "SIGPIPE", SIGPIPE },
+    { "SIGTRAP", SIGTRAP }
+};
+
+#define TPL_POSIX_SIGNAL_NAME_COUNT \
+    (sizeof(tpl_posix_signal_names) / sizeof(tpl_posix_signal_names[0]))
+
+STATIC uint64_t tpl_posix_vtime_now = 0;
+STATIC tpl_posix_stimulus *tpl_posix_stimuli = NULL;
+STATIC size_t tpl_posix_stimuli_count = 0;
+STATIC size_t tpl_posix_next_stimulus = 0;
+
+#if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0)
+/*
+ * NULL terminated table of the hardware counters, generated by goil
+ */
+extern CONSTP2VAR(tpl_counter, OS_CONST, OS_VAR) tpl_posix_vtime_counters[];
+
+/*
+ * Number of ticks the counter signal handler has to apply
+ */
+STATIC volatile tpl_tick tpl_posix_vtime_pending_ticks = 0;
+#endif
+
+STATIC int tpl_posix_signal_from_name(const char *name)
+{
+    size_t i;
+    char *end;
+    long sig;
+
+    for (i = 0; i < TPL_POSIX_SIGNAL_NAME_COUNT; i++)
+    {
+        if (strcmp(name, tpl_posix_signal_names[i].name) == 0)
+        {
+            return tpl_posix_signal_names[i].sig;
+        }
+    }
+    sig = strtol(name, &end, 10);
+    if ((*end != '\0') || (sig <= 0))
+    {
+        return -1;
+    }
+    return (int)sig;
+}
+
+STATIC int tpl_posix_stimulus_compare(const void *a, const void *b)
+{
+    const tpl_posix_stimulus *sa = (const tpl_posix_stimulus *)a;
+    const tpl_posix_stimulus *sb = (const tpl_posix_stimulus *)b;
+
+    if (sa->date < sb->date) return -1;
+    if (sa->date > sb->date) return 1;
+    return 0;
+}
+
+/*
+ * Reads the stimuli file. Each line is a date in microseconds followed by
+ * a signal name (or number). Empty lines and lines starting with # are
+ * ignored. The stimuli are sorted by date, stimuli with the same date keep
+ * the order of the file.
+ */
+STATIC void tpl_posix_load_stimuli(const char *file_name)
+{
+    FILE *file;
+    char line[256];
+    char sig_name[64];
+    unsigned long long date;
+    unsigned int line_number = 0;
+    size_t capacity = 0;
+    size_t i;
+
+    if (file_name[0] == '\0')
+    {
+        return;
+    }
+    file = fopen(file_name, "r");
+    if (file == NULL)
+    {
+        perror("[virtual time] unable to open the stimuli file");
+        exit(1);
+    }
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        line_number++;
+        if (sscanf(line, " %63s", sig_name) != 1 || sig_name[0] == '#')
+        {
+            continue;
+        }
+        if (sscanf(line, "%llu %63s", &date, sig_name) != 2)
+        {
+            fprintf(stderr, "[virtual time] %s:%u: syntax error\n",
+                    file_name, line_number);
+            exit(1);
+        }
+        if (tpl_posix_stimuli_count == capacity)
+        {
+            capacity = (capacity == 0) ? 16 : 2 * capacity;
+            tpl_posix_stimuli = realloc(tpl_posix_stimuli,
+                                        capacity * sizeof(tpl_posix_stimulus));
+            if (tpl_posix_stimuli == NULL)
+            {
+                perror("[virtual time] unable to load the stimuli");
+                exit(1);
+            }
+        }
+        tpl_posix_stimuli[tpl_posix_stimuli_count].date = date;
+        tpl_posix_stimuli[tpl_posix_stimuli_count].sig =
+            tpl_posix_signal_from_name(sig_name);
+        if (tpl_posix_stimuli[tpl_posix_stimuli_count].sig < 0)
+        {
+            fprintf(stderr, "[virtual time] %s:%u: unknown signal %s\n",
+                    file_name, line_number, sig_name);
+            exit(1);
+        }
+        tpl_posix_stimuli_count++;
+    }
+    fclose(file);
+
+    /* insertion sort, stable for stimuli sharing the same date */
+    for (i = 1; i < tpl_posix_stimuli_count; i++)
+    {
+        tpl_posix_stimulus current = tpl_posix_stimuli[i];
+        size_t j = i;
+        while (j > 0 &&
+               tpl_posix_stimulus_compare(&tpl_posix_stimuli[j - 1], &current) > 0)
+        {
+            tpl_posix_stimuli[j] = tpl_posix_stimuli[j - 1];
+            j--;
+        }
+        tpl_posix_stimuli[j] = current;
+    }
+}
+
+#if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0)
+/*
+ * Number of ticks until the next time object of a counter expires,
+ * TPL_POSIX_VTIME_NEVER if no time object is active.
+ */
+STATIC uint64_t tpl_posix_ticks_to_expiry(
+    CONSTP2CONST(tpl_counter, AUTOMATIC, OS_VAR) counter)
+{
+    uint64_t dates;
+
+    if (counter->next_to == NULL)
+    {
+        return TPL_POSIX_VTIME_NEVER;
+    }
+    if (counter->next_to->date > counter->current_date)
+    {
+        dates = counter->next_to->date - counter->current_date;
+    }
+    else
+    {
+        /* the date of the time object is after the wrap of the counter */
+        dates = (uint64_t)counter->max_allowed_value
+              - counter->current_date + counter->next_to->date + 1;
+    }
+    return (dates - 1) * counter->ticks_per_base
+         + (counter->ticks_per_base - counter->current_tick);
+}
+#endif
+
+FUNC(void, OS_CODE) tpl_posix_vtime_init(void)
+{
+    tpl_posix_load_stimuli(POSIX_VIRTUAL_TIME_STIMULI);
+}
+
+FUNC(uint64_t, OS_CODE) tpl_posix_virtual_time(void)
+{
+    return tpl_posix_vtime_now;
+}
+
+#if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0)
+FUNC(void, OS_CODE) tpl_posix_vtime_counter_handler(void)
+{
+    CONST(tpl_tick, AUTOMATIC) ticks = tpl_posix_vtime_pending_ticks;
+    uint32 i;
+
+    tpl_posix_vtime_pending_ticks = 0;
+    for (i = 0; tpl_posix_vtime_counters[i] != NULL; i++)
+    {
+        tpl_advance_counter(tpl_posix_vtime_counters[i], ticks);
+    }
+#if WITH_EXTERNAL_COM == YES
+    /*
+     * One COM tick per hardware counter tick, as tpl_call_counter_tick
+     * does. The jump does not go past the next IPDU deadline, so the
+     * ticks are applied one by one only when an IPDU has a deadline.
+     */
+    if (tpl_com_ipdu_next_deadline() != 0)
+    {
+        for (i = 0; i < ticks; i++)
+        {
+            tpl_com_ipdu_tick();
+        }
+    }
+#endif
+    if (tpl_kern.need_schedule)
+    {
+        tpl_schedule_from_running();
+        LOCAL_SWITCH_CONTEXT(0)
+    }
+}
+#endif
+
+/*
+ * Called in a loop by the idle task: nothing is ready, so the virtual time
+ * jumps to the next event. The hardware counters and the IPDUs are
+ * advanced up to this date by raising the counter signal, then the stimuli due at this date
+ * raise their signal. raise() runs the handler before returning because
+ * the interrupt signals are not blocked in the idle task.
+ * When no event remains, nothing can happen anymore and the OS is shut
+ * down.
+ */
+FUNC(void, OS_CODE) tpl_posix_vtime_jump(void)
+{
+    uint64_t next_date = TPL_POSIX_VTIME_NEVER;
+    uint64_t stimulus_date = TPL_POSIX_VTIME_NEVER;
+#if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0)
+    CONST(uint64_t, AUTOMATIC) tick = POSIX_VIRTUAL_TIME_TICK_US;
+    uint64_t ticks = TPL_POSIX_VTIME_NEVER;
+    uint64_t to_expiry;
+    uint32 i;
+
+    for (i = 0; tpl_posix_vtime_counters[i] != NULL; i++)
+    {
+        to_expiry = tpl_posix_ticks_to_expiry(tpl_posix_vtime_counters[i]);
+        if (to_expiry < ticks)
+        {
+            ticks = to_expiry;
+        }
+    }
+#if WITH_EXTERNAL_COM == YES
+    to_expiry = tpl_com_ipdu_next_deadline();
+    if ((to_expiry != 0) && (to_expiry < ticks))
+    {
+        ticks = to_expiry;
+    }
+#endif
+    if (ticks != TPL_POSIX_VTIME_NEVER)
+    {
+        /* the hardware counters tick at multiples of the tick duration */
+        next_date = (tpl_posix_vtime_now / tick + ticks) * tick;
+    }
+#endif
+
+    if (tpl_posix_next_stimulus < tpl_posix_stimuli_count)
+    {
+        stimulus_date = tpl_posix_stimuli[tpl_posix_next_stimulus].date;
+        if (stimulus_date < tpl_posix_vtime_now)
+        {
+            stimulus_date = tpl_posix_vtime_now;
+        }
+    }
+    if (stimulus_date < next_date)
+    {
+        next_date = stimulus_date;
+    }
+
+    if (next_date == TPL_POSIX_VTIME_NEVER)
+    {
+        ShutdownOS(E_OK);
+    }
+
+#if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0)
+    ticks = next_date / tick - tpl_posix_vtime_now / tick;
+    if (ticks > TPL_POSIX_VTIME_MAX_JUMP)
+    {
+        /* far away event, get closer and evaluate again */
+        ticks = TPL_POSIX_VTIME_MAX_JUMP;
+        next_date = (tpl_posix_vtime_now / tick + ticks) * tick;
+    }
+    tpl_posix_vtime_now = next_date;
+    if (ticks > 0)
+    {
+        tpl_posix_vtime_pending_ticks = (tpl_tick)ticks;
+        raise(signal_for_counters);
+    }
+#else
+    tpl_posix_vtime_now = next_date;
+#endif
+
+    /*
+     * If the counter handler switched to a task, raise() returns when the
+     * idle task runs again. The virtual time did not move meanwhile.
+     */
+    if ((stimulus_date == tpl_posix_vtime_now) &&
+        (tpl_posix_next_stimulus < tpl_posix_stimuli_count))
+    {
+        raise(tpl_posix_stimuli[tpl_posix_next_stimulus++].sig);
+    }
+}
+
+#else /* WITH_POSIX_VIRTUAL_TIME == YES */
+/* ISO C forbids an empty translation unit */
+typedef int tpl_posix_vtime_unused;
+#endif /* WITH_POSIX_VIRTUAL_TIME */
+
+/* End of file tpl_posix_vtime.c */
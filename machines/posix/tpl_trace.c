@@ -30,6 +30,9 @@
 #include <stdlib.h> /* exit */
 
 #include "tpl_trace.h"
+#if WITH_POSIX_VIRTUAL_TIME == YES
+#include "tpl_machine_posix.h" /* tpl_posix_virtual_time */
+#endif
 
 #define OS_START_SEC_VAR_POWER_ON_INIT_UNSPECIFIED
 #include "tpl_memmap.h"
@@ -45,9 +48,14 @@ FILE *trace_file = NULL;
 
 FUNC(tpl_tick, OS_CODE) tpl_trace_get_timestamp()
 {
+#if WITH_POSIX_VIRTUAL_TIME == YES
+  /* number of hardware ticks in the virtual time */
+  return (tpl_tick)(tpl_posix_virtual_time() / POSIX_VIRTUAL_TIME_TICK_US);
+#else
   CONSTP2VAR(tpl_counter, AUTOMATIC, OS_APPL_DATA) counter = &SystemCounter_counter_desc;
   tpl_tick timestamp = counter->current_date;
   return timestamp;
+#endif
 }
 
 /* return 1 when the file is opened (first time)*/
@@ -240,4 +248,7 @@ FUNC(void, OS_CODE) tpl_trace_event_reset(
 #define OS_STOP_SEC_CODE
 #include "tpl_memmap.h"
 
+#else /* WITH_TRACE == YES */
+/* ISO C forbids an empty translation unit */
+typedef int tpl_trace_unused;
 #endif /* WITH_TRACE == YES  */
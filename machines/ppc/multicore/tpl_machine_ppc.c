@@ -466,6 +466,50 @@ FUNC(void, OS_CODE) tpl_try_to_get_lock(
 }
 
 
+/**
+ * @internal
+ *
+ * The ticket and MCS spinlocks update their lock words with
+ * tpl_compare_and_swap_lock (see tpl_multicore.s), which uses the
+ * reservation of the lock word (lwarx/stwcx.). They do not take the
+ * hardware gate, so two spinlocks are updated independently.
+ */
+FUNC(tpl_lock, OS_CODE) tpl_fetch_and_increment_lock(
+  CONSTP2VAR(tpl_lock, AUTOMATIC, OS_VAR) lock)
+{
+  VAR(tpl_lock, AUTOMATIC) previous;
+
+  do
+  {
+    previous = *(volatile tpl_lock *)lock;
+  } while (FALSE == tpl_compare_and_swap_lock(lock,
+                                              previous,
+                                              (tpl_lock)(previous + 1)));
+
+  return previous;
+}
+
+
+/**
+ * @internal
+ *
+ * @see #tpl_fetch_and_increment_lock
+ */
+FUNC(tpl_lock, OS_CODE) tpl_swap_lock(
+  CONSTP2VAR(tpl_lock, AUTOMATIC, OS_VAR) lock,
+  CONST(tpl_lock, AUTOMATIC) value)
+{
+  VAR(tpl_lock, AUTOMATIC) previous;
+
+  do
+  {
+    previous = *(volatile tpl_lock *)lock;
+  } while (FALSE == tpl_compare_and_swap_lock(lock, previous, value));
+
+  return previous;
+}
+
+
 /**
  * @internal
  *
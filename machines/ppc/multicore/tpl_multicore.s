@@ -62,6 +62,27 @@ TPL_TYPE(TPL_GLOBAL_REF(tpl_get_core_id),@function)
 TPL_SIZE(TPL_GLOBAL_REF(tpl_get_core_id),$-TPL_GLOBAL_REF(tpl_get_core_id))
 
 
+/** ===========================================================================
+ * tpl_memory_barrier
+ * \brief   order the memory accesses before and after the call for the
+ *          other core
+ */
+TPL_GLOBAL(tpl_memory_barrier)
+TPL_GLOBAL_REF(tpl_memory_barrier):
+/* ------------ VLE ---------------------------------------------------------*/
+#if (WITH_VLE == YES)
+  msync
+  se_blr
+/* ------------ NO VLE ------------------------------------------------------*/
+#else
+  msync
+  blr
+#endif
+  FUNCTION(TPL_GLOBAL_REF(tpl_memory_barrier))
+TPL_TYPE(TPL_GLOBAL_REF(tpl_memory_barrier),@function)
+TPL_SIZE(TPL_GLOBAL_REF(tpl_memory_barrier),$-TPL_GLOBAL_REF(tpl_memory_barrier))
+
+
 /** ===========================================================================
  * tpl_get_kernel_lock
  * \brief   get the kernel lock
@@ -136,6 +157,87 @@ TPL_SIZE(TPL_GLOBAL_REF(tpl_release_kernel_lock),$-TPL_GLOBAL_REF(tpl_release_ke
 
 
 
+/** ===========================================================================
+ * tpl_compare_and_swap_lock
+ * \brief   write a lock word if it holds the expected value
+ * @param r3 = address of the lock word (a tpl_lock, 16 bits)
+ * @param r4 = expected value
+ * @param r5 = value to write
+ * @ret r3 = 1 if the lock word has been written, 0 otherwise
+ *
+ * The reservation granule is a word, so the word holding the lock word is
+ * reserved and only its 16 bits are compared and replaced. A failed stwcx.
+ * means the word has been written by the other core, the comparison is
+ * done again. The msync orders the previous accesses before the write and
+ * the isync keeps the following ones after it.
+ */
+TPL_GLOBAL(tpl_compare_and_swap_lock)
+TPL_GLOBAL_REF(tpl_compare_and_swap_lock):
+/* ------------ VLE ---------------------------------------------------------*/
+#if (WITH_VLE == YES)
+  /* r6 : shift of the lock word in the word, 16 at offset 0, 0 at offset 2 */
+  e_rlwinm  r6,r3,3,27,27
+  e_xori    r6,r6,16
+  /* r7 : address of the word */
+  e_rlwinm  r7,r3,0,0,29
+  /* r8 : mask, r4 : expected, r5 : value, in place in the word */
+  e_li      r8,-1
+  e_rlwinm  r8,r8,0,16,31
+  slw       r8,r8,r6
+  e_rlwinm  r4,r4,0,16,31
+  slw       r4,r4,r6
+  e_rlwinm  r5,r5,0,16,31
+  slw       r5,r5,r6
+  msync
+tpl_compare_and_swap_lock_retry :
+  lwarx     r9,0,r7
+  and       r10,r9,r8
+  cmpw      r10,r4
+  e_bne     tpl_compare_and_swap_lock_fail
+  andc      r9,r9,r8
+  or        r9,r9,r5
+  stwcx.    r9,0,r7
+  e_bne     tpl_compare_and_swap_lock_retry
+  se_isync
+  e_li      r3,1
+  se_blr
+tpl_compare_and_swap_lock_fail :
+  e_li      r3,0
+  se_blr
+/* ------------ NO VLE ------------------------------------------------------*/
+#else
+  rlwinm    r6,r3,3,27,27
+  xori      r6,r6,16
+  rlwinm    r7,r3,0,0,29
+  li        r8,-1
+  rlwinm    r8,r8,0,16,31
+  slw       r8,r8,r6
+  rlwinm    r4,r4,0,16,31
+  slw       r4,r4,r6
+  rlwinm    r5,r5,0,16,31
+  slw       r5,r5,r6
+  msync
+tpl_compare_and_swap_lock_retry :
+  lwarx     r9,0,r7
+  and       r10,r9,r8
+  cmpw      r10,r4
+  bne       tpl_compare_and_swap_lock_fail
+  andc      r9,r9,r8
+  or        r9,r9,r5
+  stwcx.    r9,0,r7
+  bne       tpl_compare_and_swap_lock_retry
+  isync
+  li        r3,1
+  blr
+tpl_compare_and_swap_lock_fail :
+  li        r3,0
+  blr
+#endif
+  FUNCTION(TPL_GLOBAL_REF(tpl_compare_and_swap_lock))
+TPL_TYPE(TPL_GLOBAL_REF(tpl_compare_and_swap_lock),@function)
+TPL_SIZE(TPL_GLOBAL_REF(tpl_compare_and_swap_lock),$-TPL_GLOBAL_REF(tpl_compare_and_swap_lock))
+
+
 #define OS_STOP_SEC_CODE
 #include "tpl_as_memmap.h"
 #endif /* if WITH_MULTICORE == YES */
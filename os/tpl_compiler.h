@@ -81,6 +81,18 @@
   #error "Configuration error WITH_COMPILER_SETTINGS is not defined"
 #endif
 
+/*
+ * TPL_ALIGNED aligns a variable on a given number of bytes. It is used to
+ * put the data accessed by the scheduler at the start of a cache line.
+ */
+#ifndef TPL_ALIGNED
+#if defined(__GNUC__)
+#define TPL_ALIGNED(size) __attribute__((aligned(size)))
+#else
+#define TPL_ALIGNED(size)
+#endif
+#endif
+
 /* TPL_COMPILER_H */
 #endif
 
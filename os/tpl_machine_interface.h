@@ -207,6 +207,19 @@ extern FUNC(void, OS_CODE) tpl_cancel_tpwatchdog(void);
 extern FUNC(tpl_time, OS_CODE) tpl_get_tptimer(void);
 #endif /* WITH_AUTOSAR_TIMING_PROTECTION */
 
+#if WITH_SERVICE_PROFILING == YES
+/**
+ * @internal
+ *
+ * Gives the current date used to profile the services, in a machine
+ * dependant unit (cycles if available). Only differences between two dates
+ * are used, so the value may wrap around.
+ *
+ * @return the current date when called
+ */
+extern FUNC(uint32, OS_CODE) tpl_get_profiling_time(void);
+#endif /* WITH_SERVICE_PROFILING */
+
 #if WITH_STACK_MONITORING == YES
 /**
  * @internal
@@ -249,6 +262,23 @@ FUNC(uint8, OS_CODE) tpl_check_stack_footprint(
   CONST(tpl_proc_id, AUTOMATIC) proc_id);
 #endif /* WITH_AUTOSAR_STACK_MONITORING */
 
+#if WITH_PAINT_STACK == YES
+/**
+ * @internal
+ *
+ * Scans the painted stack of a process from its bottom and gives the
+ * highest number of bytes used since the stack has been painted. The posix
+ * port paints the stacks once at startup, the cortex port paints a stack
+ * at each activation of its process.
+ *
+ * @param proc_id is the id of the process (task or ISR)
+ *
+ * @return the stack high-water mark in bytes
+ */
+FUNC(uint32, OS_CODE) tpl_stack_high_water_mark(
+  CONST(tpl_proc_id, AUTOMATIC) proc_id);
+#endif /* WITH_PAINT_STACK */
+
 #if NUMBER_OF_CORES > 1
 
 /**
@@ -285,6 +315,61 @@ FUNC(void, OS_CODE) tpl_get_lock(
 FUNC(void, OS_CODE) tpl_release_lock(
   CONSTP2VAR(tpl_lock, AUTOMATIC, OS_VAR) lock);
 
+/**
+ * @internal
+ *
+ * tpl_fetch_and_increment_lock atomically increments a lock word. It is
+ * used by the ticket spinlocks.
+ *
+ * @param lock  the lock word
+ *
+ * @return the value of the lock word before the increment
+ */
+FUNC(tpl_lock, OS_CODE) tpl_fetch_and_increment_lock(
+  CONSTP2VAR(tpl_lock, AUTOMATIC, OS_VAR) lock);
+
+/**
+ * @internal
+ *
+ * tpl_swap_lock atomically writes a lock word and gives its previous value.
+ * It is used by the MCS spinlocks.
+ *
+ * @param lock  the lock word
+ * @param value the value to write
+ *
+ * @return the value of the lock word before the write
+ */
+FUNC(tpl_lock, OS_CODE) tpl_swap_lock(
+  CONSTP2VAR(tpl_lock, AUTOMATIC, OS_VAR) lock,
+  CONST(tpl_lock, AUTOMATIC) value);
+
+/**
+ * @internal
+ *
+ * tpl_compare_and_swap_lock atomically writes a lock word if it holds the
+ * expected value. It is used by the ticket and MCS spinlocks.
+ *
+ * @param lock      the lock word
+ * @param expected  the value the lock word should hold
+ * @param value     the value to write
+ *
+ * @retval TRUE     the lock word held expected and has been written
+ * @retval FALSE    the lock word did not hold expected and is unchanged
+ */
+FUNC(tpl_bool, OS_CODE) tpl_compare_and_swap_lock(
+  CONSTP2VAR(tpl_lock, AUTOMATIC, OS_VAR) lock,
+  CONST(tpl_lock, AUTOMATIC) expected,
+  CONST(tpl_lock, AUTOMATIC) value);
+
+/**
+ * @internal
+ *
+ * tpl_memory_barrier orders the memory accesses: the accesses done before
+ * the call are visible to the other cores before the accesses done after
+ * it. It is used by the lock-free IOC.
+ */
+FUNC(void, OS_CODE) tpl_memory_barrier(void);
+
 #endif
 
 #define OS_STOP_SEC_CODE
@@ -80,7 +80,12 @@ FUNC(void, OS_CODE) tpl_raise_alarm(
     stat_alarm->action;
 
   /*  Call the action                                     */
+#if WITH_ALARM_ACTIVATETASK_ONLY == YES
+  /*  every alarm activates a task, no need for the pointer */
+  tpl_action_activate_task(action_desc);
+#else
   (action_desc->action)(action_desc) ;
+#endif
 }
 
 
@@ -306,6 +306,16 @@
  */
 #define E_OS_NO_DATA              30
 
+/**
+ * @def E_OS_STM_RETRY
+ *
+ * STM-HRT
+ * This status is returned when committing a transaction which has read an
+ * object updated by another transaction. The transaction has not been
+ * committed and has to be executed again. The second execution cannot fail.
+ */
+#define E_OS_STM_RETRY            31
+
 /************************************
  * Public states of a task or ISR2  *
  ************************************/
@@ -32,6 +32,8 @@
 #include "tpl_service_ids.h"
 #endif
 
+#include "tpl_os_profiling.h"
+
 #if WITH_AUTOSAR == YES
 #include "tpl_os_timeobj_kernel.h"
 #include "tpl_as_application.h"
@@ -742,9 +744,11 @@ extern VAR(tpl_service_call_desc, OS_VAR) tpl_service;
  */
 #if (WITH_ERROR_HOOK == YES) && (WITH_USEGETSERVICEID == YES)
 #   define STORE_SERVICE(service)   \
-    tpl_service.service_id = (service);
+    tpl_service.service_id = (service); \
+    PROFILE_SERVICE(service)
 #else
-#   define STORE_SERVICE(service)
+#   define STORE_SERVICE(service)   \
+    PROFILE_SERVICE(service)
 #endif
 
 /**
@@ -1056,24 +1060,28 @@ tpl_service.parameters.id.spinlock_id = (spinlockid);
  * @def LOCK_KERNEL
  *
  * This macro locks the kernel when WITH_SYSTEM_CALL is not
- * defined. If WITH_SYSTEM_CALL is defined it does nothing
+ * defined. If WITH_SYSTEM_CALL is defined it does nothing.
+ * It also starts the profiling of the kernel entry when
+ * WITH_SERVICE_PROFILING is defined.
  */
 #if WITH_SYSTEM_CALL == YES
-#define LOCK_KERNEL()
+#define LOCK_KERNEL() PROFILE_KERNEL_ENTER()
 #else
-#define LOCK_KERNEL() tpl_get_task_lock();
+#define LOCK_KERNEL() tpl_get_task_lock(); PROFILE_KERNEL_ENTER()
 #endif
 
 /**
  * @def UNLOCK_KERNEL
  *
  * This macro unlocks the kernel when WITH_SYSTEM_CALL is not
- * defined. If WITH_SYSTEM_CALL is defined it does nothing
+ * defined. If WITH_SYSTEM_CALL is defined it does nothing.
+ * It also ends the profiling of the kernel entry when
+ * WITH_SERVICE_PROFILING is defined.
  */
 #if WITH_SYSTEM_CALL == YES
-#define UNLOCK_KERNEL()
+#define UNLOCK_KERNEL() PROFILE_KERNEL_EXIT()
 #else
-#define UNLOCK_KERNEL() tpl_release_task_lock();
+#define UNLOCK_KERNEL() PROFILE_KERNEL_EXIT() tpl_release_task_lock();
 #endif
 
 /**
@@ -1229,7 +1237,7 @@ tpl_service.parameters.id.spinlock_id = (spinlockid);
 #if WITH_OS_EXTENDED == YES
 # define CHECK_NOT_EXTENDED_TASK_ERROR(task_id,result)            \
   if ((result == (tpl_status)E_OK) &&                             \
-      (tpl_stat_proc_table[task_id]->type !=                      \
+      (TPL_STAT_PROC(task_id)->type !=                            \
       (tpl_proc_type)TASK_EXTENDED))                              \
   {                                                               \
     result = (tpl_status)E_OS_ACCESS;                             \
@@ -1275,7 +1283,7 @@ tpl_service.parameters.id.spinlock_id = (spinlockid);
 #if WITH_OS_EXTENDED == YES
 # define CHECK_SUSPENDED_TASK_ERROR(task_id,result)                            \
   if ((result == (tpl_status)E_OK) &&                                          \
-      (tpl_dyn_proc_table[task_id]->state == (tpl_proc_state)SUSPENDED))  \
+      (TPL_DYN_PROC(task_id)->state == (tpl_proc_state)SUSPENDED))        \
   {                                                                            \
     result = (tpl_status)E_OS_STATE;                                           \
   }
@@ -1283,6 +1291,32 @@ tpl_service.parameters.id.spinlock_id = (spinlockid);
 # define CHECK_SUSPENDED_TASK_ERROR(task_id,result)
 #endif
 
+/**
+ * @def CHECK_SUSPENDED_NOT_REQUESTED_TASK_ERROR
+ *
+ * Same as CHECK_SUSPENDED_TASK_ERROR but in multicore a suspended task
+ * whose activation has been requested from another core is considered as
+ * activated. Used by SetEvent.
+ *
+ * @param task_id task (#TaskType) to check
+ * @param result error code to set if check fails (#StatusType)
+ *
+ * @note error code is not set if it does not equal E_OK
+ * @note checking is disabled when WITH_OS_EXTENDED == NO
+ */
+#if (WITH_OS_EXTENDED == YES) && (NUMBER_OF_CORES > 1) && (TASK_COUNT > 0)
+# define CHECK_SUSPENDED_NOT_REQUESTED_TASK_ERROR(task_id,result)              \
+  if ((result == (tpl_status)E_OK) &&                                          \
+      (TPL_DYN_PROC(task_id)->state == (tpl_proc_state)SUSPENDED) &&           \
+      (tpl_remote_requests[task_id].activations == 0))                         \
+  {                                                                            \
+    result = (tpl_status)E_OS_STATE;                                           \
+  }
+#else
+# define CHECK_SUSPENDED_NOT_REQUESTED_TASK_ERROR(task_id,result)              \
+  CHECK_SUSPENDED_TASK_ERROR(task_id,result)
+#endif
+
 
 /**
  * @def CHECK_RUNNING_OWNS_REZ_ERROR
@@ -1658,7 +1692,7 @@ tpl_service.parameters.id.spinlock_id = (spinlockid);
     CONST(uint8, AUTOMATIC) byte_idx = obj_id >> 3;            \
     extern CONSTP2CONST(tpl_app_access, AUTOMATIC, OS_APPL_CONST) tpl_app_table[APP_COUNT]; \
     CONSTP2CONST(tpl_app_access, AUTOMATIC, OS_APPL_CONST) app_access = \
-      tpl_app_table[tpl_stat_proc_table[TPL_KERN(a_core_id).running_id]->app_id];  \
+      tpl_app_table[TPL_STAT_PROC(TPL_KERN(a_core_id).running_id)->app_id];        \
     if ( (((app_access->access_vec[OBJECT_TASK][byte_idx]) >> bit_shift) & 0x1)\
           == NO_ACCESS )                                                \
     {                                                                   \
@@ -1702,7 +1736,7 @@ tpl_service.parameters.id.spinlock_id = (spinlockid);
 		CONST(uint8, AUTOMATIC) byte_idx = obj_id >> 3;            \
 		extern CONSTP2CONST(tpl_app_access, AUTOMATIC, OS_APPL_CONST) tpl_app_table[APP_COUNT];	\
         CONSTP2CONST(tpl_app_access, AUTOMATIC, OS_APPL_CONST) app_access =   \
-            tpl_app_table[tpl_stat_proc_table[TPL_KERN(a_core_id).running_id]->app_id];  \
+            tpl_app_table[TPL_STAT_PROC(TPL_KERN(a_core_id).running_id)->app_id];        \
 		if ( (((app_access->access_vec[OBJECT_ALARM][byte_idx]) >> bit_shift) & 0x1) \
                 == NO_ACCESS )                  \
 		{                                                                         \
@@ -1747,7 +1781,7 @@ tpl_service.parameters.id.spinlock_id = (spinlockid);
     extern CONSTP2CONST(tpl_app_access, AUTOMATIC, OS_APPL_CONST)       \
       tpl_app_table[APP_COUNT];                                         \
     CONSTP2CONST(tpl_app_access, AUTOMATIC, OS_APPL_CONST) app_access = \
-      tpl_app_table[tpl_stat_proc_table[TPL_KERN(a_core_id).running_id]->app_id];  \
+      tpl_app_table[TPL_STAT_PROC(TPL_KERN(a_core_id).running_id)->app_id];        \
 		if ( (((app_access->access_vec[OBJECT_RESOURCE][byte_idx]) >> bit_shift) & 0x1) \
                 == NO_ACCESS )             \
 		{                                                                       \
@@ -1791,7 +1825,7 @@ tpl_service.parameters.id.spinlock_id = (spinlockid);
     CONST(uint8, AUTOMATIC) byte_idx = obj_id >> 3;                 \
     extern CONSTP2CONST(tpl_app_access, AUTOMATIC, OS_APPL_CONST) tpl_app_table[APP_COUNT];	\
     CONSTP2CONST(tpl_app_access, AUTOMATIC, OS_APPL_CONST) app_access =   \
-      tpl_app_table[tpl_stat_proc_table[TPL_KERN(a_core_id).running_id]->app_id];  \
+      tpl_app_table[TPL_STAT_PROC(TPL_KERN(a_core_id).running_id)->app_id];        \
 		if ( (((app_access->access_vec[OBJECT_COUNTER][byte_idx]) >> bit_shift) & 0x1) \
                 == NO_ACCESS )            \
 		{                                                                      \
@@ -1835,7 +1869,7 @@ tpl_service.parameters.id.spinlock_id = (spinlockid);
     CONST(uint8, AUTOMATIC) byte_idx = obj_id >> 3;              \
     extern CONSTP2CONST(tpl_app_access, AUTOMATIC, OS_APPL_CONST) tpl_app_table[APP_COUNT]; \
     CONSTP2CONST(tpl_app_access, AUTOMATIC, OS_APPL_CONST) app_access = \
-    tpl_app_table[tpl_stat_proc_table[TPL_KERN(a_core_id).running_id]->app_id];    \
+    tpl_app_table[TPL_STAT_PROC(TPL_KERN(a_core_id).running_id)->app_id];          \
     if ( (((app_access->access_vec[OBJECT_SCHEDULETABLE][byte_idx]) >> bit_shift) & 0x1)\
              == NO_ACCESS )            \
     {                                                                   \
@@ -1879,7 +1913,7 @@ tpl_service.parameters.id.spinlock_id = (spinlockid);
     CONST(uint8, AUTOMATIC) byte_idx = obj_id >> 3;            \
     extern CONSTP2CONST(tpl_app_access, AUTOMATIC, OS_APPL_CONST) tpl_app_table[APP_COUNT]; \
     CONSTP2CONST(tpl_app_access, AUTOMATIC, OS_APPL_CONST) app_access = \
-      tpl_app_table[tpl_stat_proc_table[TPL_KERN(a_core_id).running_id]->app_id];  \
+      tpl_app_table[TPL_STAT_PROC(TPL_KERN(a_core_id).running_id)->app_id];        \
     if ( (((app_access->access_vec[OBJECT_SPINLOCK][byte_idx]) >> bit_shift) & 0x1) \
             == NO_ACCESS )                                              \
     {                                                                   \
@@ -2022,7 +2056,7 @@ result = E_OS_ACCESS;                                               \
     CONST(uint8, AUTOMATIC) byte_idx = obj_id >> 3;            \
     extern CONSTP2CONST(tpl_app_access, AUTOMATIC, OS_APPL_CONST) tpl_app_table[APP_COUNT]; \
     CONSTP2CONST(tpl_app_access, AUTOMATIC, OS_APPL_CONST) app_access = \
-      tpl_app_table[tpl_stat_proc_table[TPL_KERN(a_core_id).running_id]->app_id];  \
+      tpl_app_table[TPL_STAT_PROC(TPL_KERN(a_core_id).running_id)->app_id];        \
     if ( (((app_access->access_vec[OBJECT_IOC_SENDER][byte_idx]) >> bit_shift) & 0x1) \
             == NO_ACCESS )                                              \
     {                                                                   \
@@ -2060,7 +2094,7 @@ result = E_OS_ACCESS;                                               \
     CONST(uint8, AUTOMATIC) byte_idx = obj_id >> 3;            \
     extern CONSTP2CONST(tpl_app_access, AUTOMATIC, OS_APPL_CONST) tpl_app_table[APP_COUNT]; \
     CONSTP2CONST(tpl_app_access, AUTOMATIC, OS_APPL_CONST) app_access = \
-      tpl_app_table[tpl_stat_proc_table[TPL_KERN(a_core_id).running_id]->app_id];  \
+      tpl_app_table[TPL_STAT_PROC(TPL_KERN(a_core_id).running_id)->app_id];        \
     if ( (((app_access->access_vec[OBJECT_IOC_RECEIVER][byte_idx]) >> bit_shift) & 0x1) \
             == NO_ACCESS )                                              \
     {                                                                   \
@@ -77,16 +77,26 @@ FUNC(tpl_status, OS_CODE) tpl_set_event_service(
   /*  checks the task is an extended one  */
   CHECK_NOT_EXTENDED_TASK_ERROR(task_id,result)
   /*  checks the task is not in the SUSPENDED state   */
-  CHECK_SUSPENDED_TASK_ERROR(task_id,result)
+  CHECK_SUSPENDED_NOT_REQUESTED_TASK_ERROR(task_id,result)
 
 #if EXTENDED_TASK_COUNT > 0
   IF_NO_EXTENDED_ERROR(result)
   {
-    result = tpl_set_event(task_id, event);
-    if (result == E_OK && TPL_KERN(proc_core_id).need_schedule)
+#if NUMBER_OF_CORES > 1
+    if (proc_core_id != core_id)
     {
-      tpl_schedule_from_running(CORE_ID_OR_NOTHING(proc_core_id));
-      SWITCH_CONTEXT(CORE_ID_OR_NOTHING(proc_core_id))
+      /* the core of the task sets the events and reschedules */
+      result = tpl_request_remote_event(task_id, event);
+    }
+    else
+#endif
+    {
+      result = tpl_set_event(task_id, event);
+      if (result == E_OK && TPL_KERN(proc_core_id).need_schedule)
+      {
+        tpl_schedule_from_running(CORE_ID_OR_NOTHING(proc_core_id));
+        SWITCH_CONTEXT(CORE_ID_OR_NOTHING(proc_core_id))
+      }
     }
   }
 #endif
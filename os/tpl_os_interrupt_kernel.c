@@ -286,12 +286,12 @@ STATIC FUNC(void, OS_CODE) tpl_activate_isr(
   CONST(tpl_isr_id, AUTOMATIC) isr_id)
 {
   CONSTP2VAR(tpl_proc, AUTOMATIC, OS_APPL_DATA) isr =
-    tpl_dyn_proc_table[isr_id];
+    TPL_DYN_PROC(isr_id);
   /*
    * MISRA RULE 33 VIOLATION: the right statement does
    * not need to be executed if the first test fails
    */
-  if ((isr->activate_count < tpl_stat_proc_table[isr_id]->max_activate_count)
+  if ((isr->activate_count < TPL_STAT_PROC(isr_id)->max_activate_count)
 #if WITH_AUTOSAR == YES
       && (tpl_is_isr2_enabled(isr_id))
 #endif
@@ -464,7 +464,7 @@ FUNC(void, OS_CODE) tpl_mask_isr2_priority(
   CONST(tpl_proc_id, AUTOMATIC) proc_id)
 {
   CONST(tpl_priority, AUTOMATIC) index =
-    tpl_stat_proc_table[proc_id]->base_priority - ISR2_LOWEST_PRIO;
+    TPL_STAT_PROC(proc_id)->base_priority - ISR2_LOWEST_PRIO;
   tpl_disable_table[index]();
 }
 
@@ -480,7 +480,7 @@ extern FUNC(void, OS_CODE) tpl_unmask_isr2_priority(
   CONST(tpl_proc_id, AUTOMATIC) proc_id)
 {
   CONST(tpl_priority, AUTOMATIC) index =
-    tpl_stat_proc_table[proc_id]->base_priority - ISR2_LOWEST_PRIO;
+    TPL_STAT_PROC(proc_id)->base_priority - ISR2_LOWEST_PRIO;
   tpl_enable_table[index]();
 }
 
@@ -54,6 +54,9 @@
 #if ((WITH_IOC == YES) && (IOC_UNQUEUED_COUNT > 0))
 # include "tpl_ioc_unqueued_kernel.h"
 #endif
+#if ((WITH_COM == YES) && (WITH_EXTERNAL_COM == YES))
+# include "tpl_com_external_com.h"
+#endif
 #if SPINLOCK_COUNT > 0
 # include "tpl_as_spinlock_kernel.h"
 #endif
@@ -148,6 +151,20 @@ VAR(tpl_internal_resource, OS_VAR) INTERNAL_RES_SCHEDULER = {
     FALSE
 };
 
+#if (NUMBER_OF_CORES > 1) && (TASK_COUNT > 0)
+/**
+ * Activations and events requested for each task from another core.
+ * Indexes of this table are the tasks' identifiers.
+ */
+VAR(tpl_remote_request, OS_VAR) tpl_remote_requests[TASK_COUNT];
+
+/**
+ * Request queue of each core. Like the rest of the kernel data, they are
+ * accessed with the kernel lock held.
+ */
+VAR(tpl_request_queue, OS_VAR) tpl_request_queues[NUMBER_OF_CORES];
+#endif
+
 #define OS_STOP_SEC_VAR_UNSPECIFIED
 #include "tpl_memmap.h"
 
@@ -226,6 +243,7 @@ FUNC(int, OS_CODE) tpl_compare_entries(
   CONSTP2CONST(tpl_heap_entry, AUTOMATIC, OS_VAR) second_entry
   TAIL_FOR_PRIO_ARG_DECL(tail_for_prio))
 {
+#if WITH_READY_LIST_RANK == YES
   VAR(uint32, AUTOMATIC) first_key = first_entry->key & (PRIORITY_MASK | RANK_MASK);
   VAR(uint32, AUTOMATIC) second_key = second_entry->key & (PRIORITY_MASK | RANK_MASK);
   VAR(uint32, AUTOMATIC) first_tmp ;
@@ -244,6 +262,14 @@ FUNC(int, OS_CODE) tpl_compare_entries(
   second_key = second_key | second_tmp;
 
   return (first_key < second_key);
+#else
+  /*
+   * There is at most one job per priority level, the rank is useless
+   * and the priorities are compared directly.
+   */
+  return ((first_entry->key & PRIORITY_MASK) <
+          (second_entry->key & PRIORITY_MASK));
+#endif
 }
 
 /*
@@ -344,7 +370,7 @@ FUNC(void, OS_CODE) tpl_put_new_proc(
 
   VAR(tpl_priority, AUTOMATIC) dyn_prio;
   CONST(tpl_priority, AUTOMATIC) prio =
-    tpl_stat_proc_table[proc_id]->base_priority;
+    TPL_STAT_PROC(proc_id)->base_priority;
   /*
    * add the new entry at the end of the ready list
    */
@@ -384,7 +410,7 @@ FUNC(void, OS_CODE) tpl_put_preempted_proc(
   VAR(uint32, AUTOMATIC) index = (uint32)(++(READY_LIST(ready_list)[0].key));
 
   CONST(tpl_priority, AUTOMATIC) dyn_prio =
-    tpl_dyn_proc_table[proc_id]->priority;
+    TPL_DYN_PROC(proc_id)->priority;
 
   DOW_DO(printf("put preempted %s, %d\n",proc_name_table[proc_id],dyn_prio));
   /*
@@ -549,13 +575,13 @@ FUNC(void, OS_CODE) tpl_get_internal_resource(
   GET_TAIL_FOR_PRIO(core_id, tail_for_prio)
 
   CONSTP2VAR(tpl_internal_resource, AUTOMATIC, OS_APPL_DATA) rez =
-    tpl_stat_proc_table[task_id]->internal_resource;
+    TPL_STAT_PROC(task_id)->internal_resource;
 
   if ((NULL != rez) && (FALSE == rez->taken))
   {
     rez->taken = TRUE;
-    rez->owner_prev_priority = tpl_dyn_proc_table[task_id]->priority;
-    tpl_dyn_proc_table[task_id]->priority =
+    rez->owner_prev_priority = TPL_DYN_PROC(task_id)->priority;
+    TPL_DYN_PROC(task_id)->priority =
       DYNAMIC_PRIO(rez->ceiling_priority, tail_for_prio);
   }
 }
@@ -571,12 +597,12 @@ FUNC(void, OS_CODE) tpl_release_internal_resource(
     CONST(tpl_proc_id, AUTOMATIC) task_id)
 {
   CONSTP2VAR(tpl_internal_resource, AUTOMATIC, OS_APPL_DATA) rez =
-    tpl_stat_proc_table[task_id]->internal_resource;
+    TPL_STAT_PROC(task_id)->internal_resource;
 
   if ((NULL != rez) && (TRUE == rez->taken))
   {
     rez->taken = FALSE;
-    tpl_dyn_proc_table[task_id]->priority = rez->owner_prev_priority;
+    TPL_DYN_PROC(task_id)->priority = rez->owner_prev_priority;
   }
 }
 
@@ -630,6 +656,9 @@ FUNC(P2CONST(tpl_context, AUTOMATIC, OS_CONST), OS_CODE)
 
   DOW_DO(print_kern("before tpl_run_elected"));
 
+  /* the kernel entry in progress, if any, ends with a context switch */
+  PROFILE_KERNEL_SWITCH()
+
   if ((save) && (TPL_KERN_REF(kern).running->state != WAITING))
   {
     /*
@@ -746,8 +775,8 @@ FUNC(void, OS_CODE) tpl_start(CORE_ID_OR_VOID(core_id))
   DOW_DO(print_kern("before tpl_start"));
 
   TPL_KERN_REF(kern).elected_id = (uint32)proc.id;
-  TPL_KERN_REF(kern).elected = tpl_dyn_proc_table[proc.id];
-  TPL_KERN_REF(kern).s_elected = tpl_stat_proc_table[proc.id];
+  TPL_KERN_REF(kern).elected = TPL_DYN_PROC(proc.id);
+  TPL_KERN_REF(kern).s_elected = TPL_STAT_PROC(proc.id);
 
   if (TPL_KERN_REF(kern).elected->state == READY_AND_NEW)
   {
@@ -757,7 +786,7 @@ FUNC(void, OS_CODE) tpl_start(CORE_ID_OR_VOID(core_id))
      */
     DOW_DO(printf("%s is a new proc\n", proc_name_table[proc.id]));
     tpl_init_proc(proc.id);
-    tpl_dyn_proc_table[proc.id]->priority = proc.key;
+    TPL_DYN_PROC(proc.id)->priority = proc.key;
 #if NUMBER_OF_CORES > 1
     TPL_KERN_REF(kern).elected->state = (tpl_proc_state)READY;
     TRACE_PROC_CHANGE_STATE(TPL_KERN_REF(kern).elected_id, (tpl_proc_state)READY)
@@ -792,7 +821,7 @@ FUNC(void, OS_CODE) tpl_schedule_from_running(CORE_ID_OR_VOID(core_id))
 #endif /* WITH_STACK_MONITORING */
 
   if ((READY_LIST(ready_list)[1].key) >
-      (tpl_dyn_proc_table[TPL_KERN_REF(kern).elected_id]->priority))
+      (TPL_DYN_PROC(TPL_KERN_REF(kern).elected_id)->priority))
         {
     /* Preempts the RUNNING task */
     tpl_preempt(CORE_ID_OR_NOTHING(core_id));
@@ -957,9 +986,9 @@ FUNC(tpl_status, OS_CODE) tpl_activate_task(
 {
   VAR(tpl_status, AUTOMATIC)                              result = E_OS_LIMIT;
   CONSTP2VAR(tpl_proc, AUTOMATIC, OS_APPL_DATA)           task =
-    tpl_dyn_proc_table[task_id];
+    TPL_DYN_PROC(task_id);
   CONSTP2CONST(tpl_proc_static, AUTOMATIC, OS_APPL_DATA)  s_task =
-    tpl_stat_proc_table[task_id];
+    TPL_STAT_PROC(task_id);
 
   DOW_DO(printf("tpl_activate_task %s[%d](%d)\n",
     proc_name_table[task_id],
@@ -967,7 +996,13 @@ FUNC(tpl_status, OS_CODE) tpl_activate_task(
     task->priority
   ));
 
+#if (NUMBER_OF_CORES > 1) && (TASK_COUNT > 0)
+  /*  activations requested from another core are counted too           */
+  if ((task->activate_count + tpl_remote_requests[task_id].activations) <
+      s_task->max_activate_count)
+#else
   if (task->activate_count < s_task->max_activate_count)
+#endif
   {
 #if  WITH_AUTOSAR_TIMING_PROTECTION == YES
     /* a new instance is about to be activated: we need the agreement
@@ -1035,7 +1070,7 @@ FUNC(tpl_status, OS_CODE) tpl_activate_task(
 FUNC(void, OS_CODE) tpl_release(CONST(tpl_task_id, AUTOMATIC) task_id)
 {
   GET_PROC_CORE_ID(task_id, core_id)
-  CONSTP2VAR(tpl_proc, AUTOMATIC, OS_APPL_DATA) task = tpl_dyn_proc_table[task_id];
+  CONSTP2VAR(tpl_proc, AUTOMATIC, OS_APPL_DATA) task = TPL_DYN_PROC(task_id);
   /*  set the state to READY  */
   task->state = (tpl_proc_state)READY;
   TRACE_PROC_CHANGE_STATE(task_id, (tpl_proc_state)READY)
@@ -1062,7 +1097,7 @@ FUNC(tpl_status, OS_CODE) tpl_set_event(
 
 #if EXTENDED_TASK_COUNT > 0
   CONSTP2VAR(tpl_proc, AUTOMATIC, OS_APPL_DATA) task =
-    tpl_dyn_proc_table[task_id];
+    TPL_DYN_PROC(task_id);
   CONSTP2VAR(tpl_task_events, AUTOMATIC, OS_APPL_DATA) events =
     tpl_task_events_table[task_id];
 
@@ -1129,7 +1164,7 @@ FUNC(void, OS_CODE) tpl_init_proc(
     CONST(tpl_proc_id, AUTOMATIC) proc_id)
 {
   CONSTP2VAR(tpl_proc, AUTOMATIC, OS_APPL_DATA) dyn =
-    tpl_dyn_proc_table[proc_id];
+    TPL_DYN_PROC(proc_id);
 
   /*  set the resources list to NULL                                    */
   dyn->resources = NULL;
@@ -1177,6 +1212,17 @@ FUNC(void, OS_CODE) tpl_init_os(CONST(tpl_application_mode, AUTOMATIC) app_mode)
   }
 #endif
 
+  /*  Init the IPDUs of the external COM */
+#if ((WITH_COM == YES) && (WITH_EXTERNAL_COM == YES))
+# if NUMBER_OF_CORES > 1
+  /* Only one core must do this initialization */
+  if (core_id == OS_CORE_ID_MASTER)
+# endif
+  {
+    tpl_com_ipdu_init();
+  }
+#endif
+
 #if TASK_COUNT > 0
   /*  Look for autostart tasks    */
   for (i = 0; i < TASK_COUNT; i++)
@@ -1186,7 +1232,7 @@ FUNC(void, OS_CODE) tpl_init_os(CONST(tpl_application_mode, AUTOMATIC) app_mode)
     {
 # if NUMBER_OF_CORES > 1
       /* In multicore, we must check if the task belongs to the core */
-      if (tpl_stat_proc_table[i]->core_id == core_id)
+      if (TPL_STAT_PROC(i)->core_id == core_id)
 # endif
       {
         result = tpl_activate_task(i);
@@ -1382,6 +1428,132 @@ FUNC(void, OS_CODE) tpl_dispatch_context_switch(void)
   }
 }
 
+#if TASK_COUNT > 0
+/**
+ * @internal
+ *
+ * Appends a task to the request queue of its core if it is not already
+ * in it. The intercore interrupt is sent when the queue was empty only:
+ * otherwise the core has not processed its queue yet and will do it.
+ */
+STATIC FUNC(void, OS_CODE) tpl_post_remote_request(
+  CONST(tpl_task_id, AUTOMATIC) task_id)
+{
+  GET_PROC_CORE_ID(task_id, proc_core_id)
+  CONSTP2VAR(tpl_remote_request, AUTOMATIC, OS_VAR) request =
+    &tpl_remote_requests[task_id];
+  CONSTP2VAR(tpl_request_queue, AUTOMATIC, OS_VAR) queue =
+    &tpl_request_queues[proc_core_id];
+
+  if (request->queued == FALSE)
+  {
+    request->queued = TRUE;
+    if (queue->count == 0)
+    {
+      queue->head = task_id;
+    }
+    else
+    {
+      tpl_remote_requests[queue->tail].next = task_id;
+    }
+    queue->tail = task_id;
+    queue->count++;
+
+    if (queue->count == 1)
+    {
+      tpl_send_intercore_it(proc_core_id);
+    }
+  }
+}
+#endif
+
+/**
+ * tpl_request_remote_activation
+ *
+ * Requests the activation of a task of another core
+ */
+FUNC(tpl_status, OS_CODE) tpl_request_remote_activation(
+  CONST(tpl_task_id, AUTOMATIC) task_id)
+{
+  VAR(tpl_status, AUTOMATIC) result = E_OS_LIMIT;
+#if TASK_COUNT > 0
+  CONSTP2VAR(tpl_remote_request, AUTOMATIC, OS_VAR) request =
+    &tpl_remote_requests[task_id];
+
+  if ((TPL_DYN_PROC(task_id)->activate_count + request->activations) <
+      TPL_STAT_PROC(task_id)->max_activate_count)
+  {
+    request->activations++;
+    tpl_post_remote_request(task_id);
+    result = E_OK;
+  }
+#endif
+
+  return result;
+}
+
+/**
+ * tpl_request_remote_event
+ *
+ * Requests setting events of a task of another core
+ */
+FUNC(tpl_status, OS_CODE) tpl_request_remote_event(
+  CONST(tpl_task_id, AUTOMATIC)     task_id,
+  CONST(tpl_event_mask, AUTOMATIC)  event)
+{
+#if EXTENDED_TASK_COUNT > 0
+  tpl_remote_requests[task_id].events |= event;
+  tpl_post_remote_request(task_id);
+#endif
+
+  return E_OK;
+}
+
+/**
+ * tpl_process_remote_requests
+ *
+ * Processes the request queue of the calling core
+ */
+FUNC(void, OS_CODE) tpl_process_remote_requests(
+  CONST(uint16, AUTOMATIC) core_id)
+{
+#if TASK_COUNT > 0
+  CONSTP2VAR(tpl_request_queue, AUTOMATIC, OS_VAR) queue =
+    &tpl_request_queues[core_id];
+  P2VAR(tpl_remote_request, AUTOMATIC, OS_VAR) request;
+  VAR(tpl_task_id, AUTOMATIC) task_id;
+
+  while (queue->count > 0)
+  {
+    task_id = queue->head;
+    request = &tpl_remote_requests[task_id];
+    queue->head = request->next;
+    queue->count--;
+    request->queued = FALSE;
+
+    /*  activations first, so that the events of a task activated and
+        signaled from another core are not reset by its activation      */
+    while (request->activations > 0)
+    {
+      request->activations--;
+      tpl_activate_task(task_id);
+    }
+#if EXTENDED_TASK_COUNT > 0
+    if (request->events != 0)
+    {
+      tpl_set_event(task_id, request->events);
+      request->events = 0;
+    }
+#endif
+  }
+
+  if (TPL_KERN(core_id).need_schedule)
+  {
+    tpl_schedule_from_running(core_id);
+  }
+#endif
+}
+
 #endif
 
 #define OS_STOP_SEC_CODE
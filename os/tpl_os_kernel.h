@@ -217,6 +217,14 @@ typedef struct TPL_PROC_STATIC tpl_proc_static;
  *
  * This structure gathers the common members of executable objects dynamic
  * descriptors
+ *
+ * It holds the fields the scheduler writes (priority, state and activation
+ * count) and is kept apart from the read only #TPL_PROC_STATIC. With
+ * compact process tables, tpl_dyn_procs is therefore the hot array of the
+ * dispatcher. The context is not split out of #TPL_PROC_STATIC: the ports
+ * load it from the s_running and s_elected pointers of tpl_kern at offset
+ * 0 and read trusted_counter at a fixed offset (see the
+ * tpl_asm_definitions.h files), so neither structure may be reordered.
  */
 struct TPL_PROC {
   struct P2VAR(TPL_RESOURCE, TYPEDEF, OS_APPL_DATA)
@@ -288,6 +296,38 @@ typedef struct {
   VAR(tpl_proc_id, TYPEDEF)   id;
 } tpl_heap_entry;
 
+#if NUMBER_OF_CORES > 1
+/**
+ * @typedef tpl_remote_request
+ *
+ * Activations and events requested for a task from another core and not
+ * processed yet by the core of the task. The task is in the request queue
+ * of its core while queued is TRUE.
+ */
+typedef struct {
+  VAR(tpl_task_id, TYPEDEF)           next;         /**< next task of the
+                                                         queue          */
+  VAR(tpl_activate_counter, TYPEDEF)  activations;  /**< pending
+                                                         activations    */
+  VAR(tpl_event_mask, TYPEDEF)        events;       /**< pending events */
+  VAR(tpl_bool, TYPEDEF)              queued;       /**< the task is in
+                                                         the queue      */
+} tpl_remote_request;
+
+/**
+ * @typedef tpl_request_queue
+ *
+ * Queue of the tasks having pending remote requests for a core. Other
+ * cores append to it and the core empties it when it gets the intercore
+ * interrupt. The queue is empty when count is 0.
+ */
+typedef struct {
+  VAR(tpl_task_id, TYPEDEF) head;
+  VAR(tpl_task_id, TYPEDEF) tail;
+  VAR(uint16, TYPEDEF)      count;
+} tpl_request_queue;
+#endif /* NUMBER_OF_CORES > 1 */
+
 
 #define OS_START_SEC_VAR_UNSPECIFIED
 #include "tpl_memmap.h"
@@ -319,6 +359,13 @@ extern CONSTP2VAR(tpl_kern_state, OS_CONST, OS_VAR) tpl_kern[];
  */
 extern VAR(tpl_internal_resource, OS_VAR) INTERNAL_RES_SCHEDULER;
 
+#if (NUMBER_OF_CORES > 1) && (TASK_COUNT > 0)
+/**
+ * Activations and events requested for each task from another core
+ */
+extern VAR(tpl_remote_request, OS_VAR) tpl_remote_requests[TASK_COUNT];
+#endif
+
 #define OS_STOP_SEC_VAR_UNSPECIFIED
 #include "tpl_memmap.h"
 
@@ -401,11 +448,11 @@ extern VAR(tpl_internal_resource, OS_VAR) INTERNAL_RES_SCHEDULER;
 
 #define SWITCH_CONTEXT(a_core_id)                 \
   if (a_core_id != tpl_get_core_id()) {           \
-    tpl_send_intercore_it(a_core_id);             \
+    REMOTE_SWITCH_CONTEXT(a_core_id);             \
   }
 #define SWITCH_CONTEXT_NOSAVE(a_core_id)          \
   if (a_core_id != tpl_get_core_id()) {           \
-    tpl_send_intercore_it(a_core_id);             \
+    REMOTE_SWITCH_CONTEXT(a_core_id);             \
   }
 
 #endif
@@ -497,9 +544,46 @@ extern CONSTP2CONST(tpl_proc_static, AUTOMATIC, OS_APPL_DATA)
 extern CONSTP2VAR(tpl_proc, AUTOMATIC, OS_APPL_DATA)
   tpl_dyn_proc_table[TASK_COUNT+ISR_COUNT+NUMBER_OF_CORES];
 
+#if WITH_COMPACT_PROC_TABLES == YES
+/**
+ * With compact process tables, the static descriptors of all processes
+ * are stored in this dense array indexed by the process id, and
+ * tpl_stat_proc_table points into it.
+ */
+extern CONST(tpl_proc_static, OS_CONST)
+  tpl_stat_procs[TASK_COUNT+ISR_COUNT+NUMBER_OF_CORES];
+#endif
+
 #define OS_STOP_SEC_CONST_UNSPECIFIED
 #include "tpl_memmap.h"
 
+#if WITH_COMPACT_PROC_TABLES == YES
+#define OS_START_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+/**
+ * With compact process tables, the dynamic descriptors of all processes
+ * are stored in this dense array indexed by the process id, and
+ * tpl_dyn_proc_table points into it.
+ */
+extern VAR(tpl_proc, OS_VAR)
+  tpl_dyn_procs[TASK_COUNT+ISR_COUNT+NUMBER_OF_CORES];
+
+#define OS_STOP_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+
+/*
+ * TPL_STAT_PROC and TPL_DYN_PROC return a pointer to the static and
+ * dynamic descriptors of a process. With compact process tables, the
+ * address is computed from the process id instead of being loaded from
+ * the pointer tables.
+ */
+#define TPL_STAT_PROC(a_proc_id) (&tpl_stat_procs[a_proc_id])
+#define TPL_DYN_PROC(a_proc_id)  (&tpl_dyn_procs[a_proc_id])
+#else
+#define TPL_STAT_PROC(a_proc_id) (tpl_stat_proc_table[a_proc_id])
+#define TPL_DYN_PROC(a_proc_id)  (tpl_dyn_proc_table[a_proc_id])
+#endif
+
 
 #define OS_START_SEC_CODE
 #include "tpl_memmap.h"
@@ -644,6 +728,47 @@ FUNC(void, OS_CODE)tpl_multi_schedule(void);
  */
 FUNC(void, OS_CODE) tpl_dispatch_context_switch(void);
 
+/**
+ * @internal
+ *
+ * tpl_request_remote_activation requests the activation of a task of
+ * another core. The activation is done by the core of the task when it
+ * processes its request queue. The activation count is checked at once,
+ * pending activations included.
+ *
+ * @param   task_id   the identifier of the task
+ *
+ * @retval  E_OK        the activation has been requested
+ * @retval  E_OS_LIMIT  too many activations
+ */
+FUNC(tpl_status, OS_CODE) tpl_request_remote_activation(
+    CONST(tpl_task_id, AUTOMATIC) task_id);
+
+/**
+ * @internal
+ *
+ * tpl_request_remote_event requests setting events of an extended task of
+ * another core. Requested events are set after the requested activations.
+ *
+ * @param   task_id   the identifier of the task
+ * @param   event     the event mask
+ */
+FUNC(tpl_status, OS_CODE) tpl_request_remote_event(
+    CONST(tpl_task_id, AUTOMATIC)     task_id,
+    CONST(tpl_event_mask, AUTOMATIC)  event);
+
+/**
+ * @internal
+ *
+ * tpl_process_remote_requests does the activations and sets the events
+ * requested by other cores for the tasks of the core, then reschedules
+ * the core if needed. It is called by the intercore interrupt handler.
+ *
+ * @param   core_id   the identifier of the calling core
+ */
+FUNC(void, OS_CODE) tpl_process_remote_requests(
+    CONST(uint16, AUTOMATIC) core_id);
+
 #endif /* NUMBER_OF_CORES > 1 */
 
 #define OS_STOP_SEC_CODE
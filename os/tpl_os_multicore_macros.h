@@ -40,7 +40,7 @@
  * the proc passed as argument.
  */
 #define GET_PROC_CORE_ID(a_proc_id, a_core_id) \
-  CONST(uint16, AUTOMATIC) a_core_id = tpl_stat_proc_table[a_proc_id]->core_id;
+  CONST(uint16, AUTOMATIC) a_core_id = TPL_STAT_PROC(a_proc_id)->core_id;
 /*
  * GET_CURRENT_CORE_ID initializes the constant core_id
  * with the current core_id
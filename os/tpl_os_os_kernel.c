@@ -181,6 +181,7 @@ FUNC(void, OS_CODE) tpl_call_shutdown_os(
 
   CALL_SHUTDOWN_HOOK(error)
   TRACE_CLOSE()
+  PROFILE_SERVICE_DUMP()
 
 #if SPINLOCK_COUNT > 0
   RELEASE_ALL_SPINLOCKS(core_id);
@@ -0,0 +1,214 @@
+/**
+ * @file tpl_os_profiling.c
+ *
+ * @section desc File description
+ *
+ * Trampoline kernel entry profiling implementation file.
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline RTOS
+ *
+ * Trampoline is copyright (c) CNRS, University of Nantes, Ecole Centrale de Nantes
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the GNU Public Licence V2.
+ * Check the LICENSE file in the root directory of Trampoline
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#include "tpl_os_profiling.h"
+#include "tpl_os_kernel.h"
+#include "tpl_os_definitions.h"
+#include "tpl_machine_interface.h"
+
+#if WITH_SERVICE_PROFILING == YES
+
+/*
+ * States of the kernel entry in progress on a core
+ */
+#define PROFILING_OUT         0 /* not in the kernel                    */
+#define PROFILING_ENTERED     1 /* kernel locked, service not known yet */
+#define PROFILING_IN_SERVICE  2 /* in a service                         */
+
+/*
+ * Kernel entry in progress on a core
+ */
+typedef struct
+{
+  VAR(uint32, TYPEDEF)      start;      /* date of the kernel entry  */
+  VAR(tpl_proc_id, TYPEDEF) proc_id;    /* calling process           */
+  VAR(uint8, TYPEDEF)       service_id; /* called service            */
+  VAR(uint8, TYPEDEF)       state;      /* PROFILING_xxx             */
+} tpl_service_call;
+
+#if NUMBER_OF_CORES > 1
+#define SERVICE_CALL(a_core_id) tpl_service_call_in_progress[a_core_id]
+#else
+#define SERVICE_CALL(a_core_id) tpl_service_call_in_progress[0]
+#endif
+
+#define OS_START_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+
+VAR(tpl_service_profile, OS_VAR)
+  tpl_service_profile_table[TPL_PROFILING_PROC_COUNT][SYSCALL_COUNT];
+
+STATIC VAR(tpl_service_call, OS_VAR)
+  tpl_service_call_in_progress[NUMBER_OF_CORES];
+
+#define OS_STOP_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+
+#define OS_START_SEC_CODE
+#include "tpl_memmap.h"
+
+/*
+ * Row of the profiling table of a process
+ */
+STATIC FUNC(uint32, OS_CODE) tpl_profiling_row(
+  CONST(tpl_proc_id, AUTOMATIC) proc_id)
+{
+  VAR(uint32, AUTOMATIC) row = TPL_PROFILING_PROC_COUNT - 1;
+
+  if ((proc_id >= 0) && (proc_id < (TPL_PROFILING_PROC_COUNT - 1)))
+  {
+    row = (uint32)proc_id;
+  }
+
+  return row;
+}
+
+/*
+ * Accounts the service call in progress on a core
+ */
+STATIC FUNC(void, OS_CODE) tpl_profile_service_end(
+  P2VAR(tpl_service_call, AUTOMATIC, OS_VAR) call,
+  CONST(tpl_bool, AUTOMATIC) switched)
+{
+  VAR(uint32, AUTOMATIC) duration;
+  P2VAR(tpl_service_profile, AUTOMATIC, OS_VAR) profile;
+
+  if (call->state == PROFILING_IN_SERVICE)
+  {
+    duration = tpl_get_profiling_time() - call->start;
+    profile = &tpl_service_profile_table
+      [tpl_profiling_row(call->proc_id)][call->service_id];
+
+    profile->count++;
+    if (switched)
+    {
+      profile->switch_count++;
+    }
+    profile->total_low += duration;
+    if (profile->total_low < duration)
+    {
+      profile->total_high++;
+    }
+    if (duration > profile->max)
+    {
+      profile->max = duration;
+    }
+  }
+
+  call->state = PROFILING_OUT;
+}
+
+FUNC(void, OS_CODE) tpl_profile_kernel_enter(void)
+{
+  GET_CURRENT_CORE_ID(core_id)
+  CONSTP2VAR(tpl_service_call, AUTOMATIC, OS_VAR) call = &SERVICE_CALL(core_id);
+
+  call->proc_id = (tpl_proc_id)TPL_KERN(core_id).running_id;
+  call->state = PROFILING_ENTERED;
+  call->start = tpl_get_profiling_time();
+}
+
+FUNC(void, OS_CODE) tpl_profile_service(
+  CONST(uint8, AUTOMATIC) service_id)
+{
+  GET_CURRENT_CORE_ID(core_id)
+  CONSTP2VAR(tpl_service_call, AUTOMATIC, OS_VAR) call = &SERVICE_CALL(core_id);
+
+  /*
+   * The service id is also stored by the alarm actions, either outside
+   * of a kernel entry or within the service that ticks the counter.
+   * These ones are not accounted.
+   */
+  if ((call->state == PROFILING_ENTERED) && (service_id < SYSCALL_COUNT))
+  {
+    call->service_id = service_id;
+    call->state = PROFILING_IN_SERVICE;
+  }
+}
+
+FUNC(void, OS_CODE) tpl_profile_kernel_exit(void)
+{
+  GET_CURRENT_CORE_ID(core_id)
+
+  /*
+   * With system calls, the context switch is done when leaving the
+   * kernel, after the service has returned.
+   */
+  tpl_profile_service_end(
+    &SERVICE_CALL(core_id), TPL_KERN(core_id).need_switch != NO_NEED_SWITCH);
+}
+
+FUNC(void, OS_CODE) tpl_profile_kernel_switch(void)
+{
+  GET_CURRENT_CORE_ID(core_id)
+
+  tpl_profile_service_end(&SERVICE_CALL(core_id), TRUE);
+}
+
+FUNC(StatusType, OS_CODE) tpl_get_service_profile(
+  CONST(tpl_proc_id, AUTOMATIC) proc_id,
+  CONST(uint8, AUTOMATIC) service_id,
+  CONSTP2VAR(tpl_service_profile, AUTOMATIC, OS_APPL_DATA) profile)
+{
+  VAR(StatusType, AUTOMATIC) result = E_OS_ID;
+
+  /* a negative proc_id (INVALID_PROC_ID) is out of range once unsigned */
+  if (((uint32)proc_id < (uint32)(TASK_COUNT + ISR_COUNT)) &&
+      (service_id < SYSCALL_COUNT))
+  {
+    *profile = tpl_service_profile_table[proc_id][service_id];
+    result = E_OK;
+  }
+
+  return result;
+}
+
+FUNC(void, OS_CODE) tpl_reset_service_profiling(void)
+{
+  VAR(uint32, AUTOMATIC) row;
+  VAR(uint32, AUTOMATIC) service_id;
+
+  for (row = 0; row < TPL_PROFILING_PROC_COUNT; row++)
+  {
+    for (service_id = 0; service_id < SYSCALL_COUNT; service_id++)
+    {
+      tpl_service_profile_table[row][service_id].count = 0;
+      tpl_service_profile_table[row][service_id].switch_count = 0;
+      tpl_service_profile_table[row][service_id].total_low = 0;
+      tpl_service_profile_table[row][service_id].total_high = 0;
+      tpl_service_profile_table[row][service_id].max = 0;
+    }
+  }
+}
+
+#define OS_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+#else /* WITH_SERVICE_PROFILING == YES */
+/* ISO C forbids an empty translation unit */
+typedef int tpl_os_profiling_unused;
+#endif /* WITH_SERVICE_PROFILING */
+
+/* End of file tpl_os_profiling.c */
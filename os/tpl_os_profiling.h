@@ -0,0 +1,174 @@
+/**
+ * @file tpl_os_profiling.h
+ *
+ * @section desc File description
+ *
+ * Trampoline kernel entry profiling. When WITH_SERVICE_PROFILING is set,
+ * each service call is accounted in a table indexed by the calling
+ * process and the service id: number of calls, total and maximum time
+ * spent in the kernel and number of calls that led to a context switch.
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline RTOS
+ *
+ * Trampoline is copyright (c) CNRS, University of Nantes, Ecole Centrale de Nantes
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the GNU Public Licence V2.
+ * Check the LICENSE file in the root directory of Trampoline
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#ifndef TPL_OS_PROFILING_H
+#define TPL_OS_PROFILING_H
+
+#include "tpl_os_types.h"
+
+#if WITH_SERVICE_PROFILING == YES
+
+#include "tpl_service_ids.h"
+
+/**
+ * @internal
+ *
+ * Number of rows of the profiling table: one per task and ISR2, one per
+ * idle task and one for the calls done outside of any process (StartOS
+ * called from main for instance).
+ */
+#define TPL_PROFILING_PROC_COUNT  (TASK_COUNT + ISR_COUNT + NUMBER_OF_CORES + 1)
+
+/**
+ * @internal
+ *
+ * Profile of a service for a calling process. Times are in the unit of
+ * #tpl_get_profiling_time. The total is kept on 64 bits in two words.
+ */
+typedef struct
+{
+  VAR(uint32, TYPEDEF) count;         /**< number of calls                  */
+  VAR(uint32, TYPEDEF) switch_count;  /**< calls leading to a context switch */
+  VAR(uint32, TYPEDEF) total_low;     /**< total time, low word             */
+  VAR(uint32, TYPEDEF) total_high;    /**< total time, high word            */
+  VAR(uint32, TYPEDEF) max;           /**< longest call                     */
+} tpl_service_profile;
+
+#define OS_START_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+/**
+ * @internal
+ *
+ * The profiling table
+ */
+extern VAR(tpl_service_profile, OS_VAR)
+  tpl_service_profile_table[TPL_PROFILING_PROC_COUNT][SYSCALL_COUNT];
+#define OS_STOP_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+
+#define OS_START_SEC_CONST_UNSPECIFIED
+#include "tpl_memmap.h"
+/**
+ * @internal
+ *
+ * Names of the services, indexed by service id. Generated by goil.
+ */
+extern CONSTP2CONST(char, AUTOMATIC, OS_CONST)
+  tpl_service_name_table[SYSCALL_COUNT];
+#define OS_STOP_SEC_CONST_UNSPECIFIED
+#include "tpl_memmap.h"
+
+#define OS_START_SEC_CODE
+#include "tpl_memmap.h"
+
+/**
+ * @internal
+ *
+ * Starts the accounting of a kernel entry. Called when the kernel is
+ * locked.
+ */
+FUNC(void, OS_CODE) tpl_profile_kernel_enter(void);
+
+/**
+ * @internal
+ *
+ * Gives the service of the kernel entry in progress. Only the first call
+ * after #tpl_profile_kernel_enter is taken into account.
+ *
+ * @param service_id  id of the service (OSServiceId_xxx)
+ */
+FUNC(void, OS_CODE) tpl_profile_service(
+  CONST(uint8, AUTOMATIC) service_id);
+
+/**
+ * @internal
+ *
+ * Ends the accounting of the kernel entry in progress. Called when the
+ * kernel is unlocked.
+ */
+FUNC(void, OS_CODE) tpl_profile_kernel_exit(void);
+
+/**
+ * @internal
+ *
+ * Ends the accounting of the kernel entry in progress because it switches
+ * to another process. Called by #tpl_run_elected.
+ */
+FUNC(void, OS_CODE) tpl_profile_kernel_switch(void);
+
+/**
+ * Gives the profile of a service called by a task or an ISR2. The calls
+ * done by the idle tasks or outside of any process are only in
+ * #tpl_service_profile_table.
+ *
+ * @param proc_id     id of the calling task or ISR2
+ * @param service_id  id of the service (OSServiceId_xxx)
+ * @param profile     where the profile is copied
+ *
+ * @retval E_OK     no error
+ * @retval E_OS_ID  proc_id is not a task or an ISR2, or service_id is not
+ *                  a service
+ */
+FUNC(StatusType, OS_CODE) tpl_get_service_profile(
+  CONST(tpl_proc_id, AUTOMATIC) proc_id,
+  CONST(uint8, AUTOMATIC) service_id,
+  CONSTP2VAR(tpl_service_profile, AUTOMATIC, OS_APPL_DATA) profile);
+
+/**
+ * Clears the profiling table.
+ */
+FUNC(void, OS_CODE) tpl_reset_service_profiling(void);
+
+/**
+ * Exports the profiling table. This function is implemented in the
+ * machine dependant part. It is called at shutdown.
+ */
+extern FUNC(void, OS_CODE) tpl_service_profiling_dump(void);
+
+#define OS_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+#define PROFILE_KERNEL_ENTER()      tpl_profile_kernel_enter();
+#define PROFILE_SERVICE(service)    tpl_profile_service(service);
+#define PROFILE_KERNEL_EXIT()       tpl_profile_kernel_exit();
+#define PROFILE_KERNEL_SWITCH()     tpl_profile_kernel_switch();
+#define PROFILE_SERVICE_DUMP()      tpl_service_profiling_dump();
+
+#else
+
+#define PROFILE_KERNEL_ENTER()
+#define PROFILE_SERVICE(service)
+#define PROFILE_KERNEL_EXIT()
+#define PROFILE_KERNEL_SWITCH()
+#define PROFILE_SERVICE_DUMP()
+
+#endif /* WITH_SERVICE_PROFILING */
+
+#endif /* TPL_OS_PROFILING_H */
+
+/* End of file tpl_os_profiling.h */
@@ -86,14 +86,14 @@ FUNC(void, OS_CODE) tpl_release_all_resources(
 {
   /*  Get the resource pointer of the process */
   P2VAR(tpl_resource, AUTOMATIC, OS_APPL_DATA) res =
-  tpl_dyn_proc_table[proc_id]->resources;
+  TPL_DYN_PROC(proc_id)->resources;
 #if WITH_TRACE == YES
   GET_CURRENT_CORE_ID(core_id)
 #endif /* WITH_TRACE */
 
   if (res != NULL)
   {
-    tpl_dyn_proc_table[proc_id]->resources = NULL;
+    TPL_DYN_PROC(proc_id)->resources = NULL;
 
     do
     {
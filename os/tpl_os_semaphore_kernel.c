@@ -107,7 +107,7 @@ FUNC(tpl_status, OS_CODE) tpl_sem_wait_service(CONST(SemType, AUTOMATIC) sem_id)
   LOCK_KERNEL()
 
   task_id = TPL_KERN_REF(kern).running_id;
-  s_task = tpl_stat_proc_table[task_id];
+  s_task = TPL_STAT_PROC(task_id);
   if (s_task->max_activate_count == 1)
   {
     if (sem->token == 0)
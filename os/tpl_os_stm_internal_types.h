@@ -1,5 +1,5 @@
 /**
- * @file tpl_as_memmap.h
+ * @file tpl_os_stm_internal_types.h
  *
  * @section desc File description
  *
@@ -23,53 +23,68 @@
  * $URL:$
  */
 
-#include "tpl_os_internal_types.h" /* pour tpl_core_id */
-#include "tpl_os_stm_types.h"
+#ifndef TPL_OS_STM_INTERNAL_TYPES_H
+#define TPL_OS_STM_INTERNAL_TYPES_H
 
+#include "tpl_os_internal_types.h"
+#include "tpl_os_stm_types.h"
 
 /**
- * @def OBJECT
- *
- * Macro used to define (declare) an object
+ * @def STM_COPY_COUNT
  *
- * @param name the name (C identifier) of the IRS
+ * Number of copies of the data of an object:
+ * - copies 0 and 1 are the current version and the version published by
+ *   the next update. #CURRENT_OBJECT_POS gives the current one;
+ * - copy #STM_WRITE_COPY is where the writer of the object puts the data
+ *   of its transaction until the transaction commits.
  */
-#define OBJECT(name)                               \
-FUNC(void, OS_APPL_CODE) name##_function(void)
+#define STM_COPY_COUNT  3
 
+/**
+ * @def STM_WRITE_COPY
+ *
+ * Index of the copy written by the write-set transaction in the copy table
+ */
+#define STM_WRITE_COPY  2
 
 /**
- * @typedef tpl_stm_core_id
+ * @def STM_NO_TX
  *
- * Transaction core id
+ * Transaction descriptor id of a process which executes no transaction
  */
-typedef uint32 tpl_stm_core_id;
+#define STM_NO_TX       NUMBER_OF_STM_TX
 
 /**
- * @typedef tpl_stm_tx_id
+ * @def STM_NO_WRITER
  *
- * Transaction id
+ * Writer of an object no transaction writes
  */
-typedef tpl_stm_core_id tpl_stm_tx_id;
+#define STM_NO_WRITER   STM_NO_TX
 
 /**
- * @typedef tpl_stm_current_pos
+ * @typedef tpl_stm_tx_id
  *
- * Current position of concurrent data in copy_table
+ * Transaction descriptor id. Each task executing transactions (TASK
+ * attribute of the OIL TRANSACTION objects) has its own descriptor.
  */
-typedef char tpl_stm_current_pos;
+typedef uint32 tpl_stm_tx_id;
 
 /**
  * @typedef tpl_stm_concurrency_vector
  *
- * Object concurrency vector
+ * Object concurrency vector:
+ * - bit 31 is set when an update of the object is pending;
+ * - bit 30 is the position of the current version in the copy table;
+ * - bits 0 to NUMBER_OF_STM_TX-1 are set when the transaction of the
+ *   corresponding descriptor has read the object.
  */
 typedef uint32 tpl_stm_concurrency_vector;
 
 /**
  * @typedef tpl_stm_access_vector
  *
- * Transaction access vector
+ * Transaction access vector, bit i is set when the transaction has accessed
+ * the object whose id is i.
  */
 typedef uint32 tpl_stm_access_vector;
 
@@ -95,7 +110,8 @@ typedef uint32 tpl_stm_status;
 /**
  * @def TXS_IN_RETRY
  *
- * The transaction is in retry
+ * The transaction is active and executed again after a failure. It cannot
+ * fail: the updates of the objects it has read are delayed until it ends.
  *
  */
 #define TXS_IN_RETRY	1
@@ -103,7 +119,7 @@ typedef uint32 tpl_stm_status;
 /**
  * @def TXS_FAILED
  *
- * The transaction has failed
+ * The transaction has failed, an object it has read has been updated
  *
  */
 #define TXS_FAILED	2
@@ -116,39 +132,21 @@ typedef uint32 tpl_stm_status;
  */
 #define TXS_INACTIVE	3
 
-
-/**
- * @typedef tpl_stm_access_vector
- *
- * Transaction access vector
- */
-typedef uint32 tpl_stm_access_vector;
-
-
 /**
  * @typedef tpl_stm_object
  *
  * This is the internal object structure.
  */
 struct TPL_STM_OBJECT {
-  P2CONST(char, AUTOMATIC, OS_VAR) name;	/**< Object name
-									*/
-  CONST(tpl_stm_object_id, TYPEDEF)
-    object_id;     	/**<  Object id
-                                		                       	*/
-  P2CONST(char, AUTOMATIC, OS_VAR) type;	/**< Data type
-									*/
-  CONST(size_t, OS_VAR) size;			/**< Data size
-									*/
-  VAR(tpl_stm_current_pos, TYPEDEF)
-    current_pos;  	/**<  Current position of the concurrent data
-								 	*/
-  P2VAR(tpl_stm_data, AUTOMATIC, OS_APPL_DATA)
-    copy_table[NUMBER_OF_CORES+2];  /**<  Table gathering the
-                      copies of the concurrent data                  	*/
+  CONST(uint32, TYPEDEF)
+    size;               /**< Size of the data of the object           */
+  CONST(tpl_stm_tx_id, TYPEDEF)
+    writer;             /**< Descriptor of the only task writing the
+                             object or #STM_NO_WRITER                 */
+  CONSTP2VAR(tpl_stm_data, TYPEDEF, OS_APPL_DATA)
+    copy_table[STM_COPY_COUNT]; /**< Copies of the data of the object */
   VAR(tpl_stm_concurrency_vector, TYPEDEF)
-    concurrency_vector; /**<  Concurrency vector of the object
-								 	*/
+    concurrency_vector; /**< Concurrency vector of the object         */
 };
 
 /**
@@ -156,32 +154,36 @@ struct TPL_STM_OBJECT {
  *
  * This is an alias for the #TPL_STM_OBJECT structure
  *
- * @see #TPL_STM_TX_DESCRIPTOR
+ * @see #TPL_STM_OBJECT
  */
 typedef struct TPL_STM_OBJECT tpl_stm_object;
 
-
 /**
  * @typedef TPL_STM_TX_DESCRIPTOR
  *
- * This is is the internal transaction descriptor structure.
+ * This is is the internal transaction descriptor structure. There is one
+ * descriptor per task executing transactions since a task executes one
+ * transaction at a time. Tasks of the same core may then preempt each other
+ * in the middle of their transactions.
  */
 struct TPL_STM_TX_DESCRIPTOR {
-  CONST(tpl_stm_core_id, TYPEDEF)
-    core_id;    	/**<  Core id to which the transaction belongs
-                                		                       	*/
+  CONST(tpl_stm_tx_id, TYPEDEF)
+    tx_id;              /**< Id of the descriptor, its bit in the
+                             concurrency vectors                      */
   VAR(tpl_stm_status, TYPEDEF)
-    status;  		/**<  Status of the transaction
-								 	*/
-  P2VAR(tpl_stm_data, AUTOMATIC, OS_APPL_DATA)
-    read_set[NUMBER_OF_OBJECTS];          /**<  Set of objects accessed
-                               	in read-only mode                     	*/
-  P2VAR(tpl_stm_data, AUTOMATIC, OS_APPL_DATA)
-    write_set[NUMBER_OF_OBJECTS];          /**<  Set of objects accessed
-                                in write mode                          	*/
+    status;             /**< Status of the transaction                */
+  VAR(tpl_bool, TYPEDEF)
+    writing;            /**< TRUE for a write-set transaction         */
+  VAR(tpl_bool, TYPEDEF)
+    retry;              /**< TRUE when the next transaction is the
+                             retry of a failed one                    */
   VAR(tpl_stm_access_vector, TYPEDEF)
-    access_vector; 	/**<  Access vector of the transaction
-								 	*/
+    read_vector;        /**< Objects read by the transaction          */
+  VAR(tpl_stm_access_vector, TYPEDEF)
+    write_vector;       /**< Objects written by the transaction       */
+  CONST(tpl_stm_access_vector, TYPEDEF)
+    read_set;           /**< Objects the transactions of the task may
+                             read (READ_SET and WRITE_SET in OIL)     */
 };
 
 /**
@@ -193,3 +195,6 @@ struct TPL_STM_TX_DESCRIPTOR {
  */
 typedef struct TPL_STM_TX_DESCRIPTOR tpl_stm_tx_descriptor;
 
+#endif /* TPL_OS_STM_INTERNAL_TYPES_H */
+
+/* End of file tpl_os_stm_internal_types.h */
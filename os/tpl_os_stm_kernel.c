@@ -3,7 +3,23 @@
  *
  * @section desc File description
  *
- * Trampoline Event Management implementation file
+ * Trampoline STM-HRT implementation file
+ *
+ * The STM-HRT protocol lets tasks share objects in transactions, on the same
+ * core or on different cores. Each task listed in the TASK attribute of an
+ * OIL TRANSACTION has its own transaction descriptor, so tasks of the same
+ * core may preempt each other in the middle of a transaction. Each service
+ * is executed with the kernel locked and has a bounded execution time
+ * (loops are bounded by NUMBER_OF_OBJECTS and NUMBER_OF_STM_TX), so a
+ * transaction never waits for another one.
+ *
+ * Each object has a single writer task. Committing a write-set transaction sets
+ * the update flag of the objects it wrote and the update is published, for
+ * all the objects of the writer at once, by the writer or by any reader
+ * helping it. A publication fails the transactions in progress that read one
+ * of the updated objects. A failed transaction is executed again in retry
+ * mode: the publications of the objects it reads are delayed until it ends,
+ * so it cannot fail again and a transaction is retried at most once.
  *
  * @section copyright Copyright
  *
@@ -24,45 +40,198 @@
  */
 
 #include "tpl_os_definitions.h"
-/*#include "tpl_os_errorhook.h"
+#include "tpl_os_errorhook.h"
 #include "tpl_os_kernel.h"
 #include "tpl_machine_interface.h"
-#include "tpl_trace.h"
+#include "tpl_os_stm_kernel.h"
 
 #if WITH_AUTOSAR == YES
 #include "tpl_as_isr_kernel.h"
 #include "tpl_as_protec_hook.h"
 #endif
 
-#if WITH_MEMORY_PROTECTION == YES
-#include "tpl_os_mem_prot.h"
-#endif*/
-/*
-#include "tpl_os_event_kernel.h"*/
+#define OS_START_SEC_CODE
+#include "tpl_memmap.h"
 
-#include "tpl_os_stm_kernel.h"
+/**
+ * @internal
+ *
+ * Copies the data of an object.
+ *
+ * @param dst   destination
+ * @param src   source
+ * @param size  size of the data in bytes
+ */
+STATIC FUNC(void, OS_CODE) tpl_stm_copy(
+  P2VAR(tpl_stm_data, AUTOMATIC, OS_APPL_DATA) dst,
+  P2CONST(tpl_stm_data, AUTOMATIC, OS_APPL_DATA) src,
+  VAR(uint32, AUTOMATIC) size)
+{
+  P2VAR(uint8, AUTOMATIC, OS_APPL_DATA) dst_ptr = (uint8 *)dst;
+  P2CONST(uint8, AUTOMATIC, OS_APPL_DATA) src_ptr = (const uint8 *)src;
 
-#include <stdio.h>
-#include <string.h>
+  while (size > 0)
+  {
+    *dst_ptr = *src_ptr;
+    dst_ptr++;
+    src_ptr++;
+    size--;
+  }
+}
 
-/*
- * tpl_screen_display_service.
+/**
+ * @internal
+ *
+ * Publishes the pending updates of the objects of a writer. The updates are
+ * published together so that a transaction sees either all of them or none.
+ * They are delayed if one of the objects has been read by a transaction in
+ * retry. Otherwise the transactions in progress which read one of the
+ * objects fail.
+ *
+ * @param writer  the descriptor id of the writer
  */
+STATIC FUNC(void, OS_CODE) tpl_stm_publish(
+  CONST(tpl_stm_tx_id, AUTOMATIC) writer)
+{
+  P2VAR(tpl_stm_object, AUTOMATIC, OS_VAR) object;
+  VAR(tpl_stm_object_id, AUTOMATIC) object_id;
+  VAR(tpl_stm_tx_id, AUTOMATIC) tx_id;
+  VAR(tpl_stm_concurrency_vector, AUTOMATIC) readers = 0;
+  VAR(tpl_stm_concurrency_vector, AUTOMATIC) retrying = 0;
+
+  /* readers of the pending updates and transactions in retry */
+  for (object_id = 0; object_id < NUMBER_OF_OBJECTS; object_id++)
+  {
+    object = &tpl_stm_object_table[object_id];
+    if ((object->writer == writer) && UPDATE_FLAG(object->concurrency_vector))
+    {
+      readers |= READ_VECTOR(object->concurrency_vector);
+    }
+  }
+  for (tx_id = 0; tx_id < NUMBER_OF_STM_TX; tx_id++)
+  {
+    if (tpl_stm_tx_table[tx_id].status == TXS_IN_RETRY)
+    {
+      retrying |= (1UL << tx_id);
+    }
+  }
 
-FUNC(StatusType, OS_CODE) tpl_screen_display_service(
-  P2CONST(char, AUTOMATIC, OS_VAR) msg)
+  if ((readers & retrying) == 0)
+  {
+    for (tx_id = 0; tx_id < NUMBER_OF_STM_TX; tx_id++)
+    {
+      if (READ_VECTOR_BIT(readers, tx_id) &&
+          (tpl_stm_tx_table[tx_id].status == TXS_IN_PROGRESS))
+      {
+        tpl_stm_tx_table[tx_id].status = TXS_FAILED;
+      }
+    }
+    for (object_id = 0; object_id < NUMBER_OF_OBJECTS; object_id++)
+    {
+      object = &tpl_stm_object_table[object_id];
+      if ((object->writer == writer) &&
+          UPDATE_FLAG(object->concurrency_vector))
+      {
+        object->concurrency_vector =
+          (object->concurrency_vector ^ STM_CURRENT_POS) &
+          ~(STM_UPDATE_FLAG | STM_READ_VECTOR);
+      }
+    }
+  }
+}
+
+/**
+ * @internal
+ *
+ * Ends the transaction of a task: its read marks are removed from the
+ * objects and the updates they delayed are published.
+ *
+ * @param tx  the transaction descriptor
+ */
+STATIC FUNC(void, OS_CODE) tpl_stm_end_tx(
+  P2VAR(tpl_stm_tx_descriptor, AUTOMATIC, OS_VAR) tx)
 {
-  VAR(StatusType, AUTOMATIC) result = E_OK;
+  VAR(tpl_stm_object_id, AUTOMATIC) object_id;
+  VAR(tpl_stm_tx_id, AUTOMATIC) writer;
 
-  LOCK_KERNEL()
+  for (object_id = 0; object_id < NUMBER_OF_OBJECTS; object_id++)
+  {
+    if (tx->read_vector & (1UL << object_id))
+    {
+      tpl_stm_object_table[object_id].concurrency_vector &=
+        ~(1UL << tx->tx_id);
+    }
+  }
+  tx->read_vector = 0;
+  tx->write_vector = 0;
+  tx->status = TXS_INACTIVE;
 
-  /* Display the message    */
+  for (writer = 0; writer < NUMBER_OF_STM_TX; writer++)
+  {
+    tpl_stm_publish(writer);
+  }
+}
 
-  printf("\n---------------------\nVoici le message : %s\n---------------------\n", msg);
+/**
+ * @internal
+ *
+ * Begins the transaction of the running task.
+ *
+ * @param writing TRUE for a write-set transaction
+ */
+STATIC FUNC(void, OS_CODE) tpl_stm_begin_tx(
+  P2VAR(tpl_stm_tx_descriptor, AUTOMATIC, OS_VAR) tx,
+  CONST(tpl_bool, AUTOMATIC) writing)
+{
+  tx->status = tx->retry ? TXS_IN_RETRY : TXS_IN_PROGRESS;
+  tx->retry = FALSE;
+  tx->writing = writing;
+  tx->read_vector = 0;
+  tx->write_vector = 0;
+}
 
-  PROCESS_ERROR(result)
+/**
+ * @internal
+ *
+ * Commits the transaction of the running task. The objects written by a
+ * write-set transaction get a pending update, which is published at once
+ * if possible.
+ *
+ * @return E_OK or E_OS_STM_RETRY if the transaction has failed
+ */
+STATIC FUNC(StatusType, OS_CODE) tpl_stm_commit_tx(
+  P2VAR(tpl_stm_tx_descriptor, AUTOMATIC, OS_VAR) tx)
+{
+  P2VAR(tpl_stm_object, AUTOMATIC, OS_VAR) object;
+  VAR(tpl_stm_object_id, AUTOMATIC) object_id;
+  VAR(StatusType, AUTOMATIC) result = E_OK;
 
-  UNLOCK_KERNEL()
+  if (tx->status == TXS_FAILED)
+  {
+    tx->retry = TRUE;
+    result = E_OS_STM_RETRY;
+  }
+  else
+  {
+    for (object_id = 0; object_id < NUMBER_OF_OBJECTS; object_id++)
+    {
+      if (tx->write_vector & (1UL << object_id))
+      {
+        /*
+         * A pending update which has not been published yet is replaced,
+         * no transaction has seen it.
+         */
+        object = &tpl_stm_object_table[object_id];
+        tpl_stm_copy(
+          object->copy_table[1 - CURRENT_OBJECT_POS(object->concurrency_vector)],
+          object->copy_table[STM_WRITE_COPY],
+          object->size);
+        object->concurrency_vector |= STM_UPDATE_FLAG;
+      }
+    }
+  }
+
+  tpl_stm_end_tx(tx);
 
   return result;
 }
@@ -70,251 +239,284 @@ FUNC(StatusType, OS_CODE) tpl_screen_display_service(
 /*
  * tpl_stm_begin_read_tx_service
  *
- * Initializes a read-set transaction
- *
- * Return value:
- * E_OK:    No error (Standard & Extended)
- *
+ * See tpl_os_stm_kernel.h
  */
-FUNC(StatusType, OS_CODE) tpl_stm_begin_read_tx_service()
+FUNC(StatusType, OS_CODE) tpl_stm_begin_read_tx_service(void)
 {
- VAR(StatusType, AUTOMATIC) result = E_OK;
+  VAR(StatusType, AUTOMATIC) result = E_OK;
+  GET_STM_TX(tx_id, tx)
 
-#if NUMBER_OF_CORES > 1
- GET_CURRENT_CORE_ID(core_id)
+  LOCK_KERNEL()
 
- LOCK_KERNEL()
+  STORE_SERVICE(OSServiceId_STMBeginReadTx)
 
- /* a compléter */
+  CHECK_STM_TX_ERROR(tx_id, result)
+  CHECK_STM_ACTIVE_TX_ERROR(tx, FALSE, FALSE, result)
 
- UNLOCK_KERNEL()
-#else
- LOCK_KERNEL()
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    tpl_stm_begin_tx(tx, FALSE);
+  }
 
- /* a compléter */
+  PROCESS_ERROR(result)
 
- UNLOCK_KERNEL()
-#endif
+  UNLOCK_KERNEL()
 
- return result;
-};
+  return result;
+}
 
 /*
  * tpl_stm_begin_write_tx_service
  *
- * Initializes a write-set transaction on the core given as an argument
- *
- * tx:  Transaction descriptor
- *
- * coreId:  Core on which the write-set transaction begins
- *
- * Return value:
- * E_OK:    No error (Standard & Extended)
- *
+ * See tpl_os_stm_kernel.h
  */
-FUNC(StatusType, OS_CODE) tpl_stm_begin_write_tx_service(){
-};
+FUNC(StatusType, OS_CODE) tpl_stm_begin_write_tx_service(void)
+{
+  VAR(StatusType, AUTOMATIC) result = E_OK;
+  GET_STM_TX(tx_id, tx)
+
+  LOCK_KERNEL()
+
+  STORE_SERVICE(OSServiceId_STMBeginWriteTx)
+
+  CHECK_STM_TX_ERROR(tx_id, result)
+  CHECK_STM_ACTIVE_TX_ERROR(tx, FALSE, TRUE, result)
+
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    tpl_stm_begin_tx(tx, TRUE);
+  }
+
+  PROCESS_ERROR(result)
+
+  UNLOCK_KERNEL()
+
+  return result;
+}
 
 /*
  * tpl_stm_end_read_tx_service
  *
- * Ends a read-set transaction
- *
- * tx:  Transaction descriptor
- *
- * Return value:
- * E_OK:    No error (Standard & Extended)
- *
+ * See tpl_os_stm_kernel.h
  */
-FUNC(StatusType, OS_CODE) tpl_stm_end_read_tx_service(){
-};
+FUNC(StatusType, OS_CODE) tpl_stm_end_read_tx_service(void)
+{
+  VAR(StatusType, AUTOMATIC) result = E_OK;
+  GET_STM_TX(tx_id, tx)
 
-/*
- * tpl_stm_end_write_tx_service
- *
- * Ends a write-set transaction
- *
- * tx:  Transaction descriptor
- *
- * Return value:
- * E_OK:    No error (Standard & Extended)
- *
- */
-FUNC(StatusType, OS_CODE) tpl_stm_end_write_tx_service(){
-};
+  LOCK_KERNEL()
 
+  STORE_SERVICE(OSServiceId_STMEndReadTx)
 
-/*
- * update
- *
- * A write-set transaction is ready to update an object
- *
- * tx:  Transaction descriptor
- *
- * object_id:  Object identifier
- *
- * Return value:
- * E_OK:    No error (Standard & Extended)
- *
- */
-FUNC(StatusType, OS_CODE) update(P2VAR(tpl_stm_tx_descriptor, AUTOMATIC, OS_APPL_DATA) tx, CONST(ObjectType, AUTOMATIC) object_id){
- /* a compléter */
-};
+  CHECK_STM_TX_ERROR(tx_id, result)
+  CHECK_STM_ACTIVE_TX_ERROR(tx, TRUE, FALSE, result)
+
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    tpl_stm_end_tx(tx);
+  }
+
+  PROCESS_ERROR(result)
+
+  UNLOCK_KERNEL()
+
+  return result;
+}
 
 /*
- * read_obj
- *
- * A write-set transaction is ready to update an object
- *
- * tx:  Transaction descriptor
- *
- * object_id:  Object identifier
- *
- * Return value:
- * E_OK:    No error (Standard & Extended)
+ * tpl_stm_end_write_tx_service
  *
+ * See tpl_os_stm_kernel.h
  */
-FUNC(StatusType, OS_CODE) read_obj(CONST(tpl_stm_core_id, OS_APPL_DATA) coreid_tx1, CONST(tpl_stm_core_id, OS_APPL_DATA) coreid_tx2, CONST(ObjectType, AUTOMATIC) object_id, CONST(uint32, AUTOMATIC) instance){
+FUNC(StatusType, OS_CODE) tpl_stm_end_write_tx_service(void)
+{
+  VAR(StatusType, AUTOMATIC) result = E_OK;
+  GET_STM_TX(tx_id, tx)
+
+  LOCK_KERNEL()
 
-  char loc_current_pos;
-  char read_copy_index;
+  STORE_SERVICE(OSServiceId_STMEndWriteTx)
 
-  if ((STATUS(trans_table[coreid_tx2].status) == TXS_IN_RETRY) && (INSTANCE(trans_table[coreid_tx2].status) == instance))
- 	object_table[object_id].concurrency_vector = SET_FAIL_VECTOR(object_table[object_id].concurrency_vector, coreid_tx2);
+  CHECK_STM_TX_ERROR(tx_id, result)
+  CHECK_STM_ACTIVE_TX_ERROR(tx, TRUE, TRUE, result)
 
-  do
+  IF_NO_EXTENDED_ERROR(result)
   {
-	SET_READ_VECTOR(object_table[object_id].concurrency_vector, coreid_tx2);
-	loc_current_pos = CURRENT_OBJECT_POS(object_table[object_id].concurrency_vector);
-	read_copy_index = 2 + coreid_tx2;
-	printf("data dans la structure object_table à current_pos = %d\n", *(int*)object_table[object_id].copy_table[object_table[object_id].current_pos]);
-	object_table[object_id].copy_table[read_copy_index] = object_table[object_id].copy_table[loc_current_pos];
-	printf("data dans la structure object_table à read_copy_index = %d\n",  *(int*)object_table[object_id].copy_table[read_copy_index]);
-	if (READ_VECTOR_BIT(object_table[object_id].concurrency_vector, coreid_tx2))
-		break;
-
+    tpl_stm_end_tx(tx);
   }
-  while(1);
 
+  PROCESS_ERROR(result)
 
-  if ((INSTANCE(trans_table[coreid_tx2].status) == instance) && (STATUS(trans_table[coreid_tx2].status) < TXS_INACTIVE))
-  {
-	/* ATOMIC */
-	if (trans_table[coreid_tx1].read_set[object_id] == &object_table[object_id])
-		trans_table[coreid_tx1].read_set[object_id] = object_table[object_id].copy_table[read_copy_index];
-  }
-  printf("data dans la structure trans_table = %d\n", *(int*)trans_table[coreid_tx1].read_set[object_id]);
-};
+  UNLOCK_KERNEL()
 
+  return result;
+}
 
 /*
  * tpl_stm_open_read_object_service
  *
- * A read-set transaction opens for reading a given object
- *
- * object_id:  Object identifier
- *
- * data:  Data
- *
- * data_size:  Data size
- *
- * Return value:
- * E_OK:    No error (Standard & Extended)
- *
+ * See tpl_os_stm_kernel.h
  */
-FUNC(StatusType, OS_CODE) tpl_stm_open_read_object_service(CONST(ObjectType, AUTOMATIC) object_id, P2VAR(tpl_stm_data, AUTOMATIC, OS_APPL_DATA) data){
-
-uint32 instance;
-
-#if NUMBER_OF_CORES > 1
- GET_CURRENT_CORE_ID(core_id)
-#else
- uint32 core_id = 0;
-#endif
+FUNC(StatusType, OS_CODE) tpl_stm_open_read_object_service(
+  CONST(ObjectType, AUTOMATIC) object_id,
+  P2VAR(tpl_stm_data, AUTOMATIC, OS_APPL_DATA) data)
+{
+  VAR(StatusType, AUTOMATIC) result = E_OK;
+  P2VAR(tpl_stm_object, AUTOMATIC, OS_VAR) object;
+  P2VAR(tpl_stm_data, AUTOMATIC, OS_APPL_DATA) copy;
+  GET_STM_TX(tx_id, tx)
 
   LOCK_KERNEL()
 
-  printf("DEBUT : data pointée = %d, adresse pointée par data=%p\n", *(int*)data, data);
+  STORE_SERVICE(OSServiceId_STMOpenReadObject)
+
+  CHECK_STM_TX_ERROR(tx_id, result)
+  CHECK_STM_OBJECT_ID_ERROR(object_id, result)
+  CHECK_STM_ACTIVE_TX_ERROR(tx, TRUE, tx->writing, result)
+  CHECK_STM_READ_ACCESS_ERROR(tx, object_id, result)
 
-  if ((STATUS(trans_table[core_id].status) != TXS_IN_RETRY) && (UPDATE_FLAG(object_table[object_id].concurrency_vector)==1))
+  IF_NO_EXTENDED_ERROR(result)
   {
-	printf("Statut de la transaction différent de TXS_RETRY et update flag de l'objet à 1...\n");
-	update(writer_table[object_id], object_id);
+    object = &tpl_stm_object_table[object_id];
+
+    if (tx->write_vector & (1UL << object_id))
+    {
+      /* the transaction reads what it has written */
+      copy = object->copy_table[STM_WRITE_COPY];
+    }
+    else if ((object->writer == tx_id) &&
+             UPDATE_FLAG(object->concurrency_vector))
+    {
+      /*
+       * the writer reads its own delayed update, no other transaction can
+       * change it
+       */
+      copy = object->copy_table[
+        1 - CURRENT_OBJECT_POS(object->concurrency_vector)];
+    }
+    else
+    {
+      if ((tx->status != TXS_IN_RETRY) &&
+          UPDATE_FLAG(object->concurrency_vector))
+      {
+        /* help the writer to publish its update */
+        tpl_stm_publish(object->writer);
+      }
+      if (object->writer != tx_id)
+      {
+        object->concurrency_vector |= (1UL << tx_id);
+      }
+      copy = object->copy_table[CURRENT_OBJECT_POS(object->concurrency_vector)];
+    }
+    tx->read_vector |= (1UL << object_id);
+
+    tpl_stm_copy(data, copy, object->size);
   }
 
-  /* ATOMIC(&trans_table[core_id].read_set[object_id], NULL, &object_table[object_id]);  // inutile car déjà initialisé ainsi dans le template STM-HRT */
-  instance = INSTANCE(trans_table[core_id].status);
-  read_obj(core_id, core_id, object_id, instance);
-  SET_ACCESS_VECTOR(trans_table[core_id].access_vector, object_id);
-  printf("Data size = %zd\n", object_table[object_id].size);
-  memcpy(data, trans_table[core_id].read_set[object_id], object_table[object_id].size);
-
-  printf("FIN : data pointée = %d, adresse pointée par data=%p\n", *(int*)data, data);
+  PROCESS_ERROR(result)
 
   UNLOCK_KERNEL()
 
-};
+  return result;
+}
 
 /*
  * tpl_stm_open_write_object_service
  *
- * A write-set transaction opens for writing a given object
- *
- * object_id:  Object identifier
- *
- * data:  Data
- *
- * Return value:
- * E_OK:    No error (Standard & Extended)
- *
+ * See tpl_os_stm_kernel.h
  */
-FUNC(StatusType, OS_CODE) tpl_stm_open_write_object_service(CONST(ObjectType, AUTOMATIC) object_id, P2VAR(tpl_stm_data, AUTOMATIC, OS_APPL_DATA) data){
-
-#if NUMBER_OF_CORES > 1
- GET_CURRENT_CORE_ID(core_id)
-#else
- uint32 core_id = 0;
-#endif
+FUNC(StatusType, OS_CODE) tpl_stm_open_write_object_service(
+  CONST(ObjectType, AUTOMATIC) object_id,
+  P2VAR(tpl_stm_data, AUTOMATIC, OS_APPL_DATA) data)
+{
+  VAR(StatusType, AUTOMATIC) result = E_OK;
+  P2VAR(tpl_stm_object, AUTOMATIC, OS_VAR) object;
+  GET_STM_TX(tx_id, tx)
 
   LOCK_KERNEL()
 
-  memcpy(trans_table[core_id].write_set[object_id], data, object_table[object_id].size);
-  SET_UPDATE_FLAG(object_table[object_id].concurrency_vector);
-  SET_ACCESS_VECTOR(trans_table[core_id].access_vector, object_id);
+  STORE_SERVICE(OSServiceId_STMOpenWriteObject)
 
-  printf("Valeur data dans copy_table = %d\n", *(int*)trans_table[core_id].write_set[object_id]);
+  CHECK_STM_TX_ERROR(tx_id, result)
+  CHECK_STM_OBJECT_ID_ERROR(object_id, result)
+  CHECK_STM_ACTIVE_TX_ERROR(tx, TRUE, tx->writing, result)
+  CHECK_STM_WRITE_ACCESS_ERROR(tx, object_id, result)
+
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    object = &tpl_stm_object_table[object_id];
+    tpl_stm_copy(object->copy_table[STM_WRITE_COPY], data, object->size);
+    tx->write_vector |= (1UL << object_id);
+  }
+
+  PROCESS_ERROR(result)
 
   UNLOCK_KERNEL()
 
-};
+  return result;
+}
 
 /*
  * tpl_stm_commit_read_tx_service
  *
- * A read-set transaction tries to commit on a given core
- *
- * tx:  Transaction descriptor
- *
- * instance:  Transaction instance number
- *
- * Return value:
- * E_OK:    No error (Standard & Extended)
- *
+ * See tpl_os_stm_kernel.h
  */
-FUNC(StatusType, OS_CODE) tpl_stm_commit_read_tx_service(){
-};
+FUNC(StatusType, OS_CODE) tpl_stm_commit_read_tx_service(void)
+{
+  VAR(StatusType, AUTOMATIC) result = E_OK;
+  GET_STM_TX(tx_id, tx)
+
+  LOCK_KERNEL()
+
+  STORE_SERVICE(OSServiceId_STMCommitReadTx)
+
+  CHECK_STM_TX_ERROR(tx_id, result)
+  CHECK_STM_ACTIVE_TX_ERROR(tx, TRUE, FALSE, result)
+
+  /* a failed transaction is not an error, it is not reported */
+  PROCESS_ERROR(result)
+
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    result = tpl_stm_commit_tx(tx);
+  }
+
+  UNLOCK_KERNEL()
+
+  return result;
+}
 
 /*
  * tpl_stm_commit_write_tx_service
  *
- * A write-set transaction tries to commit on a given core
- *
- * tx:  Transaction descriptor
- *
- * Return value:
- * E_OK:    No error (Standard & Extended)
- *
+ * See tpl_os_stm_kernel.h
  */
-FUNC(StatusType, OS_CODE) tpl_stm_commit_write_tx_service(){
-};
+FUNC(StatusType, OS_CODE) tpl_stm_commit_write_tx_service(void)
+{
+  VAR(StatusType, AUTOMATIC) result = E_OK;
+  GET_STM_TX(tx_id, tx)
+
+  LOCK_KERNEL()
+
+  STORE_SERVICE(OSServiceId_STMCommitWriteTx)
+
+  CHECK_STM_TX_ERROR(tx_id, result)
+  CHECK_STM_ACTIVE_TX_ERROR(tx, TRUE, TRUE, result)
+
+  /* a failed transaction is not an error, it is not reported */
+  PROCESS_ERROR(result)
+
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    result = tpl_stm_commit_tx(tx);
+  }
+
+  UNLOCK_KERNEL()
+
+  return result;
+}
+
+#define OS_STOP_SEC_CODE
+#include "tpl_memmap.h"
 
+/* End of file tpl_os_stm_kernel.c */
@@ -1,9 +1,9 @@
 /*
- * @file tpl_os_stm.h
+ * @file tpl_os_stm_kernel.h
  *
  * @section desc File description
  *
- * Trampoline STM header file
+ * Trampoline STM kernel header file
  *
  * @section copyright Copyright
  *
@@ -22,204 +22,327 @@
  * $Author: audrey $
  * $URL: http://trampoline.rts-software.org/svn/trunk/os/tpl_os_stm.h $
  */
-/* #include "tpl_compiler.h" */
-#include "tpl_os_error.h" /* pour core_id */
 
-/* #include "tpl_os_stm.h" */
+#ifndef TPL_OS_STM_KERNEL_H
+#define TPL_OS_STM_KERNEL_H
+
+#include "tpl_os_error.h"
 #include "tpl_os_stm_internal_types.h"
 
+#define OS_START_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+
 /**
- * Array of all transaction descriptors (one per core)
- *
-  */
-extern VAR(tpl_stm_tx_descriptor, OS_APPL_DATA) trans_table[NUMBER_OF_CORES];
+ * Array of all transaction descriptors (one per task executing transactions)
+ */
+extern VAR(tpl_stm_tx_descriptor, OS_VAR)
+  tpl_stm_tx_table[NUMBER_OF_STM_TX];
 
 /**
- * Array of all STM-HRT objects
- *
-  */
-extern VAR(tpl_stm_object, OS_APPL_DATA) object_table[NUMBER_OF_OBJECTS];
+ * Array of all STM-HRT objects (indexed by object ids)
+ */
+extern VAR(tpl_stm_object, OS_VAR) tpl_stm_object_table[NUMBER_OF_OBJECTS];
+
+#define OS_STOP_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+
+#define OS_START_SEC_CONST_UNSPECIFIED
+#include "tpl_memmap.h"
 
 /**
- * Array of all transaction descriptors of writers
- *
-  */
-extern P2VAR(tpl_stm_tx_descriptor, AUTOMATIC, OS_APPL_DATA) writer_table[NUMBER_OF_OBJECTS];
+ * Transaction descriptor id of each process, #STM_NO_TX if the process
+ * executes no transaction (indexed by process ids)
+ */
+extern CONST(tpl_stm_tx_id, OS_CONST)
+  tpl_stm_tx_id_table[TASK_COUNT + ISR_COUNT];
 
+#define OS_STOP_SEC_CONST_UNSPECIFIED
+#include "tpl_memmap.h"
 
 /********************************************************************************
 *				Macros						*
 *										*
 ********************************************************************************/
-#define INSTANCE(status)			((status >> 2) & 0xFFFFFFFF)
-#define STATUS(status)				(status & 3)
-
-#define CURRENT_OBJECT_POS(concurrency_vector)	((concurrency_vector >> 30) & 1u )
-#define UPDATE_FLAG(concurrency_vector)		((concurrency_vector >> 31) & 1u )
-#define READ_VECTOR(concurrency_vector)		((concurrency_vector & NUMBER_OF_CORES))
-#define FAIL_VECTOR(concurrency_vector)		((concurrency_vector >> NUMBER_OF_CORES) & (POW2_NUMBER_OF_CORES-1))
-
-#define SET_READ_VECTOR(concurrency_vector, core_id) 	concurrency_vector = (concurrency_vector | (1u << (core_id)))
-#define READ_VECTOR_BIT(concurrency_vector, core_id) 	((concurrency_vector >> core_id) & 1u )
-
-#define SET_FAIL_VECTOR(concurrency_vector, core_id) 	concurrency_vector = (concurrency_vector | (1u << (NUMBER_OF_CORES + core_id)))
-
-#define POW2_NUMBER_OF_CORES (1 << NUMBER_OF_CORES)
-
-#define SET_UPDATE_FLAG(concurrency_vector)	concurrency_vector = (concurrency_vector |  (1u << 31))
-
-#define SET_ACCESS_VECTOR(access_vector, object_id) 	access_vector = (access_vector | (1u  << object_id))
-
+#define STM_UPDATE_FLAG           0x80000000UL
+#define STM_CURRENT_POS           0x40000000UL
+#define STM_READ_VECTOR           ((1UL << NUMBER_OF_STM_TX) - 1UL)
 
+#define CURRENT_OBJECT_POS(concurrency_vector)	(((concurrency_vector) >> 30) & 1u)
+#define UPDATE_FLAG(concurrency_vector)		(((concurrency_vector) >> 31) & 1u)
+#define READ_VECTOR(concurrency_vector)		((concurrency_vector) & STM_READ_VECTOR)
+#define READ_VECTOR_BIT(concurrency_vector, tx_id)	(((concurrency_vector) >> (tx_id)) & 1u)
 
+/*
+ * GET_STM_TX defines the tx_id constant, the transaction descriptor id of
+ * the running process, and tx, a pointer to its descriptor. tx_id is
+ * #STM_NO_TX if the running process executes no transaction.
+ */
+#define GET_STM_TX(a_tx_id, a_tx)                                       \
+  GET_CURRENT_CORE_ID(core_id)                                          \
+  CONST(tpl_stm_tx_id, AUTOMATIC) a_tx_id =                             \
+    tpl_stm_tx_id_table[TPL_KERN(core_id).running_id];                  \
+  CONSTP2VAR(tpl_stm_tx_descriptor, AUTOMATIC, OS_VAR) a_tx =           \
+    &tpl_stm_tx_table[a_tx_id];
 
-/********************************************************************************
-*				Functions					*
-*										*
-********************************************************************************/
 /**
- * @internal
- *
- * Displays on screen the message given as an argument
+ * @def CHECK_STM_TX_ERROR
  *
- * @param   msg     message to display
+ * Checks the running process executes transactions, i.e. it is the TASK of
+ * an OIL TRANSACTION object.
  *
- * @retval  E_OK        no error
+ * @param tx_id     the descriptor id of the running process
+ * @param result    error code variable to set (StatusType)
  *
+ * @note this checking is disabled if WITH_OS_EXTENDED == NO
  */
-FUNC(StatusType, OS_CODE) tpl_screen_display_service(
-  P2CONST(char, AUTOMATIC, OS_APPL_DATA) msg);
+#if WITH_OS_EXTENDED == YES
+# define CHECK_STM_TX_ERROR(tx_id,result)                       \
+  if ((result == (tpl_status)E_OK) &&                           \
+      ((tx_id) == (tpl_stm_tx_id)STM_NO_TX))                    \
+  {                                                             \
+    result = (tpl_status)E_OS_ACCESS;                           \
+  }
+#else
+# define CHECK_STM_TX_ERROR(tx_id,result)
+#endif
 
-/*
- * tpl_stm_begin_read_tx_service
+/**
+ * @def CHECK_STM_OBJECT_ID_ERROR
  *
- * Initializes a read-set transaction
+ * Checks the object id is in range.
  *
- * Return value:
- * E_OK:    No error (Standard & Extended)
+ * @param object_id the #ObjectType to check
+ * @param result    error code variable to set (StatusType)
  *
+ * @note this checking is disabled if WITH_OS_EXTENDED == NO
  */
-FUNC(StatusType, OS_CODE) tpl_stm_begin_read_tx_service();
+#if WITH_OS_EXTENDED == YES
+# define CHECK_STM_OBJECT_ID_ERROR(object_id,result)            \
+  if ((result == (tpl_status)E_OK) &&                           \
+      ((object_id) >= (tpl_stm_object_id)NUMBER_OF_OBJECTS))    \
+  {                                                             \
+    result = (tpl_status)E_OS_ID;                               \
+  }
+#else
+# define CHECK_STM_OBJECT_ID_ERROR(object_id,result)
+#endif
 
-/*
- * tpl_stm_begin_write_tx_service
- *
- * Initializes a write-set transaction on the core given as an argument
- *
- * tx:  Transaction descriptor
+/**
+ * @def CHECK_STM_ACTIVE_TX_ERROR
  *
- * coreId:  Core on which the write-set transaction begins
+ * Checks the transaction of the task has begun (active is TRUE) or has not
+ * (active is FALSE) and, if it is active, is of the expected kind.
  *
- * Return value:
- * E_OK:    No error (Standard & Extended)
+ * @param tx        the transaction descriptor
+ * @param active    TRUE if the transaction should be active
+ * @param write     TRUE if the transaction should be a write-set one
+ * @param result    error code variable to set (StatusType)
  *
+ * @note this checking is disabled if WITH_OS_EXTENDED == NO
  */
-FUNC(StatusType, OS_CODE) tpl_stm_begin_write_tx_service();
+#if WITH_OS_EXTENDED == YES
+# define CHECK_STM_ACTIVE_TX_ERROR(tx,active,write,result)      \
+  if ((result == (tpl_status)E_OK) &&                           \
+      ((((tx)->status != TXS_INACTIVE) != (active)) ||          \
+       ((active) && ((tx)->writing != (write)))))               \
+  {                                                             \
+    result = (tpl_status)E_OS_STATE;                            \
+  }
+#else
+# define CHECK_STM_ACTIVE_TX_ERROR(tx,active,write,result)
+#endif
 
-/*
- * tpl_stm_end_read_tx_service
- *
- * Ends a read-set transaction
+/**
+ * @def CHECK_STM_READ_ACCESS_ERROR
  *
- * tx:  Transaction descriptor
+ * Checks the transactions of the task may read the object according to the
+ * READ_SET and WRITE_SET of the OIL TRANSACTION objects.
  *
- * Return value:
- * E_OK:    No error (Standard & Extended)
+ * @param tx        the transaction descriptor
+ * @param object_id the #ObjectType to check
+ * @param result    error code variable to set (StatusType)
  *
+ * @note this checking is disabled if WITH_OS_EXTENDED == NO
  */
-FUNC(StatusType, OS_CODE) tpl_stm_end_read_tx_service();
+#if WITH_OS_EXTENDED == YES
+# define CHECK_STM_READ_ACCESS_ERROR(tx,object_id,result)       \
+  if ((result == (tpl_status)E_OK) &&                           \
+      (((tx)->read_set & (1UL << (object_id))) == 0))           \
+  {                                                             \
+    result = (tpl_status)E_OS_ACCESS;                           \
+  }
+#else
+# define CHECK_STM_READ_ACCESS_ERROR(tx,object_id,result)
+#endif
 
-/*
- * tpl_stm_end_write_tx_service
- *
- * Ends a write-set transaction
+/**
+ * @def CHECK_STM_WRITE_ACCESS_ERROR
  *
- * tx:  Transaction descriptor
+ * Checks the transaction is a write-set one and is the writer of the object.
  *
- * Return value:
- * E_OK:    No error (Standard & Extended)
+ * @param tx        the transaction descriptor
+ * @param object_id the #ObjectType to check
+ * @param result    error code variable to set (StatusType)
  *
+ * @note this checking is disabled if WITH_OS_EXTENDED == NO
  */
-FUNC(StatusType, OS_CODE) tpl_stm_end_write_tx_service();
+#if WITH_OS_EXTENDED == YES
+# define CHECK_STM_WRITE_ACCESS_ERROR(tx,object_id,result)      \
+  if ((result == (tpl_status)E_OK) &&                           \
+      ((!(tx)->writing) ||                                      \
+       (tpl_stm_object_table[object_id].writer != (tx)->tx_id)))   \
+  {                                                             \
+    result = (tpl_status)E_OS_ACCESS;                           \
+  }
+#else
+# define CHECK_STM_WRITE_ACCESS_ERROR(tx,object_id,result)
+#endif
 
-/*
+/********************************************************************************
+*				Functions					*
+*										*
+********************************************************************************/
+
+#define OS_START_SEC_CODE
+#include "tpl_memmap.h"
+
+/**
  * @internal
  *
- * read_obj
+ * Begins a read-set transaction for the running task. If the
+ * previous transaction of the task failed, this one is its retry and cannot fail.
  *
- * A write-set transaction is ready to update an object
+ * @retval  E_OK        no error
+ * @retval  E_OS_STATE  a transaction of the task is already in progress
+ *                      (extended error checking only)
+ * @retval  E_OS_ACCESS the running process executes no transaction
+ *                      (extended error checking only)
+ */
+FUNC(StatusType, OS_CODE) tpl_stm_begin_read_tx_service(void);
+
+/**
+ * @internal
  *
- * tx:  Transaction descriptor
+ * Begins a write-set transaction for the running task. If the
+ * previous transaction of the task failed, this one is its retry and cannot fail.
  *
- * object_id:  Object identifier
+ * @retval  E_OK        no error
+ * @retval  E_OS_STATE  a transaction of the task is already in progress
+ *                      (extended error checking only)
+ * @retval  E_OS_ACCESS the running process executes no transaction
+ *                      (extended error checking only)
+ */
+FUNC(StatusType, OS_CODE) tpl_stm_begin_write_tx_service(void);
+
+/**
+ * @internal
  *
- * Return value:
- * E_OK:    No error (Standard & Extended)
+ * Ends the read-set transaction of the running task without committing it.
  *
+ * @retval  E_OK        no error
+ * @retval  E_OS_STATE  no read-set transaction of the task is in progress
+ *                      (extended error checking only)
+ * @retval  E_OS_ACCESS the running process executes no transaction
+ *                      (extended error checking only)
  */
-FUNC(StatusType, OS_CODE) read_obj(CONST(tpl_stm_core_id, OS_APPL_DATA) coreid_tx1, CONST(tpl_stm_core_id, OS_APPL_DATA) coreid_tx2, CONST(ObjectType, AUTOMATIC) object_id, CONST(uint32, AUTOMATIC) instance);
-
+FUNC(StatusType, OS_CODE) tpl_stm_end_read_tx_service(void);
 
-/*
- * tpl_stm_open_read_object_service
- *
- * A read-set transaction opens for reading a given object
+/**
+ * @internal
  *
- * object_id:  Object identifier
+ * Ends the write-set transaction of the running task without committing
+ * it. The data written by the transaction are discarded.
  *
- * data:  Data
+ * @retval  E_OK        no error
+ * @retval  E_OS_STATE  no write-set transaction of the task is in progress
+ *                      (extended error checking only)
+ * @retval  E_OS_ACCESS the running process executes no transaction
+ *                      (extended error checking only)
+ */
+FUNC(StatusType, OS_CODE) tpl_stm_end_write_tx_service(void);
+
+/**
+ * @internal
  *
- * data_size:  Data size
+ * Copies the data of an object into the buffer of the application. A
+ * transaction which is not in retry first helps the pending update of the
+ * object to be published.
  *
- * Return value:
- * E_OK:    No error (Standard & Extended)
+ * @param   object_id   the object
+ * @param   data        buffer receiving the data of the object
  *
+ * @retval  E_OK        no error
+ * @retval  E_OS_ID     invalid object (extended error checking only)
+ * @retval  E_OS_STATE  no transaction of the task is in progress
+ *                      (extended error checking only)
+ * @retval  E_OS_ACCESS the object is not in the read set or in the write set
+ *                      of the transactions of the task, or the running
+ *                      process executes no transaction (extended error
+ *                      checking only)
  */
 FUNC(StatusType, OS_CODE) tpl_stm_open_read_object_service(
   CONST(ObjectType, AUTOMATIC) object_id,
   P2VAR(tpl_stm_data, AUTOMATIC, OS_APPL_DATA) data);
 
- /*
- * tpl_stm_open_write_object_service
- *
- * A write-set transaction opens for writing a given object
- *
- * object_id:  Object identifier
+/**
+ * @internal
  *
- * data:  Data
+ * Copies the data of the application into the write copy of an object. The
+ * object is updated when the transaction commits.
  *
- * Return value:
- * E_OK:    No error (Standard & Extended)
+ * @param   object_id   the object
+ * @param   data        buffer holding the new data of the object
  *
+ * @retval  E_OK        no error
+ * @retval  E_OS_ID     invalid object (extended error checking only)
+ * @retval  E_OS_STATE  no transaction of the task is in progress
+ *                      (extended error checking only)
+ * @retval  E_OS_ACCESS the transaction is a read-set one or the object is
+ *                      not in the write set of the transactions of the task,
+ *                      or the running process executes no transaction
+ *                      (extended error checking only)
  */
-FUNC(StatusType, OS_CODE) tpl_stm_open_write_object_service(CONST(ObjectType, AUTOMATIC) object_id, P2VAR(tpl_stm_data, AUTOMATIC, OS_APPL_DATA) data);
+FUNC(StatusType, OS_CODE) tpl_stm_open_write_object_service(
+  CONST(ObjectType, AUTOMATIC) object_id,
+  P2VAR(tpl_stm_data, AUTOMATIC, OS_APPL_DATA) data);
 
-/*
- * tpl_stm_commit_read_tx_service
- *
- * A read-set transaction tries to commit on a given core
- *
- * tx:  Transaction descriptor
- *
- * instance:  Transaction instance number
+/**
+ * @internal
  *
- * Return value:
- * E_OK:    No error (Standard & Extended)
+ * Commits the read-set transaction of the running task.
  *
+ * @retval  E_OK            the transaction is committed
+ * @retval  E_OS_STM_RETRY  an object read by the transaction has been
+ *                          updated, the transaction has to be executed
+ *                          again. The error hook is not called.
+ * @retval  E_OS_STATE      no read-set transaction of the task is in
+ *                          progress (extended error checking only)
+ * @retval  E_OS_ACCESS     the running process executes no transaction
+ *                          (extended error checking only)
  */
-FUNC(StatusType, OS_CODE) tpl_stm_commit_read_tx_service();
+FUNC(StatusType, OS_CODE) tpl_stm_commit_read_tx_service(void);
 
-/*
- * tpl_stm_commit_write_tx_service
- *
- * A write-set transaction tries to commit on a given core
- *
- * tx:  Transaction descriptor
- *
- * Return value:
- * E_OK:    No error (Standard & Extended)
+/**
+ * @internal
  *
+ * Commits the write-set transaction of the running task. The objects it
+ * has written are updated together as soon as no transaction in retry has
+ * read one of them.
+ *
+ * @retval  E_OK            the transaction is committed
+ * @retval  E_OS_STM_RETRY  an object read by the transaction has been
+ *                          updated, the transaction has to be executed
+ *                          again. The error hook is not called.
+ * @retval  E_OS_STATE      no write-set transaction of the task is in
+ *                          progress (extended error checking only)
+ * @retval  E_OS_ACCESS     the running process executes no transaction
+ *                          (extended error checking only)
  */
-FUNC(StatusType, OS_CODE) tpl_stm_commit_write_tx_service();
+FUNC(StatusType, OS_CODE) tpl_stm_commit_write_tx_service(void);
+
+#define OS_STOP_SEC_CODE
+#include "tpl_memmap.h"
 
+#endif /* TPL_OS_STM_KERNEL_H */
 
+/* End of file tpl_os_stm_kernel.h */
@@ -23,7 +23,10 @@
  * $URL$
  */
 
-#include "tpl_os_internal_types.h" /* pour tpl_core_id */
+#ifndef TPL_OS_STM_TYPES_H
+#define TPL_OS_STM_TYPES_H
+
+#include "tpl_os_internal_types.h"
 
 /**
  * @typedef tpl_stm_object_id
@@ -49,3 +52,6 @@ typedef void tpl_stm_data;
 
 #define DeclareObject(object_id) extern CONST(ObjectType, AUTOMATIC) object_id
 
+#endif /* TPL_OS_STM_TYPES_H */
+
+/* End of file tpl_os_stm_types.h */
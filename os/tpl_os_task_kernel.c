@@ -83,12 +83,22 @@ FUNC(StatusType, OS_CODE) tpl_activate_task_service(
 
     DOW_DO(printf("*S* ActivateTask\n"));
 
-    result = tpl_activate_task(task_id);
-    if (TPL_KERN(proc_core_id).need_schedule)
+#if NUMBER_OF_CORES > 1
+    if (proc_core_id != core_id)
+    {
+      /* the core of the task activates it and reschedules */
+      result = tpl_request_remote_activation(task_id);
+    }
+    else
+#endif
     {
-      tpl_schedule_from_running(CORE_ID_OR_NOTHING(proc_core_id));
-      DOW_DO(printf("*S* ActivateTask - rescheduling done\n"));
-      SWITCH_CONTEXT(CORE_ID_OR_NOTHING(proc_core_id))
+      result = tpl_activate_task(task_id);
+      if (TPL_KERN(proc_core_id).need_schedule)
+      {
+        tpl_schedule_from_running(CORE_ID_OR_NOTHING(proc_core_id));
+        DOW_DO(printf("*S* ActivateTask - rescheduling done\n"));
+        SWITCH_CONTEXT(CORE_ID_OR_NOTHING(proc_core_id))
+      }
     }
   }
 #endif
@@ -185,29 +195,21 @@ FUNC(StatusType, OS_CODE) tpl_chain_task_service(
 
     DOW_DO(printf("*S* ChainTask\n"));
 
-    /* activate the chained task */
-    result = tpl_activate_task(task_id);
-
-    if (result == E_OK)
-    {
-      /*
-       * This first part deals with the case of an activated task
-       * on a remote core
-       */
-
-      /* get the core id of the newly activated task */
-      GET_PROC_CORE_ID(task_id, activated_task_core_id)
+    /* activate the chained task. A task of another core is activated
+       by its core which does the rescheduling */
 #if NUMBER_OF_CORES > 1
-      if (activated_task_core_id != core_id)
-      {
-        REMOTE_SWITCH_CONTEXT(activated_task_core_id);
-      }
+    if (TPL_STAT_PROC(task_id)->core_id != core_id)
+    {
+      result = tpl_request_remote_activation(task_id);
+    }
+    else
 #endif
+    {
+      result = tpl_activate_task(task_id);
+    }
 
-      /*
-       * This second part deals with the local rescheduling due to
-       * the termination of the task
-       */
+    if (result == E_OK)
+    {
 
       /* terminate the running task */
       tpl_terminate();
@@ -358,7 +360,7 @@ FUNC(StatusType, OS_CODE) tpl_get_task_state_service(
 #if TASK_COUNT > 0
   IF_NO_EXTENDED_ERROR(result)
   {
-    *state = (tpl_dyn_proc_table[task_id]->state) & 0x3;
+    *state = (TPL_DYN_PROC(task_id)->state) & 0x3;
   }
 #endif
 
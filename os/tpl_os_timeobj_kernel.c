@@ -30,6 +30,7 @@
 #include "tpl_os_definitions.h"
 #include "tpl_debug.h"
 #include "tpl_trace.h"
+#include "tpl_os_alarm_kernel.h"
 
 #if WITH_AUTOSAR == YES
 #include "tpl_as_definitions.h"
@@ -290,16 +291,10 @@ STATIC FUNC(P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA), OS_CODE) tpl_remove_ti
 }
 
 /*
- * tpl_counter_tick is called by the IT associated with a counter
- * The param is a pointer to the counter
- * It increment the counter tick and the counter value if needed
- * If the counter value is incremented, it checks the next alarm
- * date and raises alarms at that date.
- *
- * suggested modification by Seb - 2005-02-01
+ * tpl_raise_time_objs processes the time objects of a counter that
+ * expire at the current date of the counter. The date of the counter
+ * must be equal to the date of its next_to.
  *
- * Update: 2006-12-10: Does not perform the rescheduling.
- *  tpl_schedule must be called explicitly
  * Bug fix:jlb:2008-09-25
  *  When 2 alarms or more were scheduled at the same date and their cycle
  *  was also the same, tpl_counter_tick went into an infinite loop because
@@ -307,15 +302,12 @@ STATIC FUNC(P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA), OS_CODE) tpl_remove_ti
  *  max_allowed_value. Now, the alarms at the same date are removed
  *  from the queue by tpl_remove_timeobj_set before being processed.
  */
-extern FUNC(void, OS_CODE) printrl(P2VAR(char, AUTOMATIC, OS_APPL_DATA) msg);
-
-FUNC(void, OS_CODE) tpl_counter_tick(
+STATIC FUNC(void, OS_CODE) tpl_raise_time_objs(
   P2VAR(tpl_counter, AUTOMATIC, OS_APPL_DATA) counter)
 {
   P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA)  t_obj;
-  /* temporary pointeur to adjust the next object of a counter when the first time
-     object at a date is a "BOOTSTRAP" time object (for schedule table only) */
-  P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA) real_next_to_temp;
+#if (WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0) && \
+    (WITH_STATIC_EXPIRY == NO)
   /*
    * A non constant function pointer is used
    * This violate MISRA rule 104. This is used to call
@@ -323,17 +315,93 @@ FUNC(void, OS_CODE) tpl_counter_tick(
    * because only 3 function can be pointed to.
    */
   VAR(tpl_expire_func, AUTOMATIC)               expire;
-  VAR(tpl_tick, AUTOMATIC)                      date;
+#endif
   /* this variable is added because the same name was used twice in this function for
    2 different variables, this behavior was dependent on the compiler */
   VAR(tpl_tick, AUTOMATIC)                      new_date;
 
+  /*  extract the time object with this date
+   from the list. (if object from schedule
+   table has been BOOTSTRAP, don't process
+   the expiry point(s))								*/
+
+  /* save the "real one" next_to (in case of a schedule table,
+   if the first time object is a BOOTSTRAP, change the next_to's
+   counter to the first time object "NO BOOTSTRAP" otherwise, the
+   time object BOOSTRAP is inserted in the list because of its
+   cycle (after launching actions below). */
+  t_obj = tpl_remove_timeobj_set(counter);
+
+  /*launch time objects' actions*/
+  while (t_obj != NULL)
+  {
+    /*  get the next one                        */
+    tpl_time_obj *next_to = t_obj->next_to;
+    TRACE_TIMEOBJ_EXPIRE(t_obj->stat_part->id)
+#if WITH_STATIC_EXPIRY == YES
+    /*  expiry processing generated by goil     */
+    tpl_expire_time_obj(t_obj);
+#elif (WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)
+    expire = t_obj->stat_part->expire;
+    expire(t_obj);
+#elif ALARM_COUNT > 0
+    /*  without schedule table, every time object is an alarm */
+    tpl_raise_alarm(t_obj);
+#endif
+    /*  rearm the alarm if needed               */
+
+    if (t_obj->cycle != 0)
+    {
+      /*  if the cycle is not 0, the new date
+       is computed by adding the cycle to
+       the current date                      */
+      new_date = t_obj->date + t_obj->cycle;
+      if (new_date > counter->max_allowed_value)
+      {
+        new_date -= (counter->max_allowed_value + 1);
+      }
+      t_obj->date = new_date;
+
+      /*  and the alarm is put back in the alarm
+       queue of the counter it belongs to    */
+      tpl_insert_time_obj(t_obj);
+    }
+    else {
+      t_obj->state = TIME_OBJ_SLEEP;
+      TRACE_TIMEOBJ_CHANGE_STATE(t_obj->stat_part->id, TIME_OBJ_SLEEP)
+    }
+    t_obj = next_to;
+  }
+}
+
+/*
+ * tpl_counter_tick is called by the IT associated with a counter
+ * The param is a pointer to the counter
+ * It increment the counter tick and the counter value if needed
+ * If the counter value is incremented, it checks the next alarm
+ * date and raises alarms at that date.
+ *
+ * suggested modification by Seb - 2005-02-01
+ *
+ * Update: 2006-12-10: Does not perform the rescheduling.
+ *  tpl_schedule must be called explicitly
+ */
+extern FUNC(void, OS_CODE) printrl(P2VAR(char, AUTOMATIC, OS_APPL_DATA) msg);
+
+FUNC(void, OS_CODE) tpl_counter_tick(
+  P2VAR(tpl_counter, AUTOMATIC, OS_APPL_DATA) counter)
+{
+  P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA)  t_obj;
+  VAR(tpl_tick, AUTOMATIC)                      date;
+
   if (tpl_counters_enabled)
   {
+#if WITH_TICKS_PER_BASE == YES
     /*  inc the current tick value of the counter     */
     counter->current_tick++;
     /*  if tickperbase is reached, the counter is inc */
     if (counter->current_tick == counter->ticks_per_base)
+#endif
     {
       date = counter->current_date;
       date++;
@@ -342,7 +410,9 @@ FUNC(void, OS_CODE) tpl_counter_tick(
         date = 0;
       }
       counter->current_date = date;
+#if WITH_TICKS_PER_BASE == YES
       counter->current_tick = 0;
+#endif
 
       /*  check if the counter has reached the
        next alarm activation date                  */
@@ -351,58 +421,104 @@ FUNC(void, OS_CODE) tpl_counter_tick(
       if ((t_obj != NULL) && (t_obj->date == date))
       {
         /*  the date of the counter has reached
-         the date of the next time obj.
-         extract the time object with this date
-         from the list. (if object from schedule
-         table has been BOOTSTRAP, don't process
-         the expiry point(s))								*/
+         the date of the next time obj.         */
+        tpl_raise_time_objs(counter);
+      }
+    }
+  }
+}
+
+/*
+ * tpl_advance_counter has the same effect as calling tpl_counter_tick
+ * ticks times in a row. Instead of walking every tick, the date of the
+ * counter jumps from one expiry date to the next one, so the cost is
+ * proportional to the number of expiries and not to the number of ticks.
+ * Cyclic time objects rearmed during the advance are processed again if
+ * their new date is reached before the end of the advance.
+ */
+FUNC(void, OS_CODE) tpl_advance_counter(
+  P2VAR(tpl_counter, AUTOMATIC, OS_APPL_DATA) counter,
+  VAR(tpl_tick, AUTOMATIC)                    ticks)
+{
+  P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA)  t_obj;
+  VAR(tpl_tick, AUTOMATIC)                      increments;
+  VAR(tpl_tick, AUTOMATIC)                      tick;
+  VAR(tpl_tick, AUTOMATIC)                      distance = 0;
+  VAR(tpl_tick, AUTOMATIC)                      date;
+  VAR(tpl_tick, AUTOMATIC)                      max = counter->max_allowed_value;
 
-        real_next_to_temp = tpl_remove_timeobj_set(counter);
+  if (tpl_counters_enabled)
+  {
+#if WITH_TICKS_PER_BASE == YES
+    /*  split the ticks in increments of the counter value and
+        remaining ticks. The tick count never exceeds ticks_per_base */
+    increments = ticks / counter->ticks_per_base;
+    tick = counter->current_tick + (ticks % counter->ticks_per_base);
+    if (tick >= counter->ticks_per_base)
+    {
+      tick -= counter->ticks_per_base;
+      increments++;
+    }
+#else
+    /*  every counter has a ticks_per_base of 1 */
+    increments = ticks;
+    tick = 0;
+#endif
+    /*  as in tpl_counter_tick, time objects are raised with a tick
+        count of 0. The remaining ticks are added at the end         */
+    if (increments > 0)
+    {
+      counter->current_tick = 0;
+    }
 
-        if( real_next_to_temp != NULL)
+    while (increments > 0)
+    {
+      date = counter->current_date;
+      t_obj = counter->next_to;
+
+      /*  number of increments to reach the next time object. A time
+          object at the current date expires after a full revolution.
+          If the full revolution does not fit in a tpl_tick, distance
+          wraps to 0 and is larger than any number of increments.     */
+      if (t_obj != NULL)
+      {
+        if (t_obj->date > date)
         {
-          /* save the "real one" next_to (in case of a schedule table,
-           if the first time object is a BOOTSTRAP, change the next_to's
-           counter to the first time object "NO BOOTSTRAP" otherwise, the
-           time object BOOSTRAP is inserted in the list because of its
-           cycle (after launching actions below). */
-          t_obj = real_next_to_temp;
-
-          /*launch time objects' actions*/
-          do
-          {
-            /*  get the next one                        */
-            tpl_time_obj *next_to = t_obj->next_to;
-            expire = t_obj->stat_part->expire;
-            TRACE_TIMEOBJ_EXPIRE(t_obj->stat_part->id)
-            expire(t_obj);
-            /*  rearm the alarm if needed               */
-
-            if (t_obj->cycle != 0)
-            {
-              /*  if the cycle is not 0, the new date
-               is computed by adding the cycle to
-               the current date                      */
-              new_date = t_obj->date + t_obj->cycle;
-              if (new_date > counter->max_allowed_value)
-              {
-                new_date -= (counter->max_allowed_value + 1);
-              }
-              t_obj->date = new_date;
-
-              /*  and the alarm is put back in the alarm
-               queue of the counter it belongs to    */
-              tpl_insert_time_obj(t_obj);
-            }
-            else {
-              t_obj->state = TIME_OBJ_SLEEP;
-              TRACE_TIMEOBJ_CHANGE_STATE(t_obj->stat_part->id, TIME_OBJ_SLEEP)
-            }
-            t_obj = next_to;
-          } while (t_obj != NULL);
+          distance = t_obj->date - date;
+        }
+        else
+        {
+          distance = (max - date) + t_obj->date + 1;
         }
       }
+
+      if ((t_obj == NULL) || (distance == 0) || (distance > increments))
+      {
+        /*  no expiry before the end: jump to the final date  */
+        if (max < (tpl_tick)(-1))
+        {
+          increments %= (max + 1);
+        }
+        if (increments > (max - date))
+        {
+          date = increments - (max - date) - 1;
+        }
+        else
+        {
+          date += increments;
+        }
+        counter->current_date = date;
+        increments = 0;
+      }
+      else
+      {
+        /*  jump to the date of the next time object and raise it   */
+        counter->current_date = t_obj->date;
+        increments -= distance;
+        tpl_raise_time_objs(counter);
+      }
     }
+    counter->current_tick = tick;
   }
 }
 
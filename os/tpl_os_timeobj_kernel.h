@@ -70,10 +70,11 @@ struct TPL_TIME_OBJ_STATIC {
   CONST(tpl_expire_func, TYPEDEF)
     expire;       /**<  expiration processing to be done when the time object
                     expires                                                   */
-#if (WITH_ID == YES)
+#if (WITH_ID == YES) || (WITH_STATIC_EXPIRY == YES)
   CONST(tpl_timeobj_id, TYPEDEF)
     id;   /**<  the id of the alarm or schedule table. This id
-                        is used for tracing the kernel                        */
+                        is used for tracing the kernel and by the
+                        generated expiry processing                           */
 #endif
 #if WITH_OSAPPLICATION == YES
   CONST(tpl_app_id, TYPEDEF)
@@ -220,6 +221,39 @@ FUNC(void, OS_CODE) tpl_remove_time_obj(
 FUNC(void, OS_CODE) tpl_counter_tick(
     P2VAR(tpl_counter, AUTOMATIC, OS_APPL_DATA) counter);
 
+/**
+ * @internal
+ *
+ * tpl_advance_counter advances a counter by several ticks at once, with
+ * the same result as calling #tpl_counter_tick ticks times. It jumps
+ * directly from one expiry date to the next one, raising the time
+ * objects that expire in between in date order, including the cyclic
+ * ones rearmed during the advance. It is used to catch up ticks missed
+ * after a long interrupt lock or to accelerate a simulation.
+ * It does not perform the rescheduling, tpl_schedule must be called
+ * explicitly.
+ *
+ * @param counter    A pointer to the counter
+ * @param ticks      The number of ticks to advance
+ */
+FUNC(void, OS_CODE) tpl_advance_counter(
+    P2VAR(tpl_counter, AUTOMATIC, OS_APPL_DATA) counter,
+    VAR(tpl_tick, AUTOMATIC) ticks);
+
+#if WITH_STATIC_EXPIRY == YES
+/**
+ * @internal
+ *
+ * tpl_expire_time_obj is generated by goil. It processes the expiry of a
+ * time object by a switch on its id calling the action of the alarms
+ * directly instead of through the expire and action function pointers.
+ *
+ * @param time_obj   A pointer to the time object that expires
+ */
+FUNC(void, OS_CODE) tpl_expire_time_obj(
+  P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA) time_obj);
+#endif
+
 #if TPL_OPTIMIZE_TICKS == YES
 FUNC(tpl_tick, OS_CODE) tpl_time_before_next_tick(
   P2VAR(tpl_counter, AUTOMATIC, OS_APPL_DATA) counter);
@@ -0,0 +1,99 @@
+#! /bin/sh
+
+#
+# @file gtl_diff.sh
+#
+# @section desc File description
+#
+# Differential test of the GTL interpreter. Every OIL file found in the
+# given directories is generated with a reference goil and with the goil
+# under test, using the same templates, and the outputs are compared.
+# The reference is usually a goil built before a change of the template
+# engine, for instance one without the folding of constant expressions,
+# so that both ways of evaluating the templates are checked against
+# each other.
+#
+# usage: gtl_diff.sh <reference goil> <tested goil> [directory...]
+#
+# The directories default to examples/posix. GOIL_TARGET and
+# GOIL_TEMPLATES may be set to change the target and the templates
+# (posix/linux and goil/templates by default). GOIL_OPTIONS is given to
+# both goil, for instance --footprint to run the footprint templates too.
+# Generated files are kept in the directory given by GTL_DIFF_DIR
+# (a temporary directory by default).
+#
+# @section copyright Copyright
+#
+# Trampoline Test Suite
+#
+# Trampoline Test Suite is copyright (c) IRCCyN 2005-2007
+# Trampoline Test Suite is protected by the French intellectual property law.
+#
+# This program is free software; you can redistribute it and/or
+# modify it under the terms of the GNU General Public License
+# as published by the Free Software Foundation; version 2
+# of the License.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; if not, write to the Free Software
+# Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+#
+# @section infos File informations
+#
+# $Date$
+# $Rev$
+# $Author$
+# $URL$
+#
+
+SCRIPT_DIR=$(cd $(dirname $0) && pwd -P)
+TPL_DIR=$(cd $SCRIPT_DIR/../.. && pwd -P)
+
+if [ $# -lt 2 ]; then
+  echo "usage: $0 <reference goil> <tested goil> [directory...]"
+  exit 2
+fi
+REF_GOIL=$1
+NEW_GOIL=$2
+shift 2
+DIRS=${*:-$TPL_DIR/examples/posix}
+TARGET=${GOIL_TARGET:-posix/linux}
+TEMPLATES=${GOIL_TEMPLATES:-$TPL_DIR/goil/templates}
+WORK_DIR=${GTL_DIFF_DIR:-$(mktemp -d)}
+
+# Lines that change from one run to the other
+IGNORED="-I generated.by.goil.on -I Automatically.generated"
+
+count=0
+failures=0
+for oil in $(find $DIRS -name "*.oil" | sort); do
+  src=$(dirname $oil)
+  name=$(echo ${src#$TPL_DIR/} | tr "/" "_")_$(basename $oil .oil)
+  # Both goil run in the same directory so that the paths written in
+  # the generated files are the same
+  for v in ref new; do
+    run=$WORK_DIR/run/$name
+    rm -rf $run $WORK_DIR/$v/$name
+    mkdir -p $run $WORK_DIR/$v
+    cp $src/*.oil $run
+    if [ "$v" = "ref" ]; then goil=$REF_GOIL; else goil=$NEW_GOIL; fi
+    (cd $run && $goil --no-color --target=$TARGET --templates=$TEMPLATES $GOIL_OPTIONS $(basename $oil) > goil.log 2>&1; echo "exit $?" >> goil.log)
+    mv $run $WORK_DIR/$v/$name
+  done
+  count=$((count + 1))
+  if diff -r -q $IGNORED $WORK_DIR/ref/$name $WORK_DIR/new/$name > /dev/null; then
+    echo "SAME $name"
+  else
+    echo "DIFF $name"
+    diff -r $IGNORED $WORK_DIR/ref/$name $WORK_DIR/new/$name | head -n 20
+    failures=$((failures + 1))
+  fi
+done
+
+echo "$failures of $count configurations differ, outputs are in $WORK_DIR"
+[ $failures -eq 0 ]
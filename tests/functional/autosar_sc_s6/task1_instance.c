@@ -0,0 +1,160 @@
+/**
+ * @file autosar_sc_s6/task1_instance.c
+ *
+ * @section desc File description
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline Test Suite
+ *
+ * Trampoline Test Suite is copyright (c) IRCCyN 2005-2007
+ * Trampoline Test Suite is protected by the French intellectual property law.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2
+ * of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+
+/*Instance of task t1*/
+
+#include "Os.h"
+#include "tpl_machine_posix.h"
+
+#define RECORD_MAX 8
+
+DeclareAlarm(Alarm1);
+DeclareAlarm(Alarm2);
+DeclareAlarm(Alarm3);
+DeclareCounter(Hardware_Counter);
+DeclareEvent(Event1);
+DeclareEvent(Event2);
+DeclareTask(t1);
+
+/* the task t2 (2) and the ISR (0) record the value of Hardware_Counter
+   and the virtual date when they run */
+static unsigned char record_source[RECORD_MAX];
+static TickType record_value[RECORD_MAX];
+static unsigned long record_us[RECORD_MAX];
+static unsigned char record_count;
+
+void record_date(unsigned char source)
+{
+	unsigned char count = record_count;
+	
+	if (count < RECORD_MAX)
+	{
+		record_source[count] = source;
+		GetCounterValue(Hardware_Counter, &record_value[count]);
+		record_us[count] = (unsigned long)tpl_posix_virtual_time();
+	}
+	record_count = count + 1;
+}
+
+/*test case:test the advance of a counter by the jumps of the virtual time*/
+static void test_t1_instance(void)
+{
+	StatusType result_inst_1, result_inst_2, result_inst_3, result_inst_4, result_inst_5, result_inst_6, result_inst_7, result_inst_8, result_inst_9, result_inst_10, result_inst_11, result_inst_12, result_inst_13, result_inst_14, result_inst_15, result_inst_16;
+	EventMaskType result_inst_17, result_inst_18;
+	TickType result_inst_19, result_inst_20, result_inst_21;
+	unsigned char i;
+	static const unsigned char expected_source[5] = { 0, 2, 2, 2, 2 };
+	static const TickType expected_value[5] = { 1, 2, 4, 6, 8 };
+	static const unsigned long expected_us[5] = { 23000, 24000, 28000, 32000, 36000 };
+	
+	/* two alarms expiring at the same date: the time jumps 3 counter
+	   increments (6 ticks) at once */
+	SCHEDULING_CHECK_INIT(1);
+	result_inst_1 = SetRelAlarm(Alarm1, 3, 0);
+	result_inst_2 = SetRelAlarm(Alarm2, 3, 0);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(1,E_OK, result_inst_1);
+	SCHEDULING_CHECK_AND_EQUAL_INT(1,E_OK, result_inst_2);
+	
+	SCHEDULING_CHECK_INIT(2);
+	result_inst_3 = WaitEvent(Event1 | Event2);
+	result_inst_4 = GetEvent(t1, &result_inst_17);
+	result_inst_5 = GetCounterValue(Hardware_Counter, &result_inst_19);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(2,E_OK, result_inst_3);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(2,E_OK, result_inst_4);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(2,E_OK, result_inst_5);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(2,(Event1 | Event2), result_inst_17);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(2,3, result_inst_19);
+	SCHEDULING_CHECK_AND_EQUAL_INT(2,6000, (unsigned long)tpl_posix_virtual_time());
+	
+	/* the counter wraps at MAXALLOWEDVALUE during the jump */
+	SCHEDULING_CHECK_INIT(3);
+	result_inst_6 = ClearEvent(Event1 | Event2);
+	result_inst_7 = SetRelAlarm(Alarm1, 8, 0);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(3,E_OK, result_inst_6);
+	SCHEDULING_CHECK_AND_EQUAL_INT(3,E_OK, result_inst_7);
+	
+	SCHEDULING_CHECK_INIT(4);
+	result_inst_8 = WaitEvent(Event1);
+	result_inst_9 = GetCounterValue(Hardware_Counter, &result_inst_20);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(4,E_OK, result_inst_8);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(4,E_OK, result_inst_9);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(4,1, result_inst_20);
+	SCHEDULING_CHECK_AND_EQUAL_INT(4,22000, (unsigned long)tpl_posix_virtual_time());
+	
+	/* a stimulus stops a jump in the middle of a counter increment, then
+	   a cyclic alarm is raised again by each jump and expires together
+	   with Alarm1 at the end */
+	SCHEDULING_CHECK_INIT(5);
+	result_inst_10 = ClearEvent(Event1);
+	result_inst_11 = SetRelAlarm(Alarm3, 1, 2);
+	result_inst_12 = SetRelAlarm(Alarm1, 7, 0);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(5,E_OK, result_inst_10);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(5,E_OK, result_inst_11);
+	SCHEDULING_CHECK_AND_EQUAL_INT(5,E_OK, result_inst_12);
+	
+	SCHEDULING_CHECK_INIT(6);
+	result_inst_13 = WaitEvent(Event1);
+	result_inst_14 = GetEvent(t1, &result_inst_18);
+	result_inst_15 = CancelAlarm(Alarm3);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(6,E_OK, result_inst_13);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(6,E_OK, result_inst_14);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(6,E_OK, result_inst_15);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(6,Event1, result_inst_18);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(6,36000, (unsigned long)tpl_posix_virtual_time());
+	SCHEDULING_CHECK_AND_EQUAL_INT(6,5, record_count);
+	
+	SCHEDULING_CHECK_INIT(7);
+	result_inst_16 = GetAlarm(Alarm1, &result_inst_21);
+	for (i = 0; i < 5; i++)
+	{
+		SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(7,expected_source[i], record_source[i]);
+		SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(7,expected_value[i], record_value[i]);
+		SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(7,expected_us[i], record_us[i]);
+	}
+	SCHEDULING_CHECK_AND_EQUAL_INT(7,E_OS_NOFUNC, result_inst_16);
+}
+
+/*create the test suite with all the test cases*/
+TestRef AutosarSCTest_seq6_t1_instance(void)
+{
+	EMB_UNIT_TESTFIXTURES(fixtures) {
+		new_TestFixture("test_t1_instance",test_t1_instance)
+	};
+	EMB_UNIT_TESTCALLER(AutosarSCTest,"AutosarSCTest_sequence6",NULL,NULL,fixtures);
+	
+	return (TestRef)&AutosarSCTest;
+}
+
+/* End of file autosar_sc_s6/task1_instance.c */